@@ -9,6 +9,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "../common/cbasetypes.hpp"
 #include "../common/cli.hpp"
@@ -264,23 +266,48 @@ DBData char_create_charstatus(DBKey key, va_list args) {
 	return db_ptr2data(cp);
 }
 
+/// Characters with saves that are queued on the asynchronous connections
+struct s_char_save_queued {
+	uint32 account_id;
+	uint32 count;
+};
+static std::unordered_map<uint32, s_char_save_queued> char_save_queued;
+/// Characters whose last save failed, their next save writes everything again
+static std::unordered_set<uint32> char_save_failed;
+
+/**
+ * Waits until the queued saves of a character were executed.
+ * Has to be called before the character is read from the database,
+ * or before its columns are written outside of char_mmo_char_tosql.
+ * @param char_id: Character ID
+ */
+void char_save_flush(uint32 char_id){
+	auto queued = char_save_queued.find(char_id);
+
+	if( queued != char_save_queued.end() )
+		SqlAsync_Flush(queued->second.account_id);
+}
+
 int char_mmo_char_tosql(uint32 char_id, struct mmo_charstatus* p){
 	int i = 0;
 	int count = 0;
 	int diff = 0;
 	char save_status[128]; //For displaying save information. [Skotlex]
 	struct mmo_charstatus *cp;
-	int errors = 0; //If there are any errors while saving, "cp" will not be updated at the end.
 	StringBuf buf;
+	std::vector<std::string> queries;
+	bool force;
 
 	if (char_id!=p->char_id) return 0;
 
 	cp = (struct mmo_charstatus *)idb_ensure(char_db_, char_id, char_create_charstatus);
+	// The cached data might not match the database after a failed save
+	force = char_save_failed.erase(char_id) > 0;
 
 	StringBuf_Init(&buf);
 	memset(save_status, 0, sizeof(save_status));
 
-	if (
+	if ( force ||
 		(p->base_exp != cp->base_exp) || (p->base_level != cp->base_level) ||
 		(p->job_level != cp->job_level) || (p->job_exp != cp->job_exp) ||
 		(p->zeny != cp->zeny) ||
@@ -302,7 +329,8 @@ int char_mmo_char_tosql(uint32 char_id, struct mmo_charstatus* p){
 		(p->show_equip != cp->show_equip) || (p->hotkey_rowshift2 != cp->hotkey_rowshift2)
 	)
 	{	//Save status
-		if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `base_level`='%d', `job_level`='%d',"
+		StringBuf_Clear(&buf);
+		StringBuf_Printf(&buf, "UPDATE `%s` SET `base_level`='%d', `job_level`='%d',"
 			"`base_exp`='%" PRIu64 "', `job_exp`='%" PRIu64 "', `zeny`='%d',"
 			"`max_hp`='%u',`hp`='%u',`max_sp`='%u',`sp`='%u',`status_point`='%d',`skill_point`='%d',"
 			"`str`='%d',`agi`='%d',`vit`='%d',`int`='%d',`dex`='%d',`luk`='%d',"
@@ -323,16 +351,13 @@ int char_mmo_char_tosql(uint32 char_id, struct mmo_charstatus* p){
 			(unsigned long)p->delete_date, // FIXME: platform-dependent size
 			p->robe, p->character_moves, p->font, p->uniqueitem_counter,
 			p->hotkey_rowshift, p->clan_id, p->title_id, p->show_equip, p->hotkey_rowshift2,
-			p->account_id, p->char_id) )
-		{
-			Sql_ShowDebug(sql_handle);
-			errors++;
-		} else
-			strcat(save_status, " status");
+			p->account_id, p->char_id);
+		queries.emplace_back(StringBuf_Value(&buf));
+		strcat(save_status, " status");
 	}
 
 	//Values that will seldom change (to speed up saving)
-	if (
+	if ( force ||
 		(p->hair != cp->hair) || (p->hair_color != cp->hair_color) || (p->clothes_color != cp->clothes_color) ||
 		(p->body != cp->body) || (p->class_ != cp->class_) ||
 		(p->partner_id != cp->partner_id) || (p->father != cp->father) ||
@@ -341,7 +366,8 @@ int char_mmo_char_tosql(uint32 char_id, struct mmo_charstatus* p){
 		(p->fame != cp->fame)
 	)
 	{
-		if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `class`='%d',"
+		StringBuf_Clear(&buf);
+		StringBuf_Printf(&buf, "UPDATE `%s` SET `class`='%d',"
 			"`hair`='%d', `hair_color`='%d', `clothes_color`='%d', `body`='%d',"
 			"`partner_id`='%u', `father`='%u', `mother`='%u', `child`='%u',"
 			"`karma`='%d',`manner`='%d', `fame`='%d'"
@@ -350,16 +376,13 @@ int char_mmo_char_tosql(uint32 char_id, struct mmo_charstatus* p){
 			p->hair, p->hair_color, p->clothes_color, p->body,
 			p->partner_id, p->father, p->mother, p->child,
 			p->karma, p->manner, p->fame,
-			p->account_id, p->char_id) )
-		{
-			Sql_ShowDebug(sql_handle);
-			errors++;
-		} else
-			strcat(save_status, " status2");
+			p->account_id, p->char_id);
+		queries.emplace_back(StringBuf_Value(&buf));
+		strcat(save_status, " status2");
 	}
 
 	/* Mercenary Owner */
-	if( (p->mer_id != cp->mer_id) ||
+	if( force || (p->mer_id != cp->mer_id) ||
 		(p->arch_calls != cp->arch_calls) || (p->arch_faith != cp->arch_faith) ||
 		(p->spear_calls != cp->spear_calls) || (p->spear_faith != cp->spear_faith) ||
 		(p->sword_calls != cp->sword_calls) || (p->sword_faith != cp->sword_faith) )
@@ -367,20 +390,18 @@ int char_mmo_char_tosql(uint32 char_id, struct mmo_charstatus* p){
 		if (mercenary_owner_tosql(char_id, p))
 			strcat(save_status, " mercenary");
 		else
-			errors++;
+			char_save_failed.insert(char_id);
 	}
 
 	//memo points
-	if( memcmp(p->memo_point, cp->memo_point, sizeof(p->memo_point)) )
+	if( force || memcmp(p->memo_point, cp->memo_point, sizeof(p->memo_point)) )
 	{
 		char esc_mapname[NAME_LENGTH*2+1];
 
 		//`memo` (`memo_id`,`char_id`,`map`,`x`,`y`)
-		if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `char_id`='%d'", schema_config.memo_db, p->char_id) )
-		{
-			Sql_ShowDebug(sql_handle);
-			errors++;
-		}
+		StringBuf_Clear(&buf);
+		StringBuf_Printf(&buf, "DELETE FROM `%s` WHERE `char_id`='%d'", schema_config.memo_db, p->char_id);
+		queries.emplace_back(StringBuf_Value(&buf));
 
 		//insert here.
 		StringBuf_Clear(&buf);
@@ -397,25 +418,17 @@ int char_mmo_char_tosql(uint32 char_id, struct mmo_charstatus* p){
 			}
 		}
 		if( count )
-		{
-			if( SQL_ERROR == Sql_QueryStr(sql_handle, StringBuf_Value(&buf)) )
-			{
-				Sql_ShowDebug(sql_handle);
-				errors++;
-			}
-		}
+			queries.emplace_back(StringBuf_Value(&buf));
 		strcat(save_status, " memo");
 	}
 
 	//skills
-	if( memcmp(p->skill, cp->skill, sizeof(p->skill)) )
+	if( force || memcmp(p->skill, cp->skill, sizeof(p->skill)) )
 	{
 		//`skill` (`char_id`, `id`, `lv`)
-		if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `char_id`='%d'", schema_config.skill_db, p->char_id) )
-		{
-			Sql_ShowDebug(sql_handle);
-			errors++;
-		}
+		StringBuf_Clear(&buf);
+		StringBuf_Printf(&buf, "DELETE FROM `%s` WHERE `char_id`='%d'", schema_config.skill_db, p->char_id);
+		queries.emplace_back(StringBuf_Value(&buf));
 
 		StringBuf_Clear(&buf);
 		StringBuf_Printf(&buf, "INSERT INTO `%s`(`char_id`,`id`,`lv`,`flag`) VALUES ", schema_config.skill_db);
@@ -436,19 +449,13 @@ int char_mmo_char_tosql(uint32 char_id, struct mmo_charstatus* p){
 			}
 		}
 		if( count )
-		{
-			if( SQL_ERROR == Sql_QueryStr(sql_handle, StringBuf_Value(&buf)) )
-			{
-				Sql_ShowDebug(sql_handle);
-				errors++;
-			}
-		}
+			queries.emplace_back(StringBuf_Value(&buf));
 
 		strcat(save_status, " skills");
 	}
 
-	diff = 0;
-	for(i = 0; i < MAX_FRIENDS; i++){
+	diff = force ? 1 : 0;
+	for(i = 0; i < MAX_FRIENDS && !diff; i++){
 		if(p->friends[i].char_id != cp->friends[i].char_id ||
 			p->friends[i].account_id != cp->friends[i].account_id){
 			diff = 1;
@@ -458,11 +465,9 @@ int char_mmo_char_tosql(uint32 char_id, struct mmo_charstatus* p){
 
 	if(diff == 1)
 	{	//Save friends
-		if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `char_id`='%d'", schema_config.friend_db, char_id) )
-		{
-			Sql_ShowDebug(sql_handle);
-			errors++;
-		}
+		StringBuf_Clear(&buf);
+		StringBuf_Printf(&buf, "DELETE FROM `%s` WHERE `char_id`='%d'", schema_config.friend_db, char_id);
+		queries.emplace_back(StringBuf_Value(&buf));
 
 		StringBuf_Clear(&buf);
 		StringBuf_Printf(&buf, "INSERT INTO `%s` (`char_id`, `friend_id`) VALUES ", schema_config.friend_db);
@@ -477,13 +482,7 @@ int char_mmo_char_tosql(uint32 char_id, struct mmo_charstatus* p){
 			}
 		}
 		if( count )
-		{
-			if( SQL_ERROR == Sql_QueryStr(sql_handle, StringBuf_Value(&buf)) )
-			{
-				Sql_ShowDebug(sql_handle);
-				errors++;
-			}
-		}
+			queries.emplace_back(StringBuf_Value(&buf));
 		strcat(save_status, " friends");
 	}
 
@@ -493,7 +492,7 @@ int char_mmo_char_tosql(uint32 char_id, struct mmo_charstatus* p){
 	StringBuf_Printf(&buf, "REPLACE INTO `%s` (`char_id`, `hotkey`, `type`, `itemskill_id`, `skill_lvl`) VALUES ", schema_config.hotkey_db);
 	diff = 0;
 	for(i = 0; i < ARRAYLENGTH(p->hotkeys); i++){
-		if(memcmp(&p->hotkeys[i], &cp->hotkeys[i], sizeof(struct hotkey)))
+		if(force || memcmp(&p->hotkeys[i], &cp->hotkeys[i], sizeof(struct hotkey)))
 		{
 			if( diff )
 				StringBuf_AppendStr(&buf, ",");// not the first hotkey
@@ -502,31 +501,189 @@ int char_mmo_char_tosql(uint32 char_id, struct mmo_charstatus* p){
 		}
 	}
 	if(diff) {
-		if( SQL_ERROR == Sql_QueryStr(sql_handle, StringBuf_Value(&buf)) )
-		{
-			Sql_ShowDebug(sql_handle);
-			errors++;
-		} else
-			strcat(save_status, " hotkeys");
+		queries.emplace_back(StringBuf_Value(&buf));
+		strcat(save_status, " hotkeys");
 	}
 #endif
 	StringBuf_Destroy(&buf);
-	if (save_status[0]!='\0' && charserv_config.save_log)
-		ShowInfo("Saved char %d - %s:%s.\n", char_id, p->name, save_status);
-	if (!errors)
-		memcpy(cp, p, sizeof(struct mmo_charstatus));
+
+	// The cache already holds the new data, other requests might read it before the queries were executed
+	memcpy(cp, p, sizeof(struct mmo_charstatus));
+
+	if( queries.empty() ){
+		if (save_status[0]!='\0' && charserv_config.save_log)
+			ShowInfo("Saved char %d - %s:%s.\n", char_id, p->name, save_status);
+		return 0;
+	}
+
+	s_char_save_queued& queued = char_save_queued[char_id];
+
+	queued.account_id = p->account_id;
+	queued.count++;
+
+	std::string name( p->name );
+	std::string status( save_status );
+
+	// Saves of the same account are executed in the order they were queued
+	SqlAsync_Queue(p->account_id, std::move(queries), [char_id, name, status]( const s_sql_async_result& result ){
+		auto queued = char_save_queued.find(char_id);
+
+		if( queued != char_save_queued.end() && --queued->second.count == 0 )
+			char_save_queued.erase(queued);
+
+		if( result.failed > 0 ){
+			ShowError("Failed to save char %d - %s, it will be saved completely on its next save.\n", char_id, name.c_str());
+			char_save_failed.insert(char_id);
+		}else if( charserv_config.save_log )
+			ShowInfo("Saved char %d - %s:%s.\n", char_id, name.c_str(), status.c_str());
+	});
+
 	return 0;
 }
 
+#define CHAR_ITEM_BATCH_ROWS 200 /// Max rows per batched upsert or delete of char_memitemdata_to_sql
+
+/// Queries of an item table, built and prepared once per table
+struct s_item_table_queries {
+	SqlStmt* select; ///< Rows of an owner, bound to item_table_owner
+	std::string upsert; ///< Insert head of the batched upsert, up to VALUES
+	std::string update; ///< On duplicate key clause of the batched upsert
+};
+
+/// Cached queries, per table name
+static std::unordered_map<std::string, s_item_table_queries> item_table_queries;
+/// Parameter of the cached select statements
+static int item_table_owner;
+
+/**
+ * Get the cached queries of an item table, preparing them on first use.
+ * @param tablename: item table
+ * @param selectoption: owner column of the table
+ * @param inventory: whether the table has the inventory only columns
+ * @return cached queries or NULL if the select could not be prepared
+ */
+static s_item_table_queries* char_item_table_queries(const char* tablename, const char* selectoption, bool inventory) {
+	auto it = item_table_queries.find(tablename);
+
+	if( it != item_table_queries.end() )
+		return &it->second;
+
+	StringBuf buf;
+	StringBuf columns;
+	int i;
+
+	// columns shared by the select and the upsert, after `nameid`
+	StringBuf_Init(&columns);
+	StringBuf_AppendStr(&columns, "`amount`, `equip`, `identify`, `refine`, `attribute`, `expire_time`, `bound`, `unique_id`, `enchantgrade`");
+	if( inventory )
+		StringBuf_AppendStr(&columns, ", `favorite`, `equip_switch`");
+	for( i = 0; i < MAX_SLOTS; ++i )
+		StringBuf_Printf(&columns, ", `card%d`", i);
+	for( i = 0; i < MAX_ITEM_RDM_OPT; ++i ) {
+		StringBuf_Printf(&columns, ", `option_id%d`", i);
+		StringBuf_Printf(&columns, ", `option_val%d`", i);
+		StringBuf_Printf(&columns, ", `option_parm%d`", i);
+	}
+
+	StringBuf_Init(&buf);
+	StringBuf_Printf(&buf, "SELECT `id`, `nameid`, %s FROM `%s` WHERE `%s`=?", StringBuf_Value(&columns), tablename, selectoption);
+
+	SqlStmt* stmt = SqlStmt_Malloc(sql_handle);
+
+	if( SQL_ERROR == SqlStmt_PrepareStr(stmt, StringBuf_Value(&buf)) ){
+		SqlStmt_ShowDebug(stmt);
+		SqlStmt_Free(stmt);
+		StringBuf_Destroy(&buf);
+		StringBuf_Destroy(&columns);
+		return NULL;
+	}
+
+	s_item_table_queries& queries = item_table_queries[tablename];
+
+	queries.select = stmt;
+
+	StringBuf_Clear(&buf);
+	StringBuf_Printf(&buf, "INSERT INTO `%s`(`id`, `%s`, `nameid`, %s) VALUES ", tablename, selectoption, StringBuf_Value(&columns));
+	queries.upsert = StringBuf_Value(&buf);
+
+	// every column but the id, owner and nameid, which identify the item
+	StringBuf_Clear(&buf);
+	StringBuf_AppendStr(&buf, " ON DUPLICATE KEY UPDATE ");
+	for( const char* column = StringBuf_Value(&columns); *column != '\0'; ){
+		const char* next = strchr(column, ',');
+		size_t len = ( next != NULL ) ? next - column : strlen(column);
+
+		StringBuf_Printf(&buf, "%s%.*s=VALUES(%.*s)", ( column == StringBuf_Value(&columns) ) ? "" : ", ", (int)len, column, (int)len, column);
+		column += len;
+		if( *column == ',' )
+			column += 2;
+	}
+	queries.update = StringBuf_Value(&buf);
+
+	StringBuf_Destroy(&buf);
+	StringBuf_Destroy(&columns);
+
+	return &queries;
+}
+
+/**
+ * Forget the cached queries of an item table.
+ *  Used when the prepared statement became invalid, for example after a reconnection.
+ * @param tablename: item table
+ */
+static void char_item_table_queries_remove(const char* tablename) {
+	auto it = item_table_queries.find(tablename);
+
+	if( it == item_table_queries.end() )
+		return;
+
+	SqlStmt_Free(it->second.select);
+	item_table_queries.erase(it);
+}
+
+/**
+ * Append a row of the batched upsert of char_memitemdata_to_sql.
+ * @param buf: query to append to
+ * @param item: item to save
+ * @param dbid: id of the row to update, 0 to insert a new row
+ * @param owner: id of the owner of the item
+ * @param inventory: whether the table has the inventory only columns
+ */
+static void char_memitemdata_row(StringBuf* buf, const struct item* item, int dbid, int owner, bool inventory) {
+	int j;
+
+	if( dbid != 0 )
+		StringBuf_Printf(buf, "('%d'", dbid);
+	else
+		StringBuf_AppendStr(buf, "(NULL");
+
+	StringBuf_Printf(buf, ", '%d', '%u', '%d', '%u', '%d', '%d', '%d', '%u', '%d', '%" PRIu64 "', '%d'",
+		owner, item->nameid, item->amount, item->equip, item->identify, item->refine, item->attribute, item->expire_time, item->bound, item->unique_id, item->enchantgrade);
+	if( inventory )
+		StringBuf_Printf(buf, ", '%d', '%u'", item->favorite, item->equipSwitch);
+	for( j = 0; j < MAX_SLOTS; ++j )
+		StringBuf_Printf(buf, ", '%u'", item->card[j]);
+	for( j = 0; j < MAX_ITEM_RDM_OPT; ++j ) {
+		StringBuf_Printf(buf, ", '%d'", item->option[j].id);
+		StringBuf_Printf(buf, ", '%d'", item->option[j].value);
+		StringBuf_Printf(buf, ", '%d'", item->option[j].param);
+	}
+	StringBuf_AppendStr(buf, ")");
+}
+
 /// Saves an array of 'item' entries into the specified table.
 int char_memitemdata_to_sql(const struct item items[], int max, int id, enum storage_type tableswitch, uint8 stor_id) {
 	StringBuf buf;
 	SqlStmt* stmt;
-	int i, j, offset = 0, errors = 0;
+	s_item_table_queries* queries;
+	int i, j, offset = 0, errors = 0, rows;
 	const char *tablename, *selectoption, *printname;
 	struct item item; // temp storage variable
 	bool* flag; // bit array for inventory matching
 	bool found;
+	bool inventory = ( tableswitch == TABLE_INVENTORY );
+	std::vector<std::pair<int, int>> updates; // changed items: row id, index in items
+	std::vector<int> deletes; // row ids of the removed items
 
 	switch (tableswitch) {
 		case TABLE_INVENTORY:
@@ -558,33 +715,31 @@ int char_memitemdata_to_sql(const struct item items[], int max, int id, enum sto
 	// and performs modification/deletion/insertion only on relevant rows.
 	// This approach is more complicated than a trivial delete&insert, but
 	// it significantly reduces cpu load on the database server.
+	// The changes are then written in a few batched queries:
+	// one upsert per CHAR_ITEM_BATCH_ROWS changed or new items,
+	// and one delete per CHAR_ITEM_BATCH_ROWS removed items.
 
-	StringBuf_Init(&buf);
-	StringBuf_AppendStr(&buf, "SELECT `id`, `nameid`, `amount`, `equip`, `identify`, `refine`, `attribute`, `expire_time`, `bound`, `unique_id`, `enchantgrade`");
-	if (tableswitch == TABLE_INVENTORY) {
-		StringBuf_Printf(&buf, ", `favorite`, `equip_switch`");
-		offset = 2;
-	}
+	for( i = 0; ; i++ ){
+		if( ( queries = char_item_table_queries(tablename, selectoption, inventory) ) == NULL )
+			return 1;
 
-	for( i = 0; i < MAX_SLOTS; ++i )
-		StringBuf_Printf(&buf, ", `card%d`", i);
-	for( i = 0; i < MAX_ITEM_RDM_OPT; ++i ) {
-		StringBuf_Printf(&buf, ", `option_id%d`", i);
-		StringBuf_Printf(&buf, ", `option_val%d`", i);
-		StringBuf_Printf(&buf, ", `option_parm%d`", i);
-	}
-	StringBuf_Printf(&buf, " FROM `%s` WHERE `%s`='%d'", tablename, selectoption, id);
+		stmt = queries->select;
+		item_table_owner = id;
+
+		if( SQL_SUCCESS == SqlStmt_BindParam(stmt, 0, SQLDT_INT, &item_table_owner, 0)
+		&&  SQL_SUCCESS == SqlStmt_Execute(stmt) )
+			break;
 
-	stmt = SqlStmt_Malloc(sql_handle);
-	if( SQL_ERROR == SqlStmt_PrepareStr(stmt, StringBuf_Value(&buf))
-	||  SQL_ERROR == SqlStmt_Execute(stmt) )
-	{
 		SqlStmt_ShowDebug(stmt);
-		SqlStmt_Free(stmt);
-		StringBuf_Destroy(&buf);
-		return 1;
+		// the statement does not survive a reconnection, prepare it again once
+		char_item_table_queries_remove(tablename);
+		if( i > 0 )
+			return 1;
 	}
 
+	if (inventory)
+		offset = 2;
+
 	SqlStmt_BindColumn(stmt, 0, SQLDT_INT,       &item.id,          0, NULL, NULL);
 	SqlStmt_BindColumn(stmt, 1, SQLDT_UINT,      &item.nameid,      0, NULL, NULL);
 	SqlStmt_BindColumn(stmt, 2, SQLDT_SHORT,     &item.amount,      0, NULL, NULL);
@@ -596,7 +751,7 @@ int char_memitemdata_to_sql(const struct item items[], int max, int id, enum sto
 	SqlStmt_BindColumn(stmt, 8, SQLDT_UINT,      &item.bound,       0, NULL, NULL);
 	SqlStmt_BindColumn(stmt, 9, SQLDT_UINT64,    &item.unique_id,   0, NULL, NULL);
 	SqlStmt_BindColumn(stmt,10, SQLDT_INT8,      &item.enchantgrade,0, NULL, NULL);
-	if (tableswitch == TABLE_INVENTORY){
+	if (inventory){
 		SqlStmt_BindColumn(stmt, 11, SQLDT_CHAR, &item.favorite,    0, NULL, NULL);
 		SqlStmt_BindColumn(stmt, 12, SQLDT_UINT, &item.equipSwitch, 0, NULL, NULL);
 	}
@@ -641,91 +796,80 @@ int char_memitemdata_to_sql(const struct item items[], int max, int id, enum sto
 					items[i].expire_time == item.expire_time &&
 					items[i].bound == item.bound &&
 					items[i].enchantgrade == item.enchantgrade &&
-					(tableswitch != TABLE_INVENTORY || (items[i].favorite == item.favorite && items[i].equipSwitch == item.equipSwitch)) )
+					(!inventory || (items[i].favorite == item.favorite && items[i].equipSwitch == item.equipSwitch)) )
 				;	//Do nothing.
 				else
-				{
-					// update all fields.
-					StringBuf_Clear(&buf);
-					StringBuf_Printf(&buf, "UPDATE `%s` SET `amount`='%d', `equip`='%u', `identify`='%d', `refine`='%d',`attribute`='%d', `expire_time`='%u', `bound`='%d', `unique_id`='%" PRIu64 "', `enchantgrade`='%d'",
-						tablename, items[i].amount, items[i].equip, items[i].identify, items[i].refine, items[i].attribute, items[i].expire_time, items[i].bound, items[i].unique_id, items[i].enchantgrade);
-					if (tableswitch == TABLE_INVENTORY)
-						StringBuf_Printf(&buf, ", `favorite`='%d', `equip_switch`='%u'", items[i].favorite, items[i].equipSwitch);
-					for( j = 0; j < MAX_SLOTS; ++j )
-						StringBuf_Printf(&buf, ", `card%d`=%u", j, items[i].card[j]);
-					for( j = 0; j < MAX_ITEM_RDM_OPT; ++j ) {
-						StringBuf_Printf(&buf, ", `option_id%d`=%d", j, items[i].option[j].id);
-						StringBuf_Printf(&buf, ", `option_val%d`=%d", j, items[i].option[j].value);
-						StringBuf_Printf(&buf, ", `option_parm%d`=%d", j, items[i].option[j].param);
-					}
-					StringBuf_Printf(&buf, " WHERE `id`='%d' LIMIT 1", item.id);
-
-					if( SQL_ERROR == Sql_QueryStr(sql_handle, StringBuf_Value(&buf)) )
-					{
-						Sql_ShowDebug(sql_handle);
-						errors++;
-					}
-				}
+					updates.push_back(std::make_pair((int)item.id, i)); // update all fields.
 
 				found = flag[i] = true; //Item dealt with,
 				break; //skip to next item in the db.
 			}
 		}
 		if( !found )
-		{// Item not present in inventory, remove it.
-			if( SQL_ERROR == Sql_Query(sql_handle, "DELETE from `%s` where `id`='%d' LIMIT 1", tablename, item.id) )
+			deletes.push_back((int)item.id); // Item not present in inventory, remove it.
+	}
+	SqlStmt_FreeResult(stmt);
+
+	StringBuf_Init(&buf);
+
+	// remove the items that are gone
+	for( size_t n = 0; n < deletes.size(); n += CHAR_ITEM_BATCH_ROWS ){
+		StringBuf_Clear(&buf);
+		StringBuf_Printf(&buf, "DELETE FROM `%s` WHERE `id` IN (", tablename);
+		for( size_t m = n; m < deletes.size() && m < n + CHAR_ITEM_BATCH_ROWS; m++ )
+			StringBuf_Printf(&buf, "%s'%d'", ( m == n ) ? "" : ",", deletes[m]);
+		StringBuf_AppendStr(&buf, ")");
+
+		if( SQL_ERROR == Sql_QueryStr(sql_handle, StringBuf_Value(&buf)) )
+		{
+			Sql_ShowDebug(sql_handle);
+			errors++;
+		}
+	}
+
+	// update the changed items and insert the non-matched items as new items
+	rows = 0;
+	for( i = 0; ; ++i )
+	{
+		const struct item* row;
+		int dbid;
+
+		if( i < (int)updates.size() ){
+			dbid = updates[i].first;
+			row = &items[updates[i].second];
+		}else if( i - (int)updates.size() < max ){
+			// skip empty and already matched entries
+			j = i - (int)updates.size();
+			if( items[j].nameid == 0 || flag[j] )
+				continue;
+			dbid = 0;
+			row = &items[j];
+		}else
+			row = NULL;
+
+		// send the batch when it is full or when all items were added
+		if( rows > 0 && ( row == NULL || rows == CHAR_ITEM_BATCH_ROWS ) ){
+			StringBuf_AppendStr(&buf, queries->update.c_str());
+
+			if( SQL_ERROR == Sql_QueryStr(sql_handle, StringBuf_Value(&buf)) )
 			{
 				Sql_ShowDebug(sql_handle);
 				errors++;
 			}
+			rows = 0;
 		}
-	}
-	SqlStmt_Free(stmt);
 
-	StringBuf_Clear(&buf);
-	StringBuf_Printf(&buf, "INSERT INTO `%s`(`%s`, `nameid`, `amount`, `equip`, `identify`, `refine`, `attribute`, `expire_time`, `bound`, `unique_id`, `enchantgrade`", tablename, selectoption);
-	if (tableswitch == TABLE_INVENTORY)
-		StringBuf_Printf(&buf, ", `favorite`, `equip_switch`");
-	for( j = 0; j < MAX_SLOTS; ++j )
-		StringBuf_Printf(&buf, ", `card%d`", j);
-	for( j = 0; j < MAX_ITEM_RDM_OPT; ++j ) {
-		StringBuf_Printf(&buf, ", `option_id%d`", j);
-		StringBuf_Printf(&buf, ", `option_val%d`", j);
-		StringBuf_Printf(&buf, ", `option_parm%d`", j);
-	}
-	StringBuf_AppendStr(&buf, ") VALUES ");
-
-	found = false;
-	// insert non-matched items into the db as new items
-	for( i = 0; i < max; ++i )
-	{
-		// skip empty and already matched entries
-		if( items[i].nameid == 0 || flag[i] )
-			continue;
+		if( row == NULL )
+			break;
 
-		if( found )
+		if( rows == 0 ){
+			StringBuf_Clear(&buf);
+			StringBuf_AppendStr(&buf, queries->upsert.c_str());
+		}else
 			StringBuf_AppendStr(&buf, ",");
-		else
-			found = true;
-
-		StringBuf_Printf(&buf, "('%d', '%u', '%d', '%u', '%d', '%d', '%d', '%u', '%d', '%" PRIu64 "', '%d'",
-			id, items[i].nameid, items[i].amount, items[i].equip, items[i].identify, items[i].refine, items[i].attribute, items[i].expire_time, items[i].bound, items[i].unique_id, items[i].enchantgrade);
-		if (tableswitch == TABLE_INVENTORY)
-			StringBuf_Printf(&buf, ", '%d', '%u'", items[i].favorite, items[i].equipSwitch);
-		for( j = 0; j < MAX_SLOTS; ++j )
-			StringBuf_Printf(&buf, ", '%u'", items[i].card[j]);
-		for( j = 0; j < MAX_ITEM_RDM_OPT; ++j ) {
-			StringBuf_Printf(&buf, ", '%d'", items[i].option[j].id);
-			StringBuf_Printf(&buf, ", '%d'", items[i].option[j].value);
-			StringBuf_Printf(&buf, ", '%d'", items[i].option[j].param);
-		}
-		StringBuf_AppendStr(&buf, ")");
-	}
 
-	if( found && SQL_ERROR == Sql_QueryStr(sql_handle, StringBuf_Value(&buf)) )
-	{
-		Sql_ShowDebug(sql_handle);
-		errors++;
+		char_memitemdata_row(&buf, row, dbid, id, inventory);
+		rows++;
 	}
 
 	ShowInfo("Saved %s (%d) data to table %s for %s: %d\n", printname, stor_id, tablename, selectoption, id);
@@ -905,6 +1049,9 @@ int char_mmo_chars_fromsql(struct char_session_data* sd, uint8* buf, uint8* coun
 	char last_map[MAP_NAME_LENGTH_EXT];
 	char sex[2];
 
+	// Wait for the queued saves of the account
+	SqlAsync_Flush(sd->account_id);
+
 	stmt = SqlStmt_Malloc(sql_handle);
 	if( stmt == NULL ) {
 		SqlStmt_ShowDebug(stmt);
@@ -1026,6 +1173,8 @@ int char_mmo_char_fromsql(uint32 char_id, struct mmo_charstatus* p, bool load_ev
 
 	if (charserv_config.save_log) ShowInfo("Char load request (%d)\n", char_id);
 
+	char_save_flush(char_id);
+
 	stmt = SqlStmt_Malloc(sql_handle);
 	if( stmt == NULL )
 	{
@@ -1519,6 +1668,8 @@ int char_make_new_char( struct char_session_data* sd, char* name_, int str, int
 /* Divorce Players */
 /*----------------------------------------------------------------------------------------------------------*/
 int char_divorce_char_sql(int partner_id1, int partner_id2){
+	char_save_flush(partner_id1);
+	char_save_flush(partner_id2);
 	if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `partner_id`='0' WHERE `char_id`='%d' OR `char_id`='%d' LIMIT 2", schema_config.char_db, partner_id1, partner_id2) )
 		Sql_ShowDebug(sql_handle);
 	if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE (`nameid`='%u' OR `nameid`='%u') AND (`char_id`='%d' OR `char_id`='%d') LIMIT 2", schema_config.inventory_db, WEDDING_RING_M, WEDDING_RING_F, partner_id1, partner_id2) )
@@ -1551,6 +1702,9 @@ enum e_char_del_response char_delete(struct char_session_data* sd, uint32 char_i
 		return CHAR_DELETE_NOTFOUND;
 	}
 
+	// The queued saves must not write the character again after it was deleted
+	SqlAsync_Flush(sd->account_id);
+
 	if (SQL_ERROR == Sql_Query(sql_handle, "SELECT `name`,`account_id`,`party_id`,`guild_id`,`base_level`,`homun_id`,`partner_id`,`father`,`mother`,`elemental_id`,`delete_date` FROM `%s` WHERE `account_id`='%u' AND `char_id`='%u'", schema_config.char_db, sd->account_id, char_id)){
 		Sql_ShowDebug(sql_handle);
 		return CHAR_DELETE_DATABASE;
@@ -1612,6 +1766,8 @@ enum e_char_del_response char_delete(struct char_session_data* sd, uint32 char_i
 	{ // Char is Baby
 		unsigned char buf[64];
 
+		char_save_flush(father_id);
+		char_save_flush(mother_id);
 		if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `child`='0' WHERE `char_id`='%d' OR `char_id`='%d'", schema_config.char_db, father_id, mother_id) )
 			Sql_ShowDebug(sql_handle);
 		if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `id` = '410' AND (`char_id`='%d' OR `char_id`='%d')", schema_config.skill_db, father_id, mother_id) )
@@ -2012,6 +2168,9 @@ void char_read_fame_list(void)
 	char* data;
 	size_t len;
 
+	// The ranking is read from the saved fame of all characters
+	SqlAsync_FlushAll();
+
 	// Empty ranking lists
 	memset(smith_fame_list, 0, sizeof(smith_fame_list));
 	memset(chemist_fame_list, 0, sizeof(chemist_fame_list));
@@ -2219,6 +2378,7 @@ TIMER_FUNC(char_clan_member_cleanup){
 		return 0;
 	}
 
+	SqlAsync_FlushAll(); // the last saves of characters that went offline might still be queued
 	if( SQL_ERROR == Sql_Query( sql_handle, "UPDATE `%s` SET `clan_id`='0' WHERE `online`='0' AND `clan_id`<>'0' AND `last_login` IS NOT NULL AND `last_login` <= NOW() - INTERVAL %d DAY", schema_config.char_db, charserv_config.clan_remove_inactive_days ) ){
 		Sql_ShowDebug(sql_handle);
 	}
@@ -3139,6 +3299,10 @@ void do_final(void)
 		char_fd = -1;
 	}
 
+	for( auto& queries : item_table_queries )
+		SqlStmt_Free(queries.second.select);
+	item_table_queries.clear();
+
 	Sql_Free(sql_handle);
 	mapindex_final();
 
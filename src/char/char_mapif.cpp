@@ -395,22 +395,48 @@ int chmapif_parse_reqsavechar(int fd, int id){
 		return 0;
 	else {
 		int aid = RFIFOL(fd,4), cid = RFIFOL(fd,8), size = RFIFOW(fd,2);
+		uint8 sections = RFIFOB(fd,13);
 		struct online_char_data* character;
 		DBMap* online_char_db = char_get_onlinedb();
 
-		if (size - 13 != sizeof(struct mmo_charstatus))
+		if (size < 14 || size != charstatus_save_length(sections))
 		{
-			ShowError("parse_from_map (save-char): Size mismatch! %d != %" PRIuPTR "\n", size-13, sizeof(struct mmo_charstatus));
+			ShowError("parse_from_map (save-char): Size mismatch! %d != %" PRIuPTR "\n", size, charstatus_save_length(sections));
 			RFIFOSKIP(fd,size);
 			return 1;
 		}
 		//Check account only if this ain't final save. Final-save goes through because of the char-map reconnect
-		if (RFIFOB(fd,12) || RFIFOB(fd,13) || (
+		//Saves that carry sections also go through, the first save after a reconnect carries all of them
+		if (RFIFOB(fd,12) || sections != 0 || (
 			(character = (struct online_char_data*)idb_get(online_char_db, aid)) != NULL &&
 			character->char_id == cid))
 		{
 			struct mmo_charstatus char_dat;
-			memcpy(&char_dat, RFIFOP(fd,13), sizeof(struct mmo_charstatus));
+			struct mmo_charstatus* cp = (struct mmo_charstatus*)idb_get(char_get_chardb(), cid);
+			size_t offset, length, pos = 14;
+
+			// The sections that were not sent did not change since the last save, take them from the cache
+			if( cp != NULL )
+				memcpy(&char_dat, cp, sizeof(struct mmo_charstatus));
+			else if( sections != ( 1 << CHARSTATUS_SECTION_MAX ) - 1 && !char_mmo_char_fromsql(cid, &char_dat, true) ){
+				ShowError("parse_from_map (save-char): Could not load character %d to complete its save.\n", cid);
+				RFIFOSKIP(fd,size);
+				return 1;
+			}
+
+			memcpy(&char_dat, RFIFOP(fd,pos), CHARSTATUS_SECTIONS_BEGIN);
+			pos += CHARSTATUS_SECTIONS_BEGIN;
+			memcpy((uint8*)&char_dat + charstatus_sections_end(), RFIFOP(fd,pos), sizeof(struct mmo_charstatus) - charstatus_sections_end());
+			pos += sizeof(struct mmo_charstatus) - charstatus_sections_end();
+
+			for( int i = 0; i < CHARSTATUS_SECTION_MAX; i++ ){
+				if( sections & ( 1 << i ) ){
+					charstatus_section_range(i, &offset, &length);
+					memcpy((uint8*)&char_dat + offset, RFIFOP(fd,pos), length);
+					pos += length;
+				}
+			}
+
 			char_mmo_char_tosql(cid, &char_dat);
 		} else {	//This may be valid on char-server reconnection, when re-sending characters that already logged off.
 			ShowError("parse_from_map (save-char): Received data for non-existant/offline character (%d:%d).\n", aid, cid);
@@ -1241,6 +1267,7 @@ int chmapif_parse_reqcharunban(int fd){
 		RFIFOSKIP(fd,6+NAME_LENGTH);
 
 		Sql_EscapeStringLen(sql_handle, esc_name, name, strnlen(name, NAME_LENGTH));
+		SqlAsync_FlushAll(); // the character is only known by name
 		if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `unban_time` = '0' WHERE `name` = '%s' LIMIT 1", schema_config.char_db, esc_name) ) {
 			Sql_ShowDebug(sql_handle);
 			return 1;
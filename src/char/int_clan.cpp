@@ -11,6 +11,7 @@
 #include "../common/mmo.hpp"
 #include "../common/showmsg.hpp"
 #include "../common/socket.hpp"
+#include "../common/sql.hpp"
 #include "../common/strlib.hpp"
 
 #include "char.hpp"
@@ -21,6 +22,7 @@
 static DBMap* clan_db; // int clan_id -> struct clan*
 
 int inter_clan_removemember_tosql(uint32 account_id, uint32 char_id){
+	SqlAsync_Flush(account_id);
 	if( SQL_ERROR == Sql_Query( sql_handle, "UPDATE `%s` SET `clan_id` = '0' WHERE `char_id` = '%d'", schema_config.char_db, char_id ) ){
 		Sql_ShowDebug( sql_handle );
 		return 1;
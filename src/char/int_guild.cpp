@@ -93,6 +93,7 @@ TIMER_FUNC(guild_save_timer){
 
 int inter_guild_removemember_tosql(uint32 char_id)
 {
+	char_save_flush(char_id);
 	if( SQL_ERROR == Sql_Query(sql_handle, "DELETE from `%s` where `char_id` = '%d'", schema_config.guild_member_db, char_id) )
 		Sql_ShowDebug(sql_handle);
 	if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `guild_id` = '0' WHERE `char_id` = '%d'", schema_config.char_db, char_id) )
@@ -246,6 +247,7 @@ int inter_guild_tosql(struct guild *g,int flag)
 					Sql_ShowDebug(sql_handle);
 				if (m->modified&GS_MEMBER_NEW || new_guild == 1)
 				{
+					char_save_flush(m->char_id);
 					if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `guild_id` = '%d' WHERE `char_id` = '%d'",
 						schema_config.char_db, g->guild_id, m->char_id) )
 						Sql_ShowDebug(sql_handle);
@@ -1342,6 +1344,7 @@ int mapif_parse_GuildLeave(int fd, int guild_id, uint32 account_id, uint32 char_
 	if( g == NULL )
 	{
 		// Unknown guild, just update the player
+		char_save_flush(char_id);
 		if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `guild_id`='0' WHERE `account_id`='%d' AND `char_id`='%d'", schema_config.char_db, account_id, char_id) )
 			Sql_ShowDebug(sql_handle);
 		// mapif_guild_withdraw(guild_id,account_id,char_id,flag,g->member[i].name,mes);
@@ -1480,6 +1483,10 @@ int mapif_parse_BreakGuild(int fd,int guild_id)
 		Sql_ShowDebug(sql_handle);
 
 	//printf("- Update guild %d of char\n",guild_id);
+	for( int i = 0; i < g->max_member; i++ ){
+		if( g->member[i].char_id )
+			char_save_flush(g->member[i].char_id); // queued saves of the members still hold the guild
+	}
 	if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `guild_id`='0' WHERE `guild_id`='%d'", schema_config.char_db, guild_id) )
 		Sql_ShowDebug(sql_handle);
 
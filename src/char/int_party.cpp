@@ -130,6 +130,10 @@ int inter_party_tosql(struct party *p, int flag, int index)
 	if( flag & PS_BREAK )
 	{// Break the party
 		// we'll skip name-checking and just reset everyone with the same party id [celest]
+		for( int i = 0; i < MAX_PARTY; i++ ){
+			if( p->member[i].char_id )
+				char_save_flush(p->member[i].char_id); // queued saves of the members still hold the party
+		}
 		if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `party_id`='0' WHERE `party_id`='%d'", schema_config.char_db, party_id) )
 			Sql_ShowDebug(sql_handle);
 		if( SQL_ERROR == Sql_Query(sql_handle, "DELETE FROM `%s` WHERE `party_id`='%d'", schema_config.party_db, party_id) )
@@ -168,6 +172,7 @@ int inter_party_tosql(struct party *p, int flag, int index)
 
 	if( flag & PS_ADDMEMBER )
 	{// Add one party member.
+		char_save_flush(p->member[index].char_id);
 		if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `party_id`='%d' WHERE `account_id`='%d' AND `char_id`='%d'",
 			schema_config.char_db, party_id, p->member[index].account_id, p->member[index].char_id) )
 			Sql_ShowDebug(sql_handle);
@@ -175,6 +180,7 @@ int inter_party_tosql(struct party *p, int flag, int index)
 
 	if( flag & PS_DELMEMBER )
 	{// Remove one party member.
+		char_save_flush(p->member[index].char_id);
 		if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `party_id`='0' WHERE `party_id`='%d' AND `account_id`='%d' AND `char_id`='%d'",
 			schema_config.char_db, party_id, p->member[index].account_id, p->member[index].char_id) )
 			Sql_ShowDebug(sql_handle);
@@ -634,6 +640,7 @@ int mapif_parse_PartyLeave(int fd, int party_id, uint32 account_id, uint32 char_
 	p = inter_party_fromsql(party_id);
 	if( p == NULL )
 	{// Party does not exists?
+		char_save_flush(char_id); // the members are unknown, but a queued save of the leaving character still holds the party
 		if( SQL_ERROR == Sql_Query(sql_handle, "UPDATE `%s` SET `party_id`='0' WHERE `party_id`='%d'", schema_config.char_db, party_id) )
 			Sql_ShowDebug(sql_handle);
 		return 0;
@@ -17,6 +17,7 @@
 #include "../common/socket.hpp"
 #include "../common/strlib.hpp"
 #include "../common/timer.hpp"
+#include "../common/utils.hpp"
 
 #include "char.hpp"
 #include "char_logif.hpp"
@@ -50,6 +51,7 @@ char char_server_id[32] = "ragnarok";
 char char_server_pw[32] = ""; // Allow user to send empty password (bugreport:7787)
 char char_server_db[32] = "ragnarok";
 char default_codepage[32] = ""; //Feature by irmin.
+int char_async_connections = 2; // Additional connections that save characters in the background
 unsigned int party_share_level = 10;
 
 /// Received packet Lengths from map-server
@@ -817,6 +819,8 @@ int inter_config_read(const char* cfgName)
 			safestrncpy(char_server_db,w2,sizeof(char_server_db));
 		else if(!strcmpi(w1,"default_codepage"))
 			safestrncpy(default_codepage,w2,sizeof(default_codepage));
+		else if(!strcmpi(w1,"char_async_connections"))
+			char_async_connections = cap_value(atoi(w2), 0, 16);
 		else if(!strcmpi(w1,"party_share_level"))
 			party_share_level = (unsigned int)atof(w2);
 		else if(!strcmpi(w1,"log_inter"))
@@ -949,6 +953,10 @@ int inter_init_sql(const char *file)
 			Sql_ShowDebug(sql_handle);
 	}
 
+	if( char_async_connections > 0 )
+		ShowInfo("Opening %d connections to save characters in the background.\n", char_async_connections);
+	SqlAsync_Init(sql_handle, char_async_connections, char_server_id, char_server_pw, char_server_ip, (uint16)char_server_port, char_server_db, default_codepage);
+
 	wis_db = idb_alloc(DB_OPT_RELEASE_DATA);
 	interServerDb.load();
 	inter_guild_sql_init();
@@ -969,6 +977,8 @@ int inter_init_sql(const char *file)
 // finalize
 void inter_final(void)
 {
+	SqlAsync_Final();
+
 	wis_db->destroy(wis_db, NULL);
 
 	inter_guild_sql_final();
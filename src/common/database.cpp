@@ -3,7 +3,184 @@
 
 #include "database.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <stdlib.h> // atexit
+#include <sys/stat.h> // mkdir
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 #include "showmsg.hpp"
+#include "strlib.hpp"
+
+#ifdef WIN32
+#include <direct.h> // _mkdir
+#include "winapi.hpp" // GetModuleFileName
+#endif
+
+#define YAML_SNAPSHOT_MAGIC 0x53535952 // "RYSS", also detects a different byte order
+#define YAML_SNAPSHOT_VERSION 2
+
+std::string YamlDatabase::snapshotPath = "db/snapshot";
+
+/// A database file that is parsed ahead of time by the prefetch threads
+struct s_yaml_prefetch {
+	YAML::Node rootNode;
+	bool done = false; // Whether the file was parsed
+	bool failed = false; // Whether the file could not be parsed, it is parsed again by the main thread to report the error
+};
+
+static std::mutex yaml_prefetch_mutex;
+static std::condition_variable yaml_prefetch_cond;
+static std::deque<std::pair<std::string, std::shared_ptr<s_yaml_prefetch>>> yaml_prefetch_queue; // Files that have not been parsed yet, in the order they are needed
+static std::unordered_map<std::string, std::shared_ptr<s_yaml_prefetch>> yaml_prefetch_files; // Files that were queued and not loaded yet
+static std::vector<std::thread> yaml_prefetch_threads;
+static bool yaml_prefetch_stop = false;
+
+/// Returns the milliseconds since a point in time.
+static int64 yaml_elapsed_ms( std::chrono::steady_clock::time_point since ){
+	return std::chrono::duration_cast<std::chrono::milliseconds>( std::chrono::steady_clock::now() - since ).count();
+}
+
+/**
+ * Queues a database file for parsing, yaml_prefetch_mutex has to be locked.
+ * @param path: Path of the file
+ * @param front: Whether the file is needed before all other queued files
+ */
+static void yaml_prefetch_queue_file( const std::string& path, bool front ){
+	if( yaml_prefetch_files.find( path ) != yaml_prefetch_files.end() ){
+		return;
+	}
+
+	std::shared_ptr<s_yaml_prefetch> entry = std::make_shared<s_yaml_prefetch>();
+
+	yaml_prefetch_files[path] = entry;
+
+	if( front ){
+		yaml_prefetch_queue.emplace_front( path, entry );
+	}else{
+		yaml_prefetch_queue.emplace_back( path, entry );
+	}
+}
+
+/**
+ * Collects the imports of a database file, that apply to this server.
+ * Runs on the prefetch threads, so invalid imports are only skipped, they are reported when the file is loaded.
+ * @param rootNode: Root node of the file
+ * @param imports: Paths of the imports
+ */
+static void yaml_prefetch_imports( const YAML::Node& rootNode, std::vector<std::string>& imports ){
+#ifdef RENEWAL
+	const std::string compiledMode = "Renewal";
+#else
+	const std::string compiledMode = "Prerenewal";
+#endif
+
+	try{
+		const YAML::Node& importsNode = rootNode["Footer"]["Imports"];
+
+		if( !importsNode.IsSequence() ){
+			return;
+		}
+
+		for( const YAML::Node& node : importsNode ){
+			if( !node["Path"].IsScalar() ){
+				continue;
+			}
+
+			if( node["Mode"].IsDefined() && node["Mode"].as<std::string>() != compiledMode ){
+				continue;
+			}
+
+			imports.push_back( node["Path"].as<std::string>() );
+		}
+	}catch( const YAML::Exception& ){
+		// Reported when the file is loaded
+	}
+}
+
+/// Parses the queued database files, until the prefetching is finalized.
+static void yaml_prefetch_worker(){
+	std::unique_lock<std::mutex> lock( yaml_prefetch_mutex );
+
+	while( true ){
+		yaml_prefetch_cond.wait( lock, [](){ return yaml_prefetch_stop || !yaml_prefetch_queue.empty(); } );
+
+		if( yaml_prefetch_stop ){
+			return;
+		}
+
+		std::string path = yaml_prefetch_queue.front().first;
+		std::shared_ptr<s_yaml_prefetch> entry = yaml_prefetch_queue.front().second;
+
+		yaml_prefetch_queue.pop_front();
+
+		YAML::Node rootNode;
+		std::vector<std::string> imports;
+		bool failed = false;
+
+		lock.unlock();
+
+		try{
+			rootNode = YAML::LoadFile( path );
+			yaml_prefetch_imports( rootNode, imports );
+		}catch( const YAML::Exception& ){
+			failed = true;
+		}
+
+		lock.lock();
+
+		// The imports are loaded right after the file itself
+		for( auto it = imports.rbegin(); it != imports.rend(); ++it ){
+			yaml_prefetch_queue_file( *it, true );
+		}
+
+		entry->rootNode = rootNode;
+		entry->failed = failed;
+		entry->done = true;
+
+		yaml_prefetch_cond.notify_all();
+	}
+}
+
+/**
+ * Takes a database file from the prefetch threads, waits until it is parsed if necessary.
+ * @param path: Path of the file
+ * @param rootNode: Root node of the file
+ * @return Whether the file was parsed successfully by the prefetch threads
+ */
+static bool yaml_prefetch_take( const std::string& path, YAML::Node& rootNode ){
+	std::unique_lock<std::mutex> lock( yaml_prefetch_mutex );
+	auto it = yaml_prefetch_files.find( path );
+
+	if( it == yaml_prefetch_files.end() ){
+		return false;
+	}
+
+	std::shared_ptr<s_yaml_prefetch> entry = it->second;
+
+	yaml_prefetch_files.erase( it );
+
+	// Not being parsed yet, so parse it directly instead
+	auto queued = std::find_if( yaml_prefetch_queue.begin(), yaml_prefetch_queue.end(), [&entry]( const std::pair<std::string, std::shared_ptr<s_yaml_prefetch>>& queuedFile ){ return queuedFile.second == entry; } );
+
+	if( queued != yaml_prefetch_queue.end() ){
+		yaml_prefetch_queue.erase( queued );
+		return false;
+	}
+
+	yaml_prefetch_cond.wait( lock, [&entry](){ return entry->done; } );
+
+	if( entry->failed ){
+		return false;
+	}
+
+	rootNode = entry->rootNode;
+
+	return true;
+}
 
 bool YamlDatabase::nodeExists( const YAML::Node& node, const std::string& name ){
 	try{
@@ -73,6 +250,8 @@ bool YamlDatabase::verifyCompatibility( const YAML::Node& rootNode ){
 			ShowError( "Database version %hu is not supported. Maximum version is: %hu\n", tmpVersion, this->version );
 			return false;
 		}else if( tmpVersion >= this->minimumVersion ){
+			// The warning would not be shown anymore, if the database was loaded from a snapshot
+			this->recordingClean = false;
 			ShowWarning( "Database version %hu is outdated and should be updated. Current version is: %hu\n", tmpVersion, this->version );
 			ShowWarning( "Reduced compatibility with %s database file from '" CL_WHITE "%s" CL_RESET "'.\n", this->type.c_str(), this->currentFile.c_str() );
 		}else{
@@ -84,14 +263,451 @@ bool YamlDatabase::verifyCompatibility( const YAML::Node& rootNode ){
 	return true;
 }
 
+void YamlSnapshot::value( std::string& value ){
+	uint32 length = static_cast<uint32>( value.length() );
+
+	this->value( length );
+
+	if( this->reading ){
+		if( this->failed || this->buffer.size() - this->offset < length ){
+			this->failed = true;
+			return;
+		}
+
+		value.assign( &this->buffer[this->offset], length );
+		this->offset += length;
+	}else{
+		this->buffer.insert( this->buffer.end(), value.begin(), value.end() );
+	}
+}
+
+bool YamlSnapshot::readFile( const std::string& path ){
+	FILE* fp = fopen( path.c_str(), "rb" );
+
+	if( fp == nullptr ){
+		return false;
+	}
+
+	fseek( fp, 0, SEEK_END );
+	long size = ftell( fp );
+	fseek( fp, 0, SEEK_SET );
+
+	this->buffer.resize( size > 0 ? size : 0 );
+	this->offset = 0;
+	this->failed = false;
+
+	bool ret = fread( this->buffer.data(), 1, this->buffer.size(), fp ) == this->buffer.size();
+
+	fclose( fp );
+
+	return ret;
+}
+
+/**
+ * Writes the snapshot to a file.
+ * It is written to a temporary file first, so a server that is started meanwhile never reads a partial snapshot.
+ * @param path: Path of the file
+ * @return Whether the file was written
+ */
+bool YamlSnapshot::writeFile( const std::string& path ){
+	std::string temporary = path + ".tmp";
+	FILE* fp = fopen( temporary.c_str(), "wb" );
+
+	if( fp == nullptr ){
+		return false;
+	}
+
+	bool ret = fwrite( this->buffer.data(), 1, this->buffer.size(), fp ) == this->buffer.size();
+
+	ret = fclose( fp ) == 0 && ret;
+
+	if( ret ){
+#ifdef WIN32
+		// Renaming does not replace an existing file on Windows
+		remove( path.c_str() );
+#endif
+		ret = rename( temporary.c_str(), path.c_str() ) == 0;
+	}
+
+	if( !ret ){
+		remove( temporary.c_str() );
+	}
+
+	return ret;
+}
+
+/// Continues a FNV-1a hash with the given data.
+uint64 YamlDatabase::snapshotHash( uint64 hash, const void* data, size_t length ){
+	const uint8* bytes = static_cast<const uint8*>( data );
+
+	for( size_t i = 0; i < length; i++ ){
+		hash ^= bytes[i];
+		hash *= 0x100000001b3ULL;
+	}
+
+	return hash;
+}
+
+/// A file a database was loaded from
+struct s_yaml_source_file {
+	std::string path;
+	bool exists;
+	uint64 hash; // Hash of the content of the file
+};
+
+/// Calculates the hash of the content of a database file.
+static void yaml_hash_file( s_yaml_source_file& file ){
+	FILE* fp = fopen( file.path.c_str(), "rb" );
+	char buffer[65536];
+	size_t length;
+
+	file.exists = fp != nullptr;
+	file.hash = 0xcbf29ce484222325ULL;
+
+	if( fp == nullptr ){
+		return;
+	}
+
+	while( ( length = fread( buffer, 1, sizeof( buffer ), fp ) ) > 0 ){
+		file.hash = YamlDatabase::snapshotHash( file.hash, buffer, length );
+	}
+
+	fclose( fp );
+}
+
+/// Combines the hashes of the files a database was loaded from.
+static uint64 yaml_hash_files( const std::vector<s_yaml_source_file>& files ){
+	uint64 hash = 0xcbf29ce484222325ULL;
+
+	for( const s_yaml_source_file& file : files ){
+		hash = YamlDatabase::snapshotHash( hash, file.path.c_str(), file.path.length() + 1 );
+		hash = YamlDatabase::snapshotHash( hash, &file.exists, sizeof( file.exists ) );
+		hash = YamlDatabase::snapshotHash( hash, &file.hash, sizeof( file.hash ) );
+	}
+
+	return hash;
+}
+
+/// Snapshots are not supported by default.
+uint32 YamlDatabase::getSnapshotVersion(){
+	return 0;
+}
+
+/// Snapshots do not depend on anything but the database files by default.
+uint64 YamlDatabase::getSnapshotDependencies(){
+	return 0;
+}
+
+bool YamlDatabase::serializeSnapshot( YamlSnapshot& snapshot ){
+	return false;
+}
+
+/**
+ * Calculates the hash of the running executable, which changes with every build.
+ * If the executable can not be read, a different value is used for every start, so no snapshot is ever current.
+ * @return Hash of the executable
+ */
+static uint64 yaml_executable_hash_calculate(){
+	s_yaml_source_file file = {};
+
+#ifdef WIN32
+	char path[MAX_PATH];
+	DWORD length = GetModuleFileNameA( nullptr, path, sizeof( path ) );
+
+	if( length > 0 && length < sizeof( path ) ){
+		file.path = path;
+	}
+#else
+	file.path = "/proc/self/exe";
+#endif
+
+	if( !file.path.empty() ){
+		yaml_hash_file( file );
+	}
+
+	if( !file.exists ){
+		ShowWarning( "Could not read the server executable, database snapshots will not be loaded.\n" );
+		return static_cast<uint64>( std::chrono::steady_clock::now().time_since_epoch().count() );
+	}
+
+	return file.hash;
+}
+
+/// Returns the hash of the running executable, it is only calculated once.
+static uint64 yaml_executable_hash(){
+	static const uint64 hash = yaml_executable_hash_calculate();
+
+	return hash;
+}
+
+/**
+ * Continues a hash with the build of the server.
+ * The executable changes with every build, including local changes of the source that are not committed.
+ * @param hash: Hash to continue
+ * @param layout: Sum of the sizes of the structures stored in the snapshot
+ * @return Hash including the build
+ */
+uint64 YamlDatabase::snapshotBuildHash( uint64 hash, size_t layout ){
+	uint64 executable = yaml_executable_hash();
+
+	hash = YamlDatabase::snapshotHash( hash, &executable, sizeof( executable ) );
+
+	return YamlDatabase::snapshotHash( hash, &layout, sizeof( layout ) );
+}
+
+/// Returns a hash of the files the database was loaded from, for databases whose snapshots depend on it.
+uint64 YamlDatabase::getSourceHash(){
+	return this->sourceHash;
+}
+
+bool YamlDatabase::snapshotSupported(){
+	return !YamlDatabase::snapshotPath.empty() && this->getSnapshotVersion() != 0;
+}
+
+std::string YamlDatabase::getSnapshotLocation(){
+	std::string name = this->type;
+
+	rathena::util::tolower( name );
+
+	return YamlDatabase::snapshotPath + "/" + name + ".dat";
+}
+
+/**
+ * Reads the snapshot of the database and checks if it is still current.
+ * A snapshot is current if it was written by the same version of the database and none of the files it was created from changed.
+ * @param snapshot: Snapshot, positioned behind its header if it is current
+ * @param dependencies: Whether to check the dependencies of the database, which might not be loaded yet
+ * @return Whether the snapshot is current
+ */
+bool YamlDatabase::readSnapshot( YamlSnapshot& snapshot, bool dependencies ){
+	std::vector<s_yaml_source_file> files;
+
+	if( !this->snapshotSupported() || !snapshot.readFile( this->getSnapshotLocation() ) ){
+		return false;
+	}
+
+	uint32 magic = 0, formatVersion = 0, snapshotVersion = 0;
+	std::string snapshotType, dbPath, location;
+	uint64 snapshotDependencies = 0;
+	uint32 count = 0;
+
+	snapshot.value( magic );
+	snapshot.value( formatVersion );
+
+	if( magic != YAML_SNAPSHOT_MAGIC || formatVersion != YAML_SNAPSHOT_VERSION ){
+		return false;
+	}
+
+	snapshot.value( snapshotType );
+	snapshot.value( snapshotVersion );
+	snapshot.value( dbPath );
+	snapshot.value( location );
+	snapshot.value( snapshotDependencies );
+
+	// A changed db_path loads the database from other files
+	if( snapshot.hasFailed() || snapshotType != this->type || snapshotVersion != this->getSnapshotVersion() || dbPath != DBPATH || location != this->getDefaultLocation() ){
+		return false;
+	}
+
+	if( dependencies && snapshotDependencies != this->getSnapshotDependencies() ){
+		return false;
+	}
+
+	snapshot.value( count );
+
+	for( uint32 i = 0; i < count && !snapshot.hasFailed(); i++ ){
+		s_yaml_source_file file = {}, current;
+
+		snapshot.value( file.path );
+		snapshot.value( file.exists );
+		snapshot.value( file.hash );
+
+		current.path = file.path;
+		yaml_hash_file( current );
+
+		if( snapshot.hasFailed() || current.exists != file.exists || current.hash != file.hash ){
+			return false;
+		}
+
+		files.push_back( current );
+	}
+
+	if( snapshot.hasFailed() ){
+		return false;
+	}
+
+	this->sourceHash = yaml_hash_files( files );
+
+	return true;
+}
+
+/// Loads the database from its snapshot, if it is current.
+bool YamlDatabase::loadSnapshot(){
+	auto start = std::chrono::steady_clock::now();
+	YamlSnapshot snapshot( true );
+
+	if( !this->readSnapshot( snapshot, true ) ){
+		return false;
+	}
+
+	std::string path = this->getSnapshotLocation();
+
+	ShowStatus( "Loading '" CL_WHITE "%s" CL_RESET "'..." CL_CLL "\r", path.c_str() );
+
+	if( !this->serializeSnapshot( snapshot ) ){
+		ShowWarning( "Failed to read %s database snapshot from '" CL_WHITE "%s" CL_RESET "', reading the database files instead.\n", this->type.c_str(), path.c_str() );
+		this->clear();
+		return false;
+	}
+
+	ShowStatus( "Done reading %s database from snapshot '" CL_WHITE "%s" CL_RESET "' (%" PRId64 " ms)" CL_CLL "\n", this->type.c_str(), path.c_str(), yaml_elapsed_ms( start ) );
+
+	return true;
+}
+
+/// Writes the snapshot of the database, after it was loaded from the recorded files.
+void YamlDatabase::saveSnapshot(){
+	YamlSnapshot snapshot( false );
+	uint32 magic = YAML_SNAPSHOT_MAGIC, formatVersion = YAML_SNAPSHOT_VERSION, snapshotVersion = this->getSnapshotVersion();
+	std::string dbPath = DBPATH;
+	std::string location = this->getDefaultLocation();
+	uint64 dependencies = this->getSnapshotDependencies();
+	uint32 files = static_cast<uint32>( this->recordedFiles.size() );
+
+	snapshot.value( magic );
+	snapshot.value( formatVersion );
+	snapshot.value( this->type );
+	snapshot.value( snapshotVersion );
+	snapshot.value( dbPath );
+	snapshot.value( location );
+	snapshot.value( dependencies );
+	snapshot.value( files );
+
+	for( std::string& path : this->recordedFiles ){
+		s_yaml_source_file file;
+
+		file.path = path;
+		yaml_hash_file( file );
+
+		snapshot.value( file.path );
+		snapshot.value( file.exists );
+		snapshot.value( file.hash );
+	}
+
+	if( !this->serializeSnapshot( snapshot ) ){
+		return;
+	}
+
+	std::string path = this->getSnapshotLocation();
+
+	if( !snapshot.writeFile( path ) ){
+		// Create the directory on first use
+#ifdef WIN32
+		_mkdir( YamlDatabase::snapshotPath.c_str() );
+#else
+		mkdir( YamlDatabase::snapshotPath.c_str(), 0755 );
+#endif
+
+		if( !snapshot.writeFile( path ) ){
+			ShowWarning( "Failed to write %s database snapshot to '" CL_WHITE "%s" CL_RESET "'.\n", this->type.c_str(), path.c_str() );
+		}
+	}
+}
+
+/**
+ * Loads the database.
+ * Databases that support snapshots are loaded from their snapshot, if none of their files changed since it was written.
+ * Otherwise they are loaded from their files and a new snapshot is written, if no warnings occurred while doing so.
+ * The snapshot is written before loadingFinished, since it is run in both cases.
+ */
 bool YamlDatabase::load(){
-	bool ret = this->load( this->getDefaultLocation() );
+	bool ret;
+
+	if( this->loadSnapshot() ){
+		ret = true;
+	}else{
+		std::vector<s_yaml_source_file> files;
+
+		this->recording = true;
+		this->recordingClean = true;
+		this->recordedFiles.clear();
+
+		ret = this->load( this->getDefaultLocation() );
+
+		for( std::string& path : this->recordedFiles ){
+			s_yaml_source_file file;
+
+			file.path = path;
+			yaml_hash_file( file );
+			files.push_back( file );
+		}
+
+		this->sourceHash = yaml_hash_files( files );
+
+		if( ret && this->recordingClean && this->snapshotSupported() ){
+			this->saveSnapshot();
+		}
+
+		this->recording = false;
+		this->recordedFiles.clear();
+	}
 
 	this->loadingFinished();
 
 	return ret;
 }
 
+/**
+ * Starts parsing the database file on the prefetch threads, before it is loaded.
+ * The files are parsed in the order they were prefetched, so it should match the order in which they are loaded.
+ */
+void YamlDatabase::prefetch(){
+	YamlSnapshot snapshot( true );
+
+	// Most likely loaded from its snapshot
+	if( this->readSnapshot( snapshot, false ) ){
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock( yaml_prefetch_mutex );
+
+	if( yaml_prefetch_stop ){
+		return;
+	}
+
+	if( yaml_prefetch_threads.empty() ){
+		// The threads have to be stopped, even if the server is shut down during startup
+		atexit( YamlDatabase::finalizePrefetch );
+
+		size_t threads = std::max( 1U, std::min( std::thread::hardware_concurrency(), 4U ) );
+
+		for( size_t i = 0; i < threads; i++ ){
+			yaml_prefetch_threads.emplace_back( yaml_prefetch_worker );
+		}
+	}
+
+	yaml_prefetch_queue_file( this->getDefaultLocation(), false );
+	yaml_prefetch_cond.notify_all();
+}
+
+/// Stops the prefetch threads and drops all prefetched files that were not loaded.
+void YamlDatabase::finalizePrefetch(){
+	{
+		std::lock_guard<std::mutex> lock( yaml_prefetch_mutex );
+
+		yaml_prefetch_stop = true;
+		yaml_prefetch_cond.notify_all();
+	}
+
+	for( std::thread& thread : yaml_prefetch_threads ){
+		thread.join();
+	}
+
+	yaml_prefetch_threads.clear();
+	yaml_prefetch_queue.clear();
+	yaml_prefetch_files.clear();
+}
+
 bool YamlDatabase::reload(){
 	this->clear();
 
@@ -100,21 +716,37 @@ bool YamlDatabase::reload(){
 
 bool YamlDatabase::load(const std::string& path) {
 	YAML::Node rootNode;
+	auto start = std::chrono::steady_clock::now();
 
-	try {
-		ShowStatus( "Loading '" CL_WHITE "%s" CL_RESET "'..." CL_CLL "\r", path.c_str() );
-		rootNode = YAML::LoadFile(path);
+	ShowStatus( "Loading '" CL_WHITE "%s" CL_RESET "'..." CL_CLL "\r", path.c_str() );
+
+	if( this->recording ){
+		this->recordedFiles.push_back( path );
 	}
-	catch(YAML::Exception &e) {
-		ShowError("Failed to read %s database file from '" CL_WHITE "%s" CL_RESET "'.\n", this->type.c_str(), path.c_str());
-		ShowError("%s (Line %d: Column %d)\n", e.msg.c_str(), e.mark.line, e.mark.column);
-		return false;
+
+	if( !yaml_prefetch_take( path, rootNode ) ){
+		try {
+			rootNode = YAML::LoadFile(path);
+		}
+		catch(YAML::Exception &e) {
+			// Missing files are recorded as such, any other error prevents the snapshot
+			if( dynamic_cast<YAML::BadFile*>( &e ) == nullptr ){
+				this->recordingClean = false;
+			}
+
+			ShowError("Failed to read %s database file from '" CL_WHITE "%s" CL_RESET "'.\n", this->type.c_str(), path.c_str());
+			ShowError("%s (Line %d: Column %d)\n", e.msg.c_str(), e.mark.line, e.mark.column);
+			return false;
+		}
 	}
 
+	int64 readTime = yaml_elapsed_ms( start );
+
 	// Required here already for header error reporting
 	this->currentFile = path;
 
 	if (!this->verifyCompatibility(rootNode)){
+		this->recordingClean = false;
 		ShowError("Failed to verify compatibility with %s database file from '" CL_WHITE "%s" CL_RESET "'.\n", this->type.c_str(), this->currentFile.c_str());
 		return false;
 	}
@@ -129,7 +761,7 @@ bool YamlDatabase::load(const std::string& path) {
 		}
 	}
 
-	this->parse( rootNode );
+	this->parse( rootNode, readTime );
 
 	this->parseImports( rootNode );
 
@@ -140,8 +772,9 @@ void YamlDatabase::loadingFinished(){
 	// Does nothing by default, just for hooking
 }
 
-void YamlDatabase::parse( const YAML::Node& rootNode ){
+void YamlDatabase::parse( const YAML::Node& rootNode, int64 readTime ){
 	uint64 count = 0;
+	auto start = std::chrono::steady_clock::now();
 
 	if( this->nodeExists( rootNode, "Body" ) ){
 		const YAML::Node& bodyNode = rootNode["Body"];
@@ -155,7 +788,7 @@ void YamlDatabase::parse( const YAML::Node& rootNode ){
 			ShowStatus( "Loading [%" PRIdPTR "/%" PRIdPTR "] entries from '" CL_WHITE "%s" CL_RESET "'" CL_CLL "\r", ++childNodesProgressed, childNodesCount, fileName );
 		}
 
-		ShowStatus( "Done reading '" CL_WHITE "%" PRIu64 CL_RESET "' entries in '" CL_WHITE "%s" CL_RESET "'" CL_CLL "\n", count, fileName );
+		ShowStatus( "Done reading '" CL_WHITE "%" PRIu64 CL_RESET "' entries in '" CL_WHITE "%s" CL_RESET "' (reading: %" PRId64 " ms, parsing: %" PRId64 " ms)" CL_CLL "\n", count, fileName, readTime, yaml_elapsed_ms( start ) );
 	}
 }
 
@@ -295,6 +928,9 @@ bool YamlDatabase::asUInt32Rate( const YAML::Node& node, const std::string& name
 void YamlDatabase::invalidWarning( const YAML::Node &node, const char* fmt, ... ){
 	va_list ap;
 
+	// The warning would not be shown anymore, if the database was loaded from a snapshot
+	this->recordingClean = false;
+
 	va_start(ap, fmt);
 
 	// Remove any remaining garbage of a previous loading line
@@ -4,6 +4,8 @@
 #ifndef DATABASE_HPP
 #define DATABASE_HPP
 
+#include <cstring>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -15,6 +17,75 @@
 #include "core.hpp"
 #include "utilities.hpp"
 
+/// Binary snapshot of the parsed contents of a database, which is written and read by the same code.
+class YamlSnapshot{
+private:
+	std::vector<char> buffer;
+	size_t offset;
+	bool reading;
+	bool failed;
+
+public:
+	YamlSnapshot( bool reading_ ){
+		this->offset = 0;
+		this->reading = reading_;
+		this->failed = false;
+	}
+
+	bool isReading(){
+		return this->reading;
+	}
+
+	/// Whether the snapshot was truncated or malformed while reading it.
+	bool hasFailed(){
+		return this->failed;
+	}
+
+	/// Writes or reads a value, that can be copied byte by byte.
+	template <typename T> void value( T& value ){
+		static_assert( std::is_trivially_copyable<T>::value, "Only values that can be copied byte by byte can be stored directly" );
+
+		if( this->reading ){
+			if( this->failed || this->buffer.size() - this->offset < sizeof( T ) ){
+				this->failed = true;
+				return;
+			}
+
+			memcpy( &value, &this->buffer[this->offset], sizeof( T ) );
+			this->offset += sizeof( T );
+		}else{
+			const char* bytes = reinterpret_cast<const char*>( &value );
+
+			this->buffer.insert( this->buffer.end(), bytes, bytes + sizeof( T ) );
+		}
+	}
+
+	void value( std::string& value );
+
+	/// Writes or reads a vector of values, that can be copied byte by byte.
+	template <typename T> void value( std::vector<T>& values ){
+		uint32 count = static_cast<uint32>( values.size() );
+
+		this->value( count );
+
+		if( this->reading ){
+			if( this->failed || ( this->buffer.size() - this->offset ) / sizeof( T ) < count ){
+				this->failed = true;
+				return;
+			}
+
+			values.resize( count );
+		}
+
+		for( T& value : values ){
+			this->value( value );
+		}
+	}
+
+	bool readFile( const std::string& path );
+	bool writeFile( const std::string& path );
+};
+
 class YamlDatabase{
 // Internal stuff
 private:
@@ -22,12 +93,21 @@ private:
 	uint16 version;
 	uint16 minimumVersion;
 	std::string currentFile;
+	bool recording; // Whether the loaded files are recorded
+	bool recordingClean; // Whether the recorded files were loaded without any warnings
+	std::vector<std::string> recordedFiles;
+	uint64 sourceHash; // Hash of the files the database was loaded from
 
 	bool verifyCompatibility( const YAML::Node& rootNode );
 	bool load( const std::string& path );
-	void parse( const YAML::Node& rootNode );
+	void parse( const YAML::Node& rootNode, int64 readTime );
 	void parseImports( const YAML::Node& rootNode );
 	template <typename R> bool asType( const YAML::Node& node, const std::string& name, R& out );
+	bool snapshotSupported();
+	std::string getSnapshotLocation();
+	bool readSnapshot( YamlSnapshot& snapshot, bool dependencies );
+	bool loadSnapshot();
+	void saveSnapshot();
 
 // These should be visible/usable by the implementation provider
 protected:
@@ -53,11 +133,23 @@ protected:
 
 	virtual void loadingFinished();
 
+	// Snapshot support, see YamlDatabase::load
+	virtual uint32 getSnapshotVersion();
+	virtual uint64 getSnapshotDependencies();
+	virtual bool serializeSnapshot( YamlSnapshot& snapshot );
+
 public:
+	static std::string snapshotPath; // Directory of the database snapshots, empty if they are disabled
+	static uint64 snapshotHash( uint64 hash, const void* data, size_t length );
+	static uint64 snapshotBuildHash( uint64 hash, size_t layout );
+
 	YamlDatabase( const std::string type_, uint16 version_, uint16 minimumVersion_ ){
 		this->type = type_;
 		this->version = version_;
 		this->minimumVersion = minimumVersion_;
+		this->recording = false;
+		this->recordingClean = false;
+		this->sourceHash = 0;
 	}
 
 	YamlDatabase( const std::string& type_, uint16 version_ ) : YamlDatabase( type_, version_, version_ ){
@@ -66,6 +158,9 @@ public:
 
 	bool load();
 	bool reload();
+	void prefetch();
+	uint64 getSourceHash();
+	static void finalizePrefetch();
 
 	// Functions that need to be implemented for each type
 	virtual void clear() = 0;
@@ -133,6 +228,51 @@ public:
 	void erase(keytype key) {
 		this->data.erase(key);
 	}
+
+protected:
+	/**
+	 * Writes or reads an entry of the database to or from a snapshot.
+	 * Databases that support snapshots have to implement it and getSnapshotVersion.
+	 * @param snapshot: Snapshot
+	 * @param entry: Entry to write or a new entry to read into
+	 * @return Whether the entry was serialized successfully
+	 */
+	virtual bool serializeEntry( YamlSnapshot& snapshot, std::shared_ptr<datatype> entry ){
+		return false;
+	}
+
+	bool serializeSnapshot( YamlSnapshot& snapshot ) override{
+		uint32 count = static_cast<uint32>( this->data.size() );
+
+		snapshot.value( count );
+
+		if( snapshot.isReading() ){
+			for( uint32 i = 0; i < count && !snapshot.hasFailed(); i++ ){
+				keytype key;
+				std::shared_ptr<datatype> entry = std::make_shared<datatype>();
+
+				snapshot.value( key );
+
+				if( !this->serializeEntry( snapshot, entry ) ){
+					return false;
+				}
+
+				this->put( key, entry );
+			}
+		}else{
+			for( auto& pair : this->data ){
+				keytype key = pair.first;
+
+				snapshot.value( key );
+
+				if( !this->serializeEntry( snapshot, pair.second ) ){
+					return false;
+				}
+			}
+		}
+
+		return !snapshot.hasFailed();
+	}
 };
 
 template <typename keytype, typename datatype> class TypesafeCachedYamlDatabase : public TypesafeYamlDatabase<keytype, datatype>{
@@ -4,6 +4,7 @@
 #ifndef MMO_HPP
 #define MMO_HPP
 
+#include <stddef.h> // offsetof
 #include <time.h>
 
 #include "../config/core.hpp"
@@ -576,6 +577,56 @@ struct mmo_charstatus {
 	unsigned long title_id;
 };
 
+/// Lists of mmo_charstatus that are only sent to the char-server when they changed
+enum e_charstatus_section : uint8 {
+	CHARSTATUS_SECTION_MEMO = 0,
+	CHARSTATUS_SECTION_SKILL,
+	CHARSTATUS_SECTION_FRIENDS,
+#ifdef HOTKEY_SAVING
+	CHARSTATUS_SECTION_HOTKEYS,
+#endif
+	CHARSTATUS_SECTION_MAX
+};
+
+/// Byte range of a section in mmo_charstatus.
+static inline void charstatus_section_range(int section, size_t* offset, size_t* length) {
+	switch( section ){
+		case CHARSTATUS_SECTION_MEMO:    *offset = offsetof(struct mmo_charstatus, memo_point); *length = sizeof(((struct mmo_charstatus*)0)->memo_point); break;
+		case CHARSTATUS_SECTION_SKILL:   *offset = offsetof(struct mmo_charstatus, skill);      *length = sizeof(((struct mmo_charstatus*)0)->skill);      break;
+		case CHARSTATUS_SECTION_FRIENDS: *offset = offsetof(struct mmo_charstatus, friends);    *length = sizeof(((struct mmo_charstatus*)0)->friends);    break;
+#ifdef HOTKEY_SAVING
+		case CHARSTATUS_SECTION_HOTKEYS: *offset = offsetof(struct mmo_charstatus, hotkeys);    *length = sizeof(((struct mmo_charstatus*)0)->hotkeys);    break;
+#endif
+		default: *offset = 0; *length = 0; break;
+	}
+}
+
+/// The sections are stored back to back, the data before and after them is part of every save.
+#define CHARSTATUS_SECTIONS_BEGIN offsetof(struct mmo_charstatus, memo_point)
+
+/// End of the last section in mmo_charstatus.
+static inline size_t charstatus_sections_end(void) {
+	size_t offset, length;
+
+	charstatus_section_range(CHARSTATUS_SECTION_MAX - 1, &offset, &length);
+	return offset + length;
+}
+
+/// Length of a character save (0x2b01) carrying the given sections, see chrif_save.
+static inline size_t charstatus_save_length(uint8 sections) {
+	size_t offset, length;
+	size_t total = 14 + CHARSTATUS_SECTIONS_BEGIN + sizeof(struct mmo_charstatus) - charstatus_sections_end();
+
+	for( int i = 0; i < CHARSTATUS_SECTION_MAX; i++ ){
+		if( sections & ( 1 << i ) ){
+			charstatus_section_range(i, &offset, &length);
+			total += length;
+		}
+	}
+
+	return total;
+}
+
 typedef enum mail_status {
 	MAIL_NEW,
 	MAIL_UNREAD,
@@ -5,6 +5,19 @@
 
 #include <stdlib.h>
 
+#if defined(SOCKET_IOURING) && defined(SOCKET_EPOLL)
+	#error "SOCKET_IOURING and SOCKET_EPOLL can not be used at the same time"
+#endif
+#if defined(SOCKET_IOURING) && !defined(__linux__)
+	#error "SOCKET_IOURING is only supported on Linux"
+#endif
+
+#ifdef SOCKET_EPOLL
+	#include <atomic>
+	#include <thread>
+	#include <vector>
+#endif
+
 #ifdef WIN32
 	#include "winapi.hpp"
 #else
@@ -15,6 +28,7 @@
 	#include <sys/ioctl.h>
 	#include <sys/socket.h>
 	#include <sys/time.h>
+	#include <sys/uio.h>
 	#include <unistd.h>
 
 	#if defined(__linux__) || defined(__linux)
@@ -22,6 +36,14 @@
 
 		#ifdef SOCKET_EPOLL
 			#include <sys/epoll.h>
+			#include <sys/eventfd.h>
+		#endif
+
+		#ifdef SOCKET_IOURING
+			#include <signal.h>
+			#include <linux/io_uring.h>
+			#include <sys/mman.h>
+			#include <sys/syscall.h>
 		#endif
 	#else 
 		#include <netinet/in.h>
@@ -161,6 +183,18 @@ char* sErr(int code)
 	return sbuf;
 }
 
+typedef WSABUF socket_iovec;
+#define sIovec(iov,ptr,size) ( (iov).buf = (char*)(ptr), (iov).len = (ULONG)(size) )
+
+int sSendv(int fd, socket_iovec* iov, int count)
+{
+	DWORD sent = 0;
+
+	if( WSASend(fd2sock(fd), iov, count, &sent, 0, NULL, NULL) == SOCKET_ERROR )
+		return SOCKET_ERROR;
+	return (int)sent;
+}
+
 #define sBind(fd,name,namelen) bind(fd2sock(fd),name,namelen)
 #define sConnect(fd,name,namelen) connect(fd2sock(fd),name,namelen)
 #define sIoctl(fd,cmd,argp) ioctlsocket(fd2sock(fd),cmd,argp)
@@ -207,6 +241,9 @@ char* sErr(int code)
 #define sFD_ISSET FD_ISSET
 #define sFD_ZERO FD_ZERO
 
+typedef struct iovec socket_iovec;
+#define sIovec(iov,ptr,size) ( (iov).iov_base = (void*)(ptr), (iov).iov_len = (size) )
+
 /////////////////////////////////////////////////////////////////////
 #endif
 /////////////////////////////////////////////////////////////////////
@@ -215,7 +252,21 @@ char* sErr(int code)
 	#define MSG_NOSIGNAL 0
 #endif
 
-#ifndef SOCKET_EPOLL
+#if !defined(WIN32)
+int sSendv(int fd, socket_iovec* iov, int count)
+{
+	struct msghdr msg;
+
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = iov;
+	msg.msg_iovlen = count;
+	return (int)sendmsg(fd, &msg, MSG_NOSIGNAL);
+}
+#endif
+
+#if defined(SOCKET_IOURING)
+	// io_uring based Event Dispatcher, see CORE : io_uring event dispatcher
+#elif !defined(SOCKET_EPOLL)
 	// Select based Event Dispatcher
 	fd_set readfds;
 #else
@@ -258,96 +309,1277 @@ static time_t socket_data_last_tick = 0;
 // The connection is closed if it goes over the limit.
 #define WFIFO_MAX (1*1024*1024)
 
+// Minimum size of a shared packet to be referenced by the write fifo.
+// Smaller packets are cheaper to copy into the write fifo directly.
+#define WFIFO_SHARED_MIN 64
+
+// Maximum amount of buffers that are passed to a single scatter/gather send.
+#define WFIFO_IOV_MAX 64
+
 struct socket_data* session[MAXCONN];
 
-#ifdef SEND_SHORTLIST
-int send_shortlist_array[MAXCONN];// we only support MAXCONN sockets, limit the array to that
-size_t send_shortlist_count = 0;// how many fd's are in the shortlist
-uint32 send_shortlist_set[(MAXCONN+31)/32];// to know if specific fd's are already in the shortlist
-#endif
+#ifdef SEND_SHORTLIST
+int send_shortlist_array[MAXCONN];// we only support MAXCONN sockets, limit the array to that
+size_t send_shortlist_count = 0;// how many fd's are in the shortlist
+uint32 send_shortlist_set[(MAXCONN+31)/32];// to know if specific fd's are already in the shortlist
+#endif
+
+static int create_session(int fd, RecvFunc func_recv, SendFunc func_send, ParseFunc func_parse);
+static int connect_client_setup(int fd, struct sockaddr_in* client_address);
+
+#ifndef MINICORE
+	int ip_rules = 1;
+	static int connect_check(uint32 ip);
+#endif
+
+const char* error_msg(void)
+{
+	static char buf[512];
+	int code = sErrno;
+	snprintf(buf, sizeof(buf), "error %d: %s", code, sErr(code));
+	return buf;
+}
+
+/*======================================
+ *	CORE : Default processing functions
+ *--------------------------------------*/
+int null_recv(int fd) { return 0; }
+int null_send(int fd) { return 0; }
+int null_parse(int fd) { return 0; }
+
+ParseFunc default_func_parse = null_parse;
+
+void set_defaultparse(ParseFunc defaultparse)
+{
+	default_func_parse = defaultparse;
+}
+
+
+/*======================================
+ *	CORE : Socket options
+ *--------------------------------------*/
+void set_nonblocking(int fd, unsigned long yes)
+{
+	// FIONBIO Use with a nonzero argp parameter to enable the nonblocking mode of socket s.
+	// The argp parameter is zero if nonblocking is to be disabled.
+	if( sIoctl(fd, FIONBIO, &yes) != 0 )
+		ShowError("set_nonblocking: Failed to set socket #%d to non-blocking mode (%s) - Please report this!!!\n", fd, error_msg());
+}
+
+void setsocketopts(int fd,int delay_timeout){
+	int yes = 1; // reuse fix
+
+#if !defined(WIN32)
+	// set SO_REAUSEADDR to true, unix only. on windows this option causes
+	// the previous owner of the socket to give up, which is not desirable
+	// in most cases, neither compatible with unix.
+	sSetsockopt(fd,SOL_SOCKET,SO_REUSEADDR,(char *)&yes,sizeof(yes));
+#ifdef SO_REUSEPORT
+	sSetsockopt(fd,SOL_SOCKET,SO_REUSEPORT,(char *)&yes,sizeof(yes));
+#endif
+#endif
+
+	// Set the socket into no-delay mode; otherwise packets get delayed for up to 200ms, likely creating server-side lag.
+	// The RO protocol is mainly single-packet request/response, plus the FIFO model already does packet grouping anyway.
+	sSetsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (char *)&yes, sizeof(yes));
+
+	// force the socket into no-wait, graceful-close mode (should be the default, but better make sure)
+	//(https://msdn.microsoft.com/en-us/library/windows/desktop/ms737582%28v=vs.85%29.aspx)
+	{
+		struct linger opt;
+		opt.l_onoff = 0; // SO_DONTLINGER
+		opt.l_linger = 0; // Do not care
+		if( sSetsockopt(fd, SOL_SOCKET, SO_LINGER, (char*)&opt, sizeof(opt)) )
+			ShowWarning("setsocketopts: Unable to set SO_LINGER mode for connection #%d!\n", fd);
+	}
+	if(delay_timeout){
+#if defined(WIN32)
+		int timeout = delay_timeout * 1000;
+#else
+		struct timeval timeout;
+		timeout.tv_sec = delay_timeout;
+		timeout.tv_usec = 0;
+#endif
+
+		if (sSetsockopt (fd, SOL_SOCKET, SO_RCVTIMEO, (char *)&timeout,sizeof(timeout)) < 0)
+			ShowError("setsocketopts: Unable to set SO_RCVTIMEO timeout for connection #%d!\n", fd);
+		if (sSetsockopt (fd, SOL_SOCKET, SO_SNDTIMEO, (char *)&timeout,sizeof(timeout)) < 0)
+			ShowError("setsocketopts: Unable to set SO_SNDTIMEO timeout for connection #%d!\n", fd);
+	}
+}
+
+#ifdef SOCKET_EPOLL
+/*======================================
+ *	CORE : I/O worker threads
+ *--------------------------------------
+ * When io_threads is enabled, recv and send calls of all connections are
+ * done by worker threads, which own their own epoll sets. The main thread
+ * only copies the data between the fifos of a session and the rings of its
+ * connection, so the game logic does not stall on socket system calls.
+ * Listening sockets are still handled by the main thread.
+ *--------------------------------------*/
+
+// size of the ring for received data of a connection
+#define SOCKET_IO_RSIZE (16*1024)
+// size of the ring for data to send of a connection
+#define SOCKET_IO_WSIZE (64*1024)
+
+/// Lock-free ring for a single producer thread and a single consumer thread.
+/// The size is rounded up to the next power of two.
+template <typename T> struct s_socket_ring {
+	T* data;
+	size_t mask;
+	std::atomic<size_t> head; // write position, only changed by the producer
+	std::atomic<size_t> tail; // read position, only changed by the consumer
+
+	s_socket_ring( size_t size ) : head( 0 ), tail( 0 ) {
+		size_t capacity = 1;
+
+		while( capacity < size )
+			capacity <<= 1;
+
+		this->data = new T[capacity];
+		this->mask = capacity - 1;
+	}
+	~s_socket_ring(){ delete[] this->data; }
+
+	/// Consumer: amount of entries that can be read
+	size_t readable(){
+		return this->head.load( std::memory_order_acquire ) - this->tail.load( std::memory_order_relaxed );
+	}
+
+	/// Producer: amount of entries that can be written
+	size_t writable(){
+		return this->mask + 1 - ( this->head.load( std::memory_order_relaxed ) - this->tail.load( std::memory_order_acquire ) );
+	}
+
+	/// Producer: continuous space at the write position
+	T* write_span( size_t& len ){
+		size_t head = this->head.load( std::memory_order_relaxed );
+
+		len = min( this->writable(), this->mask + 1 - ( head & this->mask ) );
+		return &this->data[head & this->mask];
+	}
+
+	/// Producer: publishes len entries, which were written into the write span
+	void commit_write( size_t len ){
+		this->head.store( this->head.load( std::memory_order_relaxed ) + len, std::memory_order_release );
+	}
+
+	/// Consumer: continuous data at the read position
+	T* read_span( size_t& len ){
+		size_t tail = this->tail.load( std::memory_order_relaxed );
+
+		len = min( this->readable(), this->mask + 1 - ( tail & this->mask ) );
+		return &this->data[tail & this->mask];
+	}
+
+	/// Consumer: releases len entries, which were read from the read span
+	void commit_read( size_t len ){
+		this->tail.store( this->tail.load( std::memory_order_relaxed ) + len, std::memory_order_release );
+	}
+
+	/// Producer: copies as many entries as possible into the ring and returns their amount
+	size_t write( const T* buf, size_t len ){
+		size_t done = 0;
+
+		while( done < len ){
+			size_t span;
+			T* dst = this->write_span( span );
+
+			if( span == 0 )
+				break;
+
+			span = min( span, len - done );
+			std::copy( buf + done, buf + done + span, dst );
+			this->commit_write( span );
+			done += span;
+		}
+
+		return done;
+	}
+
+	/// Consumer: copies as many entries as possible out of the ring and returns their amount
+	size_t read( T* buf, size_t len ){
+		size_t done = 0;
+
+		while( done < len ){
+			size_t span;
+			T* src = this->read_span( span );
+
+			if( span == 0 )
+				break;
+
+			span = min( span, len - done );
+			std::copy( src, src + span, buf + done );
+			this->commit_read( span );
+			done += span;
+		}
+
+		return done;
+	}
+
+private:
+	static size_t min( size_t a, size_t b ){ return a < b ? a : b; }
+};
+
+/// Connection state shared between the main thread and an I/O worker thread
+struct s_socket_io {
+	int fd;
+	size_t worker;
+	s_socket_ring<uint8> rdata; // received data, filled by the worker
+	s_socket_ring<uint8> wdata; // data to send, filled by the main thread
+	std::atomic<bool> eof; // the connection failed or was closed by the remote side
+	std::atomic<bool> send_queued; // a send command for the connection is pending
+	std::atomic<bool> throttled; // the worker stopped reading, because rdata is full
+	std::atomic<bool> wdata_full; // the main thread could not write everything into wdata
+	uint32 events; // epoll events registered by the worker
+
+	s_socket_io( int fd, size_t worker ) : fd( fd ), worker( worker ), rdata( SOCKET_IO_RSIZE ), wdata( SOCKET_IO_WSIZE ), eof( false ), send_queued( false ), throttled( false ), wdata_full( false ), events( 0 ) {}
+};
+
+enum e_socket_io_command : uint8 {
+	SOCKET_IO_ADD = 0,
+	SOCKET_IO_SEND,
+	SOCKET_IO_REMOVE,
+};
+
+struct s_socket_io_command {
+	e_socket_io_command type;
+	struct s_socket_io* io;
+};
+
+struct s_socket_io_worker {
+	std::thread thread;
+	int epfd;
+	int wakefd;
+	// Commands from the main thread.
+	// Each connection has at most one add, send and remove command queued at the same time,
+	// so a size of four times MAXCONN can not overflow.
+	s_socket_ring<s_socket_io_command> commands;
+	std::vector<struct s_socket_io*> throttled; // worker only
+	bool wake; // main thread only: commands were queued since the last wake up
+
+	s_socket_io_worker() : epfd( SOCKET_ERROR ), wakefd( SOCKET_ERROR ), commands( 4 * MAXCONN ), wake( false ) {}
+};
+
+static int socket_io_threads = 0;
+static std::vector<struct s_socket_io_worker*> socket_io_workers;
+static std::atomic<bool> socket_io_running( false );
+static std::atomic<bool> socket_io_notified( false ); // the main thread was notified about new data
+static int socket_io_wakefd = SOCKET_ERROR; // wakes up the main thread
+
+/// Wakes up the main thread, if it was not notified already.
+static void socket_io_notify_main( void ){
+	if( !socket_io_notified.exchange( true ) ){
+		uint64 value = 1;
+
+		if( write( socket_io_wakefd, &value, sizeof( value ) ) < 0 ){
+			// the counter is already set
+		}
+	}
+}
+
+/// Worker: updates the registered epoll events of the connection.
+static void socket_io_worker_events( struct s_socket_io_worker* worker, struct s_socket_io* io, uint32 events ){
+	struct epoll_event event;
+
+	if( io->events == events )
+		return;
+
+	memset( &event, 0, sizeof( event ) );
+	event.events = events;
+	event.data.ptr = io;
+
+	if( io->events == 0 )
+		epoll_ctl( worker->epfd, EPOLL_CTL_ADD, io->fd, &event );
+	else if( events == 0 )
+		epoll_ctl( worker->epfd, EPOLL_CTL_DEL, io->fd, &event );
+	else
+		epoll_ctl( worker->epfd, EPOLL_CTL_MOD, io->fd, &event );
+
+	io->events = events;
+}
+
+/// Worker: marks the connection as failed and stops watching it.
+static void socket_io_worker_eof( struct s_socket_io_worker* worker, struct s_socket_io* io ){
+	socket_io_worker_events( worker, io, 0 );
+	io->eof.store( true );
+	socket_io_notify_main();
+}
+
+/// Worker: receives all pending data of the connection into its ring.
+static void socket_io_worker_recv( struct s_socket_io_worker* worker, struct s_socket_io* io ){
+	bool received = false;
+
+	while( !io->eof.load( std::memory_order_relaxed ) ){
+		size_t space;
+		uint8* buf = io->rdata.write_span( space );
+
+		if( space == 0 ){
+			// stop reading until the main thread made some space again
+			io->throttled.store( true );
+			worker->throttled.push_back( io );
+			socket_io_worker_events( worker, io, io->events & ~EPOLLIN );
+			break;
+		}
+
+		int len = (int)recv( io->fd, buf, space, 0 );
+
+		if( len > 0 ){
+			io->rdata.commit_write( len );
+			received = true;
+
+			if( (size_t)len < space )
+				break;
+		}else if( len == 0 || ( sErrno != S_EWOULDBLOCK && sErrno != S_EINTR ) ){
+			socket_io_worker_eof( worker, io );
+			break;
+		}else{
+			break;
+		}
+	}
+
+	if( received )
+		socket_io_notify_main();
+}
+
+/// Worker: sends as much data of the connection's ring as possible.
+static void socket_io_worker_send( struct s_socket_io_worker* worker, struct s_socket_io* io ){
+	uint32 events = io->events;
+
+	while( !io->eof.load( std::memory_order_relaxed ) ){
+		size_t span;
+		uint8* buf = io->wdata.read_span( span );
+
+		if( span == 0 ){
+			events &= ~EPOLLOUT;
+			break;
+		}
+
+		int len = (int)send( io->fd, buf, span, MSG_NOSIGNAL );
+
+		if( len > 0 ){
+			io->wdata.commit_read( len );
+		}else if( len < 0 && ( sErrno == S_EWOULDBLOCK || sErrno == S_EINTR ) ){
+			// wait until the socket is writable again
+			events |= EPOLLOUT;
+			break;
+		}else{
+			socket_io_worker_eof( worker, io );
+			return;
+		}
+	}
+
+	if( !io->eof.load( std::memory_order_relaxed ) )
+		socket_io_worker_events( worker, io, events );
+
+	// the main thread has more data for this connection
+	if( io->wdata_full.load() && io->wdata.writable() > 0 ){
+		io->wdata_full.store( false );
+		socket_io_notify_main();
+	}
+}
+
+/// Worker: closes the connection after trying to send the remaining data.
+static void socket_io_worker_remove( struct s_socket_io_worker* worker, struct s_socket_io* io ){
+	socket_io_worker_send( worker, io );
+	socket_io_worker_events( worker, io, 0 );
+
+	for( size_t i = 0; i < worker->throttled.size(); i++ ){
+		if( worker->throttled[i] == io ){
+			worker->throttled.erase( worker->throttled.begin() + i );
+			break;
+		}
+	}
+
+	sShutdown( io->fd, SHUT_RDWR );
+	sClose( io->fd );
+	delete io;
+}
+
+/// Worker: processes all queued commands of the main thread.
+static void socket_io_worker_commands( struct s_socket_io_worker* worker ){
+	struct s_socket_io_command command;
+
+	while( worker->commands.read( &command, 1 ) == 1 ){
+		switch( command.type ){
+			case SOCKET_IO_ADD:
+				socket_io_worker_events( worker, command.io, EPOLLIN );
+				break;
+			case SOCKET_IO_SEND:
+				command.io->send_queued.store( false );
+				socket_io_worker_send( worker, command.io );
+				break;
+			case SOCKET_IO_REMOVE:
+				socket_io_worker_remove( worker, command.io );
+				break;
+		}
+	}
+}
+
+/// Main loop of an I/O worker thread.
+static void socket_io_worker_main( struct s_socket_io_worker* worker ){
+	struct epoll_event events[64];
+
+	while( true ){
+		bool stop = !socket_io_running.load();
+		int count = epoll_wait( worker->epfd, events, ARRAYLENGTH( events ), stop ? 0 : -1 );
+
+		for( int i = 0; i < count; i++ ){
+			struct s_socket_io* io = (struct s_socket_io*)events[i].data.ptr;
+
+			if( io == nullptr ){
+				// woken up by the main thread
+				uint64 value;
+
+				if( read( worker->wakefd, &value, sizeof( value ) ) < 0 ){
+					// the counter was reset already
+				}
+				continue;
+			}
+
+			if( events[i].events & ( EPOLLERR | EPOLLHUP ) && !( events[i].events & EPOLLIN ) ){
+				socket_io_worker_eof( worker, io );
+				continue;
+			}
+
+			if( events[i].events & EPOLLIN )
+				socket_io_worker_recv( worker, io );
+
+			if( events[i].events & EPOLLOUT )
+				socket_io_worker_send( worker, io );
+		}
+
+		socket_io_worker_commands( worker );
+
+		// continue reading from connections, which were drained by the main thread
+		for( size_t i = 0; i < worker->throttled.size(); ){
+			struct s_socket_io* io = worker->throttled[i];
+
+			if( io->rdata.writable() == 0 ){
+				i++;
+				continue;
+			}
+
+			io->throttled.store( false );
+			worker->throttled.erase( worker->throttled.begin() + i );
+
+			if( !io->eof.load( std::memory_order_relaxed ) ){
+				socket_io_worker_events( worker, io, io->events | EPOLLIN );
+				socket_io_worker_recv( worker, io );
+			}
+		}
+
+		if( stop )
+			break;
+	}
+}
+
+/// Queues a command for the worker of the connection.
+static void socket_io_command( struct s_socket_io* io, e_socket_io_command type ){
+	struct s_socket_io_worker* worker = socket_io_workers[io->worker];
+	struct s_socket_io_command command;
+
+	command.type = type;
+	command.io = io;
+
+	if( worker->commands.write( &command, 1 ) != 1 ){
+		ShowFatalError( "socket_io_command: Command queue of I/O worker %" PRIuPTR " overflowed.\n", io->worker );
+		exit( EXIT_FAILURE );
+	}
+
+	worker->wake = true;
+}
+
+/// Wakes up all workers, which have new commands.
+static void socket_io_wakeup( void ){
+	for( struct s_socket_io_worker* worker : socket_io_workers ){
+		if( worker->wake ){
+			uint64 value = 1;
+
+			worker->wake = false;
+
+			if( write( worker->wakefd, &value, sizeof( value ) ) < 0 ){
+				// the counter is already set
+			}
+		}
+	}
+}
+
+/// Hands a connected socket over to an I/O worker.
+static void socket_io_attach( int fd ){
+	session[fd]->io = new s_socket_io( fd, fd % socket_io_workers.size() );
+	socket_io_command( session[fd]->io, SOCKET_IO_ADD );
+}
+
+/// Hands the socket back to its I/O worker for closing it.
+/// The worker closes the socket, so the fd can not be reused before the worker is done with it.
+static void socket_io_detach( int fd ){
+	struct s_socket_io* io = session[fd]->io;
+
+	session[fd]->io = nullptr;
+	socket_io_command( io, SOCKET_IO_REMOVE );
+	socket_io_wakeup();
+}
+
+/// Copies the data received by the I/O worker into the read fifo.
+static int socket_io_recv( int fd ){
+	struct s_socket_io* io = session[fd]->io;
+	size_t len;
+
+	if( !session_isActive( fd ) )
+		return -1;
+
+	// check for eof before reading, so no data is lost that was received right before it
+	bool eof = io->eof.load();
+
+	len = io->rdata.read( session[fd]->rdata + session[fd]->rdata_size, RFIFOSPACE( fd ) );
+
+	if( len > 0 ){
+		session[fd]->rdata_size += len;
+		session[fd]->rdata_tick = last_tick;
+#ifdef SHOW_SERVER_STATS
+		socket_data_i += len;
+		socket_data_qi += len;
+		if (!session[fd]->flag.server)
+		{
+			socket_data_ci += len;
+		}
+#endif
+
+		// the worker stopped reading from this connection
+		if( io->throttled.load() )
+			socket_io_workers[io->worker]->wake = true;
+	}
+
+	if( eof && io->rdata.readable() == 0 )
+		set_eof( fd );
+
+	return 0;
+}
+
+/// Copies the data into the send ring of the I/O worker and returns the amount of bytes that were copied.
+static int socket_io_send( int fd, socket_iovec* iov, int count ){
+	struct s_socket_io* io = session[fd]->io;
+	size_t len = 0;
+
+	for( int i = 0; i < count; i++ ){
+		size_t n = io->wdata.write( (uint8*)iov[i].iov_base, iov[i].iov_len );
+
+		len += n;
+
+		if( n < iov[i].iov_len ){
+			// the worker notifies the main thread, when there is space again
+			io->wdata_full.store( true );
+
+			// recheck in case the worker drained the ring in the meantime
+			if( io->wdata.writable() > 0 && io->wdata_full.exchange( false ) )
+				socket_io_notify_main();
+			break;
+		}
+	}
+
+	if( len > 0 && !io->send_queued.exchange( true ) )
+		socket_io_command( io, SOCKET_IO_SEND );
+
+	return (int)len;
+}
+
+/// Starts the I/O worker threads.
+static void socket_io_init( void ){
+	struct epoll_event event;
+
+	if( socket_io_threads <= 0 )
+		return;
+
+	socket_io_wakefd = eventfd( 0, EFD_NONBLOCK );
+
+	if( socket_io_wakefd == SOCKET_ERROR ){
+		ShowError( "socket_io_init: Failed to create wake up event: %s\n", error_msg() );
+		exit( EXIT_FAILURE );
+	}
+
+	memset( &event, 0, sizeof( event ) );
+	event.events = EPOLLIN;
+	event.data.fd = socket_io_wakefd;
+
+	if( epoll_ctl( epfd, EPOLL_CTL_ADD, socket_io_wakefd, &event ) == SOCKET_ERROR ){
+		ShowError( "socket_io_init: Failed to add wake up event to epoll event dispatcher: %s\n", error_msg() );
+		exit( EXIT_FAILURE );
+	}
+
+	socket_io_running.store( true );
+
+	for( int i = 0; i < socket_io_threads; i++ ){
+		struct s_socket_io_worker* worker = new s_socket_io_worker();
+
+		worker->epfd = epoll_create( MAXCONN );
+		worker->wakefd = eventfd( 0, EFD_NONBLOCK );
+
+		if( worker->epfd == SOCKET_ERROR || worker->wakefd == SOCKET_ERROR ){
+			ShowError( "socket_io_init: Failed to create I/O worker %d: %s\n", i, error_msg() );
+			exit( EXIT_FAILURE );
+		}
+
+		memset( &event, 0, sizeof( event ) );
+		event.events = EPOLLIN;
+		event.data.ptr = nullptr;
+
+		if( epoll_ctl( worker->epfd, EPOLL_CTL_ADD, worker->wakefd, &event ) == SOCKET_ERROR ){
+			ShowError( "socket_io_init: Failed to add wake up event of I/O worker %d: %s\n", i, error_msg() );
+			exit( EXIT_FAILURE );
+		}
+
+		worker->thread = std::thread( socket_io_worker_main, worker );
+		socket_io_workers.push_back( worker );
+	}
+
+	ShowInfo( "Server uses " CL_WHITE "%d" CL_RESET " I/O worker threads\n", socket_io_threads );
+}
+
+/// Stops the I/O worker threads, after they closed all remaining connections.
+static void socket_io_final( void ){
+	socket_io_running.store( false );
+
+	for( struct s_socket_io_worker* worker : socket_io_workers ){
+		worker->wake = true;
+	}
+
+	socket_io_wakeup();
+
+	for( struct s_socket_io_worker* worker : socket_io_workers ){
+		worker->thread.join();
+		sClose( worker->epfd );
+		sClose( worker->wakefd );
+		delete worker;
+	}
+
+	socket_io_workers.clear();
+
+	if( socket_io_wakefd != SOCKET_ERROR ){
+		sClose( socket_io_wakefd );
+		socket_io_wakefd = SOCKET_ERROR;
+	}
+}
+#endif
+
+#ifdef SOCKET_IOURING
+/*======================================
+ *	CORE : io_uring event dispatcher
+ *--------------------------------------
+ * All socket operations are queued on a single io_uring instance and
+ * submitted together with the wait for their completions, so a server cycle
+ * needs a single system call for all of its sends and receives.
+ * Each connection owns a slot of one registered buffer area, which is filled
+ * by its pending receive and holds the data of its pending send.
+ * The kernel interface is used directly, so liburing is not required.
+ *--------------------------------------*/
+
+// size of the receive buffer of a connection
+#define SOCKET_URING_RSIZE (16*1024)
+// size of the send buffer of a connection
+#define SOCKET_URING_WSIZE (16*1024)
+
+enum e_socket_uring_op : uint8 {
+	SOCKET_URING_ACCEPT = 1,
+	SOCKET_URING_RECV,
+	SOCKET_URING_SEND,
+};
+
+enum e_socket_uring_state : uint8 {
+	SOCKET_URING_UNUSED = 0,
+	SOCKET_URING_ACTIVE, // connection with a session
+	SOCKET_URING_LISTEN, // listening socket
+	SOCKET_URING_CLOSING, // the socket is closed, once the kernel completed its pending operations
+};
+
+struct s_socket_uring_conn {
+	e_socket_uring_state state;
+	uint8 pending; // amount of operations in the kernel
+	bool recv_pending;
+	bool send_pending;
+	bool eof; // the connection failed or was closed by the remote side
+	uint32 rpos, rlen; // received data, which was not copied into the read fifo yet
+	uint32 wpos, wlen; // data in the send buffer, which was not sent yet
+};
+
+struct s_socket_uring {
+	int fd;
+	// submission queue
+	uint32 sq_entries;
+	uint32* sq_head;
+	uint32* sq_tail;
+	uint32* sq_mask;
+	uint32* sq_array;
+	struct io_uring_sqe* sqes;
+	uint32 sq_queued; // local tail of the submission queue
+	uint32 sq_unsubmitted; // amount of queued entries, that were not submitted yet
+	// completion queue
+	uint32* cq_head;
+	uint32* cq_tail;
+	uint32* cq_mask;
+	struct io_uring_cqe* cqes;
+	// mappings
+	void* sq_ring;
+	size_t sq_ring_size;
+	void* cq_ring;
+	size_t cq_ring_size;
+	size_t sqes_size;
+	// buffers of all connections
+	uint8* buffers;
+	size_t buffers_size;
+	bool fixed_buffers; // the buffers are registered with the kernel
+	bool multishot_accept; // a single accept operation completes for all connections
+};
+
+static struct s_socket_uring socket_uring;
+static struct s_socket_uring_conn socket_uring_conns[MAXCONN];
+
+static void session_clear_shared(struct socket_data* s);
+
+static inline uint8* socket_uring_rbuf( int fd ){
+	return socket_uring.buffers + (size_t)fd * ( SOCKET_URING_RSIZE + SOCKET_URING_WSIZE );
+}
+
+static inline uint8* socket_uring_wbuf( int fd ){
+	return socket_uring_rbuf( fd ) + SOCKET_URING_RSIZE;
+}
+
+/// Submits all queued operations to the kernel and optionally waits for completions.
+/// @param wait: wait for at least one completion
+/// @param timeout: maximum time to wait in milliseconds
+/// @return amount of submitted operations or the negated error code
+static int socket_uring_enter( bool wait, t_tick timeout ){
+	struct io_uring_getevents_arg arg;
+	struct __kernel_timespec ts;
+	uint32 flags = 0;
+	int ret;
+
+	__atomic_store_n( socket_uring.sq_tail, socket_uring.sq_queued, __ATOMIC_RELEASE );
+
+	if( wait ){
+		memset( &arg, 0, sizeof( arg ) );
+		ts.tv_sec = timeout / 1000;
+		ts.tv_nsec = ( timeout % 1000 ) * 1000000;
+		arg.sigmask_sz = _NSIG / 8;
+		arg.ts = (uint64)(uintptr_t)&ts;
+		flags = IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG;
+	}
+
+	ret = (int)syscall( __NR_io_uring_enter, socket_uring.fd, socket_uring.sq_unsubmitted, wait ? 1 : 0, flags, wait ? &arg : nullptr, wait ? sizeof( arg ) : 0 );
+
+	if( ret < 0 )
+		return -sErrno;
+
+	socket_uring.sq_unsubmitted -= ret;
+
+	return ret;
+}
+
+/// Submits all queued operations to the kernel without waiting.
+static void socket_uring_submit( void ){
+	if( socket_uring.sq_unsubmitted == 0 )
+		return;
+
+	int ret = socket_uring_enter( false, 0 );
+
+	if( ret < 0 && ret != -EINTR && ret != -EAGAIN && ret != -EBUSY ){
+		ShowFatalError( "socket_uring_submit: io_uring_enter() failed, %s!\n", sErr( -ret ) );
+		exit( EXIT_FAILURE );
+	}
+}
+
+/// Returns a cleared submission queue entry, which is submitted with the next enter.
+static struct io_uring_sqe* socket_uring_get_sqe( void ){
+	if( socket_uring.sq_queued - __atomic_load_n( socket_uring.sq_head, __ATOMIC_ACQUIRE ) >= socket_uring.sq_entries ){
+		// the queue is full, hand the entries over to the kernel
+		socket_uring_submit();
+
+		if( socket_uring.sq_queued - __atomic_load_n( socket_uring.sq_head, __ATOMIC_ACQUIRE ) >= socket_uring.sq_entries ){
+			ShowFatalError( "socket_uring_get_sqe: Submission queue overflowed.\n" );
+			exit( EXIT_FAILURE );
+		}
+	}
+
+	uint32 index = socket_uring.sq_queued & *socket_uring.sq_mask;
+	struct io_uring_sqe* sqe = &socket_uring.sqes[index];
+
+	memset( sqe, 0, sizeof( struct io_uring_sqe ) );
+	socket_uring.sq_array[index] = index;
+	socket_uring.sq_queued++;
+	socket_uring.sq_unsubmitted++;
+
+	return sqe;
+}
+
+static inline uint64 socket_uring_userdata( e_socket_uring_op op, int fd ){
+	return ( (uint64)op << 32 ) | (uint32)fd;
+}
+
+/// Queues an accept operation on the listening socket.
+static void socket_uring_queue_accept( int fd ){
+	struct io_uring_sqe* sqe = socket_uring_get_sqe();
+
+	sqe->opcode = IORING_OP_ACCEPT;
+	sqe->fd = fd;
+	if( socket_uring.multishot_accept )
+		sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+	sqe->user_data = socket_uring_userdata( SOCKET_URING_ACCEPT, fd );
+
+	socket_uring_conns[fd].pending++;
+}
+
+/// Queues a receive operation into the receive buffer of the connection.
+static void socket_uring_queue_recv( int fd ){
+	struct s_socket_uring_conn* conn = &socket_uring_conns[fd];
+	struct io_uring_sqe* sqe = socket_uring_get_sqe();
+
+	sqe->fd = fd;
+	sqe->addr = (uint64)(uintptr_t)socket_uring_rbuf( fd );
+	sqe->len = SOCKET_URING_RSIZE;
+	sqe->user_data = socket_uring_userdata( SOCKET_URING_RECV, fd );
+
+	if( socket_uring.fixed_buffers ){
+		sqe->opcode = IORING_OP_READ_FIXED;
+		sqe->buf_index = 0;
+	}else{
+		sqe->opcode = IORING_OP_RECV;
+	}
+
+	conn->rpos = 0;
+	conn->rlen = 0;
+	conn->recv_pending = true;
+	conn->pending++;
+}
+
+/// Queues a send operation for the unsent data of the send buffer of the connection.
+static void socket_uring_queue_send( int fd ){
+	struct s_socket_uring_conn* conn = &socket_uring_conns[fd];
+	struct io_uring_sqe* sqe = socket_uring_get_sqe();
+
+	sqe->fd = fd;
+	sqe->addr = (uint64)(uintptr_t)( socket_uring_wbuf( fd ) + conn->wpos );
+	sqe->len = conn->wlen - conn->wpos;
+	sqe->user_data = socket_uring_userdata( SOCKET_URING_SEND, fd );
+
+	if( socket_uring.fixed_buffers ){
+		sqe->opcode = IORING_OP_WRITE_FIXED;
+		sqe->buf_index = 0;
+	}else{
+		sqe->opcode = IORING_OP_SEND;
+		sqe->msg_flags = MSG_NOSIGNAL;
+	}
+
+	conn->send_pending = true;
+	conn->pending++;
+}
+
+/// Starts receiving on a connected socket, which has a session.
+static void socket_uring_attach( int fd ){
+	struct s_socket_uring_conn* conn = &socket_uring_conns[fd];
+
+	// the kernel waits for the socket itself, older kernels fail operations on non-blocking sockets instead
+	set_nonblocking( fd, 0 );
+
+	memset( conn, 0, sizeof( struct s_socket_uring_conn ) );
+	conn->state = SOCKET_URING_ACTIVE;
+	socket_uring_queue_recv( fd );
+}
+
+/// Starts accepting connections on a listening socket.
+static void socket_uring_listen( int fd ){
+	struct s_socket_uring_conn* conn = &socket_uring_conns[fd];
+
+	set_nonblocking( fd, 0 );
+
+	memset( conn, 0, sizeof( struct s_socket_uring_conn ) );
+	conn->state = SOCKET_URING_LISTEN;
+	socket_uring_queue_accept( fd );
+}
+
+/// Shuts the socket down and defers closing it until the kernel completed its pending operations.
+/// The fd can not be reused for a new connection, while the kernel still writes into its buffers.
+/// @return true if closing the socket was deferred
+static bool socket_uring_close( int fd ){
+	struct s_socket_uring_conn* conn = &socket_uring_conns[fd];
+
+	if( conn->state != SOCKET_URING_ACTIVE && conn->state != SOCKET_URING_LISTEN )
+		return false;
+
+	// hand queued sends over to the kernel, before they fail on the closed socket
+	socket_uring_submit();
+
+	// completes the pending operations
+	// a send might still be copied into the socket by an io-wq worker, so it is only shut down for reading,
+	// the final packets are sent before the socket is closed
+	sShutdown( fd, conn->state == SOCKET_URING_LISTEN ? SHUT_RDWR : SHUT_RD );
+
+	if( conn->pending == 0 ){
+		conn->state = SOCKET_URING_UNUSED;
+		return false;
+	}
+
+	conn->state = SOCKET_URING_CLOSING;
+	return true;
+}
+
+/// Copies the data received by the kernel into the read fifo.
+static int socket_uring_recv( int fd ){
+	struct s_socket_uring_conn* conn = &socket_uring_conns[fd];
+
+	if( conn->rlen > 0 ){
+		size_t len = conn->rlen;
+
+		if( len > RFIFOSPACE( fd ) )
+			len = RFIFOSPACE( fd );
+
+		memcpy( session[fd]->rdata + session[fd]->rdata_size, socket_uring_rbuf( fd ) + conn->rpos, len );
+		conn->rpos += (uint32)len;
+		conn->rlen -= (uint32)len;
+
+		session[fd]->rdata_size += len;
+		session[fd]->rdata_tick = last_tick;
+#ifdef SHOW_SERVER_STATS
+		socket_data_i += len;
+		socket_data_qi += len;
+		if (!session[fd]->flag.server)
+		{
+			socket_data_ci += len;
+		}
+#endif
+	}
+
+	if( conn->rlen == 0 ){
+		if( conn->eof )
+			set_eof( fd );
+		else if( !conn->recv_pending )
+			socket_uring_queue_recv( fd );
+	}
+
+	return 0;
+}
+
+/// Copies the data into the send buffer of the connection and returns the amount of bytes that were copied.
+/// Nothing is copied, while the previous send is still pending.
+static int socket_uring_send( int fd, socket_iovec* iov, int count ){
+	struct s_socket_uring_conn* conn = &socket_uring_conns[fd];
+	uint8* buf = socket_uring_wbuf( fd );
+	size_t len = 0;
+
+	if( conn->state != SOCKET_URING_ACTIVE || conn->send_pending || conn->eof )
+		return 0;
+
+	for( int i = 0; i < count && len < SOCKET_URING_WSIZE; i++ ){
+		size_t n = iov[i].iov_len;
+
+		if( n > SOCKET_URING_WSIZE - len )
+			n = SOCKET_URING_WSIZE - len;
+
+		memcpy( buf + len, iov[i].iov_base, n );
+		len += n;
+	}
+
+	if( len == 0 )
+		return 0;
+
+	conn->wpos = 0;
+	conn->wlen = (uint32)len;
+	socket_uring_queue_send( fd );
+
+	return (int)len;
+}
+
+/// Processes a completed operation of a connection, whose socket is closed already.
+static void socket_uring_complete_closing( int fd ){
+	struct s_socket_uring_conn* conn = &socket_uring_conns[fd];
+
+	if( conn->pending > 0 )
+		return;
+
+	sClose( fd );
+	conn->state = SOCKET_URING_UNUSED;
+}
+
+/// Processes a completed accept operation.
+static void socket_uring_complete_accept( int listen_fd, struct io_uring_cqe* cqe ){
+	struct s_socket_uring_conn* conn = &socket_uring_conns[listen_fd];
+	bool more = ( cqe->flags & IORING_CQE_F_MORE ) != 0;
+
+	if( !more )
+		conn->pending--;
+
+	if( conn->state != SOCKET_URING_LISTEN ){
+		if( cqe->res >= 0 )
+			sClose( cqe->res );
+		if( conn->state == SOCKET_URING_CLOSING )
+			socket_uring_complete_closing( listen_fd );
+		return;
+	}
+
+	if( cqe->res >= 0 ){
+		struct sockaddr_in client_address;
+		socklen_t len = sizeof( client_address );
+
+		if( getpeername( cqe->res, (struct sockaddr*)&client_address, &len ) == SOCKET_ERROR ){
+			// the connection was reset before it was processed
+			if( sErrno != ENOTCONN )
+				ShowError( "connect_client: getpeername failed (%s)!\n", error_msg() );
+			sClose( cqe->res );
+		}else{
+			connect_client_setup( cqe->res, &client_address );
+		}
+	}else if( cqe->res == -EINVAL && socket_uring.multishot_accept ){
+		// not supported by the kernel, accept a single connection per operation
+		socket_uring.multishot_accept = false;
+	}else{
+		ShowError( "connect_client: accept failed (%s)!\n", sErr( -cqe->res ) );
+	}
+
+	if( !more )
+		socket_uring_queue_accept( listen_fd );
+}
+
+/// Processes a completed receive operation.
+static void socket_uring_complete_recv( int fd, struct io_uring_cqe* cqe ){
+	struct s_socket_uring_conn* conn = &socket_uring_conns[fd];
+
+	conn->pending--;
+	conn->recv_pending = false;
+
+	if( conn->state != SOCKET_URING_ACTIVE ){
+		if( conn->state == SOCKET_URING_CLOSING )
+			socket_uring_complete_closing( fd );
+		return;
+	}
+
+	if( cqe->res > 0 ){
+		// copied into the read fifo, when the session is parsed
+		conn->rpos = 0;
+		conn->rlen = cqe->res;
+	}else if( cqe->res == -EAGAIN || cqe->res == -EINTR ){
+		socket_uring_queue_recv( fd );
+	}else{
+		// normal connection end or an exception
+		conn->eof = true;
+	}
+}
+
+/// Processes a completed send operation.
+static void socket_uring_complete_send( int fd, struct io_uring_cqe* cqe ){
+	struct s_socket_uring_conn* conn = &socket_uring_conns[fd];
+
+	conn->pending--;
+	conn->send_pending = false;
+
+	if( conn->state != SOCKET_URING_ACTIVE ){
+		if( conn->state == SOCKET_URING_CLOSING )
+			socket_uring_complete_closing( fd );
+		return;
+	}
+
+	if( cqe->res > 0 ){
+		conn->wpos += cqe->res;
+	}else if( cqe->res != -EAGAIN && cqe->res != -EINTR ){
+		// an exception has occured, clear the send queue as we can't send anymore
+		struct socket_data* s = session[fd];
+
+		conn->eof = true;
+		conn->wpos = conn->wlen = 0;
+
+		if( s != nullptr ){
+#ifdef SHOW_SERVER_STATS
+			socket_data_qo -= s->wdata_size + s->wshared_size;
+#endif
+			s->wdata_size = 0;
+			session_clear_shared( s );
+			set_eof( fd );
+		}
+		return;
+	}
+
+	if( conn->wpos < conn->wlen ){
+		// partially sent
+		socket_uring_queue_send( fd );
+		return;
+	}
+
+	conn->wpos = conn->wlen = 0;
+
+	if( session[fd] != nullptr ){
+		session[fd]->wdata_tick = last_tick;
+
+#ifdef SEND_SHORTLIST
+		// send the data, which did not fit into the send buffer
+		if( session[fd]->wdata_size || session[fd]->wshared_count )
+			send_shortlist_add_fd( fd );
+#endif
+	}
+}
+
+/// Submits all queued operations and waits for completions.
+/// @param timeout: maximum time to wait in milliseconds
+/// @return SOCKET_ERROR if the wait was interrupted
+static int socket_uring_wait( t_tick timeout ){
+	int ret;
+
+	if( __atomic_load_n( socket_uring.cq_tail, __ATOMIC_ACQUIRE ) != *socket_uring.cq_head ){
+		// completions are ready already
+		timeout = 0;
+	}
+
+	ret = socket_uring_enter( true, timeout );
+
+	if( ret < 0 && ret != -ETIME && ret != -EAGAIN && ret != -EBUSY ){
+		if( ret != -EINTR ){
+			ShowFatalError( "do_sockets: io_uring_enter() failed, %s!\n", sErr( -ret ) );
+			exit( EXIT_FAILURE );
+		}
+
+		return SOCKET_ERROR; // interrupted by a signal, just loop and try again
+	}
+
+	return 0;
+}
+
+/// Processes all completed operations.
+static void socket_uring_dispatch( void ){
+	uint32 head = *socket_uring.cq_head;
+	uint32 tail = __atomic_load_n( socket_uring.cq_tail, __ATOMIC_ACQUIRE );
+
+	for( ; head != tail; head++ ){
+		struct io_uring_cqe cqe = socket_uring.cqes[head & *socket_uring.cq_mask];
+		int fd = (int)( cqe.user_data & 0xFFFFFFFF );
+
+		switch( (e_socket_uring_op)( cqe.user_data >> 32 ) ){
+			case SOCKET_URING_ACCEPT:
+				socket_uring_complete_accept( fd, &cqe );
+				break;
+			case SOCKET_URING_RECV:
+				socket_uring_complete_recv( fd, &cqe );
+				break;
+			case SOCKET_URING_SEND:
+				socket_uring_complete_send( fd, &cqe );
+				break;
+		}
+	}
+
+	__atomic_store_n( socket_uring.cq_head, head, __ATOMIC_RELEASE );
+}
+
+/// Creates the io_uring instance and the buffers of all connections.
+static void socket_uring_init( void ){
+	struct io_uring_params params;
+	uint32 entries = 64;
+
+	while( entries < MAXCONN && entries < 4096 )
+		entries *= 2;
+
+	memset( &socket_uring, 0, sizeof( socket_uring ) );
+	memset( &params, 0, sizeof( params ) );
+	params.flags = IORING_SETUP_CQSIZE;
+	params.cq_entries = 4 * entries;
+
+	socket_uring.fd = (int)syscall( __NR_io_uring_setup, entries, &params );
+
+	if( socket_uring.fd == SOCKET_ERROR ){
+		ShowError( "Failed to create io_uring event dispatcher: %s\n", error_msg() );
+		exit( EXIT_FAILURE );
+	}
+
+	if( !( params.features & IORING_FEAT_EXT_ARG ) ){
+		ShowError( "Failed to create io_uring event dispatcher: Linux 5.11 or newer is required.\n" );
+		exit( EXIT_FAILURE );
+	}
+
+	socket_uring.sq_ring_size = params.sq_off.array + params.sq_entries * sizeof( uint32 );
+	socket_uring.cq_ring_size = params.cq_off.cqes + params.cq_entries * sizeof( struct io_uring_cqe );
+
+	if( params.features & IORING_FEAT_SINGLE_MMAP ){
+		if( socket_uring.cq_ring_size > socket_uring.sq_ring_size )
+			socket_uring.sq_ring_size = socket_uring.cq_ring_size;
+		else
+			socket_uring.cq_ring_size = socket_uring.sq_ring_size;
+	}
+
+	socket_uring.sq_ring = mmap( nullptr, socket_uring.sq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, socket_uring.fd, IORING_OFF_SQ_RING );
+
+	if( params.features & IORING_FEAT_SINGLE_MMAP ){
+		socket_uring.cq_ring = socket_uring.sq_ring;
+	}else{
+		socket_uring.cq_ring = mmap( nullptr, socket_uring.cq_ring_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, socket_uring.fd, IORING_OFF_CQ_RING );
+	}
+
+	socket_uring.sqes_size = params.sq_entries * sizeof( struct io_uring_sqe );
+	socket_uring.sqes = (struct io_uring_sqe*)mmap( nullptr, socket_uring.sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, socket_uring.fd, IORING_OFF_SQES );
+
+	if( socket_uring.sq_ring == MAP_FAILED || socket_uring.cq_ring == MAP_FAILED || socket_uring.sqes == MAP_FAILED ){
+		ShowError( "Failed to map io_uring event dispatcher: %s\n", error_msg() );
+		exit( EXIT_FAILURE );
+	}
+
+	uint8* sq = (uint8*)socket_uring.sq_ring;
+	uint8* cq = (uint8*)socket_uring.cq_ring;
 
-static int create_session(int fd, RecvFunc func_recv, SendFunc func_send, ParseFunc func_parse);
+	socket_uring.sq_entries = params.sq_entries;
+	socket_uring.sq_head = (uint32*)( sq + params.sq_off.head );
+	socket_uring.sq_tail = (uint32*)( sq + params.sq_off.tail );
+	socket_uring.sq_mask = (uint32*)( sq + params.sq_off.ring_mask );
+	socket_uring.sq_array = (uint32*)( sq + params.sq_off.array );
+	socket_uring.sq_queued = *socket_uring.sq_tail;
+	socket_uring.cq_head = (uint32*)( cq + params.cq_off.head );
+	socket_uring.cq_tail = (uint32*)( cq + params.cq_off.tail );
+	socket_uring.cq_mask = (uint32*)( cq + params.cq_off.ring_mask );
+	socket_uring.cqes = (struct io_uring_cqe*)( cq + params.cq_off.cqes );
 
-#ifndef MINICORE
-	int ip_rules = 1;
-	static int connect_check(uint32 ip);
-#endif
+	// buffers of all connections, in a single area, so they can be registered at once
+	socket_uring.buffers_size = (size_t)MAXCONN * ( SOCKET_URING_RSIZE + SOCKET_URING_WSIZE );
+	socket_uring.buffers = (uint8*)mmap( nullptr, socket_uring.buffers_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0 );
 
-const char* error_msg(void)
-{
-	static char buf[512];
-	int code = sErrno;
-	snprintf(buf, sizeof(buf), "error %d: %s", code, sErr(code));
-	return buf;
-}
+	if( socket_uring.buffers == MAP_FAILED ){
+		ShowError( "Failed to allocate io_uring buffers: %s\n", error_msg() );
+		exit( EXIT_FAILURE );
+	}
 
-/*======================================
- *	CORE : Default processing functions
- *--------------------------------------*/
-int null_recv(int fd) { return 0; }
-int null_send(int fd) { return 0; }
-int null_parse(int fd) { return 0; }
+	struct iovec iov;
 
-ParseFunc default_func_parse = null_parse;
+	iov.iov_base = socket_uring.buffers;
+	iov.iov_len = socket_uring.buffers_size;
 
-void set_defaultparse(ParseFunc defaultparse)
-{
-	default_func_parse = defaultparse;
-}
+	if( syscall( __NR_io_uring_register, socket_uring.fd, IORING_REGISTER_BUFFERS, &iov, 1 ) == 0 ){
+		socket_uring.fixed_buffers = true;
+	}else{
+		// most likely the limit of locked memory (ulimit -l) is too low
+		ShowWarning( "socket_init: Failed to register %" PRIuPTR " kB of io_uring buffers (%s), using unregistered buffers...\n", socket_uring.buffers_size / 1024, error_msg() );
+	}
 
+	socket_uring.multishot_accept = true;
 
-/*======================================
- *	CORE : Socket options
- *--------------------------------------*/
-void set_nonblocking(int fd, unsigned long yes)
-{
-	// FIONBIO Use with a nonzero argp parameter to enable the nonblocking mode of socket s.
-	// The argp parameter is zero if nonblocking is to be disabled.
-	if( sIoctl(fd, FIONBIO, &yes) != 0 )
-		ShowError("set_nonblocking: Failed to set socket #%d to non-blocking mode (%s) - Please report this!!!\n", fd, error_msg());
+	ShowInfo( "Server uses '" CL_WHITE "io_uring" CL_RESET "' with " CL_WHITE "%u" CL_RESET " submission entries as event dispatcher\n", params.sq_entries );
 }
 
-void setsocketopts(int fd,int delay_timeout){
-	int yes = 1; // reuse fix
-
-#if !defined(WIN32)
-	// set SO_REAUSEADDR to true, unix only. on windows this option causes
-	// the previous owner of the socket to give up, which is not desirable
-	// in most cases, neither compatible with unix.
-	sSetsockopt(fd,SOL_SOCKET,SO_REUSEADDR,(char *)&yes,sizeof(yes));
-#ifdef SO_REUSEPORT
-	sSetsockopt(fd,SOL_SOCKET,SO_REUSEPORT,(char *)&yes,sizeof(yes));
-#endif
-#endif
+/// Destroys the io_uring instance and closes the sockets, which were waiting for it.
+static void socket_uring_final( void ){
+	if( socket_uring.fd == SOCKET_ERROR )
+		return;
 
-	// Set the socket into no-delay mode; otherwise packets get delayed for up to 200ms, likely creating server-side lag.
-	// The RO protocol is mainly single-packet request/response, plus the FIFO model already does packet grouping anyway.
-	sSetsockopt(fd, IPPROTO_TCP, TCP_NODELAY, (char *)&yes, sizeof(yes));
+	// destroying the instance cancels the remaining operations
+	sClose( socket_uring.fd );
+	socket_uring.fd = SOCKET_ERROR;
 
-	// force the socket into no-wait, graceful-close mode (should be the default, but better make sure)
-	//(https://msdn.microsoft.com/en-us/library/windows/desktop/ms737582%28v=vs.85%29.aspx)
-	{
-		struct linger opt;
-		opt.l_onoff = 0; // SO_DONTLINGER
-		opt.l_linger = 0; // Do not care
-		if( sSetsockopt(fd, SOL_SOCKET, SO_LINGER, (char*)&opt, sizeof(opt)) )
-			ShowWarning("setsocketopts: Unable to set SO_LINGER mode for connection #%d!\n", fd);
+	for( int fd = 1; fd < MAXCONN; fd++ ){
+		if( socket_uring_conns[fd].state == SOCKET_URING_CLOSING )
+			sClose( fd );
+		socket_uring_conns[fd].state = SOCKET_URING_UNUSED;
 	}
-	if(delay_timeout){
-#if defined(WIN32)
-		int timeout = delay_timeout * 1000;
-#else
-		struct timeval timeout;
-		timeout.tv_sec = delay_timeout;
-		timeout.tv_usec = 0;
-#endif
 
-		if (sSetsockopt (fd, SOL_SOCKET, SO_RCVTIMEO, (char *)&timeout,sizeof(timeout)) < 0)
-			ShowError("setsocketopts: Unable to set SO_RCVTIMEO timeout for connection #%d!\n", fd);
-		if (sSetsockopt (fd, SOL_SOCKET, SO_SNDTIMEO, (char *)&timeout,sizeof(timeout)) < 0)
-			ShowError("setsocketopts: Unable to set SO_SNDTIMEO timeout for connection #%d!\n", fd);
-	}
+	munmap( socket_uring.sqes, socket_uring.sqes_size );
+	if( socket_uring.cq_ring != socket_uring.sq_ring )
+		munmap( socket_uring.cq_ring, socket_uring.cq_ring_size );
+	munmap( socket_uring.sq_ring, socket_uring.sq_ring_size );
+	munmap( socket_uring.buffers, socket_uring.buffers_size );
 }
+#endif
 
 /*======================================
  *	CORE : Socket Sub Function
@@ -371,6 +1603,14 @@ int recv_to_fifo(int fd)
 	if( !session_isActive(fd) )
 		return -1;
 
+#ifdef SOCKET_EPOLL
+	if( session[fd]->io != nullptr )
+		return socket_io_recv(fd);
+#endif
+#ifdef SOCKET_IOURING
+	return socket_uring_recv(fd);
+#endif
+
 	len = sRecv(fd, (char *) session[fd]->rdata + session[fd]->rdata_size, (int)RFIFOSPACE(fd), 0);
 
 	if( len == SOCKET_ERROR )
@@ -401,6 +1641,151 @@ int recv_to_fifo(int fd)
 	return 0;
 }
 
+/// Releases all shared packets that are queued on the session.
+static void session_clear_shared(struct socket_data* s)
+{
+	size_t i;
+
+	for( i = 0; i < s->wshared_count; i++ )
+		socket_shared_packet_release(s->wshared[i].packet);
+
+	s->wshared_count = 0;
+	s->wshared_pos = 0;
+	s->wshared_size = 0;
+}
+
+/// Removes len sent bytes from the front of the write fifo and its shared packets.
+static void session_consume_sent(struct socket_data* s, size_t len)
+{
+	size_t wdata_sent = 0, shared_sent = 0, i;
+
+	while( len > 0 ){
+		// write fifo data in front of the next shared packet
+		size_t end = ( shared_sent < s->wshared_count ) ? s->wshared[shared_sent].offset : s->wdata_size;
+		size_t chunk = end - wdata_sent;
+
+		if( chunk > len )
+			chunk = len;
+
+		wdata_sent += chunk;
+		len -= chunk;
+
+		if( len == 0 || shared_sent == s->wshared_count )
+			break;
+
+		// next shared packet
+		struct socket_shared_packet* packet = s->wshared[shared_sent].packet;
+
+		chunk = packet->len - s->wshared_pos;
+
+		if( len < chunk ){
+			s->wshared_pos += len;
+			s->wshared_size -= len;
+			break;
+		}
+
+		len -= chunk;
+		s->wshared_size -= chunk;
+		s->wshared_pos = 0;
+		socket_shared_packet_release(packet);
+		shared_sent++;
+	}
+
+	if( wdata_sent > 0 ){
+		// shift unsent data to the beginning of the queue
+		if( wdata_sent < s->wdata_size )
+			memmove(s->wdata, s->wdata + wdata_sent, s->wdata_size - wdata_sent);
+
+		s->wdata_size -= wdata_sent;
+	}
+
+	if( shared_sent > 0 ){
+		s->wshared_count -= shared_sent;
+		memmove(s->wshared, s->wshared + shared_sent, s->wshared_count * sizeof(struct socket_shared_entry));
+	}
+
+	for( i = 0; i < s->wshared_count; i++ )
+		s->wshared[i].offset -= wdata_sent;
+}
+
+/// Sends the write fifo with its shared packets using scatter/gather sends.
+static int send_from_fifo_shared(int fd)
+{
+	struct socket_data* s = session[fd];
+
+	while( s->wdata_size > 0 || s->wshared_count > 0 ){
+		socket_iovec iov[WFIFO_IOV_MAX];
+		size_t offset = 0, total = 0, i;
+		int count = 0, len;
+
+		for( i = 0; i < s->wshared_count && count + 2 <= WFIFO_IOV_MAX; i++ ){
+			struct socket_shared_entry* entry = &s->wshared[i];
+			size_t pos = ( i == 0 ) ? s->wshared_pos : 0;
+
+			if( entry->offset > offset ){
+				sIovec(iov[count], s->wdata + offset, entry->offset - offset);
+				total += entry->offset - offset;
+				count++;
+				offset = entry->offset;
+			}
+
+			sIovec(iov[count], entry->packet->data + pos, entry->packet->len - pos);
+			total += entry->packet->len - pos;
+			count++;
+		}
+
+		if( i == s->wshared_count && s->wdata_size > offset && count < WFIFO_IOV_MAX ){
+			sIovec(iov[count], s->wdata + offset, s->wdata_size - offset);
+			total += s->wdata_size - offset;
+			count++;
+		}
+
+#if defined(SOCKET_IOURING)
+		len = socket_uring_send(fd, iov, count);
+#else
+#ifdef SOCKET_EPOLL
+		if( s->io != nullptr )
+			len = socket_io_send(fd, iov, count);
+		else
+#endif
+		len = sSendv(fd, iov, count);
+#endif
+
+		if( len == SOCKET_ERROR )
+		{//An exception has occured
+			if( sErrno != S_EWOULDBLOCK ) {
+#ifdef SHOW_SERVER_STATS
+				socket_data_qo -= s->wdata_size + s->wshared_size;
+#endif
+				s->wdata_size = 0; //Clear the send queue as we can't send anymore. [Skotlex]
+				session_clear_shared(s);
+				set_eof(fd);
+			}
+			return 0;
+		}
+
+		if( len <= 0 )
+			return 0;
+
+		s->wdata_tick = last_tick;
+		session_consume_sent(s, len);
+#ifdef SHOW_SERVER_STATS
+		socket_data_o += len;
+		socket_data_qo -= len;
+		if (!s->flag.server)
+		{
+			socket_data_co += len;
+		}
+#endif
+
+		// the socket buffer is full, try again later
+		if( (size_t)len < total )
+			break;
+	}
+
+	return 0;
+}
+
 int send_from_fifo(int fd)
 {
 	int len;
@@ -408,10 +1793,28 @@ int send_from_fifo(int fd)
 	if( !session_isValid(fd) )
 		return -1;
 
+	if( session[fd]->wshared_count > 0 )
+		return send_from_fifo_shared(fd);
+
 	if( session[fd]->wdata_size == 0 )
 		return 0; // nothing to send
 
+#if defined(SOCKET_IOURING)
+	socket_iovec iov;
+
+	sIovec(iov, session[fd]->wdata, session[fd]->wdata_size);
+	len = socket_uring_send(fd, &iov, 1);
+#else
+#ifdef SOCKET_EPOLL
+	if( session[fd]->io != nullptr ){
+		socket_iovec iov;
+
+		sIovec(iov, session[fd]->wdata, session[fd]->wdata_size);
+		len = socket_io_send(fd, &iov, 1);
+	}else
+#endif
 	len = sSend(fd, (const char *) session[fd]->wdata, (int)session[fd]->wdata_size, MSG_NOSIGNAL);
+#endif
 
 	if( len == SOCKET_ERROR )
 	{//An exception has occured
@@ -479,6 +1882,13 @@ int connect_client(int listen_fd)
 		ShowError("connect_client: accept failed (%s)!\n", error_msg());
 		return -1;
 	}
+
+	return connect_client_setup(fd, &client_address);
+}
+
+/// Creates the session of an accepted connection.
+static int connect_client_setup(int fd, struct sockaddr_in* client_address)
+{
 	if( fd == 0 )
 	{// reserved
 		ShowError("connect_client: Socket #0 is reserved - Please report this!!!\n");
@@ -496,31 +1906,43 @@ int connect_client(int listen_fd)
 	set_nonblocking(fd, 1);
 
 #ifndef MINICORE
-	if( ip_rules && !connect_check(ntohl(client_address.sin_addr.s_addr)) ) {
+	if( ip_rules && !connect_check(ntohl(client_address->sin_addr.s_addr)) ) {
 		do_close(fd);
 		return -1;
 	}
 #endif
 
-#ifndef SOCKET_EPOLL
+#if defined(SOCKET_IOURING)
+	// io_uring based Event Dispatcher, the socket is attached after its session was created
+#elif !defined(SOCKET_EPOLL)
 	// Select Based Event Dispatcher
 	sFD_SET(fd,&readfds);
 #else
 	// Epoll based Event Dispatcher
-	epevent.data.fd = fd;
-	epevent.events = EPOLLIN;
-
-	if( epoll_ctl( epfd, EPOLL_CTL_ADD, fd, &epevent ) == SOCKET_ERROR ){
-		ShowError( "connect_client: Failed to add to epoll event dispatcher for new socket #%d: %s\n", fd, error_msg() );
-		sClose( fd );
-		return -1;
+	if( socket_io_threads == 0 ){
+		epevent.data.fd = fd;
+		epevent.events = EPOLLIN;
+
+		if( epoll_ctl( epfd, EPOLL_CTL_ADD, fd, &epevent ) == SOCKET_ERROR ){
+			ShowError( "connect_client: Failed to add to epoll event dispatcher for new socket #%d: %s\n", fd, error_msg() );
+			sClose( fd );
+			return -1;
+		}
 	}
 #endif
 
 	if( fd_max <= fd ) fd_max = fd + 1;
 
 	create_session(fd, recv_to_fifo, send_from_fifo, default_func_parse);
-	session[fd]->client_addr = ntohl(client_address.sin_addr.s_addr);
+	session[fd]->client_addr = ntohl(client_address->sin_addr.s_addr);
+
+#ifdef SOCKET_EPOLL
+	if( socket_io_threads > 0 )
+		socket_io_attach(fd);
+#endif
+#ifdef SOCKET_IOURING
+	socket_uring_attach(fd);
+#endif
 
 	return fd;
 }
@@ -569,7 +1991,9 @@ int make_listen_bind(uint32 ip, uint16 port)
 		exit(EXIT_FAILURE);
 	}
 
-#ifndef SOCKET_EPOLL
+#if defined(SOCKET_IOURING)
+	// io_uring based Event Dispatcher, the accept is queued after its session was created
+#elif !defined(SOCKET_EPOLL)
 	// Select Based Event Dispatcher
 	sFD_SET(fd, &readfds);
 #else
@@ -591,6 +2015,10 @@ int make_listen_bind(uint32 ip, uint16 port)
 	session[fd]->rdata_tick = 0; // disable timeouts on this socket
 	session[fd]->wdata_tick = 0;
 
+#ifdef SOCKET_IOURING
+	socket_uring_listen(fd);
+#endif
+
 	return fd;
 }
 
@@ -696,18 +2124,22 @@ int make_connection(uint32 ip, uint16 port, bool silent,int timeout) {
 	set_nonblocking(fd, 1);
 #endif
 
-#ifndef SOCKET_EPOLL
+#if defined(SOCKET_IOURING)
+	// io_uring based Event Dispatcher, the socket is attached after its session was created
+#elif !defined(SOCKET_EPOLL)
 	// Select Based Event Dispatcher
 	sFD_SET(fd,&readfds);
 #else
 	// Epoll based Event Dispatcher
-	epevent.data.fd = fd;
-	epevent.events = EPOLLIN;
-
-	if( epoll_ctl( epfd, EPOLL_CTL_ADD, fd, &epevent ) == SOCKET_ERROR ){
-		ShowError( "make_connection: failed to add socket #%d to epoll event dispatcher: %s\n", fd, error_msg() );
-		sClose(fd);
-		return -1;
+	if( socket_io_threads == 0 ){
+		epevent.data.fd = fd;
+		epevent.events = EPOLLIN;
+
+		if( epoll_ctl( epfd, EPOLL_CTL_ADD, fd, &epevent ) == SOCKET_ERROR ){
+			ShowError( "make_connection: failed to add socket #%d to epoll event dispatcher: %s\n", fd, error_msg() );
+			sClose(fd);
+			return -1;
+		}
 	}
 #endif
 
@@ -716,6 +2148,14 @@ int make_connection(uint32 ip, uint16 port, bool silent,int timeout) {
 	create_session(fd, recv_to_fifo, send_from_fifo, default_func_parse);
 	session[fd]->client_addr = ntohl(remote_address.sin_addr.s_addr);
 
+#ifdef SOCKET_EPOLL
+	if( socket_io_threads > 0 )
+		socket_io_attach(fd);
+#endif
+#ifdef SOCKET_IOURING
+	socket_uring_attach(fd);
+#endif
+
 	return fd;
 }
 
@@ -740,10 +2180,12 @@ static void delete_session(int fd)
 	{
 #ifdef SHOW_SERVER_STATS
 		socket_data_qi -= session[fd]->rdata_size - session[fd]->rdata_pos;
-		socket_data_qo -= session[fd]->wdata_size;
+		socket_data_qo -= session[fd]->wdata_size + session[fd]->wshared_size;
 #endif
+		session_clear_shared(session[fd]);
 		aFree(session[fd]->rdata);
 		aFree(session[fd]->wdata);
+		aFree(session[fd]->wshared);
 		aFree(session[fd]->session_data);
 		aFree(session[fd]);
 		session[fd] = NULL;
@@ -858,7 +2300,7 @@ int WFIFOSET(int fd, size_t len)
 			return 0;
 		}
 
-		if( s->wdata_size+len > WFIFO_MAX ) {// reached maximum write fifo size
+		if( s->wdata_size+s->wshared_size+len > WFIFO_MAX ) {// reached maximum write fifo size
 			ShowError("WFIFOSET: Maximum write buffer size for client connection %d exceeded, most likely caused by packet 0x%04x (len=%" PRIuPTR ", ip=%lu.%lu.%lu.%lu).\n", fd, WFIFOW(fd,0), len, CONVIP(s->client_addr));
 			set_eof(fd);
 			return 0;
@@ -887,9 +2329,80 @@ int WFIFOSET(int fd, size_t len)
 	return 0;
 }
 
+/// Creates a shared packet with a copy of the given data and a single reference,
+/// which is owned by the caller.
+struct socket_shared_packet* socket_shared_packet_create(const void* buf, size_t len)
+{
+	struct socket_shared_packet* packet = (struct socket_shared_packet*)aMalloc(sizeof(struct socket_shared_packet) + len);
+
+	packet->refcount = 1;
+	packet->len = len;
+	packet->data = (uint8*)(packet + 1);
+	memcpy(packet->data, buf, len);
+
+	return packet;
+}
+
+/// Drops a reference of the shared packet and frees it, once it is not referenced anymore.
+void socket_shared_packet_release(struct socket_shared_packet* packet)
+{
+	if( packet == NULL )
+		return;
+
+	if( --packet->refcount == 0 )
+		aFree(packet);
+}
+
+/// Queues a shared packet for sending, without copying it into the write fifo.
+/// Small packets and inter-server connections fall back to the write fifo.
+int WFIFOSHARE(int fd, struct socket_shared_packet* packet)
+{
+	struct socket_data* s = session[fd];
+
+	if( !session_isValid(fd) || s->wdata == NULL || packet == NULL )
+		return 0;
+
+	if( s->flag.server || packet->len < WFIFO_SHARED_MIN ){
+		WFIFOHEAD(fd, packet->len);
+		memcpy(WFIFOP(fd, 0), packet->data, packet->len);
+		return WFIFOSET(fd, packet->len);
+	}
+
+	if( packet->len > socket_max_client_packet ) {// see declaration of socket_max_client_packet for details
+		ShowError("WFIFOSHARE: Dropped too large client packet 0x%04x (length=%" PRIuPTR ", max=%" PRIuPTR ").\n", RBUFW(packet->data, 0), packet->len, socket_max_client_packet);
+		return 0;
+	}
+
+	if( s->wdata_size+s->wshared_size+packet->len > WFIFO_MAX ) {// reached maximum write fifo size
+		ShowError("WFIFOSHARE: Maximum write buffer size for client connection %d exceeded, most likely caused by packet 0x%04x (len=%" PRIuPTR ", ip=%lu.%lu.%lu.%lu).\n", fd, RBUFW(packet->data, 0), packet->len, CONVIP(s->client_addr));
+		set_eof(fd);
+		return 0;
+	}
+
+	if( s->wshared_count == s->max_wshared ){
+		s->max_wshared = s->max_wshared ? 2 * s->max_wshared : 8;
+		RECREATE(s->wshared, struct socket_shared_entry, s->max_wshared);
+	}
+
+	s->wshared[s->wshared_count].offset = s->wdata_size;
+	s->wshared[s->wshared_count].packet = packet;
+	s->wshared_count++;
+	s->wshared_size += packet->len;
+	packet->refcount++;
+#ifdef SHOW_SERVER_STATS
+	socket_data_qo += packet->len;
+#endif
+
+#ifdef SEND_SHORTLIST
+	send_shortlist_add_fd(fd);
+#endif
+
+	return 0;
+}
+
 int do_sockets(t_tick next)
 {
-#ifndef SOCKET_EPOLL
+#if !defined(SOCKET_EPOLL) && !defined(SOCKET_IOURING)
 	fd_set rfd;
 	struct timeval timeout;
 #endif
@@ -905,12 +2418,25 @@ int do_sockets(t_tick next)
 		if(!session[i])
 			continue;
 
-		if(session[i]->wdata_size)
+		if(session[i]->wdata_size || session[i]->wshared_count)
 			session[i]->func_send(i);
 	}
 #endif
 
-#ifndef SOCKET_EPOLL
+#ifdef SOCKET_EPOLL
+	// Hand the sends over to the I/O workers before waiting
+	socket_io_wakeup();
+#endif
+
+#if defined(SOCKET_IOURING)
+	// io_uring based Event Dispatcher
+
+	// submit all queued sends and receives and wait for their completions in a single call
+	ret = socket_uring_wait( next );
+
+	if( ret == SOCKET_ERROR )
+		return 0; // interrupted by a signal, just loop and try again
+#elif !defined(SOCKET_EPOLL)
 	// Select based Event Dispatcher
 
 	// can timeout until the next tick
@@ -954,13 +2480,30 @@ int do_sockets(t_tick next)
 		if( session[fd] )
 			session[fd]->func_recv(fd);
 	}
+#elif defined(SOCKET_IOURING)
+	// io_uring based completions
+	socket_uring_dispatch();
 #elif defined(SOCKET_EPOLL)
 	// epoll based selection
 
 	for( i = 0; i < ret; i++ ){
 		struct epoll_event *it = &epevents[i];
 		int fd = it->data.fd;
-		struct socket_data *sock = session[fd];
+		struct socket_data *sock;
+
+		if( fd == socket_io_wakefd ){
+			// Woken up by an I/O worker, the received data is collected before parsing
+			uint64 value;
+
+			// Drain the counter before clearing the flag, so a worker that notifies in between writes it again
+			if( read( fd, &value, sizeof( value ) ) < 0 ){
+				// the counter was reset already
+			}
+			socket_io_notified.store( false );
+			continue;
+		}
+
+		sock = session[fd];
 
 		if( !sock ){
 			continue;
@@ -995,7 +2538,7 @@ int do_sockets(t_tick next)
 		if(!session[i])
 			continue;
 
-		if(session[i]->wdata_size)
+		if(session[i]->wdata_size || session[i]->wshared_count)
 			session[i]->func_send(i);
 
 		if(session[i]->flag.eof) //func_send can't free a session, this is safe.
@@ -1021,6 +2564,17 @@ int do_sockets(t_tick next)
 			}
 		}
 
+#ifdef SOCKET_EPOLL
+		// collect the data received by the I/O worker
+		if( session[i]->io != nullptr )
+			session[i]->func_recv(i);
+#endif
+#ifdef SOCKET_IOURING
+		// collect the data received by the kernel
+		if( socket_uring_conns[i].state == SOCKET_URING_ACTIVE )
+			session[i]->func_recv(i);
+#endif
+
 		session[i]->func_parse(i);
 
 		if(!session[i])
@@ -1051,6 +2605,10 @@ int do_sockets(t_tick next)
 	}
 #endif
 
+#ifdef SOCKET_EPOLL
+	socket_io_wakeup();
+#endif
+
 	return 0;
 }
 
@@ -1346,6 +2904,16 @@ int socket_config_read(const char* cfgName)
 		else if (!strcmpi(w1,"debug"))
 			access_debug = config_switch(w2);
 #ifdef SOCKET_EPOLL
+		else if( !strcmpi( w1, "io_threads" ) ){
+			socket_io_threads = atoi(w2);
+
+			if( socket_io_threads < 0 ){
+				socket_io_threads = 0;
+			}else if( socket_io_threads > 64 ){
+				ShowWarning( "socket_config_read: io_threads is set too high. Defaulting to 64...\n" );
+				socket_io_threads = 64;
+			}
+		}
 		else if( !strcmpi( w1, "epoll_maxevents" ) ){
 			epoll_maxevents = atoi(w2);
 
@@ -1393,6 +2961,13 @@ void socket_final(void)
 		if(session[i])
 			do_close(i);
 
+#ifdef SOCKET_EPOLL
+	socket_io_final();
+#endif
+#ifdef SOCKET_IOURING
+	socket_uring_final();
+#endif
+
 	// session[0]
 	aFree(session[0]->rdata);
 	aFree(session[0]->wdata);
@@ -1426,7 +3001,23 @@ void do_close(int fd)
 
 	flush_fifo(fd); // Try to send what's left (although it might not succeed since it's a nonblocking socket)
 
-#ifndef SOCKET_EPOLL
+#ifdef SOCKET_EPOLL
+	if( session[fd] != nullptr && session[fd]->io != nullptr ){
+		// The I/O worker sends what's left and closes the socket
+		socket_io_detach(fd);
+		delete_session(fd);
+		return;
+	}
+#endif
+
+#if defined(SOCKET_IOURING)
+	// io_uring based Event Dispatcher
+	if( socket_uring_close(fd) ){
+		// The socket is closed, once the kernel is done with it
+		if (session[fd]) delete_session(fd);
+		return;
+	}
+#elif !defined(SOCKET_EPOLL)
 	// Select based Event Dispatcher
 	sFD_CLR(fd, &readfds);// this needs to be done before closing the socket
 #else
@@ -1580,7 +3171,10 @@ void socket_init(void)
 	// Get initial local ips
 	naddr_ = socket_getips(addr_,16);
 
-#ifndef SOCKET_EPOLL
+#if defined(SOCKET_IOURING)
+	// io_uring based Event Dispatcher
+	socket_uring_init();
+#elif !defined(SOCKET_EPOLL)
 	// Select based Event Dispatcher:
 	sFD_ZERO(&readfds);
 	ShowInfo( "Server uses '" CL_WHITE "select" CL_RESET "' as event dispatcher\n" );
@@ -1605,6 +3199,10 @@ void socket_init(void)
 
 	socket_config_read(SOCKET_CONF_FILENAME);
 
+#ifdef SOCKET_EPOLL
+	socket_io_init();
+#endif
+
 	// initialise last send-receive tick
 	last_tick = time(NULL);
 
@@ -1723,7 +3321,7 @@ void send_shortlist_do_sends()
 		if( session[fd] )
 		{
 			// Send data
-			if( session[fd]->wdata_size )
+			if( session[fd]->wdata_size || session[fd]->wshared_count )
 				session[fd]->func_send(fd);
 
 			// If it's been marked as eof, call the parse func on it so that
@@ -1733,7 +3331,7 @@ void send_shortlist_do_sends()
 
 			// If the session still exists, is not eof and has things left to
 			// be sent from it we'll re-add it to the shortlist.
-			if( session_isActive(fd) && session[fd]->wdata_size )
+			if( session_isActive(fd) && ( session[fd]->wdata_size || session[fd]->wshared_count ) )
 				send_shortlist_add_fd(fd);
 		}
 	}
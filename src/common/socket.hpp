@@ -83,6 +83,22 @@ typedef int (*RecvFunc)(int fd);
 typedef int (*SendFunc)(int fd);
 typedef int (*ParseFunc)(int fd);
 
+/// Reference counted packet buffer, which can be queued on multiple sessions
+/// without copying the packet data into each write fifo.
+struct socket_shared_packet {
+	uint32 refcount;
+	size_t len;
+	uint8* data;
+};
+
+/// Shared packet that was queued on a session after offset bytes of its write fifo.
+struct socket_shared_entry {
+	size_t offset;
+	struct socket_shared_packet* packet;
+};
+
+struct s_socket_io;
+
 struct socket_data
 {
 	struct {
@@ -100,6 +116,13 @@ struct socket_data
 	time_t rdata_tick; // time of last recv (for detecting timeouts); zero when timeout is disabled
 	time_t wdata_tick; // time of last send (for detecting timeouts);
 
+	struct socket_shared_entry* wshared; // shared packets queued in between the write fifo data
+	size_t wshared_count, max_wshared;
+	size_t wshared_pos; // amount of bytes of the first shared packet, which were already sent
+	size_t wshared_size; // amount of bytes of all queued shared packets, which were not sent yet
+
+	struct s_socket_io* io; // connection state of the I/O worker threads, if they are enabled
+
 	RecvFunc func_recv;
 	SendFunc func_send;
 	ParseFunc func_parse;
@@ -130,6 +153,7 @@ int make_connection(uint32 ip, uint16 port, bool silent, int timeout);
 int realloc_fifo(int fd, unsigned int rfifo_size, unsigned int wfifo_size);
 int realloc_writefifo(int fd, size_t addition);
 int WFIFOSET(int fd, size_t len);
+int WFIFOSHARE(int fd, struct socket_shared_packet* packet);
 int RFIFOSKIP(int fd, size_t len);
 
 int do_sockets(t_tick next);
@@ -137,6 +161,9 @@ void do_close(int fd);
 void socket_init(void);
 void socket_final(void);
 
+struct socket_shared_packet* socket_shared_packet_create(const void* buf, size_t len);
+void socket_shared_packet_release(struct socket_shared_packet* packet);
+
 extern void flush_fifo(int fd);
 extern void flush_fifos(void);
 extern void set_nonblocking(int fd, unsigned long yes);
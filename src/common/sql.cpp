@@ -7,6 +7,13 @@
 #include "winapi.hpp"
 #endif
 
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
 #include <mysql.h>
 #include <stdlib.h>// strtoul
 
@@ -996,6 +1003,345 @@ void SqlStmt_Free(SqlStmt* self)
 
 
 
+///////////////////////////////////////////////////////////////////////////////
+// Asynchronous Queries
+///////////////////////////////////////////////////////////////////////////////
+
+
+
+/// Interval in milliseconds in which the main thread collects completed jobs.
+#define SQL_ASYNC_POLL_INTERVAL 10
+
+/// Asynchronous job
+struct s_sql_async_job
+{
+	std::vector<std::string> queries;
+	SqlAsyncCallback callback;
+	s_sql_async_result result;
+	// first failed query, reported by the main thread
+	unsigned int error_code;
+	std::string error_message;
+	std::string error_query;
+};
+
+/// Connection of the pool and its thread
+struct s_sql_async_worker
+{
+	Sql* sql;
+	std::thread thread;
+	std::condition_variable cond; // wakes up the thread
+	std::deque<s_sql_async_job*> jobs;
+	int ping_interval; // in milliseconds, replaces the keepalive timer of the connection
+};
+
+static Sql* sql_async_fallback = NULL; // executes the jobs without a pool
+static std::vector<s_sql_async_worker*> sql_async_workers;
+static std::mutex sql_async_mutex; // protects the job queues and sql_async_done
+static std::condition_variable sql_async_done_cond; // wakes up the main thread
+static std::deque<s_sql_async_job*> sql_async_done; // executed jobs
+static bool sql_async_stopping = false;
+// main thread only
+static std::unordered_map<uint32, uint32> sql_async_pending; // key -> number of queued jobs
+static size_t sql_async_pending_total = 0;
+static int sql_async_timer = INVALID_TIMER;
+
+
+
+/// Worker: executes the queries of the job.
+/// Only the MySQL API is used, because the memory manager and the console output are not thread safe.
+///
+/// @private
+static void SqlAsync_P_Execute(Sql* self, s_sql_async_job* job)
+{
+	for( const std::string& query : job->queries )
+	{
+		if( mysql_real_query(&self->handle, query.c_str(), (unsigned long)query.length()) == 0 )
+		{
+			MYSQL_RES* result = mysql_store_result(&self->handle);
+
+			if( result != NULL )
+				mysql_free_result(result);
+			if( mysql_errno(&self->handle) == 0 )
+			{
+				job->result.affected_rows += (uint64)mysql_affected_rows(&self->handle);
+				continue;
+			}
+		}
+
+		if( job->result.failed++ == 0 )
+		{
+			job->error_code = mysql_errno(&self->handle);
+			job->error_message = mysql_error(&self->handle);
+			job->error_query = query;
+		}
+	}
+}
+
+
+
+/// Worker: executes the jobs of the connection and keeps it alive.
+///
+/// @private
+static void SqlAsync_P_Worker(s_sql_async_worker* worker)
+{
+	// the client library keeps per thread state
+	mysql_thread_init();
+
+	std::unique_lock<std::mutex> lock(sql_async_mutex);
+
+	for( ;; )
+	{
+		if( worker->jobs.empty() )
+		{
+			if( sql_async_stopping )
+				break;
+			if( worker->cond.wait_for(lock, std::chrono::milliseconds(worker->ping_interval)) == std::cv_status::timeout && worker->jobs.empty() && !sql_async_stopping )
+			{
+				lock.unlock();
+				mysql_ping(&worker->sql->handle);
+				lock.lock();
+			}
+			continue;
+		}
+
+		s_sql_async_job* job = worker->jobs.front();
+		worker->jobs.pop_front();
+		lock.unlock();
+
+		SqlAsync_P_Execute(worker->sql, job);
+
+		lock.lock();
+		sql_async_done.push_back(job);
+		sql_async_done_cond.notify_one();
+	}
+
+	lock.unlock();
+	mysql_thread_end();
+}
+
+
+
+/// Reports the errors of an executed job and calls its callback.
+///
+/// @private
+static void SqlAsync_P_Finish(s_sql_async_job* job)
+{
+	auto pending = sql_async_pending.find(job->result.key);
+
+	if( pending != sql_async_pending.end() && --pending->second == 0 )
+		sql_async_pending.erase(pending);
+	sql_async_pending_total--;
+
+	if( job->result.failed > 0 )
+	{
+		ShowSQL("DB error - %s\n", job->error_message.c_str());
+		ShowDebug("at asynchronous job %u - %s\n", job->result.key, job->error_query.c_str());
+		ra_mysql_error_handler(job->error_code);
+	}
+
+	if( job->callback )
+		job->callback(job->result);
+	delete job;
+}
+
+
+
+/// Finishes all jobs that were executed by now.
+///
+/// @private
+static void SqlAsync_P_Complete(void)
+{
+	std::deque<s_sql_async_job*> done;
+
+	{
+		std::lock_guard<std::mutex> lock(sql_async_mutex);
+
+		done.swap(sql_async_done);
+	}
+
+	for( s_sql_async_job* job : done )
+		SqlAsync_P_Finish(job);
+}
+
+
+
+/// Waits until at least one job was executed and finishes it.
+///
+/// @private
+static void SqlAsync_P_Wait(void)
+{
+	{
+		std::unique_lock<std::mutex> lock(sql_async_mutex);
+
+		sql_async_done_cond.wait(lock, []() { return !sql_async_done.empty(); });
+	}
+
+	SqlAsync_P_Complete();
+}
+
+
+
+/// Collects the completed jobs, as long as there are jobs queued.
+///
+/// @private
+static TIMER_FUNC(SqlAsync_P_Timer){
+	sql_async_timer = INVALID_TIMER;
+	SqlAsync_P_Complete();
+
+	// a callback might have queued a new job already
+	if( sql_async_pending_total > 0 && sql_async_timer == INVALID_TIMER )
+		sql_async_timer = add_timer(gettick() + SQL_ASYNC_POLL_INTERVAL, SqlAsync_P_Timer, 0, 0);
+	return 0;
+}
+
+
+
+/// Opens the connections of the pool and starts their threads.
+int SqlAsync_Init(Sql* fallback, int connections, const char* user, const char* passwd, const char* host, uint16 port, const char* db, const char* encoding)
+{
+	sql_async_fallback = fallback;
+	add_timer_func_list(SqlAsync_P_Timer, "SqlAsync_P_Timer");
+
+	for( int i = 0; i < connections; i++ )
+	{
+		Sql* sql = Sql_Malloc();
+
+		if( SQL_ERROR == Sql_Connect(sql, user, passwd, host, port, db) )
+		{
+			ShowError("SqlAsync_Init: Could only open %d of %d connections.\n", i, connections);
+			Sql_Free(sql);
+			break;
+		}
+
+		if( encoding != NULL && *encoding && SQL_ERROR == Sql_SetEncoding(sql, encoding) )
+			Sql_ShowDebug(sql);
+
+		s_sql_async_worker* worker = new s_sql_async_worker();
+
+		// the thread pings the connection itself, the main thread must not use it anymore
+		worker->sql = sql;
+		worker->ping_interval = get_timer(sql->keepalive)->interval;
+		delete_timer(sql->keepalive, Sql_P_KeepaliveTimer);
+		sql->keepalive = INVALID_TIMER;
+		sql_async_workers.push_back(worker);
+	}
+
+	for( s_sql_async_worker* worker : sql_async_workers )
+		worker->thread = std::thread(SqlAsync_P_Worker, worker);
+
+	return (int)sql_async_workers.size();
+}
+
+
+
+/// Queues a job.
+void SqlAsync_Queue(uint32 key, std::vector<std::string>&& queries, SqlAsyncCallback callback)
+{
+	s_sql_async_job* job = new s_sql_async_job();
+
+	job->queries = std::move(queries);
+	job->callback = std::move(callback);
+	job->result.key = key;
+	job->result.failed = 0;
+	job->result.affected_rows = 0;
+	job->error_code = 0;
+
+	if( sql_async_workers.empty() )
+	{// execute the job right away
+		for( const std::string& query : job->queries )
+		{
+			if( SQL_ERROR == Sql_QueryStr(sql_async_fallback, query.c_str()) )
+			{
+				Sql_ShowDebug(sql_async_fallback);
+				job->result.failed++;
+			}
+			else
+				job->result.affected_rows += Sql_NumRowsAffected(sql_async_fallback);
+			Sql_FreeResult(sql_async_fallback);
+		}
+
+		if( job->callback )
+			job->callback(job->result);
+		delete job;
+		return;
+	}
+
+	// jobs with the same key always go to the same connection
+	s_sql_async_worker* worker = sql_async_workers[key % sql_async_workers.size()];
+
+	sql_async_pending[key]++;
+	sql_async_pending_total++;
+
+	{
+		std::lock_guard<std::mutex> lock(sql_async_mutex);
+
+		worker->jobs.push_back(job);
+	}
+	worker->cond.notify_one();
+
+	if( sql_async_timer == INVALID_TIMER )
+		sql_async_timer = add_timer(gettick() + SQL_ASYNC_POLL_INTERVAL, SqlAsync_P_Timer, 0, 0);
+}
+
+
+
+/// Returns whether jobs with the given key are still queued or executed.
+bool SqlAsync_Pending(uint32 key)
+{
+	return sql_async_pending.find(key) != sql_async_pending.end();
+}
+
+
+
+/// Waits until all jobs with the given key are completed.
+void SqlAsync_Flush(uint32 key)
+{
+	while( SqlAsync_Pending(key) )
+		SqlAsync_P_Wait();
+}
+
+
+
+/// Waits until all jobs are completed.
+void SqlAsync_FlushAll(void)
+{
+	while( sql_async_pending_total > 0 )
+		SqlAsync_P_Wait();
+}
+
+
+
+/// Completes all jobs, stops the threads and closes the connections of the pool.
+void SqlAsync_Final(void)
+{
+	SqlAsync_FlushAll();
+
+	{
+		std::lock_guard<std::mutex> lock(sql_async_mutex);
+
+		sql_async_stopping = true;
+	}
+
+	for( s_sql_async_worker* worker : sql_async_workers )
+	{
+		worker->cond.notify_one();
+		worker->thread.join();
+		Sql_Free(worker->sql);
+		delete worker;
+	}
+	sql_async_workers.clear();
+	sql_async_stopping = false;
+
+	if( sql_async_timer != INVALID_TIMER )
+	{
+		delete_timer(sql_async_timer, SqlAsync_P_Timer);
+		sql_async_timer = INVALID_TIMER;
+	}
+	sql_async_fallback = NULL;
+}
+
+
+
 /// Receives MySQL error codes during runtime (not on first-time-connects).
 void ra_mysql_error_handler(unsigned int ecode) {
 	switch( ecode ) {
@@ -6,6 +6,10 @@
 
 #include <stdarg.h>// va_list
 
+#include <functional>
+#include <string>
+#include <vector>
+
 #include "cbasetypes.hpp"
 
 // Return codes
@@ -350,6 +354,67 @@ void SqlStmt_ShowDebug_(SqlStmt* self, const char* debug_file, const unsigned lo
 /// Frees a SqlStmt returned by SqlStmt_Malloc.
 void SqlStmt_Free(SqlStmt* self);
 
+
+
+///////////////////////////////////////////////////////////////////////////////
+// Asynchronous Queries
+///////////////////////////////////////////////////////////////////////////////
+// Queries that do not need to return data can be queued on a pool of 
+// additional connections, each with its own thread.
+// A job is a list of complete queries, that are executed one after another.
+// Jobs with the same key are always executed in the order they were queued,
+// jobs with different keys can run at the same time.
+// The callback of a job is called on the main thread after it was executed.
+//
+// Without any connections in the pool the jobs are executed directly on the 
+// connection that was passed to SqlAsync_Init.
+
+
+
+/// Result of an asynchronous job.
+struct s_sql_async_result {
+	uint32 key;
+	size_t failed; // number of queries that failed
+	uint64 affected_rows; // sum of the affected rows of all queries
+};
+
+typedef std::function<void( const s_sql_async_result& result )> SqlAsyncCallback;
+
+
+
+/// Opens the connections of the pool and starts their threads.
+/// The connections are established with the same parameters as Sql_Connect.
+///
+/// @return Number of connections in the pool
+int SqlAsync_Init(Sql* fallback, int connections, const char* user, const char* passwd, const char* host, uint16 port, const char* db, const char* encoding);
+
+
+
+/// Queues a job.
+/// The callback is optional.
+void SqlAsync_Queue(uint32 key, std::vector<std::string>&& queries, SqlAsyncCallback callback);
+
+
+
+/// Returns whether jobs with the given key are still queued or executed.
+bool SqlAsync_Pending(uint32 key);
+
+
+
+/// Waits until all jobs with the given key are completed and calls their callbacks.
+/// Has to be called before data that was written by these jobs is read again.
+void SqlAsync_Flush(uint32 key);
+
+
+
+/// Waits until all jobs are completed and calls their callbacks.
+void SqlAsync_FlushAll(void);
+
+
+
+/// Completes all jobs, stops the threads and closes the connections of the pool.
+void SqlAsync_Final(void);
+
 void Sql_Init(void);
 
 #endif /* SQL_HPP */
@@ -18,6 +18,11 @@
 #include "showmsg.hpp"
 #include "utils.hpp"
 
+#ifdef TIMER_TRACE
+#include "core.hpp" // SERVER_NAME
+#include "strlib.hpp" // safesnprintf()
+#endif
+
 // If the server can't handle processing thousands of monsters
 // or many connected clients, please increase TIMER_MIN_INTERVAL.
 // The official interval of 20ms is however strongly recommended,
@@ -36,6 +41,7 @@ static int free_timer_list_max = 0;
 static int free_timer_list_pos = 0;
 
 
+#ifndef TIMER_WHEEL
 /// Comparator for the timer heap. (minimum tick at top)
 /// Returns negative if tid1's tick is smaller, positive if tid2's tick is smaller, 0 if equal.
 ///
@@ -46,6 +52,39 @@ static int free_timer_list_pos = 0;
 
 // timer heap (binary heap of tid's)
 static BHEAP_VAR(int, timer_heap);
+#else
+// The timer wheel consists of a root level with one slot per millisecond
+// and TIMER_WHEEL_LEVELS upper levels, where every slot of a level covers
+// the whole range of the level below it. Timers are cascaded down a level
+// whenever the root level wraps around.
+#define TIMER_WHEEL_ROOT_BITS 8
+#define TIMER_WHEEL_LEVEL_BITS 6
+#define TIMER_WHEEL_LEVELS 4
+#define TIMER_WHEEL_ROOT_SIZE (1 << TIMER_WHEEL_ROOT_BITS)
+#define TIMER_WHEEL_LEVEL_SIZE (1 << TIMER_WHEEL_LEVEL_BITS)
+#define TIMER_WHEEL_SLOTS (TIMER_WHEEL_ROOT_SIZE + TIMER_WHEEL_LEVELS * TIMER_WHEEL_LEVEL_SIZE)
+
+/// Links of a timer inside its wheel slot
+struct s_timer_link {
+	int prev, next; // neighbours in the slot, INVALID_TIMER at the ends
+	int slot; // slot of the timer, -1 if it is not queued
+};
+
+// timer links (array, parallel to timer_data)
+static struct s_timer_link* timer_link = NULL;
+
+// first timer of every slot
+static int timer_wheel[TIMER_WHEEL_SLOTS];
+// next tick the wheel will process
+static t_tick timer_wheel_tick = 0;
+// number of queued timers
+static int timer_wheel_count = 0;
+#endif
+
+#ifdef TIMER_TRACE
+// Records every scheduling operation, so that it can be replayed by the timer benchmark
+static FILE* timer_trace_fp = NULL;
+#endif
 
 
 // server startup time
@@ -195,16 +234,90 @@ t_tick gettick(void)
 #endif
 //////////////////////////////////////////////////////////////////////////
 
+#ifndef TIMER_WHEEL
 /*======================================
  * 	CORE : Timer Heap
  *--------------------------------------*/
 
 /// Adds a timer to the timer_heap
-static void push_timer_heap(int tid)
+static void push_timer(int tid)
 {
 	BHEAP_ENSURE(timer_heap, 1, 256);
 	BHEAP_PUSH(timer_heap, tid, DIFFTICK_MINTOPCMP, SWAP);
 }
+#else
+/*======================================
+ * 	CORE : Timer Wheel
+ *--------------------------------------*/
+
+/// Adds a timer to the slot of the wheel that matches its tick.
+static void push_timer(int tid)
+{
+	t_tick tick = timer_data[tid].tick;
+	t_tick idx = DIFF_TICK(tick, timer_wheel_tick);
+	int slot;
+
+	if( idx < 0 )
+		slot = (int)(timer_wheel_tick & (TIMER_WHEEL_ROOT_SIZE - 1)); // already expired, run with the next slot
+	else if( idx < TIMER_WHEEL_ROOT_SIZE )
+		slot = (int)(tick & (TIMER_WHEEL_ROOT_SIZE - 1));
+	else {
+		int level;
+		int shift = TIMER_WHEEL_ROOT_BITS;
+
+		for( level = 0; level < TIMER_WHEEL_LEVELS - 1; level++, shift += TIMER_WHEEL_LEVEL_BITS ){
+			if( idx < ((t_tick)1 << (shift + TIMER_WHEEL_LEVEL_BITS)) )
+				break;
+		}
+
+		if( level == TIMER_WHEEL_LEVELS - 1 && idx >= ((t_tick)1 << (shift + TIMER_WHEEL_LEVEL_BITS)) )
+			tick = timer_wheel_tick + ((t_tick)1 << (shift + TIMER_WHEEL_LEVEL_BITS)) - 1; // too far away, park it in the last slot and cascade it again later
+
+		slot = TIMER_WHEEL_ROOT_SIZE + level * TIMER_WHEEL_LEVEL_SIZE + (int)((tick >> shift) & (TIMER_WHEEL_LEVEL_SIZE - 1));
+	}
+
+	timer_link[tid].slot = slot;
+	timer_link[tid].prev = INVALID_TIMER;
+	timer_link[tid].next = timer_wheel[slot];
+	if( timer_wheel[slot] != INVALID_TIMER )
+		timer_link[timer_wheel[slot]].prev = tid;
+	timer_wheel[slot] = tid;
+	timer_wheel_count++;
+}
+
+/// Removes a timer from its slot of the wheel.
+static void pop_timer(int tid)
+{
+	struct s_timer_link* link = &timer_link[tid];
+
+	if( link->prev != INVALID_TIMER )
+		timer_link[link->prev].next = link->next;
+	else
+		timer_wheel[link->slot] = link->next;
+	if( link->next != INVALID_TIMER )
+		timer_link[link->next].prev = link->prev;
+
+	link->slot = -1;
+	timer_wheel_count--;
+}
+
+/// Moves all timers of a slot of an upper level to the levels below.
+/// Returns the index of the slot inside its level.
+static int cascade_timer_wheel(int level)
+{
+	int shift = TIMER_WHEEL_ROOT_BITS + level * TIMER_WHEEL_LEVEL_BITS;
+	int index = (int)((timer_wheel_tick >> shift) & (TIMER_WHEEL_LEVEL_SIZE - 1));
+	int slot = TIMER_WHEEL_ROOT_SIZE + level * TIMER_WHEEL_LEVEL_SIZE + index;
+	int tid;
+
+	while( (tid = timer_wheel[slot]) != INVALID_TIMER ){
+		pop_timer(tid);
+		push_timer(tid);
+	}
+
+	return index;
+}
+#endif
 
 /*==========================
  * 	Timer Management
@@ -234,6 +347,11 @@ static int acquire_timer(void)
 		else
 			CREATE(timer_data, struct TimerData, timer_data_max);
 		memset(timer_data + (timer_data_max - 256), 0, sizeof(struct TimerData)*256);
+#ifdef TIMER_WHEEL
+		RECREATE(timer_link, struct s_timer_link, timer_data_max);
+		for( int i = timer_data_max - 256; i < timer_data_max; i++ )
+			timer_link[i].slot = -1;
+#endif
 	}
 
 	if( tid >= timer_data_num )
@@ -242,6 +360,18 @@ static int acquire_timer(void)
 	return tid;
 }
 
+/// Returns a timer id to the list of free timers.
+static void release_timer(int tid)
+{
+	timer_data[tid].type = 0;
+	if (free_timer_list_pos >= free_timer_list_max) {
+		free_timer_list_max += 256;
+		RECREATE(free_timer_list,int,free_timer_list_max);
+		memset(free_timer_list + (free_timer_list_max - 256), 0, 256 * sizeof(int));
+	}
+	free_timer_list[free_timer_list_pos++] = tid;
+}
+
 /// Starts a new timer that is deleted once it expires (single-use).
 /// Returns the timer's id.
 int add_timer(t_tick tick, TimerFunc func, int id, intptr_t data)
@@ -255,7 +385,11 @@ int add_timer(t_tick tick, TimerFunc func, int id, intptr_t data)
 	timer_data[tid].data     = data;
 	timer_data[tid].type     = TIMER_ONCE_AUTODEL;
 	timer_data[tid].interval = 1000;
-	push_timer_heap(tid);
+	push_timer(tid);
+#ifdef TIMER_TRACE
+	if( timer_trace_fp )
+		fprintf(timer_trace_fp, "A %" PRtf " %d %" PRtf " 0\n", gettick(), tid, tick);
+#endif
 
 	return tid;
 }
@@ -279,7 +413,11 @@ int add_timer_interval(t_tick tick, TimerFunc func, int id, intptr_t data, int i
 	timer_data[tid].data     = data;
 	timer_data[tid].type     = TIMER_INTERVAL;
 	timer_data[tid].interval = interval;
-	push_timer_heap(tid);
+	push_timer(tid);
+#ifdef TIMER_TRACE
+	if( timer_trace_fp )
+		fprintf(timer_trace_fp, "A %" PRtf " %d %" PRtf " %d\n", gettick(), tid, tick, interval);
+#endif
 
 	return tid;
 }
@@ -306,6 +444,21 @@ int delete_timer(int tid, TimerFunc func)
 		return -2;
 	}
 
+#ifdef TIMER_TRACE
+	if( timer_trace_fp )
+		fprintf(timer_trace_fp, "D %" PRtf " %d\n", gettick(), tid);
+#endif
+
+#ifdef TIMER_WHEEL
+	if( timer_link[tid].slot >= 0 )
+	{// unlink it right away instead of waiting for it to expire
+		pop_timer(tid);
+		timer_data[tid].func = NULL;
+		release_timer(tid);
+		return 0;
+	}
+#endif
+
 	timer_data[tid].func = NULL;
 	timer_data[tid].type = TIMER_ONCE_AUTODEL;
 
@@ -323,11 +476,15 @@ t_tick addt_tickimer(int tid, t_tick tick)
 /// Returns the new tick value, or -1 if it fails.
 t_tick sett_tickimer(int tid, t_tick tick)
 {
+#ifndef TIMER_WHEEL
 	size_t i;
 
 	// search timer position
 	ARR_FIND(0, BHEAP_LENGTH(timer_heap), i, BHEAP_DATA(timer_heap)[i] == tid);
 	if( i == BHEAP_LENGTH(timer_heap) )
+#else
+	if( timer_link[tid].slot < 0 )
+#endif
 	{
 		ShowError("sett_tickimer: no such timer %d (%p(%s))\n", tid, timer_data[tid].func, search_timer_func_list(timer_data[tid].func));
 		return -1;
@@ -339,19 +496,70 @@ t_tick sett_tickimer(int tid, t_tick tick)
 	if( timer_data[tid].tick == tick )
 		return tick;// nothing to do, already in propper position
 
+#ifdef TIMER_TRACE
+	if( timer_trace_fp )
+		fprintf(timer_trace_fp, "S %" PRtf " %d %" PRtf "\n", gettick(), tid, tick);
+#endif
+
 	// pop and push adjusted timer
+#ifndef TIMER_WHEEL
 	BHEAP_POPINDEX(timer_heap, i, DIFFTICK_MINTOPCMP, SWAP);
 	timer_data[tid].tick = tick;
 	BHEAP_PUSH(timer_heap, tid, DIFFTICK_MINTOPCMP, SWAP);
+#else
+	pop_timer(tid);
+	timer_data[tid].tick = tick;
+	push_timer(tid);
+#endif
 	return tick;
 }
 
+/// Executes an expired timer, that was already removed from the scheduler.
+/// Afterwards it is either released or pushed again, depending on its type.
+static void exec_timer(int tid, t_tick tick)
+{
+	t_tick diff = DIFF_TICK(timer_data[tid].tick, tick);
+
+	timer_data[tid].type |= TIMER_REMOVE_HEAP;
+
+	if( timer_data[tid].func )
+	{
+		if( diff < -1000 )
+			// timer was delayed for more than 1 second, use current tick instead
+			timer_data[tid].func(tid, tick, timer_data[tid].id, timer_data[tid].data);
+		else
+			timer_data[tid].func(tid, timer_data[tid].tick, timer_data[tid].id, timer_data[tid].data);
+	}
+
+	// in the case the function didn't change anything...
+	if( timer_data[tid].type & TIMER_REMOVE_HEAP )
+	{
+		timer_data[tid].type &= ~TIMER_REMOVE_HEAP;
+
+		switch( timer_data[tid].type )
+		{
+		default:
+		case TIMER_ONCE_AUTODEL:
+			release_timer(tid);
+		break;
+		case TIMER_INTERVAL:
+			if( DIFF_TICK(timer_data[tid].tick, tick) < -1000 )
+				timer_data[tid].tick = tick + timer_data[tid].interval;
+			else
+				timer_data[tid].tick += timer_data[tid].interval;
+			push_timer(tid);
+		break;
+		}
+	}
+}
+
 /// Executes all expired timers.
 /// Returns the value of the smallest non-expired timer (or 1 second if there aren't any).
 t_tick do_timer(t_tick tick)
 {
 	t_tick diff = TIMER_MAX_INTERVAL; // return value
 
+#ifndef TIMER_WHEEL
 	// process all timers one by one
 	while( BHEAP_LENGTH(timer_heap) )
 	{
@@ -363,45 +571,45 @@ t_tick do_timer(t_tick tick)
 
 		// remove timer
 		BHEAP_POP(timer_heap, DIFFTICK_MINTOPCMP, SWAP);
-		timer_data[tid].type |= TIMER_REMOVE_HEAP;
+		exec_timer(tid, tick);
+	}
+#else
+	// process the wheel slot by slot, all timers of a root slot expire together
+	while( DIFF_TICK(timer_wheel_tick, tick) <= 0 )
+	{
+		int index = (int)(timer_wheel_tick & (TIMER_WHEEL_ROOT_SIZE - 1));
+		int tid;
 
-		if( timer_data[tid].func )
-		{
-			if( diff < -1000 )
-				// timer was delayed for more than 1 second, use current tick instead
-				timer_data[tid].func(tid, tick, timer_data[tid].id, timer_data[tid].data);
-			else
-				timer_data[tid].func(tid, timer_data[tid].tick, timer_data[tid].id, timer_data[tid].data);
+		if( timer_wheel_count == 0 )
+		{// nothing queued, skip ahead
+			timer_wheel_tick = tick + 1;
+			break;
+		}
+
+		if( index == 0 )
+		{// root level wrapped around, refill it from the upper levels
+			for( int level = 0; level < TIMER_WHEEL_LEVELS && cascade_timer_wheel(level) == 0; level++ );
 		}
 
-		// in the case the function didn't change anything...
-		if( timer_data[tid].type & TIMER_REMOVE_HEAP )
+		while( (tid = timer_wheel[index]) != INVALID_TIMER )
 		{
-			timer_data[tid].type &= ~TIMER_REMOVE_HEAP;
-
-			switch( timer_data[tid].type )
-			{
-			default:
-			case TIMER_ONCE_AUTODEL:
-				timer_data[tid].type = 0;
-				if (free_timer_list_pos >= free_timer_list_max) {
-					free_timer_list_max += 256;
-					RECREATE(free_timer_list,int,free_timer_list_max);
-					memset(free_timer_list + (free_timer_list_max - 256), 0, 256 * sizeof(int));
-				}
-				free_timer_list[free_timer_list_pos++] = tid;
-			break;
-			case TIMER_INTERVAL:
-				if( DIFF_TICK(timer_data[tid].tick, tick) < -1000 )
-					timer_data[tid].tick = tick + timer_data[tid].interval;
-				else
-					timer_data[tid].tick += timer_data[tid].interval;
-				push_timer_heap(tid);
-			break;
-			}
+			pop_timer(tid);
+			exec_timer(tid, tick);
 		}
+
+		timer_wheel_tick++;
 	}
 
+	if( timer_wheel_count > 0 )
+	{// the next timer is either in the remaining root slots or after the root level wraps around
+		int index = (int)(timer_wheel_tick & (TIMER_WHEEL_ROOT_SIZE - 1));
+		int i;
+
+		ARR_FIND(index, TIMER_WHEEL_ROOT_SIZE, i, timer_wheel[i] != INVALID_TIMER);
+		diff = DIFF_TICK(timer_wheel_tick, tick) + i - index;
+	}
+#endif
+
 	return cap_value(diff, TIMER_MIN_INTERVAL, TIMER_MAX_INTERVAL);
 }
 
@@ -515,6 +723,22 @@ void timer_init(void)
 #endif
 
 	time(&start_time);
+
+#ifdef TIMER_WHEEL
+	for( int i = 0; i < TIMER_WHEEL_SLOTS; i++ )
+		timer_wheel[i] = INVALID_TIMER;
+	timer_wheel_tick = gettick_nocache();
+#endif
+
+#ifdef TIMER_TRACE
+	{
+		char path[256];
+
+		safesnprintf(path, sizeof(path), "log/timer_trace_%s.log", SERVER_NAME);
+		if( (timer_trace_fp = fopen(path, "w")) == NULL )
+			ShowWarning("timer_init: could not open timer trace file '%s'.\n", path);
+	}
+#endif
 }
 
 void timer_final(void)
@@ -529,6 +753,16 @@ void timer_final(void)
 	}
 
 	if (timer_data) aFree(timer_data);
+#ifndef TIMER_WHEEL
 	BHEAP_CLEAR(timer_heap);
+#else
+	if (timer_link) aFree(timer_link);
+	timer_wheel_count = 0;
+#endif
 	if (free_timer_list) aFree(free_timer_list);
+
+#ifdef TIMER_TRACE
+	if (timer_trace_fp) fclose(timer_trace_fp);
+	timer_trace_fp = NULL;
+#endif
 }
@@ -5,6 +5,8 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <unordered_map>
 
 #include "../common/cbasetypes.hpp"
 #include "../common/showmsg.hpp"
@@ -24,43 +26,159 @@ static char   ipban_db_database[32] = "ragnarok";
 static char   ipban_codepage[32] = "";
 static char   ipban_table[32] = "ipbanlist";
 
+#define IPBAN_RELOAD_INTERVAL 60 // interval in seconds to reload the active bans and expire the failed attempts
+
 // globals
 static Sql* sql_handle = NULL;
 static int cleanup_timer_id = INVALID_TIMER;
+static int reload_timer_id = INVALID_TIMER;
 static bool ipban_inited = false;
 
+/// Active bans, one table per prefix length (a.*.*.*, a.b.*.*, a.b.c.*, a.b.c.d).
+/// Keys are the ip masked to that prefix, values the expiration time of the ban.
+static std::unordered_map<uint32, time_t> ipban_list[4];
+
 //early declaration
 TIMER_FUNC(ipban_cleanup);
+TIMER_FUNC(ipban_reload);
+
+/**
+ * Netmask of a ban entry.
+ * @param level: 0 for a.*.*.* up to 3 for a.b.c.d
+ * @return mask of the octets covered by the entry
+ */
+static inline uint32 ipban_mask(int level) {
+	return 0xFFFFFFFF << ( 8 * ( 3 - level ) );
+}
+
+/**
+ * Parse a `list` entry of the ipban table.
+ *  Only the forms matched by ipban_check are accepted: a.*.*.*, a.b.*.*, a.b.c.* and a.b.c.d.
+ * @param list: entry to parse
+ * @param ip: ipv4 ip of the entry, wildcards are set to 0
+ * @param level: prefix length of the entry (see ipban_mask)
+ * @return true if the entry is valid, false otherwise
+ */
+static bool ipban_parse(const char* list, uint32* ip, int* level) {
+	uint32 result = 0;
+	int concrete = 0;
+
+	for( int i = 0; i < 4; i++ ){
+		if( i > 0 && *list++ != '.' )
+			return false;
+
+		if( *list == '*' ){
+			if( i == 0 )
+				return false;// a ban on everything was never matched
+			list++;
+			continue;
+		}
+
+		if( concrete != i || !ISDIGIT(*list) )
+			return false;// digits after a wildcard
+
+		char* end;
+		unsigned long octet = strtoul(list, &end, 10);
+
+		if( octet > 255 || end - list > 3 )
+			return false;
+
+		result |= octet << ( 8 * ( 3 - i ) );
+		concrete++;
+		list = end;
+	}
+
+	if( *list != '\0' )
+		return false;
+
+	*ip = result;
+	*level = concrete - 1;
+	return true;
+}
+
+/**
+ * Add a ban to the in-memory index.
+ *  If the entry is already banned, the later expiration time is kept.
+ * @param ip: ipv4 ip of the entry
+ * @param level: prefix length of the entry (see ipban_mask)
+ * @param rtime: expiration time of the ban
+ */
+static void ipban_add(uint32 ip, int level, time_t rtime) {
+	time_t& entry = ipban_list[level][ip & ipban_mask(level)];
+
+	if( rtime > entry )
+		entry = rtime;
+}
+
+/**
+ * Replace the in-memory index with the active bans of the ipban table.
+ *  Picks up the bans that were added or lifted outside of the login-server.
+ * @return number of bans loaded
+ */
+static size_t ipban_load(void) {
+	size_t count = 0;
+
+	if( SQL_ERROR == Sql_Query(sql_handle, "SELECT `list`, UNIX_TIMESTAMP(`rtime`) FROM `%s` WHERE `rtime` > NOW()", ipban_table) )
+	{
+		Sql_ShowDebug(sql_handle);
+		return 0;// keep the current list
+	}
+
+	for( int i = 0; i < ARRAYLENGTH(ipban_list); i++ )
+		ipban_list[i].clear();
+
+	while( SQL_SUCCESS == Sql_NextRow(sql_handle) )
+	{
+		char* data;
+		uint32 ip;
+		int level;
+
+		Sql_GetData(sql_handle, 0, &data, NULL);
+
+		if( data == NULL || !ipban_parse(data, &ip, &level) )
+			continue;
+
+		char* rtime;
+
+		Sql_GetData(sql_handle, 1, &rtime, NULL);
+		ipban_add(ip, level, (time_t)strtoll(rtime, NULL, 10));
+		count++;
+	}
+
+	Sql_FreeResult(sql_handle);
+
+	return count;
+}
 
 /**
  * Check if ip is in the active bans list.
  * @param ip: ipv4 ip to check if ban
- * @return true if found or error, false if not in list
+ * @return true if found, false if not in list
  */
 bool ipban_check(uint32 ip) {
-	uint8* p = (uint8*)&ip;
-	char* data = NULL;
-	int matches;
+	time_t now;
 
 	if( !login_config.ipban )
 		return false;// ipban disabled
 
-	if( SQL_ERROR == Sql_Query(sql_handle, "SELECT count(*) FROM `%s` WHERE `rtime` > NOW() AND (`list` = '%u.*.*.*' OR `list` = '%u.%u.*.*' OR `list` = '%u.%u.%u.*' OR `list` = '%u.%u.%u.%u')",
-		ipban_table, p[3], p[3], p[2], p[3], p[2], p[1], p[3], p[2], p[1], p[0]) )
-	{
-		Sql_ShowDebug(sql_handle);
-		// close connection because we can't verify their connectivity.
-		return true;
-	}
+	now = time(NULL);
 
-	if( SQL_ERROR == Sql_NextRow(sql_handle) )
-		return true;// Shouldn't happen, but just in case...
+	for( int i = 0; i < ARRAYLENGTH(ipban_list); i++ ){
+		if( ipban_list[i].empty() )
+			continue;
 
-	Sql_GetData(sql_handle, 0, &data, NULL);
-	matches = atoi(data);
-	Sql_FreeResult(sql_handle);
+		auto it = ipban_list[i].find(ip & ipban_mask(i));
+
+		if( it == ipban_list[i].end() )
+			continue;
+
+		if( it->second > now )
+			return true;
 
-	return( matches > 0 );
+		ipban_list[i].erase(it);// expired
+	}
+
+	return false;
 }
 
 /**
@@ -83,13 +201,15 @@ void ipban_log(uint32 ip) {
 		if( SQL_ERROR == Sql_Query(sql_handle, "INSERT INTO `%s`(`list`,`btime`,`rtime`,`reason`) VALUES ('%u.%u.%u.*', NOW() , NOW() +  INTERVAL %d MINUTE ,'Password error ban')",
 			ipban_table, p[3], p[2], p[1], login_config.dynamic_pass_failure_ban_duration) )
 			Sql_ShowDebug(sql_handle);
+
+		// the ban is active even if it could not be stored
+		ipban_add(ip, 2, time(NULL) + login_config.dynamic_pass_failure_ban_duration * 60);
 	}
 }
 
 /**
  * Timered function to remove expired bans.
- *  Request all characters to update their registered ip and transmit their new ip.
- *  Performed each ip_sync_interval.
+ *  Performed each ipban_cleanup_interval.
  * @param tid: timer id
  * @param tick: tick of execution
  * @param id: unused
@@ -106,6 +226,26 @@ TIMER_FUNC(ipban_cleanup){
 	return 0;
 }
 
+/**
+ * Timered function to reload the in-memory ban list and expire the old failed attempts.
+ *  Picks up the bans added to the table outside of the login-server.
+ *  Performed each IPBAN_RELOAD_INTERVAL, regardless of ipban_cleanup_interval.
+ * @param tid: timer id
+ * @param tick: tick of execution
+ * @param id: unused
+ * @param data: unused
+ * @return 0
+ */
+TIMER_FUNC(ipban_reload){
+	if( !login_config.ipban )
+		return 0;// ipban disabled
+
+	ipban_load();
+	loginlog_expire(login_config.dynamic_pass_failure_ban_interval);
+
+	return 0;
+}
+
 /**
  * Read configuration options.
  * @param key: config keyword
@@ -218,12 +358,17 @@ void ipban_init(void) {
 	if( codepage[0] != '\0' && SQL_ERROR == Sql_SetEncoding(sql_handle, codepage) )
 		Sql_ShowDebug(sql_handle);
 
+	ShowInfo("Loaded '" CL_WHITE "%" PRIuPTR CL_RESET "' active IP bans.\n", ipban_load());
+
 	if( login_config.ipban_cleanup_interval > 0 )
 	{ // set up periodic cleanup of connection history and active bans
 		add_timer_func_list(ipban_cleanup, "ipban_cleanup");
 		cleanup_timer_id = add_timer_interval(gettick()+10, ipban_cleanup, 0, 0, login_config.ipban_cleanup_interval*1000);
 	} else // make sure it gets cleaned up on login-server start regardless of interval-based cleanups
 		ipban_cleanup(0,0,0,0);
+
+	add_timer_func_list(ipban_reload, "ipban_reload");
+	reload_timer_id = add_timer_interval(gettick()+IPBAN_RELOAD_INTERVAL*1000, ipban_reload, 0, 0, IPBAN_RELOAD_INTERVAL*1000);
 }
 
 /**
@@ -238,8 +383,13 @@ void ipban_final(void) {
 		// release data
 		delete_timer(cleanup_timer_id, ipban_cleanup);
 
+	delete_timer(reload_timer_id, ipban_reload);
+
 	ipban_cleanup(0,0,0,0); // always clean up on login-server stop
 
+	for( int i = 0; i < ARRAYLENGTH(ipban_list); i++ )
+		ipban_list[i].clear();
+
 	// close connections
 	Sql_Free(sql_handle);
 	sql_handle = NULL;
@@ -3,8 +3,11 @@
 
 #include "loginlog.hpp"
 
+#include <deque>
 #include <stdlib.h> // exit
 #include <string.h>
+#include <time.h>
+#include <unordered_map>
 
 #include "../common/cbasetypes.hpp"
 #include "../common/mmo.hpp"
@@ -13,6 +16,8 @@
 #include "../common/sql.hpp"
 #include "../common/strlib.hpp"
 
+#include "login.hpp"
+
 // global sql settings (in ipban_sql.cpp)
 static char   global_db_hostname[64] = "127.0.0.1"; // Doubled to reflect the change on commit #0f2dd7f
 static uint16 global_db_port = 3306;
@@ -32,6 +37,20 @@ static char   log_login_db[256] = "loginlog";
 static Sql* sql_handle = NULL;
 static bool enabled = false;
 
+/// Times of the recent failed login attempts (rcode 0 or 1) per ip, oldest first.
+/// Only kept when the ipban is enabled, since it is the only reader.
+static std::unordered_map<uint32, std::deque<time_t>> loginlog_failures;
+
+
+/**
+ * Drop the failed attempts of an ip that are older than the limit.
+ * @param failures: attempts of the ip
+ * @param limit: oldest time to keep
+ */
+static void loginlog_failures_trim(std::deque<time_t>& failures, time_t limit) {
+	while( !failures.empty() && failures.front() <= limit )
+		failures.pop_front();
+}
 
 /**
  * Get the number of failed login attempts by the ip in the last minutes.
@@ -40,23 +59,66 @@ static bool enabled = false;
  * @return number of failed attempts
  */
 unsigned long loginlog_failedattempts(uint32 ip, unsigned int minutes) {
-	unsigned long failures = 0;
-
 	if( !enabled )
 		return 0;
 
-	if( SQL_ERROR == Sql_Query(sql_handle, "SELECT count(*) FROM `%s` WHERE `ip` = '%s' AND (`rcode` = '0' OR `rcode` = '1') AND `time` > NOW() - INTERVAL %d MINUTE",
-		log_login_db, ip2str(ip,NULL), minutes) )// how many times failed account? in one ip.
+	auto it = loginlog_failures.find(ip);
+
+	if( it == loginlog_failures.end() )
+		return 0;
+
+	loginlog_failures_trim(it->second, time(NULL) - minutes * 60);
+
+	unsigned long failures = (unsigned long)it->second.size();
+
+	if( failures == 0 )
+		loginlog_failures.erase(it);
+
+	return failures;
+}
+
+/**
+ * Forget the failed login attempts older than the given minutes.
+ * @param minutes: intervall to keep
+ */
+void loginlog_expire(unsigned int minutes) {
+	time_t limit = time(NULL) - minutes * 60;
+
+	for( auto it = loginlog_failures.begin(); it != loginlog_failures.end(); ){
+		loginlog_failures_trim(it->second, limit);
+
+		if( it->second.empty() )
+			it = loginlog_failures.erase(it);
+		else
+			++it;
+	}
+}
+
+/**
+ * Load the failed login attempts of the last minutes from the login log.
+ *  Keeps the ipban counters across restarts of the login-server.
+ * @param minutes: intervall to load
+ */
+static void loginlog_failures_load(unsigned int minutes) {
+	if( SQL_ERROR == Sql_Query(sql_handle, "SELECT `ip`, UNIX_TIMESTAMP(`time`) FROM `%s` WHERE (`rcode` = '0' OR `rcode` = '1') AND `time` > NOW() - INTERVAL %d MINUTE ORDER BY `time`",
+		log_login_db, minutes) )
+	{
 		Sql_ShowDebug(sql_handle);
+		return;
+	}
 
-	if( SQL_SUCCESS == Sql_NextRow(sql_handle) )
+	while( SQL_SUCCESS == Sql_NextRow(sql_handle) )
 	{
-		char* data;
-		Sql_GetData(sql_handle, 0, &data, NULL);
-		failures = strtoul(data, NULL, 10);
-		Sql_FreeResult(sql_handle);
+		char* ip;
+		char* rtime;
+
+		Sql_GetData(sql_handle, 0, &ip, NULL);
+		Sql_GetData(sql_handle, 1, &rtime, NULL);
+
+		loginlog_failures[str2ip(ip)].push_back((time_t)strtoll(rtime, NULL, 10));
 	}
-	return failures;
+
+	Sql_FreeResult(sql_handle);
 }
 
 
@@ -75,6 +137,14 @@ void login_log(uint32 ip, const char* username, int rcode, const char* message)
 	if( !enabled )
 		return;
 
+	if( ( rcode == 0 || rcode == 1 ) && login_config.ipban ){
+		std::deque<time_t>& failures = loginlog_failures[ip];
+		time_t now = time(NULL);
+
+		loginlog_failures_trim(failures, now - login_config.dynamic_pass_failure_ban_interval * 60);
+		failures.push_back(now);
+	}
+
 	Sql_EscapeStringLen(sql_handle, esc_username, username, strnlen(username, NAME_LENGTH));
 	Sql_EscapeStringLen(sql_handle, esc_message, message, strnlen(message, 255));
 
@@ -198,6 +268,9 @@ bool loginlog_init(void) {
 
 	enabled = true;
 
+	if( login_config.ipban )
+		loginlog_failures_load(login_config.dynamic_pass_failure_ban_interval);
+
 	return true;
 }
 
@@ -208,6 +281,7 @@ bool loginlog_init(void) {
  * @return true success
  */
 bool loginlog_final(void) {
+	loginlog_failures.clear();
 	Sql_Free(sql_handle);
 	sql_handle = NULL;
 	return true;
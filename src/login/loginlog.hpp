@@ -16,6 +16,12 @@
  */
 unsigned long loginlog_failedattempts(uint32 ip, unsigned int minutes);
 
+/**
+ * Forget the failed login attempts older than the given minutes.
+ * @param minutes: intervall to keep
+ */
+void loginlog_expire(unsigned int minutes);
+
 /**
  * Records an event in the login log.
  * @param ip:
@@ -351,13 +351,13 @@ int battle_delay_damage(t_tick tick, int amotion, struct block_list *src, struct
 	sc = status_get_sc(target);
 
 	if (sc) {
-		if (sc->data[SC_DEVOTION] && sc->data[SC_DEVOTION]->val1)
-			d_tbl = map_id2bl(sc->data[SC_DEVOTION]->val1);
-		if (sc->data[SC_WATER_SCREEN_OPTION] && sc->data[SC_WATER_SCREEN_OPTION]->val1)
-			e_tbl = map_id2bl(sc->data[SC_WATER_SCREEN_OPTION]->val1);
+		if (sc->getSCE(SC_DEVOTION) && sc->getSCE(SC_DEVOTION)->val1)
+			d_tbl = map_id2bl(sc->getSCE(SC_DEVOTION)->val1);
+		if (sc->getSCE(SC_WATER_SCREEN_OPTION) && sc->getSCE(SC_WATER_SCREEN_OPTION)->val1)
+			e_tbl = map_id2bl(sc->getSCE(SC_WATER_SCREEN_OPTION)->val1);
 	}
 
-	if( ((d_tbl && check_distance_bl(target, d_tbl, sc->data[SC_DEVOTION]->val3)) || e_tbl) &&
+	if( ((d_tbl && check_distance_bl(target, d_tbl, sc->getSCE(SC_DEVOTION)->val3)) || e_tbl) &&
 		damage > 0 && skill_id != CR_REFLECTSHIELD
 #ifndef RENEWAL
 		&& skill_id != PA_PRESSURE
@@ -435,32 +435,32 @@ int64 battle_attr_fix(struct block_list *src, struct block_list *target, int64 d
 	if (sc && sc->count) { //increase dmg by src status
 		switch(atk_elem){
 			case ELE_FIRE:
-				if (sc->data[SC_VOLCANO])
+				if (sc->getSCE(SC_VOLCANO))
 #ifdef RENEWAL
-					ratio += sc->data[SC_VOLCANO]->val3;
+					ratio += sc->getSCE(SC_VOLCANO)->val3;
 #else
-					damage += (int64)((damage*sc->data[SC_VOLCANO]->val3) / 100);
+					damage += (int64)((damage*sc->getSCE(SC_VOLCANO)->val3) / 100);
 #endif
 				break;
 			case ELE_WIND:
-				if (sc->data[SC_VIOLENTGALE])
+				if (sc->getSCE(SC_VIOLENTGALE))
 #ifdef RENEWAL
-					ratio += sc->data[SC_VIOLENTGALE]->val3;
+					ratio += sc->getSCE(SC_VIOLENTGALE)->val3;
 #else
-					damage += (int64)((damage*sc->data[SC_VIOLENTGALE]->val3) / 100);
+					damage += (int64)((damage*sc->getSCE(SC_VIOLENTGALE)->val3) / 100);
 #endif
 				break;
 			case ELE_WATER:
-				if (sc->data[SC_DELUGE])
+				if (sc->getSCE(SC_DELUGE))
 #ifdef RENEWAL
-					ratio += sc->data[SC_DELUGE]->val3;
+					ratio += sc->getSCE(SC_DELUGE)->val3;
 #else
-					damage += (int64)((damage*sc->data[SC_DELUGE]->val3) / 100);
+					damage += (int64)((damage*sc->getSCE(SC_DELUGE)->val3) / 100);
 #endif
 				break;
 			case ELE_GHOST:
-				if (sc->data[SC_TELEKINESIS_INTENSE])
-					ratio += sc->data[SC_TELEKINESIS_INTENSE]->val3;
+				if (sc->getSCE(SC_TELEKINESIS_INTENSE))
+					ratio += sc->getSCE(SC_TELEKINESIS_INTENSE)->val3;
 				break;
 		}
 	}
@@ -489,7 +489,7 @@ int64 battle_attr_fix(struct block_list *src, struct block_list *target, int64 d
 	if (tsc && tsc->count) { //increase dmg by target status
 		switch(atk_elem) {
 			case ELE_FIRE:
-				if (tsc->data[SC_SPIDERWEB]) { //Double damage
+				if (tsc->getSCE(SC_SPIDERWEB)) { //Double damage
 #ifdef RENEWAL
 					ratio += 100;
 #else
@@ -498,11 +498,11 @@ int64 battle_attr_fix(struct block_list *src, struct block_list *target, int64 d
 					//Remove a unit group or end whole status change
 					status_change_end(target, SC_SPIDERWEB, INVALID_TIMER);
 				}
-				if (tsc->data[SC_THORNSTRAP] && battle_getcurrentskill(src) != GN_CARTCANNON)
+				if (tsc->getSCE(SC_THORNSTRAP) && battle_getcurrentskill(src) != GN_CARTCANNON)
 					status_change_end(target, SC_THORNSTRAP, INVALID_TIMER);
-				if (tsc->data[SC_CRYSTALIZE])
+				if (tsc->getSCE(SC_CRYSTALIZE))
 					status_change_end(target, SC_CRYSTALIZE, INVALID_TIMER);
-				if (tsc->data[SC_EARTH_INSIGNIA])
+				if (tsc->getSCE(SC_EARTH_INSIGNIA))
 #ifdef RENEWAL
 					ratio += 50;
 #else
@@ -510,36 +510,36 @@ int64 battle_attr_fix(struct block_list *src, struct block_list *target, int64 d
 #endif
 				break;
 			case ELE_HOLY:
-				if (tsc->data[SC_ORATIO])
+				if (tsc->getSCE(SC_ORATIO))
 #ifdef RENEWAL
-					ratio += tsc->data[SC_ORATIO]->val1 * 2;
+					ratio += tsc->getSCE(SC_ORATIO)->val1 * 2;
 #else
-					damage += (int64)(damage * (tsc->data[SC_ORATIO]->val1 * 2) / 100);
+					damage += (int64)(damage * (tsc->getSCE(SC_ORATIO)->val1 * 2) / 100);
 #endif
 				break;
 			case ELE_POISON:
-				if (tsc->data[SC_VENOMIMPRESS])
+				if (tsc->getSCE(SC_VENOMIMPRESS))
 #ifdef RENEWAL
-					ratio += tsc->data[SC_VENOMIMPRESS]->val2;
+					ratio += tsc->getSCE(SC_VENOMIMPRESS)->val2;
 #else
-					damage += (int64)(damage * tsc->data[SC_VENOMIMPRESS]->val2 / 100);
+					damage += (int64)(damage * tsc->getSCE(SC_VENOMIMPRESS)->val2 / 100);
 #endif
-				if (tsc->data[SC_CLOUD_POISON]) {
+				if (tsc->getSCE(SC_CLOUD_POISON)) {
 #ifdef RENEWAL
-					ratio += 5 * tsc->data[SC_CLOUD_POISON]->val1;
+					ratio += 5 * tsc->getSCE(SC_CLOUD_POISON)->val1;
 #else
-					damage += (int64)(damage * 5 * tsc->data[SC_CLOUD_POISON]->val1 / 100);
+					damage += (int64)(damage * 5 * tsc->getSCE(SC_CLOUD_POISON)->val1 / 100);
 #endif
 				}
 				break;
 			case ELE_WIND:
-				if (tsc->data[SC_WATER_INSIGNIA])
+				if (tsc->getSCE(SC_WATER_INSIGNIA))
 #ifdef RENEWAL
 					ratio += 50;
 #else
 					damage += (int64)(damage * 50 / 100);
 #endif
-				if (tsc->data[SC_CRYSTALIZE]) {
+				if (tsc->getSCE(SC_CRYSTALIZE)) {
 					uint16 skill_id = battle_getcurrentskill(src);
 
 					if (skill_get_type(skill_id)&BF_MAGIC)
@@ -551,7 +551,7 @@ int64 battle_attr_fix(struct block_list *src, struct block_list *target, int64 d
 				}
 				break;
 			case ELE_WATER:
-				if (tsc->data[SC_FIRE_INSIGNIA])
+				if (tsc->getSCE(SC_FIRE_INSIGNIA))
 #ifdef RENEWAL
 					ratio += 50;
 #else
@@ -559,7 +559,7 @@ int64 battle_attr_fix(struct block_list *src, struct block_list *target, int64 d
 #endif
 				break;
 			case ELE_EARTH:
-				if (tsc->data[SC_WIND_INSIGNIA])
+				if (tsc->getSCE(SC_WIND_INSIGNIA))
 #ifdef RENEWAL
 					ratio += 50;
 #else
@@ -568,15 +568,15 @@ int64 battle_attr_fix(struct block_list *src, struct block_list *target, int64 d
 				status_change_end(target, SC_MAGNETICFIELD, INVALID_TIMER); //freed if received earth dmg
 				break;
 			case ELE_NEUTRAL:
-				if (tsc->data[SC_ANTI_M_BLAST])
+				if (tsc->getSCE(SC_ANTI_M_BLAST))
 #ifdef RENEWAL
-					ratio += tsc->data[SC_ANTI_M_BLAST]->val2;
+					ratio += tsc->getSCE(SC_ANTI_M_BLAST)->val2;
 #else
-					damage += (int64)(damage * tsc->data[SC_ANTI_M_BLAST]->val2 / 100);
+					damage += (int64)(damage * tsc->getSCE(SC_ANTI_M_BLAST)->val2 / 100);
 #endif
 				break;
 			case ELE_DARK:
-				if (tsc->data[SC_SOULCURSE]) {
+				if (tsc->getSCE(SC_SOULCURSE)) {
 					if (status_get_class_(target) == CLASS_BOSS)
 #ifdef RENEWAL
 						ratio += 20;
@@ -593,7 +593,7 @@ int64 battle_attr_fix(struct block_list *src, struct block_list *target, int64 d
 				break;
 		}
 
-		if (tsc->data[SC_MAGIC_POISON])
+		if (tsc->getSCE(SC_MAGIC_POISON))
 #ifdef RENEWAL
 			ratio += 50;
 #else
@@ -743,8 +743,8 @@ int battle_calc_cardfix(int attack_type, struct block_list *src, struct block_li
 #endif
 				cardfix = cardfix * (100 - tsd->bonus.magic_def_rate) / 100;
 
-				if( tsd->sc.data[SC_MDEF_RATE] )
-					cardfix = cardfix * (100 - tsd->sc.data[SC_MDEF_RATE]->val1) / 100;
+				if( tsd->sc.getSCE(SC_MDEF_RATE) )
+					cardfix = cardfix * (100 - tsd->sc.getSCE(SC_MDEF_RATE)->val1) / 100;
 				APPLY_CARDFIX(damage, cardfix);
 			}
 			break;
@@ -959,8 +959,8 @@ int battle_calc_cardfix(int attack_type, struct block_list *src, struct block_li
 					cardfix = cardfix * (100 - tsd->bonus.near_attack_def_rate) / 100;
 				else if (!nk[NK_IGNORELONGCARD])	// BF_LONG (there's no other choice)
 					cardfix = cardfix * (100 - tsd->bonus.long_attack_def_rate) / 100;
-				if( tsd->sc.data[SC_DEF_RATE] )
-					cardfix = cardfix * (100 - tsd->sc.data[SC_DEF_RATE]->val1) / 100;
+				if( tsd->sc.getSCE(SC_DEF_RATE) )
+					cardfix = cardfix * (100 - tsd->sc.getSCE(SC_DEF_RATE)->val1) / 100;
 				APPLY_CARDFIX(damage, cardfix);
 			}
 			break;
@@ -1081,7 +1081,7 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 	int flag = d->flag;
 
 	// SC Types that must be first because they may or may not block damage
-	if ((sce = sc->data[SC_KYRIE]) && damage > 0) {
+	if ((sce = sc->getSCE(SC_KYRIE)) && damage > 0) {
 		sce->val2 -= static_cast<int>(cap_value(damage, INT_MIN, INT_MAX));
 		if (flag & BF_WEAPON || skill_id == TF_THROWSTONE) {
 			if (sce->val2 >= 0)
@@ -1093,7 +1093,7 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 			status_change_end(target, SC_KYRIE, INVALID_TIMER);
 	}
 
-	if ((sce = sc->data[SC_P_ALTER]) && damage > 0) {
+	if ((sce = sc->getSCE(SC_P_ALTER)) && damage > 0) {
 		clif_specialeffect(target, EF_GUARD, AREA);
 		sce->val3 -= static_cast<int>(cap_value(damage, INT_MIN, INT_MAX));
 		if (sce->val3 >= 0)
@@ -1104,7 +1104,7 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 			status_change_end(target, SC_P_ALTER, INVALID_TIMER);
 	}
 
-	if ((sce = sc->data[SC_TUNAPARTY]) && damage > 0) {
+	if ((sce = sc->getSCE(SC_TUNAPARTY)) && damage > 0) {
 		sce->val2 -= static_cast<int>(cap_value(damage, INT_MIN, INT_MAX));
 		if (sce->val2 >= 0)
 			damage = 0;
@@ -1114,14 +1114,14 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 			status_change_end(target, SC_TUNAPARTY, INVALID_TIMER);
 	}
 
-	if ((sce = sc->data[SC_DIMENSION1]) && damage > 0) {
+	if ((sce = sc->getSCE(SC_DIMENSION1)) && damage > 0) {
 		sce->val2 -= static_cast<int>(cap_value(damage, INT_MIN, INT_MAX));
 		if (sce->val2 <= 0)
 			status_change_end(target, SC_DIMENSION1, INVALID_TIMER);
 		return false;
 	}
 
-	if ((sce = sc->data[SC_DIMENSION2]) && damage > 0) {
+	if ((sce = sc->getSCE(SC_DIMENSION2)) && damage > 0) {
 		sce->val2 -= static_cast<int>(cap_value(damage, INT_MIN, INT_MAX));
 		if (sce->val2 <= 0)
 			status_change_end(target, SC_DIMENSION2, INVALID_TIMER);
@@ -1132,7 +1132,7 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 		return false;
 
 	// ATK_BLOCK Type
-	if ((sce = sc->data[SC_SAFETYWALL]) && (flag&(BF_SHORT | BF_MAGIC)) == BF_SHORT) {
+	if ((sce = sc->getSCE(SC_SAFETYWALL)) && (flag&(BF_SHORT | BF_MAGIC)) == BF_SHORT) {
 		std::shared_ptr<s_skill_unit_group> group = skill_id2group(sce->val3);
 
 		if (group) {
@@ -1167,24 +1167,24 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 		status_change_end(target, SC_SAFETYWALL, INVALID_TIMER);
 	}
 
-	if ((sc->data[SC_PNEUMA] && (flag&(BF_MAGIC | BF_LONG)) == BF_LONG) ||
+	if ((sc->getSCE(SC_PNEUMA) && (flag&(BF_MAGIC | BF_LONG)) == BF_LONG) ||
 #ifdef RENEWAL
-		(sc->data[SC_BASILICA_CELL]
+		(sc->getSCE(SC_BASILICA_CELL)
 #else
-		(sc->data[SC_BASILICA]
+		(sc->getSCE(SC_BASILICA)
 #endif
 		&& !status_bl_has_mode(src, MD_STATUSIMMUNE) && skill_id != SP_SOULEXPLOSION) ||
-		(sc->data[SC_ZEPHYR] && !(flag&BF_MAGIC && skill_id) && !(skill_get_inf(skill_id)&(INF_GROUND_SKILL | INF_SELF_SKILL))) ||
-		sc->data[SC__MANHOLE] ||
-		sc->data[SC_KINGS_GRACE] ||
-		sc->data[SC_GRAVITYCONTROL]
+		(sc->getSCE(SC_ZEPHYR) && !(flag&BF_MAGIC && skill_id) && !(skill_get_inf(skill_id)&(INF_GROUND_SKILL | INF_SELF_SKILL))) ||
+		sc->getSCE(SC__MANHOLE) ||
+		sc->getSCE(SC_KINGS_GRACE) ||
+		sc->getSCE(SC_GRAVITYCONTROL)
 		)
 	{
 		d->dmg_lv = ATK_BLOCK;
 		return false;
 	}
 
-	if (sc->data[SC_WHITEIMPRISON]) { // Gravitation and Pressure do damage without removing the effect
+	if (sc->getSCE(SC_WHITEIMPRISON)) { // Gravitation and Pressure do damage without removing the effect
 		if (skill_id == MG_NAPALMBEAT ||
 			skill_id == MG_SOULSTRIKE ||
 			skill_id == WL_SOULEXPANSION ||
@@ -1200,14 +1200,14 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 		}
 	}
 
-	if ((sce = sc->data[SC_WEAPONBLOCKING]) && flag&(BF_SHORT | BF_WEAPON) && rnd() % 100 < sce->val2) {
+	if ((sce = sc->getSCE(SC_WEAPONBLOCKING)) && flag&(BF_SHORT | BF_WEAPON) && rnd() % 100 < sce->val2) {
 		clif_skill_nodamage(target, src, GC_WEAPONBLOCKING, sce->val1, 1);
 		sc_start(src, target, SC_WEAPONBLOCK_ON, 100, src->id, skill_get_time2(GC_WEAPONBLOCKING, sce->val1));
 		d->dmg_lv = ATK_BLOCK;
 		return false;
 	}
 
-	if ((sce = sc->data[SC_MILLENNIUMSHIELD]) && sce->val2 > 0 && damage > 0) {
+	if ((sce = sc->getSCE(SC_MILLENNIUMSHIELD)) && sce->val2 > 0 && damage > 0) {
 		sce->val3 -= static_cast<int>(cap_value(damage, INT_MIN, INT_MAX)); // absorb damage
 		d->dmg_lv = ATK_BLOCK;
 		if (sce->val3 <= 0) { // Shield Down
@@ -1223,8 +1223,8 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 	}
 
 	// ATK_MISS Type
-	if ((sce = sc->data[SC_AUTOGUARD]) && flag&BF_WEAPON && rnd() % 100 < sce->val2 && !skill_get_inf2(skill_id, INF2_IGNOREAUTOGUARD)) {
-		status_change_entry *sce_d = sc->data[SC_DEVOTION];
+	if ((sce = sc->getSCE(SC_AUTOGUARD)) && flag&BF_WEAPON && rnd() % 100 < sce->val2 && !skill_get_inf2(skill_id, INF2_IGNOREAUTOGUARD)) {
+		status_change_entry *sce_d = sc->getSCE(SC_DEVOTION);
 		block_list *d_bl;
 		int delay;
 
@@ -1252,14 +1252,14 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 		} else {
 			clif_skill_nodamage(target, target, CR_AUTOGUARD, sce->val1, 1);
 			unit_set_walkdelay(target, gettick(), delay, 1);
-			if (sc->data[SC_SHRINK] && rnd() % 100 < 5 * sce->val1)
+			if (sc->getSCE(SC_SHRINK) && rnd() % 100 < 5 * sce->val1)
 				skill_blown(target, src, skill_get_blewcount(CR_SHRINK, 1), -1, BLOWN_NONE);
 			d->dmg_lv = ATK_MISS;
 			return false;
 		}
 	}
 
-	if (sc->data[SC_NEUTRALBARRIER] && ((flag&(BF_LONG|BF_MAGIC)) == BF_LONG
+	if (sc->getSCE(SC_NEUTRALBARRIER) && ((flag&(BF_LONG|BF_MAGIC)) == BF_LONG
 #ifndef RENEWAL
 		|| skill_id == CR_ACIDDEMONSTRATION
 #endif
@@ -1269,7 +1269,7 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 	}
 
 	// ATK_DEF Type
-	if ((sce = sc->data[SC_LIGHTNINGWALK]) && !(flag & BF_MAGIC) && flag&BF_LONG && rnd() % 100 < sce->val1) {
+	if ((sce = sc->getSCE(SC_LIGHTNINGWALK)) && !(flag & BF_MAGIC) && flag&BF_LONG && rnd() % 100 < sce->val1) {
 		const int dx[8] = { 0,-1,-1,-1,0,1,1,1 };
 		const int dy[8] = { 1,1,0,-1,-1,-1,0,1 };
 		uint8 dir = map_calc_dir(target, src->x, src->y);
@@ -1284,12 +1284,12 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 	}
 
 	// Other
-	if ((sc->data[SC_HERMODE] && flag&BF_MAGIC) ||
-		(sc->data[SC_TATAMIGAESHI] && (flag&(BF_MAGIC | BF_LONG)) == BF_LONG) ||
-		(sc->data[SC_MEIKYOUSISUI] && rnd() % 100 < 40)) // custom value
+	if ((sc->getSCE(SC_HERMODE) && flag&BF_MAGIC) ||
+		(sc->getSCE(SC_TATAMIGAESHI) && (flag&(BF_MAGIC | BF_LONG)) == BF_LONG) ||
+		(sc->getSCE(SC_MEIKYOUSISUI) && rnd() % 100 < 40)) // custom value
 		return false;
 
-	if ((sce = sc->data[SC_PARRYING]) && flag&BF_WEAPON && skill_id != WS_CARTTERMINATION && rnd() % 100 < sce->val2) {
+	if ((sce = sc->getSCE(SC_PARRYING)) && flag&BF_WEAPON && skill_id != WS_CARTTERMINATION && rnd() % 100 < sce->val2) {
 		clif_skill_nodamage(target, target, LK_PARRYING, sce->val1, 1);
 
 		if (skill_id == LK_PARRYING) {
@@ -1301,7 +1301,7 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 		return false;
 	}
 
-	if (sc->data[SC_DODGE] && (flag&BF_LONG || sc->data[SC_SPURT]) && (skill_id != NPC_EARTHQUAKE || (skill_id == NPC_EARTHQUAKE && flag & NPC_EARTHQUAKE_FLAG)) && rnd() % 100 < 20) {
+	if (sc->getSCE(SC_DODGE) && (flag&BF_LONG || sc->getSCE(SC_SPURT)) && (skill_id != NPC_EARTHQUAKE || (skill_id == NPC_EARTHQUAKE && flag & NPC_EARTHQUAKE_FLAG)) && rnd() % 100 < 20) {
 		map_session_data *sd = map_id2sd(target->id);
 
 		if (sd && pc_issit(sd))
@@ -1311,7 +1311,7 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 		return false;
 	}
 
-	if ((sce = sc->data[SC_KAUPE]) && (skill_id != NPC_EARTHQUAKE || (skill_id == NPC_EARTHQUAKE && flag & NPC_EARTHQUAKE_FLAG)) && rnd() % 100 < sce->val2) { //Kaupe blocks damage (skill or otherwise) from players, mobs, homuns, mercenaries.
+	if ((sce = sc->getSCE(SC_KAUPE)) && (skill_id != NPC_EARTHQUAKE || (skill_id == NPC_EARTHQUAKE && flag & NPC_EARTHQUAKE_FLAG)) && rnd() % 100 < sce->val2) { //Kaupe blocks damage (skill or otherwise) from players, mobs, homuns, mercenaries.
 		clif_specialeffect(target, EF_STORMKICK4, AREA);
 		//Shouldn't end until Breaker's non-weapon part connects.
 #ifndef RENEWAL
@@ -1322,12 +1322,12 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 		return false;
 	}
 
-	if (flag&BF_MAGIC && (sce = sc->data[SC_PRESTIGE]) && rnd() % 100 < sce->val2) {
+	if (flag&BF_MAGIC && (sce = sc->getSCE(SC_PRESTIGE)) && rnd() % 100 < sce->val2) {
 		clif_specialeffect(target, EF_STORMKICK4, AREA); // Still need confirm it.
 		return false;
 	}
 
-	if (((sce = sc->data[SC_UTSUSEMI]) || sc->data[SC_BUNSINJYUTSU]) && flag&BF_WEAPON && !skill_get_inf2(skill_id, INF2_IGNORECICADA)) {
+	if (((sce = sc->getSCE(SC_UTSUSEMI)) || sc->getSCE(SC_BUNSINJYUTSU)) && flag&BF_WEAPON && !skill_get_inf2(skill_id, INF2_IGNORECICADA)) {
 		skill_additional_effect(src, target, skill_id, skill_lv, flag, ATK_BLOCK, gettick());
 		if (!status_isdead(src))
 			skill_counter_additional_effect(src, target, skill_id, skill_lv, flag, gettick());
@@ -1338,7 +1338,7 @@ bool battle_status_block_damage(struct block_list *src, struct block_list *targe
 		//Both need to be consumed if they are active.
 		if (sce && --sce->val2 <= 0)
 			status_change_end(target, SC_UTSUSEMI, INVALID_TIMER);
-		if ((sce = sc->data[SC_BUNSINJYUTSU]) && --sce->val2 <= 0)
+		if ((sce = sc->getSCE(SC_BUNSINJYUTSU)) && --sce->val2 <= 0)
 			status_change_end(target, SC_BUNSINJYUTSU, INVALID_TIMER);
 		return false;
 	}
@@ -1394,10 +1394,10 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 
 	sc = status_get_sc(bl); //check target status
 
-	if( sc && sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+	if( sc && sc->getSCE(SC_INVINCIBLE) && !sc->getSCE(SC_INVINCIBLEOFF) )
 		return 1;
 
-	if (sc && sc->data[SC_MAXPAIN])
+	if (sc && sc->getSCE(SC_MAXPAIN))
 		return 0;
 
 	switch (skill_id) {
@@ -1411,7 +1411,7 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 
 	// Nothing can reduce the damage, but Safety Wall and Millennium Shield can block it completely.
 	// So can defense sphere's but what the heck is that??? [Rytech]
-	if (skill_id == SJ_NOVAEXPLOSING && !(sc && (sc->data[SC_SAFETYWALL] || sc->data[SC_MILLENNIUMSHIELD])))
+	if (skill_id == SJ_NOVAEXPLOSING && !(sc && (sc->getSCE(SC_SAFETYWALL) || sc->getSCE(SC_MILLENNIUMSHIELD))))
 		return damage;
 
 	if( sc && sc->count ) {
@@ -1420,11 +1420,11 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 
 		// Damage increasing effects
 #ifdef RENEWAL // Flat +400% damage from melee
-		if (sc->data[SC_KAITE] && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT)
+		if (sc->getSCE(SC_KAITE) && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT)
 			damage <<= 2;
 #endif
 
-		if (sc->data[SC_AETERNA] && skill_id != PF_SOULBURN) {
+		if (sc->getSCE(SC_AETERNA) && skill_id != PF_SOULBURN) {
 			if (src->type != BL_MER || !skill_id)
 				damage <<= 1; // Lex Aeterna only doubles damage of regular attacks from mercenaries
 
@@ -1435,7 +1435,7 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 		}
 
 #ifdef RENEWAL
-		if( sc->data[SC_RAID] ) {
+		if( sc->getSCE(SC_RAID) ) {
 			if (status_get_class_(bl) == CLASS_BOSS)
 				damage += damage * 15 / 100;
 			else
@@ -1444,11 +1444,11 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 #endif
 
 		if( damage ) {
-			if( sc->data[SC_DEEPSLEEP] ) {
+			if( sc->getSCE(SC_DEEPSLEEP) ) {
 				damage += damage / 2; // 1.5 times more damage while in Deep Sleep.
 				status_change_end(bl,SC_DEEPSLEEP,INVALID_TIMER);
 			}
-			if( tsd && sd && sc->data[SC_CRYSTALIZE] && flag&BF_WEAPON ) {
+			if( tsd && sd && sc->getSCE(SC_CRYSTALIZE) && flag&BF_WEAPON ) {
 				switch(tsd->status.weapon) {
 					case W_MACE:
 					case W_2HMACE:
@@ -1473,14 +1473,14 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 						break;
 				}
 			}
-			if( sc->data[SC_VOICEOFSIREN] )
+			if( sc->getSCE(SC_VOICEOFSIREN) )
 				status_change_end(bl,SC_VOICEOFSIREN,INVALID_TIMER);
 		}
 
-		if (sc->data[SC_SOUNDOFDESTRUCTION])
+		if (sc->getSCE(SC_SOUNDOFDESTRUCTION))
 			damage <<= 1;
-		if (sc->data[SC_DARKCROW] && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT) {
-			int bonus = sc->data[SC_DARKCROW]->val2;
+		if (sc->getSCE(SC_DARKCROW) && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT) {
+			int bonus = sc->getSCE(SC_DARKCROW)->val2;
 
 			if (status_get_class_(bl) == CLASS_BOSS)
 				bonus /= 2;
@@ -1491,7 +1491,7 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 		// Damage reductions
 		// Assumptio increases DEF on RE mode, otherwise gives a reduction on the final damage. [Igniz]
 #ifndef RENEWAL
-		if( sc->data[SC_ASSUMPTIO] ) {
+		if( sc->getSCE(SC_ASSUMPTIO) ) {
 			if( map_flag_vs(bl->m) )
 				damage = (int64)damage*2/3; //Receive 66% damage
 			else
@@ -1499,47 +1499,47 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 		}
 #endif
 
-		if (sc->data[SC_DEFENDER] &&
+		if (sc->getSCE(SC_DEFENDER) &&
 			skill_id != NJ_ZENYNAGE && skill_id != KO_MUCHANAGE &&
 #ifdef RENEWAL
 			((flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON) || skill_id == GN_FIRE_EXPANSION_ACID))
 #else
 			(flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON))
 #endif
-			damage -= damage * sc->data[SC_DEFENDER]->val2 / 100;
+			damage -= damage * sc->getSCE(SC_DEFENDER)->val2 / 100;
 
-		if(sc->data[SC_ADJUSTMENT] && (flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON))
+		if(sc->getSCE(SC_ADJUSTMENT) && (flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON))
 			damage -= damage * 20 / 100;
 
-		if(sc->data[SC_FOGWALL] && skill_id != RK_DRAGONBREATH && skill_id != RK_DRAGONBREATH_WATER) {
+		if(sc->getSCE(SC_FOGWALL) && skill_id != RK_DRAGONBREATH && skill_id != RK_DRAGONBREATH_WATER) {
 			if(flag&BF_SKILL) //25% reduction
 				damage -= damage * 25 / 100;
 			else if ((flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON))
 				damage >>= 2; //75% reduction
 		}
 
-		if (sc->data[SC_SPORE_EXPLOSION] && (flag & BF_LONG) == BF_LONG)
+		if (sc->getSCE(SC_SPORE_EXPLOSION) && (flag & BF_LONG) == BF_LONG)
 			damage += damage * (status_get_class(bl) == CLASS_BOSS ? 5 : 10) / 100;
 
-		if(sc->data[SC_ARMORCHANGE]) {
+		if(sc->getSCE(SC_ARMORCHANGE)) {
 			//On official servers, SC_ARMORCHANGE does not change DEF/MDEF but rather increases/decreases the damage
 			if(flag&BF_WEAPON)
-				damage -= damage * sc->data[SC_ARMORCHANGE]->val2 / 100;
+				damage -= damage * sc->getSCE(SC_ARMORCHANGE)->val2 / 100;
 			else if(flag&BF_MAGIC)
-				damage -= damage * sc->data[SC_ARMORCHANGE]->val3 / 100;
+				damage -= damage * sc->getSCE(SC_ARMORCHANGE)->val3 / 100;
 		}
 
-		if(sc->data[SC_SMOKEPOWDER]) {
+		if(sc->getSCE(SC_SMOKEPOWDER)) {
 			if( (flag&(BF_SHORT|BF_WEAPON)) == (BF_SHORT|BF_WEAPON) )
 				damage -= damage * 15 / 100; // 15% reduction to physical melee attacks
 			else if( (flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON) )
 				damage -= damage * 50 / 100; // 50% reduction to physical ranged attacks
 		}
 
-		if (sc->data[SC_WATER_BARRIER])
+		if (sc->getSCE(SC_WATER_BARRIER))
 			damage = damage * 80 / 100; // 20% reduction to all type attacks
 
-		if (sc->data[SC_SU_STOOP])
+		if (sc->getSCE(SC_SU_STOOP))
 			damage -= damage * 90 / 100;
 
 		// Compressed code, fixed by map.hpp [Epoque]
@@ -1549,46 +1549,46 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			for (const auto &raceit : race2) {
 				switch (raceit) {
 					case RC2_MANUK:
-						if (sce = sc->data[SC_MANU_DEF])
+						if (sce = sc->getSCE(SC_MANU_DEF))
 							damage -= damage * sce->val1 / 100;
 						break;
 					case RC2_SPLENDIDE:
-						if (sce = sc->data[SC_SPL_DEF])
+						if (sce = sc->getSCE(SC_SPL_DEF))
 							damage -= damage * sce->val1 / 100;
 						break;
 					case RC2_OGH_ATK_DEF:
-						if (sc->data[SC_GLASTHEIM_DEF])
+						if (sc->getSCE(SC_GLASTHEIM_DEF))
 							return 0;
 						break;
 					case RC2_OGH_HIDDEN:
-						if (sce = sc->data[SC_GLASTHEIM_HIDDEN])
+						if (sce = sc->getSCE(SC_GLASTHEIM_HIDDEN))
 							damage -= damage * sce->val1 / 100;
 						break;
 					case RC2_BIO5_ACOLYTE_MERCHANT:
-						if (sce = sc->data[SC_LHZ_DUN_N1])
+						if (sce = sc->getSCE(SC_LHZ_DUN_N1))
 							damage -= damage * sce->val2 / 100;
 						break;
 					case RC2_BIO5_MAGE_ARCHER:
-						if (sce = sc->data[SC_LHZ_DUN_N2])
+						if (sce = sc->getSCE(SC_LHZ_DUN_N2))
 							damage -= damage * sce->val2 / 100;
 						break;
 					case RC2_BIO5_SWORDMAN_THIEF:
-						if (sce = sc->data[SC_LHZ_DUN_N3])
+						if (sce = sc->getSCE(SC_LHZ_DUN_N3))
 							damage -= damage * sce->val2 / 100;
 						break;
 					case RC2_BIO5_MVP:
-						if (sce = sc->data[SC_LHZ_DUN_N4])
+						if (sce = sc->getSCE(SC_LHZ_DUN_N4))
 							damage -= damage * sce->val2 / 100;
 						break;
 				}
 			}
 		}
 
-		if((sce=sc->data[SC_ARMOR]) && //NPC_DEFENDER
+		if((sce=sc->getSCE(SC_ARMOR)) && //NPC_DEFENDER
 			sce->val3&flag && sce->val4&flag)
-			damage -= damage * sc->data[SC_ARMOR]->val2 / 100;
+			damage -= damage * sc->getSCE(SC_ARMOR)->val2 / 100;
 
-		if( sc->data[SC_ENERGYCOAT] && (skill_id == GN_HELLS_PLANT_ATK ||
+		if( sc->getSCE(SC_ENERGYCOAT) && (skill_id == GN_HELLS_PLANT_ATK ||
 #ifdef RENEWAL
 			((flag&BF_WEAPON || flag&BF_MAGIC) && skill_id != WS_CARTTERMINATION)
 #else
@@ -1605,39 +1605,39 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			damage -= damage * 6 * (1 + per) / 100; //Reduction: 6% + 6% every 20%
 		}
 
-		if(sc->data[SC_GRANITIC_ARMOR])
-			damage -= damage * sc->data[SC_GRANITIC_ARMOR]->val2 / 100;
+		if(sc->getSCE(SC_GRANITIC_ARMOR))
+			damage -= damage * sc->getSCE(SC_GRANITIC_ARMOR)->val2 / 100;
 
-		if(sc->data[SC_PAIN_KILLER]) {
-			damage -= sc->data[SC_PAIN_KILLER]->val2;
+		if(sc->getSCE(SC_PAIN_KILLER)) {
+			damage -= sc->getSCE(SC_PAIN_KILLER)->val2;
 			damage = i64max(damage, 1);
 		}
 
-		if( (sce=sc->data[SC_MAGMA_FLOW]) && (rnd()%100 <= sce->val2) )
+		if( (sce=sc->getSCE(SC_MAGMA_FLOW)) && (rnd()%100 <= sce->val2) )
 			skill_castend_damage_id(bl,src,MH_MAGMA_FLOW,sce->val1,gettick(),0);
 
-		if( damage > 0 && (sce = sc->data[SC_STONEHARDSKIN]) ) {
+		if( damage > 0 && (sce = sc->getSCE(SC_STONEHARDSKIN)) ) {
 			if( src->type == BL_MOB ) //using explicit call instead break_equip for duration
 				sc_start(src,src, SC_STRIPWEAPON, 30, 0, skill_get_time2(RK_STONEHARDSKIN, sce->val1));
 			else if (flag&(BF_WEAPON|BF_SHORT))
 				skill_break_equip(src,src, EQP_WEAPON, 3000, BCT_SELF);
 		}
 
-		if (src->type == BL_PC && sc->data[SC_GVG_GOLEM]) {
+		if (src->type == BL_PC && sc->getSCE(SC_GVG_GOLEM)) {
 			if (flag&BF_WEAPON)
-				damage -= damage * sc->data[SC_GVG_GOLEM]->val3 / 100;
+				damage -= damage * sc->getSCE(SC_GVG_GOLEM)->val3 / 100;
 			if (flag&BF_MAGIC)
-				damage -= damage * sc->data[SC_GVG_GOLEM]->val4 / 100;
+				damage -= damage * sc->getSCE(SC_GVG_GOLEM)->val4 / 100;
 		}
 
 #ifdef RENEWAL
 		// Renewal: steel body reduces all incoming damage to 1/10 [helvetica]
-		if( sc->data[SC_STEELBODY] )
+		if( sc->getSCE(SC_STEELBODY) )
 			damage = damage > 10 ? damage / 10 : 1;
 #endif
 
 		//Finally added to remove the status of immobile when Aimed Bolt is used. [Jobbie]
-		if( skill_id == RA_AIMEDBOLT && (sc->data[SC_BITE] || sc->data[SC_ANKLE] || sc->data[SC_ELECTRICSHOCKER]) ) {
+		if( skill_id == RA_AIMEDBOLT && (sc->getSCE(SC_BITE) || sc->getSCE(SC_ANKLE) || sc->getSCE(SC_ELECTRICSHOCKER)) ) {
 			status_change_end(bl, SC_BITE, INVALID_TIMER);
 			status_change_end(bl, SC_ANKLE, INVALID_TIMER);
 			status_change_end(bl, SC_ELECTRICSHOCKER, INVALID_TIMER);
@@ -1646,26 +1646,26 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 		if (!damage)
 			return 0;
 
-		if( sd && (sce = sc->data[SC_FORCEOFVANGUARD]) && flag&BF_WEAPON && rnd()%100 < sce->val2 )
+		if( sd && (sce = sc->getSCE(SC_FORCEOFVANGUARD)) && flag&BF_WEAPON && rnd()%100 < sce->val2 )
 			pc_addspiritball(sd,skill_get_time(LG_FORCEOFVANGUARD,sce->val1),sce->val3);
 
-		if( sd && (sce = sc->data[SC_GT_ENERGYGAIN]) && flag&BF_WEAPON && rnd()%100 < sce->val2 ) {
+		if( sd && (sce = sc->getSCE(SC_GT_ENERGYGAIN)) && flag&BF_WEAPON && rnd()%100 < sce->val2 ) {
 			int spheres = 5;
 
-			if( sc->data[SC_RAISINGDRAGON] )
-				spheres += sc->data[SC_RAISINGDRAGON]->val1;
+			if( sc->getSCE(SC_RAISINGDRAGON) )
+				spheres += sc->getSCE(SC_RAISINGDRAGON)->val1;
 
 			pc_addspiritball(sd, skill_get_time2(SR_GENTLETOUCH_ENERGYGAIN, sce->val1), spheres);
 		}
 
-		if (sc->data[SC_STYLE_CHANGE] && sc->data[SC_STYLE_CHANGE]->val1 == MH_MD_GRAPPLING) {
+		if (sc->getSCE(SC_STYLE_CHANGE) && sc->getSCE(SC_STYLE_CHANGE)->val1 == MH_MD_GRAPPLING) {
 			TBL_HOM *hd = BL_CAST(BL_HOM,bl); // We add a sphere for when the Homunculus is being hit
 
 			if (hd && (rnd()%100<50) ) // According to WarpPortal, this is a flat 50% chance
 				hom_addspiritball(hd, 10);
 		}
 
-		if( sc->data[SC__DEADLYINFECT] && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT && damage > 0 && rnd()%100 < 30 + 10 * sc->data[SC__DEADLYINFECT]->val1 )
+		if( sc->getSCE(SC__DEADLYINFECT) && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT && damage > 0 && rnd()%100 < 30 + 10 * sc->getSCE(SC__DEADLYINFECT)->val1 )
 			status_change_spread(bl, src, 1); // Deadly infect attacked side
 
 	} //End of target SC_ check
@@ -1674,17 +1674,17 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 	sc = status_get_sc(src);
 
 	if (sc && sc->count) {
-		if( sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+		if( sc->getSCE(SC_INVINCIBLE) && !sc->getSCE(SC_INVINCIBLEOFF) )
 			damage += damage * 75 / 100;
 
-		if ((sce = sc->data[SC_BLOODLUST]) && flag&BF_WEAPON && damage > 0 && rnd()%100 < sce->val3)
+		if ((sce = sc->getSCE(SC_BLOODLUST)) && flag&BF_WEAPON && damage > 0 && rnd()%100 < sce->val3)
 			status_heal(src, damage * sce->val4 / 100, 0, 3);
 
-		if ((sce = sc->data[SC_BLOODSUCKER]) && flag & BF_WEAPON && damage > 0 && rnd() % 100 < (2 * sce->val1 - 1))
+		if ((sce = sc->getSCE(SC_BLOODSUCKER)) && flag & BF_WEAPON && damage > 0 && rnd() % 100 < (2 * sce->val1 - 1))
 			status_heal(src, damage * sce->val1 / 100, 0, 3);
 
-		if (flag&BF_MAGIC && bl->type == BL_PC && sc->data[SC_GVG_GIANT] && sc->data[SC_GVG_GIANT]->val4)
-			damage += damage * sc->data[SC_GVG_GIANT]->val4 / 100;
+		if (flag&BF_MAGIC && bl->type == BL_PC && sc->getSCE(SC_GVG_GIANT) && sc->getSCE(SC_GVG_GIANT)->val4)
+			damage += damage * sc->getSCE(SC_GVG_GIANT)->val4 / 100;
 
 		// [Epoque]
 		if (bl->type == BL_MOB) {
@@ -1694,31 +1694,31 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 				for (const auto &raceit : race2) {
 					switch (raceit) {
 						case RC2_MANUK:
-							if (sce = sc->data[SC_MANU_ATK])
+							if (sce = sc->getSCE(SC_MANU_ATK))
 								damage += damage * sce->val1 / 100;
 							break;
 						case RC2_SPLENDIDE:
-							if (sce = sc->data[SC_SPL_ATK])
+							if (sce = sc->getSCE(SC_SPL_ATK))
 								damage += damage * sce->val1 / 100;
 							break;
 						case RC2_OGH_ATK_DEF:
-							if (sc->data[SC_GLASTHEIM_ATK])
+							if (sc->getSCE(SC_GLASTHEIM_ATK))
 								damage <<= 1;
 							break;
 						case RC2_BIO5_SWORDMAN_THIEF:
-							if (sce = sc->data[SC_LHZ_DUN_N1])
+							if (sce = sc->getSCE(SC_LHZ_DUN_N1))
 								damage += damage * sce->val1 / 100;
 							break;
 						case RC2_BIO5_ACOLYTE_MERCHANT:
-							if (sce = sc->data[SC_LHZ_DUN_N2])
+							if (sce = sc->getSCE(SC_LHZ_DUN_N2))
 								damage += damage * sce->val1 / 100;
 							break;
 						case RC2_BIO5_MAGE_ARCHER:
-							if (sce = sc->data[SC_LHZ_DUN_N3])
+							if (sce = sc->getSCE(SC_LHZ_DUN_N3))
 								damage += damage * sce->val1 / 100;
 							break;
 						case RC2_BIO5_MVP:
-							if (sce = sc->data[SC_LHZ_DUN_N4])
+							if (sce = sc->getSCE(SC_LHZ_DUN_N4))
 								damage += damage * sce->val1 / 100;
 							break;
 					}
@@ -1726,31 +1726,31 @@ int64 battle_calc_damage(struct block_list *src,struct block_list *bl,struct Dam
 			}
 		}
 
-		if (sc->data[SC_POISONINGWEAPON] && flag&BF_SHORT && (skill_id == 0 || skill_id == GC_VENOMPRESSURE) && damage > 0) {
+		if (sc->getSCE(SC_POISONINGWEAPON) && flag&BF_SHORT && (skill_id == 0 || skill_id == GC_VENOMPRESSURE) && damage > 0) {
 			damage += damage * 10 / 100;
-			if (rnd() % 100 < sc->data[SC_POISONINGWEAPON]->val3)
-				sc_start4(src, bl, (sc_type)sc->data[SC_POISONINGWEAPON]->val2, 100, sc->data[SC_POISONINGWEAPON]->val1, 0, 1, 0, skill_get_time2(GC_POISONINGWEAPON, 1));
+			if (rnd() % 100 < sc->getSCE(SC_POISONINGWEAPON)->val3)
+				sc_start4(src, bl, (sc_type)sc->getSCE(SC_POISONINGWEAPON)->val2, 100, sc->getSCE(SC_POISONINGWEAPON)->val1, 0, 1, 0, skill_get_time2(GC_POISONINGWEAPON, 1));
 		}
 
-		if( sc->data[SC__DEADLYINFECT] && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT && damage > 0 && rnd()%100 < 30 + 10 * sc->data[SC__DEADLYINFECT]->val1 )
+		if( sc->getSCE(SC__DEADLYINFECT) && (flag&(BF_SHORT|BF_MAGIC)) == BF_SHORT && damage > 0 && rnd()%100 < 30 + 10 * sc->getSCE(SC__DEADLYINFECT)->val1 )
 			status_change_spread(src, bl, 0);
 
-		if (sc->data[SC_STYLE_CHANGE] && sc->data[SC_STYLE_CHANGE]->val1 == MH_MD_FIGHTING) {
+		if (sc->getSCE(SC_STYLE_CHANGE) && sc->getSCE(SC_STYLE_CHANGE)->val1 == MH_MD_FIGHTING) {
 			TBL_HOM *hd = BL_CAST(BL_HOM,src); //when attacking
 
 			if (hd && (rnd()%100<50) ) hom_addspiritball(hd, 10); // According to WarpPortal, this is a flat 50% chance
 		}
 
-		if (flag & BF_WEAPON && (sce = sc->data[SC_ADD_ATK_DAMAGE]))
+		if (flag & BF_WEAPON && (sce = sc->getSCE(SC_ADD_ATK_DAMAGE)))
 			damage += damage * sce->val1 / 100;
-		if (flag & BF_MAGIC && (sce = sc->data[SC_ADD_MATK_DAMAGE]))
+		if (flag & BF_MAGIC && (sce = sc->getSCE(SC_ADD_MATK_DAMAGE)))
 			damage += damage * sce->val1 / 100;
-		if (sc->data[SC_DANCEWITHWUG] && (flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON))
-			damage += damage * sc->data[SC_DANCEWITHWUG]->val1 / 100;
-		if (sc->data[SC_UNLIMITEDHUMMINGVOICE] && flag&BF_MAGIC)
-			damage += damage * sc->data[SC_UNLIMITEDHUMMINGVOICE]->val3 / 100;
+		if (sc->getSCE(SC_DANCEWITHWUG) && (flag&(BF_LONG|BF_WEAPON)) == (BF_LONG|BF_WEAPON))
+			damage += damage * sc->getSCE(SC_DANCEWITHWUG)->val1 / 100;
+		if (sc->getSCE(SC_UNLIMITEDHUMMINGVOICE) && flag&BF_MAGIC)
+			damage += damage * sc->getSCE(SC_UNLIMITEDHUMMINGVOICE)->val3 / 100;
 
-		if (tsd && (sce = sc->data[SC_SOULREAPER])) {
+		if (tsd && (sce = sc->getSCE(SC_SOULREAPER))) {
 			if (rnd()%100 < sce->val2 && tsd->soulball < MAX_SOUL_BALL) {
 				clif_specialeffect(src, 1208, AREA);
 				pc_addsoulball(tsd, 5 + 3 * pc_checkskill(tsd, SP_SOULENERGY));
@@ -2013,7 +2013,7 @@ int64 battle_addmastery(struct map_session_data *sd,struct block_list *target,in
 
 	if((skill = pc_checkskill(sd,HT_BEASTBANE)) > 0 && (status->race == RC_INSECT || status->race == RC_BRUTE || status->race == RC_PLAYER_DORAM) ) {
 		damage += (skill * 4);
-		if (sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_HUNTER)
+		if (sd->sc.getSCE(SC_SPIRIT) && sd->sc.getSCE(SC_SPIRIT)->val2 == SL_HUNTER)
 			damage += sd->status.str;
 	}
 
@@ -2196,13 +2196,13 @@ static int battle_calc_base_weapon_attack(struct block_list *src, struct status_
 		atkmin = max(0, (int)(atkmin - variance + base_stat_bonus));
 		atkmax = min(UINT16_MAX, (int)(atkmax + variance + base_stat_bonus));
 
-		if (sc && sc->data[SC_MAXIMIZEPOWER])
+		if (sc && sc->getSCE(SC_MAXIMIZEPOWER))
 			damage = atkmax;
 		else
 			damage = rnd_value(atkmin, atkmax);
 	}
 
-	if (sc && sc->data[SC_WEAPONPERFECTION])
+	if (sc && sc->getSCE(SC_WEAPONPERFECTION))
 		weapon_perfection = true;
 
 	battle_add_weapon_damage(sd, &damage, type);
@@ -2273,7 +2273,7 @@ static int64 battle_calc_base_damage(struct block_list *src, struct status_data
 		}
 	}
 
-	if (sc && sc->data[SC_MAXIMIZEPOWER])
+	if (sc && sc->getSCE(SC_MAXIMIZEPOWER))
 		atkmin = atkmax;
 
 	//Weapon Damage calculation
@@ -2299,25 +2299,25 @@ static int64 battle_calc_base_damage(struct block_list *src, struct status_data
 			case ELEMENTALID_AGNI_S:
 			case ELEMENTALID_AGNI_M:
 			case ELEMENTALID_AGNI_L:
-				if (ele_sc->data[SC_FIRE_INSIGNIA] && ele_sc->data[SC_FIRE_INSIGNIA]->val1 == 1)
+				if (ele_sc->getSCE(SC_FIRE_INSIGNIA) && ele_sc->getSCE(SC_FIRE_INSIGNIA)->val1 == 1)
 					damage += damage * 20 / 100;
 				break;
 			case ELEMENTALID_AQUA_S:
 			case ELEMENTALID_AQUA_M:
 			case ELEMENTALID_AQUA_L:
-				if (ele_sc->data[SC_WATER_INSIGNIA] && ele_sc->data[SC_WATER_INSIGNIA]->val1 == 1)
+				if (ele_sc->getSCE(SC_WATER_INSIGNIA) && ele_sc->getSCE(SC_WATER_INSIGNIA)->val1 == 1)
 					damage += damage * 20 / 100;
 				break;
 			case ELEMENTALID_VENTUS_S:
 			case ELEMENTALID_VENTUS_M:
 			case ELEMENTALID_VENTUS_L:
-				if (ele_sc->data[SC_WIND_INSIGNIA] && ele_sc->data[SC_WIND_INSIGNIA]->val1 == 1)
+				if (ele_sc->getSCE(SC_WIND_INSIGNIA) && ele_sc->getSCE(SC_WIND_INSIGNIA)->val1 == 1)
 					damage += damage * 20 / 100;
 				break;
 			case ELEMENTALID_TERA_S:
 			case ELEMENTALID_TERA_M:
 			case ELEMENTALID_TERA_L:
-				if (ele_sc->data[SC_EARTH_INSIGNIA] && ele_sc->data[SC_EARTH_INSIGNIA]->val1 == 1)
+				if (ele_sc->getSCE(SC_EARTH_INSIGNIA) && ele_sc->getSCE(SC_EARTH_INSIGNIA)->val1 == 1)
 					damage += damage * 20 / 100;
 				break;
 			}
@@ -2689,19 +2689,19 @@ static bool is_attack_critical(struct Damage* wd, struct block_list *src, struct
 			}
 		}
 
-		if(sc && sc->data[SC_CAMOUFLAGE])
-			cri += 100 * min(10,sc->data[SC_CAMOUFLAGE]->val3); //max 100% (1K)
+		if(sc && sc->getSCE(SC_CAMOUFLAGE))
+			cri += 100 * min(10,sc->getSCE(SC_CAMOUFLAGE)->val3); //max 100% (1K)
 
 		//The official equation is *2, but that only applies when sd's do critical.
 		//Therefore, we use the old value 3 on cases when an sd gets attacked by a mob
 		cri -= tstatus->luk * ((!sd && tsd) ? 3 : 2);
 
-		if( tsc && tsc->data[SC_SLEEP] )
+		if( tsc && tsc->getSCE(SC_SLEEP) )
 			cri <<= 1;
 
 		switch(skill_id) {
 			case 0:
-				if(sc && !sc->data[SC_AUTOCOUNTER])
+				if(sc && !sc->getSCE(SC_AUTOCOUNTER))
 					break;
 				clif_specialeffect(src, EF_AUTOCOUNTER, AREA);
 				status_change_end(src, SC_AUTOCOUNTER, INVALID_TIMER);
@@ -2825,18 +2825,18 @@ static bool is_attack_hitting(struct Damage* wd, struct block_list *src, struct
 		return true;
 	else if(sd && sd->bonus.perfect_hit > 0 && rnd()%100 < sd->bonus.perfect_hit)
 		return true;
-	else if (sc && sc->data[SC_FUSION])
+	else if (sc && sc->getSCE(SC_FUSION))
 		return true;
 	else if ((skill_id == AS_SPLASHER || skill_id == GN_SPORE_EXPLOSION) && !wd->miscflag)
 		return true;
-	else if (skill_id == CR_SHIELDBOOMERANG && sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_CRUSADER )
+	else if (skill_id == CR_SHIELDBOOMERANG && sc && sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_CRUSADER )
 		return true;
 	else if (tsc && tsc->opt1 && tsc->opt1 != OPT1_STONEWAIT && tsc->opt1 != OPT1_BURNING)
 		return true;
 	else if (nk[NK_IGNOREFLEE])
 		return true;
 
-	if( tsc && tsc->data[SC_NEUTRALBARRIER] && (wd->flag&(BF_LONG|BF_MAGIC)) == BF_LONG )
+	if( tsc && tsc->getSCE(SC_NEUTRALBARRIER) && (wd->flag&(BF_LONG|BF_MAGIC)) == BF_LONG )
 		return false;
 
 	flee = tstatus->flee;
@@ -2862,7 +2862,7 @@ static bool is_attack_hitting(struct Damage* wd, struct block_list *src, struct
 	hitrate += sstatus->hit - flee;
 
 	//Fogwall's hit penalty is only for normal ranged attacks.
-	if ((wd->flag&(BF_LONG|BF_MAGIC)) == BF_LONG && !skill_id && tsc && tsc->data[SC_FOGWALL])
+	if ((wd->flag&(BF_LONG|BF_MAGIC)) == BF_LONG && !skill_id && tsc && tsc->getSCE(SC_FOGWALL))
 		hitrate -= 50;
 
 	if(sd && is_skill_using_arrow(src, skill_id))
@@ -2968,10 +2968,10 @@ static bool is_attack_hitting(struct Damage* wd, struct block_list *src, struct
 	}
 
 	if (sc) {
-		if (sc->data[SC_MTF_ASPD])
-			hitrate += sc->data[SC_MTF_ASPD]->val2;
-		if (sc->data[SC_MTF_ASPD2])
-			hitrate += sc->data[SC_MTF_ASPD2]->val2;
+		if (sc->getSCE(SC_MTF_ASPD))
+			hitrate += sc->getSCE(SC_MTF_ASPD)->val2;
+		if (sc->getSCE(SC_MTF_ASPD2))
+			hitrate += sc->getSCE(SC_MTF_ASPD2)->val2;
 	}
 
 	hitrate = cap_value(hitrate, battle_config.min_hitrate, battle_config.max_hitrate);
@@ -2998,7 +2998,7 @@ static bool attack_ignores_def(struct Damage* wd, struct block_list *src, struct
 		return true;
 	else
 #endif
-	if (sc && sc->data[SC_FUSION])
+	if (sc && sc->getSCE(SC_FUSION))
 		return true;
 	else if (skill_id != CR_GRANDCROSS && skill_id != NPC_GRANDDARKNESS)
 	{	//Ignore Defense?
@@ -3096,8 +3096,8 @@ static int battle_get_weapon_element(struct Damage* wd, struct block_list *src,
 		if(sd && sd->spiritcharm_type != CHARM_TYPE_NONE && sd->spiritcharm >= MAX_SPIRITCHARM)
 			element = sd->spiritcharm_type; // Summoning 10 spiritcharm will endow your weapon
 		// on official endows override all other elements [helvetica]
-		if(sc && sc->data[SC_ENCHANTARMS]) // Check for endows
-			element = sc->data[SC_ENCHANTARMS]->val1;
+		if(sc && sc->getSCE(SC_ENCHANTARMS)) // Check for endows
+			element = sc->getSCE(SC_ENCHANTARMS)->val1;
 	} else if( element == ELE_ENDOWED ) //Use enchantment's element
 		element = status_get_attack_sc_element(src,sc);
 	else if( element == ELE_RANDOM ) //Use random element
@@ -3113,22 +3113,22 @@ static int battle_get_weapon_element(struct Damage* wd, struct block_list *src,
 			break;
 		case RK_DRAGONBREATH:
 			if (sc) {
-				if (sc->data[SC_LUXANIMA]) // Lux Anima has priority over Giant Growth
+				if (sc->getSCE(SC_LUXANIMA)) // Lux Anima has priority over Giant Growth
 					element = ELE_DARK;
-				else if (sc->data[SC_GIANTGROWTH])
+				else if (sc->getSCE(SC_GIANTGROWTH))
 					element = ELE_HOLY;
 			}
 			break;
 		case RK_DRAGONBREATH_WATER:
 			if (sc) {
-				if (sc->data[SC_LUXANIMA]) // Lux Anima has priority over Fighting Spirit
+				if (sc->getSCE(SC_LUXANIMA)) // Lux Anima has priority over Fighting Spirit
 					element = ELE_NEUTRAL;
-				else if (sc->data[SC_FIGHTINGSPIRIT])
+				else if (sc->getSCE(SC_FIGHTINGSPIRIT))
 					element = ELE_GHOST;
 			}
 			break;
 		case LG_HESPERUSLIT:
-			if (sc && sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 4)
+			if (sc && sc->getSCE(SC_BANDING) && sc->getSCE(SC_BANDING)->val2 > 4)
 				element = ELE_HOLY;
 			break;
 		case GN_CARTCANNON:
@@ -3145,7 +3145,7 @@ static int battle_get_weapon_element(struct Damage* wd, struct block_list *src,
 			break;
 	}
 
-	if (sc && sc->data[SC_GOLDENE_FERSE] && ((!skill_id && (rnd() % 100 < sc->data[SC_GOLDENE_FERSE]->val4)) || skill_id == MH_STAHL_HORN))
+	if (sc && sc->getSCE(SC_GOLDENE_FERSE) && ((!skill_id && (rnd() % 100 < sc->getSCE(SC_GOLDENE_FERSE)->val4)) || skill_id == MH_STAHL_HORN))
 		element = ELE_HOLY;
 
 // calc_flag means the element should be calculated for damage only
@@ -3229,13 +3229,13 @@ static void battle_calc_element_damage(struct Damage* wd, struct block_list *src
 #ifdef RENEWAL
 		if (sd == nullptr) { // Only monsters have a single ATK for element, in pre-renewal we also apply element to entire ATK on players [helvetica]
 #endif
-			if (sc && sc->data[SC_WATK_ELEMENT]) { // Descriptions indicate this means adding a percent of a normal attack in another element [Skotlex]
-				int64 damage = battle_calc_base_damage(src, sstatus, &sstatus->rhw, sc, tstatus->size, (is_skill_using_arrow(src, skill_id) ? 2 : 0)) * sc->data[SC_WATK_ELEMENT]->val2 / 100;
+			if (sc && sc->getSCE(SC_WATK_ELEMENT)) { // Descriptions indicate this means adding a percent of a normal attack in another element [Skotlex]
+				int64 damage = battle_calc_base_damage(src, sstatus, &sstatus->rhw, sc, tstatus->size, (is_skill_using_arrow(src, skill_id) ? 2 : 0)) * sc->getSCE(SC_WATK_ELEMENT)->val2 / 100;
 
-				wd->damage += battle_attr_fix(src, target, damage, sc->data[SC_WATK_ELEMENT]->val1, tstatus->def_ele, tstatus->ele_lv);
+				wd->damage += battle_attr_fix(src, target, damage, sc->getSCE(SC_WATK_ELEMENT)->val1, tstatus->def_ele, tstatus->ele_lv);
 				if (is_attack_left_handed(src, skill_id)) {
-					damage = battle_calc_base_damage(src, sstatus, &sstatus->lhw, sc, tstatus->size, (is_skill_using_arrow(src, skill_id) ? 2 : 0)) * sc->data[SC_WATK_ELEMENT]->val2 / 100;
-					wd->damage2 += battle_attr_fix(src, target, damage, sc->data[SC_WATK_ELEMENT]->val1, tstatus->def_ele, tstatus->ele_lv);
+					damage = battle_calc_base_damage(src, sstatus, &sstatus->lhw, sc, tstatus->size, (is_skill_using_arrow(src, skill_id) ? 2 : 0)) * sc->getSCE(SC_WATK_ELEMENT)->val2 / 100;
+					wd->damage2 += battle_attr_fix(src, target, damage, sc->getSCE(SC_WATK_ELEMENT)->val1, tstatus->def_ele, tstatus->ele_lv);
 				}
 			}
 #ifdef RENEWAL
@@ -3343,26 +3343,26 @@ static void battle_calc_attack_masteries(struct Damage* wd, struct block_list *s
 
 		if (sc) { // Status change considered as masteries
 #ifdef RENEWAL
-			if (sc->data[SC_NIBELUNGEN]) // With renewal, the level 4 weapon limitation has been removed
-				ATK_ADD(wd->masteryAtk, wd->masteryAtk2, sc->data[SC_NIBELUNGEN]->val2);
+			if (sc->getSCE(SC_NIBELUNGEN)) // With renewal, the level 4 weapon limitation has been removed
+				ATK_ADD(wd->masteryAtk, wd->masteryAtk2, sc->getSCE(SC_NIBELUNGEN)->val2);
 #endif
 
-			if(sc->data[SC_CAMOUFLAGE]) {
-				ATK_ADD(wd->damage, wd->damage2, 30 * min(10, sc->data[SC_CAMOUFLAGE]->val3));
+			if(sc->getSCE(SC_CAMOUFLAGE)) {
+				ATK_ADD(wd->damage, wd->damage2, 30 * min(10, sc->getSCE(SC_CAMOUFLAGE)->val3));
 #ifdef RENEWAL
-				ATK_ADD(wd->masteryAtk, wd->masteryAtk2, 30 * min(10, sc->data[SC_CAMOUFLAGE]->val3));
+				ATK_ADD(wd->masteryAtk, wd->masteryAtk2, 30 * min(10, sc->getSCE(SC_CAMOUFLAGE)->val3));
 #endif
 			}
-			if(sc->data[SC_GN_CARTBOOST]) {
-				ATK_ADD(wd->damage, wd->damage2, 10 * sc->data[SC_GN_CARTBOOST]->val1);
+			if(sc->getSCE(SC_GN_CARTBOOST)) {
+				ATK_ADD(wd->damage, wd->damage2, 10 * sc->getSCE(SC_GN_CARTBOOST)->val1);
 #ifdef RENEWAL
-				ATK_ADD(wd->masteryAtk, wd->masteryAtk2, 10 * sc->data[SC_GN_CARTBOOST]->val1);
+				ATK_ADD(wd->masteryAtk, wd->masteryAtk2, 10 * sc->getSCE(SC_GN_CARTBOOST)->val1);
 #endif
 			}
-			if (sc->data[SC_P_ALTER]) {
-				ATK_ADD(wd->damage, wd->damage2, sc->data[SC_P_ALTER]->val2);
+			if (sc->getSCE(SC_P_ALTER)) {
+				ATK_ADD(wd->damage, wd->damage2, sc->getSCE(SC_P_ALTER)->val2);
 #ifdef RENEWAL
-				ATK_ADD(wd->masteryAtk, wd->masteryAtk2, sc->data[SC_P_ALTER]->val2);
+				ATK_ADD(wd->masteryAtk, wd->masteryAtk2, sc->getSCE(SC_P_ALTER)->val2);
 #endif
 			}
 		}
@@ -3390,7 +3390,7 @@ static void battle_calc_damage_parts(struct Damage* wd, struct block_list *src,s
 	wd->statusAtk += battle_calc_status_attack(sstatus, EQI_HAND_R);
 	wd->statusAtk2 += battle_calc_status_attack(sstatus, EQI_HAND_L);
 
-	if (sd && sd->sc.data[SC_SEVENWIND]) { // Mild Wind applies element to status ATK as well as weapon ATK [helvetica]
+	if (sd && sd->sc.getSCE(SC_SEVENWIND)) { // Mild Wind applies element to status ATK as well as weapon ATK [helvetica]
 		wd->statusAtk = battle_attr_fix(src, target, wd->statusAtk, right_element, tstatus->def_ele, tstatus->ele_lv);
 		wd->statusAtk2 = battle_attr_fix(src, target, wd->statusAtk, left_element, tstatus->def_ele, tstatus->ele_lv);
 	} else { // status atk is considered neutral on normal attacks [helvetica]
@@ -3561,8 +3561,8 @@ static void battle_calc_skill_base_damage(struct Damage* wd, struct block_list *
 #endif
 					sstatus->batk + sstatus->rhw.atk + (index >= 0 && sd->inventory_data[index] ?
 						sd->inventory_data[index]->atk : 0)) * (skill_lv + 5) / 5;
-				if (sc && sc->data[SC_KAGEMUSYA])
-					damagevalue += damagevalue * sc->data[SC_KAGEMUSYA]->val2 / 100;
+				if (sc && sc->getSCE(SC_KAGEMUSYA))
+					damagevalue += damagevalue * sc->getSCE(SC_KAGEMUSYA)->val2 / 100;
 				ATK_ADD(wd->damage, wd->damage2, damagevalue);
 #ifdef RENEWAL
 				ATK_ADD(wd->weaponAtk, wd->weaponAtk2, damagevalue);
@@ -3581,7 +3581,7 @@ static void battle_calc_skill_base_damage(struct Damage* wd, struct block_list *
 				battle_calc_damage_parts(wd, src, target, skill_id, skill_lv);
 			else {
 				i = (is_attack_critical(wd, src, target, skill_id, skill_lv, false)?1:0)|
-					(!skill_id && sc && sc->data[SC_CHANGE]?4:0);
+					(!skill_id && sc && sc->getSCE(SC_CHANGE)?4:0);
 
 				wd->damage = battle_calc_base_damage(src, sstatus, &sstatus->rhw, sc, tstatus->size, i);
 				if (is_attack_left_handed(src, skill_id))
@@ -3591,9 +3591,9 @@ static void battle_calc_skill_base_damage(struct Damage* wd, struct block_list *
 			i = (is_attack_critical(wd, src, target, skill_id, skill_lv, false)?1:0)|
 				(is_skill_using_arrow(src, skill_id)?2:0)|
 				(skill_id == HW_MAGICCRASHER?4:0)|
-				(!skill_id && sc && sc->data[SC_CHANGE]?4:0)|
+				(!skill_id && sc && sc->getSCE(SC_CHANGE)?4:0)|
 				(skill_id == MO_EXTREMITYFIST?8:0)|
-				(sc && sc->data[SC_WEAPONPERFECTION]?8:0);
+				(sc && sc->getSCE(SC_WEAPONPERFECTION)?8:0);
 			if (is_skill_using_arrow(src, skill_id) && sd) {
 				switch(sd->status.weapon) {
 					case W_BOW:
@@ -3697,12 +3697,12 @@ static void battle_calc_multi_attack(struct Damage* wd, struct block_list *src,s
 		short i;
 		if( ( ( skill_lv = pc_checkskill(sd,TF_DOUBLE) ) > 0 && sd->weapontype1 == W_DAGGER )
 			|| ( sd->bonus.double_rate > 0 && sd->weapontype1 != W_FIST ) // Will fail bare-handed
-			|| ( sc && sc->data[SC_KAGEMUSYA] && sd->weapontype1 != W_FIST )) // Will fail bare-handed
+			|| ( sc && sc->getSCE(SC_KAGEMUSYA) && sd->weapontype1 != W_FIST )) // Will fail bare-handed
 		{	//Success chance is not added, the higher one is used [Skotlex]
 			int max_rate = 0;
 
-			if (sc && sc->data[SC_KAGEMUSYA])
-				max_rate = sc->data[SC_KAGEMUSYA]->val1 * 10; // Same rate as even levels of TF_DOUBLE
+			if (sc && sc->getSCE(SC_KAGEMUSYA))
+				max_rate = sc->getSCE(SC_KAGEMUSYA)->val1 * 10; // Same rate as even levels of TF_DOUBLE
 			else
 #ifdef RENEWAL
 				max_rate = max(7 * skill_lv, sd->bonus.double_rate);
@@ -3716,7 +3716,7 @@ static void battle_calc_multi_attack(struct Damage* wd, struct block_list *src,s
 			}
 		}
 		else if( ((sd->weapontype1 == W_REVOLVER && (skill_lv = pc_checkskill(sd,GS_CHAINACTION)) > 0) //Normal Chain Action effect
-			|| (sc && sc->count && sc->data[SC_E_CHAIN] && (skill_lv = sc->data[SC_E_CHAIN]->val1) > 0)) //Chain Action of ETERNAL_CHAIN
+			|| (sc && sc->count && sc->getSCE(SC_E_CHAIN) && (skill_lv = sc->getSCE(SC_E_CHAIN)->val1) > 0)) //Chain Action of ETERNAL_CHAIN
 			&& rnd()%100 < 5*skill_lv ) //Success rate
 		{
 			wd->div_ = skill_get_num(GS_CHAINACTION,skill_lv);
@@ -3724,11 +3724,11 @@ static void battle_calc_multi_attack(struct Damage* wd, struct block_list *src,s
 
 			sc_start(src,src,SC_QD_SHOT_READY,100,target->id,skill_get_time(RL_QD_SHOT,1));
 		}
-		else if(sc && sc->data[SC_FEARBREEZE] && sd->weapontype1==W_BOW
+		else if(sc && sc->getSCE(SC_FEARBREEZE) && sd->weapontype1==W_BOW
 			&& (i = sd->equip_index[EQI_AMMO]) >= 0 && sd->inventory_data[i] && sd->inventory.u.items_inventory[i].amount > 1)
 		{
 			int chance = rnd()%100;
-			switch(sc->data[SC_FEARBREEZE]->val1) {
+			switch(sc->getSCE(SC_FEARBREEZE)->val1) {
 				case 5: if( chance < 4) { wd->div_ = 5; break; } // 3 % chance to attack 5 times.
 				case 4: if( chance < 7) { wd->div_ = 4; break; } // 6 % chance to attack 4 times.
 				case 3: if( chance < 10) { wd->div_ = 3; break; } // 9 % chance to attack 3 times.
@@ -3736,7 +3736,7 @@ static void battle_calc_multi_attack(struct Damage* wd, struct block_list *src,s
 				case 1: if( chance < 13) { wd->div_ = 2; break; } // 12 % chance to attack 2 times.
 			}
 			wd->div_ = min(wd->div_,sd->inventory.u.items_inventory[i].amount);
-			sc->data[SC_FEARBREEZE]->val4 = wd->div_-1;
+			sc->getSCE(SC_FEARBREEZE)->val4 = wd->div_-1;
 			if (wd->div_ > 1)
 				wd->type = DMG_MULTI_HIT;
 		}
@@ -3755,10 +3755,10 @@ static void battle_calc_multi_attack(struct Damage* wd, struct block_list *src,s
 			wd->div_ = (sd ? max(1, sd->spiritball_old) : 1);
 			break;
 		case RL_QD_SHOT:
-			wd->div_ = 1 + (sd ? sd->status.job_level : 1) / 20 + (tsc && tsc->data[SC_C_MARKER] ? 2 : 0);
+			wd->div_ = 1 + (sd ? sd->status.job_level : 1) / 20 + (tsc && tsc->getSCE(SC_C_MARKER) ? 2 : 0);
 			break;
 		case KO_JYUMONJIKIRI:
-			if( tsc && tsc->data[SC_JYUMONJIKIRI] )
+			if( tsc && tsc->getSCE(SC_JYUMONJIKIRI) )
 				wd->div_ = wd->div_ * -1;// needs more info
 			break;
 #ifdef RENEWAL
@@ -3795,22 +3795,22 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 
 	//Skill damage modifiers that stack linearly
 	if(sc && skill_id != PA_SACRIFICE) {
-		if(sc->data[SC_OVERTHRUST])
-			skillratio += sc->data[SC_OVERTHRUST]->val3;
-		if(sc->data[SC_MAXOVERTHRUST])
-			skillratio += sc->data[SC_MAXOVERTHRUST]->val2;
-		if(sc->data[SC_BERSERK])
+		if(sc->getSCE(SC_OVERTHRUST))
+			skillratio += sc->getSCE(SC_OVERTHRUST)->val3;
+		if(sc->getSCE(SC_MAXOVERTHRUST))
+			skillratio += sc->getSCE(SC_MAXOVERTHRUST)->val2;
+		if(sc->getSCE(SC_BERSERK))
 #ifndef RENEWAL
 			skillratio += 100;
 #else
 			skillratio += 200;
-		if (sc && sc->data[SC_TRUESIGHT])
-			skillratio += 2 * sc->data[SC_TRUESIGHT]->val1;
-		if (sc->data[SC_CONCENTRATION] && (skill_id != RK_DRAGONBREATH && skill_id != RK_DRAGONBREATH_WATER))
-			skillratio += sc->data[SC_CONCENTRATION]->val2;
+		if (sc && sc->getSCE(SC_TRUESIGHT))
+			skillratio += 2 * sc->getSCE(SC_TRUESIGHT)->val1;
+		if (sc->getSCE(SC_CONCENTRATION) && (skill_id != RK_DRAGONBREATH && skill_id != RK_DRAGONBREATH_WATER))
+			skillratio += sc->getSCE(SC_CONCENTRATION)->val2;
 #endif
 		if (!skill_id || skill_id == KN_AUTOCOUNTER) {
-			if (sc->data[SC_CRUSHSTRIKE]) {
+			if (sc->getSCE(SC_CRUSHSTRIKE)) {
 				if (sd) { //ATK [{Weapon Level * (Weapon Upgrade Level + 6) * 100} + (Weapon ATK) + (Weapon Weight)]%
 					short index = sd->equip_index[EQI_HAND_R];
 
@@ -3821,7 +3821,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 				status_change_end(src,SC_CRUSHSTRIKE,INVALID_TIMER);
 				skill_break_equip(src,src,EQP_WEAPON,2000,BCT_SELF);
 			} else {
-				if (sc->data[SC_GIANTGROWTH] && (sd->class_&MAPID_THIRDMASK) == MAPID_RUNE_KNIGHT) { // Increase damage again if Crush Strike is not active
+				if (sc->getSCE(SC_GIANTGROWTH) && (sd->class_&MAPID_THIRDMASK) == MAPID_RUNE_KNIGHT) { // Increase damage again if Crush Strike is not active
 					if (map_flag_vs(src->m)) // Only half of the 2.5x increase on versus-type maps
 						skillratio += 125;
 					else
@@ -4018,7 +4018,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 		case MO_FINGEROFFENSIVE:
 #ifdef RENEWAL
 			skillratio += 500 + skill_lv * 200;
-			if (tsc && tsc->data[SC_BLADESTOP])
+			if (tsc && tsc->getSCE(SC_BLADESTOP))
 				skillratio += skillratio / 2;
 #else
 			skillratio += 50 * skill_lv;
@@ -4027,7 +4027,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 		case MO_INVESTIGATE:
 #ifdef RENEWAL
 			skillratio += -100 + 100 * skill_lv;
-			if (tsc && tsc->data[SC_BLADESTOP])
+			if (tsc && tsc->getSCE(SC_BLADESTOP))
 				skillratio += skillratio / 2;
 #else
 			skillratio += 75 * skill_lv;
@@ -4059,7 +4059,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 #else
 			skillratio += 140 + 60 * skill_lv;
 #endif
-			if (sc->data[SC_GT_ENERGYGAIN])
+			if (sc->getSCE(SC_GT_ENERGYGAIN))
 				skillratio += skillratio * 50 / 100;
 			break;
 		case BA_MUSICALSTRIKE:
@@ -4077,7 +4077,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 #else
 			skillratio += -60 + 100 * skill_lv;
 #endif
-			if (sc->data[SC_GT_ENERGYGAIN])
+			if (sc->getSCE(SC_GT_ENERGYGAIN))
 				skillratio += skillratio * 50 / 100;
 			break;
 		case CH_CHAINCRUSH:
@@ -4087,7 +4087,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 #else
 			skillratio += 300 + 100 * skill_lv;
 #endif
-			if (sc->data[SC_GT_ENERGYGAIN])
+			if (sc->getSCE(SC_GT_ENERGYGAIN))
 				skillratio += skillratio * 50 / 100;
 			break;
 		case CH_PALMSTRIKE:
@@ -4103,7 +4103,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 			break;
 		case LK_JOINTBEAT:
 			skillratio += 10 * skill_lv - 50;
-			if (wd->miscflag & BREAK_NECK || (tsc && tsc->data[SC_JOINTBEAT] && tsc->data[SC_JOINTBEAT]->val2 & BREAK_NECK)) // The 2x damage is only for the BREAK_NECK ailment.
+			if (wd->miscflag & BREAK_NECK || (tsc && tsc->getSCE(SC_JOINTBEAT) && tsc->getSCE(SC_JOINTBEAT)->val2 & BREAK_NECK)) // The 2x damage is only for the BREAK_NECK ailment.
 				skillratio <<= 1;
 			break;
 #ifdef RENEWAL
@@ -4202,11 +4202,11 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 			break;
 		case TK_JUMPKICK:
 			//Different damage formulas depending on damage trigger
-			if (sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == skill_id)
+			if (sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == skill_id)
 				skillratio += -100 + 4 * status_get_lv(src); //Tumble formula [4%*baselevel]
 			else if (wd->miscflag) {
 				skillratio += -100 + 4 * status_get_lv(src); //Running formula [4%*baselevel]
-				if (sc && sc->data[SC_SPURT]) //Spurt formula [8%*baselevel]
+				if (sc && sc->getSCE(SC_SPURT)) //Spurt formula [8%*baselevel]
 					skillratio *= 2;
 			}
 			else
@@ -4238,7 +4238,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 			break;
 		case GS_DESPERADO:
 			skillratio += 50 * (skill_lv - 1);
-			if (sc && sc->data[SC_FALLEN_ANGEL])
+			if (sc && sc->getSCE(SC_FALLEN_ANGEL))
 				skillratio *= 2;
 			break;
 		case GS_DUST:
@@ -4387,8 +4387,8 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 		case GC_CROSSRIPPERSLASHER:
 			skillratio += -100 + 80 * skill_lv + (sstatus->agi * 3);
 			RE_LVL_DMOD(100);
-			if (sc && sc->data[SC_ROLLINGCUTTER])
-				skillratio += sc->data[SC_ROLLINGCUTTER]->val1 * 200;
+			if (sc && sc->getSCE(SC_ROLLINGCUTTER))
+				skillratio += sc->getSCE(SC_ROLLINGCUTTER)->val1 * 200;
 			break;
 		case GC_DARKCROW:
 			skillratio += 100 * (skill_lv - 1);
@@ -4400,14 +4400,14 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 			skillratio += 900 + 80 * skill_lv;
 			break;
 		case RA_ARROWSTORM:
-			if (sc && sc->data[SC_FEARBREEZE])
+			if (sc && sc->getSCE(SC_FEARBREEZE))
 				skillratio += -100 + 200 + 250 * skill_lv;
 			else
 				skillratio += -100 + 200 + 180 * skill_lv;
 			RE_LVL_DMOD(100);
 			break;
 		case RA_AIMEDBOLT:
-			if (sc && sc->data[SC_FEARBREEZE])
+			if (sc && sc->getSCE(SC_FEARBREEZE))
 				skillratio += -100 + 800 + 35 * skill_lv;
 			else
 				skillratio += -100 + 500 + 20 * skill_lv;	
@@ -4518,7 +4518,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 			RE_LVL_DMOD(100);
 			break;
 		case LG_OVERBRAND:
-			if(sc && sc->data[SC_OVERBRANDREADY])
+			if(sc && sc->getSCE(SC_OVERBRANDREADY))
 				skillratio += -100 + 450 * skill_lv;
 			else
 				skillratio += -100 + 300 * skill_lv;
@@ -4530,7 +4530,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 			RE_LVL_DMOD(100);
 			break;
 		case LG_HESPERUSLIT:
-			if (sc && sc->data[SC_INSPIRATION])
+			if (sc && sc->getSCE(SC_INSPIRATION))
 				skillratio += -100 + 450 * skill_lv;
 			else
 				skillratio += -100 + 300 * skill_lv;
@@ -4538,7 +4538,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 			RE_LVL_DMOD(100);
 			break;
 		case SR_EARTHSHAKER:
-			if (tsc && ((tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK)) || tsc->data[SC_CAMOUFLAGE] || tsc->data[SC_STEALTHFIELD] || tsc->data[SC__SHADOWFORM])) {
+			if (tsc && ((tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK)) || tsc->getSCE(SC_CAMOUFLAGE) || tsc->getSCE(SC_STEALTHFIELD) || tsc->getSCE(SC__SHADOWFORM))) {
 				//[(Skill Level x 300) x (Caster Base Level / 100) + (Caster STR x 3)] %
 				skillratio += -100 + 300 * skill_lv;
 				RE_LVL_DMOD(100);
@@ -4572,7 +4572,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 					skillratio += -100 + (hp + sp) / 4;
 				RE_LVL_DMOD(100);
 			}
-			if (sc->data[SC_GT_REVITALIZE])
+			if (sc->getSCE(SC_GT_REVITALIZE))
 				skillratio += skillratio * 30 / 100;
 			break;
 		case SR_SKYNETBLOW:
@@ -4582,14 +4582,14 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 			break;
 
 		case SR_RAMPAGEBLASTER:
-			if (tsc && tsc->data[SC_EARTHSHAKER]) {
+			if (tsc && tsc->getSCE(SC_EARTHSHAKER)) {
 				skillratio += 1400 + 550 * skill_lv;
 				RE_LVL_DMOD(120);
 			} else {
 				skillratio += 900 + 350 * skill_lv;
 				RE_LVL_DMOD(150);
 			}
-			if (sc->data[SC_GT_CHANGE])
+			if (sc->getSCE(SC_GT_CHANGE))
 				skillratio += skillratio * 30 / 100;
 			break;
 		case SR_KNUCKLEARROW:
@@ -4605,7 +4605,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 					skillratio += 400 + 100 * skill_lv;
 				RE_LVL_DMOD(100);
 			}
-			if (sc->data[SC_GT_CHANGE])
+			if (sc->getSCE(SC_GT_CHANGE))
 				skillratio += skillratio * 30 / 100;
 			break;
 		case SR_WINDMILL: // ATK [(Caster Base Level + Caster DEX) x Caster Base Level / 100] %
@@ -4613,12 +4613,12 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 			RE_LVL_DMOD(100);
 			break;
 		case SR_GATEOFHELL:
-			if (sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == SR_FALLENEMPIRE)
+			if (sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == SR_FALLENEMPIRE)
 				skillratio += -100 + 800 * skill_lv;
 			else
 				skillratio += -100 + 500 * skill_lv;
 			RE_LVL_DMOD(100);
-			if (sc->data[SC_GT_REVITALIZE])
+			if (sc->getSCE(SC_GT_REVITALIZE))
 				skillratio += skillratio * 30 / 100;
 			break;
 		case SR_GENTLETOUCH_QUIET:
@@ -4736,16 +4736,16 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 		case KO_JYUMONJIKIRI:
 			skillratio += -100 + 200 * skill_lv;
 			RE_LVL_DMOD(120);
-			if(tsc && tsc->data[SC_JYUMONJIKIRI])
+			if(tsc && tsc->getSCE(SC_JYUMONJIKIRI))
 				skillratio += skill_lv * status_get_lv(src);
-			if (sc && sc->data[SC_KAGEMUSYA])
-				skillratio += skillratio * sc->data[SC_KAGEMUSYA]->val2 / 100;
+			if (sc && sc->getSCE(SC_KAGEMUSYA))
+				skillratio += skillratio * sc->getSCE(SC_KAGEMUSYA)->val2 / 100;
 			break;
 		case KO_HUUMARANKA:
 			skillratio += -100 + 150 * skill_lv + sstatus->str + (sd ? pc_checkskill(sd,NJ_HUUMA) * 100 : 0);
 			RE_LVL_DMOD(100);
-			if (sc && sc->data[SC_KAGEMUSYA])
-				skillratio += skillratio * sc->data[SC_KAGEMUSYA]->val2 / 100;
+			if (sc && sc->getSCE(SC_KAGEMUSYA))
+				skillratio += skillratio * sc->getSCE(SC_KAGEMUSYA)->val2 / 100;
 			break;
 		case KO_SETSUDAN:
 			skillratio += 100 * (skill_lv - 1);
@@ -4753,7 +4753,7 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 			if (tsc) {
 				struct status_change_entry *sce;
 
-				if ((sce = tsc->data[SC_SPIRIT]) || (sce = tsc->data[SC_SOULGOLEM]) || (sce = tsc->data[SC_SOULSHADOW]) || (sce = tsc->data[SC_SOULFALCON]) || (sce = tsc->data[SC_SOULFAIRY])) // Bonus damage added when target is soul linked.
+				if ((sce = tsc->getSCE(SC_SPIRIT)) || (sce = tsc->getSCE(SC_SOULGOLEM)) || (sce = tsc->getSCE(SC_SOULSHADOW)) || (sce = tsc->getSCE(SC_SOULFALCON)) || (sce = tsc->getSCE(SC_SOULFAIRY))) // Bonus damage added when target is soul linked.
 					skillratio += 200 * sce->val1;
 			}
 			break;
@@ -4761,8 +4761,8 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 			skillratio += -100 + (sd ? pc_checkskill(sd,NJ_TOBIDOUGU) : 1) * (50 + sstatus->dex / 4) * skill_lv * 4 / 10;
 			RE_LVL_DMOD(120);
 			skillratio += 10 * (sd ? sd->status.job_level : 1);
-			if (sc && sc->data[SC_KAGEMUSYA])
-				skillratio += skillratio * sc->data[SC_KAGEMUSYA]->val2 / 100;
+			if (sc && sc->getSCE(SC_KAGEMUSYA))
+				skillratio += skillratio * sc->getSCE(SC_KAGEMUSYA)->val2 / 100;
 			break;
 		case KO_MAKIBISHI:
 			skillratio += -100 + 20 * skill_lv;
@@ -4876,8 +4876,8 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 		case SJ_FULLMOONKICK:
 			skillratio += 1000 + 100 * skill_lv;
 			RE_LVL_DMOD(100);
-			if (sc && sc->data[SC_LIGHTOFMOON])
-				skillratio += skillratio * sc->data[SC_LIGHTOFMOON]->val2 / 100;
+			if (sc && sc->getSCE(SC_LIGHTOFMOON))
+				skillratio += skillratio * sc->getSCE(SC_LIGHTOFMOON)->val2 / 100;
 			break;
 		case SJ_NEWMOONKICK:
 			skillratio += 600 + 100 * skill_lv;
@@ -4888,8 +4888,8 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 		case SJ_SOLARBURST:
 			skillratio += 900 + 220 * skill_lv;
 			RE_LVL_DMOD(100);
-			if (sc && sc->data[SC_LIGHTOFSUN])
-				skillratio += skillratio * sc->data[SC_LIGHTOFSUN]->val2 / 100;
+			if (sc && sc->getSCE(SC_LIGHTOFSUN))
+				skillratio += skillratio * sc->getSCE(SC_LIGHTOFSUN)->val2 / 100;
 			break;
 		case SJ_PROMINENCEKICK:
 				skillratio += 50 + 50 * skill_lv;
@@ -4898,8 +4898,8 @@ static int battle_calc_attack_skill_ratio(struct Damage* wd, struct block_list *
 		case SJ_FALLINGSTAR_ATK2:
 			skillratio += 100 * skill_lv;
 			RE_LVL_DMOD(100);
-			if (sc && sc->data[SC_LIGHTOFSTAR])
-				skillratio += skillratio * sc->data[SC_LIGHTOFSTAR]->val2 / 100;
+			if (sc && sc->getSCE(SC_LIGHTOFSTAR))
+				skillratio += skillratio * sc->getSCE(SC_LIGHTOFSTAR)->val2 / 100;
 			break;
 	}
 	return skillratio;
@@ -4987,13 +4987,13 @@ static void battle_attack_sc_bonus(struct Damage* wd, struct block_list *src, st
 	//The following are applied on top of current damage and are stackable.
 	if (sc) {
 #ifdef RENEWAL
-		if (sc->data[SC_WATK_ELEMENT] && skill_id != ASC_METEORASSAULT)
-			ATK_ADDRATE(wd->weaponAtk, wd->weaponAtk2, sc->data[SC_WATK_ELEMENT]->val2);
-		if (sc->data[SC_DRUMBATTLE])
-			ATK_ADD(wd->equipAtk, wd->equipAtk2, sc->data[SC_DRUMBATTLE]->val2);
-		if (sc->data[SC_MADNESSCANCEL])
+		if (sc->getSCE(SC_WATK_ELEMENT) && skill_id != ASC_METEORASSAULT)
+			ATK_ADDRATE(wd->weaponAtk, wd->weaponAtk2, sc->getSCE(SC_WATK_ELEMENT)->val2);
+		if (sc->getSCE(SC_DRUMBATTLE))
+			ATK_ADD(wd->equipAtk, wd->equipAtk2, sc->getSCE(SC_DRUMBATTLE)->val2);
+		if (sc->getSCE(SC_MADNESSCANCEL))
 			ATK_ADD(wd->equipAtk, wd->equipAtk2, 100);
-		if (sc->data[SC_MAGICALBULLET]) {
+		if (sc->getSCE(SC_MAGICALBULLET)) {
 			short tmdef = tstatus->mdef + tstatus->mdef2;
 
 			if (sstatus->matk_min > tmdef && sstatus->matk_max > sstatus->matk_min) {
@@ -5002,24 +5002,24 @@ static void battle_attack_sc_bonus(struct Damage* wd, struct block_list *src, st
 				ATK_ADD(wd->weaponAtk, wd->weaponAtk2, i64max(sstatus->matk_min - tmdef, 0));
 			}
 		}
-		if (sc->data[SC_GATLINGFEVER])
-			ATK_ADD(wd->equipAtk, wd->equipAtk2, sc->data[SC_GATLINGFEVER]->val3);
+		if (sc->getSCE(SC_GATLINGFEVER))
+			ATK_ADD(wd->equipAtk, wd->equipAtk2, sc->getSCE(SC_GATLINGFEVER)->val3);
 #else
-		if (sc->data[SC_TRUESIGHT])
-			ATK_ADDRATE(wd->damage, wd->damage2, 2 * sc->data[SC_TRUESIGHT]->val1);
+		if (sc->getSCE(SC_TRUESIGHT))
+			ATK_ADDRATE(wd->damage, wd->damage2, 2 * sc->getSCE(SC_TRUESIGHT)->val1);
 #endif
-		if (sc->data[SC_SPIRIT]) {
-			if (skill_id == AS_SONICBLOW && sc->data[SC_SPIRIT]->val2 == SL_ASSASIN) {
+		if (sc->getSCE(SC_SPIRIT)) {
+			if (skill_id == AS_SONICBLOW && sc->getSCE(SC_SPIRIT)->val2 == SL_ASSASIN) {
 				ATK_ADDRATE(wd->damage, wd->damage2, map_flag_gvg2(src->m) ? 25 : 100); //+25% dmg on woe/+100% dmg on nonwoe
 				RE_ALLATK_ADDRATE(wd, map_flag_gvg2(src->m) ? 25 : 100); //+25% dmg on woe/+100% dmg on nonwoe
-			} else if (skill_id == CR_SHIELDBOOMERANG && sc->data[SC_SPIRIT]->val2 == SL_CRUSADER) {
+			} else if (skill_id == CR_SHIELDBOOMERANG && sc->getSCE(SC_SPIRIT)->val2 == SL_CRUSADER) {
 				ATK_ADDRATE(wd->damage, wd->damage2, 100);
 				RE_ALLATK_ADDRATE(wd, 100);
 			}
 		}
-		if (sc->data[SC_GT_CHANGE])
-			ATK_ADDRATE(wd->damage, wd->damage2, sc->data[SC_GT_CHANGE]->val1);
-		if (sc->data[SC_EDP]) {
+		if (sc->getSCE(SC_GT_CHANGE))
+			ATK_ADDRATE(wd->damage, wd->damage2, sc->getSCE(SC_GT_CHANGE)->val1);
+		if (sc->getSCE(SC_EDP)) {
 			switch(skill_id) {
 				case AS_SPLASHER:
 				case ASC_METEORASSAULT:
@@ -5039,39 +5039,39 @@ static void battle_attack_sc_bonus(struct Damage* wd, struct block_list *src, st
 					// Renewal EDP formula [helvetica]
 					// weapon atk * (1 + (edp level * .8))
 					// equip atk * (1 + (edp level * .6))
-					ATK_RATE(wd->weaponAtk, wd->weaponAtk2, 100 + (sc->data[SC_EDP]->val1 * 80));
-					ATK_RATE(wd->equipAtk, wd->equipAtk2, 100 + (sc->data[SC_EDP]->val1 * 60));
+					ATK_RATE(wd->weaponAtk, wd->weaponAtk2, 100 + (sc->getSCE(SC_EDP)->val1 * 80));
+					ATK_RATE(wd->equipAtk, wd->equipAtk2, 100 + (sc->getSCE(SC_EDP)->val1 * 60));
 					break;
 #else
 				default:
-					ATK_ADDRATE(wd->damage, wd->damage2, sc->data[SC_EDP]->val3);
+					ATK_ADDRATE(wd->damage, wd->damage2, sc->getSCE(SC_EDP)->val3);
 
 #endif
 			}
 		}
-		if (sc->data[SC_DANCEWITHWUG]) {
+		if (sc->getSCE(SC_DANCEWITHWUG)) {
 			if (skill_get_inf2(skill_id, INF2_INCREASEDANCEWITHWUGDAMAGE)) {
-				ATK_ADDRATE(wd->damage, wd->damage2, sc->data[SC_DANCEWITHWUG]->val1 * 10 * battle_calc_chorusbonus(sd));
-				RE_ALLATK_ADDRATE(wd, sc->data[SC_DANCEWITHWUG]->val1 * 10 * battle_calc_chorusbonus(sd));
+				ATK_ADDRATE(wd->damage, wd->damage2, sc->getSCE(SC_DANCEWITHWUG)->val1 * 10 * battle_calc_chorusbonus(sd));
+				RE_ALLATK_ADDRATE(wd, sc->getSCE(SC_DANCEWITHWUG)->val1 * 10 * battle_calc_chorusbonus(sd));
 			}
-			ATK_ADDRATE(wd->damage, wd->damage2, sc->data[SC_DANCEWITHWUG]->val1 * 2 * battle_calc_chorusbonus(sd));
+			ATK_ADDRATE(wd->damage, wd->damage2, sc->getSCE(SC_DANCEWITHWUG)->val1 * 2 * battle_calc_chorusbonus(sd));
 #ifdef RENEWAL
-			ATK_ADDRATE(wd->equipAtk, wd->equipAtk2, sc->data[SC_DANCEWITHWUG]->val1 * 2 * battle_calc_chorusbonus(sd));
+			ATK_ADDRATE(wd->equipAtk, wd->equipAtk2, sc->getSCE(SC_DANCEWITHWUG)->val1 * 2 * battle_calc_chorusbonus(sd));
 #endif
 		}
-		if(sc->data[SC_ZENKAI] && sstatus->rhw.ele == sc->data[SC_ZENKAI]->val2) {
+		if(sc->getSCE(SC_ZENKAI) && sstatus->rhw.ele == sc->getSCE(SC_ZENKAI)->val2) {
 			ATK_ADD(wd->damage, wd->damage2, 200);
 #ifdef RENEWAL
 			ATK_ADD(wd->equipAtk, wd->equipAtk2, 200);
 #endif
 		}
-		if (sc->data[SC_EQC]) {
-			ATK_ADDRATE(wd->damage, wd->damage2, -sc->data[SC_EQC]->val2);
+		if (sc->getSCE(SC_EQC)) {
+			ATK_ADDRATE(wd->damage, wd->damage2, -sc->getSCE(SC_EQC)->val2);
 #ifdef RENEWAL
-			ATK_ADDRATE(wd->equipAtk, wd->equipAtk2, -sc->data[SC_EQC]->val2);
+			ATK_ADDRATE(wd->equipAtk, wd->equipAtk2, -sc->getSCE(SC_EQC)->val2);
 #endif
 		}
-		if(sc->data[SC_STYLE_CHANGE]) {
+		if(sc->getSCE(SC_STYLE_CHANGE)) {
 			TBL_HOM *hd = BL_CAST(BL_HOM,src);
 
 			if(hd) {
@@ -5079,52 +5079,52 @@ static void battle_attack_sc_bonus(struct Damage* wd, struct block_list *src, st
 				RE_ALLATK_ADD(wd, hd->homunculus.spiritball * 3);
 			}
 		}
-		if(sc->data[SC_UNLIMIT] && (wd->flag&(BF_LONG|BF_MAGIC)) == BF_LONG) {
+		if(sc->getSCE(SC_UNLIMIT) && (wd->flag&(BF_LONG|BF_MAGIC)) == BF_LONG) {
 			switch(skill_id) {
 				case RA_WUGDASH:
 				case RA_WUGSTRIKE:
 				case RA_WUGBITE:
 					break;
 				default:
-					ATK_ADDRATE(wd->damage, wd->damage2, sc->data[SC_UNLIMIT]->val2);
-					RE_ALLATK_ADDRATE(wd, sc->data[SC_UNLIMIT]->val2);
+					ATK_ADDRATE(wd->damage, wd->damage2, sc->getSCE(SC_UNLIMIT)->val2);
+					RE_ALLATK_ADDRATE(wd, sc->getSCE(SC_UNLIMIT)->val2);
 					break;
 			}
 		}
-		if (sc->data[SC_HEAT_BARREL]) {
-			ATK_ADDRATE(wd->damage, wd->damage2, sc->data[SC_HEAT_BARREL]->val3);
-			RE_ALLATK_ADDRATE(wd, sc->data[SC_HEAT_BARREL]->val3);
+		if (sc->getSCE(SC_HEAT_BARREL)) {
+			ATK_ADDRATE(wd->damage, wd->damage2, sc->getSCE(SC_HEAT_BARREL)->val3);
+			RE_ALLATK_ADDRATE(wd, sc->getSCE(SC_HEAT_BARREL)->val3);
 		}
 		if((wd->flag&(BF_LONG|BF_MAGIC)) == BF_LONG) {
-			if (sc->data[SC_MTF_RANGEATK]) { // Monster Transformation bonus
-				ATK_ADDRATE(wd->damage, wd->damage2, sc->data[SC_MTF_RANGEATK]->val1);
-				RE_ALLATK_ADDRATE(wd, sc->data[SC_MTF_RANGEATK]->val1);
+			if (sc->getSCE(SC_MTF_RANGEATK)) { // Monster Transformation bonus
+				ATK_ADDRATE(wd->damage, wd->damage2, sc->getSCE(SC_MTF_RANGEATK)->val1);
+				RE_ALLATK_ADDRATE(wd, sc->getSCE(SC_MTF_RANGEATK)->val1);
 			}
-			if (sc->data[SC_MTF_RANGEATK2]) { // Monster Transformation bonus
-				ATK_ADDRATE(wd->damage, wd->damage2, sc->data[SC_MTF_RANGEATK2]->val1);
-				RE_ALLATK_ADDRATE(wd, sc->data[SC_MTF_RANGEATK2]->val1);
+			if (sc->getSCE(SC_MTF_RANGEATK2)) { // Monster Transformation bonus
+				ATK_ADDRATE(wd->damage, wd->damage2, sc->getSCE(SC_MTF_RANGEATK2)->val1);
+				RE_ALLATK_ADDRATE(wd, sc->getSCE(SC_MTF_RANGEATK2)->val1);
 			}
-			if (sc->data[SC_ARCLOUSEDASH] && sc->data[SC_ARCLOUSEDASH]->val4) {
-				ATK_ADDRATE(wd->damage, wd->damage2, sc->data[SC_ARCLOUSEDASH]->val4);
-				RE_ALLATK_ADDRATE(wd, sc->data[SC_ARCLOUSEDASH]->val4);
+			if (sc->getSCE(SC_ARCLOUSEDASH) && sc->getSCE(SC_ARCLOUSEDASH)->val4) {
+				ATK_ADDRATE(wd->damage, wd->damage2, sc->getSCE(SC_ARCLOUSEDASH)->val4);
+				RE_ALLATK_ADDRATE(wd, sc->getSCE(SC_ARCLOUSEDASH)->val4);
 			}
 		}
 
-		if (sd && wd->flag&BF_WEAPON && sc->data[SC_GVG_GIANT] && sc->data[SC_GVG_GIANT]->val3) {
-			ATK_ADDRATE(wd->damage, wd->damage2, sc->data[SC_GVG_GIANT]->val3);
-			RE_ALLATK_ADDRATE(wd, sc->data[SC_GVG_GIANT]->val3);
+		if (sd && wd->flag&BF_WEAPON && sc->getSCE(SC_GVG_GIANT) && sc->getSCE(SC_GVG_GIANT)->val3) {
+			ATK_ADDRATE(wd->damage, wd->damage2, sc->getSCE(SC_GVG_GIANT)->val3);
+			RE_ALLATK_ADDRATE(wd, sc->getSCE(SC_GVG_GIANT)->val3);
 		}
 
-		if (skill_id == 0 && sc->data[SC_EXEEDBREAK]) {
-			ATK_ADDRATE(wd->damage, wd->damage2, sc->data[SC_EXEEDBREAK]->val2);
-			RE_ALLATK_ADDRATE(wd, sc->data[SC_EXEEDBREAK]->val2);
+		if (skill_id == 0 && sc->getSCE(SC_EXEEDBREAK)) {
+			ATK_ADDRATE(wd->damage, wd->damage2, sc->getSCE(SC_EXEEDBREAK)->val2);
+			RE_ALLATK_ADDRATE(wd, sc->getSCE(SC_EXEEDBREAK)->val2);
 		}
-		if (sc->data[SC_PYREXIA] && sc->data[SC_PYREXIA]->val3 == 0) {
-			ATK_ADDRATE(wd->damage, wd->damage2, sc->data[SC_PYREXIA]->val2);
-			RE_ALLATK_ADDRATE(wd, sc->data[SC_PYREXIA]->val2);
+		if (sc->getSCE(SC_PYREXIA) && sc->getSCE(SC_PYREXIA)->val3 == 0) {
+			ATK_ADDRATE(wd->damage, wd->damage2, sc->getSCE(SC_PYREXIA)->val2);
+			RE_ALLATK_ADDRATE(wd, sc->getSCE(SC_PYREXIA)->val2);
 		}
 
-		if (sc->data[SC_MIRACLE])
+		if (sc->getSCE(SC_MIRACLE))
 			anger_id = 2; // Always treat all monsters as star flagged monster when in miracle state
 	}
 
@@ -5191,8 +5191,8 @@ static void battle_calc_defense_reduction(struct Damage* wd, struct block_list *
 		}
 	}
 
-	if (sc && sc->data[SC_EXPIATIO]) {
-		short i = 5 * sc->data[SC_EXPIATIO]->val1; // 5% per level
+	if (sc && sc->getSCE(SC_EXPIATIO)) {
+		short i = 5 * sc->getSCE(SC_EXPIATIO)->val1; // 5% per level
 
 		i = min(i,100); //cap it to 100 for 0 def min
 		def1 = (def1*(100-i))/100;
@@ -5200,25 +5200,25 @@ static void battle_calc_defense_reduction(struct Damage* wd, struct block_list *
 	}
 
 	if (tsc) {
-		if (tsc->data[SC_FORCEOFVANGUARD]) {
-			short i = 2 * tsc->data[SC_FORCEOFVANGUARD]->val1;
+		if (tsc->getSCE(SC_FORCEOFVANGUARD)) {
+			short i = 2 * tsc->getSCE(SC_FORCEOFVANGUARD)->val1;
 
 			def1 = (def1 * (100 + i)) / 100;
 		}
 
-		if( tsc->data[SC_CAMOUFLAGE] ){
-			short i = 5 * tsc->data[SC_CAMOUFLAGE]->val3; //5% per second
+		if( tsc->getSCE(SC_CAMOUFLAGE) ){
+			short i = 5 * tsc->getSCE(SC_CAMOUFLAGE)->val3; //5% per second
 
 			i = min(i,100); //cap it to 100 for 0 def min
 			def1 = (def1*(100-i))/100;
 			def2 = (def2*(100-i))/100;
 		}
 
-		if (tsc->data[SC_GT_REVITALIZE])
-			def1 += tsc->data[SC_GT_REVITALIZE]->val4;
+		if (tsc->getSCE(SC_GT_REVITALIZE))
+			def1 += tsc->getSCE(SC_GT_REVITALIZE)->val4;
 
-		if (tsc->data[SC_OVERED_BOOST] && target->type == BL_PC)
-			def1 = (def1 * tsc->data[SC_OVERED_BOOST]->val4) / 100;
+		if (tsc->getSCE(SC_OVERED_BOOST) && target->type == BL_PC)
+			def1 = (def1 * tsc->getSCE(SC_OVERED_BOOST)->val4) / 100;
 	}
 
 	if( battle_config.vit_penalty_type && battle_config.vit_penalty_target&target->type ) {
@@ -5228,11 +5228,11 @@ static void battle_calc_defense_reduction(struct Damage* wd, struct block_list *
 		target_count = min(unit_counttargeted(target), (100 / battle_config.vit_penalty_num) + (battle_config.vit_penalty_count - 1));
 		if(target_count >= battle_config.vit_penalty_count) {
 			if(battle_config.vit_penalty_type == 1) {
-				if( !tsc || !tsc->data[SC_STEELBODY] )
+				if( !tsc || !tsc->getSCE(SC_STEELBODY) )
 					def1 = (def1 * (100 - (target_count - (battle_config.vit_penalty_count - 1))*battle_config.vit_penalty_num))/100;
 				def2 = (def2 * (100 - (target_count - (battle_config.vit_penalty_count - 1))*battle_config.vit_penalty_num))/100;
 			} else { //Assume type 2
-				if( !tsc || !tsc->data[SC_STEELBODY] )
+				if( !tsc || !tsc->getSCE(SC_STEELBODY) )
 					def1 -= (target_count - (battle_config.vit_penalty_count - 1))*battle_config.vit_penalty_num;
 				def2 -= (target_count - (battle_config.vit_penalty_count - 1))*battle_config.vit_penalty_num;
 			}
@@ -5270,7 +5270,7 @@ static void battle_calc_defense_reduction(struct Damage* wd, struct block_list *
 #ifndef RENEWAL
 		//VIT + rnd(0,[VIT/20]^2-1)
 		vit_def = (def2/20)*(def2/20);
-		if (tsc && tsc->data[SC_SKA])
+		if (tsc && tsc->getSCE(SC_SKA))
 			vit_def += 100; //Eska increases the random part of the formula by 100
 		vit_def = def2 + (vit_def>0?rnd()%vit_def:0);
 #else
@@ -5330,15 +5330,15 @@ static void battle_calc_attack_post_defense(struct Damage* wd, struct block_list
 
 	// Post skill/vit reduction damage increases
 	if( sc ) { // SC skill damages
-		if(sc->data[SC_AURABLADE]
+		if(sc->getSCE(SC_AURABLADE)
 #ifndef RENEWAL
 				&& skill_id != LK_SPIRALPIERCE && skill_id != ML_SPIRALPIERCE
 #endif
 		) {
 #ifdef RENEWAL
-			ATK_ADD(wd->damage, wd->damage2, (3 + sc->data[SC_AURABLADE]->val1) * status_get_lv(src)); // !TODO: Confirm formula
+			ATK_ADD(wd->damage, wd->damage2, (3 + sc->getSCE(SC_AURABLADE)->val1) * status_get_lv(src)); // !TODO: Confirm formula
 #else
-			ATK_ADD(wd->damage, wd->damage2, 20 * sc->data[SC_AURABLADE]->val1);
+			ATK_ADD(wd->damage, wd->damage2, 20 * sc->getSCE(SC_AURABLADE)->val1);
 #endif
 		}
 	}
@@ -5500,8 +5500,8 @@ struct block_list *battle_check_devotion(struct block_list *bl) {
 
 	if (battle_config.devotion_rdamage && battle_config.devotion_rdamage > rnd() % 100) {
 		struct status_change *sc = status_get_sc(bl);
-		if (sc && sc->data[SC_DEVOTION])
-			d_bl = map_id2bl(sc->data[SC_DEVOTION]->val1);
+		if (sc && sc->getSCE(SC_DEVOTION))
+			d_bl = map_id2bl(sc->getSCE(SC_DEVOTION)->val1);
 	}
 	return d_bl;
 }
@@ -5587,32 +5587,32 @@ static void battle_calc_weapon_final_atk_modifiers(struct Damage* wd, struct blo
 	int skill_damage = 0;
 
 	//Reject Sword bugreport:4493 by Daegaladh
-	if(wd->damage && tsc && tsc->data[SC_REJECTSWORD] &&
+	if(wd->damage && tsc && tsc->getSCE(SC_REJECTSWORD) &&
 		(src->type!=BL_PC || (
 			((TBL_PC *)src)->weapontype1 == W_DAGGER ||
 			((TBL_PC *)src)->weapontype1 == W_1HSWORD ||
 			((TBL_PC *)src)->status.weapon == W_2HSWORD
 		)) &&
-		rnd()%100 < tsc->data[SC_REJECTSWORD]->val2
+		rnd()%100 < tsc->getSCE(SC_REJECTSWORD)->val2
 		)
 	{
 		ATK_RATER(wd->damage, 50)
 		status_fix_damage(target,src,wd->damage,clif_damage(target,src,gettick(),0,0,wd->damage,0,DMG_NORMAL,0,false),ST_REJECTSWORD);
-		clif_skill_nodamage(target,target,ST_REJECTSWORD,tsc->data[SC_REJECTSWORD]->val1,1);
-		if( --(tsc->data[SC_REJECTSWORD]->val3) <= 0 )
+		clif_skill_nodamage(target,target,ST_REJECTSWORD,tsc->getSCE(SC_REJECTSWORD)->val1,1);
+		if( --(tsc->getSCE(SC_REJECTSWORD)->val3) <= 0 )
 			status_change_end(target, SC_REJECTSWORD, INVALID_TIMER);
 	}
 
-	if( tsc && tsc->data[SC_CRESCENTELBOW] && wd->flag&BF_SHORT && rnd()%100 < tsc->data[SC_CRESCENTELBOW]->val2 ) {
+	if( tsc && tsc->getSCE(SC_CRESCENTELBOW) && wd->flag&BF_SHORT && rnd()%100 < tsc->getSCE(SC_CRESCENTELBOW)->val2 ) {
 		//ATK [{(Target HP / 100) x Skill Level} x Caster Base Level / 125] % + [Received damage x {1 + (Skill Level x 0.2)}]
 		int64 rdamage = 0;
-		int ratio = (int64)(status_get_hp(src) / 100) * tsc->data[SC_CRESCENTELBOW]->val1 * status_get_lv(target) / 125;
+		int ratio = (int64)(status_get_hp(src) / 100) * tsc->getSCE(SC_CRESCENTELBOW)->val1 * status_get_lv(target) / 125;
 		if (ratio > 5000) ratio = 5000; // Maximum of 5000% ATK
 		rdamage = battle_calc_base_damage(target,tstatus,&tstatus->rhw,tsc,sstatus->size,0);
-		rdamage = (int64)rdamage * ratio / 100 + wd->damage * (10 + tsc->data[SC_CRESCENTELBOW]->val1 * 20 / 10) / 10;
-		skill_blown(target, src, skill_get_blewcount(SR_CRESCENTELBOW_AUTOSPELL, tsc->data[SC_CRESCENTELBOW]->val1), unit_getdir(src), BLOWN_NONE);
+		rdamage = (int64)rdamage * ratio / 100 + wd->damage * (10 + tsc->getSCE(SC_CRESCENTELBOW)->val1 * 20 / 10) / 10;
+		skill_blown(target, src, skill_get_blewcount(SR_CRESCENTELBOW_AUTOSPELL, tsc->getSCE(SC_CRESCENTELBOW)->val1), unit_getdir(src), BLOWN_NONE);
 		clif_skill_damage(target, src, gettick(), status_get_amotion(src), 0, rdamage,
-			1, SR_CRESCENTELBOW_AUTOSPELL, tsc->data[SC_CRESCENTELBOW]->val1, DMG_SINGLE); // This is how official does
+			1, SR_CRESCENTELBOW_AUTOSPELL, tsc->getSCE(SC_CRESCENTELBOW)->val1, DMG_SINGLE); // This is how official does
 		clif_damage(src, target, gettick(), status_get_amotion(src)+1000, 0, rdamage/10, 1, DMG_NORMAL, 0, false);
 		status_damage(target, src, rdamage, 0, 0, 0, 0);
 		status_damage(src, target, rdamage/10, 0, 0, 1, 0);
@@ -5621,7 +5621,7 @@ static void battle_calc_weapon_final_atk_modifiers(struct Damage* wd, struct blo
 
 	if( sc ) {
 		//SC_FUSION hp penalty [Komurka]
-		if (sc->data[SC_FUSION]) {
+		if (sc->getSCE(SC_FUSION)) {
 			unsigned int hp = sstatus->max_hp;
 
 			if (sd && tsd) {
@@ -5634,9 +5634,9 @@ static void battle_calc_weapon_final_atk_modifiers(struct Damage* wd, struct blo
 		}
 		// Only affecting non-skills
 		if (!skill_id && wd->dmg_lv > ATK_BLOCK) {
-			if (sc->data[SC_ENCHANTBLADE]) {
+			if (sc->getSCE(SC_ENCHANTBLADE)) {
 				//[((Skill Lv x 20) + 100) x (casterBaseLevel / 150)] + casterInt + MATK - MDEF - MDEF2
-				int64 enchant_dmg = sc->data[SC_ENCHANTBLADE]->val2;
+				int64 enchant_dmg = sc->getSCE(SC_ENCHANTBLADE)->val2;
 				if (sstatus->matk_max > sstatus->matk_min)
 					enchant_dmg = enchant_dmg + sstatus->matk_min + rnd() % (sstatus->matk_max - sstatus->matk_min);
 				else
@@ -5775,7 +5775,7 @@ static struct Damage initialize_weapon_data(struct block_list *src, struct block
 	} else {
 		bool is_long = false;
 
-		if (is_skill_using_arrow(src, skill_id) || (sc && sc->data[SC_SOULATTACK]))
+		if (is_skill_using_arrow(src, skill_id) || (sc && sc->getSCE(SC_SOULATTACK)))
 			is_long = true;
 		wd.flag |= is_long ? BF_LONG : BF_SHORT;
 	}
@@ -5815,14 +5815,14 @@ void battle_do_reflect(int attack_type, struct Damage *wd, struct block_list* sr
 			struct block_list *d_bl = battle_check_devotion(src);
 			status_change *sc = status_get_sc(src);
 
-			if (sc && sc->data[SC_VITALITYACTIVATION])
+			if (sc && sc->getSCE(SC_VITALITYACTIVATION))
 				rdamage /= 2;
-			if (tsc->data[SC_MAXPAIN]) {
-				tsc->data[SC_MAXPAIN]->val2 = (int)rdamage;
-				skill_castend_damage_id(target, src, NPC_MAXPAIN_ATK, tsc->data[SC_MAXPAIN]->val1, tick, wd->flag);
-				tsc->data[SC_MAXPAIN]->val2 = 0;
+			if (tsc->getSCE(SC_MAXPAIN)) {
+				tsc->getSCE(SC_MAXPAIN)->val2 = (int)rdamage;
+				skill_castend_damage_id(target, src, NPC_MAXPAIN_ATK, tsc->getSCE(SC_MAXPAIN)->val1, tick, wd->flag);
+				tsc->getSCE(SC_MAXPAIN)->val2 = 0;
 			}
-			else if( attack_type == BF_WEAPON && tsc->data[SC_REFLECTDAMAGE] ) // Don't reflect your own damage (Grand Cross)
+			else if( attack_type == BF_WEAPON && tsc->getSCE(SC_REFLECTDAMAGE) ) // Don't reflect your own damage (Grand Cross)
 				map_foreachinshootrange(battle_damage_area,target,skill_get_splash(LG_REFLECTDAMAGE,1),BL_CHAR,tick,target,wd->amotion,sstatus->dmotion,rdamage,wd->flag);
 			else if( attack_type == BF_WEAPON || attack_type == BF_MISC) {
 				rdelay = clif_damage(src, (!d_bl) ? src : d_bl, tick, wd->amotion, sstatus->dmotion, rdamage, 1, DMG_ENDURE, 0, false);
@@ -6043,7 +6043,7 @@ static struct Damage battle_calc_weapon_attack(struct block_list *src, struct bl
 			double bonus = 1 + skill_lv * 2 / 10;
 
 			ATK_ADD(wd.damage, wd.damage2, sstatus->max_hp - sstatus->hp);
-			if(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == SR_FALLENEMPIRE) {
+			if(sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == SR_FALLENEMPIRE) {
 				ATK_ADD(wd.damage, wd.damage2, static_cast<int64>(sstatus->max_sp * bonus) + 40 * status_get_lv(src));
 			} else
 				ATK_ADD(wd.damage, wd.damage2, static_cast<int64>(sstatus->sp * bonus) + 10 * status_get_lv(src));
@@ -6232,14 +6232,14 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 			if (sd && (sd->weapontype1 == W_STAFF || sd->weapontype1 == W_2HSTAFF || sd->weapontype1 == W_BOOK))
 				ad.div_ = 2;
 			if( sc && sc->count ) {
-				if( sc->data[SC_HEATER_OPTION] )
-					s_ele = sc->data[SC_HEATER_OPTION]->val3;
-				else if( sc->data[SC_COOLER_OPTION] )
-					s_ele = sc->data[SC_COOLER_OPTION]->val3;
-				else if( sc->data[SC_BLAST_OPTION] )
-					s_ele = sc->data[SC_BLAST_OPTION]->val3;
-				else if( sc->data[SC_CURSED_SOIL_OPTION] )
-					s_ele = sc->data[SC_CURSED_SOIL_OPTION]->val3;
+				if( sc->getSCE(SC_HEATER_OPTION) )
+					s_ele = sc->getSCE(SC_HEATER_OPTION)->val3;
+				else if( sc->getSCE(SC_COOLER_OPTION) )
+					s_ele = sc->getSCE(SC_COOLER_OPTION)->val3;
+				else if( sc->getSCE(SC_BLAST_OPTION) )
+					s_ele = sc->getSCE(SC_BLAST_OPTION)->val3;
+				else if( sc->getSCE(SC_CURSED_SOIL_OPTION) )
+					s_ele = sc->getSCE(SC_CURSED_SOIL_OPTION)->val3;
 			}
 			break;
 		case KO_KAIHOU:
@@ -6247,11 +6247,11 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 				s_ele = sd->spiritcharm_type;
 			break;
 		case AB_ADORAMUS:
-			if (sc && sc->data[SC_ANCILLA])
+			if (sc && sc->getSCE(SC_ANCILLA))
 				s_ele = ELE_NEUTRAL;
 			break;
 		case LG_RAYOFGENESIS:
-			if (sc && sc->data[SC_INSPIRATION])
+			if (sc && sc->getSCE(SC_INSPIRATION))
 				s_ele = ELE_NEUTRAL;
 			break;
 	}
@@ -6399,8 +6399,8 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 					case MG_FIREBOLT:
 					case MG_COLDBOLT:
 					case MG_LIGHTNINGBOLT:
-						if (sc && sc->data[SC_SPELLFIST] && mflag&BF_SHORT)  {
-							skillratio += (sc->data[SC_SPELLFIST]->val3 * 100) + (sc->data[SC_SPELLFIST]->val1 * 50 - 50) - 100; // val3 = used bolt level, val1 = used spellfist level. [Rytech]
+						if (sc && sc->getSCE(SC_SPELLFIST) && mflag&BF_SHORT)  {
+							skillratio += (sc->getSCE(SC_SPELLFIST)->val3 * 100) + (sc->getSCE(SC_SPELLFIST)->val1 * 50 - 50) - 100; // val3 = used bolt level, val1 = used spellfist level. [Rytech]
 							ad.div_ = 1; // ad mods, to make it work similar to regular hits [Xazax]
 							ad.flag = BF_WEAPON|BF_SHORT;
 							ad.type = DMG_NORMAL;
@@ -6417,7 +6417,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 						break;
 					case AL_HOLYLIGHT:
 						skillratio += 25;
-						if (sd && sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_PRIEST)
+						if (sd && sd->sc.getSCE(SC_SPIRIT) && sd->sc.getSCE(SC_SPIRIT)->val2 == SL_PRIEST)
 							skillratio *= 5; //Does 5x damage include bonuses from other skills?
 						break;
 					case AL_RUWACH:
@@ -6485,7 +6485,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 					case NJ_HYOUSENSOU:
 #ifdef RENEWAL
 						skillratio -= 30;
-						if (sc && sc->data[SC_SUITON])
+						if (sc && sc->getSCE(SC_SUITON))
 							skillratio += 2 * skill_lv;
 #endif
 						if(sd && sd->spiritcharm_type == CHARM_TYPE_WATER && sd->spiritcharm > 0)
@@ -6575,7 +6575,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 						RE_LVL_DMOD(100);
 						break;
 					case NPC_JACKFROST:
-						if (tsc && tsc->data[SC_FREEZING]) {
+						if (tsc && tsc->getSCE(SC_FREEZING)) {
 							skillratio += 900 + 300 * skill_lv;
 							RE_LVL_DMOD(100);
 						} else {
@@ -6584,7 +6584,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 						}
 						break;
 					case WL_JACKFROST:
-						if (tsc && tsc->data[SC_MISTY_FROST])
+						if (tsc && tsc->getSCE(SC_MISTY_FROST))
 							skillratio += -100 + 1200 + 600 * skill_lv;
 						else
 							skillratio += -100 + 1000 + 300 * skill_lv;
@@ -6633,13 +6633,13 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 						break;
 					case LG_RAYOFGENESIS:
 						skillratio += -100 + 230 * skill_lv + sstatus->int_ / 6; // !TODO: What's the INT bonus?
-						if (sc && sc->data[SC_INSPIRATION])
+						if (sc && sc->getSCE(SC_INSPIRATION))
 							skillratio += 70 * skill_lv;
 						RE_LVL_DMOD(100);
 						break;
 					case WM_METALICSOUND:
 						skillratio += -100 + 120 * skill_lv + 60 * ((sd) ? pc_checkskill(sd, WM_LESSON) : 1);
-						if (tsc && tsc->data[SC_SLEEP])
+						if (tsc && tsc->getSCE(SC_SLEEP))
 							skillratio += 100; // !TODO: Confirm target sleeping bonus
 						RE_LVL_DMOD(100);
 						break;
@@ -6651,13 +6651,13 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 					case SO_FIREWALK:
 						skillratio += -100 + 60 * skill_lv;
 						RE_LVL_DMOD(100);
-						if( sc && sc->data[SC_HEATER_OPTION] )
+						if( sc && sc->getSCE(SC_HEATER_OPTION) )
 							skillratio += (sd ? sd->status.job_level / 2 : 0);
 						break;
 					case SO_ELECTRICWALK:
 						skillratio += -100 + 60 * skill_lv;
 						RE_LVL_DMOD(100);
-						if( sc && sc->data[SC_BLAST_OPTION] )
+						if( sc && sc->getSCE(SC_BLAST_OPTION) )
 							skillratio += (sd ? sd->status.job_level / 2 : 0);
 						break;
 					case NPC_FIREWALK:
@@ -6667,21 +6667,21 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 					case SO_EARTHGRAVE: // !TODO: Confirm formula
 						skillratio += -100 + sstatus->int_ / 6 * skill_lv + ((sd) ? pc_checkskill(sd, SA_SEISMICWEAPON) * 200 : 0);
 						RE_LVL_DMOD(100);
-						if( sc && sc->data[SC_CURSED_SOIL_OPTION] )
+						if( sc && sc->getSCE(SC_CURSED_SOIL_OPTION) )
 							skillratio += (sd ? sd->status.job_level * 5 : 0);
 						break;
 					case SO_DIAMONDDUST: // !TODO: Confirm formula
 						skillratio += -100 + 200 * ((sd) ? pc_checkskill(sd, SA_FROSTWEAPON) : 0) + sstatus->int_ / 6 * skill_lv;
 						RE_LVL_DMOD(100);
-						if( sc && sc->data[SC_COOLER_OPTION] )
+						if( sc && sc->getSCE(SC_COOLER_OPTION) )
 							skillratio += (sd ? sd->status.job_level * 5 : 0);
 						break;
 					case SO_POISON_BUSTER:
 						skillratio += -100 + 1000 + 300 * skill_lv + sstatus->int_ / 6; // !TODO: Confirm INT bonus
-						if( tsc && tsc->data[SC_CLOUD_POISON] )
+						if( tsc && tsc->getSCE(SC_CLOUD_POISON) )
 							skillratio += 200 * skill_lv;
 						RE_LVL_DMOD(100);
-						if( sc && sc->data[SC_CURSED_SOIL_OPTION] )
+						if( sc && sc->getSCE(SC_CURSED_SOIL_OPTION) )
 							skillratio += (sd ? sd->status.job_level * 5 : 0);
 						break;
 					case NPC_POISON_BUSTER:
@@ -6690,14 +6690,14 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 					case SO_PSYCHIC_WAVE:
 						skillratio += -100 + 70 * skill_lv + 3 * sstatus->int_;
 						RE_LVL_DMOD(100);
-						if (sc && (sc->data[SC_HEATER_OPTION] || sc->data[SC_COOLER_OPTION] ||
-							sc->data[SC_BLAST_OPTION] || sc->data[SC_CURSED_SOIL_OPTION]))
+						if (sc && (sc->getSCE(SC_HEATER_OPTION) || sc->getSCE(SC_COOLER_OPTION) ||
+							sc->getSCE(SC_BLAST_OPTION) || sc->getSCE(SC_CURSED_SOIL_OPTION)))
 							skillratio += 20;
 						break;
 					case SO_CLOUD_KILL:
 						skillratio += -100 + 40 * skill_lv;
 						RE_LVL_DMOD(100);
-						if (sc && sc->data[SC_CURSED_SOIL_OPTION])
+						if (sc && sc->getSCE(SC_CURSED_SOIL_OPTION))
 							skillratio += (sd ? sd->status.job_level : 0);
 						break;
 					case NPC_CLOUD_KILL:
@@ -6706,7 +6706,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 					case SO_VARETYR_SPEAR: //MATK [{( Endow Tornado skill level x 50 ) + ( Caster INT x Varetyr Spear Skill level )} x Caster Base Level / 100 ] %
 						skillratio += -100 + sstatus->int_ / 6 * skill_lv + ((sd) ? pc_checkskill(sd, SA_LIGHTNINGLOADER) * 50 : 0); // !TODO: Confirm new formula
 						RE_LVL_DMOD(100);
-						if (sc && sc->data[SC_BLAST_OPTION])
+						if (sc && sc->getSCE(SC_BLAST_OPTION))
 							skillratio += (sd ? sd->status.job_level * 5 : 0);
 						break;
 					case GN_DEMONIC_FIRE:
@@ -6772,7 +6772,7 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 						skillratio += 900;
 						break;
 					case SP_CURSEEXPLOSION:
-						if (tsc && tsc->data[SC_SOULCURSE])
+						if (tsc && tsc->getSCE(SC_SOULCURSE))
 							skillratio += 1400 + 200 * skill_lv;
 						else
 							skillratio += 300 + 100 * skill_lv;
@@ -6791,10 +6791,10 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 				}
 
 				if (sc) {// Insignia's increases the damage of offensive magic by a fixed percentage depending on the element.
-					if ((sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 3 && s_ele == ELE_FIRE) ||
-						(sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 3 && s_ele == ELE_WATER) ||
-						(sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 3 && s_ele == ELE_WIND) ||
-						(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 3 && s_ele == ELE_EARTH))
+					if ((sc->getSCE(SC_FIRE_INSIGNIA) && sc->getSCE(SC_FIRE_INSIGNIA)->val1 == 3 && s_ele == ELE_FIRE) ||
+						(sc->getSCE(SC_WATER_INSIGNIA) && sc->getSCE(SC_WATER_INSIGNIA)->val1 == 3 && s_ele == ELE_WATER) ||
+						(sc->getSCE(SC_WIND_INSIGNIA) && sc->getSCE(SC_WIND_INSIGNIA)->val1 == 3 && s_ele == ELE_WIND) ||
+						(sc->getSCE(SC_EARTH_INSIGNIA) && sc->getSCE(SC_EARTH_INSIGNIA)->val1 == 3 && s_ele == ELE_EARTH))
 						skillratio += 25;
 				}
 
@@ -6831,8 +6831,8 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 			defType mdef = tstatus->mdef;
 			int mdef2= tstatus->mdef2;
 
-			if (sc && sc->data[SC_EXPIATIO]) {
-				i = 5 * sc->data[SC_EXPIATIO]->val1; // 5% per level
+			if (sc && sc->getSCE(SC_EXPIATIO)) {
+				i = 5 * sc->getSCE(SC_EXPIATIO)->val1; // 5% per level
 
 				i = min(i, 100); //cap it to 100 for 5 mdef min
 				mdef -= mdef * i / 100;
@@ -6876,22 +6876,22 @@ struct Damage battle_calc_magic_attack(struct block_list *src,struct block_list
 			switch(skill_id) {
 				case MG_LIGHTNINGBOLT:
 				case MG_THUNDERSTORM:
-					if(sc->data[SC_GUST_OPTION])
+					if(sc->getSCE(SC_GUST_OPTION))
 						ad.damage += (6 + sstatus->int_ / 4) + max(sstatus->dex - 10, 0) / 30;
 					break;
 				case MG_FIREBOLT:
 				case MG_FIREWALL:
-					if(sc->data[SC_PYROTECHNIC_OPTION])
+					if(sc->getSCE(SC_PYROTECHNIC_OPTION))
 						ad.damage += (6 + sstatus->int_ / 4) + max(sstatus->dex - 10, 0) / 30;
 					break;
 				case MG_COLDBOLT:
 				case MG_FROSTDIVER:
-					if(sc->data[SC_AQUAPLAY_OPTION])
+					if(sc->getSCE(SC_AQUAPLAY_OPTION))
 						ad.damage += (6 + sstatus->int_ / 4) + max(sstatus->dex - 10, 0) / 30;
 					break;
 				case WZ_EARTHSPIKE:
 				case WZ_HEAVENDRIVE:
-					if(sc->data[SC_PETROLOGY_OPTION])
+					if(sc->getSCE(SC_PETROLOGY_OPTION))
 						ad.damage += (6 + sstatus->int_ / 4) + max(sstatus->dex - 10, 0) / 30;
 					break;
 			}
@@ -7149,7 +7149,7 @@ struct Damage battle_calc_misc_attack(struct block_list *src,struct block_list *
 
 				md.damage = (int64)sstatus->hp + (atk.damage * (int64)sstatus->hp * skill_lv) / (int64)sstatus->max_hp;
 
-				if (sc && sc->data[SC_BUNSINJYUTSU] && (i = sc->data[SC_BUNSINJYUTSU]->val2) > 0) { // mirror image bonus only occurs if active
+				if (sc && sc->getSCE(SC_BUNSINJYUTSU) && (i = sc->getSCE(SC_BUNSINJYUTSU)->val2) > 0) { // mirror image bonus only occurs if active
 					md.div_ = -(i + 2); // mirror image count + 2
 					md.damage += (md.damage * (((i + 1) * 10) / 5)) / 10;
 				}
@@ -7196,8 +7196,8 @@ struct Damage battle_calc_misc_attack(struct block_list *src,struct block_list *
 				md.damage /= 10;
 			break;
 		case NPC_MAXPAIN_ATK:
-			if (ssc && ssc->data[SC_MAXPAIN])
-				md.damage = ssc->data[SC_MAXPAIN]->val2;
+			if (ssc && ssc->getSCE(SC_MAXPAIN))
+				md.damage = ssc->getSCE(SC_MAXPAIN)->val2;
 			else
 				md.damage = 0;
 			break;
@@ -7427,12 +7427,12 @@ int64 battle_calc_return_damage(struct block_list* bl, struct block_list *src, i
 	ssc = status_get_sc(src);
 
 	if (sc) { // These statuses do not reflect any damage (off the target)
-		if (sc->data[SC_WHITEIMPRISON] || sc->data[SC_DARKCROW] || sc->data[SC_KYOMU])
+		if (sc->getSCE(SC_WHITEIMPRISON) || sc->getSCE(SC_DARKCROW) || sc->getSCE(SC_KYOMU))
 			return 0;
 	}
 
 	if (ssc) {
-		if (ssc->data[SC_HELLS_PLANT])
+		if (ssc->getSCE(SC_HELLS_PLANT))
 			return 0;
 	}
 
@@ -7441,35 +7441,35 @@ int64 battle_calc_return_damage(struct block_list* bl, struct block_list *src, i
 			rdamage += damage * sd->bonus.short_weapon_damage_return / 100;
 			rdamage = i64max(rdamage, 1);
 		} else if( status_reflect && sc && sc->count ) {
-			if( sc->data[SC_REFLECTSHIELD] ) {
+			if( sc->getSCE(SC_REFLECTSHIELD) ) {
 				struct status_change_entry *sce_d;
 				struct block_list *d_bl = NULL;
 
-				if( (sce_d = sc->data[SC_DEVOTION]) && (d_bl = map_id2bl(sce_d->val1)) &&
+				if( (sce_d = sc->getSCE(SC_DEVOTION)) && (d_bl = map_id2bl(sce_d->val1)) &&
 					((d_bl->type == BL_MER && ((TBL_MER*)d_bl)->master && ((TBL_MER*)d_bl)->master->bl.id == bl->id) ||
 					(d_bl->type == BL_PC && ((TBL_PC*)d_bl)->devotion[sce_d->val2] == bl->id)) )
 				{ //Don't reflect non-skill attack if has SC_REFLECTSHIELD from Devotion bonus inheritance
-					if( (!skill_id && battle_config.devotion_rdamage_skill_only && sc->data[SC_REFLECTSHIELD]->val4) ||
+					if( (!skill_id && battle_config.devotion_rdamage_skill_only && sc->getSCE(SC_REFLECTSHIELD)->val4) ||
 						!check_distance_bl(bl,d_bl,sce_d->val3) )
 						return 0;
 				}
 			}
-			if ( sc->data[SC_REFLECTSHIELD] && skill_id != WS_CARTTERMINATION ) {
+			if ( sc->getSCE(SC_REFLECTSHIELD) && skill_id != WS_CARTTERMINATION ) {
 				// Don't reflect non-skill attack if has SC_REFLECTSHIELD from Devotion bonus inheritance
-				if (!skill_id && battle_config.devotion_rdamage_skill_only && sc->data[SC_REFLECTSHIELD]->val4)
+				if (!skill_id && battle_config.devotion_rdamage_skill_only && sc->getSCE(SC_REFLECTSHIELD)->val4)
 					rdamage = 0;
 				else {
-					rdamage += damage * sc->data[SC_REFLECTSHIELD]->val2 / 100;
+					rdamage += damage * sc->getSCE(SC_REFLECTSHIELD)->val2 / 100;
 					rdamage = i64max(rdamage, 1);
 				}
 			}
 
-			if (sc->data[SC_DEATHBOUND] && skill_id != WS_CARTTERMINATION && skill_id != GN_HELLS_PLANT_ATK && !status_bl_has_mode(src,MD_STATUSIMMUNE)) {
+			if (sc->getSCE(SC_DEATHBOUND) && skill_id != WS_CARTTERMINATION && skill_id != GN_HELLS_PLANT_ATK && !status_bl_has_mode(src,MD_STATUSIMMUNE)) {
 				if (distance_bl(src,bl) <= 0 || !map_check_dir(map_calc_dir(bl,src->x,src->y), unit_getdir(bl))) {
-					int64 rd1 = min(damage, status_get_max_hp(bl)) * sc->data[SC_DEATHBOUND]->val2 / 100; // Amplify damage.
+					int64 rd1 = min(damage, status_get_max_hp(bl)) * sc->getSCE(SC_DEATHBOUND)->val2 / 100; // Amplify damage.
 
 					*dmg = rd1 * 30 / 100; // Received damage = 30% of amplified damage.
-					clif_skill_damage(src, bl, gettick(), status_get_amotion(src), 0, -30000, 1, RK_DEATHBOUND, sc->data[SC_DEATHBOUND]->val1, DMG_SINGLE);
+					clif_skill_damage(src, bl, gettick(), status_get_amotion(src), 0, -30000, 1, RK_DEATHBOUND, sc->getSCE(SC_DEATHBOUND)->val1, DMG_SINGLE);
 					skill_blown(bl, src, skill_get_blewcount(RK_DEATHBOUND, 1), unit_getdir(src), BLOWN_NONE);
 					status_change_end(bl, SC_DEATHBOUND, INVALID_TIMER);
 					rdamage += rd1 * 70 / 100; // Target receives 70% of the amplified damage. [Rytech]
@@ -7492,21 +7492,21 @@ int64 battle_calc_return_damage(struct block_list* bl, struct block_list *src, i
 	}
 
 	if (ssc) {
-		if (ssc->data[SC_REFLECTDAMAGE]) {
-			rdamage -= damage * ssc->data[SC_REFLECTDAMAGE]->val2 / 100;
-			if (--(ssc->data[SC_REFLECTDAMAGE]->val3) < 1) // TODO: Confirm if reflect count still exists
+		if (ssc->getSCE(SC_REFLECTDAMAGE)) {
+			rdamage -= damage * ssc->getSCE(SC_REFLECTDAMAGE)->val2 / 100;
+			if (--(ssc->getSCE(SC_REFLECTDAMAGE)->val3) < 1) // TODO: Confirm if reflect count still exists
 				status_change_end(bl, SC_REFLECTDAMAGE, INVALID_TIMER);
 		}
-		if (ssc->data[SC_VENOMBLEED] && ssc->data[SC_VENOMBLEED]->val3 == 0)
-			rdamage -= damage * ssc->data[SC_VENOMBLEED]->val2 / 100;
+		if (ssc->getSCE(SC_VENOMBLEED) && ssc->getSCE(SC_VENOMBLEED)->val3 == 0)
+			rdamage -= damage * ssc->getSCE(SC_VENOMBLEED)->val2 / 100;
 
-		if (rdamage > 0 && ssc->data[SC_REF_T_POTION])
+		if (rdamage > 0 && ssc->getSCE(SC_REF_T_POTION))
 			return 1; // Returns 1 damage
 	}
 
 	if (sc) {
-		if (sc->data[SC_MAXPAIN])
-			rdamage = damage * sc->data[SC_MAXPAIN]->val1 * 10 / 100;
+		if (sc->getSCE(SC_MAXPAIN))
+			rdamage = damage * sc->getSCE(SC_MAXPAIN)->val1 * 10 / 100;
 	}
 
 	return cap_value(min(rdamage,max_damage),INT_MIN,INT_MAX);
@@ -7733,20 +7733,20 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 		}
 	}
 	if (sc && sc->count) {
-		if (sc->data[SC_CLOAKING] && !(sc->data[SC_CLOAKING]->val4 & 2))
+		if (sc->getSCE(SC_CLOAKING) && !(sc->getSCE(SC_CLOAKING)->val4 & 2))
 			status_change_end(src, SC_CLOAKING, INVALID_TIMER);
-		else if (sc->data[SC_CLOAKINGEXCEED] && !(sc->data[SC_CLOAKINGEXCEED]->val4 & 2))
+		else if (sc->getSCE(SC_CLOAKINGEXCEED) && !(sc->getSCE(SC_CLOAKINGEXCEED)->val4 & 2))
 			status_change_end(src, SC_CLOAKINGEXCEED, INVALID_TIMER);
-		else if (sc->data[SC_NEWMOON] && --(sc->data[SC_NEWMOON]->val2) <= 0)
+		else if (sc->getSCE(SC_NEWMOON) && --(sc->getSCE(SC_NEWMOON)->val2) <= 0)
 			status_change_end(src, SC_NEWMOON, INVALID_TIMER);
 	}
-	if (tsc && tsc->data[SC_AUTOCOUNTER] && status_check_skilluse(target, src, KN_AUTOCOUNTER, 1)) {
+	if (tsc && tsc->getSCE(SC_AUTOCOUNTER) && status_check_skilluse(target, src, KN_AUTOCOUNTER, 1)) {
 		uint8 dir = map_calc_dir(target,src->x,src->y);
 		int t_dir = unit_getdir(target);
 		int dist = distance_bl(src, target);
 
 		if (dist <= 0 || (!map_check_dir(dir,t_dir) && dist <= tstatus->rhw.range+1)) {
-			uint16 skill_lv = tsc->data[SC_AUTOCOUNTER]->val1;
+			uint16 skill_lv = tsc->getSCE(SC_AUTOCOUNTER)->val1;
 
 			clif_skillcastcancel(target); //Remove the casting bar. [Skotlex]
 			clif_damage(src, target, tick, sstatus->amotion, 1, 0, 1, DMG_NORMAL, 0, false); //Display MISS.
@@ -7756,13 +7756,13 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 		}
 	}
 
-	if( tsc && tsc->data[SC_BLADESTOP_WAIT] &&
+	if( tsc && tsc->getSCE(SC_BLADESTOP_WAIT) &&
 #ifndef RENEWAL
 		status_get_class_(src) != CLASS_BOSS &&
 #endif
 		(src->type == BL_PC || tsd == NULL || distance_bl(src, target) <= (tsd->status.weapon == W_FIST ? 1 : 2)) )
 	{
-		uint16 skill_lv = tsc->data[SC_BLADESTOP_WAIT]->val1;
+		uint16 skill_lv = tsc->getSCE(SC_BLADESTOP_WAIT)->val1;
 		int duration = skill_get_time2(MO_BLADESTOP,skill_lv);
 
 #ifdef RENEWAL
@@ -7786,8 +7786,8 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 		int triple_rate = 30 - skillv; //Base Rate
 #endif
 
-		if (sc && sc->data[SC_SKILLRATE_UP] && sc->data[SC_SKILLRATE_UP]->val1 == MO_TRIPLEATTACK) {
-			triple_rate+= triple_rate*(sc->data[SC_SKILLRATE_UP]->val2)/100;
+		if (sc && sc->getSCE(SC_SKILLRATE_UP) && sc->getSCE(SC_SKILLRATE_UP)->val1 == MO_TRIPLEATTACK) {
+			triple_rate+= triple_rate*(sc->getSCE(SC_SKILLRATE_UP)->val2)/100;
 			status_change_end(src, SC_SKILLRATE_UP, INVALID_TIMER);
 		}
 		if (rnd()%100 < triple_rate) {
@@ -7800,11 +7800,11 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 	}
 
 	if (sc) {
-		if (sc->data[SC_SACRIFICE]) {
-			uint16 skill_lv = sc->data[SC_SACRIFICE]->val1;
+		if (sc->getSCE(SC_SACRIFICE)) {
+			uint16 skill_lv = sc->getSCE(SC_SACRIFICE)->val1;
 			damage_lv ret_val;
 
-			if( --sc->data[SC_SACRIFICE]->val2 <= 0 )
+			if( --sc->getSCE(SC_SACRIFICE)->val2 <= 0 )
 				status_change_end(src, SC_SACRIFICE, INVALID_TIMER);
 
 			/**
@@ -7818,39 +7818,39 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 				return ATK_MISS;
 			return ret_val;
 		}
-		if (sc->data[SC_MAGICALATTACK]) {
-			if( skill_attack(BF_MAGIC,src,src,target,NPC_MAGICALATTACK,sc->data[SC_MAGICALATTACK]->val1,tick,0) )
+		if (sc->getSCE(SC_MAGICALATTACK)) {
+			if( skill_attack(BF_MAGIC,src,src,target,NPC_MAGICALATTACK,sc->getSCE(SC_MAGICALATTACK)->val1,tick,0) )
 				return ATK_DEF;
 			return ATK_MISS;
 		}
-		if( sc->data[SC_GT_ENERGYGAIN] ) {
+		if( sc->getSCE(SC_GT_ENERGYGAIN) ) {
 			int spheres = 5;
 
-			if( sc->data[SC_RAISINGDRAGON] )
-				spheres += sc->data[SC_RAISINGDRAGON]->val1;
+			if( sc->getSCE(SC_RAISINGDRAGON) )
+				spheres += sc->getSCE(SC_RAISINGDRAGON)->val1;
 
-			if( sd && rnd()%100 < sc->data[SC_GT_ENERGYGAIN]->val2 )
-				pc_addspiritball(sd, skill_get_time2(SR_GENTLETOUCH_ENERGYGAIN, sc->data[SC_GT_ENERGYGAIN]->val1), spheres);
+			if( sd && rnd()%100 < sc->getSCE(SC_GT_ENERGYGAIN)->val2 )
+				pc_addspiritball(sd, skill_get_time2(SR_GENTLETOUCH_ENERGYGAIN, sc->getSCE(SC_GT_ENERGYGAIN)->val1), spheres);
 		}
 	}
 
-	if( tsc && tsc->data[SC_GT_ENERGYGAIN] ) {
+	if( tsc && tsc->getSCE(SC_GT_ENERGYGAIN) ) {
 		int spheres = 5;
 
-		if( tsc->data[SC_RAISINGDRAGON] )
-			spheres += tsc->data[SC_RAISINGDRAGON]->val1;
+		if( tsc->getSCE(SC_RAISINGDRAGON) )
+			spheres += tsc->getSCE(SC_RAISINGDRAGON)->val1;
 
-		if( tsd && rnd()%100 < tsc->data[SC_GT_ENERGYGAIN]->val2 )
-			pc_addspiritball(tsd, skill_get_time2(SR_GENTLETOUCH_ENERGYGAIN, tsc->data[SC_GT_ENERGYGAIN]->val1), spheres);
+		if( tsd && rnd()%100 < tsc->getSCE(SC_GT_ENERGYGAIN)->val2 )
+			pc_addspiritball(tsd, skill_get_time2(SR_GENTLETOUCH_ENERGYGAIN, tsc->getSCE(SC_GT_ENERGYGAIN)->val1), spheres);
 	}
 
-	if (tsc && tsc->data[SC_MTF_MLEATKED] && rnd()%100 < tsc->data[SC_MTF_MLEATKED]->val2)
-		clif_skill_nodamage(target, target, SM_ENDURE, tsc->data[SC_MTF_MLEATKED]->val1, sc_start(src, target, SC_ENDURE, 100, tsc->data[SC_MTF_MLEATKED]->val1, skill_get_time(SM_ENDURE, tsc->data[SC_MTF_MLEATKED]->val1)));
+	if (tsc && tsc->getSCE(SC_MTF_MLEATKED) && rnd()%100 < tsc->getSCE(SC_MTF_MLEATKED)->val2)
+		clif_skill_nodamage(target, target, SM_ENDURE, tsc->getSCE(SC_MTF_MLEATKED)->val1, sc_start(src, target, SC_ENDURE, 100, tsc->getSCE(SC_MTF_MLEATKED)->val1, skill_get_time(SM_ENDURE, tsc->getSCE(SC_MTF_MLEATKED)->val1)));
 
-	if(tsc && tsc->data[SC_KAAHI] && tstatus->hp < tstatus->max_hp && status_charge(target, 0, tsc->data[SC_KAAHI]->val3)) {
+	if(tsc && tsc->getSCE(SC_KAAHI) && tstatus->hp < tstatus->max_hp && status_charge(target, 0, tsc->getSCE(SC_KAAHI)->val3)) {
 		int hp_heal = tstatus->max_hp - tstatus->hp;
-		if (hp_heal > tsc->data[SC_KAAHI]->val2)
-			hp_heal = tsc->data[SC_KAAHI]->val2;
+		if (hp_heal > tsc->getSCE(SC_KAAHI)->val2)
+			hp_heal = tsc->getSCE(SC_KAAHI)->val2;
 		if (hp_heal)
 			status_heal(target, hp_heal, 0, 2);
 	}
@@ -7861,12 +7861,12 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 		vellum_damage = true;
 
 	if( sc && sc->count ) {
-		if (sc->data[SC_EXEEDBREAK])
+		if (sc->getSCE(SC_EXEEDBREAK))
 			status_change_end(src, SC_EXEEDBREAK, INVALID_TIMER);
-		if( sc->data[SC_SPELLFIST] && !vellum_damage ){
+		if( sc->getSCE(SC_SPELLFIST) && !vellum_damage ){
 			if (status_charge(src, 0, 20)) {
 				if (!is_infinite_defense(target, wd.flag)) {
-					struct Damage ad = battle_calc_attack(BF_MAGIC, src, target, sc->data[SC_SPELLFIST]->val2, sc->data[SC_SPELLFIST]->val3, flag | BF_SHORT);
+					struct Damage ad = battle_calc_attack(BF_MAGIC, src, target, sc->getSCE(SC_SPELLFIST)->val2, sc->getSCE(SC_SPELLFIST)->val3, flag | BF_SHORT);
 
 					wd.damage = ad.damage;
 					DAMAGE_DIV_FIX(wd.damage, wd.div_); // Double the damage for multiple hits.
@@ -7877,14 +7877,14 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 			} else
 				status_change_end(src,SC_SPELLFIST,INVALID_TIMER);
 		}
-		if (sc->data[SC_GIANTGROWTH] && (wd.flag&BF_SHORT) && rnd()%100 < sc->data[SC_GIANTGROWTH]->val2 && !is_infinite_defense(target, wd.flag) && !vellum_damage)
+		if (sc->getSCE(SC_GIANTGROWTH) && (wd.flag&BF_SHORT) && rnd()%100 < sc->getSCE(SC_GIANTGROWTH)->val2 && !is_infinite_defense(target, wd.flag) && !vellum_damage)
 			wd.damage += wd.damage * 150 / 100; // 2.5 times damage
 
-		if( sd && battle_config.arrow_decrement && sc->data[SC_FEARBREEZE] && sc->data[SC_FEARBREEZE]->val4 > 0) {
+		if( sd && battle_config.arrow_decrement && sc->getSCE(SC_FEARBREEZE) && sc->getSCE(SC_FEARBREEZE)->val4 > 0) {
 			short idx = sd->equip_index[EQI_AMMO];
-			if (idx >= 0 && sd->inventory.u.items_inventory[idx].amount >= sc->data[SC_FEARBREEZE]->val4) {
-				pc_delitem(sd,idx,sc->data[SC_FEARBREEZE]->val4,0,1,LOG_TYPE_CONSUME);
-				sc->data[SC_FEARBREEZE]->val4 = 0;
+			if (idx >= 0 && sd->inventory.u.items_inventory[idx].amount >= sc->getSCE(SC_FEARBREEZE)->val4) {
+				pc_delitem(sd,idx,sc->getSCE(SC_FEARBREEZE)->val4,0,1,LOG_TYPE_CONSUME);
+				sc->getSCE(SC_FEARBREEZE)->val4 = 0;
 			}
 		}
 	}
@@ -7894,14 +7894,14 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 	damage = wd.damage + wd.damage2;
 	if( damage > 0 && src != target )
 	{
-		if( sc && sc->data[SC_DUPLELIGHT] && (wd.flag&BF_SHORT) && rnd()%100 <= 10+2*sc->data[SC_DUPLELIGHT]->val1 )
+		if( sc && sc->getSCE(SC_DUPLELIGHT) && (wd.flag&BF_SHORT) && rnd()%100 <= 10+2*sc->getSCE(SC_DUPLELIGHT)->val1 )
 		{	// Activates it only from melee damage
 			uint16 skill_id;
 			if( rnd()%2 == 1 )
 				skill_id = AB_DUPLELIGHT_MELEE;
 			else
 				skill_id = AB_DUPLELIGHT_MAGIC;
-			skill_attack(skill_get_type(skill_id), src, src, target, skill_id, sc->data[SC_DUPLELIGHT]->val1, tick, SD_LEVEL);
+			skill_attack(skill_get_type(skill_id), src, src, target, skill_id, sc->getSCE(SC_DUPLELIGHT)->val1, tick, SD_LEVEL);
 		}
 	}
 
@@ -7924,7 +7924,7 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 
 	map_freeblock_lock();
 
-	if( !(tsc && tsc->data[SC_DEVOTION]) && !vellum_damage && skill_check_shadowform(target, damage, wd.div_) ) {
+	if( !(tsc && tsc->getSCE(SC_DEVOTION)) && !vellum_damage && skill_check_shadowform(target, damage, wd.div_) ) {
 		if( !status_isdead(target) )
 			skill_additional_effect(src, target, 0, 0, wd.flag, wd.dmg_lv, tick);
 		if( wd.dmg_lv > ATK_BLOCK )
@@ -7932,8 +7932,8 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 	} else
 		battle_delay_damage(tick, wd.amotion, src, target, wd.flag, 0, 0, damage, wd.dmg_lv, wd.dmotion, true, wd.isspdamage);
 	if( tsc ) {
-		if( tsc->data[SC_DEVOTION] ) {
-			struct status_change_entry *sce = tsc->data[SC_DEVOTION];
+		if( tsc->getSCE(SC_DEVOTION) ) {
+			struct status_change_entry *sce = tsc->getSCE(SC_DEVOTION);
 			struct block_list *d_bl = map_id2bl(sce->val1);
 
 			if( d_bl && (
@@ -7958,16 +7958,16 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 			else
 				status_change_end(target, SC_DEVOTION, INVALID_TIMER);
 		}
-		if (target->type == BL_PC && (wd.flag&BF_SHORT) && tsc->data[SC_CIRCLE_OF_FIRE_OPTION]) {
+		if (target->type == BL_PC && (wd.flag&BF_SHORT) && tsc->getSCE(SC_CIRCLE_OF_FIRE_OPTION)) {
 			struct elemental_data *ed = ((TBL_PC*)target)->ed;
 
 			if (ed) {
-				clif_skill_damage(&ed->bl, target, tick, status_get_amotion(src), 0, -30000, 1, EL_CIRCLE_OF_FIRE, tsc->data[SC_CIRCLE_OF_FIRE_OPTION]->val1, DMG_SINGLE);
-				skill_attack(BF_WEAPON,&ed->bl,&ed->bl,src,EL_CIRCLE_OF_FIRE,tsc->data[SC_CIRCLE_OF_FIRE_OPTION]->val1,tick,wd.flag);
+				clif_skill_damage(&ed->bl, target, tick, status_get_amotion(src), 0, -30000, 1, EL_CIRCLE_OF_FIRE, tsc->getSCE(SC_CIRCLE_OF_FIRE_OPTION)->val1, DMG_SINGLE);
+				skill_attack(BF_WEAPON,&ed->bl,&ed->bl,src,EL_CIRCLE_OF_FIRE,tsc->getSCE(SC_CIRCLE_OF_FIRE_OPTION)->val1,tick,wd.flag);
 			}
 		}
-		if (tsc->data[SC_WATER_SCREEN_OPTION]) {
-			struct block_list *e_bl = map_id2bl(tsc->data[SC_WATER_SCREEN_OPTION]->val1);
+		if (tsc->getSCE(SC_WATER_SCREEN_OPTION)) {
+			struct block_list *e_bl = map_id2bl(tsc->getSCE(SC_WATER_SCREEN_OPTION)->val1);
 
 			if (e_bl && !status_isdead(e_bl)) {
 				clif_damage(e_bl, e_bl, tick, 0, 0, damage, wd.div_, DMG_NORMAL, 0, false);
@@ -7975,12 +7975,12 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 			}
 		}
 	}
-	if (sc && sc->data[SC_AUTOSPELL] && rnd()%100 < sc->data[SC_AUTOSPELL]->val4) {
+	if (sc && sc->getSCE(SC_AUTOSPELL) && rnd()%100 < sc->getSCE(SC_AUTOSPELL)->val4) {
 		int sp = 0;
-		uint16 skill_id = sc->data[SC_AUTOSPELL]->val2;
-		uint16 skill_lv = sc->data[SC_AUTOSPELL]->val3;
+		uint16 skill_id = sc->getSCE(SC_AUTOSPELL)->val2;
+		uint16 skill_lv = sc->getSCE(SC_AUTOSPELL)->val3;
 		int i = rnd()%100;
-		if (sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_SAGE)
+		if (sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_SAGE)
 			i = 0; //Max chance, no skill_lv reduction. [Skotlex]
 		//reduction only for skill_lv > 1
 		if (skill_lv > 1) {
@@ -8016,12 +8016,12 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 	}
 	if (sd) {
 		uint16 r_skill = 0, sk_idx = 0;
-		if( wd.flag&BF_WEAPON && sc && sc->data[SC__AUTOSHADOWSPELL] && rnd()%100 < sc->data[SC__AUTOSHADOWSPELL]->val3 &&
-			(r_skill = (uint16)sc->data[SC__AUTOSHADOWSPELL]->val1) && (sk_idx = skill_get_index(r_skill)) &&
+		if( wd.flag&BF_WEAPON && sc && sc->getSCE(SC__AUTOSHADOWSPELL) && rnd()%100 < sc->getSCE(SC__AUTOSHADOWSPELL)->val3 &&
+			(r_skill = (uint16)sc->getSCE(SC__AUTOSHADOWSPELL)->val1) && (sk_idx = skill_get_index(r_skill)) &&
 			sd->status.skill[sk_idx].id != 0 && sd->status.skill[sk_idx].flag == SKILL_FLAG_PLAGIARIZED )
 		{
 			if (r_skill != AL_HOLYLIGHT && r_skill != PR_MAGNUS) {
-				int r_lv = sc->data[SC__AUTOSHADOWSPELL]->val2, type;
+				int r_lv = sc->getSCE(SC__AUTOSHADOWSPELL)->val2, type;
 
 				if( (type = skill_get_casttype(r_skill)) == CAST_GROUND ) {
 					int maxcount = 0;
@@ -8070,11 +8070,11 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 				clif_status_change(src, EFST_POSTDELAY, 1, skill_delayfix(src, r_skill, r_lv), 0, 0, 1);
 			}
 		}
-		if (wd.flag&BF_WEAPON && sc && sc->data[SC_FALLINGSTAR] && rand()%100 < sc->data[SC_FALLINGSTAR]->val2) {
+		if (wd.flag&BF_WEAPON && sc && sc->getSCE(SC_FALLINGSTAR) && rand()%100 < sc->getSCE(SC_FALLINGSTAR)->val2) {
 			if (sd)
 				sd->state.autocast = 1;
-			if (status_charge(src, 0, skill_get_sp(SJ_FALLINGSTAR_ATK, sc->data[SC_FALLINGSTAR]->val1)))
-				skill_castend_nodamage_id(src, src, SJ_FALLINGSTAR_ATK, sc->data[SC_FALLINGSTAR]->val1, tick, flag);
+			if (status_charge(src, 0, skill_get_sp(SJ_FALLINGSTAR_ATK, sc->getSCE(SC_FALLINGSTAR)->val1)))
+				skill_castend_nodamage_id(src, src, SJ_FALLINGSTAR_ATK, sc->getSCE(SC_FALLINGSTAR)->val1, tick, flag);
 			if (sd)
 				sd->state.autocast = 0;
 		}
@@ -8087,13 +8087,13 @@ enum damage_lv battle_weapon_attack(struct block_list* src, struct block_list* t
 	}
 
 	if (tsc) {
-		if (damage > 0 && tsc->data[SC_POISONREACT] &&
-			(rnd()%100 < tsc->data[SC_POISONREACT]->val3
+		if (damage > 0 && tsc->getSCE(SC_POISONREACT) &&
+			(rnd()%100 < tsc->getSCE(SC_POISONREACT)->val3
 			|| sstatus->def_ele == ELE_POISON) &&
 //			check_distance_bl(src, target, tstatus->rhw.range+1) && Doesn't checks range! o.O;
 			status_check_skilluse(target, src, TF_POISON, 0)
 		) {	//Poison React
-			struct status_change_entry *sce = tsc->data[SC_POISONREACT];
+			struct status_change_entry *sce = tsc->getSCE(SC_POISONREACT);
 			if (sstatus->def_ele == ELE_POISON) {
 				sce->val2 = 0;
 				skill_attack(BF_WEAPON,target,target,src,AS_POISONREACT,sce->val1,tick,0);
@@ -8233,7 +8233,7 @@ int battle_check_target( struct block_list *src, struct block_list *target,int f
 				if (((TBL_PC*)target)->invincible_timer != INVALID_TIMER || pc_isinvisible((TBL_PC*)target))
 					return -1; //Cannot be targeted yet.
 				if( sc && sc->count ) {
-					if( sc->data[SC_VOICEOFSIREN] && sc->data[SC_VOICEOFSIREN]->val2 == target->id )
+					if( sc->getSCE(SC_VOICEOFSIREN) && sc->getSCE(SC_VOICEOFSIREN)->val2 == target->id )
 						return -1;
 				}
 			}
@@ -8328,7 +8328,7 @@ int battle_check_target( struct block_list *src, struct block_list *target,int f
 			sd = BL_CAST(BL_PC, t_bl);
 			sc = status_get_sc(t_bl);
 
-			if( ((sd->state.block_action & PCBLOCK_IMMUNE) || (sc->data[SC_KINGS_GRACE] && s_bl->type != BL_PC)) && flag&BCT_ENEMY )
+			if( ((sd->state.block_action & PCBLOCK_IMMUNE) || (sc->getSCE(SC_KINGS_GRACE) && s_bl->type != BL_PC)) && flag&BCT_ENEMY )
 				return 0; // Global immunity only to Attacks
 			if( sd->status.karma && s_bl->type == BL_PC && ((TBL_PC*)s_bl)->status.karma )
 				state |= BCT_ENEMY; // Characters with bad karma may fight amongst them
@@ -8376,7 +8376,7 @@ int battle_check_target( struct block_list *src, struct block_list *target,int f
 				}
 				//Status changes that prevent traps from triggering
 				if (sc && sc->count && inf2[INF2_ISTRAP]) {
-					if( sc->data[SC_SIGHTBLASTER] && sc->data[SC_SIGHTBLASTER]->val2 > 0 && sc->data[SC_SIGHTBLASTER]->val4%2 == 0)
+					if( sc->getSCE(SC_SIGHTBLASTER) && sc->getSCE(SC_SIGHTBLASTER)->val2 > 0 && sc->getSCE(SC_SIGHTBLASTER)->val4%2 == 0)
 						return -1;
 				}
 			}
@@ -9133,6 +9133,7 @@ static const struct _battle_data {
 	{ "idletime_mer_option",                &battle_config.idletime_mer_option,             0x1F,   0x1,    0xFFF,          },
 	{ "feature.refineui",                   &battle_config.feature_refineui,                1,      0,      1,              },
 	{ "rndopt_drop_pillar",                 &battle_config.rndopt_drop_pillar,              1,      0,      1,              },
+	{ "path_reach_jps",                     &battle_config.path_reach_jps,                  0,      0,      1,              },
 
 #include "../custom/battle_config_init.inc"
 };
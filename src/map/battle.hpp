@@ -690,6 +690,7 @@ struct Battle_Config
 	int idletime_mer_option;
 	int feature_refineui;
 	int rndopt_drop_pillar;
+	int path_reach_jps;
 
 #include "../custom/battle_config_struct.inc"
 };
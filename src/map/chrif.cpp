@@ -38,6 +38,7 @@ static TIMER_FUNC(check_connect_char_server);
 static struct eri *auth_db_ers; //For reutilizing player login structures.
 static DBMap* auth_db; // int id -> struct auth_node*
 static bool char_init_done = false; //server already initialized? Used for InterInitOnce and vending loadings
+static uint32 chrif_connection_id = 0; // Increased on every connection to the char-server, see chrif_save
 
 static const int packet_len_table[0x3d] = { // U - used, F - free
 	60, 3,-1,-1,10,-1, 6,-1,	// 2af8-2aff: U->2af8, U->2af9, U->2afa, U->2afb, U->2afc, U->2afd, U->2afe, U->2aff
@@ -59,7 +60,7 @@ static const int packet_len_table[0x3d] = { // U - used, F - free
 //2afe: Outgoing, send_usercount_tochar -> 'sends player count of this map server to charserver'
 //2aff: Outgoing, send_users_tochar -> 'sends all actual connected character ids to charserver'
 //2b00: Incoming, map_setusers -> 'set the actual usercount? PACKET.2B COUNT.L.. ?' (not sure)
-//2b01: Outgoing, chrif_save -> 'charsave of char XY account XY (complete struct)'
+//2b01: Outgoing, chrif_save -> 'charsave of char XY account XY (struct without the unchanged sections)'
 //2b02: Outgoing, chrif_charselectreq -> 'player returns from ingame to charserver to select another char.., this packets includes sessid etc' ? (not 100% sure)
 //2b03: Incoming, clif_charselectok -> '' (i think its the packet after enterworld?) (not sure)
 //2b04: Incoming, chrif_recvmap -> 'getting maps from charserver of other mapserver's'
@@ -280,8 +281,31 @@ int chrif_isconnected(void) {
 	return (session_isValid(char_fd) && chrif_state == 2);
 }
 
+/**
+ * FNV-1a hash of a section of the character data, see chrif_save.
+ * @param status: character data
+ * @param section: e_charstatus_section
+ * @return hash of the section
+ */
+static uint64 chrif_section_hash(const struct mmo_charstatus* status, int section) {
+	const uint8* data;
+	size_t offset, length;
+	uint64 hash = 14695981039346656037ULL;
+
+	charstatus_section_range(section, &offset, &length);
+	data = (const uint8*)status + offset;
+
+	for( size_t i = 0; i < length; i++ ){
+		hash ^= data[i];
+		hash *= 1099511628211ULL;
+	}
+
+	return hash;
+}
+
 /**
  * Saves character data.
+ *  The lists of the character (see e_charstatus_section) are only sent when they changed.
  * @param sd: Player data
  * @param flag: Save flag types:
  *  CSAVE_NORMAL: Normal save
@@ -331,31 +355,59 @@ int chrif_save(struct map_session_data *sd, int flag) {
 	if (sd->vars_dirty)
 		intif_saveregistry(sd);
 
-	mmo_charstatus_len = sizeof(sd->status) + 13;
+	const struct mmo_charstatus* status = &sd->status;
+	struct mmo_charstatus instance_status;
+
+	// If the user is on a instance map, we have to fake his current position
+	if( map_getmapdata(sd->bl.m)->instance_id ){
+		// Copy the whole status
+		memcpy( &instance_status, &sd->status, sizeof( struct mmo_charstatus ) );
+		// Change his current position to his savepoint
+		memcpy( &instance_status.last_point, &instance_status.save_point, sizeof( struct point ) );
+		status = &instance_status;
+	}
+
+	// Only send the sections that changed since the last save on this connection,
+	// the char-server keeps the rest from its cached copy of the character.
+	uint8 sections = 0;
+	uint64 hashes[CHARSTATUS_SECTION_MAX];
+
+	for( int i = 0; i < CHARSTATUS_SECTION_MAX; i++ ){
+		hashes[i] = chrif_section_hash(status, i);
+		if( sd->status_connection != chrif_connection_id || hashes[i] != sd->status_hash[i] )
+			sections |= 1 << i;
+	}
+
+	mmo_charstatus_len = (uint16)charstatus_save_length(sections);
 	WFIFOHEAD(char_fd, mmo_charstatus_len);
 	WFIFOW(char_fd,0) = 0x2b01;
 	WFIFOW(char_fd,2) = mmo_charstatus_len;
 	WFIFOL(char_fd,4) = sd->status.account_id;
 	WFIFOL(char_fd,8) = sd->status.char_id;
 	WFIFOB(char_fd,12) = (flag&CSAVE_QUIT) ? 1 : 0; //Flag to tell char-server this character is quitting.
+	WFIFOB(char_fd,13) = sections;
 
-	// If the user is on a instance map, we have to fake his current position
-	if( map_getmapdata(sd->bl.m)->instance_id ){
-		struct mmo_charstatus status;
+	size_t offset, length, pos = 14;
 
-		// Copy the whole status
-		memcpy( &status, &sd->status, sizeof( struct mmo_charstatus ) );
-		// Change his current position to his savepoint
-		memcpy( &status.last_point, &status.save_point, sizeof( struct point ) );
-		// Copy the copied status into the packet
-		memcpy( WFIFOP( char_fd, 13 ), &status, sizeof( struct mmo_charstatus ) );
-	} else {
-		// Copy the whole status into the packet
-		memcpy( WFIFOP( char_fd, 13 ), &sd->status, sizeof( struct mmo_charstatus ) );
+	// Everything before and after the sections is always sent
+	memcpy( WFIFOP( char_fd, pos ), status, CHARSTATUS_SECTIONS_BEGIN );
+	pos += CHARSTATUS_SECTIONS_BEGIN;
+	memcpy( WFIFOP( char_fd, pos ), (const uint8*)status + charstatus_sections_end(), sizeof( struct mmo_charstatus ) - charstatus_sections_end() );
+	pos += sizeof( struct mmo_charstatus ) - charstatus_sections_end();
+
+	for( int i = 0; i < CHARSTATUS_SECTION_MAX; i++ ){
+		if( sections & ( 1 << i ) ){
+			charstatus_section_range(i, &offset, &length);
+			memcpy( WFIFOP( char_fd, pos ), (const uint8*)status + offset, length );
+			pos += length;
+		}
 	}
 
 	WFIFOSET(char_fd, WFIFOW(char_fd,2));
 
+	memcpy( sd->status_hash, hashes, sizeof( hashes ) );
+	sd->status_connection = chrif_connection_id;
+
 	if( sd->status.pet_id > 0 && sd->pd )
 		intif_save_petdata(sd->status.account_id,&sd->pd->pet);
 	if( hom_is_active(sd->hd) )
@@ -570,6 +622,8 @@ void chrif_on_ready(void) {
 	ShowStatus("Map Server is now online.\n");
 
 	chrif_state = 2;
+	// The char-server might have lost its cached characters, the next saves are complete again
+	chrif_connection_id++;
 
 	chrif_check_shutdown();
 
@@ -1324,10 +1378,10 @@ int chrif_save_scdata(struct map_session_data *sd) { //parses the sc_data of the
 	WFIFOL(char_fd,8) = sd->status.char_id;
 
 	for (i = 0; i < SC_MAX; i++) {
-		if (!sc->data[i])
+		if (!sc->getSCE(i))
 			continue;
-		if (sc->data[i]->timer != INVALID_TIMER) {
-			timer = get_timer(sc->data[i]->timer);
+		if (sc->getSCE(i)->timer != INVALID_TIMER) {
+			timer = get_timer(sc->getSCE(i)->timer);
 			if (timer == NULL || timer->func != status_change_timer)
 				continue;
 			if (DIFF_TICK(timer->tick,tick) > 0)
@@ -1337,10 +1391,10 @@ int chrif_save_scdata(struct map_session_data *sd) { //parses the sc_data of the
 		} else
 			data.tick = INFINITE_TICK; //Infinite duration
 		data.type = i;
-		data.val1 = sc->data[i]->val1;
-		data.val2 = sc->data[i]->val2;
-		data.val3 = sc->data[i]->val3;
-		data.val4 = sc->data[i]->val4;
+		data.val1 = sc->getSCE(i)->val1;
+		data.val2 = sc->getSCE(i)->val2;
+		data.val3 = sc->getSCE(i)->val3;
+		data.val4 = sc->getSCE(i)->val4;
 		memcpy(WFIFOP(char_fd,14 +count*sizeof(struct status_change_data)),
 			&data, sizeof(struct status_change_data));
 		count++;
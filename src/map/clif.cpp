@@ -381,6 +381,16 @@ static bool clif_session_isValid(struct map_session_data *sd) {
 	return ( sd != nullptr && session_isActive(sd->fd) );
 }
 
+/// Queues a packet of clif_send on a session.
+/// The packet data is copied once into a shared buffer on first use and then referenced by all further sessions.
+static void clif_send_shared( int fd, struct socket_shared_packet** packet, const void* buf, int len ){
+	if( *packet == nullptr ){
+		*packet = socket_shared_packet_create( buf, len );
+	}
+
+	WFIFOSHARE( fd, *packet );
+}
+
 /*==========================================
  * sub process of clif_send
  * Called from a map_foreachinallarea (grabs all players in specific area and subjects them to this function)
@@ -397,6 +407,7 @@ static int clif_send_sub(struct block_list *bl, va_list ap)
 	struct map_session_data *sd;
 	unsigned char *buf;
 	int len, type, fd;
+	struct socket_shared_packet** packet;
 
 	nullpo_ret(bl);
 	nullpo_ret(sd = (struct map_session_data *)bl);
@@ -410,6 +421,7 @@ static int clif_send_sub(struct block_list *bl, va_list ap)
 	len = va_arg(ap,int);
 	nullpo_ret(src_bl = va_arg(ap,struct block_list*));
 	type = va_arg(ap,int);
+	packet = va_arg(ap,struct socket_shared_packet**);
 
 	switch(type) {
 	case AREA_WOS:
@@ -438,7 +450,7 @@ static int clif_send_sub(struct block_list *bl, va_list ap)
 
 	/* unless visible, hold it here */
 	if (!battle_config.update_enemy_position && clif_ally_only && !sd->special_state.intravision &&
-		!sd->sc.data[SC_INTRAVISION] && battle_check_target(src_bl,&sd->bl,BCT_ENEMY) > 0)
+		!sd->sc.getSCE(SC_INTRAVISION) && battle_check_target(src_bl,&sd->bl,BCT_ENEMY) > 0)
 		return 0;
 
 	WFIFOHEAD(fd, len);
@@ -452,8 +464,7 @@ static int clif_send_sub(struct block_list *bl, va_list ap)
 		return 0;
 	}
 
-	memcpy(WFIFOP(fd,0), buf, len);
-	WFIFOSET(fd,len);
+	clif_send_shared(fd, packet, buf, len);
 
 	return 0;
 }
@@ -471,6 +482,7 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 	std::shared_ptr<s_battleground_data> bg;
 	int x0 = 0, x1 = 0, y0 = 0, y1 = 0, fd;
 	struct s_mapiterator* iter;
+	struct socket_shared_packet* packet = nullptr;
 
 	if( type != ALL_CLIENT )
 		nullpo_ret(bl);
@@ -483,9 +495,7 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 		iter = mapit_getallusers();
 		while( ( tsd = (map_session_data*)mapit_next( iter ) ) != nullptr ){
 			if( session_isActive( fd = tsd->fd ) ){
-				WFIFOHEAD( fd, len );
-				memcpy( WFIFOP( fd, 0 ), buf, len );
-				WFIFOSET( fd, len );
+				clif_send_shared( fd, &packet, buf, len );
 			}
 		}
 		mapit_free(iter);
@@ -495,9 +505,7 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 		iter = mapit_getallusers();
 		while( ( tsd = (map_session_data*)mapit_next( iter ) ) != nullptr ){
 			if( bl->m == tsd->bl.m && session_isActive( fd = tsd->fd ) ){
-				WFIFOHEAD( fd, len );
-				memcpy( WFIFOP( fd, 0 ), buf, len );
-				WFIFOSET( fd, len );
+				clif_send_shared( fd, &packet, buf, len );
 			}
 		}
 		mapit_free(iter);
@@ -510,11 +518,11 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 	case AREA_WOC:
 	case AREA_WOS:
 		map_foreachinallarea(clif_send_sub, bl->m, bl->x-AREA_SIZE, bl->y-AREA_SIZE, bl->x+AREA_SIZE, bl->y+AREA_SIZE,
-			BL_PC, buf, len, bl, type);
+			BL_PC, buf, len, bl, type, &packet);
 		break;
 	case AREA_CHAT_WOC:
 		map_foreachinallarea(clif_send_sub, bl->m, bl->x-(AREA_SIZE-5), bl->y-(AREA_SIZE-5),
-			bl->x+(AREA_SIZE-5), bl->y+(AREA_SIZE-5), BL_PC, buf, len, bl, AREA_WOC);
+			bl->x+(AREA_SIZE-5), bl->y+(AREA_SIZE-5), BL_PC, buf, len, bl, AREA_WOC, &packet);
 		break;
 
 	case CHAT:
@@ -532,9 +540,7 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 				if (type == CHAT_WOS && cd->usersd[i] == sd)
 					continue;
 				if( session_isActive( fd = cd->usersd[i]->fd ) ){
-					WFIFOHEAD(fd,len);
-					memcpy(WFIFOP(fd,0), buf, len);
-					WFIFOSET(fd,len);
+					clif_send_shared( fd, &packet, buf, len );
 				}
 			}
 		}
@@ -570,9 +576,7 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 				if( (type == PARTY_AREA || type == PARTY_AREA_WOS) && (sd->bl.x < x0 || sd->bl.y < y0 || sd->bl.x > x1 || sd->bl.y > y1) )
 					continue;
 
-				WFIFOHEAD(fd, len);
-				memcpy(WFIFOP(fd, 0), buf, len);
-				WFIFOSET(fd, len);
+				clif_send_shared( fd, &packet, buf, len );
 			}
 			if (!enable_spy) //Skip unnecessary parsing. [Skotlex]
 				break;
@@ -580,9 +584,7 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 			iter = mapit_getallusers();
 			while( ( tsd = (map_session_data*)mapit_next( iter ) ) != nullptr ){
 				if( tsd->partyspy == p->party.party_id && session_isActive( fd = tsd->fd ) ){
-					WFIFOHEAD( fd, len );
-					memcpy( WFIFOP( fd, 0 ), buf, len );
-					WFIFOSET( tsd->fd, len );
+					clif_send_shared( fd, &packet, buf, len );
 				}
 			}
 			mapit_free(iter);
@@ -598,9 +600,7 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 			if( type == DUEL_WOS && bl->id == tsd->bl.id )
 				continue;
 			if( sd->duel_group == tsd->duel_group && session_isActive( fd = tsd->fd ) ){
-				WFIFOHEAD( fd, len );
-				memcpy( WFIFOP( fd, 0 ), buf, len );
-				WFIFOSET( fd, len );
+				clif_send_shared( fd, &packet, buf, len );
 			}
 		}
 		mapit_free(iter);
@@ -648,9 +648,7 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 					if( (type == GUILD_AREA || type == GUILD_AREA_WOS) && (sd->bl.x < x0 || sd->bl.y < y0 || sd->bl.x > x1 || sd->bl.y > y1) )
 						continue;
 
-					WFIFOHEAD(fd,len);
-					memcpy(WFIFOP(fd,0), buf, len);
-					WFIFOSET(fd,len);
+					clif_send_shared( fd, &packet, buf, len );
 				}
 			}
 			if (!enable_spy) //Skip unnecessary parsing. [Skotlex]
@@ -659,9 +657,7 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 			iter = mapit_getallusers();
 			while( ( tsd = (map_session_data*)mapit_next( iter ) ) != nullptr ){
 				if( tsd->guildspy == g->guild_id && session_isActive( fd = tsd->fd ) ){
-					WFIFOHEAD( fd, len );
-					memcpy( WFIFOP( fd, 0 ), buf, len );
-					WFIFOSET( fd, len );
+					clif_send_shared( fd, &packet, buf, len );
 				}
 			}
 			mapit_free(iter);
@@ -689,9 +685,7 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 					continue;
 				if( (type == BG_AREA || type == BG_AREA_WOS) && (sd->bl.x < x0 || sd->bl.y < y0 || sd->bl.x > x1 || sd->bl.y > y1) )
 					continue;
-				WFIFOHEAD(fd,len);
-				memcpy(WFIFOP(fd,0), buf, len);
-				WFIFOSET(fd,len);
+				clif_send_shared( fd, &packet, buf, len );
 			}
 		}
 		break;
@@ -704,9 +698,7 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 					continue;
 				}
 
-				WFIFOHEAD(fd,len);
-				memcpy(WFIFOP(fd,0), buf, len);
-				WFIFOSET(fd,len);
+				clif_send_shared( fd, &packet, buf, len );
 			}
 
 			if (!enable_spy) //Skip unnecessary parsing. [Skotlex]
@@ -715,9 +707,7 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 			iter = mapit_getallusers();
 			while( ( tsd = (map_session_data*)mapit_next( iter ) ) != nullptr ){
 				if( tsd->clanspy == clan->id && session_isActive( fd = tsd->fd ) ){
-					WFIFOHEAD(fd, len);
-					memcpy(WFIFOP(fd, 0), buf, len);
-					WFIFOSET(fd, len);
+					clif_send_shared( fd, &packet, buf, len );
 				}
 			}
 			mapit_free(iter);
@@ -729,6 +719,8 @@ int clif_send(const void* buf, int len, struct block_list* bl, enum send_target
 		return -1;
 	}
 
+	socket_shared_packet_release(packet);
+
 	return 0;
 }
 
@@ -1516,13 +1508,13 @@ static void clif_millenniumshield_single(int fd, map_session_data *sd)
 {
 	nullpo_retv(sd);
 
-	if (sd->sc.data[SC_MILLENNIUMSHIELD] == nullptr)
+	if (sd->sc.getSCE(SC_MILLENNIUMSHIELD) == nullptr)
 		return;
 
 	WFIFOHEAD(fd, packet_len(0x440));
 	WFIFOW(fd, 0) = 0x440;
 	WFIFOL(fd, 2) = sd->bl.id;
-	WFIFOW(fd, 6) = sd->sc.data[SC_MILLENNIUMSHIELD]->val2;
+	WFIFOW(fd, 6) = sd->sc.getSCE(SC_MILLENNIUMSHIELD)->val2;
 	WFIFOW(fd, 8) = 0;
 	WFIFOSET(fd, packet_len(0x440));
 }
@@ -1645,8 +1637,8 @@ int clif_spawn( struct block_list *bl, bool walking ){
 
 			if (sd->spiritball > 0)
 				clif_spiritball(&sd->bl);
-			if (sd->sc.data[SC_MILLENNIUMSHIELD])
-				clif_millenniumshield(&sd->bl, sd->sc.data[SC_MILLENNIUMSHIELD]->val2);
+			if (sd->sc.getSCE(SC_MILLENNIUMSHIELD))
+				clif_millenniumshield(&sd->bl, sd->sc.getSCE(SC_MILLENNIUMSHIELD)->val2);
 			if (sd->soulball > 0)
 				clif_soulball(sd);
 			if(sd->state.size==SZ_BIG) // tiny/big players [Valaris]
@@ -4090,8 +4082,8 @@ void clif_changeoption_target( struct block_list* bl, struct block_list* target
 
 		//Whenever we send "changeoption" to the client, the provoke icon is lost
 		//There is probably an option for the provoke icon, but as we don't know it, we have to do this for now
-		if( sc->data[SC_PROVOKE] ){
-			const struct TimerData *td = get_timer( sc->data[SC_PROVOKE]->timer );
+		if( sc->getSCE(SC_PROVOKE) ){
+			const struct TimerData *td = get_timer( sc->getSCE(SC_PROVOKE)->timer );
 
 			clif_status_change( bl, StatusIconChangeTable[SC_PROVOKE], 1, ( !td ? INFINITE_TICK : DIFF_TICK( td->tick, gettick() ) ), 0, 0, 0 );
 		}
@@ -4726,7 +4718,7 @@ static void clif_getareachar_pc(struct map_session_data* sd,struct map_session_d
 
 	if(dstsd->spiritball > 0)
 		clif_spiritball( &dstsd->bl, &sd->bl, SELF );
-	if (dstsd->sc.data[SC_MILLENNIUMSHIELD])
+	if (dstsd->sc.getSCE(SC_MILLENNIUMSHIELD))
 		clif_millenniumshield_single(sd->fd, dstsd);
 	if (dstsd->spiritcharm_type != CHARM_TYPE_NONE && dstsd->spiritcharm > 0)
 		clif_spiritcharm_single(sd->fd, dstsd);
@@ -4747,7 +4739,7 @@ static void clif_getareachar_pc(struct map_session_data* sd,struct map_session_d
 	if( i < MAX_DEVOTION )
 		clif_devotion(&dstsd->bl, sd);
 	// display link (dstsd - crusader) to sd
-	if( dstsd->sc.data[SC_DEVOTION] && (d_bl = map_id2bl(dstsd->sc.data[SC_DEVOTION]->val1)) != NULL )
+	if( dstsd->sc.getSCE(SC_DEVOTION) && (d_bl = map_id2bl(dstsd->sc.getSCE(SC_DEVOTION)->val1)) != NULL )
 		clif_devotion(d_bl, sd);
 }
 
@@ -4929,7 +4921,7 @@ int clif_damage(struct block_list* src, struct block_list* dst, t_tick tick, int
 		type = clif_calc_delay(type,div,damage+damage2,ddelay);
 	sc = status_get_sc(dst);
 	if(sc && sc->count) {
-		if(sc->data[SC_HALLUCINATION]) {
+		if(sc->getSCE(SC_HALLUCINATION)) {
 			if(damage) damage = clif_hallucination_damage();
 			if(damage2) damage2 = clif_hallucination_damage();
 		}
@@ -5709,7 +5701,7 @@ int clif_skill_damage(struct block_list *src,struct block_list *dst,t_tick tick,
 	type = clif_calc_delay(type,div,damage,ddelay);
 
 	if( ( sc = status_get_sc(dst) ) && sc->count ) {
-		if(sc->data[SC_HALLUCINATION] && damage)
+		if(sc->getSCE(SC_HALLUCINATION) && damage)
 			damage = clif_hallucination_damage();
 	}
 
@@ -5806,7 +5798,7 @@ int clif_skill_damage2(struct block_list *src,struct block_list *dst,t_tick tick
 	sc = status_get_sc(dst);
 
 	if(sc && sc->count) {
-		if(sc->data[SC_HALLUCINATION] && damage)
+		if(sc->getSCE(SC_HALLUCINATION) && damage)
 			damage = clif_hallucination_damage();
 	}
 
@@ -6268,7 +6260,7 @@ void clif_efst_status_change_sub(struct block_list *tbl, struct block_list *bl,
 	for (i = 0; i < sc_display_count; i++) {
 		enum sc_type type = sc_display[i]->type;
 		struct status_change *sc = status_get_sc(bl);
-		const struct TimerData *td = (sc && sc->data[type] ? get_timer(sc->data[type]->timer) : NULL);
+		const struct TimerData *td = (sc && sc->getSCE(type) ? get_timer(sc->getSCE(type)->timer) : NULL);
 		t_tick tick = 0;
 
 		if (td)
@@ -6286,8 +6278,8 @@ void clif_efst_status_change_sub(struct block_list *tbl, struct block_list *bl,
 				}
 				break;
 			case SC_HELLS_PLANT:
-				if( sc && sc->data[type] ){
-					tick = sc->data[type]->val4;
+				if( sc && sc->getSCE(type) ){
+					tick = sc->getSCE(type)->val4;
 				}
 				break;
 		}
@@ -9683,7 +9675,7 @@ void clif_refresh(struct map_session_data *sd)
 	clif_updatestatus(sd,SP_LUK);
 	if (sd->spiritball)
 		clif_spiritball( &sd->bl, &sd->bl, SELF );
-	if (sd->sc.data[SC_MILLENNIUMSHIELD])
+	if (sd->sc.getSCE(SC_MILLENNIUMSHIELD))
 		clif_millenniumshield_single(sd->fd, sd);
 	if (sd->spiritcharm_type != CHARM_TYPE_NONE && sd->spiritcharm > 0)
 		clif_spiritcharm_single(sd->fd, sd);
@@ -10737,7 +10729,7 @@ void clif_parse_LoadEndAck(int fd,struct map_session_data *sd)
 			clif_status_load(&sd->bl, EFST_RIDING, 1);
 		else if (sd->sc.option&OPTION_WUGRIDER)
 			clif_status_load(&sd->bl, EFST_WUGRIDER, 1);
-		else if (sd->sc.data[SC_ALL_RIDING])
+		else if (sd->sc.getSCE(SC_ALL_RIDING))
 			clif_status_load(&sd->bl, EFST_ALL_RIDING, 1);
 
 		if(sd->status.manner < 0)
@@ -10906,7 +10898,7 @@ void clif_parse_LoadEndAck(int fd,struct map_session_data *sd)
 	if (sd->sc.opt2) //Client loses these on warp.
 		clif_changeoption(&sd->bl);
 
-	if ((sd->sc.data[SC_MONSTER_TRANSFORM] || sd->sc.data[SC_ACTIVE_MONSTER_TRANSFORM]) && battle_config.mon_trans_disable_in_gvg && mapdata_flag_gvg2(mapdata)) {
+	if ((sd->sc.getSCE(SC_MONSTER_TRANSFORM) || sd->sc.getSCE(SC_ACTIVE_MONSTER_TRANSFORM)) && battle_config.mon_trans_disable_in_gvg && mapdata_flag_gvg2(mapdata)) {
 		status_change_end(&sd->bl, SC_MONSTER_TRANSFORM, INVALID_TIMER);
 		status_change_end(&sd->bl, SC_ACTIVE_MONSTER_TRANSFORM, INVALID_TIMER);
 		clif_displaymessage(sd->fd, msg_txt(sd,731)); // Transforming into monster is not allowed in Guild Wars.
@@ -11160,7 +11152,7 @@ void clif_parse_WalkToXY(int fd, struct map_session_data *sd)
 	} else if (pc_cant_act(sd))
 		return;
 
-	if(sd->sc.data[SC_RUN] || sd->sc.data[SC_WUGDASH])
+	if(sd->sc.getSCE(SC_RUN) || sd->sc.getSCE(SC_WUGDASH))
 		return;
 
 	RFIFOPOS(fd, packet_db[RFIFOW(fd,0)].pos[0], &x, &y, NULL);
@@ -11172,8 +11164,8 @@ void clif_parse_WalkToXY(int fd, struct map_session_data *sd)
 
 	// Cloaking wall check is actually updated when you click to process next movement
 	// not when you move each cell.  This is official behaviour.
-	if (sd->sc.data[SC_CLOAKING])
-		skill_check_cloaking(&sd->bl, sd->sc.data[SC_CLOAKING]);
+	if (sd->sc.getSCE(SC_CLOAKING))
+		skill_check_cloaking(&sd->bl, sd->sc.getSCE(SC_CLOAKING));
 	status_change_end(&sd->bl, SC_ROLLINGCUTTER, INVALID_TIMER); // If you move, you lose your counters. [malufett]
 
 	pc_delinvincibletimer(sd);
@@ -11215,7 +11207,7 @@ void clif_parse_QuitGame(int fd, struct map_session_data *sd)
 {
 	/*	Rovert's prevent logout option fixed [Valaris]	*/
 	//int type = RFIFOW(fd,packet_db[RFIFOW(fd,0)].pos[0]);
-	if( !sd->sc.data[SC_CLOAKING] && !sd->sc.data[SC_HIDING] && !sd->sc.data[SC_CHASEWALK] && !sd->sc.data[SC_CLOAKINGEXCEED] && !sd->sc.data[SC_SUHIDE] && !sd->sc.data[SC_NEWMOON] &&
+	if( !sd->sc.getSCE(SC_CLOAKING) && !sd->sc.getSCE(SC_HIDING) && !sd->sc.getSCE(SC_CHASEWALK) && !sd->sc.getSCE(SC_CLOAKINGEXCEED) && !sd->sc.getSCE(SC_SUHIDE) && !sd->sc.getSCE(SC_NEWMOON) &&
 		(!battle_config.prevent_logout || sd->canlog_tick == 0 || DIFF_TICK(gettick(), sd->canlog_tick) > battle_config.prevent_logout) )
 	{
 		pc_damage_log_clear(sd,0);
@@ -11454,12 +11446,12 @@ void clif_parse_ActionRequest_sub(struct map_session_data *sd, int action_type,
 	// Statuses that don't let the player sit / attack / talk with NPCs(targeted)
 	// (not all are included in pc_can_attack)
 	if (sd->sc.count &&
-		(sd->sc.data[SC_TRICKDEAD] ||
-		(sd->sc.data[SC_AUTOCOUNTER] && action_type != 0x07) ||
-		 sd->sc.data[SC_BLADESTOP] ||
-		 sd->sc.data[SC__MANHOLE] ||
-		 sd->sc.data[SC_SUHIDE] ||
-		 sd->sc.data[SC_GRAVITYCONTROL]))
+		(sd->sc.getSCE(SC_TRICKDEAD) ||
+		(sd->sc.getSCE(SC_AUTOCOUNTER) && action_type != 0x07) ||
+		 sd->sc.getSCE(SC_BLADESTOP) ||
+		 sd->sc.getSCE(SC__MANHOLE) ||
+		 sd->sc.getSCE(SC_SUHIDE) ||
+		 sd->sc.getSCE(SC_GRAVITYCONTROL)))
 		return;
 
 	if(action_type != 0x00 && action_type != 0x07)
@@ -11512,8 +11504,8 @@ void clif_parse_ActionRequest_sub(struct map_session_data *sd, int action_type,
 			break;
 
 		if (sd->sc.count && (
-			sd->sc.data[SC_DANCING] ||
-			(sd->sc.data[SC_GRAVITATION] && sd->sc.data[SC_GRAVITATION]->val3 == BCT_SELF)
+			sd->sc.getSCE(SC_DANCING) ||
+			(sd->sc.getSCE(SC_GRAVITATION) && sd->sc.getSCE(SC_GRAVITATION)->val3 == BCT_SELF)
 		)) //No sitting during these states either.
 			break;
 
@@ -11598,7 +11590,7 @@ void clif_parse_Restart(int fd, struct map_session_data *sd)
 		break;
 	case 0x01:
 		/*	Rovert's Prevent logout option - Fixed [Valaris]	*/
-		if( !sd->sc.data[SC_CLOAKING] && !sd->sc.data[SC_HIDING] && !sd->sc.data[SC_CHASEWALK] && !sd->sc.data[SC_CLOAKINGEXCEED] && !sd->sc.data[SC_SUHIDE] && !sd->sc.data[SC_NEWMOON] &&
+		if( !sd->sc.getSCE(SC_CLOAKING) && !sd->sc.getSCE(SC_HIDING) && !sd->sc.getSCE(SC_CHASEWALK) && !sd->sc.getSCE(SC_CLOAKINGEXCEED) && !sd->sc.getSCE(SC_SUHIDE) && !sd->sc.getSCE(SC_NEWMOON) &&
 			(!battle_config.prevent_logout || sd->canlog_tick == 0 || DIFF_TICK(gettick(), sd->canlog_tick) > battle_config.prevent_logout) )
 		{	//Send to char-server for character selection.
 			pc_damage_log_clear(sd,0);
@@ -11801,9 +11793,9 @@ void clif_parse_DropItem(int fd, struct map_session_data *sd){
 			break;
 
 		if (sd->sc.count && (
-			sd->sc.data[SC_AUTOCOUNTER] ||
-			sd->sc.data[SC_BLADESTOP] ||
-			(sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOITEM)
+			sd->sc.getSCE(SC_AUTOCOUNTER) ||
+			sd->sc.getSCE(SC_BLADESTOP) ||
+			(sd->sc.getSCE(SC_NOCHAT) && sd->sc.getSCE(SC_NOCHAT)->val1&MANNER_NOITEM)
 		))
 			break;
 
@@ -12112,7 +12104,7 @@ void clif_parse_CreateChatRoom(int fd, struct map_session_data* sd)
 	char s_password[CHATROOM_PASS_SIZE];
 	char s_title[CHATROOM_TITLE_SIZE];
 
-	if (sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOROOM)
+	if (sd->sc.getSCE(SC_NOCHAT) && sd->sc.getSCE(SC_NOCHAT)->val1&MANNER_NOROOM)
 		return;
 	if(battle_config.basic_skill_check && pc_checkskill(sd,NV_BASIC) < 4 && pc_checkskill(sd, SU_BASIC_SKILL) < 1) {
 		clif_skill_fail(sd,1,USESKILL_FAIL_LEVEL,3);
@@ -12347,7 +12339,7 @@ void clif_parse_RemoveOption(int fd,struct map_session_data *sd)
 {
 	if( !(sd->sc.option&(OPTION_RIDING|OPTION_FALCON|OPTION_DRAGON|OPTION_MADOGEAR))
 #ifdef NEW_CARTS
-		&& sd->sc.data[SC_PUSH_CART] )
+		&& sd->sc.getSCE(SC_PUSH_CART) )
 		pc_setcart(sd,0);
 #else
 		)
@@ -12509,9 +12501,9 @@ static void clif_parse_UseSkillToPos_homun(struct homun_data *hd, struct map_ses
 	}
 
 #ifdef RENEWAL
-	if (hd->sc.data[SC_BASILICA_CELL])
+	if (hd->sc.getSCE(SC_BASILICA_CELL))
 #else
-	if (hd->sc.data[SC_BASILICA])
+	if (hd->sc.getSCE(SC_BASILICA))
 #endif
 		return;
 	lv = hom_checkskill(hd, skill_id);
@@ -12562,9 +12554,9 @@ static void clif_parse_UseSkillToPos_mercenary(struct mercenary_data *md, struct
 	}
 
 #ifdef RENEWAL
-	if (md->sc.data[SC_BASILICA_CELL])
+	if (md->sc.getSCE(SC_BASILICA_CELL))
 #else
-	if (md->sc.data[SC_BASILICA])
+	if (md->sc.getSCE(SC_BASILICA))
 #endif
 		return;
 	lv = mercenary_checkskill(md, skill_id);
@@ -12648,7 +12640,7 @@ void clif_parse_skill_toid( struct map_session_data* sd, uint16 skill_id, uint16
 		return;
 
 #ifndef RENEWAL
-	if( sd->sc.data[SC_BASILICA] && (skill_id != HP_BASILICA || sd->sc.data[SC_BASILICA]->val4 != sd->bl.id) )
+	if( sd->sc.getSCE(SC_BASILICA) && (skill_id != HP_BASILICA || sd->sc.getSCE(SC_BASILICA)->val4 != sd->bl.id) )
 		return; // On basilica only caster can use Basilica again to stop it.
 #endif
 
@@ -12764,7 +12756,7 @@ static void clif_parse_UseSkillToPosSub(int fd, struct map_session_data *sd, uin
 		return;
 
 #ifndef RENEWAL
-	if( sd->sc.data[SC_BASILICA] && (skill_id != HP_BASILICA || sd->sc.data[SC_BASILICA]->val4 != sd->bl.id) )
+	if( sd->sc.getSCE(SC_BASILICA) && (skill_id != HP_BASILICA || sd->sc.getSCE(SC_BASILICA)->val4 != sd->bl.id) )
 		return; // On basilica only caster can use Basilica again to stop it.
 #endif
 
@@ -13820,7 +13812,7 @@ void clif_parse_OpenVending(int fd, struct map_session_data* sd){
 		}
 	}
 
-	if( sd->sc.data[SC_NOCHAT] && sd->sc.data[SC_NOCHAT]->val1&MANNER_NOROOM )
+	if( sd->sc.getSCE(SC_NOCHAT) && sd->sc.getSCE(SC_NOCHAT)->val1&MANNER_NOROOM )
 		return;
 	if( map_getmapflag(sd->bl.m, MF_NOVENDING) ) {
 		clif_displaymessage (sd->fd, msg_txt(sd,276)); // "You can't open a shop on this map"
@@ -1532,7 +1532,7 @@ void guild_guildaura_refresh(struct map_session_data *sd, uint16 skill_id, uint1
 	std::shared_ptr<s_skill_unit_group> group;
 	sc_type type = status_skill2sc(skill_id);
 
-	if( sd->sc.data[type] && (group = skill_id2group(sd->sc.data[type]->val4)) ) {
+	if( sd->sc.getSCE(type) && (group = skill_id2group(sd->sc.getSCE(type)->val4)) ) {
 		skill_delunitgroup(group);
 		status_change_end(&sd->bl,type,INVALID_TIMER);
 	}
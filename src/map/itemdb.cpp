@@ -1021,6 +1021,9 @@ uint64 ItemDatabase::parseBodyNode(const YAML::Node &node) {
 		}
 
 		item->script = parse_script(script.c_str(), this->getCurrentFile().c_str(), node["Script"].Mark().line + 1, SCRIPT_IGNORE_EXTERNAL_BRACKETS);
+		this->scriptSources[nameid] = { script, this->getCurrentFile(), node["Script"].Mark().line + 1 };
+		// Most item scripts only give bonuses, these do not need to be run on every status calculation
+		script_compile_bonus(item->script);
 	} else {
 		if (!exists) 
 			item->script = nullptr;
@@ -1038,6 +1041,7 @@ uint64 ItemDatabase::parseBodyNode(const YAML::Node &node) {
 		}
 
 		item->equip_script = parse_script(script.c_str(), this->getCurrentFile().c_str(), node["EquipScript"].Mark().line + 1, SCRIPT_IGNORE_EXTERNAL_BRACKETS);
+		this->equipScriptSources[nameid] = { script, this->getCurrentFile(), node["EquipScript"].Mark().line + 1 };
 	} else {
 		if (!exists)
 			item->equip_script = nullptr;
@@ -1055,6 +1059,7 @@ uint64 ItemDatabase::parseBodyNode(const YAML::Node &node) {
 		}
 
 		item->unequip_script = parse_script(script.c_str(), this->getCurrentFile().c_str(), node["UnEquipScript"].Mark().line + 1, SCRIPT_IGNORE_EXTERNAL_BRACKETS);
+		this->unequipScriptSources[nameid] = { script, this->getCurrentFile(), node["UnEquipScript"].Mark().line + 1 };
 	} else {
 		if (!exists)
 			item->unequip_script = nullptr;
@@ -1136,6 +1141,179 @@ void ItemDatabase::loadingFinished(){
 
 		item_db.put( ITEMID_DUMMY, dummy_item );
 	}
+
+	// The snapshot was written already
+	this->scriptSources.clear();
+	this->equipScriptSources.clear();
+	this->unequipScriptSources.clear();
+}
+
+/// Version of the snapshot of the item database, has to be increased when parseBodyNode or item_data change.
+uint32 ItemDatabase::getSnapshotVersion(){
+	return 1;
+}
+
+/// The item database depends on the script constants, which can be changed by the build as well.
+uint64 ItemDatabase::getSnapshotDependencies(){
+	uint64 hash = constant_db.getSourceHash();
+
+	return YamlDatabase::snapshotBuildHash( hash, sizeof( struct item_data ) );
+}
+
+/**
+ * Writes or reads an item script to or from a snapshot.
+ * Scripts are stored as their source code and compiled again, when reading the snapshot.
+ * @param snapshot: Snapshot
+ * @param script: Compiled script
+ * @param source: Source of the script, when writing the snapshot
+ * @param bonus: Whether the script may be compiled to constant bonuses
+ * @return Whether the script was serialized successfully
+ */
+bool ItemDatabase::serializeScript( YamlSnapshot& snapshot, struct script_code*& script, s_item_script_source& source, bool bonus ){
+	bool exists = script != nullptr;
+
+	snapshot.value( exists );
+
+	if( !exists ){
+		return true;
+	}
+
+	// The source of the script was not recorded
+	if( !snapshot.isReading() && source.line == 0 ){
+		return false;
+	}
+
+	snapshot.value( source.code );
+	snapshot.value( source.file );
+	snapshot.value( source.line );
+
+	if( snapshot.isReading() && !snapshot.hasFailed() ){
+		script = parse_script( source.code.c_str(), source.file.c_str(), source.line, SCRIPT_IGNORE_EXTERNAL_BRACKETS );
+
+		if( bonus ){
+			script_compile_bonus( script );
+		}
+	}
+
+	return !snapshot.hasFailed();
+}
+
+/**
+ * Writes or reads an item to or from a snapshot.
+ * Only contains what is parsed from the item database, everything else is loaded after it anyway.
+ * @param snapshot: Snapshot
+ * @param item: Item
+ * @return Whether the item was serialized successfully
+ */
+bool ItemDatabase::serializeEntry( YamlSnapshot& snapshot, std::shared_ptr<item_data> item ){
+	// Bitfields are serialized through a copy
+	uint8 available = item->flag.available, no_refine = item->flag.no_refine, autoequip = item->flag.autoequip, guid = item->flag.guid;
+
+	snapshot.value( item->nameid );
+	snapshot.value( item->name );
+	snapshot.value( item->ename );
+	snapshot.value( item->value_buy );
+	snapshot.value( item->value_sell );
+	snapshot.value( item->type );
+	snapshot.value( item->subtype );
+	snapshot.value( item->maxchance );
+	snapshot.value( item->sex );
+	snapshot.value( item->equip );
+	snapshot.value( item->weight );
+	snapshot.value( item->atk );
+	snapshot.value( item->def );
+	snapshot.value( item->range );
+	snapshot.value( item->slots );
+	snapshot.value( item->look );
+	snapshot.value( item->elv );
+	snapshot.value( item->weapon_level );
+	snapshot.value( item->armor_level );
+	snapshot.value( item->view_id );
+	snapshot.value( item->elvmax );
+#ifdef RENEWAL
+	snapshot.value( item->matk );
+#endif
+	snapshot.value( item->class_base );
+	snapshot.value( item->class_upper );
+	snapshot.value( available );
+	snapshot.value( item->flag.no_equip );
+	snapshot.value( no_refine );
+	snapshot.value( item->flag.delay_consume );
+	snapshot.value( item->flag.trade_restriction );
+	snapshot.value( autoequip );
+	snapshot.value( item->flag.buyingstore );
+	snapshot.value( item->flag.dead_branch );
+	snapshot.value( item->flag.group );
+	snapshot.value( guid );
+	snapshot.value( item->flag.broadcast );
+	snapshot.value( item->flag.bindOnEquip );
+	snapshot.value( item->flag.dropEffect );
+	snapshot.value( item->stack );
+	snapshot.value( item->item_usage );
+	snapshot.value( item->gm_lv_trade_override );
+	snapshot.value( item->delay );
+
+	item->flag.available = available;
+	item->flag.no_refine = no_refine;
+	item->flag.autoequip = autoequip;
+	item->flag.guid = guid;
+
+	if( snapshot.hasFailed() ){
+		return false;
+	}
+
+	s_item_script_source script = {}, equip_script = {}, unequip_script = {};
+
+	if( !snapshot.isReading() ){
+		script = util::umap_get( this->scriptSources, item->nameid, script );
+		equip_script = util::umap_get( this->equipScriptSources, item->nameid, equip_script );
+		unequip_script = util::umap_get( this->unequipScriptSources, item->nameid, unequip_script );
+	}
+
+	return this->serializeScript( snapshot, item->script, script, true )
+		&& this->serializeScript( snapshot, item->equip_script, equip_script, false )
+		&& this->serializeScript( snapshot, item->unequip_script, unequip_script, false );
+}
+
+/// Writes or reads the items and their name lookups, since names do not have to be unique.
+bool ItemDatabase::serializeSnapshot( YamlSnapshot& snapshot ){
+	if( !TypesafeCachedYamlDatabase::serializeSnapshot( snapshot ) ){
+		return false;
+	}
+
+	for( auto* names : { &this->aegisNameToItemDataMap, &this->nameToItemDataMap } ){
+		uint32 count = static_cast<uint32>( names->size() );
+
+		snapshot.value( count );
+
+		if( snapshot.isReading() ){
+			for( uint32 i = 0; i < count && !snapshot.hasFailed(); i++ ){
+				std::string name;
+				t_itemid nameid = 0;
+
+				snapshot.value( name );
+				snapshot.value( nameid );
+
+				std::shared_ptr<item_data> item = this->find( nameid );
+
+				if( item == nullptr ){
+					return false;
+				}
+
+				(*names)[name] = item;
+			}
+		}else{
+			for( auto& pair : *names ){
+				std::string name = pair.first;
+				t_itemid nameid = pair.second->nameid;
+
+				snapshot.value( name );
+				snapshot.value( nameid );
+			}
+		}
+	}
+
+	return !snapshot.hasFailed();
 }
 
 /**
@@ -2028,6 +2206,7 @@ static void itemdb_read_combos(const char* basedir, bool silent) {
 
 			entry->nameid = {};
 			entry->script = parse_script(str[1], path, lines, 0);
+			script_compile_bonus(entry->script);
 			entry->id = count;
 
 			// Store into first item
@@ -2578,6 +2757,7 @@ uint64 RandomOptionDatabase::parseBodyNode(const YAML::Node &node) {
 		}
 
 		randopt->script = parse_script(script.c_str(), this->getCurrentFile().c_str(), id, SCRIPT_IGNORE_EXTERNAL_BRACKETS);
+		script_compile_bonus(randopt->script);
 	}
 
 	if (!exists)
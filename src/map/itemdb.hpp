@@ -1023,12 +1023,28 @@ public:
 
 extern RandomOptionGroupDatabase random_option_group;
 
+/// Source code of an item script, the compiled script can not be stored in a snapshot
+struct s_item_script_source {
+	std::string code;
+	std::string file;
+	int32 line;
+};
+
 class ItemDatabase : public TypesafeCachedYamlDatabase<t_itemid, item_data> {
 private:
 	std::unordered_map<std::string, std::shared_ptr<item_data>> nameToItemDataMap;
 	std::unordered_map<std::string, std::shared_ptr<item_data>> aegisNameToItemDataMap;
+	// Sources of the scripts, until the snapshot was written
+	std::unordered_map<t_itemid, s_item_script_source> scriptSources, equipScriptSources, unequipScriptSources;
 
 	e_sex defaultGender( const YAML::Node &node, std::shared_ptr<item_data> id );
+	bool serializeScript( YamlSnapshot& snapshot, struct script_code*& script, s_item_script_source& source, bool bonus );
+
+protected:
+	uint32 getSnapshotVersion() override;
+	uint64 getSnapshotDependencies() override;
+	bool serializeEntry( YamlSnapshot& snapshot, std::shared_ptr<item_data> item ) override;
+	bool serializeSnapshot( YamlSnapshot& snapshot ) override;
 
 public:
 	ItemDatabase() : TypesafeCachedYamlDatabase("ITEM_DB", 2, 1) {
@@ -1043,6 +1059,9 @@ public:
 
 		this->nameToItemDataMap.clear();
 		this->aegisNameToItemDataMap.clear();
+		this->scriptSources.clear();
+		this->equipScriptSources.clear();
+		this->unequipScriptSources.clear();
 	}
 
 	// Additional
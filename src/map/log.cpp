@@ -3,13 +3,19 @@
 
 #include "log.hpp"
 
+#include <memory>
+#include <stdarg.h>
 #include <stdlib.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "../common/cbasetypes.hpp"
 #include "../common/nullpo.hpp"
 #include "../common/showmsg.hpp"
 #include "../common/sql.hpp" // SQL_INNODB
 #include "../common/strlib.hpp"
+#include "../common/timer.hpp"
 
 #include "battle.hpp"
 #include "homunculus.hpp"
@@ -54,6 +60,199 @@ struct Log_Config log_config;
 #define LOG_QUERY "INSERT DELAYED"
 #endif
 
+/// Maximum length of a batch query, stays well below the default max_allowed_packet
+#define LOG_BATCH_MAXLEN 65536
+/// Key of the log queries on the asynchronous connection
+#define LOG_SQL_KEY 0
+
+/// Rows of a log table that were not sent to the database yet
+struct s_log_batch {
+	std::string query; // INSERT with all rows
+	size_t prefix; // length of the INSERT in front of the first row
+	std::vector<size_t> row_ends; // end of each row in the query, the rows are separated by a comma
+};
+
+static std::unordered_map<std::string, s_log_batch> log_batches; // INSERT prefix -> batch
+static std::unordered_map<std::string, FILE*> log_files; // log files opened since the last flush
+static int log_pending = 0; // batches that were sent, but not written yet
+
+/// Counters of the log writer
+static struct {
+	uint64 rows; // rows queued for the database
+	uint64 queries; // batches sent to the database
+	uint64 failed; // batches the database did not accept
+	uint64 lost; // rows the database did not accept on their own either
+	uint64 stalls; // times the map-server had to wait for the database
+	int max_pending; // highest number of batches that waited for the database
+	t_tick last_warning;
+} log_stats;
+
+
+/// Writes the rows of a failed batch one by one, so a single bad row does not lose the others.
+static void log_sql_retry(const s_log_batch& batch)
+{
+	std::vector<std::string> queries;
+	std::string prefix = batch.query.substr(0, batch.prefix);
+	size_t start = batch.prefix;
+
+	for( size_t end : batch.row_ends )
+	{
+		queries.push_back(prefix + batch.query.substr(start, end - start));
+		start = end + 1;
+	}
+
+	size_t rows = queries.size();
+
+	log_pending++;
+	log_stats.queries += rows;
+
+	SqlAsync_Queue(LOG_SQL_KEY, std::move(queries), [rows]( const s_sql_async_result& result ){
+		log_pending--;
+		log_stats.lost += result.failed;
+
+		if( result.failed > 0 )
+			ShowError("log_sql_retry: %" PRIuPTR " of %" PRIuPTR " rows of a failed log batch could not be written and are lost.\n", result.failed, rows);
+	});
+}
+
+
+/// Sends the rows of a batch to the log database.
+/// If the database falls behind, the map-server waits for it instead of dropping logs.
+/// If the database rejects the batch, its rows are written one by one.
+static void log_sql_send(s_log_batch& batch)
+{
+	std::vector<std::string> queries;
+
+	if( batch.row_ends.empty() )
+		return;
+
+	if( log_pending >= log_config.max_pending )
+	{
+		log_stats.stalls++;
+		if( DIFF_TICK(gettick(), log_stats.last_warning) >= 60000 )
+		{
+			ShowWarning("log_sql_send: The log database can not keep up, %d batches are pending (waited %" PRIu64 " times so far).\n", log_pending, log_stats.stalls);
+			log_stats.last_warning = gettick();
+		}
+		SqlAsync_Flush(LOG_SQL_KEY);
+	}
+
+	// the rows are kept until the batch was written, in case they have to be written again
+	std::shared_ptr<s_log_batch> sent = std::make_shared<s_log_batch>();
+
+	sent->query.swap(batch.query);
+	sent->prefix = batch.prefix;
+	sent->row_ends.swap(batch.row_ends);
+	queries.push_back(sent->query);
+
+	log_pending++;
+	log_stats.queries++;
+	log_stats.max_pending = max(log_stats.max_pending, log_pending);
+
+	SqlAsync_Queue(LOG_SQL_KEY, std::move(queries), [sent]( const s_sql_async_result& result ){
+		log_pending--;
+
+		if( result.failed == 0 )
+			return;
+
+		log_stats.failed++;
+
+		if( sent->row_ends.size() > 1 )
+			log_sql_retry(*sent);
+		else
+		{
+			log_stats.lost++;
+			ShowError("log_sql_send: A log row could not be written and is lost.\n");
+		}
+	});
+}
+
+
+/// Queues a row for a log table.
+/// @param table: name of the table
+/// @param columns: column list, the first column receives the time of the event
+/// @param format: values of the other columns, as if it was sprintf
+static void log_sql_row(const char* table, const char* columns, const char* format, ...)
+{
+	StringBuf buf;
+	va_list ap;
+
+	StringBuf_Init(&buf);
+	StringBuf_Printf(&buf, LOG_QUERY " INTO `%s` (%s) VALUES ", table, columns);
+
+	s_log_batch& batch = log_batches[StringBuf_Value(&buf)];
+
+	if( batch.row_ends.empty() )
+	{
+		batch.query = StringBuf_Value(&buf);
+		batch.prefix = batch.query.length();
+	}
+	else
+		batch.query += ',';
+
+	// the rows are written later, so the time of the event is stored instead of NOW()
+	StringBuf_Clear(&buf);
+	StringBuf_Printf(&buf, "(FROM_UNIXTIME(%" PRIu64 "),", (uint64)time(NULL));
+	va_start(ap, format);
+	StringBuf_Vprintf(&buf, format, ap);
+	va_end(ap);
+	StringBuf_AppendStr(&buf, ")");
+
+	batch.query += StringBuf_Value(&buf);
+	batch.row_ends.push_back(batch.query.length());
+	log_stats.rows++;
+	StringBuf_Destroy(&buf);
+
+	if( (int)batch.row_ends.size() >= log_config.batch_rows || batch.query.length() >= LOG_BATCH_MAXLEN )
+		log_sql_send(batch);
+}
+
+
+/// Escapes a string for a log row.
+/// The output buffer must be at least len*2+1 in size.
+static const char* log_sql_escape(char* out_to, const char* from, size_t len)
+{
+	Sql_EscapeStringLen(logmysql_handle, out_to, from, safestrnlen(from, len));
+	return out_to;
+}
+
+
+/// Returns the log file for the given path.
+/// The file is kept open until the next flush.
+static FILE* log_file(const char* path)
+{
+	auto file = log_files.find(path);
+
+	if( file != log_files.end() )
+		return file->second;
+
+	FILE* fp = fopen(path, "a");
+
+	if( fp != NULL )
+		log_files[path] = fp;
+	return fp;
+}
+
+
+/// Sends all collected rows to the database and closes the log files.
+/// The files are opened again for the next event, so they can be rotated.
+static void log_flush(void)
+{
+	for( auto& batch : log_batches )
+		log_sql_send(batch.second);
+
+	for( auto& file : log_files )
+		fclose(file.second);
+	log_files.clear();
+}
+
+
+static TIMER_FUNC(log_flush_timer)
+{
+	log_flush();
+	return 0;
+}
+
 
 /// obtain log type character for item/zeny logs
 static char log_picktype2char(e_log_pick_type type)
@@ -172,17 +371,10 @@ void log_branch(struct map_session_data* sd)
 		return;
 
 	if( log_config.sql_logs ) {
-		SqlStmt* stmt;
-		stmt = SqlStmt_Malloc(logmysql_handle);
-		if( SQL_SUCCESS != SqlStmt_Prepare(stmt, LOG_QUERY " INTO `%s` (`branch_date`, `account_id`, `char_id`, `char_name`, `map`) VALUES (NOW(), '%d', '%d', ?, '%s')", log_config.log_branch, sd->status.account_id, sd->status.char_id, mapindex_id2name(sd->mapindex) )
-		||  SQL_SUCCESS != SqlStmt_BindParam(stmt, 0, SQLDT_STRING, sd->status.name, strnlen(sd->status.name, NAME_LENGTH))
-		||  SQL_SUCCESS != SqlStmt_Execute(stmt) )
-		{
-			SqlStmt_ShowDebug(stmt);
-			SqlStmt_Free(stmt);
-			return;
-		}
-		SqlStmt_Free(stmt);
+		char esc_name[NAME_LENGTH*2+1];
+
+		log_sql_row(log_config.log_branch, "`branch_date`, `account_id`, `char_id`, `char_name`, `map`", "'%d', '%d', '%s', '%s'",
+			sd->status.account_id, sd->status.char_id, log_sql_escape(esc_name, sd->status.name, NAME_LENGTH), mapindex_id2name(sd->mapindex));
 	}
 	else
 	{
@@ -190,12 +382,11 @@ void log_branch(struct map_session_data* sd)
 		time_t curtime;
 		FILE* logfp;
 
-		if( ( logfp = fopen(log_config.log_branch, "a") ) == NULL )
+		if( ( logfp = log_file(log_config.log_branch) ) == NULL )
 			return;
 		time(&curtime);
 		strftime(timestring, sizeof(timestring), log_timestamp_format, localtime(&curtime));
 		fprintf(logfp,"%s - %s[%d:%d]\t%s\n", timestring, sd->status.name, sd->status.account_id, sd->status.char_id, mapindex_id2name(sd->mapindex));
-		fclose(logfp);
 	}
 }
 
@@ -213,32 +404,35 @@ void log_pick(int id, int16 m, e_log_pick_type type, int amount, struct item* it
 
 	if( log_config.sql_logs )
 	{
+		static std::string columns;
 		int i;
-		SqlStmt* stmt = SqlStmt_Malloc(logmysql_handle);
 		StringBuf buf;
+
 		StringBuf_Init(&buf);
 
-		StringBuf_Printf(&buf, "%s INTO `%s` (`time`, `char_id`, `type`, `nameid`, `amount`, `refine`, `map`, `unique_id`, `bound`, `enchantgrade`", LOG_QUERY, log_config.log_pick);
-		for (i = 0; i < MAX_SLOTS; ++i)
-			StringBuf_Printf(&buf, ", `card%d`", i);
-		for (i = 0; i < MAX_ITEM_RDM_OPT; ++i) {
-			StringBuf_Printf(&buf, ", `option_id%d`", i);
-			StringBuf_Printf(&buf, ", `option_val%d`", i);
-			StringBuf_Printf(&buf, ", `option_parm%d`", i);
+		if( columns.empty() )
+		{
+			StringBuf_AppendStr(&buf, "`time`, `char_id`, `type`, `nameid`, `amount`, `refine`, `map`, `unique_id`, `bound`, `enchantgrade`");
+			for (i = 0; i < MAX_SLOTS; ++i)
+				StringBuf_Printf(&buf, ", `card%d`", i);
+			for (i = 0; i < MAX_ITEM_RDM_OPT; ++i) {
+				StringBuf_Printf(&buf, ", `option_id%d`", i);
+				StringBuf_Printf(&buf, ", `option_val%d`", i);
+				StringBuf_Printf(&buf, ", `option_parm%d`", i);
+			}
+			columns = StringBuf_Value(&buf);
+			StringBuf_Clear(&buf);
 		}
-		StringBuf_Printf(&buf, ") VALUES(NOW(),'%u','%c','%u','%d','%d','%s','%" PRIu64 "','%d','%d'",
+
+		StringBuf_Printf(&buf, "'%u','%c','%u','%d','%d','%s','%" PRIu64 "','%d','%d'",
 			id, log_picktype2char(type), itm->nameid, amount, itm->refine, map_getmapdata(m)->name[0] ? map_getmapdata(m)->name : "", itm->unique_id, itm->bound, itm->enchantgrade);
 
 		for (i = 0; i < MAX_SLOTS; i++)
 			StringBuf_Printf(&buf, ",'%u'", itm->card[i]);
 		for (i = 0; i < MAX_ITEM_RDM_OPT; i++)
 			StringBuf_Printf(&buf, ",'%d','%d','%d'", itm->option[i].id, itm->option[i].value, itm->option[i].param);
-		StringBuf_Printf(&buf, ")");
 
-		if (SQL_SUCCESS != SqlStmt_PrepareStr(stmt, StringBuf_Value(&buf)) || SQL_SUCCESS != SqlStmt_Execute(stmt))
-			SqlStmt_ShowDebug(stmt);
-
-		SqlStmt_Free(stmt);
+		log_sql_row(log_config.log_pick, columns.c_str(), "%s", StringBuf_Value(&buf));
 		StringBuf_Destroy(&buf);
 	}
 	else
@@ -247,12 +441,11 @@ void log_pick(int id, int16 m, e_log_pick_type type, int amount, struct item* it
 		time_t curtime;
 		FILE* logfp;
 
-		if( ( logfp = fopen(log_config.log_pick, "a") ) == NULL )
+		if( ( logfp = log_file(log_config.log_pick) ) == NULL )
 			return;
 		time(&curtime);
 		strftime(timestring, sizeof(timestring), log_timestamp_format, localtime(&curtime));
 		fprintf(logfp,"%s - %d\t%c\t%u,%d,%d,%u,%u,%u,%u,%s,'%" PRIu64 "',%d,%d\n", timestring, id, log_picktype2char(type), itm->nameid, amount, itm->refine, itm->card[0], itm->card[1], itm->card[2], itm->card[3], map_getmapdata(m)->name[0]?map_getmapdata(m)->name:"", itm->unique_id, itm->bound, itm->enchantgrade);
-		fclose(logfp);
 	}
 }
 
@@ -281,12 +474,8 @@ void log_zeny(struct map_session_data* sd, e_log_pick_type type, struct map_sess
 
 	if( log_config.sql_logs )
 	{
-		if( SQL_ERROR == Sql_Query(logmysql_handle, LOG_QUERY " INTO `%s` (`time`, `char_id`, `src_id`, `type`, `amount`, `map`) VALUES (NOW(), '%d', '%d', '%c', '%d', '%s')",
-			log_config.log_zeny, sd->status.char_id, src_sd->status.char_id, log_picktype2char(type), amount, mapindex_id2name(sd->mapindex)) )
-		{
-			Sql_ShowDebug(logmysql_handle);
-			return;
-		}
+		log_sql_row(log_config.log_zeny, "`time`, `char_id`, `src_id`, `type`, `amount`, `map`", "'%d', '%d', '%c', '%d', '%s'",
+			sd->status.char_id, src_sd->status.char_id, log_picktype2char(type), amount, mapindex_id2name(sd->mapindex));
 	}
 	else
 	{
@@ -294,12 +483,11 @@ void log_zeny(struct map_session_data* sd, e_log_pick_type type, struct map_sess
 		time_t curtime;
 		FILE* logfp;
 
-		if( ( logfp = fopen(log_config.log_zeny, "a") ) == NULL )
+		if( ( logfp = log_file(log_config.log_zeny) ) == NULL )
 			return;
 		time(&curtime);
 		strftime(timestring, sizeof(timestring), log_timestamp_format, localtime(&curtime));
 		fprintf(logfp, "%s - %s[%d]\t%s[%d]\t%d\t\n", timestring, src_sd->status.name, src_sd->status.account_id, sd->status.name, sd->status.account_id, amount);
-		fclose(logfp);
 	}
 }
 
@@ -314,12 +502,8 @@ void log_mvpdrop(struct map_session_data* sd, int monster_id, t_itemid nameid, t
 
 	if( log_config.sql_logs )
 	{
-		if( SQL_ERROR == Sql_Query(logmysql_handle, LOG_QUERY " INTO `%s` (`mvp_date`, `kill_char_id`, `monster_id`, `prize`, `mvpexp`, `map`) VALUES (NOW(), '%d', '%d', '%u', '%" PRIu64 "', '%s') ",
-			log_config.log_mvpdrop, sd->status.char_id, monster_id, nameid, exp, mapindex_id2name(sd->mapindex)) )
-		{
-			Sql_ShowDebug(logmysql_handle);
-			return;
-		}
+		log_sql_row(log_config.log_mvpdrop, "`mvp_date`, `kill_char_id`, `monster_id`, `prize`, `mvpexp`, `map`", "'%d', '%d', '%u', '%" PRIu64 "', '%s'",
+			sd->status.char_id, monster_id, nameid, exp, mapindex_id2name(sd->mapindex));
 	}
 	else
 	{
@@ -327,12 +511,11 @@ void log_mvpdrop(struct map_session_data* sd, int monster_id, t_itemid nameid, t
 		time_t curtime;
 		FILE* logfp;
 
-		if( ( logfp = fopen(log_config.log_mvpdrop,"a") ) == NULL )
+		if( ( logfp = log_file(log_config.log_mvpdrop) ) == NULL )
 			return;
 		time(&curtime);
 		strftime(timestring, sizeof(timestring), log_timestamp_format, localtime(&curtime));
 		fprintf(logfp,"%s - %s[%d:%d]\t%d\t%u,%" PRIu64 "\n", timestring, sd->status.name, sd->status.account_id, sd->status.char_id, monster_id, nameid, exp);
-		fclose(logfp);
 	}
 }
 
@@ -348,19 +531,11 @@ void log_atcommand(struct map_session_data* sd, const char* message)
 
 	if( log_config.sql_logs )
 	{
-		SqlStmt* stmt;
+		char esc_name[NAME_LENGTH*2+1];
+		char esc_message[255*2+1];
 
-		stmt = SqlStmt_Malloc(logmysql_handle);
-		if( SQL_SUCCESS != SqlStmt_Prepare(stmt, LOG_QUERY " INTO `%s` (`atcommand_date`, `account_id`, `char_id`, `char_name`, `map`, `command`) VALUES (NOW(), '%d', '%d', ?, '%s', ?)", log_config.log_gm, sd->status.account_id, sd->status.char_id, mapindex_id2name(sd->mapindex) )
-		||  SQL_SUCCESS != SqlStmt_BindParam(stmt, 0, SQLDT_STRING, sd->status.name, strnlen(sd->status.name, NAME_LENGTH))
-		||  SQL_SUCCESS != SqlStmt_BindParam(stmt, 1, SQLDT_STRING, (char*)message, safestrnlen(message, 255))
-		||  SQL_SUCCESS != SqlStmt_Execute(stmt) )
-		{
-			SqlStmt_ShowDebug(stmt);
-			SqlStmt_Free(stmt);
-			return;
-		}
-		SqlStmt_Free(stmt);
+		log_sql_row(log_config.log_gm, "`atcommand_date`, `account_id`, `char_id`, `char_name`, `map`, `command`", "'%d', '%d', '%s', '%s', '%s'",
+			sd->status.account_id, sd->status.char_id, log_sql_escape(esc_name, sd->status.name, NAME_LENGTH), mapindex_id2name(sd->mapindex), log_sql_escape(esc_message, message, 255));
 	}
 	else
 	{
@@ -368,12 +543,11 @@ void log_atcommand(struct map_session_data* sd, const char* message)
 		time_t curtime;
 		FILE* logfp;
 
-		if( ( logfp = fopen(log_config.log_gm, "a") ) == NULL )
+		if( ( logfp = log_file(log_config.log_gm) ) == NULL )
 			return;
 		time(&curtime);
 		strftime(timestring, sizeof(timestring), log_timestamp_format, localtime(&curtime));
 		fprintf(logfp, "%s - %s[%d]: %s\n", timestring, sd->status.name, sd->status.account_id, message);
-		fclose(logfp);
 	}
 }
 
@@ -386,18 +560,11 @@ void log_npc( struct npc_data* nd, const char* message ){
 
 	if( log_config.sql_logs )
 	{
-		SqlStmt* stmt;
-		stmt = SqlStmt_Malloc(logmysql_handle);
-		if( SQL_SUCCESS != SqlStmt_Prepare(stmt, LOG_QUERY " INTO `%s` (`npc_date`, `char_name`, `map`, `mes`) VALUES (NOW(), ?, '%s', ?)", log_config.log_npc, map_mapid2mapname(nd->bl.m) )
-		||  SQL_SUCCESS != SqlStmt_BindParam(stmt, 0, SQLDT_STRING, nd->name, strnlen(nd->name, NAME_LENGTH))
-		||  SQL_SUCCESS != SqlStmt_BindParam(stmt, 1, SQLDT_STRING, (char*)message, safestrnlen(message, 255))
-		||  SQL_SUCCESS != SqlStmt_Execute(stmt) )
-		{
-			SqlStmt_ShowDebug(stmt);
-			SqlStmt_Free(stmt);
-			return;
-		}
-		SqlStmt_Free(stmt);
+		char esc_name[NAME_LENGTH*2+1];
+		char esc_message[255*2+1];
+
+		log_sql_row(log_config.log_npc, "`npc_date`, `char_name`, `map`, `mes`", "'%s', '%s', '%s'",
+			log_sql_escape(esc_name, nd->name, NAME_LENGTH), map_mapid2mapname(nd->bl.m), log_sql_escape(esc_message, message, 255));
 	}
 	else
 	{
@@ -405,12 +572,11 @@ void log_npc( struct npc_data* nd, const char* message ){
 		time_t curtime;
 		FILE* logfp;
 
-		if( ( logfp = fopen(log_config.log_npc, "a") ) == NULL )
+		if( ( logfp = log_file(log_config.log_npc) ) == NULL )
 			return;
 		time(&curtime);
 		strftime(timestring, sizeof(timestring), log_timestamp_format, localtime(&curtime));
 		fprintf(logfp, "%s - %s: %s\n", timestring, nd->name, message);
-		fclose(logfp);
 	}
 }
 
@@ -424,18 +590,11 @@ void log_npc(struct map_session_data* sd, const char* message)
 
 	if( log_config.sql_logs )
 	{
-		SqlStmt* stmt;
-		stmt = SqlStmt_Malloc(logmysql_handle);
-		if( SQL_SUCCESS != SqlStmt_Prepare(stmt, LOG_QUERY " INTO `%s` (`npc_date`, `account_id`, `char_id`, `char_name`, `map`, `mes`) VALUES (NOW(), '%d', '%d', ?, '%s', ?)", log_config.log_npc, sd->status.account_id, sd->status.char_id, mapindex_id2name(sd->mapindex) )
-		||  SQL_SUCCESS != SqlStmt_BindParam(stmt, 0, SQLDT_STRING, sd->status.name, strnlen(sd->status.name, NAME_LENGTH))
-		||  SQL_SUCCESS != SqlStmt_BindParam(stmt, 1, SQLDT_STRING, (char*)message, safestrnlen(message, 255))
-		||  SQL_SUCCESS != SqlStmt_Execute(stmt) )
-		{
-			SqlStmt_ShowDebug(stmt);
-			SqlStmt_Free(stmt);
-			return;
-		}
-		SqlStmt_Free(stmt);
+		char esc_name[NAME_LENGTH*2+1];
+		char esc_message[255*2+1];
+
+		log_sql_row(log_config.log_npc, "`npc_date`, `account_id`, `char_id`, `char_name`, `map`, `mes`", "'%d', '%d', '%s', '%s', '%s'",
+			sd->status.account_id, sd->status.char_id, log_sql_escape(esc_name, sd->status.name, NAME_LENGTH), mapindex_id2name(sd->mapindex), log_sql_escape(esc_message, message, 255));
 	}
 	else
 	{
@@ -443,12 +602,11 @@ void log_npc(struct map_session_data* sd, const char* message)
 		time_t curtime;
 		FILE* logfp;
 
-		if( ( logfp = fopen(log_config.log_npc, "a") ) == NULL )
+		if( ( logfp = log_file(log_config.log_npc) ) == NULL )
 			return;
 		time(&curtime);
 		strftime(timestring, sizeof(timestring), log_timestamp_format, localtime(&curtime));
 		fprintf(logfp, "%s - %s[%d]: %s\n", timestring, sd->status.name, sd->status.account_id, message);
-		fclose(logfp);
 	}
 }
 
@@ -471,19 +629,11 @@ void log_chat(e_log_chat_type type, int type_id, int src_charid, int src_accid,
 	}
 
 	if( log_config.sql_logs ) {
-		SqlStmt* stmt;
+		char esc_name[NAME_LENGTH*2+1];
+		char esc_message[CHAT_SIZE_MAX*2+1];
 
-		stmt = SqlStmt_Malloc(logmysql_handle);
-		if( SQL_SUCCESS != SqlStmt_Prepare(stmt, LOG_QUERY " INTO `%s` (`time`, `type`, `type_id`, `src_charid`, `src_accountid`, `src_map`, `src_map_x`, `src_map_y`, `dst_charname`, `message`) VALUES (NOW(), '%c', '%d', '%d', '%d', '%s', '%d', '%d', ?, ?)", log_config.log_chat, log_chattype2char(type), type_id, src_charid, src_accid, mapname, x, y)
-		||  SQL_SUCCESS != SqlStmt_BindParam(stmt, 0, SQLDT_STRING, (char*)dst_charname, safestrnlen(dst_charname, NAME_LENGTH))
-		||  SQL_SUCCESS != SqlStmt_BindParam(stmt, 1, SQLDT_STRING, (char*)message, safestrnlen(message, CHAT_SIZE_MAX))
-		||  SQL_SUCCESS != SqlStmt_Execute(stmt) )
-		{
-			SqlStmt_ShowDebug(stmt);
-			SqlStmt_Free(stmt);
-			return;
-		}
-		SqlStmt_Free(stmt);
+		log_sql_row(log_config.log_chat, "`time`, `type`, `type_id`, `src_charid`, `src_accountid`, `src_map`, `src_map_x`, `src_map_y`, `dst_charname`, `message`", "'%c', '%d', '%d', '%d', '%s', '%d', '%d', '%s', '%s'",
+			log_chattype2char(type), type_id, src_charid, src_accid, mapname, x, y, log_sql_escape(esc_name, dst_charname, NAME_LENGTH), log_sql_escape(esc_message, message, CHAT_SIZE_MAX));
 	}
 	else
 	{
@@ -491,12 +641,11 @@ void log_chat(e_log_chat_type type, int type_id, int src_charid, int src_accid,
 		time_t curtime;
 		FILE* logfp;
 
-		if( ( logfp = fopen(log_config.log_chat, "a") ) == NULL )
+		if( ( logfp = log_file(log_config.log_chat) ) == NULL )
 			return;
 		time(&curtime);
 		strftime(timestring, sizeof(timestring), log_timestamp_format, localtime(&curtime));
 		fprintf(logfp, "%s - %c,%d,%d,%d,%s,%d,%d,%s,%s\n", timestring, log_chattype2char(type), type_id, src_charid, src_accid, mapname, x, y, dst_charname, message);
-		fclose(logfp);
 	}
 }
 
@@ -508,23 +657,18 @@ void log_cash( struct map_session_data* sd, e_log_pick_type type, e_log_cash_typ
 		return;
 
 	if( log_config.sql_logs ){
-		if( SQL_ERROR == Sql_Query( logmysql_handle, LOG_QUERY " INTO `%s` ( `time`, `char_id`, `type`, `cash_type`, `amount`, `map` ) VALUES ( NOW(), '%d', '%c', '%c', '%d', '%s' )",
-			log_config.log_cash, sd->status.char_id, log_picktype2char( type ), log_cashtype2char( cash_type ), amount, mapindex_id2name( sd->mapindex ) ) )
-		{
-			Sql_ShowDebug( logmysql_handle );
-			return;
-		}
+		log_sql_row( log_config.log_cash, "`time`, `char_id`, `type`, `cash_type`, `amount`, `map`", "'%d', '%c', '%c', '%d', '%s'",
+			sd->status.char_id, log_picktype2char( type ), log_cashtype2char( cash_type ), amount, mapindex_id2name( sd->mapindex ) );
 	}else{
 		char timestring[255];
 		time_t curtime;
 		FILE* logfp;
 
-		if( ( logfp = fopen( log_config.log_cash, "a" ) ) == NULL )
+		if( ( logfp = log_file(log_config.log_cash) ) == NULL )
 			return;
 		time( &curtime );
 		strftime( timestring, sizeof( timestring ), log_timestamp_format, localtime( &curtime ) );
 		fprintf( logfp, "%s - %s[%d]\t%d(%c)\t\n", timestring, sd->status.name, sd->status.account_id, amount, log_cashtype2char( cash_type ) );
-		fclose( logfp );
 	}
 }
 
@@ -561,23 +705,18 @@ void log_feeding(struct map_session_data *sd, e_log_feeding_type type, t_itemid
 	}
 
 	if (log_config.sql_logs) {
-		if (SQL_ERROR == Sql_Query(logmysql_handle, LOG_QUERY " INTO `%s` (`time`, `char_id`, `target_id`, `target_class`, `type`, `intimacy`, `item_id`, `map`, `x`, `y`) VALUES ( NOW(), '%" PRIu32 "', '%" PRIu32 "', '%hu', '%c', '%" PRIu32 "', '%u', '%s', '%hu', '%hu' )",
-			log_config.log_feeding, sd->status.char_id, target_id, target_class, log_feedingtype2char(type), intimacy, nameid, mapindex_id2name(sd->mapindex), sd->bl.x, sd->bl.y))
-		{
-			Sql_ShowDebug(logmysql_handle);
-			return;
-		}
+		log_sql_row(log_config.log_feeding, "`time`, `char_id`, `target_id`, `target_class`, `type`, `intimacy`, `item_id`, `map`, `x`, `y`", "'%" PRIu32 "', '%" PRIu32 "', '%hu', '%c', '%" PRIu32 "', '%u', '%s', '%hu', '%hu'",
+			sd->status.char_id, target_id, target_class, log_feedingtype2char(type), intimacy, nameid, mapindex_id2name(sd->mapindex), sd->bl.x, sd->bl.y);
 	} else {
 		char timestring[255];
 		time_t curtime;
 		FILE* logfp;
 
-		if ((logfp = fopen(log_config.log_feeding, "a")) == NULL)
+		if ((logfp = log_file(log_config.log_feeding)) == NULL)
 			return;
 		time(&curtime);
 		strftime(timestring, sizeof(timestring), log_timestamp_format, localtime(&curtime));
 		fprintf(logfp, "%s - %s[%d]\t%d\t%d(%c)\t%d\t%u\t%s\t%hu,%hu\n", timestring, sd->status.name, sd->status.char_id, target_id, target_class, log_feedingtype2char(type), intimacy, nameid, mapindex_id2name(sd->mapindex), sd->bl.x, sd->bl.y);
-		fclose(logfp);
 	}
 }
 
@@ -591,6 +730,10 @@ void log_set_defaults(void)
 	log_config.price_items_log  = 1000; // 1000z
 	log_config.amount_items_log = 100;
 
+	log_config.batch_rows = 100;
+	log_config.flush_interval = 1000;
+	log_config.max_pending = 64;
+
 	safestrncpy(log_timestamp_format, "%m/%d/%Y %H:%M:%S", sizeof(log_timestamp_format));
 }
 
@@ -651,6 +794,12 @@ int log_config_read(const char* cfgName)
 				log_config.feeding = config_switch(w2);
 			else if( strcmpi(w1, "log_chat_woe_disable") == 0 )
 				log_config.log_chat_woe_disable = config_switch(w2) > 0;
+			else if( strcmpi(w1, "log_batch_rows") == 0 )
+				log_config.batch_rows = max(atoi(w2), 1);
+			else if( strcmpi(w1, "log_flush_interval") == 0 )
+				log_config.flush_interval = max(atoi(w2), 100);
+			else if( strcmpi(w1, "log_max_pending") == 0 )
+				log_config.max_pending = max(atoi(w2), 1);
 			else if( strcmpi(w1, "log_branch_db") == 0 )
 				safestrncpy(log_config.log_branch, w2, sizeof(log_config.log_branch));
 			else if( strcmpi(w1, "log_pick_db") == 0 )
@@ -724,3 +873,28 @@ int log_config_read(const char* cfgName)
 
 	return 0;
 }
+
+
+void do_init_log(void)
+{
+	memset(&log_stats, 0, sizeof(log_stats));
+	log_stats.last_warning = gettick() - 60000;
+
+	add_timer_func_list(log_flush_timer, "log_flush_timer");
+	add_timer_interval(gettick() + log_config.flush_interval, log_flush_timer, 0, 0, log_config.flush_interval);
+}
+
+void do_final_log(void)
+{
+	log_flush();
+	log_batches.clear();
+
+	if( log_config.sql_logs )
+	{
+		SqlAsync_Final();
+
+		if( log_stats.rows > 0 )
+			ShowInfo("Wrote %" PRIu64 " log rows in %" PRIu64 " queries (%" PRIu64 " failed batches, %" PRIu64 " rows lost), waited %" PRIu64 " times for the log database, at most %d queries were pending.\n",
+				log_stats.rows - log_stats.lost, log_stats.queries, log_stats.failed, log_stats.lost, log_stats.stalls, log_stats.max_pending);
+	}
+}
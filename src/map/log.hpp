@@ -86,6 +86,9 @@ void log_mvpdrop(struct map_session_data* sd, int monster_id, t_itemid nameid, t
 
 int log_config_read(const char* cfgName);
 
+void do_init_log(void);
+void do_final_log(void);
+
 extern struct Log_Config
 {
 	e_log_pick_type enable_logs;
@@ -96,6 +99,7 @@ extern struct Log_Config
 	int rare_items_log,refine_items_log,price_items_log,amount_items_log; //for filter
 	int branch, mvpdrop, zeny, commands, npc, chat;
 	unsigned feeding : 2;
+	int batch_rows, flush_interval, max_pending; // log writer
 	char log_branch[64], log_pick[64], log_zeny[64], log_mvpdrop[64], log_gm[64], log_npc[64], log_chat[64], log_cash[64];
 	char log_feeding[64];
 } log_config;
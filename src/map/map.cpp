@@ -3,8 +3,17 @@
 
 #include "map.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <errno.h>
+#include <mutex>
 #include <stdlib.h>
 #include <math.h>
+#include <thread>
+#ifndef _WIN32
+#include <sys/mman.h>
+#endif
 
 #include "../common/cbasetypes.hpp"
 #include "../common/cli.hpp"
@@ -112,7 +121,6 @@ static DBMap* map_msg_db=NULL;
 
 static int map_users=0;
 
-#define BLOCK_SIZE 8
 #define block_free_max 1048576
 struct block_list *block_free[block_free_max];
 static int block_free_count = 0, block_free_lock = 0;
@@ -161,6 +169,38 @@ struct map_cache_map_info {
 	int32 len;
 };
 
+#define MAP_CACHE_FLAT_MAGIC 0x464d4152 // "RAMF", also detects a different byte order
+#define MAP_CACHE_FLAT_VERSION 1
+
+// This is the main header found at the very beginning of the flat map cache
+// The flat map cache is created by the mapcache tool from the map cache. It holds the terrain
+// bitplanes of every map in the layout of map_data::cell, so they can be mapped into memory as is.
+struct map_cache_flat_header {
+	uint32 magic;
+	uint32 version;
+	uint32 map_count;
+	uint32 source_size; // Size of the map cache the flat map cache was created from
+	uint64 source_hash; // FNV-1a hash of that map cache
+};
+
+// This is the entry of a map in the directory following the header of the flat map cache
+struct map_cache_flat_info {
+	char name[MAP_NAME_LENGTH];
+	int16 xs;
+	int16 ys;
+	uint32 offset; // Page aligned file offset of the terrain bitplanes of the map
+};
+
+// A flat map cache, which stays mapped into memory until the map-server shuts down
+struct s_map_cache_flat {
+	char* data;
+	size_t size;
+	bool mapped; // Whether data was mapped or read into an allocated buffer
+	std::unordered_map<std::string, const struct map_cache_flat_info*> maps;
+};
+
+static struct s_map_cache_flat map_cache_flat[2];
+
 char motd_txt[256] = "conf/motd.txt";
 char charhelp_txt[256] = "conf/charhelp.txt";
 char channel_conf[256] = "conf/channels.conf";
@@ -285,6 +325,313 @@ TIMER_FUNC(map_freeblock_timer){
  *------------------------------------------*/
 static struct block_list bl_head;
 
+/*==========================================
+ * Spatial index of the objects on a map
+ * Each block keeps the objects of BLOCK_SIZE x BLOCK_SIZE cells in a
+ * contiguous array together with their coordinates and types, plus a
+ * bitmask of the types it contains. Area searches skip blocks without
+ * objects of the searched types and filter the others without touching
+ * the objects themselves.
+ *------------------------------------------*/
+
+/// Allocates the empty blocks of a map.
+static void map_alloc_blocks(struct map_data* mapdata)
+{
+	mapdata->block = (struct s_map_block*)aCalloc(mapdata->bxs * mapdata->bys, sizeof(struct s_map_block));
+}
+
+/// Frees the blocks of a map.
+static void map_free_blocks(struct map_data* mapdata)
+{
+	if( mapdata->block == nullptr )
+		return;
+
+	for( int i = 0; i < mapdata->bxs * mapdata->bys; i++ ){
+		if( mapdata->block[i].entries != nullptr )
+			aFree(mapdata->block[i].entries);
+		if( mapdata->block[i].area_npcs != nullptr )
+			aFree(mapdata->block[i].area_npcs);
+	}
+
+	aFree(mapdata->block);
+	mapdata->block = nullptr;
+}
+
+/**
+ * Allocates the cell bitplanes of a map, the dimensions of the map have to be set.
+ * @param mapdata: Map
+ * @param terrain: Terrain bitplanes of the map in the flat map cache, which are used instead of allocating them
+ */
+static void map_alloc_cells(struct map_data* mapdata, uint64* terrain = nullptr)
+{
+	mapdata->cell_words = (mapdata->xs + 63) / 64;
+	if( terrain != nullptr ){
+		mapdata->cell = terrain;
+		mapdata->cell_mapped = true;
+	}else{
+		mapdata->cell = (uint64*)aCalloc((size_t)CELL_TERRAIN_MAX * mapdata->ys * mapdata->cell_words, sizeof(uint64));
+		mapdata->cell_mapped = false;
+	}
+	mapdata->cell_overlay = (uint64*)aCalloc((size_t)(CELL_MAX - CELL_TERRAIN_MAX) * mapdata->ys * mapdata->cell_words, sizeof(uint64));
+#ifdef CELL_NOSTACK
+	mapdata->cell_bl = (unsigned char*)aCalloc((size_t)mapdata->xs * mapdata->ys, sizeof(unsigned char));
+#endif
+	mapdata->path_cache = (struct s_path_cache*)aCalloc(1, sizeof(struct s_path_cache));
+}
+
+/// Frees the cell bitplanes of a map.
+static void map_free_cells(struct map_data* mapdata)
+{
+	if( mapdata->cell != nullptr ){
+		if( !mapdata->cell_mapped )
+			aFree(mapdata->cell);
+		mapdata->cell = nullptr;
+		mapdata->cell_mapped = false;
+	}
+	if( mapdata->cell_overlay != nullptr ){
+		aFree(mapdata->cell_overlay);
+		mapdata->cell_overlay = nullptr;
+	}
+#ifdef CELL_NOSTACK
+	if( mapdata->cell_bl != nullptr ){
+		aFree(mapdata->cell_bl);
+		mapdata->cell_bl = nullptr;
+	}
+#endif
+	if( mapdata->path_cache != nullptr ){
+		aFree(mapdata->path_cache);
+		mapdata->path_cache = nullptr;
+	}
+}
+
+/// Returns the block, which contains the given cell.
+static inline struct s_map_block* map_getblock(struct map_data* mapdata, int16 x, int16 y)
+{
+	return &mapdata->block[x / BLOCK_SIZE + (y / BLOCK_SIZE) * mapdata->bxs];
+}
+
+/// Appends the object to the entries of the block.
+static void map_block_push(struct s_map_block* block, struct block_list* bl)
+{
+	struct s_map_block_entry* entry;
+
+	if( block->count == block->max ){
+		block->max = block->max ? block->max * 2 : 4;
+		RECREATE(block->entries, struct s_map_block_entry, block->max);
+	}
+
+	entry = &block->entries[block->count];
+	entry->bl = bl;
+	entry->x = bl->x;
+	entry->y = bl->y;
+	entry->type = bl->type;
+
+	bl->block_pos = block->count++;
+	block->types |= bl->type;
+	block->version++;
+}
+
+/// Removes the object from the entries of the block, the last entry takes its position.
+static void map_block_pop(struct s_map_block* block, struct block_list* bl)
+{
+	uint32 pos = bl->block_pos;
+
+	block->count--;
+	block->version++;
+
+	if( pos != block->count ){
+		block->entries[pos] = block->entries[block->count];
+		block->entries[pos].bl->block_pos = pos;
+	}
+
+	// The type stays in the bitmask as long as another object of it is left
+	for( uint32 i = 0; i < block->count; i++ ){
+		if( block->entries[i].type == bl->type )
+			return;
+	}
+
+	block->types &= ~bl->type;
+}
+
+/**
+ * Registers the trigger area of a npc in all blocks it overlaps, see npc_setcells.
+ * Warps are kept in front of the other npcs like in map_data::npc.
+ * Blocks in which the npc is already registered are left as they are.
+ * @param nd: Npc with a trigger area
+ * @param x0: West end of the trigger area
+ * @param y0: South end of the trigger area
+ * @param x1: East end of the trigger area
+ * @param y1: North end of the trigger area
+ */
+void map_addareanpc(struct npc_data* nd, int16 x0, int16 y0, int16 x1, int16 y1)
+{
+	struct map_data* mapdata = map_getmapdata(nd->bl.m);
+
+	if( mapdata == nullptr || mapdata->block == nullptr )
+		return;
+
+	x0 = i16max(x0, 0);
+	y0 = i16max(y0, 0);
+	x1 = i16min(x1, mapdata->xs - 1);
+	y1 = i16min(y1, mapdata->ys - 1);
+
+	for( int by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++ ){
+		for( int bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++ ){
+			struct s_map_block* block = &mapdata->block[bx + by * mapdata->bxs];
+			uint16 pos;
+
+			ARR_FIND(0, block->area_npc_count, pos, block->area_npcs[pos] == nd);
+			if( pos < block->area_npc_count )
+				continue; // Already registered
+
+			if( block->area_npc_count == block->area_npc_max ){
+				block->area_npc_max = block->area_npc_max ? block->area_npc_max * 2 : 4;
+				RECREATE(block->area_npcs, struct npc_data*, block->area_npc_max);
+			}
+
+			pos = block->area_npc_count;
+			if( nd->subtype == NPCTYPE_WARP )
+				ARR_FIND(0, block->area_npc_count, pos, block->area_npcs[pos]->subtype != NPCTYPE_WARP);
+
+			memmove(&block->area_npcs[pos + 1], &block->area_npcs[pos], (block->area_npc_count - pos) * sizeof(struct npc_data*));
+			block->area_npcs[pos] = nd;
+			block->area_npc_count++;
+		}
+	}
+}
+
+/**
+ * Removes the trigger area of a npc from all blocks it overlaps, see npc_unsetcells.
+ * @param nd: Npc with a trigger area
+ * @param x0: West end of the trigger area
+ * @param y0: South end of the trigger area
+ * @param x1: East end of the trigger area
+ * @param y1: North end of the trigger area
+ */
+void map_delareanpc(struct npc_data* nd, int16 x0, int16 y0, int16 x1, int16 y1)
+{
+	struct map_data* mapdata = map_getmapdata(nd->bl.m);
+
+	if( mapdata == nullptr || mapdata->block == nullptr )
+		return;
+
+	x0 = i16max(x0, 0);
+	y0 = i16max(y0, 0);
+	x1 = i16min(x1, mapdata->xs - 1);
+	y1 = i16min(y1, mapdata->ys - 1);
+
+	for( int by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++ ){
+		for( int bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++ ){
+			struct s_map_block* block = &mapdata->block[bx + by * mapdata->bxs];
+			uint16 pos;
+
+			ARR_FIND(0, block->area_npc_count, pos, block->area_npcs[pos] == nd);
+			if( pos == block->area_npc_count )
+				continue;
+
+			block->area_npc_count--;
+			memmove(&block->area_npcs[pos], &block->area_npcs[pos + 1], (block->area_npc_count - pos) * sizeof(struct npc_data*));
+		}
+	}
+}
+
+/**
+ * Returns the npcs whose trigger area overlaps the block of a cell.
+ * The npcs still have to check if the cell is inside their area.
+ * The list may change whenever a npc is moved, loaded or unloaded.
+ * @param m: Map
+ * @param x: X coordinate of the cell
+ * @param y: Y coordinate of the cell
+ * @param count: Set to the number of npcs in the list
+ * @return list of npcs, warps first
+ */
+struct npc_data** map_getareanpcs(int16 m, int16 x, int16 y, int* count)
+{
+	struct map_data* mapdata = map_getmapdata(m);
+
+	if( mapdata == nullptr || mapdata->block == nullptr || x < 0 || y < 0 || x >= mapdata->xs || y >= mapdata->ys ){
+		*count = 0;
+		return nullptr;
+	}
+
+	struct s_map_block* block = map_getblock(mapdata, x, y);
+
+	*count = block->area_npc_count;
+	return block->area_npcs;
+}
+
+/**
+ * Visits all objects of the given types in an area.
+ * Mobs are visited after all other types.
+ * Only reads the blocks, so it is safe to use from worker threads while the main thread waits for them.
+ * @param mapdata: Map to search on
+ * @param x0: West end of area
+ * @param y0: South end of area
+ * @param x1: East end of area
+ * @param y1: North end of area
+ * @param type: Type of bl to search for
+ * @param visit: Called for each object in the area, returns false to stop the search
+ */
+template <typename Visitor>
+static void map_scan_area(struct map_data* mapdata, int x0, int y0, int x1, int y1, int type, Visitor visit)
+{
+	const int passes[] = { type&~BL_MOB, type&BL_MOB };
+
+	for( int pass : passes ){
+		if( pass == 0 )
+			continue;
+
+		for( int by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++ ){
+			for( int bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++ ){
+				const struct s_map_block* block = &mapdata->block[bx + by * mapdata->bxs];
+
+				if( !(block->types&pass) )
+					continue; // No objects of the searched types
+
+				for( uint32 i = 0; i < block->count; i++ ){
+					const struct s_map_block_entry* entry = &block->entries[i];
+
+					if( entry->type&pass
+						&& entry->x >= x0 && entry->x <= x1 && entry->y >= y0 && entry->y <= y1
+						&& !visit(entry->bl) )
+						return;
+				}
+			}
+		}
+	}
+}
+
+/**
+ * Collects all objects of the given types in an area into bl_list.
+ * Mobs are collected after all other types.
+ * @param mapdata: Map to search on
+ * @param x0: West end of area
+ * @param y0: South end of area
+ * @param x1: East end of area
+ * @param y1: North end of area
+ * @param type: Type of bl to search for
+ * @param filter: Additional check for each object in the area
+ */
+template <typename Filter>
+static void map_collect_area(struct map_data* mapdata, int x0, int y0, int x1, int y1, int type, Filter filter)
+{
+	map_scan_area(mapdata, x0, y0, x1, y1, type, [&filter]( struct block_list* bl ){
+		if( bl_list_count >= BL_LIST_MAX )
+			return false;
+
+		if( filter(bl) )
+			bl_list[bl_list_count++] = bl;
+
+		return true;
+	});
+}
+
+/// Filter for map_collect_area, which accepts all objects in the area.
+static inline bool map_collect_all(struct block_list* bl)
+{
+	return true;
+}
+
 #ifdef CELL_NOSTACK
 /*==========================================
  * These pair of functions update the counter of how many objects
@@ -296,7 +643,7 @@ static void map_addblcell(struct block_list *bl)
 
 	if( bl->m<0 || bl->x<0 || bl->x>=mapdata->xs || bl->y<0 || bl->y>=mapdata->ys || !(bl->type&BL_CHAR) )
 		return;
-	mapdata->cell[bl->x+bl->y*mapdata->xs].cell_bl++;
+	mapdata->cell_bl[bl->x+bl->y*mapdata->xs]++;
 	return;
 }
 
@@ -306,7 +653,7 @@ static void map_delblcell(struct block_list *bl)
 
 	if( bl->m <0 || bl->x<0 || bl->x>=mapdata->xs || bl->y<0 || bl->y>=mapdata->ys || !(bl->type&BL_CHAR) )
 		return;
-	mapdata->cell[bl->x+bl->y*mapdata->xs].cell_bl--;
+	mapdata->cell_bl[bl->x+bl->y*mapdata->xs]--;
 }
 #endif
 
@@ -317,7 +664,6 @@ static void map_delblcell(struct block_list *bl)
 int map_addblock(struct block_list* bl)
 {
 	int16 m, x, y;
-	int pos;
 
 	nullpo_ret(bl);
 
@@ -347,19 +693,8 @@ int map_addblock(struct block_list* bl)
 		return 1;
 	}
 
-	pos = x/BLOCK_SIZE+(y/BLOCK_SIZE)*mapdata->bxs;
-
-	if (bl->type == BL_MOB) {
-		bl->next = mapdata->block_mob[pos];
-		bl->prev = &bl_head;
-		if (bl->next) bl->next->prev = bl;
-		mapdata->block_mob[pos] = bl;
-	} else {
-		bl->next = mapdata->block[pos];
-		bl->prev = &bl_head;
-		if (bl->next) bl->next->prev = bl;
-		mapdata->block[pos] = bl;
-	}
+	map_block_push(map_getblock(mapdata, x, y), bl);
+	bl->prev = &bl_head;
 
 #ifdef CELL_NOSTACK
 	map_addblcell(bl);
@@ -373,17 +708,10 @@ int map_addblock(struct block_list* bl)
  *------------------------------------------*/
 int map_delblock(struct block_list* bl)
 {
-	int pos;
 	nullpo_ret(bl);
 
-	// blocklist (2ways chainlist)
-	if (bl->prev == NULL) {
-		if (bl->next != NULL) {
-			// can't delete block (already at the beginning of the chain)
-			ShowError("map_delblock error : bl->next!=NULL\n");
-		}
-		return 0;
-	}
+	if (bl->prev == NULL)
+		return 0; // not on a map
 
 #ifdef CELL_NOSTACK
 	map_delblcell(bl);
@@ -391,21 +719,7 @@ int map_delblock(struct block_list* bl)
 
 	struct map_data *mapdata = map_getmapdata(bl->m);
 
-	pos = bl->x/BLOCK_SIZE+(bl->y/BLOCK_SIZE)*mapdata->bxs;
-
-	if (bl->next)
-		bl->next->prev = bl->prev;
-	if (bl->prev == &bl_head) {
-	//Since the head of the list, update the block_list map of []
-		if (bl->type == BL_MOB) {
-			mapdata->block_mob[pos] = bl->next;
-		} else {
-			mapdata->block[pos] = bl->next;
-		}
-	} else {
-		bl->prev->next = bl->next;
-	}
-	bl->next = NULL;
+	map_block_pop(map_getblock(mapdata, bl->x, bl->y), bl);
 	bl->prev = NULL;
 
 	return 0;
@@ -449,8 +763,8 @@ int map_moveblock(struct block_list *bl, int x1, int y1, t_tick tick)
 			status_change_end(bl, SC_TATAMIGAESHI, INVALID_TIMER);
 			status_change_end(bl, SC_MAGICROD, INVALID_TIMER);
 			status_change_end(bl, SC_SU_STOOP, INVALID_TIMER);
-			if (sc->data[SC_PROPERTYWALK] &&
-				sc->data[SC_PROPERTYWALK]->val3 >= skill_get_maxcount(sc->data[SC_PROPERTYWALK]->val1,sc->data[SC_PROPERTYWALK]->val2) )
+			if (sc->getSCE(SC_PROPERTYWALK) &&
+				sc->getSCE(SC_PROPERTYWALK)->val3 >= skill_get_maxcount(sc->getSCE(SC_PROPERTYWALK)->val1,sc->getSCE(SC_PROPERTYWALK)->val2) )
 				status_change_end(bl,SC_PROPERTYWALK,INVALID_TIMER);
 		}
 	} else
@@ -466,10 +780,19 @@ int map_moveblock(struct block_list *bl, int x1, int y1, t_tick tick)
 	if (moveblock) {
 		if(map_addblock(bl))
 			return 1;
-	}
+	} else {
+		// Same block, only the coordinates of its entry change
+		struct map_data* mapdata = map_getmapdata(bl->m);
+		struct s_map_block* block = map_getblock(mapdata, x1, y1);
+		struct s_map_block_entry* entry = &block->entries[bl->block_pos];
+
+		entry->x = x1;
+		entry->y = y1;
+		block->version++;
 #ifdef CELL_NOSTACK
-	else map_addblcell(bl);
+		map_addblcell(bl);
 #endif
+	}
 
 	if (bl->type&BL_CHAR) {
 
@@ -485,49 +808,49 @@ int map_moveblock(struct block_list *bl, int x1, int y1, t_tick tick)
 		}
 
 		if (sc && sc->count) {
-			if (sc->data[SC_DANCING])
-				skill_unit_move_unit_group(skill_id2group(sc->data[SC_DANCING]->val2), bl->m, x1-x0, y1-y0);
+			if (sc->getSCE(SC_DANCING))
+				skill_unit_move_unit_group(skill_id2group(sc->getSCE(SC_DANCING)->val2), bl->m, x1-x0, y1-y0);
 			else {
-				if (sc->data[SC_CLOAKING] && sc->data[SC_CLOAKING]->val1 < 3 && !skill_check_cloaking(bl, NULL))
+				if (sc->getSCE(SC_CLOAKING) && sc->getSCE(SC_CLOAKING)->val1 < 3 && !skill_check_cloaking(bl, NULL))
 					status_change_end(bl, SC_CLOAKING, INVALID_TIMER);
-				if (sc->data[SC_WARM])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_WARM]->val4), bl->m, x1-x0, y1-y0);
-				if (sc->data[SC_BANDING])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_BANDING]->val4), bl->m, x1-x0, y1-y0);
+				if (sc->getSCE(SC_WARM))
+					skill_unit_move_unit_group(skill_id2group(sc->getSCE(SC_WARM)->val4), bl->m, x1-x0, y1-y0);
+				if (sc->getSCE(SC_BANDING))
+					skill_unit_move_unit_group(skill_id2group(sc->getSCE(SC_BANDING)->val4), bl->m, x1-x0, y1-y0);
 
-				if (sc->data[SC_NEUTRALBARRIER_MASTER])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_NEUTRALBARRIER_MASTER]->val2), bl->m, x1-x0, y1-y0);
-				else if (sc->data[SC_STEALTHFIELD_MASTER])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_STEALTHFIELD_MASTER]->val2), bl->m, x1-x0, y1-y0);
+				if (sc->getSCE(SC_NEUTRALBARRIER_MASTER))
+					skill_unit_move_unit_group(skill_id2group(sc->getSCE(SC_NEUTRALBARRIER_MASTER)->val2), bl->m, x1-x0, y1-y0);
+				else if (sc->getSCE(SC_STEALTHFIELD_MASTER))
+					skill_unit_move_unit_group(skill_id2group(sc->getSCE(SC_STEALTHFIELD_MASTER)->val2), bl->m, x1-x0, y1-y0);
 
-				if( sc->data[SC__SHADOWFORM] ) {//Shadow Form Caster Moving
+				if( sc->getSCE(SC__SHADOWFORM) ) {//Shadow Form Caster Moving
 					struct block_list *d_bl;
-					if( (d_bl = map_id2bl(sc->data[SC__SHADOWFORM]->val2)) == NULL || !check_distance_bl(bl,d_bl,10) )
+					if( (d_bl = map_id2bl(sc->getSCE(SC__SHADOWFORM)->val2)) == NULL || !check_distance_bl(bl,d_bl,10) )
 						status_change_end(bl,SC__SHADOWFORM,INVALID_TIMER);
 				}
 
-				if (sc->data[SC_PROPERTYWALK]
-					&& sc->data[SC_PROPERTYWALK]->val3 < skill_get_maxcount(sc->data[SC_PROPERTYWALK]->val1,sc->data[SC_PROPERTYWALK]->val2)
+				if (sc->getSCE(SC_PROPERTYWALK)
+					&& sc->getSCE(SC_PROPERTYWALK)->val3 < skill_get_maxcount(sc->getSCE(SC_PROPERTYWALK)->val1,sc->getSCE(SC_PROPERTYWALK)->val2)
 					&& map_find_skill_unit_oncell(bl,bl->x,bl->y,SO_ELECTRICWALK,NULL,0) == NULL
 					&& map_find_skill_unit_oncell(bl,bl->x,bl->y,NPC_ELECTRICWALK,NULL,0) == NULL
 					&& map_find_skill_unit_oncell(bl,bl->x,bl->y,SO_FIREWALK,NULL,0) == NULL
 					&& map_find_skill_unit_oncell(bl,bl->x,bl->y,NPC_FIREWALK,NULL,0) == NULL
-					&& skill_unitsetting(bl,sc->data[SC_PROPERTYWALK]->val1,sc->data[SC_PROPERTYWALK]->val2,x0, y0,0)) {
-						sc->data[SC_PROPERTYWALK]->val3++;
+					&& skill_unitsetting(bl,sc->getSCE(SC_PROPERTYWALK)->val1,sc->getSCE(SC_PROPERTYWALK)->val2,x0, y0,0)) {
+						sc->getSCE(SC_PROPERTYWALK)->val3++;
 				}
 
 
 			}
 			/* Guild Aura Moving */
 			if( bl->type == BL_PC && ((TBL_PC*)bl)->state.gmaster_flag ) {
-				if (sc->data[SC_LEADERSHIP])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_LEADERSHIP]->val4), bl->m, x1-x0, y1-y0);
-				if (sc->data[SC_GLORYWOUNDS])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_GLORYWOUNDS]->val4), bl->m, x1-x0, y1-y0);
-				if (sc->data[SC_SOULCOLD])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_SOULCOLD]->val4), bl->m, x1-x0, y1-y0);
-				if (sc->data[SC_HAWKEYES])
-					skill_unit_move_unit_group(skill_id2group(sc->data[SC_HAWKEYES]->val4), bl->m, x1-x0, y1-y0);
+				if (sc->getSCE(SC_LEADERSHIP))
+					skill_unit_move_unit_group(skill_id2group(sc->getSCE(SC_LEADERSHIP)->val4), bl->m, x1-x0, y1-y0);
+				if (sc->getSCE(SC_GLORYWOUNDS))
+					skill_unit_move_unit_group(skill_id2group(sc->getSCE(SC_GLORYWOUNDS)->val4), bl->m, x1-x0, y1-y0);
+				if (sc->getSCE(SC_SOULCOLD))
+					skill_unit_move_unit_group(skill_id2group(sc->getSCE(SC_SOULCOLD)->val4), bl->m, x1-x0, y1-y0);
+				if (sc->getSCE(SC_HAWKEYES))
+					skill_unit_move_unit_group(skill_id2group(sc->getSCE(SC_HAWKEYES)->val4), bl->m, x1-x0, y1-y0);
 			}
 		}
 	} else
@@ -544,40 +867,31 @@ int map_moveblock(struct block_list *bl, int x1, int y1, t_tick tick)
  *------------------------------------------*/
 int map_count_oncell(int16 m, int16 x, int16 y, int type, int flag)
 {
-	int bx,by;
-	struct block_list *bl;
+	struct s_map_block *block;
 	int count = 0;
 	struct map_data *mapdata = map_getmapdata(m);
 
 	if (x < 0 || y < 0 || (x >= mapdata->xs) || (y >= mapdata->ys))
 		return 0;
 
-	bx = x/BLOCK_SIZE;
-	by = y/BLOCK_SIZE;
+	block = map_getblock(mapdata, x, y);
 
-	if (type&~BL_MOB)
-		for( bl = mapdata->block[bx+by*mapdata->bxs] ; bl != NULL ; bl = bl->next )
-			if(bl->x == x && bl->y == y && bl->type&type) {
-				if(flag&1) {
-					struct unit_data *ud = unit_bl2ud(bl);
-					if(!ud || ud->walktimer == INVALID_TIMER)
-						count++;
-				} else {
-					count++;
-				}
-			}
+	if (!(block->types&type))
+		return 0;
 
-	if (type&BL_MOB)
-		for( bl = mapdata->block_mob[bx+by*mapdata->bxs] ; bl != NULL ; bl = bl->next )
-			if(bl->x == x && bl->y == y) {
-				if(flag&1) {
-					struct unit_data *ud = unit_bl2ud(bl);
-					if(!ud || ud->walktimer == INVALID_TIMER)
-						count++;
-				} else {
+	for( uint32 i = 0; i < block->count; i++ ) {
+		struct s_map_block_entry *entry = &block->entries[i];
+
+		if(entry->x == x && entry->y == y && entry->type&type) {
+			if(flag&1) {
+				struct unit_data *ud = unit_bl2ud(entry->bl);
+				if(!ud || ud->walktimer == INVALID_TIMER)
 					count++;
-				}
+			} else {
+				count++;
 			}
+		}
+	}
 
 	return count;
 }
@@ -587,23 +901,26 @@ int map_count_oncell(int16 m, int16 x, int16 y, int type, int flag)
  * flag&1: runs battle_check_target check based on unit->group->target_flag
  */
 struct skill_unit* map_find_skill_unit_oncell(struct block_list* target,int16 x,int16 y,uint16 skill_id,struct skill_unit* out_unit, int flag) {
-	int16 bx,by;
-	struct block_list *bl;
+	struct s_map_block *block;
 	struct skill_unit *unit;
 	struct map_data *mapdata = map_getmapdata(target->m);
 
 	if (x < 0 || y < 0 || (x >= mapdata->xs) || (y >= mapdata->ys))
 		return NULL;
 
-	bx = x/BLOCK_SIZE;
-	by = y/BLOCK_SIZE;
+	block = map_getblock(mapdata, x, y);
 
-	for( bl = mapdata->block[bx+by*mapdata->bxs] ; bl != NULL ; bl = bl->next )
+	if (!(block->types&BL_SKILL))
+		return NULL;
+
+	for( uint32 i = 0; i < block->count; i++ )
 	{
-		if (bl->x != x || bl->y != y || bl->type != BL_SKILL)
+		struct s_map_block_entry *entry = &block->entries[i];
+
+		if (entry->x != x || entry->y != y || entry->type != BL_SKILL)
 			continue;
 
-		unit = (struct skill_unit *) bl;
+		unit = (struct skill_unit *) entry->bl;
 		if( unit == out_unit || !unit->alive || !unit->group || unit->group->skill_id != skill_id )
 			continue;
 		if( !(flag&1) || battle_check_target(&unit->bl,target,unit->group->target_flag) > 0 )
@@ -617,9 +934,8 @@ struct skill_unit* map_find_skill_unit_oncell(struct block_list* target,int16 x,
  *------------------------------------------*/
 int map_foreachinrangeV(int (*func)(struct block_list*,va_list),struct block_list* center, int16 range, int type, va_list ap, bool wall_check)
 {
-	int bx, by, m;
+	int m;
 	int returnCount = 0;	//total sum of returned values of func() [Skotlex]
-	struct block_list *bl;
 	int blockcount = bl_list_count, i;
 	int x0, x1, y0, y1;
 	va_list ap_copy;
@@ -639,38 +955,13 @@ int map_foreachinrangeV(int (*func)(struct block_list*,va_list),struct block_lis
 	x1 = i16min(center->x + range, mapdata->xs - 1);
 	y1 = i16min(center->y + range, mapdata->ys - 1);
 
-	if ( type&~BL_MOB ) {
-		for( by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++ ) {
-			for( bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++ ) {
-				for(bl = mapdata->block[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next ) {
-					if( bl->type&type
-						&& bl->x >= x0 && bl->x <= x1 && bl->y >= y0 && bl->y <= y1
+	map_collect_area(mapdata, x0, y0, x1, y1, type, [center, range, wall_check]( struct block_list* bl ){
+		return true
 #ifdef CIRCULAR_AREA
-						&& check_distance_bl(center, bl, range)
+			&& check_distance_bl(center, bl, range)
 #endif
-						&& ( !wall_check || path_search_long(NULL, center->m, center->x, center->y, bl->x, bl->y, CELL_CHKWALL) )
-					  	&& bl_list_count < BL_LIST_MAX )
-						bl_list[ bl_list_count++ ] = bl;
-				}
-			}
-		}
-	}
-
-	if ( type&BL_MOB ) {
-		for( by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++ ) {
-			for( bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++ ) {
-				for(bl = mapdata->block_mob[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next ) {
-					if( bl->x >= x0 && bl->x <= x1 && bl->y >= y0 && bl->y <= y1
-#ifdef CIRCULAR_AREA
-						&& check_distance_bl(center, bl, range)
-#endif
-						&& ( !wall_check || path_search_long(NULL, center->m, center->x, center->y, bl->x, bl->y, CELL_CHKWALL) )
-					  	&& bl_list_count < BL_LIST_MAX )
-						bl_list[ bl_list_count++ ] = bl;
-				}
-			}
-		}
-	}
+			&& ( !wall_check || path_search_long(NULL, center->m, center->x, center->y, bl->x, bl->y, CELL_CHKWALL) );
+	});
 
 	if( bl_list_count >= BL_LIST_MAX )
 		ShowWarning("map_foreachinrange: block count too many!\n");
@@ -737,9 +1028,8 @@ int map_foreachinshootrange(int (*func)(struct block_list*,va_list),struct block
 *------------------------------------------*/
 int map_foreachinareaV(int(*func)(struct block_list*, va_list), int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int type, va_list ap, bool wall_check)
 {
-	int bx, by, cx, cy;
+	int cx = 0, cy = 0;
 	int returnCount = 0;	//total sum of returned values of func()
-	struct block_list *bl;
 	int blockcount = bl_list_count, i;
 	va_list ap_copy;
 
@@ -767,32 +1057,12 @@ int map_foreachinareaV(int(*func)(struct block_list*, va_list), int16 m, int16 x
 		cy = y0 + (y1 - y0) / 2;
 	}
 
-	if( type&~BL_MOB ) {
-		for (by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++) {
-			for (bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++) {
-				for(bl = mapdata->block[bx + by * mapdata->bxs]; bl != NULL; bl = bl->next) {
-					if ( bl->type&type
-						&& bl->x >= x0 && bl->x <= x1 && bl->y >= y0 && bl->y <= y1
-						&& ( !wall_check || path_search_long(NULL, m, cx, cy, bl->x, bl->y, CELL_CHKWALL) )
-						&& bl_list_count < BL_LIST_MAX )
-						bl_list[bl_list_count++] = bl;
-				}
-			}
-		}
-	}
-
-	if( type&BL_MOB ) {
-		for (by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++) {
-			for (bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++) {
-				for(bl = mapdata->block_mob[bx + by * mapdata->bxs]; bl != NULL; bl = bl->next) {
-					if ( bl->x >= x0 && bl->x <= x1 && bl->y >= y0 && bl->y <= y1
-						&& ( !wall_check || path_search_long(NULL, m, cx, cy, bl->x, bl->y, CELL_CHKWALL) )
-						&& bl_list_count < BL_LIST_MAX )
-						bl_list[bl_list_count++] = bl;
-				}
-			}
-		}
-	}
+	if( wall_check )
+		map_collect_area(mapdata, x0, y0, x1, y1, type, [m, cx, cy]( struct block_list* bl ){
+			return path_search_long(NULL, m, cx, cy, bl->x, bl->y, CELL_CHKWALL);
+		});
+	else
+		map_collect_area(mapdata, x0, y0, x1, y1, type, map_collect_all);
 
 	if (bl_list_count >= BL_LIST_MAX)
 		ShowWarning("map_foreachinarea: block count too many!\n");
@@ -847,9 +1117,8 @@ int map_foreachinarea(int(*func)(struct block_list*, va_list), int16 m, int16 x0
  *------------------------------------------*/
 int map_forcountinrange(int (*func)(struct block_list*,va_list), struct block_list* center, int16 range, int count, int type, ...)
 {
-	int bx, by, m;
+	int m;
 	int returnCount = 0;	//total sum of returned values of func() [Skotlex]
-	struct block_list *bl;
 	int blockcount = bl_list_count, i;
 	int x0, x1, y0, y1;
 	struct map_data *mapdata;
@@ -867,33 +1136,13 @@ int map_forcountinrange(int (*func)(struct block_list*,va_list), struct block_li
 	x1 = i16min(center->x + range, mapdata->xs - 1);
 	y1 = i16min(center->y + range, mapdata->ys - 1);
 
-	if ( type&~BL_MOB )
-		for ( by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++ ) {
-			for( bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++ ) {
-				for( bl = mapdata->block[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next ) {
-					if( bl->type&type
-						&& bl->x >= x0 && bl->x <= x1 && bl->y >= y0 && bl->y <= y1
-#ifdef CIRCULAR_AREA
-						&& check_distance_bl(center, bl, range)
-#endif
-					  	&& bl_list_count < BL_LIST_MAX )
-						bl_list[ bl_list_count++ ] = bl;
-				}
-			}
-		}
-	if( type&BL_MOB )
-		for( by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++ ) {
-			for( bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++ ){
-				for( bl = mapdata->block_mob[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next ) {
-					if( bl->x >= x0 && bl->x <= x1 && bl->y >= y0 && bl->y <= y1
 #ifdef CIRCULAR_AREA
-						&& check_distance_bl(center, bl, range)
+	map_collect_area(mapdata, x0, y0, x1, y1, type, [center, range]( struct block_list* bl ){
+		return check_distance_bl(center, bl, range);
+	});
+#else
+	map_collect_area(mapdata, x0, y0, x1, y1, type, map_collect_all);
 #endif
-						&& bl_list_count < BL_LIST_MAX )
-						bl_list[ bl_list_count++ ] = bl;
-				}
-			}
-		}
 
 	if( bl_list_count >= BL_LIST_MAX )
 		ShowWarning("map_forcountinrange: block count too many!\n");
@@ -916,9 +1165,7 @@ int map_forcountinrange(int (*func)(struct block_list*,va_list), struct block_li
 }
 int map_forcountinarea(int (*func)(struct block_list*,va_list), int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int count, int type, ...)
 {
-	int bx, by;
 	int returnCount = 0;	//total sum of returned values of func() [Skotlex]
-	struct block_list *bl;
 	int blockcount = bl_list_count, i;
 	va_list ap;
 
@@ -941,19 +1188,7 @@ int map_forcountinarea(int (*func)(struct block_list*,va_list), int16 m, int16 x
 	x1 = i16min(x1, mapdata->xs - 1);
 	y1 = i16min(y1, mapdata->ys - 1);
 
-	if ( type&~BL_MOB )
-		for( by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++ )
-			for( bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++ )
-				for( bl = mapdata->block[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next )
-					if( bl->type&type && bl->x >= x0 && bl->x <= x1 && bl->y >= y0 && bl->y <= y1 && bl_list_count < BL_LIST_MAX )
-						bl_list[ bl_list_count++ ] = bl;
-
-	if( type&BL_MOB )
-		for( by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++ )
-			for( bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++ )
-				for( bl = mapdata->block_mob[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next )
-					if( bl->x >= x0 && bl->x <= x1 && bl->y >= y0 && bl->y <= y1 && bl_list_count < BL_LIST_MAX )
-						bl_list[ bl_list_count++ ] = bl;
+	map_collect_area(mapdata, x0, y0, x1, y1, type, map_collect_all);
 
 	if( bl_list_count >= BL_LIST_MAX )
 		ShowWarning("map_forcountinarea: block count too many!\n");
@@ -981,9 +1216,8 @@ int map_forcountinarea(int (*func)(struct block_list*,va_list), int16 m, int16 x
  *------------------------------------------*/
 int map_foreachinmovearea(int (*func)(struct block_list*,va_list), struct block_list* center, int16 range, int16 dx, int16 dy, int type, ...)
 {
-	int bx, by, m;
+	int m;
 	int returnCount = 0;  //total sum of returned values of func() [Skotlex]
-	struct block_list *bl;
 	int blockcount = bl_list_count, i;
 	int16 x0, x1, y0, y1;
 	va_list ap;
@@ -1028,63 +1262,19 @@ int map_foreachinmovearea(int (*func)(struct block_list*,va_list), struct block_
 		x1 = i16min(x1, mapdata->xs - 1);
 		y1 = i16min(y1, mapdata->ys - 1);
 
-		for( by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++ ) {
-			for( bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++ ) {
-				if ( type&~BL_MOB ) {
-					for( bl = mapdata->block[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next ) {
-						if( bl->type&type &&
-							bl->x >= x0 && bl->x <= x1 &&
-							bl->y >= y0 && bl->y <= y1 &&
-							bl_list_count < BL_LIST_MAX )
-							bl_list[ bl_list_count++ ] = bl;
-					}
-				}
-				if ( type&BL_MOB ) {
-					for( bl = mapdata->block_mob[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next ) {
-						if( bl->x >= x0 && bl->x <= x1 &&
-							bl->y >= y0 && bl->y <= y1 &&
-							bl_list_count < BL_LIST_MAX )
-							bl_list[ bl_list_count++ ] = bl;
-					}
-				}
-			}
-		}
+		map_collect_area(mapdata, x0, y0, x1, y1, type, map_collect_all);
 	} else { // Diagonal movement
 		x0 = i16max(x0, 0);
 		y0 = i16max(y0, 0);
 		x1 = i16min(x1, mapdata->xs - 1);
 		y1 = i16min(y1, mapdata->ys - 1);
 
-		for( by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++ ) {
-			for( bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++ ) {
-				if ( type & ~BL_MOB ) {
-					for( bl = mapdata->block[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next ) {
-						if( bl->type&type &&
-							bl->x >= x0 && bl->x <= x1 &&
-							bl->y >= y0 && bl->y <= y1 &&
-							bl_list_count < BL_LIST_MAX )
-						if( ( dx > 0 && bl->x < x0 + dx) ||
-							( dx < 0 && bl->x > x1 + dx) ||
-							( dy > 0 && bl->y < y0 + dy) ||
-							( dy < 0 && bl->y > y1 + dy) )
-							bl_list[ bl_list_count++ ] = bl;
-					}
-				}
-				if ( type&BL_MOB ) {
-					for( bl = mapdata->block_mob[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next ) {
-						if( bl->x >= x0 && bl->x <= x1 &&
-							bl->y >= y0 && bl->y <= y1 &&
-							bl_list_count < BL_LIST_MAX)
-						if( ( dx > 0 && bl->x < x0 + dx) ||
-							( dx < 0 && bl->x > x1 + dx) ||
-							( dy > 0 && bl->y < y0 + dy) ||
-							( dy < 0 && bl->y > y1 + dy) )
-							bl_list[ bl_list_count++ ] = bl;
-					}
-				}
-			}
-		}
-
+		map_collect_area(mapdata, x0, y0, x1, y1, type, [x0, y0, x1, y1, dx, dy]( struct block_list* bl ){
+			return ( dx > 0 && bl->x < x0 + dx) ||
+				( dx < 0 && bl->x > x1 + dx) ||
+				( dy > 0 && bl->y < y0 + dy) ||
+				( dy < 0 && bl->y > y1 + dy);
+		});
 	}
 
 	if( bl_list_count >= BL_LIST_MAX )
@@ -1111,9 +1301,7 @@ int map_foreachinmovearea(int (*func)(struct block_list*,va_list), struct block_
 //
 int map_foreachincell(int (*func)(struct block_list*,va_list), int16 m, int16 x, int16 y, int type, ...)
 {
-	int bx, by;
 	int returnCount = 0;  //total sum of returned values of func() [Skotlex]
-	struct block_list *bl;
 	int blockcount = bl_list_count, i;
 	struct map_data *mapdata = map_getmapdata(m);
 	va_list ap;
@@ -1124,17 +1312,7 @@ int map_foreachincell(int (*func)(struct block_list*,va_list), int16 m, int16 x,
 
 	if ( x < 0 || y < 0 || x >= mapdata->xs || y >= mapdata->ys ) return 0;
 
-	by = y / BLOCK_SIZE;
-	bx = x / BLOCK_SIZE;
-
-	if( type&~BL_MOB )
-		for( bl = mapdata->block[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next )
-			if( bl->type&type && bl->x == x && bl->y == y && bl_list_count < BL_LIST_MAX )
-				bl_list[ bl_list_count++ ] = bl;
-	if( type&BL_MOB )
-		for( bl = mapdata->block_mob[ bx + by * mapdata->bxs]; bl != NULL; bl = bl->next )
-			if( bl->x == x && bl->y == y && bl_list_count < BL_LIST_MAX)
-				bl_list[ bl_list_count++ ] = bl;
+	map_collect_area(mapdata, x, y, x, y, type, map_collect_all);
 
 	if( bl_list_count >= BL_LIST_MAX )
 		ShowWarning("map_foreachincell: block count too many!\n");
@@ -1195,8 +1373,6 @@ int map_foreachinpath(int (*func)(struct block_list*,va_list),int16 m,int16 x0,i
 
 	//Generic map_foreach* variables.
 	int i, blockcount = bl_list_count;
-	struct block_list *bl;
-	int bx, by;
 	//method specific variables
 	int magnitude2, len_limit; //The square of the magnitude
 	int k, xi, yi, xu, yu;
@@ -1255,71 +1431,30 @@ int map_foreachinpath(int (*func)(struct block_list*,va_list),int16 m,int16 x0,i
 
 	range *= range << 8; //Values are shifted later on for higher precision using int math.
 
-	if ( type&~BL_MOB )
-		for ( by = my0 / BLOCK_SIZE; by <= my1 / BLOCK_SIZE; by++ ) {
-			for( bx = mx0 / BLOCK_SIZE; bx <= mx1 / BLOCK_SIZE; bx++ ) {
-				for( bl = mapdata->block[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next ) {
-					if( bl->prev && bl->type&type && bl_list_count < BL_LIST_MAX ) {
-						xi = bl->x;
-						yi = bl->y;
+	map_collect_area(mapdata, mx0, my0, mx1, my1, type, [&]( struct block_list* bl ){
+		xi = bl->x;
+		yi = bl->y;
 
-						k = ( xi - x0 ) * ( x1 - x0 ) + ( yi - y0 ) * ( y1 - y0 );
+		k = ( xi - x0 ) * ( x1 - x0 ) + ( yi - y0 ) * ( y1 - y0 );
 
-						if ( k < 0 || k > len_limit ) //Since more skills use this, check for ending point as well.
-							continue;
+		if ( k < 0 || k > len_limit ) //Since more skills use this, check for ending point as well.
+			return false;
 
-						if ( k > magnitude2 && !path_search_long(NULL, m, x0, y0, xi, yi, CELL_CHKWALL) )
-							continue; //Targets beyond the initial ending point need the wall check.
+		if ( k > magnitude2 && !path_search_long(NULL, m, x0, y0, xi, yi, CELL_CHKWALL) )
+			return false; //Targets beyond the initial ending point need the wall check.
 
-						//All these shifts are to increase the precision of the intersection point and distance considering how it's
-						//int math.
-						k  = ( k << 4 ) / magnitude2; //k will be between 1~16 instead of 0~1
-						xi <<= 4;
-						yi <<= 4;
-						xu = ( x0 << 4 ) + k * ( x1 - x0 );
-						yu = ( y0 << 4 ) + k * ( y1 - y0 );
-						k  = MAGNITUDE2(xi, yi, xu, yu);
+		//All these shifts are to increase the precision of the intersection point and distance considering how it's
+		//int math.
+		k  = ( k << 4 ) / magnitude2; //k will be between 1~16 instead of 0~1
+		xi <<= 4;
+		yi <<= 4;
+		xu = ( x0 << 4 ) + k * ( x1 - x0 );
+		yu = ( y0 << 4 ) + k * ( y1 - y0 );
+		k  = MAGNITUDE2(xi, yi, xu, yu);
 
-						//If all dot coordinates were <<4 the square of the magnitude is <<8
-						if ( k > range )
-							continue;
-
-						bl_list[ bl_list_count++ ] = bl;
-					}
-				}
-			}
-		}
-	 if( type&BL_MOB )
-		for( by = my0 / BLOCK_SIZE; by <= my1 / BLOCK_SIZE; by++ ) {
-			for( bx = mx0 / BLOCK_SIZE; bx <= mx1 / BLOCK_SIZE; bx++ ) {
-				for( bl = mapdata->block_mob[ bx + by * mapdata->bxs ]; bl != NULL; bl = bl->next ) {
-					if( bl->prev && bl_list_count < BL_LIST_MAX ) {
-						xi = bl->x;
-						yi = bl->y;
-						k = ( xi - x0 ) * ( x1 - x0 ) + ( yi - y0 ) * ( y1 - y0 );
-
-						if ( k < 0 || k > len_limit )
-							continue;
-
-						if ( k > magnitude2 && !path_search_long(NULL, m, x0, y0, xi, yi, CELL_CHKWALL) )
-							continue; //Targets beyond the initial ending point need the wall check.
-
-						k  = ( k << 4 ) / magnitude2; //k will be between 1~16 instead of 0~1
-						xi <<= 4;
-						yi <<= 4;
-						xu = ( x0 << 4 ) + k * ( x1 - x0 );
-						yu = ( y0 << 4 ) + k * ( y1 - y0 );
-						k  = MAGNITUDE2(xi, yi, xu, yu);
-
-						//If all dot coordinates were <<4 the square of the magnitude is <<8
-						if ( k > range )
-							continue;
-
-						bl_list[ bl_list_count++ ] = bl;
-					}
-				}
-			}
-		}
+		//If all dot coordinates were <<4 the square of the magnitude is <<8
+		return k <= range;
+	});
 
 	if( bl_list_count >= BL_LIST_MAX )
 		ShowWarning("map_foreachinpath: block count too many!\n");
@@ -1360,8 +1495,6 @@ int map_foreachindir(int(*func)(struct block_list*, va_list), int16 m, int16 x0,
 	int returnCount = 0;  //Total sum of returned values of func()
 
 	int i, blockcount = bl_list_count;
-	struct block_list *bl;
-	int bx, by;
 	int mx0, mx1, my0, my1, rx, ry;
 	uint8 dir = map_calc_dir_xy(x0, y0, x1, y1, 6);
 	short dx = dirx[dir];
@@ -1415,78 +1548,28 @@ int map_foreachindir(int(*func)(struct block_list*, va_list), int16 m, int16 x0,
 	mx1 = min(mx1, mapdata->xs - 1);
 	my1 = min(my1, mapdata->ys - 1);
 
-	if (type&~BL_MOB) {
-		for (by = my0 / BLOCK_SIZE; by <= my1 / BLOCK_SIZE; by++) {
-			for (bx = mx0 / BLOCK_SIZE; bx <= mx1 / BLOCK_SIZE; bx++) {
-				for (bl = mapdata->block[bx + by * mapdata->bxs]; bl != NULL; bl = bl->next) {
-					if (bl->prev && bl->type&type && bl_list_count < BL_LIST_MAX) {
-						//Check if inside search area
-						if (bl->x < mx0 || bl->x > mx1 || bl->y < my0 || bl->y > my1)
-							continue;
-						//What matters now is the relative x and y from the start point
-						rx = (bl->x - x0);
-						ry = (bl->y - y0);
-						//Do not hit source cell
-						if (battle_config.skill_eightpath_same_cell == 0 && rx == 0 && ry == 0)
-							continue;
-						//This turns it so that the area that is hit is always with positive rx and ry
-						rx *= dx;
-						ry *= dy;
-						//These checks only need to be done for diagonal paths
-						if (dir % 2) {
-							//Check for length
-							if ((rx + ry < offset) || (rx + ry > 2 * (length + (offset/2) - 1)))
-								continue;
-							//Check for width
-							if (abs(rx - ry) > 2 * range)
-								continue;
-						}
-						//Everything else ok, check for line of sight from source
-						if (!path_search_long(NULL, m, x0, y0, bl->x, bl->y, CELL_CHKWALL))
-							continue;
-						//All checks passed, add to list
-						bl_list[bl_list_count++] = bl;
-					}
-				}
-			}
-		}
-	}
-	if (type&BL_MOB) {
-		for (by = my0 / BLOCK_SIZE; by <= my1 / BLOCK_SIZE; by++) {
-			for (bx = mx0 / BLOCK_SIZE; bx <= mx1 / BLOCK_SIZE; bx++) {
-				for (bl = mapdata->block_mob[bx + by * mapdata->bxs]; bl != NULL; bl = bl->next) {
-					if (bl->prev && bl_list_count < BL_LIST_MAX) {
-						//Check if inside search area
-						if (bl->x < mx0 || bl->x > mx1 || bl->y < my0 || bl->y > my1)
-							continue;
-						//What matters now is the relative x and y from the start point
-						rx = (bl->x - x0);
-						ry = (bl->y - y0);
-						//Do not hit source cell
-						if (battle_config.skill_eightpath_same_cell == 0 && rx == 0 && ry == 0)
-							continue;
-						//This turns it so that the area that is hit is always with positive rx and ry
-						rx *= dx;
-						ry *= dy;
-						//These checks only need to be done for diagonal paths
-						if (dir % 2) {
-							//Check for length
-							if ((rx + ry < offset) || (rx + ry > 2 * (length + (offset / 2) - 1)))
-								continue;
-							//Check for width
-							if (abs(rx - ry) > 2 * range)
-								continue;
-						}
-						//Everything else ok, check for line of sight from source
-						if (!path_search_long(NULL, m, x0, y0, bl->x, bl->y, CELL_CHKWALL))
-							continue;
-						//All checks passed, add to list
-						bl_list[bl_list_count++] = bl;
-					}
-				}
-			}
+	map_collect_area(mapdata, mx0, my0, mx1, my1, type, [&]( struct block_list* bl ){
+		//What matters now is the relative x and y from the start point
+		rx = (bl->x - x0);
+		ry = (bl->y - y0);
+		//Do not hit source cell
+		if (battle_config.skill_eightpath_same_cell == 0 && rx == 0 && ry == 0)
+			return false;
+		//This turns it so that the area that is hit is always with positive rx and ry
+		rx *= dx;
+		ry *= dy;
+		//These checks only need to be done for diagonal paths
+		if (dir % 2) {
+			//Check for length
+			if ((rx + ry < offset) || (rx + ry > 2 * (length + (offset/2) - 1)))
+				return false;
+			//Check for width
+			if (abs(rx - ry) > 2 * range)
+				return false;
 		}
-	}
+		//Everything else ok, check for line of sight from source
+		return path_search_long(NULL, m, x0, y0, bl->x, bl->y, CELL_CHKWALL);
+	});
 
 	if( bl_list_count >= BL_LIST_MAX )
 		ShowWarning("map_foreachindir: block count too many!\n");
@@ -1509,47 +1592,312 @@ int map_foreachindir(int(*func)(struct block_list*, va_list), int16 m, int16 x0,
 // Copy of map_foreachincell, but applied to the whole map. [Skotlex]
 int map_foreachinmap(int (*func)(struct block_list*,va_list), int16 m, int type,...)
 {
-	int b, bsize;
 	int returnCount = 0;  //total sum of returned values of func() [Skotlex]
-	struct block_list *bl;
 	int blockcount = bl_list_count, i;
 	struct map_data *mapdata = map_getmapdata(m);
 	va_list ap;
 
-	if( mapdata == nullptr || mapdata->block == nullptr ){
-		return 0;
+	if( mapdata == nullptr || mapdata->block == nullptr ){
+		return 0;
+	}
+
+	map_collect_area(mapdata, 0, 0, mapdata->xs - 1, mapdata->ys - 1, type, map_collect_all);
+
+	if( bl_list_count >= BL_LIST_MAX )
+		ShowWarning("map_foreachinmap: block count too many!\n");
+
+	map_freeblock_lock();
+
+	for( i = blockcount; i < bl_list_count ; i++ )
+		if( bl_list[ i ]->prev ) { //func() may delete this bl_list[] slot, checking for prev ensures it wasn't queued for deletion.
+			va_start(ap, type);
+			returnCount += func(bl_list[ i ], ap);
+			va_end(ap);
+		}
+
+	map_freeblock_unlock();
+
+	bl_list_count = blockcount;
+	return returnCount;
+}
+
+/**
+ * Collects all objects of the given types in range of the center into a list.
+ * The objects are in the same order as map_foreachinallrange passes them to its function.
+ * Unlike the map_foreach* functions this does not use bl_list and only reads the blocks,
+ * so worker threads can search the map while the main thread waits for them.
+ * @param center: Center of the area
+ * @param range: Range of the area
+ * @param type: Type of bl to search for
+ * @param list: Receives the objects
+ */
+void map_getallinrange(struct block_list* center, int16 range, int type, std::vector<struct block_list*>& list)
+{
+	int x0, x1, y0, y1;
+
+	list.clear();
+
+	if( center->m < 0 )
+		return;
+
+	struct map_data *mapdata = map_getmapdata(center->m);
+
+	if( mapdata == nullptr || mapdata->block == nullptr ){
+		return;
+	}
+
+	x0 = i16max(center->x - range, 0);
+	y0 = i16max(center->y - range, 0);
+	x1 = i16min(center->x + range, mapdata->xs - 1);
+	y1 = i16min(center->y + range, mapdata->ys - 1);
+
+	map_scan_area(mapdata, x0, y0, x1, y1, type, [center, range, &list]( struct block_list* bl ){
+#ifdef CIRCULAR_AREA
+		if( !check_distance_bl(center, bl, range) )
+			return true;
+#endif
+		list.push_back(bl);
+		return true;
+	});
+}
+
+/**
+ * Returns the combined version of the blocks covering the area map_getallinrange visits.
+ * The versions only increase, so an unchanged result means that no object was added to,
+ * removed from or moved within any of these blocks.
+ * @param center: Center of the area
+ * @param range: Range around the center
+ * @return Sum of the versions of the blocks
+ */
+uint64 map_getrangeversion(struct block_list* center, int16 range)
+{
+	if( center->m < 0 )
+		return 0;
+
+	struct map_data *mapdata = map_getmapdata(center->m);
+
+	if( mapdata == nullptr || mapdata->block == nullptr ){
+		return 0;
+	}
+
+	int bx0 = i16max(center->x - range, 0) / BLOCK_SIZE;
+	int by0 = i16max(center->y - range, 0) / BLOCK_SIZE;
+	int bx1 = i16min(center->x + range, mapdata->xs - 1) / BLOCK_SIZE;
+	int by1 = i16min(center->y + range, mapdata->ys - 1) / BLOCK_SIZE;
+	uint64 version = 0;
+
+	for( int by = by0; by <= by1; by++ ){
+		for( int bx = bx0; bx <= bx1; bx++ )
+			version += mapdata->block[bx + by * mapdata->bxs].version;
+	}
+
+	return version;
+}
+
+
+/*==========================================
+ * Map shards
+ *------------------------------------------
+ * The maps are partitioned into shards, which are balanced by the amount
+ * of monsters on their maps. Every shard owns a thread, the first one is
+ * the main thread. map_shard_run hands a job to all shards at once and
+ * waits until each of them processed its own maps, so the maps of a shard
+ * are always processed on the same thread.
+ * The jobs may only read the maps, everything that changes the game state
+ * is applied by the main thread afterwards.
+ *------------------------------------------*/
+
+static int map_shards = 1; // map_shards setting of map_athena.conf
+static int map_load_threads = 0; // map_load_threads setting of map_athena.conf, 0 uses one thread per core
+static std::vector<std::thread> map_shard_threads; // threads of the shards 1 to map_shards - 1
+static std::mutex map_shard_mutex;
+static std::condition_variable map_shard_wake_cond; // wakes up the shard threads
+static std::condition_variable map_shard_done_cond; // wakes up the main thread
+static const std::function<void(int16)>* map_shard_job = nullptr; // job of the current round
+static uint32 map_shard_round = 0; // increased for every job
+static int map_shard_busy = 0; // shard threads that did not finish the current job yet
+static bool map_shard_stopping = false;
+
+/// Returns the amount of shards, 1 if the maps are not sharded.
+int map_shard_count(void)
+{
+	return map_shards;
+}
+
+/**
+ * Runs a job on all shards in parallel and waits until all of them finished it.
+ * The job is called with the index of the shard it runs on and should only visit the maps of that shard.
+ * It may only read the maps, since the other shards run at the same time.
+ * @param job: Job to run
+ */
+void map_shard_run(const std::function<void(int16 shard)>& job)
+{
+	if( map_shard_threads.empty() ){
+		job(0);
+		return;
+	}
+
+	{
+		std::lock_guard<std::mutex> lock(map_shard_mutex);
+
+		map_shard_job = &job;
+		map_shard_round++;
+		map_shard_busy = (int)map_shard_threads.size();
+	}
+
+	map_shard_wake_cond.notify_all();
+
+	// The main thread runs the first shard
+	job(0);
+
+	std::unique_lock<std::mutex> lock(map_shard_mutex);
+
+	map_shard_done_cond.wait(lock, []() { return map_shard_busy == 0; });
+	map_shard_job = nullptr;
+}
+
+/// Main function of the shard threads.
+static void map_shard_main(int16 shard)
+{
+	std::unique_lock<std::mutex> lock(map_shard_mutex);
+	uint32 round = map_shard_round;
+
+	path_init_thread(); // The main thread waits until all shards started
+
+	for(;;){
+		if( --map_shard_busy == 0 )
+			map_shard_done_cond.notify_one();
+
+		map_shard_wake_cond.wait(lock, [&round]() { return map_shard_stopping || map_shard_round != round; });
+
+		if( map_shard_stopping )
+			break;
+
+		round = map_shard_round;
+		lock.unlock();
+		(*map_shard_job)(shard);
+		lock.lock();
+	}
+
+	path_final_thread(); // The main thread waits in map_shard_final
+}
+
+/// Returns how much work a map causes for its shard.
+static int map_shard_weight(int16 m)
+{
+	struct map_data* mapdata = map_getmapdata(m);
+	int spawned = 0, spawns = 0;
+
+	if( mapdata->instance_id > 0 )
+		mapdata = map_getmapdata(mapdata->instance_src_map); // Spawns are created later
+
+	if( mapdata->block != nullptr ){
+		for( int i = 0; i < mapdata->bxs * mapdata->bys; i++ ){
+			const struct s_map_block* block = &mapdata->block[i];
+
+			for( uint32 j = 0; block->types&BL_MOB && j < block->count; j++ ){
+				if( block->entries[j].type == BL_MOB )
+					spawned++;
+			}
+		}
+	}
+
+	// Dynamic mobs are not spawned until players enter the map
+	for( int i = 0; i < MAX_MOB_LIST_PER_MAP; i++ ){
+		if( mapdata->moblist[i] != nullptr )
+			spawns += mapdata->moblist[i]->num;
+	}
+
+	return 1 + i32max(spawned, spawns);
+}
+
+/**
+ * Returns the shard with the least work.
+ * @param exclude: Map which is not counted, because it gets a shard now
+ */
+static int16 map_shard_lightest(int16 exclude)
+{
+	if( map_shards <= 1 )
+		return 0;
+
+	std::vector<int> load(map_shards, 0);
+	int16 shard = 0;
+
+	for( int16 m = 0; m < map_num; m++ ){
+		struct map_data* mapdata = map_getmapdata(m);
+
+		if( m != exclude && mapdata->cell != nullptr )
+			load[mapdata->shard] += map_shard_weight(m);
+	}
+
+	for( int16 i = 1; i < map_shards; i++ ){
+		if( load[i] < load[shard] )
+			shard = i;
+	}
+
+	return shard;
+}
+
+/// Partitions the loaded maps into the shards and starts their threads.
+static void map_shard_init(void)
+{
+	if( map_shards <= 1 )
+		return;
+
+	std::vector<std::pair<int, int16>> weights;
+	std::vector<int> load(map_shards, 0);
+	std::vector<int> maps(map_shards, 0);
+
+	for( int16 m = 0; m < map_num; m++ )
+		weights.push_back(std::make_pair(map_shard_weight(m), m));
+
+	// Heaviest maps first, each to the shard with the least work so far
+	std::stable_sort(weights.begin(), weights.end(), [](const std::pair<int, int16>& a, const std::pair<int, int16>& b) {
+		return a.first > b.first;
+	});
+
+	for( const auto& weight : weights ){
+		int16 shard = (int16)(std::min_element(load.begin(), load.end()) - load.begin());
+
+		map_getmapdata(weight.second)->shard = shard;
+		load[shard] += weight.first;
+		maps[shard]++;
 	}
 
-	bsize = mapdata->bxs * mapdata->bys;
+	std::unique_lock<std::mutex> lock(map_shard_mutex);
 
-	if( type&~BL_MOB )
-		for( b = 0; b < bsize; b++ )
-			for( bl = mapdata->block[ b ]; bl != NULL; bl = bl->next )
-				if( bl->type&type && bl_list_count < BL_LIST_MAX )
-					bl_list[ bl_list_count++ ] = bl;
+	map_shard_stopping = false;
+	map_shard_busy = map_shards - 1;
 
-	if( type&BL_MOB )
-		for( b = 0; b < bsize; b++ )
-			for( bl = mapdata->block_mob[ b ]; bl != NULL; bl = bl->next )
-				if( bl_list_count < BL_LIST_MAX )
-					bl_list[ bl_list_count++ ] = bl;
+	for( int16 shard = 1; shard < map_shards; shard++ )
+		map_shard_threads.emplace_back(map_shard_main, shard);
 
-	if( bl_list_count >= BL_LIST_MAX )
-		ShowWarning("map_foreachinmap: block count too many!\n");
+	map_shard_done_cond.wait(lock, []() { return map_shard_busy == 0; });
 
-	map_freeblock_lock();
+	ShowInfo("Maps are partitioned into " CL_WHITE "%d" CL_RESET " shards.\n", map_shards);
 
-	for( i = blockcount; i < bl_list_count ; i++ )
-		if( bl_list[ i ]->prev ) { //func() may delete this bl_list[] slot, checking for prev ensures it wasn't queued for deletion.
-			va_start(ap, type);
-			returnCount += func(bl_list[ i ], ap);
-			va_end(ap);
-		}
+	for( int16 shard = 0; shard < map_shards; shard++ )
+		ShowInfo("Shard %d: " CL_WHITE "%d" CL_RESET " maps with a weight of " CL_WHITE "%d" CL_RESET ".\n", shard, maps[shard], load[shard]);
+}
 
-	map_freeblock_unlock();
+/// Stops the threads of the shards.
+static void map_shard_final(void)
+{
+	if( map_shard_threads.empty() )
+		return;
 
-	bl_list_count = blockcount;
-	return returnCount;
+	{
+		std::lock_guard<std::mutex> lock(map_shard_mutex);
+
+		map_shard_stopping = true;
+	}
+
+	map_shard_wake_cond.notify_all();
+
+	for( std::thread& thread : map_shard_threads )
+		thread.join();
+
+	map_shard_threads.clear();
 }
 
 
@@ -1857,7 +2205,7 @@ int map_addflooritem(struct item *item, int amount, int16 m, int16 x, int16 y, i
 
 	CREATE(fitem, struct flooritem_data, 1);
 	fitem->bl.type=BL_ITEM;
-	fitem->bl.prev = fitem->bl.next = NULL;
+	fitem->bl.prev = NULL;
 	fitem->bl.m=m;
 	fitem->bl.x=x;
 	fitem->bl.y=y;
@@ -2095,7 +2443,7 @@ int map_quit(struct map_session_data *sd) {
 		status_change_end(&sd->bl, SC_HAWKEYES, INVALID_TIMER);
 		status_change_end(&sd->bl, SC_EMERGENCY_MOVE, INVALID_TIMER);
 		status_change_end(&sd->bl, SC_CHASEWALK2, INVALID_TIMER);
-		if(sd->sc.data[SC_PROVOKE] && sd->sc.data[SC_PROVOKE]->timer == INVALID_TIMER)
+		if(sd->sc.getSCE(SC_PROVOKE) && sd->sc.getSCE(SC_PROVOKE)->timer == INVALID_TIMER)
 			status_change_end(&sd->bl, SC_PROVOKE, INVALID_TIMER); //Infinite provoke ends on logout
 		status_change_end(&sd->bl, SC_WEIGHT50, INVALID_TIMER);
 		status_change_end(&sd->bl, SC_WEIGHT90, INVALID_TIMER);
@@ -2124,7 +2472,7 @@ int map_quit(struct map_session_data *sd) {
 			status_change_end(&sd->bl, SC_STRIPHELM, INVALID_TIMER);
 			status_change_end(&sd->bl, SC_EXTREMITYFIST, INVALID_TIMER);
 			status_change_end(&sd->bl, SC_EXPLOSIONSPIRITS, INVALID_TIMER);
-			if(sd->sc.data[SC_REGENERATION] && sd->sc.data[SC_REGENERATION]->val4)
+			if(sd->sc.getSCE(SC_REGENERATION) && sd->sc.getSCE(SC_REGENERATION)->val4)
 				status_change_end(&sd->bl, SC_REGENERATION, INVALID_TIMER);
 			//TO-DO Probably there are way more NPC_type negative status that are removed
 			status_change_end(&sd->bl, SC_CHANGEUNDEAD, INVALID_TIMER);
@@ -2752,15 +3100,11 @@ int map_addinstancemap(int src_m, int instance_id)
 	dst_map->npc_num_warp = 0;
 
 	// Reallocate cells
-	size_t num_cell = dst_map->xs * dst_map->ys;
+	map_alloc_cells(dst_map);
+	memcpy( dst_map->cell, src_map->cell, (size_t)CELL_TERRAIN_MAX * dst_map->ys * dst_map->cell_words * sizeof(uint64) );
+	memcpy( dst_map->cell_overlay, src_map->cell_overlay, (size_t)(CELL_MAX - CELL_TERRAIN_MAX) * dst_map->ys * dst_map->cell_words * sizeof(uint64) );
 
-	CREATE( dst_map->cell, struct mapcell, num_cell );
-	memcpy( dst_map->cell, src_map->cell, num_cell * sizeof(struct mapcell) );
-
-	size_t size = dst_map->bxs * dst_map->bys * sizeof(struct block_list*);
-
-	dst_map->block = (struct block_list **)aCalloc(1,size);
-	dst_map->block_mob = (struct block_list **)aCalloc(1,size);
+	map_alloc_blocks(dst_map);
 
 	dst_map->index = mapindex_addmap(-1, dst_map->name);
 	dst_map->channel = nullptr;
@@ -2768,6 +3112,8 @@ int map_addinstancemap(int src_m, int instance_id)
 
 	map_data_copy(dst_map, src_map);
 
+	dst_map->shard = map_shard_lightest(dst_m);
+
 	ShowInfo("[Instance] Created map '%s' (%d) from '%s' (%d).\n", dst_map->name, dst_map->m, name, src_map->m);
 
 	map_addmap2db(dst_map);
@@ -2841,15 +3187,8 @@ int map_delinstancemap(int m)
 	mapdata->mob_delete_timer = INVALID_TIMER;
 
 	// Free memory
-	if (mapdata->cell)
-		aFree(mapdata->cell);
-	mapdata->cell = nullptr;
-	if (mapdata->block)
-		aFree(mapdata->block);
-	mapdata->block = nullptr;
-	if (mapdata->block_mob)
-		aFree(mapdata->block_mob);
-	mapdata->block_mob = nullptr;
+	map_free_cells(mapdata);
+	map_free_blocks(mapdata);
 
 	map_free_questinfo(mapdata);
 	mapdata->damage_adjust = {};
@@ -3160,33 +3499,98 @@ int map_random_dir(struct block_list *bl, int16 *x, int16 *y)
 }
 
 // gat system
-inline static struct mapcell map_gat2cell(int gat) {
-	struct mapcell cell;
-
-	memset(&cell,0,sizeof(struct mapcell));
-
-	switch( gat ) {
-		case 0: cell.walkable = 1; cell.shootable = 1; cell.water = 0; break; // walkable ground
-		case 1: cell.walkable = 0; cell.shootable = 0; cell.water = 0; break; // non-walkable ground
-		case 2: cell.walkable = 1; cell.shootable = 1; cell.water = 0; break; // ???
-		case 3: cell.walkable = 1; cell.shootable = 1; cell.water = 1; break; // walkable water
-		case 4: cell.walkable = 1; cell.shootable = 1; cell.water = 0; break; // ???
-		case 5: cell.walkable = 0; cell.shootable = 1; cell.water = 0; break; // gap (snipable)
-		case 6: cell.walkable = 1; cell.shootable = 1; cell.water = 0; break; // ???
-		default:
-			ShowWarning("map_gat2cell: unrecognized gat type '%d'\n", gat);
-			break;
+
+/// Sets or clears a flag of a cell, the cell has to be on the map.
+static inline void map_setcellflag(struct map_data* mapdata, cell_t flag, int16 x, int16 y, bool set)
+{
+	uint64* word = map_cellword(mapdata, flag, x, y);
+	uint64 bit = (uint64)1 << (x % 64);
+
+	if( set )
+		*word |= bit;
+	else
+		*word &= ~bit;
+}
+
+/// Terrain flags of a gat type
+enum e_gat_flag : uint8 {
+	GAT_WALKABLE = 0x1,
+	GAT_SHOOTABLE = 0x2,
+	GAT_WATER = 0x4,
+};
+
+/// Terrain flags of the gat types, unrecognized gat types have none
+static const uint8 map_gat_flags[] = {
+	GAT_WALKABLE|GAT_SHOOTABLE, // 0: walkable ground
+	0, // 1: non-walkable ground
+	GAT_WALKABLE|GAT_SHOOTABLE, // 2: ???
+	GAT_WALKABLE|GAT_SHOOTABLE|GAT_WATER, // 3: walkable water
+	GAT_WALKABLE|GAT_SHOOTABLE, // 4: ???
+	GAT_SHOOTABLE, // 5: gap (snipable)
+	GAT_WALKABLE|GAT_SHOOTABLE, // 6: ???
+};
+
+/// Sets the terrain flags of a cell from its gat type, the cell has to be on the map.
+static void map_setgatcellp(struct map_data* mapdata, int16 x, int16 y, int gat)
+{
+	uint8 flags = 0;
+
+	if( gat >= 0 && (size_t)gat < ARRAYLENGTH(map_gat_flags) )
+		flags = map_gat_flags[gat];
+	else
+		ShowWarning("map_gat2cell: unrecognized gat type '%d'\n", gat);
+
+	map_setcellflag(mapdata, CELL_WALKABLE, x, y, (flags&GAT_WALKABLE) != 0);
+	map_setcellflag(mapdata, CELL_SHOOTABLE, x, y, (flags&GAT_SHOOTABLE) != 0);
+	map_setcellflag(mapdata, CELL_WATER, x, y, (flags&GAT_WATER) != 0);
+}
+
+/**
+ * Sets the terrain flags of a whole row of a map from its gat types, a word of each bitplane at a time.
+ * Used by the map loading threads, so unrecognized gat types are only counted instead of being reported.
+ * @param mapdata: Map with empty cells
+ * @param y: Row
+ * @param gat: Gat types of the row
+ * @return Number of unrecognized gat types
+ */
+static uint32 map_setgatrow(struct map_data* mapdata, int16 y, const int* gat)
+{
+	uint32 unknown = 0;
+
+	for( int16 x = 0; x < mapdata->xs; x += 64 ){
+		uint64 walkable = 0, shootable = 0, water = 0;
+		int16 n = min(mapdata->xs - x, 64);
+
+		for( int16 i = 0; i < n; i++ ){
+			int type = gat[x + i];
+			uint8 flags;
+
+			if( type >= 0 && (size_t)type < ARRAYLENGTH(map_gat_flags) )
+				flags = map_gat_flags[type];
+			else{
+				flags = 0;
+				unknown++;
+			}
+
+			walkable |= (uint64)( ( flags & GAT_WALKABLE ) != 0 ) << i;
+			shootable |= (uint64)( ( flags & GAT_SHOOTABLE ) != 0 ) << i;
+			water |= (uint64)( ( flags & GAT_WATER ) != 0 ) << i;
+		}
+
+		*map_cellword(mapdata, CELL_WALKABLE, x, y) = walkable;
+		*map_cellword(mapdata, CELL_SHOOTABLE, x, y) = shootable;
+		*map_cellword(mapdata, CELL_WATER, x, y) = water;
 	}
 
-	return cell;
+	return unknown;
 }
 
-static int map_cell2gat(struct mapcell cell)
+static int map_cell2gat(bool walkable, bool shootable, bool water)
 {
-	if( cell.walkable == 1 && cell.shootable == 1 && cell.water == 0 ) return 0;
-	if( cell.walkable == 0 && cell.shootable == 0 && cell.water == 0 ) return 1;
-	if( cell.walkable == 1 && cell.shootable == 1 && cell.water == 1 ) return 3;
-	if( cell.walkable == 0 && cell.shootable == 1 && cell.water == 0 ) return 5;
+	if( walkable && shootable && !water ) return 0;
+	if( !walkable && !shootable && !water ) return 1;
+	if( walkable && shootable && water ) return 3;
+	if( !walkable && shootable && !water ) return 5;
 
 	ShowWarning("map_cell2gat: cell has no matching gat type\n");
 	return 1; // default to 'wall'
@@ -3205,67 +3609,63 @@ int map_getcell(int16 m,int16 x,int16 y,cell_chk cellchk)
 
 int map_getcellp(struct map_data* m,int16 x,int16 y,cell_chk cellchk)
 {
-	struct mapcell cell;
-
 	nullpo_ret(m);
 
 	//NOTE: this intentionally overrides the last row and column
 	if(x<0 || x>=m->xs-1 || y<0 || y>=m->ys-1)
 		return( cellchk == CELL_CHKNOPASS );
 
-	cell = m->cell[x + y*m->xs];
-
 	switch(cellchk)
 	{
 		// gat type retrieval
 		case CELL_GETTYPE:
-			return map_cell2gat(cell);
+			return map_cell2gat(map_cellflag(m, CELL_WALKABLE, x, y), map_cellflag(m, CELL_SHOOTABLE, x, y), map_cellflag(m, CELL_WATER, x, y));
 
 		// base gat type checks
 		case CELL_CHKWALL:
-			return (!cell.walkable && !cell.shootable);
+			return (!map_cellflag(m, CELL_WALKABLE, x, y) && !map_cellflag(m, CELL_SHOOTABLE, x, y));
 
 		case CELL_CHKWATER:
-			return (cell.water);
+			return map_cellflag(m, CELL_WATER, x, y);
 
 		case CELL_CHKCLIFF:
-			return (!cell.walkable && cell.shootable);
+			return (!map_cellflag(m, CELL_WALKABLE, x, y) && map_cellflag(m, CELL_SHOOTABLE, x, y));
 
 
 		// base cell type checks
 		case CELL_CHKNPC:
-			return (cell.npc);
+			return map_cellflag(m, CELL_NPC, x, y);
 		case CELL_CHKBASILICA:
-			return (cell.basilica);
+			return map_cellflag(m, CELL_BASILICA, x, y);
 		case CELL_CHKLANDPROTECTOR:
-			return (cell.landprotector);
+			return map_cellflag(m, CELL_LANDPROTECTOR, x, y);
 		case CELL_CHKNOVENDING:
-			return (cell.novending);
+			return map_cellflag(m, CELL_NOVENDING, x, y);
 		case CELL_CHKNOCHAT:
-			return (cell.nochat);
+			return map_cellflag(m, CELL_NOCHAT, x, y);
 		case CELL_CHKMAELSTROM:
-			return (cell.maelstrom);
+			return map_cellflag(m, CELL_MAELSTROM, x, y);
 		case CELL_CHKICEWALL:
-			return (cell.icewall);
+			return map_cellflag(m, CELL_ICEWALL, x, y);
 
 		// special checks
 		case CELL_CHKPASS:
 #ifdef CELL_NOSTACK
-			if (cell.cell_bl >= battle_config.custom_cell_stack_limit) return 0;
+			if (m->cell_bl[x + y*m->xs] >= battle_config.custom_cell_stack_limit) return 0;
 #endif
 		case CELL_CHKREACH:
-			return (cell.walkable);
+			return map_cellflag(m, CELL_WALKABLE, x, y);
 
 		case CELL_CHKNOPASS:
 #ifdef CELL_NOSTACK
-			if (cell.cell_bl >= battle_config.custom_cell_stack_limit) return 1;
+			if (m->cell_bl[x + y*m->xs] >= battle_config.custom_cell_stack_limit) return 1;
 #endif
 		case CELL_CHKNOREACH:
-			return (!cell.walkable);
+			return !map_cellflag(m, CELL_WALKABLE, x, y);
 
 		case CELL_CHKSTACK:
 #ifdef CELL_NOSTACK
-			return (cell.cell_bl >= battle_config.custom_cell_stack_limit);
+			return (m->cell_bl[x + y*m->xs] >= battle_config.custom_cell_stack_limit);
 #else
 			return 0;
 #endif
@@ -3275,6 +3675,121 @@ int map_getcellp(struct map_data* m,int16 x,int16 y,cell_chk cellchk)
 	}
 }
 
+/// Counts the set bits of a word.
+static inline int map_popcount(uint64 v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_popcountll(v);
+#else
+	v = v - ((v >> 1) & 0x5555555555555555ULL);
+	v = (v & 0x3333333333333333ULL) + ((v >> 2) & 0x3333333333333333ULL);
+	v = (v + (v >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	return (int)((v * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+/**
+ * Counts the cells of an area for which map_getcell(m, x, y, cellchk) would be true.
+ * @see map_getcellp_count
+ */
+int map_getcell_count(int16 m, int16 x0, int16 y0, int16 x1, int16 y1, cell_chk cellchk)
+{
+	if (m < 0)
+		return 0;
+	else
+		return map_getcellp_count(map_getmapdata(m), x0, y0, x1, y1, cellchk);
+}
+
+/**
+ * Counts the cells of an area for which map_getcellp(m, x, y, cellchk) would be true.
+ * Checks whose result only depends on the bitplanes are done a row word (64 cells) at a time.
+ * @param m: Map
+ * @param x0: West end of the area
+ * @param y0: South end of the area
+ * @param x1: East end of the area
+ * @param y1: North end of the area
+ * @param cellchk: Check to do for each cell
+ * @return number of cells in the area, which passed the check
+ */
+int map_getcellp_count(struct map_data* m, int16 x0, int16 y0, int16 x1, int16 y1, cell_chk cellchk)
+{
+	nullpo_ret(m);
+
+	if( x0 > x1 )
+		SWAP(x0, x1);
+	if( y0 > y1 )
+		SWAP(y0, y1);
+
+	// Same as in map_getcellp, the last row and column are not checked
+	int16 cx0 = i16max(x0, 0), cy0 = i16max(y0, 0);
+	int16 cx1 = i16min(x1, m->xs - 2), cy1 = i16min(y1, m->ys - 2);
+	int count = 0;
+
+	if( cellchk == CELL_CHKNOPASS ){
+		// Cells outside of the checked part are not passable
+		count = (x1 - x0 + 1) * (y1 - y0 + 1);
+		if( cx0 <= cx1 && cy0 <= cy1 )
+			count -= (cx1 - cx0 + 1) * (cy1 - cy0 + 1);
+	}
+
+	if( cx0 > cx1 || cy0 > cy1 )
+		return count;
+
+	cell_t flag, flag2 = CELL_MAX;
+	bool invert = false, invert2 = false;
+
+	switch( cellchk ){
+		case CELL_CHKWALL:			flag = CELL_WALKABLE; invert = true; flag2 = CELL_SHOOTABLE; invert2 = true; break;
+		case CELL_CHKWATER:			flag = CELL_WATER; break;
+		case CELL_CHKCLIFF:			flag = CELL_WALKABLE; invert = true; flag2 = CELL_SHOOTABLE; break;
+		case CELL_CHKNPC:			flag = CELL_NPC; break;
+		case CELL_CHKBASILICA:		flag = CELL_BASILICA; break;
+		case CELL_CHKLANDPROTECTOR:	flag = CELL_LANDPROTECTOR; break;
+		case CELL_CHKNOVENDING:		flag = CELL_NOVENDING; break;
+		case CELL_CHKNOCHAT:		flag = CELL_NOCHAT; break;
+		case CELL_CHKMAELSTROM:		flag = CELL_MAELSTROM; break;
+		case CELL_CHKICEWALL:		flag = CELL_ICEWALL; break;
+		case CELL_CHKREACH:			flag = CELL_WALKABLE; break;
+		case CELL_CHKNOREACH:		flag = CELL_WALKABLE; invert = true; break;
+#ifndef CELL_NOSTACK
+		case CELL_CHKPASS:			flag = CELL_WALKABLE; break;
+		case CELL_CHKNOPASS:		flag = CELL_WALKABLE; invert = true; break;
+#endif
+		default:
+			// Depends on more than the bitplanes
+			for( int16 y = cy0; y <= cy1; y++ ){
+				for( int16 x = cx0; x <= cx1; x++ ){
+					if( map_getcellp(m, x, y, cellchk) )
+						count++;
+				}
+			}
+			return count;
+	}
+
+	for( int16 y = cy0; y <= cy1; y++ ){
+		const uint64* row = map_cellword(m, flag, 0, y);
+		const uint64* row2 = ( flag2 != CELL_MAX ) ? map_cellword(m, flag2, 0, y) : nullptr;
+
+		for( int w = cx0 / 64; w <= cx1 / 64; w++ ){
+			uint64 mask = ~(uint64)0;
+
+			if( w == cx0 / 64 )
+				mask &= ~(uint64)0 << (cx0 % 64);
+			if( w == cx1 / 64 && cx1 % 64 != 63 )
+				mask &= ((uint64)1 << (cx1 % 64 + 1)) - 1;
+
+			uint64 bits = invert ? ~row[w] : row[w];
+
+			if( row2 != nullptr )
+				bits &= invert2 ? ~row2[w] : row2[w];
+
+			count += map_popcount(bits & mask);
+		}
+	}
+
+	return count;
+}
+
 /*==========================================
  * Change the type/flags of a map cell
  * 'cell' - which flag to modify
@@ -3282,47 +3797,32 @@ int map_getcellp(struct map_data* m,int16 x,int16 y,cell_chk cellchk)
  *------------------------------------------*/
 void map_setcell(int16 m, int16 x, int16 y, cell_t cell, bool flag)
 {
-	int j;
 	struct map_data *mapdata = map_getmapdata(m);
 
 	if( m < 0 || x < 0 || x >= mapdata->xs || y < 0 || y >= mapdata->ys )
 		return;
 
-	j = x + y*mapdata->xs;
+	if( cell < CELL_WALKABLE || cell >= CELL_MAX ){
+		ShowWarning("map_setcell: invalid cell type '%d'\n", (int)cell);
+		return;
+	}
 
-	switch( cell ) {
-		case CELL_WALKABLE:      mapdata->cell[j].walkable = flag;      break;
-		case CELL_SHOOTABLE:     mapdata->cell[j].shootable = flag;     break;
-		case CELL_WATER:         mapdata->cell[j].water = flag;         break;
+	if( map_cellflag(mapdata, cell, x, y) == flag )
+		return;
 
-		case CELL_NPC:           mapdata->cell[j].npc = flag;           break;
-		case CELL_BASILICA:      mapdata->cell[j].basilica = flag;      break;
-		case CELL_LANDPROTECTOR: mapdata->cell[j].landprotector = flag; break;
-		case CELL_NOVENDING:     mapdata->cell[j].novending = flag;     break;
-		case CELL_NOCHAT:        mapdata->cell[j].nochat = flag;        break;
-		case CELL_MAELSTROM:	 mapdata->cell[j].maelstrom = flag;	  break;
-		case CELL_ICEWALL:		 mapdata->cell[j].icewall = flag;		  break;
-		default:
-			ShowWarning("map_setcell: invalid cell type '%d'\n", (int)cell);
-			break;
-	}
+	map_setcellflag(mapdata, cell, x, y, flag);
+	mapdata->cell_version++;
 }
 
 void map_setgatcell(int16 m, int16 x, int16 y, int gat)
 {
-	int j;
-	struct mapcell cell;
 	struct map_data *mapdata = map_getmapdata(m);
 
 	if( m < 0 || x < 0 || x >= mapdata->xs || y < 0 || y >= mapdata->ys )
 		return;
 
-	j = x + y*mapdata->xs;
-
-	cell = map_gat2cell(gat);
-	mapdata->cell[j].walkable = cell.walkable;
-	mapdata->cell[j].shootable = cell.shootable;
-	mapdata->cell[j].water = cell.water;
+	map_setgatcellp(mapdata, x, y, gat);
+	mapdata->cell_version++;
 }
 
 /*==========================================
@@ -3545,55 +4045,210 @@ static char *map_init_mapcache(FILE *fp)
 	return buffer;
 }
 
-/*==========================================
- * Map cache reading
- * [Shinryo]: Optimized some behaviour to speed this up
- *==========================================*/
-int map_readfromcache(struct map_data *m, char *buffer, char *decode_buffer)
+#define MAP_LOAD_BATCH 64 // Number of gat files that are read before they are decoded, when using GRF files
+
+/// A map that is being loaded by map_readallmaps
+struct s_map_load_job {
+	const char* data; // Compressed gat types of the map in the map cache
+	unsigned long len; // Length of the compressed gat types
+	uint8* gat; // Gat file of the map, when using GRF files
+	int water_height; // Water level of the map, when using GRF files
+	uint32 unknown; // Number of cells with unrecognized gat types
+	bool failed; // Whether the cells could not be decoded
+};
+
+/// Indexes the maps of a map cache by their name.
+static void map_index_mapcache(char* buffer, std::unordered_map<std::string, const struct map_cache_map_info*>& index)
 {
-	int i;
 	struct map_cache_main_header *header = (struct map_cache_main_header *)buffer;
-	struct map_cache_map_info *info = NULL;
 	char *p = buffer + sizeof(struct map_cache_main_header);
 
-	for(i = 0; i < header->map_count; i++) {
-		info = (struct map_cache_map_info *)p;
+	for( int i = 0; i < header->map_count; i++ ){
+		const struct map_cache_map_info* info = (struct map_cache_map_info *)p;
 
-		if( strcmp(m->name, info->name) == 0 )
-			break; // Map found
+		// The first entry of a map is used
+		index.emplace(std::string(info->name, strnlen(info->name, MAP_NAME_LENGTH)), info);
 
 		// Jump to next entry..
 		p += sizeof(struct map_cache_map_info) + info->len;
 	}
+}
+
+/*==========================================
+ * Map cache reading
+ * [Shinryo]: Optimized some behaviour to speed this up
+ * Only locates the map, its cells are decoded by map_decodecells.
+ *==========================================*/
+static bool map_readfromcache(struct map_data *m, const std::unordered_map<std::string, const struct map_cache_map_info*>& index, struct s_map_load_job* job)
+{
+	auto it = index.find(m->name);
+
+	if( it == index.end() )
+		return false; // Not found
+
+	const struct map_cache_map_info *info = it->second;
+
+	if( info->xs <= 0 || info->ys <= 0 )
+		return false; // Invalid
+
+	if( (unsigned long)info->xs * (unsigned long)info->ys > MAX_MAP_SIZE ){
+		ShowWarning("map_readfromcache: %s exceeded MAX_MAP_SIZE of %d\n", info->name, MAX_MAP_SIZE);
+		return false; // Say not found to remove it from list.. [Shinryo]
+	}
+
+	m->xs = info->xs;
+	m->ys = info->ys;
+	map_alloc_cells(m);
+
+	job->data = (const char*)info + sizeof(struct map_cache_map_info);
+	job->len = info->len;
 
-	if( info && i < header->map_count ) {
-		unsigned long size, xy;
+	return true;
+}
+
+/// Calculates the FNV-1a hash of a file.
+static bool map_hash_file(const char* path, uint64* hash, uint32* size)
+{
+	FILE* fp = fopen(path, "rb");
+	unsigned char buffer[65536];
+	size_t len;
 
-		if( info->xs <= 0 || info->ys <= 0 )
-			return 0;// Invalid
+	if( fp == nullptr )
+		return false;
 
-		m->xs = info->xs;
-		m->ys = info->ys;
-		size = (unsigned long)info->xs*(unsigned long)info->ys;
+	*hash = 14695981039346656037ULL;
+	*size = 0;
 
-		if(size > MAX_MAP_SIZE) {
-			ShowWarning("map_readfromcache: %s exceeded MAX_MAP_SIZE of %d\n", info->name, MAX_MAP_SIZE);
-			return 0; // Say not found to remove it from list.. [Shinryo]
+	while( ( len = fread(buffer, 1, sizeof(buffer), fp) ) > 0 ){
+		for( size_t i = 0; i < len; i++ ){
+			*hash ^= buffer[i];
+			*hash *= 1099511628211ULL;
 		}
+		*size += (uint32)len;
+	}
+
+	fclose(fp);
+	return true;
+}
+
+/**
+ * Opens a flat map cache and maps it into memory.
+ * The pages are mapped copy-on-write, so the terrain of all map-servers on a machine
+ * is shared until a cell is changed at runtime.
+ * @param cache: Flat map cache to open
+ * @param path: Path of the flat map cache
+ * @param source: Path of the map cache, which it has to be created from
+ * @return true if the flat map cache can be used
+ */
+static bool map_open_mapcache_flat(struct s_map_cache_flat* cache, const char* path, const char* source)
+{
+	struct map_cache_flat_header header;
+	FILE* fp;
+	size_t size;
+
+	if( ( fp = fopen(path, "rb") ) == nullptr )
+		return false;
+
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
 
-		// TO-DO: Maybe handle the scenario, if the decoded buffer isn't the same size as expected? [Shinryo]
-		decode_zip(decode_buffer, &size, p+sizeof(struct map_cache_map_info), info->len);
+	if( size < sizeof(header) || fread(&header, sizeof(header), 1, fp) != 1 || header.magic != MAP_CACHE_FLAT_MAGIC || header.version != MAP_CACHE_FLAT_VERSION
+		|| sizeof(header) + (size_t)header.map_count * sizeof(struct map_cache_flat_info) > size ){
+		ShowWarning("Flat map cache " CL_WHITE "%s" CL_RESET " is invalid, run the mapcache tool again.\n", path);
+		fclose(fp);
+		return false;
+	}
 
-		CREATE(m->cell, struct mapcell, size);
+	uint64 hash;
+	uint32 source_size;
+
+	if( map_hash_file(source, &hash, &source_size) && ( hash != header.source_hash || source_size != header.source_size ) ){
+		ShowWarning("Flat map cache " CL_WHITE "%s" CL_RESET " is older than " CL_WHITE "%s" CL_RESET ", run the mapcache tool again.\n", path, source);
+		fclose(fp);
+		return false;
+	}
 
+#ifndef _WIN32
+	void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno(fp), 0);
 
-		for( xy = 0; xy < size; ++xy )
-			m->cell[xy] = map_gat2cell(decode_buffer[xy]);
+	if( data == MAP_FAILED ){
+		ShowError("map_open_mapcache_flat: Failed to map %s into memory: %s\n", path, strerror(errno));
+		fclose(fp);
+		return false;
+	}
 
-		return 1;
+	cache->data = (char*)data;
+	cache->mapped = true;
+#else
+	CREATE(cache->data, char, size);
+	fseek(fp, 0, SEEK_SET);
+
+	if( fread(cache->data, 1, size, fp) != size ){
+		ShowError("map_open_mapcache_flat: Could not read entire flat map cache %s\n", path);
+		aFree(cache->data);
+		cache->data = nullptr;
+		fclose(fp);
+		return false;
+	}
+
+	cache->mapped = false;
+#endif
+	fclose(fp);
+	cache->size = size;
+
+	const struct map_cache_flat_info* info = (const struct map_cache_flat_info*)(cache->data + sizeof(header));
+
+	for( uint32 i = 0; i < header.map_count; i++, info++ ){
+		size_t words = (size_t)CELL_TERRAIN_MAX * info->ys * ((info->xs + 63) / 64);
+
+		if( info->xs <= 0 || info->ys <= 0 || info->offset % sizeof(uint64) != 0 || info->offset + words * sizeof(uint64) > size ){
+			ShowWarning("Flat map cache " CL_WHITE "%s" CL_RESET " has an invalid entry for map %.*s, it is skipped.\n", path, MAP_NAME_LENGTH, info->name);
+			continue;
+		}
+
+		cache->maps[std::string(info->name, strnlen(info->name, MAP_NAME_LENGTH))] = info;
+	}
+
+	return true;
+}
+
+/// Unmaps a flat map cache, no map may use its terrain anymore.
+static void map_close_mapcache_flat(struct s_map_cache_flat* cache)
+{
+	if( cache->data == nullptr )
+		return;
+
+#ifndef _WIN32
+	munmap(cache->data, cache->size);
+#else
+	aFree(cache->data);
+#endif
+	cache->data = nullptr;
+	cache->size = 0;
+	cache->maps.clear();
+}
+
+/// Uses the terrain of a map in a flat map cache.
+static bool map_readfromcache_flat(struct map_data* m, struct s_map_cache_flat* cache)
+{
+	auto it = cache->maps.find(m->name);
+
+	if( it == cache->maps.end() )
+		return false;
+
+	const struct map_cache_flat_info* info = it->second;
+
+	if( (unsigned long)info->xs * (unsigned long)info->ys > MAX_MAP_SIZE ){
+		ShowWarning("map_readfromcache_flat: %s exceeded MAX_MAP_SIZE of %d\n", m->name, MAX_MAP_SIZE);
+		return false;
 	}
 
-	return 0; // Not found
+	m->xs = info->xs;
+	m->ys = info->ys;
+	map_alloc_cells(m, (uint64*)(cache->data + info->offset));
+
+	return true;
 }
 
 int map_addmap(char* mapname)
@@ -3731,45 +4386,85 @@ int map_waterheight(char* mapname)
 
 /*==================================
  * .GAT format
+ * Only reads the file, its cells are decoded by map_decodecells.
  *----------------------------------*/
-int map_readgat (struct map_data* m)
+static bool map_readgat(struct map_data* m, struct s_map_load_job* job)
 {
 	char filename[256];
 	uint8* gat;
-	int water_height;
-	size_t xy, off, num_cells;
 
 	sprintf(filename, "data\\%s.gat", m->name);
 
 	gat = (uint8 *) grfio_read(filename);
 	if (gat == NULL)
-		return 0;
+		return false;
 
 	m->xs = *(int32*)(gat+6);
 	m->ys = *(int32*)(gat+10);
-	num_cells = m->xs * m->ys;
-	CREATE(m->cell, struct mapcell, num_cells);
+	map_alloc_cells(m);
 
-	water_height = map_waterheight(m->name);
+	job->gat = gat;
+	job->water_height = map_waterheight(m->name);
 
-	// Set cell properties
-	off = 14;
-	for( xy = 0; xy < num_cells; ++xy )
-	{
-		// read cell data
-		float height = *(float*)( gat + off      );
-		uint32 type = *(uint32*)( gat + off + 16 );
-		off += 20;
+	return true;
+}
+
+/**
+ * Decodes the cells of a map, that was located by map_readfromcache or map_readgat.
+ * Runs on the map loading threads, so neither the memory manager nor the console may be used.
+ * @param m: Map
+ * @param job: Map loading job of the map
+ * @param buffer: Buffer of the thread for the decompressed map cache data
+ * @param row: Buffer of the thread for the gat types of a row
+ */
+static void map_decodecells(struct map_data* m, struct s_map_load_job* job, std::vector<uint8>& buffer, std::vector<int>& row)
+{
+	unsigned long size = (unsigned long)m->xs * (unsigned long)m->ys;
+
+	row.resize(m->xs);
+
+	if( job->gat != nullptr ){
+		const uint8* p = job->gat + 14;
+
+		for( int16 y = 0; y < m->ys; y++ ){
+			for( int16 x = 0; x < m->xs; x++, p += 20 ){
+				// read cell data
+				float height = *(float*)( p      );
+				uint32 type = *(uint32*)( p + 16 );
+
+				if( type == 0 && job->water_height != RSW_NO_WATER && height > job->water_height )
+					type = 3; // Cell is 0 (walkable) but under water level, set to 3 (walkable water)
+
+				row[x] = (int)type;
+			}
+
+			job->unknown += map_setgatrow(m, y, row.data());
+		}
+	}else{
+		buffer.resize(size);
+
+		if( decode_zip(buffer.data(), &size, job->data, job->len) != 0 || size != buffer.size() ){
+			job->failed = true;
+			return;
+		}
 
-		if( type == 0 && water_height != RSW_NO_WATER && height > water_height )
-			type = 3; // Cell is 0 (walkable) but under water level, set to 3 (walkable water)
+		for( int16 y = 0; y < m->ys; y++ ){
+			for( int16 x = 0; x < m->xs; x++ )
+				row[x] = (char)buffer[(size_t)y * m->xs + x];
 
-		m->cell[xy] = map_gat2cell(type);
+			job->unknown += map_setgatrow(m, y, row.data());
+		}
 	}
+}
 
-	aFree(gat);
+/// Returns the microseconds since a point in time and moves the point to now.
+static int64 map_lap_us(std::chrono::steady_clock::time_point& since)
+{
+	auto now = std::chrono::steady_clock::now();
+	int64 us = std::chrono::duration_cast<std::chrono::microseconds>(now - since).count();
 
-	return 1;
+	since = now;
+	return us;
 }
 
 /*======================================
@@ -3796,7 +4491,9 @@ int map_readallmaps (void)
 		NULL,
 		NULL
 	};
-	char map_cache_decode_buffer[MAX_MAP_SIZE];
+	std::unordered_map<std::string, const struct map_cache_map_info*> map_cache_index[2];
+	auto lap = std::chrono::steady_clock::now();
+	int64 cache_us, read_us = 0, decode_us = 0, register_us, flags_us;
 
 	if( enable_grf )
 		ShowStatus("Loading maps (using GRF files)...\n");
@@ -3805,8 +4502,18 @@ int map_readallmaps (void)
 			"db/" DBPATH "map_cache.dat",
 			"db/" DBIMPORT "/map_cache.dat"
 		};
+		const char* mapcacheflatpath[] = {
+			"db/" DBPATH "map_cache_flat.dat",
+			"db/" DBIMPORT "/map_cache_flat.dat"
+		};
 
 		for( int i = 0; i < 2; i++ ){
+			// Prefer the flat map cache, its terrain can be used without decoding it
+			if( map_open_mapcache_flat( &map_cache_flat[i], mapcacheflatpath[i], mapcachefilepath[i] ) ){
+				ShowStatus( "Loading maps (using %s as map cache)...\n", mapcacheflatpath[i] );
+				continue;
+			}
+
 			ShowStatus( "Loading maps (using %s as map cache)...\n", mapcachefilepath[i] );
 
 			if( ( fp = fopen(mapcachefilepath[i], "rb") ) == NULL ){
@@ -3828,53 +4535,123 @@ int map_readallmaps (void)
 			}
 
 			fclose(fp);
+
+			map_index_mapcache(map_cache_buffer[i], map_cache_index[i]);
 		}
 	}
 
+	cache_us = map_lap_us(lap);
+
+	int threads = map_load_threads;
+
+	if( threads <= 0 )
+		threads = (int)std::thread::hardware_concurrency();
+	threads = cap_value(threads, 1, 64);
+
+	// The gat files are only held in memory for one batch of maps, the map cache is in memory anyway
+	int batch = enable_grf ? MAP_LOAD_BATCH : INT_MAX;
+	std::vector<struct s_map_load_job> jobs; // Map loading jobs of the maps, in the order of the map list
 	int maps_removed = 0;
 
-	for (int i = 0; i < map_num; i++) {
-		size_t size;
-		bool success = false;
-		unsigned short idx = 0;
-		struct map_data *mapdata = &map[i];
+	jobs.reserve(map_num);
+
+	for( int begin = 0; begin < map_num; ){
+		int end = begin;
+
+		// Locate the maps of the batch and allocate their cells
+		while( end < map_num && end - begin < batch ){
+			bool success = false;
+			unsigned short idx = 0;
+			struct map_data *mapdata = &map[end];
+			struct s_map_load_job job = {};
+
+			// show progress
+			ShowStatus("Loading maps [%i/%i]: %s" CL_CLL "\r", end, map_num, mapdata->name);
+
+			if( enable_grf ){
+				// try to load the map
+				success = map_readgat(mapdata, &job);
+			}else{
+				// try to load the map
+				// Read from import first, in case of override
+				// If nothing was found in import - try to find it in the main file
+				for( int j = 1; j >= 0 && !success; j-- ){
+					if( map_cache_flat[j].data != nullptr ){
+						success = map_readfromcache_flat( mapdata, &map_cache_flat[j] );
+					}else if( map_cache_buffer[j] != NULL ){
+						success = map_readfromcache( mapdata, map_cache_index[j], &job );
+					}
+				}
+			}
 
-		// show progress
-		ShowStatus("Loading maps [%i/%i]: %s" CL_CLL "\r", i, map_num, mapdata->name);
-
-		if( enable_grf ){
-			// try to load the map
-			success = map_readgat(mapdata) != 0;
-		}else{
-			// try to load the map
-			// Read from import first, in case of override
-			if( map_cache_buffer[1] != NULL ){
-				success = map_readfromcache( mapdata, map_cache_buffer[1], map_cache_decode_buffer ) != 0;
+			// The map was not found - remove it
+			if (!(idx = mapindex_name2id(mapdata->name)) || !success) {
+				map_free_cells(mapdata);
+				if( job.gat != nullptr )
+					aFree(job.gat);
+				map_delmapid(end);
+				maps_removed++;
+				continue;
 			}
 
-			// Nothing was found in import - try to find it in the main file
-			if( !success ){
-				success = map_readfromcache( mapdata, map_cache_buffer[0], map_cache_decode_buffer ) != 0;
+			mapdata->index = idx;
+			jobs.push_back(job);
+			end++;
+		}
+
+		read_us += map_lap_us(lap);
+
+		// Decode the cells of the batch, each map is decoded by one of the threads
+		std::atomic<int> next(begin);
+		auto decode = [&]() {
+			std::vector<uint8> buffer;
+			std::vector<int> row;
+
+			for( int i = next++; i < end; i = next++ ){
+				if( jobs[i].data != nullptr || jobs[i].gat != nullptr )
+					map_decodecells(&map[i], &jobs[i], buffer, row);
+			}
+		};
+		std::vector<std::thread> workers;
+
+		for( int i = 1; i < min(threads, end - begin); i++ )
+			workers.emplace_back(decode);
+		decode();
+		for( std::thread& worker : workers )
+			worker.join();
+
+		for( int i = begin; i < end; i++ ){
+			if( jobs[i].gat != nullptr ){
+				aFree(jobs[i].gat);
+				jobs[i].gat = nullptr;
 			}
 		}
 
-		// The map was not found - remove it
-		if (!(idx = mapindex_name2id(mapdata->name)) || !success) {
+		decode_us += map_lap_us(lap);
+		begin = end;
+	}
+
+	for (int i = 0; i < map_num; i++) {
+		struct map_data *mapdata = &map[i];
+
+		if( jobs[i].failed ){
+			ShowWarning("map_readallmaps: Failed to decode the cells of %s.\n", mapdata->name);
+			map_free_cells(mapdata);
 			map_delmapid(i);
+			jobs.erase(jobs.begin() + i);
 			maps_removed++;
 			i--;
 			continue;
 		}
 
-		mapdata->index = idx;
+		if( jobs[i].unknown > 0 )
+			ShowWarning("map_readallmaps: %s has %u cells with an unrecognized gat type.\n", mapdata->name, jobs[i].unknown);
 
 		if (uidb_get(map_db,(unsigned int)mapdata->index) != NULL) {
 			ShowWarning("Map %s already loaded!" CL_CLL "\n", mapdata->name);
-			if (mapdata->cell) {
-				aFree(mapdata->cell);
-				mapdata->cell = NULL;
-			}
+			map_free_cells(mapdata);
 			map_delmapid(i);
+			jobs.erase(jobs.begin() + i);
 			maps_removed++;
 			i--;
 			continue;
@@ -3889,24 +4666,28 @@ int map_readallmaps (void)
 		mapdata->bxs = (mapdata->xs + BLOCK_SIZE - 1) / BLOCK_SIZE;
 		mapdata->bys = (mapdata->ys + BLOCK_SIZE - 1) / BLOCK_SIZE;
 
-		size = mapdata->bxs * mapdata->bys * sizeof(struct block_list*);
-		mapdata->block = (struct block_list**)aCalloc(size, 1);
-		mapdata->block_mob = (struct block_list**)aCalloc(size, 1);
+		map_alloc_blocks(mapdata);
 
 		memset(&mapdata->save, 0, sizeof(struct point));
 		mapdata->damage_adjust = {};
 		mapdata->channel = NULL;
 	}
 
+	register_us = map_lap_us(lap);
+
 	// intialization and configuration-dependent adjustments of mapflags
 	map_flags_init();
 
+	flags_us = map_lap_us(lap);
+
 	if( !enable_grf ) {
 		// The cache isn't needed anymore, so free it. [Shinryo]
-		if( map_cache_buffer[1] != NULL ){
-			aFree(map_cache_buffer[1]);
+		// The flat map cache stays mapped, since the maps use its terrain.
+		for( int i = 0; i < 2; i++ ){
+			if( map_cache_buffer[i] != NULL ){
+				aFree(map_cache_buffer[i]);
+			}
 		}
-		aFree(map_cache_buffer[0]);
 	}
 
 	if (maps_removed)
@@ -3914,6 +4695,8 @@ int map_readallmaps (void)
 
 	// finished map loading
 	ShowInfo("Successfully loaded '" CL_WHITE "%d" CL_RESET "' maps." CL_CLL "\n",map_num);
+	ShowInfo("Map loading took " CL_WHITE "%d" CL_RESET " ms (map cache: %d ms, reading: %d ms, decoding: %d ms on %d threads, registration: %d ms, mapflags: %d ms).\n",
+		(int)((cache_us + read_us + decode_us + register_us + flags_us) / 1000), (int)(cache_us / 1000), (int)(read_us / 1000), (int)(decode_us / 1000), threads, (int)(register_us / 1000), (int)(flags_us / 1000));
 
 	return 0;
 }
@@ -4077,6 +4860,8 @@ int map_config_read(const char *cfgName)
 			safestrncpy(channel_conf, w2, sizeof(channel_conf));
 		else if(strcmpi(w1,"db_path") == 0)
 			safestrncpy(db_path,w2,ARRAYLENGTH(db_path));
+		else if(strcmpi(w1,"db_snapshot_path") == 0)
+			YamlDatabase::snapshotPath = strcmpi(w2, "none") == 0 ? "" : w2;
 		else if (strcmpi(w1, "console") == 0) {
 			console = config_switch(w2);
 			if (console)
@@ -4085,6 +4870,10 @@ int map_config_read(const char *cfgName)
 			enable_spy = config_switch(w2);
 		else if (strcmpi(w1, "use_grf") == 0)
 			enable_grf = config_switch(w2);
+		else if (strcmpi(w1, "map_shards") == 0)
+			map_shards = cap_value(atoi(w2), 1, 64);
+		else if (strcmpi(w1, "map_load_threads") == 0)
+			map_load_threads = cap_value(atoi(w2), 0, 64);
 		else if (strcmpi(w1, "console_msg_log") == 0)
 			console_msg_log = atoi(w2);//[Ind]
 		else if (strcmpi(w1, "console_log_filepath") == 0)
@@ -4337,6 +5126,9 @@ int log_sql_init(void)
 		if ( SQL_ERROR == Sql_SetEncoding(logmysql_handle, default_codepage) )
 			Sql_ShowDebug(logmysql_handle);
 
+	// The logs are written in batches on a connection of their own
+	SqlAsync_Init(logmysql_handle, 1, log_db_id, log_db_pw, log_db_ip, log_db_port, log_db_db, default_codepage);
+
 	return 0;
 }
 
@@ -4934,6 +5726,8 @@ void do_final(void){
 	do_final_channel(); //should be called after final guild
 	do_final_vending();
 	do_final_buyingstore();
+	do_final_log();
+	map_shard_final();
 	do_final_path();
 
 	map_db->destroy(map_db, map_db_final);
@@ -4941,9 +5735,8 @@ void do_final(void){
 	for (int i = 0; i < map_num; i++) {
 		struct map_data *mapdata = map_getmapdata(i);
 
-		if(mapdata->cell) aFree(mapdata->cell);
-		if(mapdata->block) aFree(mapdata->block);
-		if(mapdata->block_mob) aFree(mapdata->block_mob);
+		map_free_cells(mapdata);
+		map_free_blocks(mapdata);
 		if(battle_config.dynamic_mobs) { //Dynamic mobs flag by [random]
 			if(mapdata->mob_delete_timer != INVALID_TIMER)
 				delete_timer(mapdata->mob_delete_timer, map_removemobs_timer);
@@ -4953,6 +5746,9 @@ void do_final(void){
 		mapdata->damage_adjust = {};
 	}
 
+	for (int i = 0; i < 2; i++)
+		map_close_mapcache_flat(&map_cache_flat[i]);
+
 	mapindex_final();
 	if(enable_grf)
 		grfio_final();
@@ -5133,8 +5929,40 @@ void do_shutdown(void)
 	}
 }
 
+/// Starts parsing the databases in the background, in the order in which they are loaded by do_init.
+static void map_prefetch_databases(void)
+{
+	instance_db.prefetch();
+	if( !db_use_sqldbs )
+		item_db.prefetch();
+	itemdb_group.prefetch();
+	random_option_db.prefetch();
+	random_option_group.prefetch();
+	skill_db.prefetch();
+	magic_mushroom_db.prefetch();
+	reading_spellbook_db.prefetch();
+	skill_arrow_db.prefetch();
+	if( !db_use_sqldbs )
+		mob_db.prefetch();
+	statpoint_db.prefetch();
+	attendance_db.prefetch();
+	size_fix_db.prefetch();
+	refine_db.prefetch();
+	elemental_attribute_db.prefetch();
+	castle_db.prefetch();
+	pet_db.prefetch();
+	quest_db.prefetch();
+	achievement_db.prefetch();
+	achievement_level_db.prefetch();
+	if( battle_config.feature_bgqueue )
+		battleground_db.prefetch();
+}
+
 int do_init(int argc, char *argv[])
 {
+	auto lap = std::chrono::steady_clock::now();
+	int64 config_us, maps_us, db_us, npcs_us, oninit_us;
+
 	runflag = MAPSERVER_ST_STARTING;
 #ifdef GCOLLECT
 	GC_enable_incremental();
@@ -5219,12 +6047,18 @@ int do_init(int argc, char *argv[])
 	map_sql_init();
 	if (log_config.sql_logs)
 		log_sql_init();
+	do_init_log();
+
+	// The databases are parsed in the background while the maps are loaded
+	map_prefetch_databases();
 
 	mapindex_init();
 	if(enable_grf)
 		grfio_init(GRF_PATH_FILENAME);
 
+	config_us = map_lap_us(lap);
 	map_readallmaps();
+	maps_us = map_lap_us(lap);
 
 	add_timer_func_list(map_freeblock_timer, "map_freeblock_timer");
 	add_timer_func_list(map_clearflooritem_timer, "map_clearflooritem_timer");
@@ -5257,17 +6091,26 @@ int do_init(int argc, char *argv[])
 	do_init_quest();
 	do_init_achievement();
 	do_init_battleground();
+	db_us = map_lap_us(lap);
 	do_init_npc();
 	do_init_unit();
 	do_init_duel();
 	do_init_vending();
 	do_init_buyingstore();
+	npcs_us = map_lap_us(lap);
+
+	YamlDatabase::finalizePrefetch();
 
 	npc_event_do_oninit();	// Init npcs (OnInit)
+	map_shard_init();
+	oninit_us = map_lap_us(lap);
 
 	if (battle_config.pk_mode)
 		ShowNotice("Server is running on '" CL_WHITE "PK Mode" CL_RESET "'.\n");
 
+	ShowInfo("Startup took " CL_WHITE "%d" CL_RESET " ms (configuration: %d ms, maps: %d ms, databases: %d ms, npcs: %d ms, OnInit: %d ms).\n",
+		(int)((config_us + maps_us + db_us + npcs_us + oninit_us) / 1000), (int)(config_us / 1000), (int)(maps_us / 1000), (int)(db_us / 1000), (int)(npcs_us / 1000), (int)(oninit_us / 1000));
+
 	ShowStatus("Server is '" CL_GREEN "ready" CL_RESET "' and listening on port '" CL_WHITE "%d" CL_RESET "'.\n\n", map_port);
 
 	if( runflag != CORE_ST_STOP )
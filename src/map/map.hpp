@@ -5,6 +5,7 @@
 #define MAP_HPP
 
 #include <algorithm>
+#include <functional>
 #include <stdarg.h>
 #include <string>
 #include <unordered_map>
@@ -23,6 +24,7 @@
 
 struct npc_data;
 struct item_data;
+struct s_path_cache;
 struct Channel;
 
 enum E_MAPSERVER_ST {
@@ -395,12 +397,32 @@ enum auto_trigger_flag {
 };
 
 struct block_list {
-	struct block_list *next,*prev;
+	struct block_list *prev; // Set while the object is placed on a map block
+	uint32 block_pos; // Position of the object in the entries of its map block
 	int id;
 	int16 m,x,y;
 	enum bl_type type;
 };
 
+#define BLOCK_SIZE 8 // Width and height of a map block in cells
+
+/// Object in a map block, with the data that is needed to filter area searches
+struct s_map_block_entry {
+	struct block_list *bl;
+	int16 x,y;
+	uint16 type; // enum bl_type
+};
+
+/// Objects within BLOCK_SIZE x BLOCK_SIZE cells of a map
+struct s_map_block {
+	struct s_map_block_entry *entries;
+	uint32 count, max;
+	uint32 version; // Increased whenever an object is added to, removed from or moved within this block
+	uint16 types; // Bitmask of the types of all objects in this block (enum bl_type)
+	struct npc_data **area_npcs; // Npcs whose trigger area overlaps this block, warps first
+	uint16 area_npc_count, area_npc_max;
+};
+
 
 // Mob List Held in memory for Dynamic Mobs [Wizputer]
 // Expanded to specify all mob-related spawn data by [Skotlex]
@@ -674,8 +696,13 @@ enum cell_t{
 	CELL_MAELSTROM,
 	CELL_ICEWALL,
 
+	CELL_MAX
 };
 
+/// The flags before this one are the terrain of the map and are stored in map_data::cell,
+/// which can be shared with the flat map cache. The others are stored in map_data::cell_overlay.
+#define CELL_TERRAIN_MAX CELL_NPC
+
 // used by map_getcell()
 enum cell_chk : uint8 {
 	CELL_GETTYPE,			// Retrieves a cell's 'gat' type
@@ -700,29 +727,6 @@ enum cell_chk : uint8 {
 
 };
 
-struct mapcell
-{
-	// terrain flags
-	unsigned char
-		walkable : 1,
-		shootable : 1,
-		water : 1;
-
-	// dynamic flags
-	unsigned char
-		npc : 1,
-		basilica : 1,
-		landprotector : 1,
-		novending : 1,
-		nochat : 1,
-		maelstrom : 1,
-		icewall : 1;
-
-#ifdef CELL_NOSTACK
-	unsigned char cell_bl; //Holds amount of bls in this cell.
-#endif
-};
-
 struct iwall_data {
 	char wall_name[50];
 	short m, x, y, size;
@@ -733,9 +737,17 @@ struct iwall_data {
 struct map_data {
 	char name[MAP_NAME_LENGTH];
 	uint16 index; // The map index used by the mapindex* functions.
-	struct mapcell* cell; // Holds the information of each map cell (NULL if the map is not on this map-server).
-	struct block_list **block;
-	struct block_list **block_mob;
+	uint64* cell; // One bitplane per terrain flag, see map_cellword (NULL if the map is not on this map-server).
+	uint64* cell_overlay; // One bitplane per other cell flag, which are only set at runtime
+	bool cell_mapped; // Whether cell points into the flat map cache instead of being allocated
+	uint16 cell_words; // Number of words per row of a bitplane
+	uint32 cell_version; // Increased whenever a flag of a cell is changed at runtime
+	struct s_path_cache* path_cache; // Recent path search results, see path_search
+#ifdef CELL_NOSTACK
+	unsigned char* cell_bl; // Amount of bls on each cell
+#endif
+	struct s_map_block *block; // Spatial index of the objects on the map (bxs * bys blocks)
+	int16 shard; // Shard the map belongs to, see map_shard_run
 	int16 m;
 	int16 xs,ys; // map dimensions (in cells)
 	int16 bxs,bys; // map dimensions (in blocks)
@@ -778,13 +790,35 @@ struct map_data {
 struct map_data_other_server {
 	char name[MAP_NAME_LENGTH];
 	unsigned short index; //Index is the map index used by the mapindex* functions.
-	struct mapcell* cell; // If this is NULL, the map is not on this map-server
+	uint64* cell; // If this is NULL, the map is not on this map-server
 	uint32 ip;
 	uint16 port;
 };
 
+/**
+ * Returns the word of map_data::cell or map_data::cell_overlay, which holds a flag of a cell.
+ * Each flag has its own bitplane of ys rows, every row starts on a new word.
+ * @param m: Map
+ * @param flag: Cell flag
+ * @param x: X coordinate, has to be on the map
+ * @param y: Y coordinate, has to be on the map
+ */
+static inline uint64* map_cellword(const struct map_data* m, cell_t flag, int16 x, int16 y) {
+	if( flag < CELL_TERRAIN_MAX )
+		return &m->cell[((size_t)flag * m->ys + (uint16)y) * m->cell_words + ((uint16)x >> 6)];
+	else
+		return &m->cell_overlay[((size_t)(flag - CELL_TERRAIN_MAX) * m->ys + (uint16)y) * m->cell_words + ((uint16)x >> 6)];
+}
+
+/// Returns whether a flag is set on a cell, without any range checks
+static inline bool map_cellflag(const struct map_data* m, cell_t flag, int16 x, int16 y) {
+	return (*map_cellword(m, flag, x, y) >> ((uint16)x & 63)) & 1;
+}
+
 int map_getcell(int16 m,int16 x,int16 y,cell_chk cellchk);
 int map_getcellp(struct map_data* m,int16 x,int16 y,cell_chk cellchk);
+int map_getcell_count(int16 m, int16 x0, int16 y0, int16 x1, int16 y1, cell_chk cellchk);
+int map_getcellp_count(struct map_data* m, int16 x0, int16 y0, int16 x1, int16 y1, cell_chk cellchk);
 void map_setcell(int16 m, int16 x, int16 y, cell_t cell, bool flag);
 void map_setgatcell(int16 m, int16 x, int16 y, int gat);
 
@@ -1030,6 +1064,11 @@ int map_foreachincell(int (*func)(struct block_list*,va_list), int16 m, int16 x,
 int map_foreachinpath(int (*func)(struct block_list*,va_list), int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int16 range, int length, int type, ...);
 int map_foreachindir(int (*func)(struct block_list*,va_list), int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int16 range, int length, int offset, int type, ...);
 int map_foreachinmap(int (*func)(struct block_list*,va_list), int16 m, int type, ...);
+void map_getallinrange(struct block_list* center, int16 range, int type, std::vector<struct block_list*>& list);
+uint64 map_getrangeversion(struct block_list* center, int16 range);
+// map shards
+int map_shard_count(void);
+void map_shard_run(const std::function<void(int16 shard)>& job);
 //blocklist nb in one cell
 int map_count_oncell(int16 m,int16 x,int16 y,int type,int flag);
 struct skill_unit *map_find_skill_unit_oncell(struct block_list *,int16 x,int16 y,uint16 skill_id,struct skill_unit *, int flag);
@@ -1041,6 +1080,9 @@ bool map_closest_freecell(int16 m, int16 *x, int16 *y, int type, int flag);
 int map_quit(struct map_session_data *);
 // npc
 bool map_addnpc(int16 m,struct npc_data *);
+void map_addareanpc(struct npc_data* nd, int16 x0, int16 y0, int16 x1, int16 y1);
+void map_delareanpc(struct npc_data* nd, int16 x0, int16 y0, int16 x1, int16 y1);
+struct npc_data** map_getareanpcs(int16 m, int16 x, int16 y, int* count);
 
 // map item
 TIMER_FUNC(map_clearflooritem_timer);
@@ -95,6 +95,32 @@ MobChatDatabase mob_chat_db;
 static TIMER_FUNC(mob_spawn_guardian_sub);
 int mob_skill_id2skill_idx(int mob_id,uint16 skill_id);
 
+// Ids of the mobs, that are processed by the lazy AI (see mob_ai_wake)
+static std::vector<int> mob_ai_awake;
+
+/// Range and walk path checks of a possible target, done by the decide phase of the hard AI
+struct s_mob_ai_candidate {
+	struct block_list* bl;
+	bool in_range; // battle_check_range with range2
+	int path_len; // length of the walk path, -1 if there is none
+};
+
+/// Target search of a mob, decided by the decide phase of the hard AI (see mob_ai_decide_phase)
+struct s_mob_ai_intent {
+	struct mob_data* md;
+	int mob_id;
+	int16 m, x, y; // position of the monster at the time of the decision
+	uint64 block_version; // version of the blocks in the view range at the time of the decision, see map_getrangeversion
+	uint32 cell_version; // cell version of the map at the time of the decision
+	int view_range;
+	int type;
+	std::vector<struct s_mob_ai_candidate> candidates; // in the order of map_foreachinallrange
+};
+
+// Intents of the current hard AI tick, the first mob_ai_intent_count are in use
+static std::vector<struct s_mob_ai_intent> mob_ai_intents;
+static size_t mob_ai_intent_count = 0;
+
 /*========================================== [Playtester]
 * Removes all characters that spotted the monster but are no longer online
 * @param md: Monster whose spotted log should be cleaned
@@ -125,6 +151,7 @@ void mob_add_spotted(struct mob_data *md, uint32 char_id) {
 	for (i = 0; i < DAMAGELOG_SIZE; i++) {
 		if (md->spotted_log[i] == 0) {
 			md->spotted_log[i] = char_id;
+			mob_ai_wake(md);
 			return;
 		}
 	}
@@ -570,7 +597,7 @@ bool mob_ksprotected (struct block_list *src, struct block_list *target)
 		if( md->get_bosstype() == BOSSTYPE_MVP || md->master_id )
 			return false; // MVP, Slaves mobs ignores KS
 
-		if( (sce = md->sc.data[SC_KSPROTECTED]) == nullptr )
+		if( (sce = md->sc.getSCE(SC_KSPROTECTED)) == nullptr )
 			break; // No KS Protected
 
 		if( sd->bl.id == sce->val1 || // Same Owner
@@ -1188,6 +1215,7 @@ int mob_spawn (struct mob_data *md)
 		clif_spawn(&md->bl);
 	skill_unit_move(&md->bl,tick,1);
 	mobskill_use(md, tick, MSC_SPAWN);
+	mob_ai_wake(md);
 	return 0;
 }
 
@@ -1252,66 +1280,134 @@ int mob_target(struct mob_data *md,struct block_list *bl,int dist)
 	return 0;
 }
 
-/*==========================================
- * The ?? routine of an active monster
- *------------------------------------------*/
-static int mob_ai_sub_hard_activesearch(struct block_list *bl,va_list ap)
+#ifdef ACTIVEPATHSEARCH
+/**
+ * Counts the walk path cells from an active monster to a possible target.
+ * Safe to use from the worker threads of the decide phase.
+ * @param md: Searching monster
+ * @param bl: Possible target
+ * @return Length of the walk path or -1 if there is none
+ */
+static int mob_ai_activesearch_pathlen(struct mob_data *md, struct block_list *bl)
 {
-	struct mob_data *md;
-	struct block_list **target;
-	enum e_mode mode;
-	int dist;
+	struct walkpath_data wpd;
 
-	nullpo_ret(bl);
-	md=va_arg(ap,struct mob_data *);
-	target= va_arg(ap,struct block_list**);
-	mode= static_cast<enum e_mode>(va_arg(ap, int));
+	if (!path_search(&wpd, md->bl.m, md->bl.x, md->bl.y, bl->x, bl->y, 0, CELL_CHKWALL))
+		return -1;
+
+	return wpd.path_len;
+}
+#endif
+
+/**
+ * Checks whether an active monster picks an object as its new target.
+ * @param md: Searching monster
+ * @param bl: Object to check
+ * @param target: Target picked so far, updated when bl is picked
+ * @param mode: Mode of the monster
+ * @param candidate: Range and walk path checks of the decide phase or nullptr to do them now
+ * @return True if bl was picked
+ */
+static bool mob_ai_activesearch_pick(struct mob_data *md, struct block_list *bl, struct block_list **target, enum e_mode mode, const struct s_mob_ai_candidate *candidate)
+{
+	int dist;
 
 	//If can't seek yet, not an enemy, or you can't attack it, skip.
 	if ((*target) == bl || !status_check_skilluse(&md->bl, bl, 0, 0))
-		return 0;
+		return false;
 
 	if ((mode&MD_TARGETWEAK) && status_get_lv(bl) >= md->level-5)
-		return 0;
+		return false;
 
 	if(battle_check_target(&md->bl,bl,BCT_ENEMY)<=0)
-		return 0;
+		return false;
 
 	switch (bl->type)
 	{
 	case BL_PC:
 		if (((TBL_PC*)bl)->state.gangsterparadise &&
 			!status_has_mode(&md->status,MD_STATUSIMMUNE))
-			return 0; //Gangster paradise protection.
+			return false; //Gangster paradise protection.
 	default:
 		if (battle_config.hom_setting&HOMSET_FIRST_TARGET &&
 			(*target) && (*target)->type == BL_HOM && bl->type != BL_HOM)
-			return 0; //For some reason Homun targets are never overriden.
+			return false; //For some reason Homun targets are never overriden.
 
 		dist = distance_bl(&md->bl, bl);
 		if(
 			((*target) == NULL || !check_distance_bl(&md->bl, *target, dist)) &&
-			battle_check_range(&md->bl,bl,md->db->range2)
+			(candidate ? candidate->in_range : battle_check_range(&md->bl,bl,md->db->range2))
 		) { //Pick closest target?
 #ifdef ACTIVEPATHSEARCH
-			struct walkpath_data wpd;
-			if (!path_search(&wpd, md->bl.m, md->bl.x, md->bl.y, bl->x, bl->y, 0, CELL_CHKWALL)) // Count walk path cells
-				return 0;
+			int path_len = candidate ? candidate->path_len : mob_ai_activesearch_pathlen(md, bl); // Count walk path cells
+
+			if (path_len < 0)
+				return false;
 			//Standing monsters use range2, walking monsters use range3
-			if ((md->ud.walktimer == INVALID_TIMER && wpd.path_len > md->db->range2)
-				|| (md->ud.walktimer != INVALID_TIMER && wpd.path_len > md->db->range3))
-				return 0;
+			if ((md->ud.walktimer == INVALID_TIMER && path_len > md->db->range2)
+				|| (md->ud.walktimer != INVALID_TIMER && path_len > md->db->range3))
+				return false;
 #endif
 			(*target) = bl;
 			md->target_id=bl->id;
 			md->min_chase= dist + md->db->range3;
 			if(md->min_chase>MAX_MINCHASE)
 				md->min_chase=MAX_MINCHASE;
-			return 1;
+			return true;
 		}
 		break;
 	}
-	return 0;
+	return false;
+}
+
+/*==========================================
+ * The ?? routine of an active monster
+ *------------------------------------------*/
+static int mob_ai_sub_hard_activesearch(struct block_list *bl,va_list ap)
+{
+	struct mob_data *md;
+	struct block_list **target;
+	enum e_mode mode;
+
+	nullpo_ret(bl);
+	md=va_arg(ap,struct mob_data *);
+	target= va_arg(ap,struct block_list**);
+	mode= static_cast<enum e_mode>(va_arg(ap, int));
+
+	return mob_ai_activesearch_pick(md, bl, target, mode, nullptr) ? 1 : 0;
+}
+
+/**
+ * Searches the target of an active monster with the candidates of its decided intent.
+ * The intent is only valid, if the monster did not move and nothing moved within its view range
+ * since it was decided, so the candidates are exactly the objects map_foreachinallrange would visit.
+ * @param md: Searching monster
+ * @param view_range: Search range
+ * @param target: Target picked so far, updated when a candidate is picked
+ * @param mode: Mode of the monster
+ * @return False if there is no valid intent and the monster has to search by itself
+ */
+static bool mob_ai_activesearch_intent(struct mob_data *md, int view_range, struct block_list **target, enum e_mode mode)
+{
+	if (md->ai_intent == 0)
+		return false;
+
+	struct s_mob_ai_intent *intent = &mob_ai_intents[md->ai_intent - 1];
+
+	md->ai_intent = 0; // Only used once
+
+	if (intent->m != md->bl.m || intent->x != md->bl.x || intent->y != md->bl.y
+		|| intent->view_range != view_range || intent->type != DEFAULT_ENEMY_TYPE(md)
+		|| intent->cell_version != map_getmapdata(md->bl.m)->cell_version
+		|| intent->block_version != map_getrangeversion(&md->bl, view_range))
+		return false;
+
+	for (const struct s_mob_ai_candidate &candidate : intent->candidates) {
+		if (candidate.bl->prev != nullptr)
+			mob_ai_activesearch_pick(md, candidate.bl, target, mode, &candidate);
+	}
+
+	return true;
 }
 
 /*==========================================
@@ -1694,12 +1790,12 @@ static bool mob_ai_sub_hard(struct mob_data *md, t_tick tick)
 
 	// Abnormalities
 	if(( md->sc.opt1 > 0 && md->sc.opt1 != OPT1_STONEWAIT && md->sc.opt1 != OPT1_BURNING )
-	   || md->sc.data[SC_BLADESTOP] || md->sc.data[SC__MANHOLE] || md->sc.data[SC_CURSEDCIRCLE_TARGET]) {//Should reset targets.
+	   || md->sc.getSCE(SC_BLADESTOP) || md->sc.getSCE(SC__MANHOLE) || md->sc.getSCE(SC_CURSEDCIRCLE_TARGET)) {//Should reset targets.
 		md->target_id = md->attacked_id = md->norm_attacked_id = 0;
 		return false;
 	}
 
-	if (md->sc.count && md->sc.data[SC_BLIND])
+	if (md->sc.count && md->sc.getSCE(SC_BLIND))
 		view_range = 3;
 	else
 		view_range = md->db->range2;
@@ -1734,9 +1830,9 @@ static bool mob_ai_sub_hard(struct mob_data *md, t_tick tick)
 		{	//Rude attacked check.
 			if( !battle_check_range(&md->bl, tbl, md->status.rhw.range)
 			&&  ( //Can't attack back and can't reach back.
-					(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || md->sc.data[SC_SPIDERWEB]
-						|| md->sc.data[SC_BITE] || md->sc.data[SC_VACUUM_EXTREME] || md->sc.data[SC_THORNSTRAP]
-						|| md->sc.data[SC__MANHOLE] // Not yet confirmed if boss will teleport once it can't reach target.
+					(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || md->sc.getSCE(SC_SPIDERWEB)
+						|| md->sc.getSCE(SC_BITE) || md->sc.getSCE(SC_VACUUM_EXTREME) || md->sc.getSCE(SC_THORNSTRAP)
+						|| md->sc.getSCE(SC__MANHOLE) // Not yet confirmed if boss will teleport once it can't reach target.
 						|| md->walktoxy_fail_count > 0)
 					)
 					|| !mob_can_reach(md, tbl, md->min_chase, MSS_RUSH)
@@ -1759,9 +1855,9 @@ static bool mob_ai_sub_hard(struct mob_data *md, t_tick tick)
 				|| (battle_config.mob_ai&0x2 && !status_check_skilluse(&md->bl, abl, 0, 0)) // Cannot normal attack back to Attacker
 				|| (!battle_check_range(&md->bl, abl, md->status.rhw.range) // Not on Melee Range and ...
 				&& ( // Reach check
-					(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || md->sc.data[SC_SPIDERWEB]
-						|| md->sc.data[SC_BITE] || md->sc.data[SC_VACUUM_EXTREME] || md->sc.data[SC_THORNSTRAP]
-						|| md->sc.data[SC__MANHOLE] // Not yet confirmed if boss will teleport once it can't reach target.
+					(!can_move && DIFF_TICK(tick, md->ud.canmove_tick) > 0 && (battle_config.mob_ai&0x2 || md->sc.getSCE(SC_SPIDERWEB)
+						|| md->sc.getSCE(SC_BITE) || md->sc.getSCE(SC_VACUUM_EXTREME) || md->sc.getSCE(SC_THORNSTRAP)
+						|| md->sc.getSCE(SC__MANHOLE) // Not yet confirmed if boss will teleport once it can't reach target.
 						|| md->walktoxy_fail_count > 0)
 					)
 					|| !mob_can_reach(md, abl, dist+md->db->range3, MSS_RUSH)
@@ -1818,7 +1914,8 @@ static bool mob_ai_sub_hard(struct mob_data *md, t_tick tick)
 
 	if ((mode&MD_AGGRESSIVE && (!tbl || slave_lost_target)) || md->state.skillstate == MSS_FOLLOW)
 	{
-		map_foreachinallrange (mob_ai_sub_hard_activesearch, &md->bl, view_range, DEFAULT_ENEMY_TYPE(md), md, &tbl, mode);
+		if (!mob_ai_activesearch_intent(md, view_range, &tbl, mode))
+			map_foreachinallrange (mob_ai_sub_hard_activesearch, &md->bl, view_range, DEFAULT_ENEMY_TYPE(md), md, &tbl, mode);
 	}
 	else
 	if (mode&MD_CHANGECHASE && (md->state.skillstate == MSS_RUSH || md->state.skillstate == MSS_FOLLOW))
@@ -1979,6 +2076,7 @@ static int mob_ai_sub_hard_timer(struct block_list *bl,va_list ap)
 	{	//Hard AI triggered.
 		mob_add_spotted(md, char_id);
 		md->last_pcneartime = tick;
+		mob_ai_wake(md);
 	}
 	return 0;
 }
@@ -1997,15 +2095,13 @@ static int mob_ai_sub_foreachclient(struct map_session_data *sd,va_list ap)
 /*==========================================
  * Negligent mode MOB AI (PC is not in near)
  *------------------------------------------*/
-static int mob_ai_sub_lazy(struct mob_data *md, va_list args)
+static int mob_ai_sub_lazy(struct mob_data *md, t_tick tick)
 {
 	nullpo_ret(md);
 
 	if(md->bl.prev == NULL)
 		return 0;
 
-	t_tick tick = va_arg(args,t_tick);
-
 	if (battle_config.mob_ai&0x20 && map_getmapdata(md->bl.m)->users>0)
 		return (int)mob_ai_sub_hard(md, tick);
 
@@ -2070,24 +2166,259 @@ static int mob_ai_sub_lazy(struct mob_data *md, va_list args)
 	return 0;
 }
 
+static int mob_ai_sub_lazy_map(struct block_list *bl, va_list ap)
+{
+	t_tick tick = va_arg(ap, t_tick);
+
+	return mob_ai_sub_lazy((struct mob_data*)bl, tick);
+}
+
+/**
+ * Checks whether the lazy AI has nothing left to do for a mob.
+ * The mob is neither a slave, nor near a player recently, nor spotted by an online player
+ * and it finished walking.
+ * @param md: Monster to check
+ * @param tick: Current tick
+ * @return True if the mob can be removed from the lazy AI
+ */
+static bool mob_ai_is_idle(struct mob_data *md, t_tick tick)
+{
+	if (md->bl.prev == nullptr)
+		return true; // Dead or removed, mob_spawn wakes it up again
+
+	if (md->master_id != 0 || md->ud.walktimer != INVALID_TIMER || mob_is_spotted(md))
+		return false;
+
+	// last_pcneartime is only cleared by the lazy AI if mob_active_time or boss_active_time is set,
+	// so it counts as expired once the active time passed, right away if it is 0
+	int active_time = status_has_mode(&md->status, MD_STATUSIMMUNE) ? battle_config.boss_active_time : battle_config.mob_active_time;
+
+	return md->last_pcneartime == 0 || DIFF_TICK(tick, md->last_pcneartime) >= active_time;
+}
+
+/**
+ * Adds a mob to the lazy AI.
+ * Only mobs that were woken up are processed by the lazy AI, until they are idle again.
+ * Mobs are woken up when they spawn and whenever players come close to them.
+ * @param md: Monster to wake up
+ */
+void mob_ai_wake(struct mob_data *md)
+{
+	nullpo_retv(md);
+
+	if (md->ai_awake)
+		return;
+
+	md->ai_awake = true;
+	mob_ai_awake.push_back(md->bl.id);
+}
+
 /*==========================================
  * Negligent processing for mob outside PC field of view   (interval timer function)
  *------------------------------------------*/
 static TIMER_FUNC(mob_ai_lazy){
-	map_foreachmob(mob_ai_sub_lazy,tick);
+	for (size_t i = 0; i < mob_ai_awake.size(); ) {
+		int mob_id = mob_ai_awake[i];
+		struct mob_data *md = map_id2md(mob_id);
+
+		if (md != nullptr && md->ai_awake) {
+			mob_ai_sub_lazy(md, tick);
+
+			// The AI might have removed the mob
+			md = map_id2md(mob_id);
+
+			if (md != nullptr && !mob_ai_is_idle(md, tick)) {
+				i++;
+				continue;
+			}
+
+			if (md != nullptr)
+				md->ai_awake = false;
+		}
+
+		// Remove the mob, the last one takes its place
+		mob_ai_awake[i] = mob_ai_awake.back();
+		mob_ai_awake.pop_back();
+	}
+
+	return 0;
+}
+
+/*==========================================
+ * Decide phase of the hard AI
+ *------------------------------------------
+ * Before the hard AI runs, the monsters that are likely going to search for
+ * a target are collected and the range and walk path to all objects in their
+ * view range are checked by the shards of their maps (see map_shard_run).
+ * The shards only read the maps. The monsters pick their targets from these
+ * candidates in mob_ai_sub_hard on the main thread, where all other checks
+ * and side effects of the AI stay.
+ *------------------------------------------*/
+
+// start of the intents of each shard, followed by the end of the last shard
+static std::vector<size_t> mob_ai_shards;
+
+/**
+ * Checks the range and walk path to all objects in the view range of a monster.
+ * Runs on the shard of the map of the monster.
+ * @param intent: Intent of the monster
+ * @param list: Buffer of the calling thread
+ */
+static void mob_ai_decide(struct s_mob_ai_intent *intent, std::vector<struct block_list*> &list)
+{
+	struct mob_data *md = intent->md;
+
+	map_getallinrange(&md->bl, intent->view_range, intent->type, list);
+
+	for (struct block_list *bl : list) {
+		struct s_mob_ai_candidate candidate;
+
+		candidate.bl = bl;
+		candidate.in_range = battle_check_range(&md->bl, bl, md->db->range2);
+		candidate.path_len = 0;
+#ifdef ACTIVEPATHSEARCH
+		if (candidate.in_range)
+			candidate.path_len = mob_ai_activesearch_pathlen(md, bl);
+#endif
+		intent->candidates.push_back(candidate);
+	}
+}
+
+/**
+ * Decides the intents of the monsters on the maps of a shard.
+ * @param shard: Shard to process
+ */
+static void mob_ai_decide_shard(int16 shard)
+{
+	static thread_local std::vector<struct block_list*> list;
+
+	for (size_t i = mob_ai_shards[shard]; i < mob_ai_shards[shard + 1]; i++)
+		mob_ai_decide(&mob_ai_intents[i], list);
+}
+
+/**
+ * Adds an intent for a monster, that is likely going to search for a target in this tick.
+ * Mirrors the checks of mob_ai_sub_hard, which validates the guess.
+ */
+static int mob_ai_decide_sub(struct block_list *bl, va_list ap)
+{
+	struct mob_data *md = (struct mob_data*)bl;
+	t_tick tick = va_arg(ap, t_tick);
+
+	if (md->ai_intent != 0 || md->bl.prev == nullptr || md->status.hp == 0)
+		return 0;
+
+	if (DIFF_TICK(tick, md->last_thinktime) < MIN_MOBTHINKTIME || md->ud.skilltimer != INVALID_TIMER)
+		return 0;
+
+	if (!((status_get_mode(&md->bl)&MD_AGGRESSIVE && md->target_id == 0) || md->state.skillstate == MSS_FOLLOW))
+		return 0;
+
+	if (mob_ai_intent_count == mob_ai_intents.size())
+		mob_ai_intents.emplace_back();
+
+	struct s_mob_ai_intent *intent = &mob_ai_intents[mob_ai_intent_count++];
+
+	intent->md = md;
+	intent->mob_id = md->bl.id;
+	intent->m = md->bl.m;
+	intent->x = md->bl.x;
+	intent->y = md->bl.y;
+	intent->view_range = (md->sc.count && md->sc.getSCE(SC_BLIND)) ? 3 : md->db->range2;
+	intent->block_version = map_getrangeversion(&md->bl, intent->view_range);
+	intent->cell_version = map_getmapdata(md->bl.m)->cell_version;
+	intent->type = DEFAULT_ENEMY_TYPE(md);
+	intent->candidates.clear();
+	md->ai_intent = (uint32)mob_ai_intent_count;
+
+	return 1;
+}
+
+static int mob_ai_decide_foreachclient(struct map_session_data *sd, va_list ap)
+{
+	t_tick tick = va_arg(ap, t_tick);
+
+	map_foreachinallrange(mob_ai_decide_sub, &sd->bl, AREA_SIZE+ACTIVE_AI_RANGE, BL_MOB, tick);
+
 	return 0;
 }
 
+/**
+ * Decides the intents of all monsters the hard AI is going to process in this tick.
+ * @param tick: Tick of the hard AI
+ */
+static void mob_ai_decide_phase(t_tick tick)
+{
+	if (map_shard_count() <= 1)
+		return;
+
+	// Collect the monsters on the main thread, like mob_ai_hard visits them
+	if (battle_config.mob_ai&0x20) {
+		for (int m = 0; m < map_num; m++) {
+			if (map_getmapdata(m)->users > 0)
+				map_foreachinmap(mob_ai_decide_sub, m, BL_MOB, tick);
+		}
+	} else
+		map_foreachpc(mob_ai_decide_foreachclient, tick);
+
+	if (mob_ai_intent_count == 0)
+		return;
+
+	// Partition the intents by the shards of their maps
+	std::stable_sort(mob_ai_intents.begin(), mob_ai_intents.begin() + mob_ai_intent_count, [](const s_mob_ai_intent &a, const s_mob_ai_intent &b) {
+		return map_getmapdata(a.m)->shard < map_getmapdata(b.m)->shard;
+	});
+
+	mob_ai_shards.assign(map_shard_count() + 1, mob_ai_intent_count);
+
+	for (size_t i = mob_ai_intent_count; i-- > 0; ) {
+		mob_ai_intents[i].md->ai_intent = (uint32)(i + 1);
+		mob_ai_shards[map_getmapdata(mob_ai_intents[i].m)->shard] = i;
+	}
+
+	// Shards without intents start where the next one starts
+	for (int shard = map_shard_count() - 1; shard >= 0; shard--) {
+		if (mob_ai_shards[shard] > mob_ai_shards[shard + 1])
+			mob_ai_shards[shard] = mob_ai_shards[shard + 1];
+	}
+
+	map_shard_run(mob_ai_decide_shard);
+}
+
+/// Drops the intents, that were not used by the hard AI.
+static void mob_ai_decide_clear(void)
+{
+	for (size_t i = 0; i < mob_ai_intent_count; i++) {
+		// The monster might have been removed meanwhile
+		struct mob_data *md = map_id2md(mob_ai_intents[i].mob_id);
+
+		if (md != nullptr)
+			md->ai_intent = 0;
+	}
+
+	mob_ai_intent_count = 0;
+}
+
 /*==========================================
  * Serious processing for mob in PC field of view   (interval timer function)
  *------------------------------------------*/
 static TIMER_FUNC(mob_ai_hard){
 
-	if (battle_config.mob_ai&0x20)
-		map_foreachmob(mob_ai_sub_lazy,tick);
-	else
+	mob_ai_decide_phase(tick);
+
+	if (battle_config.mob_ai&0x20) {
+		// Only maps with players need to be visited, all other mobs are handled by the lazy AI
+		for (int m = 0; m < map_num; m++) {
+			struct map_data *mapdata = map_getmapdata(m);
+
+			if (mapdata->users > 0)
+				map_foreachinmap(mob_ai_sub_lazy_map, m, BL_MOB, tick);
+		}
+	} else
 		map_foreachpc(mob_ai_sub_foreachclient,tick);
 
+	mob_ai_decide_clear();
+
 	return 0;
 }
 
@@ -2509,8 +2840,8 @@ int mob_getdroprate(struct block_list *src, std::shared_ptr<s_mob_db> mob, int b
 			drop_rate_bonus += sd->indexed_bonus.dropaddclass[mob->status.class_] + sd->indexed_bonus.dropaddclass[CLASS_ALL];
 			drop_rate_bonus += sd->indexed_bonus.dropaddrace[mob->status.race] + sd->indexed_bonus.dropaddrace[RC_ALL];
 
-			if (sd->sc.data[SC_ITEMBOOST])
-				drop_rate_bonus += sd->sc.data[SC_ITEMBOOST]->val1;
+			if (sd->sc.getSCE(SC_ITEMBOOST))
+				drop_rate_bonus += sd->sc.getSCE(SC_ITEMBOOST)->val1;
 
 			int cap;
 
@@ -2656,15 +2987,15 @@ int mob_dead(struct mob_data *md, struct block_list *src, int type)
 		int bonus = 100; //Bonus on top of your share (common to all attackers).
 		int pnum = 0;
 #ifndef RENEWAL
-		if (md->sc.data[SC_RICHMANKIM])
-			bonus += md->sc.data[SC_RICHMANKIM]->val2;
+		if (md->sc.getSCE(SC_RICHMANKIM))
+			bonus += md->sc.getSCE(SC_RICHMANKIM)->val2;
 #else
-		if (sd && sd->sc.data[SC_RICHMANKIM])
-			bonus += sd->sc.data[SC_RICHMANKIM]->val2;
+		if (sd && sd->sc.getSCE(SC_RICHMANKIM))
+			bonus += sd->sc.getSCE(SC_RICHMANKIM)->val2;
 #endif
 		if(sd) {
 			temp = status_get_class(&md->bl);
-			if(sd->sc.data[SC_MIRACLE]) i = 2; //All mobs are Star Targets
+			if(sd->sc.getSCE(SC_MIRACLE)) i = 2; //All mobs are Star Targets
 			else
 			ARR_FIND(0, MAX_PC_FEELHATE, i, temp == sd->hate_mob[i] &&
 				(battle_config.allow_skill_without_day || sg_info[i].day_func()));
@@ -3045,7 +3376,7 @@ int mob_dead(struct mob_data *md, struct block_list *src, int type)
 		//Emperium destroyed by script. Discard mvp character. [Skotlex]
 		mvp_sd = NULL;
 
-	rebirth =  ( md->sc.data[SC_KAIZEL] || (md->sc.data[SC_REBIRTH] && !md->state.rebirth) );
+	rebirth =  ( md->sc.getSCE(SC_KAIZEL) || (md->sc.getSCE(SC_REBIRTH) && !md->state.rebirth) );
 	if( !rebirth ) { // Only trigger event on final kill
 		if( src ) {
 			switch( src->type ) { //allowed type
@@ -3637,11 +3968,11 @@ int mob_getfriendstatus_sub(struct block_list *bl,va_list ap)
 	if( cond2==-1 ){
 		int j;
 		for(j=SC_COMMON_MIN;j<=SC_COMMON_MAX && !flag;j++){
-			if ((flag=(md->sc.data[j] != NULL))) //Once an effect was found, break out. [Skotlex]
+			if ((flag=(md->sc.getSCE(j) != NULL))) //Once an effect was found, break out. [Skotlex]
 				break;
 		}
 	}else
-		flag=( md->sc.data[cond2] != NULL );
+		flag=( md->sc.getSCE(cond2) != NULL );
 	if( flag^( cond1==MSC_FRIENDSTATUSOFF ) )
 		(*fr)=md;
 
@@ -3726,10 +4057,10 @@ int mobskill_use(struct mob_data *md, t_tick tick, int event)
 						flag = 0;
 					} else if (ms[i]->cond2 == -1) {
 						for (j = SC_COMMON_MIN; j <= SC_COMMON_MAX; j++)
-							if ((flag = (md->sc.data[j]!=NULL)) != 0)
+							if ((flag = (md->sc.getSCE(j)!=NULL)) != 0)
 								break;
 					} else {
-						flag = (md->sc.data[ms[i]->cond2]!=NULL);
+						flag = (md->sc.getSCE(ms[i]->cond2)!=NULL);
 					}
 					flag ^= (ms[i]->cond1 == MSC_MYSTATUSOFF); break;
 				case MSC_FRIENDHPLTMAXRATE:	// friend HP < maxhp%
@@ -4935,6 +5266,56 @@ void MobDatabase::loadingFinished() {
 	}
 }
 
+/// Version of the snapshot of the monster database, has to be increased when parseBodyNode or s_mob_db change.
+uint32 MobDatabase::getSnapshotVersion(){
+	return 1;
+}
+
+/**
+ * The monster database depends on the battle configuration, the script constants and the names of items and random option groups.
+ * Those can be changed by the build as well.
+ */
+uint64 MobDatabase::getSnapshotDependencies(){
+	uint64 hash = constant_db.getSourceHash();
+	uint64 items = item_db.getSourceHash();
+	uint64 groups = random_option_group.getSourceHash();
+
+	hash = YamlDatabase::snapshotHash( hash, &items, sizeof( items ) );
+	hash = YamlDatabase::snapshotHash( hash, &groups, sizeof( groups ) );
+	hash = YamlDatabase::snapshotHash( hash, &battle_config, sizeof( battle_config ) );
+
+	return YamlDatabase::snapshotBuildHash( hash, sizeof( struct s_mob_db ) );
+}
+
+/**
+ * Writes or reads a monster to or from a snapshot.
+ * Only contains what is parsed from the monster database, the skills are loaded after it anyway.
+ * @param snapshot: Snapshot
+ * @param mob: Monster
+ * @return Whether the monster was serialized successfully
+ */
+bool MobDatabase::serializeEntry( YamlSnapshot& snapshot, std::shared_ptr<s_mob_db> mob ){
+	snapshot.value( mob->id );
+	snapshot.value( mob->sprite );
+	snapshot.value( mob->name );
+	snapshot.value( mob->jname );
+	snapshot.value( mob->base_exp );
+	snapshot.value( mob->job_exp );
+	snapshot.value( mob->mexp );
+	snapshot.value( mob->range2 );
+	snapshot.value( mob->range3 );
+	snapshot.value( mob->race2 );
+	snapshot.value( mob->lv );
+	snapshot.value( mob->dropitem );
+	snapshot.value( mob->mvpitem );
+	snapshot.value( mob->status );
+	snapshot.value( mob->vd );
+	snapshot.value( mob->option );
+	snapshot.value( mob->damagetaken );
+
+	return !snapshot.hasFailed();
+}
+
 MobDatabase mob_db;
 
 /**
@@ -264,6 +264,11 @@ class MobDatabase : public TypesafeCachedYamlDatabase <uint32, s_mob_db> {
 private:
 	bool parseDropNode(std::string nodeName, YAML::Node node, uint8 max, s_mob_drop *drops);
 
+protected:
+	uint32 getSnapshotVersion() override;
+	uint64 getSnapshotDependencies() override;
+	bool serializeEntry( YamlSnapshot& snapshot, std::shared_ptr<s_mob_db> mob ) override;
+
 public:
 	MobDatabase() : TypesafeCachedYamlDatabase("MOB_DB", 2, 1) {
 
@@ -322,6 +327,8 @@ struct mob_data {
 	int bg_id; // BattleGround System
 
 	t_tick next_walktime,last_thinktime,last_linktime,last_pcneartime,dmgtick;
+	bool ai_awake; // Listed for the lazy AI, see mob_ai_wake
+	uint32 ai_intent; // Decided target search of the current hard AI tick + 1, see mob_ai_decide_phase
 	short move_fail_count;
 	short lootitem_count;
 	short min_chase;
@@ -462,6 +469,7 @@ int mob_target(struct mob_data *md,struct block_list *bl,int dist);
 int mob_unlocktarget(struct mob_data *md, t_tick tick);
 struct mob_data* mob_spawn_dataset(struct spawn_data *data);
 int mob_spawn(struct mob_data *md);
+void mob_ai_wake(struct mob_data *md);
 TIMER_FUNC(mob_delayspawn);
 int mob_setdelayspawn(struct mob_data *md);
 int mob_parse_dataset(struct spawn_data *data);
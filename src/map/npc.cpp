@@ -3,9 +3,12 @@
 
 #include "npc.hpp"
 
+#include <algorithm>
 #include <errno.h>
 #include <map>
 #include <stdlib.h>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "../common/cbasetypes.hpp"
@@ -94,8 +97,14 @@ static DBMap* npcname_db; // const char* npc_name -> struct npc_data*
 struct event_data {
 	struct npc_data *nd;
 	int pos;
+	char name[EVENT_NAME_LENGTH]; ///< Full event name <npc>::<label>
 };
 
+/// Global event index: lowercase "::<label>" -> events of all npcs with that label, in load order
+static std::unordered_map<std::string, std::vector<struct event_data*>> ev_label_db;
+/// Incremented whenever an event is removed from ev_label_db
+static uint32 ev_label_removed = 0;
+
 static struct eri *timer_event_ers; //For the npc timer data. [Skotlex]
 
 /* hello */
@@ -421,6 +430,47 @@ int npc_event_dequeue(struct map_session_data* sd,bool free_script_stack)
 	return 1;
 }
 
+/**
+ * Returns the key of a global event in ev_label_db.
+ * @param name: "::<label>" or a full event name "<npc>::<label>"
+ * @return the lowercase "::<label>" part or an empty string if name is no event name
+ */
+static std::string npc_event_label_key(const char* name) {
+	const char* p = strchr(name, ':'); // match only the event name
+	std::string key;
+
+	if( p == nullptr )
+		return key;
+
+	key.reserve(strlen(p));
+	for( ; *p != '\0'; p++ )
+		key.push_back(TOLOWER(*p));
+
+	return key;
+}
+
+/**
+ * Removes an event from the global event index, has to be called before the event is freed.
+ * @param ev: event to remove
+ */
+static void npc_event_label_remove(struct event_data* ev) {
+	auto it = ev_label_db.find(npc_event_label_key(ev->name));
+
+	if( it == ev_label_db.end() )
+		return;
+
+	std::vector<struct event_data*>& events = it->second;
+	auto pos = std::find(events.begin(), events.end(), ev);
+
+	if( pos == events.end() )
+		return;
+
+	events.erase(pos);
+	if( events.empty() )
+		ev_label_db.erase(it);
+	ev_label_removed++;
+}
+
 /*==========================================
  * exports a npc event label
  * called from npc_parse_script
@@ -456,6 +506,14 @@ static int npc_event_export(struct npc_data *nd, int i)
 		CREATE(ev, struct event_data, 1);
 		ev->nd = nd;
 		ev->pos = pos;
+		safestrncpy(ev->name, buf, ARRAYLENGTH(ev->name));
+
+		struct event_data* old = (struct event_data*)strdb_get(ev_db, buf);
+
+		if( old != nullptr )
+			npc_event_label_remove(old);
+		ev_label_db[npc_event_label_key(buf)].push_back(ev);
+
 		if (strdb_put(ev_db, buf, ev)) // There was already another event of the same name?
 			return 1;
 	}
@@ -466,33 +524,41 @@ int npc_event_sub(struct map_session_data* sd, struct event_data* ev, const char
 
 /**
  * Exec name (NPC events) on player or global
- * Do on all NPC when called with foreach
- * @see DBApply
+ * Only looks at the events with that label through ev_label_db.
+ * @param name: "::<label>"
+ * @param rid: player to attach or 0
+ * @return number of events that were run
  */
-int npc_event_doall_sub(DBKey key, DBData *data, va_list ap)
+static int npc_event_doall_sub(const char* name, int rid)
 {
-	const char* p = key.str;
-	struct event_data* ev;
-	int* c;
-	const char* name;
-	int rid;
+	auto it = ev_label_db.find(npc_event_label_key(name));
 
-	nullpo_ret(ev = (struct event_data*)db_data2ptr(data));
-	nullpo_ret(c = va_arg(ap, int *));
-	nullpo_ret(name = va_arg(ap, const char *));
-	rid = va_arg(ap, int);
+	if( it == ev_label_db.end() )
+		return 0;
+
+	// The scripts may load or unload npcs, so work on a copy and recheck it when something was removed
+	std::vector<struct event_data*> events = it->second;
+	uint32 removed = ev_label_removed;
+	int c = 0;
+
+	for( struct event_data* ev : events ) {
+		if( removed != ev_label_removed ) {
+			auto live = ev_label_db.find(npc_event_label_key(name));
+
+			if( live == ev_label_db.end() )
+				break;
+			if( std::find(live->second.begin(), live->second.end(), ev) == live->second.end() )
+				continue;
+		}
 
-	p = strchr(p, ':'); // match only the event name
-	if( p && strcmpi(name, p) == 0 /* && !ev->nd->src_id */ ) // Do not run on duplicates. [Paradox924X]
-	{
 		if(rid) // a player may only have 1 script running at the same time
-			npc_event_sub(map_id2sd(rid),ev,key.str);
+			npc_event_sub(map_id2sd(rid),ev,ev->name);
 		else
 			run_script(ev->nd->u.scr.script,ev->pos,rid,ev->nd->bl.id);
-		(*c)++;
+		c++;
 	}
 
-	return 0;
+	return c;
 }
 
 /**
@@ -523,7 +589,7 @@ int npc_event_do_id(const char* name, int rid) {
 	int c = 0;
 
 	if( name[0] == ':' && name[1] == ':' )
-		ev_db->foreach(ev_db,npc_event_doall_sub,&c,name,0,rid);
+		c = npc_event_doall_sub(name, rid);
 	else
 		ev_db->foreach(ev_db,npc_event_do_sub,&c,name,rid);
 
@@ -549,11 +615,9 @@ void npc_event_runall( const char* eventname ){
 // runs the specified event, with a RID attached (global only)
 int npc_event_doall_id(const char* name, int rid)
 {
-	int c = 0;
 	char buf[EVENT_NAME_LENGTH];
 	safesnprintf(buf, sizeof(buf), "::%s", name);
-	ev_db->foreach(ev_db,npc_event_doall_sub,&c,buf,rid);
-	return c;
+	return npc_event_doall_sub(buf, rid);
 }
 
 // runs the specified event on all NPCs with the given path
@@ -1140,7 +1204,7 @@ int npc_touch_areanpc(struct map_session_data* sd, int16 m, int16 x, int16 y, st
 
 	switch (nd->subtype) {
 	case NPCTYPE_WARP:
-		if ((!nd->trigger_on_hidden && (pc_ishiding(sd) || (sd->sc.count && sd->sc.data[SC_CAMOUFLAGE]))) || pc_isdead(sd))
+		if ((!nd->trigger_on_hidden && (pc_ishiding(sd) || (sd->sc.count && sd->sc.getSCE(SC_CAMOUFLAGE)))) || pc_isdead(sd))
 			break; // hidden or dead chars cannot use warps
 		if (!pc_job_can_entermap((enum e_job)sd->status.class_, map_mapindex2mapid(nd->u.warp.mapindex), sd->group_level))
 			break;
@@ -1186,8 +1250,15 @@ int npc_touch_area_allnpc(struct map_session_data* sd, int16 m, int16 x, int16 y
 	struct map_data *mapdata = map_getmapdata(m);
 	int f = 1;
 
-	for (int i = 0; i < mapdata->npc_num_area; i++) {
-		switch( npc_touch_areanpc(sd, m, x, y, mapdata->npc[i]) ) {
+	for (int i = 0; ; i++) {
+		int count;
+		// Fetched again for every npc, as the OnTouch scripts may move, load or unload npcs
+		struct npc_data** area_npcs = map_getareanpcs(m, x, y, &count);
+
+		if (i >= count)
+			break;
+
+		switch( npc_touch_areanpc(sd, m, x, y, area_npcs[i]) ) {
 		case 0:
 			break;
 		case 1:
@@ -1212,25 +1283,27 @@ int npc_touch_areanpc2(struct mob_data *md)
 	int i, x = md->bl.x, y = md->bl.y, id;
 	char eventname[EVENT_NAME_LENGTH];
 	struct event_data* ev;
-	int xs, ys;
-	struct map_data *mapdata = map_getmapdata(md->bl.m);
+	int xs, ys, count;
+	struct npc_data** area_npcs = map_getareanpcs(md->bl.m, x, y, &count);
 
-	for( i = 0; i < mapdata->npc_num_area; i++ )
+	for( i = 0; i < count; i++ )
 	{
-		if( mapdata->npc[i]->sc.option&(OPTION_INVISIBLE|OPTION_CLOAK) )
+		struct npc_data* nd = area_npcs[i];
+
+		if( nd->sc.option&(OPTION_INVISIBLE|OPTION_CLOAK) )
 			continue;
 
-		switch( mapdata->npc[i]->subtype )
+		switch( nd->subtype )
 		{
 			case NPCTYPE_WARP:
 				if( !( battle_config.mob_warp&1 ) )
 					continue;
-				xs = mapdata->npc[i]->u.warp.xs;
-				ys = mapdata->npc[i]->u.warp.ys;
+				xs = nd->u.warp.xs;
+				ys = nd->u.warp.ys;
 				break;
 			case NPCTYPE_SCRIPT:
-				xs = mapdata->npc[i]->u.scr.xs;
-				ys = mapdata->npc[i]->u.scr.ys;
+				xs = nd->u.scr.xs;
+				ys = nd->u.scr.ys;
 				break;
 			default:
 				continue; // Keep Searching
@@ -1238,26 +1311,26 @@ int npc_touch_areanpc2(struct mob_data *md)
 		if (xs < 0 || ys < 0)
 			continue;
 
-		if( x >= mapdata->npc[i]->bl.x-xs && x <= mapdata->npc[i]->bl.x+xs && y >= mapdata->npc[i]->bl.y-ys && y <= mapdata->npc[i]->bl.y+ys )
+		if( x >= nd->bl.x-xs && x <= nd->bl.x+xs && y >= nd->bl.y-ys && y <= nd->bl.y+ys )
 		{ // In the npc touch area
-			switch( mapdata->npc[i]->subtype )
+			switch( nd->subtype )
 			{
 				case NPCTYPE_WARP: {
-					int16 warp_m = map_mapindex2mapid(mapdata->npc[i]->u.warp.mapindex);
+					int16 warp_m = map_mapindex2mapid(nd->u.warp.mapindex);
 
 					if( warp_m < 0 )
 						break; // Cannot Warp between map servers
-					if( unit_warp(&md->bl, warp_m, mapdata->npc[i]->u.warp.x, mapdata->npc[i]->u.warp.y, CLR_OUTSIGHT) == 0 )
+					if( unit_warp(&md->bl, warp_m, nd->u.warp.x, nd->u.warp.y, CLR_OUTSIGHT) == 0 )
 						return 1; // Warped
 				}
 					break;
 				case NPCTYPE_SCRIPT:
-					if( mapdata->npc[i]->bl.id == md->areanpc_id )
+					if( nd->bl.id == md->areanpc_id )
 						break; // Already touch this NPC
-					safesnprintf(eventname, ARRAYLENGTH(eventname), "%s::%s", mapdata->npc[i]->exname, script_config.ontouchnpc_event_name);
+					safesnprintf(eventname, ARRAYLENGTH(eventname), "%s::%s", nd->exname, script_config.ontouchnpc_event_name);
 					if( (ev = (struct event_data*)strdb_get(ev_db, eventname)) == NULL || ev->nd == NULL )
 						break; // No OnTouchNPC Event
-					md->areanpc_id = mapdata->npc[i]->bl.id;
+					md->areanpc_id = nd->bl.id;
 					id = md->bl.id; // Stores Unique ID
 					run_script(ev->nd->u.scr.script, ev->pos, md->bl.id, ev->nd->bl.id);
 					if( map_id2md(id) == NULL ) return 1; // Not Warped, but killed
@@ -1298,47 +1371,48 @@ int npc_check_areanpc(int flag, int16 m, int16 x, int16 y, int16 range)
 	y1 = i16min(y+range, mapdata->ys-1);
 
 	//First check for npc_cells on the range given
-	i = 0;
-	for (ys = y0; ys <= y1 && !i; ys++) {
-		for(xs = x0; xs <= x1 && !i; xs++){
-			if (map_getcell(m,xs,ys,CELL_CHKNPC))
-				i = 1;
-		}
-	}
-	if (!i) return 0; //No NPC_CELLs.
+	if (!map_getcellp_count(mapdata, x0, y0, x1, y1, CELL_CHKNPC))
+		return 0; //No NPC_CELLs.
 
-	//Now check for the actual NPC on said range.
-	for (i = 0; i < mapdata->npc_num_area; i++)
-	{
-		if (mapdata->npc[i]->sc.option&OPTION_INVISIBLE)
-			continue;
+	//Now check for the actual NPC on said range, only the npcs registered in the blocks of the range can overlap it.
+	for (int by = y0 / BLOCK_SIZE; by <= y1 / BLOCK_SIZE; by++) {
+		for (int bx = x0 / BLOCK_SIZE; bx <= x1 / BLOCK_SIZE; bx++) {
+			int count;
+			struct npc_data** area_npcs = map_getareanpcs(m, bx * BLOCK_SIZE, by * BLOCK_SIZE, &count);
 
-		switch(mapdata->npc[i]->subtype)
-		{
-		case NPCTYPE_WARP:
-			if (!(flag&1))
-				continue;
-			xs=mapdata->npc[i]->u.warp.xs;
-			ys=mapdata->npc[i]->u.warp.ys;
-			break;
-		case NPCTYPE_SCRIPT:
-			if (!(flag&2))
-				continue;
-			xs=mapdata->npc[i]->u.scr.xs;
-			ys=mapdata->npc[i]->u.scr.ys;
-			break;
-		default:
-			continue;
-		}
+			for (i = 0; i < count; i++)
+			{
+				struct npc_data* nd = area_npcs[i];
 
-		if( x1 >= mapdata->npc[i]->bl.x-xs && x0 <= mapdata->npc[i]->bl.x+xs
-		&&  y1 >= mapdata->npc[i]->bl.y-ys && y0 <= mapdata->npc[i]->bl.y+ys )
-			break; // found a npc
+				if (nd->sc.option&OPTION_INVISIBLE)
+					continue;
+
+				switch(nd->subtype)
+				{
+				case NPCTYPE_WARP:
+					if (!(flag&1))
+						continue;
+					xs=nd->u.warp.xs;
+					ys=nd->u.warp.ys;
+					break;
+				case NPCTYPE_SCRIPT:
+					if (!(flag&2))
+						continue;
+					xs=nd->u.scr.xs;
+					ys=nd->u.scr.ys;
+					break;
+				default:
+					continue;
+				}
+
+				if( x1 >= nd->bl.x-xs && x0 <= nd->bl.x+xs
+				&&  y1 >= nd->bl.y-ys && y0 <= nd->bl.y+ys )
+					return nd->bl.id; // found a npc
+			}
+		}
 	}
-	if (i == mapdata->npc_num_area)
-		return 0;
 
-	return (mapdata->npc[i]->bl.id);
+	return 0;
 }
 
 /*==========================================
@@ -2357,6 +2431,7 @@ static int npc_unload_ev(DBKey key, DBData *data, va_list ap)
 	char* npcname = va_arg(ap, char *);
 
 	if(strcmp(ev->nd->exname,npcname)==0){
+		npc_event_label_remove(ev);
 		db_remove(ev_db, key);
 		return 1;
 	}
@@ -2714,7 +2789,7 @@ struct npc_data *npc_create_npc(int16 m, int16 x, int16 y){
 
 	CREATE(nd, struct npc_data, 1);
 	nd->bl.id = npc_get_new_npc_id();
-	nd->bl.prev = nd->bl.next = nullptr;
+	nd->bl.prev = nullptr;
 	nd->bl.m = m;
 	nd->bl.x = x;
 	nd->bl.y = y;
@@ -3822,6 +3897,8 @@ void npc_setcells(struct npc_data* nd)
 	if (m < 0 || xs < 0 || ys < 0) //invalid range or map
 		return;
 
+	map_addareanpc(nd, x - xs, y - ys, x + xs, y + ys);
+
 	for (i = y-ys; i <= y+ys; i++) {
 		for (j = x-xs; j <= x+xs; j++) {
 			if (map_getcell(m, j, i, CELL_CHKNOPASS))
@@ -3865,6 +3942,8 @@ void npc_unsetcells(struct npc_data* nd)
 	for(y0 = y-ys; y0 > 0 && map_getcell(m, x, y0, CELL_CHKNPC); y0--);
 	for(y1 = y+ys; y1 < mapdata->ys-1 && map_getcell(m, x, y1, CELL_CHKNPC); y1++);
 
+	map_delareanpc(nd, x - xs, y - ys, x + xs, y + ys);
+
 	//Erase this npc's cells
 	for (i = y-ys; i <= y+ys; i++)
 		for (j = x-xs; j <= x+xs; j++)
@@ -4656,29 +4735,23 @@ void npc_read_event_script(void)
 
 	for (i = 0; i < NPCE_MAX; i++)
 	{
-		DBIterator* iter;
-		DBKey key;
-		DBData *data;
 		char name[EVENT_NAME_LENGTH];
 
 		safesnprintf(name,EVENT_NAME_LENGTH,"::%s", npc_get_script_event_name(i));
 
-		iter = db_iterator(ev_db);
-		for( data = iter->first(iter,&key); iter->exists(iter); data = iter->next(iter,&key) )
-		{
-			const char* p = key.str;
-			struct event_data* ed = (struct event_data*)db_data2ptr(data);
+		auto it = ev_label_db.find(npc_event_label_key(name));
 
-			if( (p=strchr(p,':')) && strcmpi(name,p)==0 ){
-				struct script_event_s evt;
+		if( it == ev_label_db.end() )
+			continue;
 
-				evt.event = ed;
-				evt.event_name = key.str;
+		for( struct event_data* ed : it->second ){
+			struct script_event_s evt;
 
-				script_event[static_cast<enum npce_event>(i)].push_back(evt);
-			}
+			evt.event = ed;
+			evt.event_name = ed->name;
+
+			script_event[static_cast<enum npce_event>(i)].push_back(evt);
 		}
-		dbi_destroy(iter);
 	}
 
 	if (battle_config.etc_log) {
@@ -4717,6 +4790,7 @@ int npc_reload(void) {
 
 	db_clear(npcname_db);
 	db_clear(ev_db);
+	ev_label_db.clear();
 
 	//Remove all npcs/mobs. [Skotlex]
 
@@ -4837,6 +4911,7 @@ bool npc_unloadfile( const char* path ) {
 void do_clear_npc(void) {
 	db_clear(npcname_db);
 	db_clear(ev_db);
+	ev_label_db.clear();
 }
 
 /*==========================================
@@ -4845,6 +4920,7 @@ void do_clear_npc(void) {
 void do_final_npc(void) {
 	npc_clear_pathlist();
 	script_event.clear();
+	ev_label_db.clear();
 	ev_db->destroy(ev_db, NULL);
 	npcname_db->destroy(npcname_db, NULL);
 	npc_path_db->destroy(npc_path_db, NULL);
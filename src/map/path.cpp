@@ -41,8 +41,9 @@ struct path_node {
 
 /// Binary heap of path nodes
 BHEAP_STRUCT_DECL(node_heap, struct path_node*);
-static BHEAP_STRUCT_VAR(node_heap, g_open_set);	// use static heap for all path calculations
-												// it get's initialized in do_init_path, freed in do_final_path.
+static thread_local BHEAP_STRUCT_VAR(node_heap, g_open_set);	// use static heap for all path calculations of a thread
+															// it get's initialized in do_init_path, freed in do_final_path.
+															// worker threads use path_init_thread and path_final_thread instead.
 
 
 /// Comparator for binary heap of path nodes (minimum cost at top)
@@ -55,6 +56,47 @@ static BHEAP_STRUCT_VAR(node_heap, g_open_set);	// use static heap for all path
 #define heuristic(x0, y0, x1, y1)	(MOVE_COST * (abs((x1) - (x0)) + abs((y1) - (y0)))) // Manhattan distance
 /// @}
 
+/// @name Structures and defines for Jump Point Search
+/// @{
+
+/// Cells on a path of at most MAX_WALKPATH steps are within a window of this size around start and goal
+#define JPS_SIZE (MAX_WALKPATH + 1)
+
+/// Jump point node, coordinates are relative to the search window
+struct jps_node {
+	uint32 search; ///< Search the node belongs to, nodes of previous searches are unused
+	short x; ///< X-coordinate
+	short y; ///< Y-coordinate
+	short px; ///< X-coordinate of the parent jump point (for pruning the neighbors)
+	short py; ///< Y-coordinate of the parent jump point
+	short g_cost; ///< Actual cost from start to this node
+	short f_cost; ///< g_cost + octile_heuristic(this, goal)
+	short steps; ///< Amount of cells walked from start to this node
+	short flag; ///< SET_OPEN / SET_CLOSED
+};
+
+/// Binary heap of jump point nodes
+BHEAP_STRUCT_DECL(jps_heap, struct jps_node*);
+static thread_local BHEAP_STRUCT_VAR(jps_heap, g_jps_open_set); // same life cycle as g_open_set
+static thread_local struct jps_node* g_jps_nodes = nullptr; // JPS_SIZE * JPS_SIZE nodes of the window
+static thread_local uint32 g_jps_search = 0;
+
+/// Window of a jump point search.
+/// The walkable cells are stored as bitmaps, so whole lines can be scanned at once.
+struct s_jps_search {
+	int16 wx, wy; ///< South west corner of the window on the map
+	int16 gx, gy; ///< Goal, relative to the window
+	uint64 rows[JPS_SIZE + 2]; ///< Bit x of rows[y + 1] is set if (wx + x, wy + y) is walkable, the first and last line stay empty
+	uint64 cols[JPS_SIZE + 2]; ///< Bit y of cols[x + 1] is set if (wx + x, wy + y) is walkable, the first and last line stay empty
+};
+
+/// Estimates the cost from (x0,y0) to (x1,y1).
+/// Unlike the client's heuristic this never overestimates, so the shortest path is found.
+#define octile_heuristic(x0, y0, x1, y1) (MOVE_COST * max(abs((x1) - (x0)), abs((y1) - (y0))) + (MOVE_DIAGONAL_COST - MOVE_COST) * min(abs((x1) - (x0)), abs((y1) - (y0))))
+/// Minimum amount of cells to walk from (x0,y0) to (x1,y1)
+#define walk_steps(x0, y0, x1, y1) max(abs((x1) - (x0)), abs((y1) - (y0)))
+/// @}
+
 // Translates dx,dy into walking direction
 static enum directions walk_choices [3][3] =
 {
@@ -66,12 +108,43 @@ static enum directions walk_choices [3][3] =
 
 void do_init_path(){
 	BHEAP_INIT(g_open_set);	// [fwi]: BHEAP_STRUCT_VAR already initialized the heap, this is rudendant & just for code-conformance/readability
+	BHEAP_INIT(g_jps_open_set);
+	CREATE(g_jps_nodes, struct jps_node, JPS_SIZE * JPS_SIZE);
 }//
 
 void do_final_path(){
 	BHEAP_CLEAR(g_open_set);
+	BHEAP_CLEAR(g_jps_open_set);
+	aFree(g_jps_nodes);
+	g_jps_nodes = nullptr;
 }//
 
+/**
+ * Prepares the path search for the calling worker thread.
+ * Every node is at most once in the open set, so it is allocated with room for all nodes up front
+ * and path_search never has to use the memory manager, which is not thread-safe, in the worker.
+ * Must be called while the main thread waits for the worker.
+ */
+void path_init_thread(){
+	BHEAP_INIT(g_open_set);
+	VECTOR_RESIZE(g_open_set, MAX_WALKPATH * MAX_WALKPATH, struct path_node **);
+	BHEAP_INIT(g_jps_open_set);
+	VECTOR_RESIZE(g_jps_open_set, JPS_SIZE * JPS_SIZE, struct jps_node **);
+	CREATE(g_jps_nodes, struct jps_node, JPS_SIZE * JPS_SIZE);
+	g_jps_search = 0;
+}
+
+/**
+ * Frees the open set of the calling worker thread.
+ * Must be called while the main thread waits for the worker.
+ */
+void path_final_thread(){
+	BHEAP_CLEAR(g_open_set);
+	BHEAP_CLEAR(g_jps_open_set);
+	aFree(g_jps_nodes);
+	g_jps_nodes = nullptr;
+}
+
 
 /*==========================================
  * Find the closest reachable cell, 'count' cells away from (x0,y0) in direction (dx,dy).
@@ -164,6 +237,21 @@ bool path_search_long(struct shootpath_data *spd,int16 m,int16 x0,int16 y0,int16
 		spd->rx = 1;
 	}
 
+	// The line stays within the rectangle of its ends, so if both are on the checked part
+	// of the map the common checks can read the bitplanes without going through map_getcellp
+	const uint64* walkable = nullptr;
+	const uint64* shootable = nullptr;
+
+	if( ( cell == CELL_CHKWALL || cell == CELL_CHKNOREACH
+#ifndef CELL_NOSTACK
+		|| cell == CELL_CHKNOPASS
+#endif
+		) && x0 >= 0 && x1 < mapdata->xs - 1 && min(y0, y1) >= 0 && max(y0, y1) < mapdata->ys - 1 ) {
+		walkable = map_cellword(mapdata, CELL_WALKABLE, 0, 0);
+		if( cell == CELL_CHKWALL )
+			shootable = map_cellword(mapdata, CELL_SHOOTABLE, 0, 0);
+	}
+
 	while (x0 != x1 || y0 != y1)
 	{
 		wx += dx;
@@ -185,7 +273,15 @@ bool path_search_long(struct shootpath_data *spd,int16 m,int16 x0,int16 y0,int16
 			spd->y[spd->len] = y0;
 			spd->len++;
 		}
-		if ((x0 != x1 || y0 != y1) && map_getcellp(mapdata,x0,y0,cell))
+		if (x0 == x1 && y0 == y1)
+			break;
+		if (walkable != nullptr) {
+			size_t word = (size_t)y0 * mapdata->cell_words + (x0 >> 6);
+			uint64 bit = (uint64)1 << (x0 & 63);
+
+			if (!(walkable[word] & bit) && (shootable == nullptr || !(shootable[word] & bit)))
+				return false;
+		} else if (map_getcellp(mapdata,x0,y0,cell))
 			return false;
 	}
 
@@ -259,6 +355,550 @@ static int add_path(struct node_heap *heap, struct path_node *tp, int16 x, int16
 }
 ///@}
 
+/// @name Jump Point Search related functions
+/// @{
+
+#define swap_ptrcast_jpsnode(a, b) swap_ptrcast(struct jps_node *, a, b)
+
+/// Pushes jps_node to the binary jps_heap.
+static void heap_push_jps_node(struct jps_heap *heap, struct jps_node *node)
+{
+#ifndef __clang_analyzer__ // TODO: Figure out why clang's static analyzer doesn't like this
+	BHEAP_ENSURE2(*heap, 1, 256, struct jps_node **);
+	BHEAP_PUSH2(*heap, node, NODE_MINTOPCMP, swap_ptrcast_jpsnode);
+#endif // __clang_analyzer__
+}
+
+/// Index of the lowest set bit, v must not be 0.
+static inline int jps_lowest_bit(uint64 v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctzll(v);
+#else
+	int i = 0;
+	while (!(v & 1)) {
+		v >>= 1;
+		i++;
+	}
+	return i;
+#endif
+}
+
+/// Index of the highest set bit, v must not be 0.
+static inline int jps_highest_bit(uint64 v)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return 63 - __builtin_clzll(v);
+#else
+	int i = 0;
+	while (v >>= 1)
+		i++;
+	return i;
+#endif
+}
+
+/// Transposes a 64x64 bit matrix, bit c of m[r] becomes bit r of m[c].
+static void jps_transpose(uint64 m[64])
+{
+	uint64 mask = 0x00000000FFFFFFFFULL;
+	int j, k;
+
+	for (j = 32; j != 0; j >>= 1, mask ^= mask << j) {
+		for (k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+			uint64 t = ((m[k] >> j) ^ m[k | j]) & mask;
+
+			m[k | j] ^= t;
+			m[k] ^= t << j;
+		}
+	}
+}
+
+/// Whether (x,y) of the window can be walked on. Cells outside of the window count as obstacles.
+static inline bool jps_walkable(const struct s_jps_search *s, int x, int y)
+{
+	if (x < 0 || x >= JPS_SIZE || y < 0 || y >= JPS_SIZE)
+		return false;
+
+	return (s->rows[y + 1] >> x) & 1;
+}
+
+/**
+ * Walks along a line of the window until a jump point is found.
+ * A cell is a jump point if it is the goal or if a cell next to it can only be reached through it.
+ * All cells of the line are checked at once with the bitmaps of the line and the lines next to it.
+ * @param lines: Rows to walk horizontally or columns to walk vertically
+ * @param line: Index of the line to walk on
+ * @param pos: Position on the line to start from
+ * @param dir: 1 to walk towards higher positions, -1 towards lower ones
+ * @param goal: Position of the goal if it is on this line, otherwise -1
+ * @return position of the jump point or -1 if an obstacle is hit first
+ */
+static int jps_scan(const uint64 *lines, int line, int pos, int dir, int goal)
+{
+	uint64 open = lines[line], left = lines[line - 1], right = lines[line + 1];
+	uint64 stop;
+	int found;
+
+	if (pos < 0 || pos >= JPS_SIZE)
+		return -1;
+
+	stop = ~open;
+	if (goal >= 0)
+		stop |= (uint64)1 << goal;
+
+	if (dir > 0) {
+		// A cell next to the line is forced if the one behind it is not walkable
+		stop |= (left & ~(left << 1)) | (right & ~(right << 1));
+		stop &= ~(uint64)0 << pos;
+		found = jps_lowest_bit(stop); // the bits after the window are never open
+	} else {
+		stop |= (left & ~(left >> 1)) | (right & ~(right >> 1));
+		stop &= ((uint64)2 << pos) - 1;
+		if (stop == 0)
+			return -1;
+		found = jps_highest_bit(stop);
+	}
+
+	return ((open >> found) & 1) ? found : -1;
+}
+
+/// Walks from (x,y) in the direction (dx,dy) until a jump point is found.
+/// Diagonal cells are jump points if a straight walk from them finds one.
+/// Like in the A* search, a diagonal step is only possible if both cells around it are walkable.
+static bool jps_jump(const struct s_jps_search *s, int x, int y, int dx, int dy, int *jx, int *jy)
+{
+	if (dy == 0) {
+		if ((*jx = jps_scan(s->rows, y + 1, x, dx, (y == s->gy) ? s->gx : -1)) < 0)
+			return false;
+		*jy = y;
+		return true;
+	}
+
+	if (dx == 0) {
+		if ((*jy = jps_scan(s->cols, x + 1, y, dy, (x == s->gx) ? s->gy : -1)) < 0)
+			return false;
+		*jx = x;
+		return true;
+	}
+
+	for (;; x += dx, y += dy) {
+		if (!jps_walkable(s, x, y))
+			return false;
+		if ((x == s->gx && y == s->gy)
+			|| jps_scan(s->rows, y + 1, x + dx, dx, (y == s->gy) ? s->gx : -1) >= 0
+			|| jps_scan(s->cols, x + 1, y + dy, dy, (x == s->gx) ? s->gy : -1) >= 0)
+			break;
+		if (!jps_walkable(s, x + dx, y) || !jps_walkable(s, x, y + dy))
+			return false;
+	}
+
+	*jx = x;
+	*jy = y;
+	return true;
+}
+
+/// Collects the directions to search from a jump point, pruned by the direction it was reached from.
+/// @return amount of directions
+static int jps_directions(const struct s_jps_search *s, const struct jps_node *node, int8 dirs[8][2])
+{
+	int x = node->x, y = node->y;
+	int dx = (x > node->px) - (x < node->px);
+	int dy = (y > node->py) - (y < node->py);
+	int n = 0;
+
+#define add_dir(ddx, ddy) (dirs[n][0] = (ddx), dirs[n][1] = (ddy), n++)
+	if (dx == 0 && dy == 0) { // start node, search in all directions
+		bool north = jps_walkable(s, x, y + 1), south = jps_walkable(s, x, y - 1);
+		bool east = jps_walkable(s, x + 1, y), west = jps_walkable(s, x - 1, y);
+
+		if (north) add_dir(0, 1);
+		if (south) add_dir(0, -1);
+		if (east) add_dir(1, 0);
+		if (west) add_dir(-1, 0);
+		if (north && east) add_dir(1, 1);
+		if (north && west) add_dir(-1, 1);
+		if (south && east) add_dir(1, -1);
+		if (south && west) add_dir(-1, -1);
+	} else if (dx != 0 && dy != 0) {
+		bool vertical = jps_walkable(s, x, y + dy), horizontal = jps_walkable(s, x + dx, y);
+
+		if (vertical) add_dir(0, dy);
+		if (horizontal) add_dir(dx, 0);
+		if (vertical && horizontal) add_dir(dx, dy);
+	} else if (dx != 0) {
+		bool next = jps_walkable(s, x + dx, y), north = jps_walkable(s, x, y + 1), south = jps_walkable(s, x, y - 1);
+
+		if (next) {
+			add_dir(dx, 0);
+			if (north) add_dir(dx, 1);
+			if (south) add_dir(dx, -1);
+		}
+		if (north) add_dir(0, 1);
+		if (south) add_dir(0, -1);
+	} else {
+		bool next = jps_walkable(s, x, y + dy), east = jps_walkable(s, x + 1, y), west = jps_walkable(s, x - 1, y);
+
+		if (next) {
+			add_dir(0, dy);
+			if (east) add_dir(1, dy);
+			if (west) add_dir(-1, dy);
+		}
+		if (east) add_dir(1, 0);
+		if (west) add_dir(-1, 0);
+	}
+#undef add_dir
+
+	return n;
+}
+
+/**
+ * Fills the bitmaps of the search window with the cells that pass the check.
+ * Checks that only depend on the terrain are read from the cell bitplanes a row at a time.
+ */
+static void jps_load_window(struct s_jps_search *s, struct map_data *mapdata, int width, int height, cell_chk cell)
+{
+	const uint64 *walkable = nullptr, *shootable = nullptr;
+	uint64 full = ((uint64)1 << width) - 1;
+	uint64 lines[64] = {};
+	int x, y;
+
+	switch (cell) {
+#ifndef CELL_NOSTACK
+		case CELL_CHKNOPASS:
+#endif
+		case CELL_CHKNOREACH:
+			walkable = map_cellword(mapdata, CELL_WALKABLE, 0, 0);
+			break;
+		case CELL_CHKWALL:
+			walkable = map_cellword(mapdata, CELL_WALKABLE, 0, 0);
+			shootable = map_cellword(mapdata, CELL_SHOOTABLE, 0, 0);
+			break;
+		default:
+			break;
+	}
+
+	for (y = 0; y < height; y++) {
+		int16 my = s->wy + y;
+
+		if (walkable != nullptr) {
+			size_t word = (size_t)my * mapdata->cell_words + (s->wx >> 6);
+			int shift = s->wx & 63;
+			uint64 bits = walkable[word] >> shift;
+
+			if (shootable != nullptr)
+				bits |= shootable[word] >> shift;
+			if (shift != 0 && shift + width > 64) {
+				bits |= walkable[word + 1] << (64 - shift);
+				if (shootable != nullptr)
+					bits |= shootable[word + 1] << (64 - shift);
+			}
+			lines[y] = bits & full;
+
+			// map_getcellp overrides the last row and column
+			if (my == mapdata->ys - 1)
+				lines[y] = (cell == CELL_CHKNOPASS) ? 0 : full;
+			else if (s->wx + width == mapdata->xs) {
+				if (cell == CELL_CHKNOPASS)
+					lines[y] &= ~((uint64)1 << (width - 1));
+				else
+					lines[y] |= (uint64)1 << (width - 1);
+			}
+		} else {
+			for (x = 0; x < width; x++) {
+				if (!map_getcellp(mapdata, s->wx + x, my, cell))
+					lines[y] |= (uint64)1 << x;
+			}
+		}
+	}
+
+	s->rows[0] = s->cols[0] = 0;
+	memcpy(&s->rows[1], lines, sizeof(uint64) * JPS_SIZE);
+	s->rows[JPS_SIZE + 1] = 0;
+	jps_transpose(lines);
+	memcpy(&s->cols[1], lines, sizeof(uint64) * JPS_SIZE);
+	s->cols[JPS_SIZE + 1] = 0;
+}
+
+/**
+ * Jump Point Search (x0,y0)->(x1,y1), only checks whether a path exists.
+ * Instead of adding every neighbor cell to the open set like A*, straight and diagonal lines
+ * are followed until a cell is found where the path may have to turn, so open fields only
+ * cost a few nodes. Finds the shortest path, which has to be at most MAX_WALKPATH cells long.
+ * Both cells must be on the map and the goal must pass the check.
+ */
+static bool path_search_jps(struct map_data *mapdata, int16 x0, int16 y0, int16 x1, int16 y1, cell_chk cell)
+{
+	struct s_jps_search s;
+	struct jps_node *current, *node;
+	int kx, ky, width, height;
+
+	if (walk_steps(x0, y0, x1, y1) > MAX_WALKPATH)
+		return false;
+
+	// A cell can only be on the path if walking to it from the start and from it to the goal
+	// takes at most MAX_WALKPATH steps. On each axis that allows (MAX_WALKPATH - distance) / 2
+	// more cells than the ones between start and goal.
+	kx = (MAX_WALKPATH - abs(x1 - x0)) / 2;
+	ky = (MAX_WALKPATH - abs(y1 - y0)) / 2;
+	s.wx = max(min(x0, x1) - kx, 0);
+	s.wy = max(min(y0, y1) - ky, 0);
+	width = min(max(x0, x1) + kx, mapdata->xs - 1) - s.wx + 1;
+	height = min(max(y0, y1) + ky, mapdata->ys - 1) - s.wy + 1;
+	s.gx = x1 - s.wx;
+	s.gy = y1 - s.wy;
+	x0 -= s.wx;
+	y0 -= s.wy;
+
+	jps_load_window(&s, mapdata, width, height, cell);
+
+	// Nodes of previous searches are told apart by their search number, so they do not have to be cleared
+	if (++g_jps_search == 0) {
+		memset(g_jps_nodes, 0, sizeof(struct jps_node) * JPS_SIZE * JPS_SIZE);
+		g_jps_search = 1;
+	}
+
+	BHEAP_RESET(g_jps_open_set);
+
+	// Start node
+	node = &g_jps_nodes[y0 * JPS_SIZE + x0];
+	node->search = g_jps_search;
+	node->x = node->px = x0;
+	node->y = node->py = y0;
+	node->g_cost = 0;
+	node->f_cost = octile_heuristic(x0, y0, s.gx, s.gy);
+	node->steps = 0;
+	node->flag = SET_OPEN;
+	heap_push_jps_node(&g_jps_open_set, node);
+
+	while (BHEAP_LENGTH(g_jps_open_set) > 0) {
+		int8 dirs[8][2];
+		int i, n;
+
+		current = BHEAP_PEEK(g_jps_open_set); // Look for the lowest f_cost node in the 'open' set
+		BHEAP_POP2(g_jps_open_set, NODE_MINTOPCMP, swap_ptrcast_jpsnode); // Remove it from 'open' set
+		current->flag = SET_CLOSED;
+
+		if (current->x == s.gx && current->y == s.gy)
+			return true;
+
+		n = jps_directions(&s, current, dirs);
+
+		for (i = 0; i < n; i++) {
+			int dx = dirs[i][0], dy = dirs[i][1];
+			int jx, jy, k, steps, g_cost;
+
+			if (!jps_jump(&s, current->x + dx, current->y + dy, dx, dy, &jx, &jy))
+				continue;
+
+			// Jump points are always connected by a straight or diagonal line
+			steps = walk_steps(current->x, current->y, jx, jy);
+			g_cost = current->g_cost + steps * ((dx != 0 && dy != 0) ? MOVE_DIAGONAL_COST : MOVE_COST);
+			steps += current->steps;
+
+			if (steps + walk_steps(jx, jy, s.gx, s.gy) > MAX_WALKPATH)
+				continue; // the goal can't be reached within the walk path limit from here
+
+			node = &g_jps_nodes[jy * JPS_SIZE + jx];
+
+			if (node->search != g_jps_search) { // New node
+				node->search = g_jps_search;
+				node->x = jx;
+				node->y = jy;
+			} else if (g_cost >= node->g_cost) {
+				continue;
+			} else if (node->flag == SET_OPEN) { // Better path to a node in the open set
+				node->px = current->x;
+				node->py = current->y;
+				node->g_cost = g_cost;
+				node->f_cost = g_cost + octile_heuristic(jx, jy, s.gx, s.gy);
+				node->steps = steps;
+				ARR_FIND(0, BHEAP_LENGTH(g_jps_open_set), k, BHEAP_DATA(g_jps_open_set)[k] == node);
+				BHEAP_UPDATE(g_jps_open_set, k, NODE_MINTOPCMP, swap_ptrcast_jpsnode);
+				continue;
+			}
+
+			node->px = current->x;
+			node->py = current->y;
+			node->g_cost = g_cost;
+			node->f_cost = g_cost + octile_heuristic(jx, jy, s.gx, s.gy);
+			node->steps = steps;
+			node->flag = SET_OPEN;
+			heap_push_jps_node(&g_jps_open_set, node); // Put it in open set (again)
+		}
+	}
+
+	return false;
+}
+///@}
+
+/// @name Path search result cache
+/// @{
+
+/// Whether the result of a path search with the given check only depends on the cell flags.
+static inline bool path_cache_allowed(cell_chk cell)
+{
+#ifdef CELL_NOSTACK
+	// The amount of objects on a cell changes without changing the cell version of the map
+	if (cell == CELL_CHKPASS || cell == CELL_CHKNOPASS || cell == CELL_CHKSTACK)
+		return false;
+#endif
+	return true;
+}
+
+/// Packs start and goal of a search into a cache key.
+static inline uint64 path_cache_key(int16 x0, int16 y0, int16 x1, int16 y1)
+{
+	return (uint64)(uint16)x0 | ((uint64)(uint16)y0 << 16) | ((uint64)(uint16)x1 << 32) | ((uint64)(uint16)y1 << 48);
+}
+
+/**
+ * Looks up a search result in the cache of a map.
+ * All entries are dropped once a cell of the map was changed.
+ * @param cache: Path cache of the map
+ * @param cell_version: Current cell version of the map
+ * @param key: Start and goal of the search
+ * @param mode: Check and algorithm of the search
+ * @param entry: Set to the found entry or the least recently used one, which should be replaced
+ * @return true if the result is cached
+ */
+static bool path_cache_find(struct s_path_cache *cache, uint32 cell_version, uint64 key, uint8 mode, struct s_path_cache_entry **entry)
+{
+	struct s_path_cache_entry *victim;
+	int i;
+
+	if (cache->cell_version != cell_version || ++cache->clock == 0) {
+		memset(cache->entries, 0, sizeof(cache->entries));
+		cache->cell_version = cell_version;
+		cache->clock = 1;
+	}
+
+	victim = &cache->entries[0];
+
+	for (i = 0; i < PATH_CACHE_SIZE; i++) {
+		struct s_path_cache_entry *it = &cache->entries[i];
+
+		if (it->last_used != 0 && it->key == key && it->mode == mode) {
+			it->last_used = cache->clock;
+			*entry = it;
+			return true;
+		}
+		if (it->last_used < victim->last_used)
+			victim = it;
+	}
+
+	*entry = victim;
+	return false;
+}
+///@}
+
+/// A* (A-star) pathfinding (x0,y0)->(x1,y1)
+/// We always use A* for finding walkpaths because it is what game client uses.
+/// Easy pathfinding cuts corners of non-walkable cells, but client always walks around it.
+static bool path_search_astar(struct walkpath_data *wpd, struct map_data *mapdata, int16 x0, int16 y0, int16 x1, int16 y1, cell_chk cell)
+{
+	register int i, x, y, dx = 0, dy = 0;
+
+	// FIXME: This array is too small to ensure all paths shorter than MAX_WALKPATH
+	// can be found without node collision: calc_index(node1) = calc_index(node2).
+	// Figure out more proper size or another way to keep track of known nodes.
+	struct path_node tp[MAX_WALKPATH * MAX_WALKPATH];
+	struct path_node *current, *it;
+	int xs = mapdata->xs - 1;
+	int ys = mapdata->ys - 1;
+	int len = 0;
+	int j;
+
+	BHEAP_RESET(g_open_set);
+
+	memset(tp, 0, sizeof(tp));
+
+	// Start node
+	i = calc_index(x0, y0);
+	tp[i].parent = NULL;
+	tp[i].x      = x0;
+	tp[i].y      = y0;
+	tp[i].g_cost = 0;
+	tp[i].f_cost = heuristic(x0, y0, x1, y1);
+	tp[i].flag   = SET_OPEN;
+
+	heap_push_node(&g_open_set, &tp[i]); // Put start node to 'open' set
+
+	for(;;) {
+		int e = 0; // error flag
+
+		// Saves allowed directions for the current cell. Diagonal directions
+		// are only allowed if both directions around it are allowed. This is
+		// to prevent cutting corner of nearby wall.
+		// For example, you can only go NW from the current cell, if you can
+		// go N *and* you can go W. Otherwise you need to walk around the
+		// (corner of the) non-walkable cell.
+		int allowed_dirs = 0;
+
+		int g_cost;
+
+		if (BHEAP_LENGTH(g_open_set) == 0) {
+			return false;
+		}
+
+		current = BHEAP_PEEK(g_open_set); // Look for the lowest f_cost node in the 'open' set
+		BHEAP_POP2(g_open_set, NODE_MINTOPCMP, swap_ptrcast_pathnode); // Remove it from 'open' set
+
+		x      = current->x;
+		y      = current->y;
+		g_cost = current->g_cost;
+
+		current->flag = SET_CLOSED; // Add current node to 'closed' set
+
+		if (x == x1 && y == y1) {
+			break;
+		}
+
+		if (y < ys && !map_getcellp(mapdata, x, y+1, cell)) allowed_dirs |= PATH_DIR_NORTH;
+		if (y >  0 && !map_getcellp(mapdata, x, y-1, cell)) allowed_dirs |= PATH_DIR_SOUTH;
+		if (x < xs && !map_getcellp(mapdata, x+1, y, cell)) allowed_dirs |= PATH_DIR_EAST;
+		if (x >  0 && !map_getcellp(mapdata, x-1, y, cell)) allowed_dirs |= PATH_DIR_WEST;
+
+#define chk_dir(d) ((allowed_dirs & (d)) == (d))
+		// Process neighbors of current node
+		if (chk_dir(PATH_DIR_SOUTH|PATH_DIR_EAST) && !map_getcellp(mapdata, x+1, y-1, cell))
+			e += add_path(&g_open_set, tp, x+1, y-1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x+1, y-1, x1, y1)); // (x+1, y-1) 5
+		if (chk_dir(PATH_DIR_EAST))
+			e += add_path(&g_open_set, tp, x+1, y, g_cost + MOVE_COST, current, heuristic(x+1, y, x1, y1)); // (x+1, y) 6
+		if (chk_dir(PATH_DIR_NORTH|PATH_DIR_EAST) && !map_getcellp(mapdata, x+1, y+1, cell))
+			e += add_path(&g_open_set, tp, x+1, y+1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x+1, y+1, x1, y1)); // (x+1, y+1) 7
+		if (chk_dir(PATH_DIR_NORTH))
+			e += add_path(&g_open_set, tp, x, y+1, g_cost + MOVE_COST, current, heuristic(x, y+1, x1, y1)); // (x, y+1) 0
+		if (chk_dir(PATH_DIR_NORTH|PATH_DIR_WEST) && !map_getcellp(mapdata, x-1, y+1, cell))
+			e += add_path(&g_open_set, tp, x-1, y+1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x-1, y+1, x1, y1)); // (x-1, y+1) 1
+		if (chk_dir(PATH_DIR_WEST))
+			e += add_path(&g_open_set, tp, x-1, y, g_cost + MOVE_COST, current, heuristic(x-1, y, x1, y1)); // (x-1, y) 2
+		if (chk_dir(PATH_DIR_SOUTH|PATH_DIR_WEST) && !map_getcellp(mapdata, x-1, y-1, cell))
+			e += add_path(&g_open_set, tp, x-1, y-1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x-1, y-1, x1, y1)); // (x-1, y-1) 3
+		if (chk_dir(PATH_DIR_SOUTH))
+			e += add_path(&g_open_set, tp, x, y-1, g_cost + MOVE_COST, current, heuristic(x, y-1, x1, y1)); // (x, y-1) 4
+#undef chk_dir
+		if (e) {
+			return false;
+		}
+	}
+
+	for (it = current; it->parent != NULL; it = it->parent, len++);
+	if (len > sizeof(wpd->path))
+		return false;
+
+	// Recreate path
+	wpd->path_len = len;
+	wpd->path_pos = 0;
+
+	for (it = current, j = len-1; j >= 0; it = it->parent, j--) {
+		dx = it->x - it->parent->x;
+		dy = it->y - it->parent->y;
+		wpd->path[j] = walk_choices[-dy + 1][dx + 1];
+	}
+
+	return true;
+}
+
 /*==========================================
  * path search (x0,y0)->(x1,y1)
  * wpd: path info will be written here
@@ -266,7 +906,11 @@ static int add_path(struct node_heap *heap, struct path_node *tp, int16 x, int16
  * flag: &2 = call path_search_long instead
  * cell: type of obstruction to check for
  *
- * Note: uses global g_open_set, therefore this method can't be called in parallel or recursivly.
+ * Results of full searches are kept in the path cache of the map.
+ * If wpd is NULL and path_reach_jps is enabled, Jump Point Search is used instead of A*.
+ *
+ * Note: uses the open set of the thread, therefore this method can't be called recursivly.
+ * Worker threads have to call path_init_thread first.
  *------------------------------------------*/
 bool path_search(struct walkpath_data *wpd, int16 m, int16 x0, int16 y0, int16 x1, int16 y1, int flag, cell_chk cell)
 {
@@ -326,111 +970,33 @@ bool path_search(struct walkpath_data *wpd, int16 m, int16 x0, int16 y0, int16 x
 
 		return false; // easy path unsuccessful
 	} else { // !(flag&1)
-		// FIXME: This array is too small to ensure all paths shorter than MAX_WALKPATH
-		// can be found without node collision: calc_index(node1) = calc_index(node2).
-		// Figure out more proper size or another way to keep track of known nodes.
-		struct path_node tp[MAX_WALKPATH * MAX_WALKPATH];
-		struct path_node *current, *it;
-		int xs = mapdata->xs - 1;
-		int ys = mapdata->ys - 1;
-		int len = 0;
-		int j;
-
-		// A* (A-star) pathfinding
-		// We always use A* for finding walkpaths because it is what game client uses.
-		// Easy pathfinding cuts corners of non-walkable cells, but client always walks around it.
-		BHEAP_RESET(g_open_set);
-
-		memset(tp, 0, sizeof(tp));
-
-		// Start node
-		i = calc_index(x0, y0);
-		tp[i].parent = NULL;
-		tp[i].x      = x0;
-		tp[i].y      = y0;
-		tp[i].g_cost = 0;
-		tp[i].f_cost = heuristic(x0, y0, x1, y1);
-		tp[i].flag   = SET_OPEN;
-
-		heap_push_node(&g_open_set, &tp[i]); // Put start node to 'open' set
-
-		for(;;) {
-			int e = 0; // error flag
-
-			// Saves allowed directions for the current cell. Diagonal directions
-			// are only allowed if both directions around it are allowed. This is
-			// to prevent cutting corner of nearby wall.
-			// For example, you can only go NW from the current cell, if you can
-			// go N *and* you can go W. Otherwise you need to walk around the
-			// (corner of the) non-walkable cell.
-			int allowed_dirs = 0;
-
-			int g_cost;
-
-			if (BHEAP_LENGTH(g_open_set) == 0) {
-				return false;
-			}
-
-			current = BHEAP_PEEK(g_open_set); // Look for the lowest f_cost node in the 'open' set
-			BHEAP_POP2(g_open_set, NODE_MINTOPCMP, swap_ptrcast_pathnode); // Remove it from 'open' set
-
-			x      = current->x;
-			y      = current->y;
-			g_cost = current->g_cost;
-
-			current->flag = SET_CLOSED; // Add current node to 'closed' set
-
-			if (x == x1 && y == y1) {
-				break;
-			}
-
-			if (y < ys && !map_getcellp(mapdata, x, y+1, cell)) allowed_dirs |= PATH_DIR_NORTH;
-			if (y >  0 && !map_getcellp(mapdata, x, y-1, cell)) allowed_dirs |= PATH_DIR_SOUTH;
-			if (x < xs && !map_getcellp(mapdata, x+1, y, cell)) allowed_dirs |= PATH_DIR_EAST;
-			if (x >  0 && !map_getcellp(mapdata, x-1, y, cell)) allowed_dirs |= PATH_DIR_WEST;
-
-#define chk_dir(d) ((allowed_dirs & (d)) == (d))
-			// Process neighbors of current node
-			if (chk_dir(PATH_DIR_SOUTH|PATH_DIR_EAST) && !map_getcellp(mapdata, x+1, y-1, cell))
-				e += add_path(&g_open_set, tp, x+1, y-1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x+1, y-1, x1, y1)); // (x+1, y-1) 5
-			if (chk_dir(PATH_DIR_EAST))
-				e += add_path(&g_open_set, tp, x+1, y, g_cost + MOVE_COST, current, heuristic(x+1, y, x1, y1)); // (x+1, y) 6
-			if (chk_dir(PATH_DIR_NORTH|PATH_DIR_EAST) && !map_getcellp(mapdata, x+1, y+1, cell))
-				e += add_path(&g_open_set, tp, x+1, y+1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x+1, y+1, x1, y1)); // (x+1, y+1) 7
-			if (chk_dir(PATH_DIR_NORTH))
-				e += add_path(&g_open_set, tp, x, y+1, g_cost + MOVE_COST, current, heuristic(x, y+1, x1, y1)); // (x, y+1) 0
-			if (chk_dir(PATH_DIR_NORTH|PATH_DIR_WEST) && !map_getcellp(mapdata, x-1, y+1, cell))
-				e += add_path(&g_open_set, tp, x-1, y+1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x-1, y+1, x1, y1)); // (x-1, y+1) 1
-			if (chk_dir(PATH_DIR_WEST))
-				e += add_path(&g_open_set, tp, x-1, y, g_cost + MOVE_COST, current, heuristic(x-1, y, x1, y1)); // (x-1, y) 2
-			if (chk_dir(PATH_DIR_SOUTH|PATH_DIR_WEST) && !map_getcellp(mapdata, x-1, y-1, cell))
-				e += add_path(&g_open_set, tp, x-1, y-1, g_cost + MOVE_DIAGONAL_COST, current, heuristic(x-1, y-1, x1, y1)); // (x-1, y-1) 3
-			if (chk_dir(PATH_DIR_SOUTH))
-				e += add_path(&g_open_set, tp, x, y-1, g_cost + MOVE_COST, current, heuristic(x, y-1, x1, y1)); // (x, y-1) 4
-#undef chk_dir
-			if (e) {
-				return false;
-			}
+		struct s_path_cache_entry *entry = nullptr;
+		bool jps = (wpd == &s_wpd && battle_config.path_reach_jps);
+		uint8 mode = (uint8)cell | (jps ? 0x80 : 0);
+		bool found;
+
+		if (path_cache_allowed(cell) && path_cache_find(mapdata->path_cache, mapdata->cell_version, path_cache_key(x0, y0, x1, y1), mode, &entry)) {
+			if (entry->found)
+				memcpy(wpd, &entry->wpd, sizeof(*wpd));
+			return entry->found;
 		}
 
-		for (it = current; it->parent != NULL; it = it->parent, len++);
-		if (len > sizeof(wpd->path))
-			return false;
-
-		// Recreate path
-		wpd->path_len = len;
-		wpd->path_pos = 0;
-
-		for (it = current, j = len-1; j >= 0; it = it->parent, j--) {
-			dx = it->x - it->parent->x;
-			dy = it->y - it->parent->y;
-			wpd->path[j] = walk_choices[-dy + 1][dx + 1];
+		if (jps)
+			found = path_search_jps(mapdata, x0, y0, x1, y1, cell);
+		else
+			found = path_search_astar(wpd, mapdata, x0, y0, x1, y1, cell);
+
+		if (entry != nullptr) {
+			entry->key = path_cache_key(x0, y0, x1, y1);
+			entry->last_used = mapdata->path_cache->clock;
+			entry->mode = mode;
+			entry->found = found;
+			if (found && !jps)
+				memcpy(&entry->wpd, wpd, sizeof(*wpd));
 		}
 
-		return true;
-	} // A* end
-
-	return false;
+		return found;
+	}
 }
 
 
@@ -37,6 +37,25 @@ struct shootpath_data {
 	int y[MAX_WALKPATH];
 };
 
+#define PATH_CACHE_SIZE 32
+
+/// Result of a previous path search
+struct s_path_cache_entry {
+	uint64 key; ///< Start and goal of the search, see path_cache_key
+	uint32 last_used; ///< Clock of the cache at the last hit (0 = unused)
+	uint8 mode; ///< Check and algorithm of the search
+	bool found; ///< Whether a path was found
+	struct walkpath_data wpd; ///< The path, if it was found by A*
+};
+
+/// Per-map cache of the most recently used path search results.
+/// Only ever accessed by the thread that processes the map.
+struct s_path_cache {
+	uint32 cell_version; ///< Cell version of the map the entries were calculated for
+	uint32 clock; ///< Increased with every lookup, used for the LRU replacement
+	struct s_path_cache_entry entries[PATH_CACHE_SIZE];
+};
+
 #define check_distance_bl(bl1, bl2, distance) check_distance((bl1)->x - (bl2)->x, (bl1)->y - (bl2)->y, distance)
 #define check_distance_blxy(bl, x1, y1, distance) check_distance((bl)->x-(x1), (bl)->y-(y1), distance)
 #define check_distance_xy(x0, y0, x1, y1, distance) check_distance((x0)-(x1), (y0)-(y1), distance)
@@ -73,5 +92,7 @@ bool direction_diagonal( enum directions direction );
 //
 void do_init_path();
 void do_final_path();
+void path_init_thread();
+void path_final_thread();
 
 #endif /* PATH_HPP */
@@ -2656,6 +2656,7 @@ struct script_code* parse_script(const char *src,const char *file,int line,int o
 	code->script_size = script_size;
 	code->local.vars = NULL;
 	code->local.arrays = NULL;
+	code->bonus_count = -1;
 	return code;
 }
 
@@ -3610,6 +3611,10 @@ void script_free_code(struct script_code* code)
 	script_free_vars(code->local.vars);
 	if (code->local.arrays)
 		code->local.arrays->destroy(code->local.arrays, script_free_array_db);
+	if (code->insns)
+		aFree(code->insns);
+	if (code->bonuses)
+		aFree(code->bonuses);
 	aFree(code->script_buf);
 	aFree(code);
 }
@@ -3758,6 +3763,90 @@ int64 get_num(unsigned char *script,int *pos)
 	return value;
 }
 
+/**
+ * Decodes the instruction at a position of a script buffer.
+ * @param buf: Script buffer
+ * @param pos: Position of the instruction
+ * @param insn: Receives the instruction
+ */
+static void script_decode_insn(unsigned char* buf, int pos, struct script_insn* insn)
+{
+	insn->pos = pos;
+	insn->op = get_com(buf, &pos);
+	insn->val = 0;
+
+	switch( insn->op ){
+		case C_INT:
+			insn->val = get_num(buf, &pos);
+			break;
+		case C_POS:
+		case C_NAME:
+			insn->val = GETVALUE(buf, pos);
+			pos += 3;
+			break;
+		case C_STR:
+			insn->val = pos;
+			while( buf[pos++] );
+			break;
+		default:
+			break;
+	}
+
+	insn->next = pos;
+}
+
+/**
+ * Decodes the whole script buffer into fixed size instructions.
+ * The variable length numbers, references and strings are decoded only once,
+ * instead of every time the instruction runs.
+ * @param code: Script to decode
+ */
+static void script_decode(struct script_code* code)
+{
+	struct script_insn insn;
+	int count = 0;
+
+	for( int pos = 0; pos < code->script_size; pos = insn.next ){
+		script_decode_insn(code->script_buf, pos, &insn);
+		count++;
+	}
+
+	CREATE(code->insns, struct script_insn, count);
+	code->insn_count = 0;
+
+	for( int pos = 0; pos < code->script_size; pos = code->insns[code->insn_count++].next )
+		script_decode_insn(code->script_buf, pos, &code->insns[code->insn_count]);
+}
+
+/**
+ * Searches the decoded instruction at a position of the script buffer.
+ * @param code: Script to search in
+ * @param pos: Position in the script buffer
+ * @return Index of the instruction or -1 if no instruction starts at the position
+ */
+static int script_insn_find(struct script_code* code, int pos)
+{
+	int min = 0, max;
+
+	if( code->insns == nullptr )
+		script_decode(code);
+
+	max = code->insn_count - 1;
+
+	while( min <= max ){
+		int mid = (min + max) / 2;
+
+		if( code->insns[mid].pos < pos )
+			min = mid + 1;
+		else if( code->insns[mid].pos > pos )
+			max = mid - 1;
+		else
+			return mid;
+	}
+
+	return -1;
+}
+
 /// Ternary operators
 /// test ? if_true : if_false
 void op_3(struct script_state* st, int op)
@@ -4385,8 +4474,31 @@ void run_script_main(struct script_state *st)
 	} else if(st->state != END)
 		st->state = RUN;
 
+	struct script_code* code = NULL; // script of the decoded instructions
+	int pc = 0; // index of the next decoded instruction
+
 	while(st->state == RUN) {
-		enum c_op c = get_com(st->script->script_buf,&st->pos);
+		const struct script_insn* insn;
+		struct script_insn single;
+		unsigned char* buf = st->script->script_buf;
+
+		// Commands can jump or switch to another script, look the instruction up again then
+		if( code != st->script || pc >= code->insn_count || code->insns[pc].pos != st->pos ) {
+			code = st->script;
+			pc = script_insn_find(code, st->pos);
+		}
+
+		if( pc < 0 ) {// not the start of a decoded instruction, decode it directly
+			script_decode_insn(buf, st->pos, &single);
+			insn = &single;
+			code = NULL;
+		} else
+			insn = &code->insns[pc++];
+
+		enum c_op c = insn->op;
+
+		st->pos = insn->next;
+
 		switch(c){
 		case C_EOL:
 			if( stack->defsp > stack->sp )
@@ -4395,19 +4507,17 @@ void run_script_main(struct script_state *st)
 				pop_stack(st, stack->defsp, stack->sp);// pop unused stack data. (unused return value)
 			break;
 		case C_INT:
-			push_val(stack,C_INT,get_num(st->script->script_buf,&st->pos));
+			push_val(stack,C_INT,insn->val);
 			break;
 		case C_POS:
 		case C_NAME:
-			push_val(stack,c,GETVALUE(st->script->script_buf,st->pos));
-			st->pos+=3;
+			push_val(stack,c,insn->val);
 			break;
 		case C_ARG:
 			push_val(stack,c,0);
 			break;
 		case C_STR:
-			push_str(stack,C_CONSTSTR,(char*)(st->script->script_buf+st->pos));
-			while(st->script->script_buf[st->pos++]);
+			push_str(stack,C_CONSTSTR,(char*)(buf+insn->val));
 			break;
 		case C_FUNC:
 			run_func(st);
@@ -5942,16 +6052,16 @@ BUILDIN_FUNC(percentheal)
 		return SCRIPT_CMD_SUCCESS;
 
 #ifdef RENEWAL
-	if( sd->sc.data[SC_EXTREMITYFIST2] )
+	if( sd->sc.getSCE(SC_EXTREMITYFIST2) )
 		sp = 0;
 #endif
 
-	if (sd->sc.data[SC_NORECOVER_STATE]) {
+	if (sd->sc.getSCE(SC_NORECOVER_STATE)) {
 		hp = 0;
 		sp = 0;
 	}
 
-	if (sd->sc.data[SC_BITESCAR])
+	if (sd->sc.getSCE(SC_BITESCAR))
 		hp = 0;
 
 	pc_percentheal(sd,hp,sp);
@@ -9567,6 +9677,34 @@ BUILDIN_FUNC(statusup2)
 	return SCRIPT_CMD_SUCCESS;
 }
 
+/// Checks if the first value of a bonus type is a skill.
+static bool script_bonus_isskill(int type)
+{
+	switch( type ){
+		case SP_AUTOSPELL:
+		case SP_AUTOSPELL_WHENHIT:
+		case SP_AUTOSPELL_ONSKILL:
+		case SP_SKILL_ATK:
+		case SP_SKILL_HEAL:
+		case SP_SKILL_HEAL2:
+		case SP_ADD_SKILL_BLOW:
+		case SP_CASTRATE:
+		case SP_ADDEFF_ONSKILL:
+		case SP_SKILL_USE_SP_RATE:
+		case SP_SKILL_COOLDOWN:
+		case SP_SKILL_FIXEDCAST:
+		case SP_SKILL_VARIABLECAST:
+		case SP_VARCASTRATE:
+		case SP_FIXCASTRATE:
+		case SP_SKILL_DELAY:
+		case SP_SKILL_USE_SP:
+		case SP_SUB_SKILL:
+			return true;
+		default:
+			return false;
+	}
+}
+
 /// See 'doc/item_bonus.txt'
 ///
 /// bonus <bonus type>,<val1>;
@@ -9588,46 +9726,26 @@ BUILDIN_FUNC(bonus)
 		return SCRIPT_CMD_SUCCESS; // no player attached
 
 	type = script_getnum(st,2);
-	switch( type ) {
-		case SP_AUTOSPELL:
-		case SP_AUTOSPELL_WHENHIT:
-		case SP_AUTOSPELL_ONSKILL:
-		case SP_SKILL_ATK:
-		case SP_SKILL_HEAL:
-		case SP_SKILL_HEAL2:
-		case SP_ADD_SKILL_BLOW:
-		case SP_CASTRATE:
-		case SP_ADDEFF_ONSKILL:
-		case SP_SKILL_USE_SP_RATE:
-		case SP_SKILL_COOLDOWN:
-		case SP_SKILL_FIXEDCAST:
-		case SP_SKILL_VARIABLECAST:
-		case SP_VARCASTRATE:
-		case SP_FIXCASTRATE:
-		case SP_SKILL_DELAY:
-		case SP_SKILL_USE_SP:
-		case SP_SUB_SKILL:
-			// these bonuses support skill names
-			if (script_isstring(st, 3)) {
-				const char *name = script_getstr(st, 3);
+	if( script_bonus_isskill(type) ){
+		// these bonuses support skill names
+		if (script_isstring(st, 3)) {
+			const char *name = script_getstr(st, 3);
 
-				if (!(val1 = skill_name2id(name))) {
-					ShowError("buildin_bonus: Invalid skill name %s passed to item bonus. Skipping.\n", name);
-					return SCRIPT_CMD_FAILURE;
-				}
-			} else {
-				val1 = script_getnum(st, 3);
+			if (!(val1 = skill_name2id(name))) {
+				ShowError("buildin_bonus: Invalid skill name %s passed to item bonus. Skipping.\n", name);
+				return SCRIPT_CMD_FAILURE;
+			}
+		} else {
+			val1 = script_getnum(st, 3);
 
-				if (strcmpi(script_getfuncname(st), "bonus") && !skill_get_index(val1)) { // Only check skill ID for bonus2, bonus3, bonus4, or bonus5
-					ShowError("buildin_bonus: Invalid skill ID %d passed to item bonus. Skipping.\n", val1);
-					return SCRIPT_CMD_FAILURE;
-				}
+			if (strcmpi(script_getfuncname(st), "bonus") && !skill_get_index(val1)) { // Only check skill ID for bonus2, bonus3, bonus4, or bonus5
+				ShowError("buildin_bonus: Invalid skill ID %d passed to item bonus. Skipping.\n", val1);
+				return SCRIPT_CMD_FAILURE;
 			}
-			break;
-		default:
-			if (script_hasdata(st, 3))
-				val1 = script_getnum(st, 3);
-			break;
+		}
+	}else{
+		if (script_hasdata(st, 3))
+			val1 = script_getnum(st, 3);
 	}
 
 	switch( script_lastdata(st)-2 ) {
@@ -9673,6 +9791,137 @@ BUILDIN_FUNC(bonus)
 	return SCRIPT_CMD_SUCCESS;
 }
 
+/**
+ * Compiles a script that consists only of bonus commands with constant arguments,
+ * like most item scripts do, into a list of bonuses.
+ * These are given by script_run_bonus without running the script.
+ * @param code: Script to compile
+ * @return True if the script was compiled, false if it has to be run
+ */
+bool script_compile_bonus(struct script_code* code)
+{
+	std::vector<struct script_bonus> bonuses;
+	struct script_insn insn;
+	int pos = 0;
+
+	if( code == nullptr )
+		return false;
+
+	for( ;; ){
+		script_decode_insn(code->script_buf, pos, &insn);
+		pos = insn.next;
+
+		if( insn.op == C_NOP )
+			break;
+
+		// bonus<n> <type>,<val1>,...;
+		if( insn.op != C_NAME || str_data[insn.val].type != C_FUNC || str_data[insn.val].func != buildin_bonus )
+			return false;
+
+		const char* name = get_str((int)insn.val);
+		struct script_bonus bonus = {};
+		int values = 0, count = ( name[5] == '\0' ) ? -1 : name[5] - '0';
+
+		script_decode_insn(code->script_buf, pos, &insn);
+		pos = insn.next;
+
+		if( insn.op != C_ARG )
+			return false;
+
+		for( ;; ){
+			script_decode_insn(code->script_buf, pos, &insn);
+			pos = insn.next;
+
+			if( insn.op == C_FUNC )
+				break;
+			if( insn.op != C_INT || values > (int)ARRAYLENGTH(bonus.val) )
+				return false;
+
+			int64 value = insn.val;
+
+			script_decode_insn(code->script_buf, pos, &insn);
+
+			if( insn.op == C_NEG ){
+				value = -value;
+				pos = insn.next;
+			}
+
+			if( values == 0 )
+				bonus.type = static_cast<int>(value);
+			else
+				bonus.val[values - 1] = static_cast<int>(value);
+			values++;
+		}
+
+		script_decode_insn(code->script_buf, pos, &insn);
+		pos = insn.next;
+
+		// bonus takes an optional value, the others a fixed amount
+		if( insn.op != C_EOL || values == 0 || ( count >= 0 && values != count + 1 ) || ( count < 0 && values > 2 ) )
+			return false;
+
+		bonus.count = values - 1;
+		bonuses.push_back(bonus);
+	}
+
+	if( code->bonuses != nullptr )
+		aFree(code->bonuses);
+	code->bonuses = nullptr;
+	code->bonus_count = (int)bonuses.size();
+
+	if( !bonuses.empty() ){
+		CREATE(code->bonuses, struct script_bonus, bonuses.size());
+		memcpy(code->bonuses, bonuses.data(), bonuses.size() * sizeof(struct script_bonus));
+	}
+
+	return true;
+}
+
+/**
+ * Gives the bonuses of a script to a player.
+ * Scripts compiled by script_compile_bonus are not run, all others are.
+ * @param code: Script
+ * @param sd: Player
+ */
+void script_run_bonus(struct script_code* code, struct map_session_data* sd)
+{
+	if( code == nullptr || sd == nullptr )
+		return;
+
+	if( code->bonus_count < 0 ){
+		run_script(code, 0, sd->bl.id, 0);
+		return;
+	}
+
+	for( int i = 0; i < code->bonus_count; i++ ){
+		const struct script_bonus* bonus = &code->bonuses[i];
+
+		if( bonus->count >= 2 && script_bonus_isskill(bonus->type) && !skill_get_index(bonus->val[0]) ){
+			ShowError("buildin_bonus: Invalid skill ID %d passed to item bonus. Skipping.\n", bonus->val[0]);
+			continue;
+		}
+
+		switch( bonus->count ){
+			case 0:
+			case 1:
+				pc_bonus(sd, bonus->type, bonus->val[0]);
+				break;
+			case 2:
+				pc_bonus2(sd, bonus->type, bonus->val[0], bonus->val[1]);
+				break;
+			case 3:
+				pc_bonus3(sd, bonus->type, bonus->val[0], bonus->val[1], bonus->val[2]);
+				break;
+			case 4:
+				pc_bonus4(sd, bonus->type, bonus->val[0], bonus->val[1], bonus->val[2], bonus->val[3]);
+				break;
+			case 5:
+				pc_bonus5(sd, bonus->type, bonus->val[0], bonus->val[1], bonus->val[2], bonus->val[3], bonus->val[4]);
+				break;
+		}
+	}
+}
+
 BUILDIN_FUNC(autobonus)
 {
 	unsigned int dur, pos;
@@ -11863,7 +12112,7 @@ BUILDIN_FUNC(sc_end)
 
 	if (type >= 0 && type < SC_MAX) {
 		struct status_change *sc = status_get_sc(bl);
-		struct status_change_entry *sce = sc ? sc->data[type] : NULL;
+		struct status_change_entry *sce = sc ? sc->getSCE(type) : NULL;
 
 		if (!sce)
 			return SCRIPT_CMD_SUCCESS;
@@ -11937,7 +12186,7 @@ BUILDIN_FUNC(sc_end_class)
 	for (int i = 0; i < MAX_SKILL_TREE && (skill_id = skill_tree[pc_class2idx(class_)][i].skill_id) > 0; i++) {
 		enum sc_type sc = status_skill2sc(skill_id);
 
-		if (sc > SC_COMMON_MAX && sd->sc.data[sc])
+		if (sc > SC_COMMON_MAX && sd->sc.getSCE(sc))
 			status_change_end(&sd->bl, sc, INVALID_TIMER);
 	}
 
@@ -11987,7 +12236,7 @@ BUILDIN_FUNC(getstatus)
 		return SCRIPT_CMD_SUCCESS;
 	}
 
-	if( sd->sc.count == 0 || !sd->sc.data[id] )
+	if( sd->sc.count == 0 || !sd->sc.getSCE(id) )
 	{// no status is active
 		script_pushint(st, 0);
 		return SCRIPT_CMD_SUCCESS;
@@ -11995,13 +12244,13 @@ BUILDIN_FUNC(getstatus)
 
 	switch( type )
 	{
-		case 1:	 script_pushint(st, sd->sc.data[id]->val1);	break;
-		case 2:  script_pushint(st, sd->sc.data[id]->val2);	break;
-		case 3:  script_pushint(st, sd->sc.data[id]->val3);	break;
-		case 4:  script_pushint(st, sd->sc.data[id]->val4);	break;
+		case 1:	 script_pushint(st, sd->sc.getSCE(id)->val1);	break;
+		case 2:  script_pushint(st, sd->sc.getSCE(id)->val2);	break;
+		case 3:  script_pushint(st, sd->sc.getSCE(id)->val3);	break;
+		case 4:  script_pushint(st, sd->sc.getSCE(id)->val4);	break;
 		case 5:
 			{
-				struct TimerData* timer = (struct TimerData*)get_timer(sd->sc.data[id]->timer);
+				struct TimerData* timer = (struct TimerData*)get_timer(sd->sc.getSCE(id)->timer);
 
 				if( timer )
 				{// return the amount of time remaining
@@ -17581,6 +17830,7 @@ BUILDIN_FUNC(setitemscript)
 		script_free_code(*dstscript);
 
 	*dstscript = script[0] ? parse_script(script, "script_setitemscript", 0, 0) : NULL;
+	script_compile_bonus(*dstscript);
 	script_pushint(st,1);
 	return SCRIPT_CMD_SUCCESS;
 }
@@ -18472,7 +18722,7 @@ BUILDIN_FUNC(setunitdata)
 			case UMOB_LEVEL: md->level = (unsigned short)value; clif_name_area(&md->bl); break;
 			case UMOB_HP: md->base_status->hp = (unsigned int)value; status_set_hp(bl, (unsigned int)value, 0); clif_name_area(&md->bl); break;
 			case UMOB_MAXHP: md->base_status->hp = md->base_status->max_hp = (unsigned int)value; status_set_maxhp(bl, (unsigned int)value, 0); clif_name_area(&md->bl); break;
-			case UMOB_MASTERAID: md->master_id = value; break;
+			case UMOB_MASTERAID: md->master_id = value; mob_ai_wake(md); break;
 			case UMOB_MAPID: if (mapname) value = map_mapname2mapid(mapname); unit_warp(bl, (short)value, 0, 0, CLR_TELEPORT); break;
 			case UMOB_X: if (!unit_walktoxy(bl, (short)value, md->bl.y, 2)) unit_movepos(bl, (short)value, md->bl.y, 0, 0); break;
 			case UMOB_Y: if (!unit_walktoxy(bl, md->bl.x, (short)value, 2)) unit_movepos(bl, md->bl.x, (short)value, 0, 0); break;
@@ -21683,7 +21933,7 @@ BUILDIN_FUNC(ismounting) {
 	
 	if (!script_charid2sd(2,sd))
 		return SCRIPT_CMD_FAILURE;
-	if( sd->sc.data[SC_ALL_RIDING] )
+	if( sd->sc.getSCE(SC_ALL_RIDING) )
 		script_pushint(st,1);
 	else
 		script_pushint(st,0);
@@ -21704,11 +21954,11 @@ BUILDIN_FUNC(setmounting) {
 	if( sd->sc.option&(OPTION_WUGRIDER|OPTION_RIDING|OPTION_DRAGON|OPTION_MADOGEAR) ) {
 		clif_msg(sd, NEED_REINS_OF_MOUNT);
 		script_pushint(st,0); //can't mount with one of these
-	} else if (sd->sc.data[SC_CLOAKING] || sd->sc.data[SC_CHASEWALK] || sd->sc.data[SC_CLOAKINGEXCEED] || sd->sc.data[SC_CAMOUFLAGE] || sd->sc.data[SC_STEALTHFIELD] || sd->sc.data[SC__FEINTBOMB]) {
+	} else if (sd->sc.getSCE(SC_CLOAKING) || sd->sc.getSCE(SC_CHASEWALK) || sd->sc.getSCE(SC_CLOAKINGEXCEED) || sd->sc.getSCE(SC_CAMOUFLAGE) || sd->sc.getSCE(SC_STEALTHFIELD) || sd->sc.getSCE(SC__FEINTBOMB)) {
 		// SC_HIDING, SC__INVISIBILITY, SC__SHADOWFORM, SC_SUHIDE already disable item usage
 		script_pushint(st, 0); // Silent failure
 	} else {
-		if( sd->sc.data[SC_ALL_RIDING] )
+		if( sd->sc.getSCE(SC_ALL_RIDING) )
 			status_change_end(&sd->bl, SC_ALL_RIDING, INVALID_TIMER); //release mount
 		else
 			sc_start(NULL, &sd->bl, SC_ALL_RIDING, 10000, 1, INFINITE_TICK); //mount
@@ -280,6 +280,21 @@ struct script_data {
 	struct reg_db *ref;
 };
 
+/// Decoded instruction of a script buffer, see script_decode
+struct script_insn {
+	int pos; ///< position of the instruction in the script buffer
+	int next; ///< position of the following instruction
+	int64 val; ///< operand: number of C_INT, id of C_NAME, label of C_POS, position of the C_STR text
+	enum c_op op;
+};
+
+/// Bonus command with constant arguments, see script_compile_bonus
+struct script_bonus {
+	int type;
+	int val[5];
+	uint8 count; // Amount of values after the type
+};
+
 // Moved defsp from script_state to script_stack since
 // it must be saved when script state is RERUNLINE. [Eoe / jA 1094]
 struct script_code {
@@ -287,6 +302,10 @@ struct script_code {
 	unsigned char* script_buf;
 	struct reg_db local;
 	unsigned short instances;
+	struct script_insn* insns; // Decoded instructions, created on the first run
+	int insn_count;
+	struct script_bonus* bonuses; // Bonus commands of a script that consists only of them
+	int bonus_count; // -1 if the script has to be run
 };
 
 struct script_stack {
@@ -2071,6 +2090,8 @@ public:
 	uint64 parseBodyNode(const YAML::Node& node);
 };
 
+extern ConstantDatabase constant_db;
+
 /**
  * used to generate quick script_array entries
  **/
@@ -2088,6 +2109,8 @@ void script_warning(const char* src, const char* file, int start_line, const cha
 bool is_number(const char *p);
 struct script_code* parse_script(const char* src,const char* file,int line,int options);
 void run_script(struct script_code *rootscript,int pos,int rid,int oid);
+bool script_compile_bonus(struct script_code* code);
+void script_run_bonus(struct script_code* code, struct map_session_data* sd);
 
 bool set_reg_num(struct script_state* st, struct map_session_data* sd, int64 num, const char* name, const int64 value, struct reg_db *ref);
 bool set_reg_str(struct script_state* st, struct map_session_data* sd, int64 num, const char* name, const char* value, struct reg_db* ref);
@@ -631,45 +631,45 @@ int skill_calc_heal(struct block_list *src, struct block_list *target, uint16 sk
 #endif
 
 	if (sc && sc->count) {
-		if (sc->data[SC_OFFERTORIUM] && (skill_id == AB_HIGHNESSHEAL || skill_id == AB_CHEAL || skill_id == PR_SANCTUARY || skill_id == AL_HEAL))
+		if (sc->getSCE(SC_OFFERTORIUM) && (skill_id == AB_HIGHNESSHEAL || skill_id == AB_CHEAL || skill_id == PR_SANCTUARY || skill_id == AL_HEAL))
 #ifdef RENEWAL
-			hp_bonus += sc->data[SC_OFFERTORIUM]->val2;
+			hp_bonus += sc->getSCE(SC_OFFERTORIUM)->val2;
 #else
-			hp += hp * sc->data[SC_OFFERTORIUM]->val2 / 100;
+			hp += hp * sc->getSCE(SC_OFFERTORIUM)->val2 / 100;
 #endif
-		if (sc->data[SC_GLASTHEIM_HEAL] && skill_id != NPC_EVILLAND && skill_id != BA_APPLEIDUN)
+		if (sc->getSCE(SC_GLASTHEIM_HEAL) && skill_id != NPC_EVILLAND && skill_id != BA_APPLEIDUN)
 #ifdef RENEWAL
-			hp_bonus += sc->data[SC_GLASTHEIM_HEAL]->val1;
+			hp_bonus += sc->getSCE(SC_GLASTHEIM_HEAL)->val1;
 #else
-			hp += hp * sc->data[SC_GLASTHEIM_HEAL]->val1 / 100;
+			hp += hp * sc->getSCE(SC_GLASTHEIM_HEAL)->val1 / 100;
 #endif
 	}
 
 	if (tsc && tsc->count) {
 		if (skill_id != NPC_EVILLAND && skill_id != BA_APPLEIDUN) {
-			if (tsc->data[SC_INCHEALRATE])
+			if (tsc->getSCE(SC_INCHEALRATE))
 #ifdef RENEWAL
-				hp_bonus += tsc->data[SC_INCHEALRATE]->val1; //Only affects Heal, Sanctuary and PotionPitcher.(like bHealPower) [Inkfish]
+				hp_bonus += tsc->getSCE(SC_INCHEALRATE)->val1; //Only affects Heal, Sanctuary and PotionPitcher.(like bHealPower) [Inkfish]
 #else
-				hp += hp * tsc->data[SC_INCHEALRATE]->val1 / 100;
+				hp += hp * tsc->getSCE(SC_INCHEALRATE)->val1 / 100;
 #endif
-			if (tsc->data[SC_GLASTHEIM_HEAL])
+			if (tsc->getSCE(SC_GLASTHEIM_HEAL))
 #ifdef RENEWAL
-				hp_bonus += tsc->data[SC_GLASTHEIM_HEAL]->val2;
+				hp_bonus += tsc->getSCE(SC_GLASTHEIM_HEAL)->val2;
 #else
-				hp += hp * tsc->data[SC_GLASTHEIM_HEAL]->val2 / 100;
+				hp += hp * tsc->getSCE(SC_GLASTHEIM_HEAL)->val2 / 100;
 #endif
-			if (tsc->data[SC_ANCILLA])
+			if (tsc->getSCE(SC_ANCILLA))
 #ifdef RENEWAL
-				hp_bonus += tsc->data[SC_ANCILLA]->val1;
+				hp_bonus += tsc->getSCE(SC_ANCILLA)->val1;
 #else
-				hp += hp * tsc->data[SC_ANCILLA]->val1 / 100;
-			if (tsc->data[SC_WATER_INSIGNIA] && tsc->data[SC_WATER_INSIGNIA]->val1 == 2)
+				hp += hp * tsc->getSCE(SC_ANCILLA)->val1 / 100;
+			if (tsc->getSCE(SC_WATER_INSIGNIA) && tsc->getSCE(SC_WATER_INSIGNIA)->val1 == 2)
 				hp += hp / 10;
 #endif
 #ifdef RENEWAL
-			if (tsc->data[SC_ASSUMPTIO])
-				hp_bonus += tsc->data[SC_ASSUMPTIO]->val1 * 2;
+			if (tsc->getSCE(SC_ASSUMPTIO))
+				hp_bonus += tsc->getSCE(SC_ASSUMPTIO)->val1 * 2;
 #endif
 		}
 	}
@@ -700,7 +700,7 @@ int skill_calc_heal(struct block_list *src, struct block_list *target, uint16 sk
 					max += wMatk + variance;
 				}
 
-				if( sc && sc->data[SC_RECOGNIZEDSPELL] )
+				if( sc && sc->getSCE(SC_RECOGNIZEDSPELL) )
 					min = max;
 
 				if( sd && sd->right_weapon.overrefine > 0 ){
@@ -718,7 +718,7 @@ int skill_calc_heal(struct block_list *src, struct block_list *target, uint16 sk
 	// Global multipliers are applied after the MATK is applied
 	if (tsc && tsc->count) {
 		if (skill_id != NPC_EVILLAND && skill_id != BA_APPLEIDUN) {
-			if (tsc->data[SC_WATER_INSIGNIA] && tsc->data[SC_WATER_INSIGNIA]->val1 == 2)
+			if (tsc->getSCE(SC_WATER_INSIGNIA) && tsc->getSCE(SC_WATER_INSIGNIA)->val1 == 2)
 				global_bonus *= 1.1f;
 		}
 	}
@@ -730,11 +730,11 @@ int skill_calc_heal(struct block_list *src, struct block_list *target, uint16 sk
 	if (heal && tsc && tsc->count) {
 		uint8 penalty = 0;
 
-		if (tsc->data[SC_CRITICALWOUND])
-			penalty += tsc->data[SC_CRITICALWOUND]->val2;
-		if (tsc->data[SC_DEATHHURT] && tsc->data[SC_DEATHHURT]->val3 == 1)
+		if (tsc->getSCE(SC_CRITICALWOUND))
+			penalty += tsc->getSCE(SC_CRITICALWOUND)->val2;
+		if (tsc->getSCE(SC_DEATHHURT) && tsc->getSCE(SC_DEATHHURT)->val3 == 1)
 			penalty += 20;
-		if (tsc->data[SC_NORECOVER_STATE])
+		if (tsc->getSCE(SC_NORECOVER_STATE))
 			penalty = 100;
 		if (penalty > 0) {
 #ifdef RENEWAL
@@ -776,11 +776,11 @@ static int8 skill_isCopyable(struct map_session_data *sd, uint16 skill_id) {
 	s_skill_copyable copyable = skill_db.find(skill_id)->copyable;
 
 	//Plagiarism only able to copy skill while SC_PRESERVE is not active and skill is copyable by Plagiarism
-	if (copyable.option & SKILL_COPY_PLAGIARISM && pc_checkskill(sd,RG_PLAGIARISM) && !sd->sc.data[SC_PRESERVE])
+	if (copyable.option & SKILL_COPY_PLAGIARISM && pc_checkskill(sd,RG_PLAGIARISM) && !sd->sc.getSCE(SC_PRESERVE))
 		return 1;
 
 	//Reproduce can copy skill if SC__REPRODUCE is active and the skill is copyable by Reproduce
-	if (copyable.option & SKILL_COPY_REPRODUCE && pc_checkskill(sd,SC_REPRODUCE) && sd->sc.data[SC__REPRODUCE] && sd->sc.data[SC__REPRODUCE]->val1)
+	if (copyable.option & SKILL_COPY_REPRODUCE && pc_checkskill(sd,SC_REPRODUCE) && sd->sc.getSCE(SC__REPRODUCE) && sd->sc.getSCE(SC__REPRODUCE)->val1)
 		return 2;
 
 	return 0;
@@ -843,7 +843,7 @@ bool skill_isNotOk(uint16 skill_id, struct map_session_data *sd)
 			return true;
 	}
 
-	if( sd->sc.data[SC_ALL_RIDING] )
+	if( sd->sc.getSCE(SC_ALL_RIDING) )
 		return true; //You can't use skills while in the new mounts (The client doesn't let you, this is to make cheat-safe)
 
 	switch (skill_id) {
@@ -984,61 +984,61 @@ bool skill_isNotOk_hom(struct homun_data *hd, uint16 skill_id, uint16 skill_lv)
 			}
 			break;
 		case MH_GOLDENE_FERSE: // Can't be used with Angriff's Modus
-			if (sc && sc->data[SC_ANGRIFFS_MODUS])
+			if (sc && sc->getSCE(SC_ANGRIFFS_MODUS))
 				return true;
 			break;
 		case MH_ANGRIFFS_MODUS:
-			if (sc && sc->data[SC_GOLDENE_FERSE])
+			if (sc && sc->getSCE(SC_GOLDENE_FERSE))
 				return true;
 			break;
 		case MH_TINDER_BREAKER: // Must be in grappling mode
-			if (!(sc && sc->data[SC_STYLE_CHANGE] && sc->data[SC_STYLE_CHANGE]->val1 == MH_MD_GRAPPLING)) {
+			if (!(sc && sc->getSCE(SC_STYLE_CHANGE) && sc->getSCE(SC_STYLE_CHANGE)->val1 == MH_MD_GRAPPLING)) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL_STYLE_CHANGE_GRAPPLER, 1);
 				return true;
 			}
 			break;
 		case MH_SONIC_CRAW: // Must be in fighting mode
-			if (!(sc && sc->data[SC_STYLE_CHANGE] && sc->data[SC_STYLE_CHANGE]->val1 == MH_MD_FIGHTING)) {
+			if (!(sc && sc->getSCE(SC_STYLE_CHANGE) && sc->getSCE(SC_STYLE_CHANGE)->val1 == MH_MD_FIGHTING)) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL_STYLE_CHANGE_FIGHTER, 0);
 				return true;
 			}
 			break;
 		case MH_SILVERVEIN_RUSH:
-			if (!(sc && sc->data[SC_STYLE_CHANGE] && sc->data[SC_STYLE_CHANGE]->val1 == MH_MD_FIGHTING)) {
+			if (!(sc && sc->getSCE(SC_STYLE_CHANGE) && sc->getSCE(SC_STYLE_CHANGE)->val1 == MH_MD_FIGHTING)) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL_STYLE_CHANGE_FIGHTER, 0);
 				return true;
 			}
-			if (!(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MH_SONIC_CRAW)) {
+			if (!(sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == MH_SONIC_CRAW)) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL_COMBOSKILL, MH_SONIC_CRAW);
 				return true;
 			}
 			break;
 		case MH_MIDNIGHT_FRENZY:
-			if (!(sc && sc->data[SC_STYLE_CHANGE] && sc->data[SC_STYLE_CHANGE]->val1 == MH_MD_FIGHTING)) {
+			if (!(sc && sc->getSCE(SC_STYLE_CHANGE) && sc->getSCE(SC_STYLE_CHANGE)->val1 == MH_MD_FIGHTING)) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL_STYLE_CHANGE_FIGHTER, 0);
 				return true;
 			}
-			if (!(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MH_SILVERVEIN_RUSH)) {
+			if (!(sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == MH_SILVERVEIN_RUSH)) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL_COMBOSKILL, MH_SILVERVEIN_RUSH);
 				return true;
 			}
 			break;
 		case MH_CBC:
-			if (!(sc && sc->data[SC_STYLE_CHANGE] && sc->data[SC_STYLE_CHANGE]->val1 == MH_MD_GRAPPLING)) {
+			if (!(sc && sc->getSCE(SC_STYLE_CHANGE) && sc->getSCE(SC_STYLE_CHANGE)->val1 == MH_MD_GRAPPLING)) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL_STYLE_CHANGE_GRAPPLER, 0);
 				return true;
 			}
-			if (!(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MH_TINDER_BREAKER)) {
+			if (!(sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == MH_TINDER_BREAKER)) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL_COMBOSKILL, MH_TINDER_BREAKER);
 				return true;
 			}
 			break;
 		case MH_EQC:
-			if (!(sc && sc->data[SC_STYLE_CHANGE] && sc->data[SC_STYLE_CHANGE]->val1 == MH_MD_GRAPPLING)) {
+			if (!(sc && sc->getSCE(SC_STYLE_CHANGE) && sc->getSCE(SC_STYLE_CHANGE)->val1 == MH_MD_GRAPPLING)) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL_STYLE_CHANGE_GRAPPLER, 0);
 				return true;
 			}
-			if (!(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MH_CBC)) {
+			if (!(sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == MH_CBC)) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL_COMBOSKILL, MH_CBC);
 				return true;
 			}
@@ -1181,25 +1181,25 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 	// Taekwon combos activate on traps, so we need to check them even for targets that don't have status
 	if (sd && skill_id == 0 && !(attack_type&BF_SKILL) && sc) {
 		// Chance to trigger Taekwon kicks
-		if (sc->data[SC_READYSTORM] &&
+		if (sc->getSCE(SC_READYSTORM) &&
 			sc_start4(src, src, SC_COMBO, 15, TK_STORMKICK,
 				0, 2, 0,
 				(2000 - 4 * sstatus->agi - 2 * sstatus->dex)))
 			; //Stance triggered
-		else if (sc->data[SC_READYDOWN] &&
+		else if (sc->getSCE(SC_READYDOWN) &&
 			sc_start4(src, src, SC_COMBO, 15, TK_DOWNKICK,
 				0, 2, 0,
 				(2000 - 4 * sstatus->agi - 2 * sstatus->dex)))
 			; //Stance triggered
-		else if (sc->data[SC_READYTURN] &&
+		else if (sc->getSCE(SC_READYTURN) &&
 			sc_start4(src, src, SC_COMBO, 15, TK_TURNKICK,
 				0, 2, 0,
 				(2000 - 4 * sstatus->agi - 2 * sstatus->dex)))
 			; //Stance triggered
-		else if (sc->data[SC_READYCOUNTER]) { //additional chance from SG_FRIEND [Komurka]
+		else if (sc->getSCE(SC_READYCOUNTER)) { //additional chance from SG_FRIEND [Komurka]
 			rate = 20;
-			if (sc->data[SC_SKILLRATE_UP] && sc->data[SC_SKILLRATE_UP]->val1 == TK_COUNTER) {
-				rate += rate*sc->data[SC_SKILLRATE_UP]->val2 / 100;
+			if (sc->getSCE(SC_SKILLRATE_UP) && sc->getSCE(SC_SKILLRATE_UP)->val1 == TK_COUNTER) {
+				rate += rate*sc->getSCE(SC_SKILLRATE_UP)->val2 / 100;
 				status_change_end(src, SC_SKILLRATE_UP, INVALID_TIMER);
 			}
 			sc_start4(src, src, SC_COMBO, rate, TK_COUNTER,
@@ -1320,15 +1320,15 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 				if (sc) {
 					struct status_change_entry *sce;
 					// Enchant Poison gives a chance to poison attacked enemies
-					if((sce=sc->data[SC_ENCPOISON])) //Don't use sc_start since chance comes in 1/10000 rate.
+					if((sce=sc->getSCE(SC_ENCPOISON))) //Don't use sc_start since chance comes in 1/10000 rate.
 						status_change_start(src,bl,SC_POISON,sce->val2, sce->val1,src->id,0,0,
 							skill_get_time2(AS_ENCHANTPOISON,sce->val1),SCSTART_NONE);
 					// Enchant Deadly Poison gives a chance to deadly poison attacked enemies
-					if((sce=sc->data[SC_EDP]))
+					if((sce=sc->getSCE(SC_EDP)))
 						sc_start4(src,bl,SC_DPOISON,sce->val2, sce->val1,src->id,0,0,
 							skill_get_time2(ASC_EDP,sce->val1));
 
-					if ((sce = sc->data[SC_LUXANIMA]) && rnd() % 100 < sce->val2)
+					if ((sce = sc->getSCE(SC_LUXANIMA)) && rnd() % 100 < sce->val2)
 						skill_castend_nodamage_id(src, bl, RK_STORMBLAST, 1, tick, 0);
 				}
 			}
@@ -1595,7 +1595,7 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 		break;
 
 	case PF_FOGWALL:
-		if (src != bl && !tsc->data[SC_DELUGE])
+		if (src != bl && !tsc->getSCE(SC_DELUGE))
 			sc_start(src,bl,SC_BLIND,100,skill_lv,skill_get_time2(skill_id,skill_lv));
 		break;
 
@@ -1637,7 +1637,7 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 
 	case TK_JUMPKICK:
 		// debuff the following statuses
-		if( dstsd && dstsd->class_ != MAPID_SOUL_LINKER && !tsc->data[SC_PRESERVE] ) {
+		if( dstsd && dstsd->class_ != MAPID_SOUL_LINKER && !tsc->getSCE(SC_PRESERVE) ) {
 			status_change_end(bl, SC_SPIRIT, INVALID_TIMER);
 			status_change_end(bl, SC_ADRENALINE2, INVALID_TIMER);
 			status_change_end(bl, SC_KAITE, INVALID_TIMER);
@@ -1741,7 +1741,7 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 		// Status chances are applied officially through a check
 		// The skill first trys to give the frozen status to targets that are hit
 		sc_start(src, bl, SC_FREEZE, 10 * skill_lv, skill_lv, skill_get_time(skill_id, skill_lv));
-		if (!tsc->data[SC_FREEZE]) // If it fails to give the frozen status, it will attempt to give the freezing status
+		if (!tsc->getSCE(SC_FREEZE)) // If it fails to give the frozen status, it will attempt to give the freezing status
 			sc_start(src, bl, SC_FREEZING, 20 + skill_lv * 10, skill_lv, skill_get_time2(skill_id, skill_lv));
 		break;
 	case NC_POWERSWING:
@@ -1779,7 +1779,7 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 			sc_start(src,bl, SC_BLIND, 50, skill_lv, skill_get_time(skill_id,skill_lv));
 		break;
 	case LG_HESPERUSLIT:
-		if( pc_checkskill(sd,LG_PINPOINTATTACK) > 0 && sc && sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 5 )
+		if( pc_checkskill(sd,LG_PINPOINTATTACK) > 0 && sc && sc->getSCE(SC_BANDING) && sc->getSCE(SC_BANDING)->val2 > 5 )
 			skill_castend_damage_id(src,bl,LG_PINPOINTATTACK,rnd_value(1, pc_checkskill(sd,LG_PINPOINTATTACK)),tick,0);
 		break;
 	case SR_DRAGONCOMBO:
@@ -1804,7 +1804,7 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 		break;
 	case SO_DIAMONDDUST:
 		rate = 5 + 5 * skill_lv;
-		if( sc && sc->data[SC_COOLER_OPTION] )
+		if( sc && sc->getSCE(SC_COOLER_OPTION) )
 			rate += (sd ? sd->status.job_level / 5 : 0);
 		sc_start(src,bl, SC_CRYSTALIZE, rate, skill_lv, skill_get_time2(skill_id, skill_lv));
 		break;
@@ -1923,7 +1923,7 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 			}
 
 			for (i = 0; n > 0 && i < SC_MAX; i++) {
-				if (!tsc->data[i])
+				if (!tsc->getSCE(i))
 					continue;
 				switch (i) {
 					case SC_WEIGHT50:		case SC_WEIGHT90:		case SC_HALLUCINATION:
@@ -2010,7 +2010,7 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 					case SC_WHISTLE:		case SC_ASSNCROS:		case SC_POEMBRAGI:
 					case SC_APPLEIDUN:		case SC_HUMMING:		case SC_DONTFORGETME:
 					case SC_FORTUNE:		case SC_SERVICE4U:
-						if (!battle_config.dispel_song || tsc->data[i]->val4 == 0)
+						if (!battle_config.dispel_song || tsc->getSCE(i)->val4 == 0)
 							continue; //If in song area don't end it, even if config enabled
 						break;
 					case SC_ASSUMPTIO:
@@ -2019,7 +2019,7 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 						break;
 				}
 				if( i == SC_BERSERK || i == SC_SATURDAYNIGHTFEVER )
-					tsc->data[i]->val2 = 0;
+					tsc->getSCE(i)->val2 = 0;
 				status_change_end(bl,(sc_type)i,INVALID_TIMER);
 				n--;
 			}
@@ -2095,9 +2095,9 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 #ifndef RENEWAL
 			if( sc )
 			{
-				if(sc->data[SC_OVERTHRUST])
+				if(sc->getSCE(SC_OVERTHRUST))
 					rate += 10;
-				if(sc->data[SC_MAXOVERTHRUST])
+				if(sc->getSCE(SC_MAXOVERTHRUST))
 					rate += 10;
 			}
 #endif
@@ -2110,8 +2110,8 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 			rate = 0;
 			if( sd )
 				rate += sd->bonus.break_weapon_rate;
-			if( sc && sc->data[SC_MELTDOWN] )
-				rate += sc->data[SC_MELTDOWN]->val2;
+			if( sc && sc->getSCE(SC_MELTDOWN) )
+				rate += sc->getSCE(SC_MELTDOWN)->val2;
 			if( rate )
 				skill_break_equip(src,bl, EQP_WEAPON, rate, BCT_ENEMY);
 
@@ -2119,8 +2119,8 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 			rate = 0;
 			if( sd )
 				rate += sd->bonus.break_armor_rate;
-			if( sc && sc->data[SC_MELTDOWN] )
-				rate += sc->data[SC_MELTDOWN]->val3;
+			if( sc && sc->getSCE(SC_MELTDOWN) )
+				rate += sc->getSCE(SC_MELTDOWN)->val3;
 			if( rate )
 				skill_break_equip(src,bl, EQP_ARMOR, rate, BCT_ENEMY);
 		}
@@ -2140,14 +2140,14 @@ int skill_additional_effect(struct block_list* src, struct block_list *bl, uint1
 	if( sd && sd->ed && sc && !status_isdead(bl) && !skill_id ) {
 		struct unit_data *ud = unit_bl2ud(src);
 
-		if( sc->data[SC_WILD_STORM_OPTION] )
-			skill = sc->data[SC_WILD_STORM_OPTION]->val2;
-		else if( sc->data[SC_UPHEAVAL_OPTION] )
-			skill = sc->data[SC_UPHEAVAL_OPTION]->val3;
-		else if( sc->data[SC_TROPIC_OPTION] )
-			skill = sc->data[SC_TROPIC_OPTION]->val3;
-		else if( sc->data[SC_CHILLY_AIR_OPTION] )
-			skill = sc->data[SC_CHILLY_AIR_OPTION]->val3;
+		if( sc->getSCE(SC_WILD_STORM_OPTION) )
+			skill = sc->getSCE(SC_WILD_STORM_OPTION)->val2;
+		else if( sc->getSCE(SC_UPHEAVAL_OPTION) )
+			skill = sc->getSCE(SC_UPHEAVAL_OPTION)->val3;
+		else if( sc->getSCE(SC_TROPIC_OPTION) )
+			skill = sc->getSCE(SC_TROPIC_OPTION)->val3;
+		else if( sc->getSCE(SC_CHILLY_AIR_OPTION) )
+			skill = sc->getSCE(SC_CHILLY_AIR_OPTION)->val3;
 		else
 			skill = 0;
 
@@ -2414,9 +2414,9 @@ int skill_counter_additional_effect (struct block_list* src, struct block_list *
 		{
 			status_change *sc = status_get_sc(src);
 
-			if( sc && sc->data[SC_FORCEOFVANGUARD]) {
-				for(int i = 0; i < sc->data[SC_FORCEOFVANGUARD]->val3; i++ )
-					pc_addspiritball(sd, skill_get_time(LG_FORCEOFVANGUARD,1),sc->data[SC_FORCEOFVANGUARD]->val3);
+			if( sc && sc->getSCE(SC_FORCEOFVANGUARD)) {
+				for(int i = 0; i < sc->getSCE(SC_FORCEOFVANGUARD)->val3; i++ )
+					pc_addspiritball(sd, skill_get_time(LG_FORCEOFVANGUARD,1),sc->getSCE(SC_FORCEOFVANGUARD)->val3);
 			}
 		}
 		break;
@@ -2461,10 +2461,10 @@ int skill_counter_additional_effect (struct block_list* src, struct block_list *
 			if( skill_id == WZ_WATERBALL ) {//(bugreport:5303)
 				struct status_change *sc = NULL;
 				if( ( sc = status_get_sc(src) ) ) {
-					if(sc->data[SC_SPIRIT] &&
-								sc->data[SC_SPIRIT]->val2 == SL_WIZARD &&
-								sc->data[SC_SPIRIT]->val3 == WZ_WATERBALL)
-								sc->data[SC_SPIRIT]->val3 = 0; //Clear bounced spell check.
+					if(sc->getSCE(SC_SPIRIT) &&
+								sc->getSCE(SC_SPIRIT)->val2 == SL_WIZARD &&
+								sc->getSCE(SC_SPIRIT)->val3 == WZ_WATERBALL)
+								sc->getSCE(SC_SPIRIT)->val3 = 0; //Clear bounced spell check.
 				}
 			}
 		}
@@ -2476,7 +2476,7 @@ int skill_counter_additional_effect (struct block_list* src, struct block_list *
 	if (dstsd && !status_isdead(bl) && !(skill_id && skill_get_nk(skill_id, NK_NODAMAGE))) {
 		struct status_change *sc = status_get_sc(bl);
 
-		if (sc && sc->data[SC_DORAM_SVSP] && attack_type&(BF_MAGIC|BF_LONG))
+		if (sc && sc->getSCE(SC_DORAM_SVSP) && attack_type&(BF_MAGIC|BF_LONG))
 			skill_castend_damage_id(bl, src, SU_SV_STEMSPEAR, (pc_checkskill(dstsd, SU_SV_STEMSPEAR) ? pc_checkskill(dstsd, SU_SV_STEMSPEAR) : 1), tick, 0);
 	}
 
@@ -2616,7 +2616,7 @@ int skill_break_equip(struct block_list *src, struct block_list *bl, unsigned sh
 
 	for (i = 0; i < 4; i++) {
 		if (where&where_list[i]) {
-			if (sc && sc->count && sc->data[scdef[i]])
+			if (sc && sc->count && sc->getSCE(scdef[i]))
 				where&=~where_list[i];
 			else if (rnd()%10000 >= rate)
 				where&=~where_list[i];
@@ -2778,7 +2778,7 @@ bool skill_strip_equip(struct block_list *src, struct block_list *target, uint16
 	}
 
 	for (uint8 i = 0; i < ARRAYLENGTH(pos); i++) {
-		if (location&pos[i] && sc_def[i] > SC_NONE && tsc->data[sc_def[i]])
+		if (location&pos[i] && sc_def[i] > SC_NONE && tsc->getSCE(sc_def[i]))
 			location &=~ pos[i];
 	}
 	if (!location)
@@ -2847,11 +2847,11 @@ short skill_blown(struct block_list* src, struct block_list* target, char count,
 	}
 
 	if (tsc) {
-		if (tsc->data[SC_SU_STOOP]) // Any knockback will cancel it.
+		if (tsc->getSCE(SC_SU_STOOP)) // Any knockback will cancel it.
 			status_change_end(target, SC_SU_STOOP, INVALID_TIMER);
-		if (tsc->data[SC_ROLLINGCUTTER])
+		if (tsc->getSCE(SC_ROLLINGCUTTER))
 			status_change_end(target, SC_ROLLINGCUTTER, INVALID_TIMER);
-		if (tsc->data[SC_SV_ROOTTWIST]) // Shouldn't move.
+		if (tsc->getSCE(SC_SV_ROOTTWIST)) // Shouldn't move.
 			return 0;
 	}
 
@@ -2868,14 +2868,14 @@ static int skill_magic_reflect(struct block_list* src, struct block_list* bl, in
 	struct status_change *sc = status_get_sc(bl);
 	struct map_session_data* sd = BL_CAST(BL_PC, bl);
 
-	if (!sc || !sc->data[SC_KYOMU]) { // Kyomu doesn't reflect
+	if (!sc || !sc->getSCE(SC_KYOMU)) { // Kyomu doesn't reflect
 		// Item-based reflection - Bypasses Boss check
 		if (sd && sd->bonus.magic_damage_return && type && rnd()%100 < sd->bonus.magic_damage_return)
 			return 1;
 	}
 
 	// Magic Mirror reflection - Bypasses Boss check
-	if (sc && sc->data[SC_MAGICMIRROR] && rnd()%100 < sc->data[SC_MAGICMIRROR]->val2)
+	if (sc && sc->getSCE(SC_MAGICMIRROR) && rnd()%100 < sc->getSCE(SC_MAGICMIRROR)->val2)
 		return 1;
 
 	if( status_get_class_(src) == CLASS_BOSS )
@@ -2886,7 +2886,7 @@ static int skill_magic_reflect(struct block_list* src, struct block_list* bl, in
 		return 0;
 
 	// Kaite reflection - Does not bypass Boss check
-	if( sc->data[SC_KAITE] && (src->type == BL_PC || status_get_lv(src) <= 80)
+	if( sc->getSCE(SC_KAITE) && (src->type == BL_PC || status_get_lv(src) <= 80)
 #ifdef RENEWAL
 		&& type // Does not reflect AoE
 #endif
@@ -2894,7 +2894,7 @@ static int skill_magic_reflect(struct block_list* src, struct block_list* bl, in
 		// Kaite only works against non-players if they are low-level.
 		// Kyomu doesn't disable Kaite, but the "skill fail chance" part of Kyomu applies to it.
 		clif_specialeffect(bl, EF_ATTACKENERGY2, AREA);
-		if( --sc->data[SC_KAITE]->val2 <= 0 )
+		if( --sc->getSCE(SC_KAITE)->val2 <= 0 )
 			status_change_end(bl, SC_KAITE, INVALID_TIMER);
 		return 2;
 	}
@@ -2986,7 +2986,7 @@ void skill_combo(struct block_list* src,struct block_list *dsrc, struct block_li
 	if(sc == NULL) return;
 
 	//End previous combo state after skill is invoked
-	if ((sce = sc->data[SC_COMBO]) != NULL) {
+	if ((sce = sc->getSCE(SC_COMBO)) != NULL) {
 		switch (skill_id) {
 		case TK_TURNKICK:
 		case TK_STORMKICK:
@@ -3036,7 +3036,7 @@ void skill_combo(struct block_list* src,struct block_list *dsrc, struct block_li
 				target_id = 0; // Will target current auto-target instead
 			}
 		case CH_CHAINCRUSH:
-			if (!duration && pc_checkskill(sd, MO_EXTREMITYFIST) > 0 && sd->spiritball > 0 && sd->sc.data[SC_EXPLOSIONSPIRITS]) {
+			if (!duration && pc_checkskill(sd, MO_EXTREMITYFIST) > 0 && sd->spiritball > 0 && sd->sc.getSCE(SC_EXPLOSIONSPIRITS)) {
 				duration = 1;
 				target_id = 0; // Will target current auto-target instead
 			}
@@ -3101,7 +3101,7 @@ static void skill_do_copy(struct block_list* src,struct block_list *bl, uint16 s
 	if (!tsd || (!pc_checkskill(tsd,RG_PLAGIARISM) && !pc_checkskill(tsd,SC_REPRODUCE)))
 		return;
 	//If SC_PRESERVE is active and SC__REPRODUCE is not active, nothing to do
-	else if (tsd->sc.data[SC_PRESERVE] && !tsd->sc.data[SC__REPRODUCE])
+	else if (tsd->sc.getSCE(SC_PRESERVE) && !tsd->sc.getSCE(SC__REPRODUCE))
 		return;
 	else {
 		uint16 idx;
@@ -3135,7 +3135,7 @@ static void skill_do_copy(struct block_list* src,struct block_list *bl, uint16 s
 					struct status_change *tsc = status_get_sc(bl);
 					//Already did SC check
 					//Skill level copied depends on Reproduce skill that used
-					lv = (tsc) ? tsc->data[SC__REPRODUCE]->val1 : 1;
+					lv = (tsc) ? tsc->getSCE(SC__REPRODUCE)->val1 : 1;
 					if( tsd->reproduceskill_idx > 0 && tsd->status.skill[tsd->reproduceskill_idx].flag == SKILL_FLAG_PLAGIARIZED ) {
 						clif_deleteskill(tsd,tsd->status.skill[tsd->reproduceskill_idx].id);
 						tsd->status.skill[tsd->reproduceskill_idx].id = 0;
@@ -3299,12 +3299,12 @@ int64 skill_attack (int attack_type, struct block_list* src, struct block_list *
 		tsc = NULL; //Don't need it.
 
 	 //Trick Dead protects you from damage, but not from buffs and the like, hence it's placed here.
-	if (tsc && tsc->data[SC_TRICKDEAD])
+	if (tsc && tsc->getSCE(SC_TRICKDEAD))
 		return 0;
 
 #ifndef RENEWAL
 	//When Gravitational Field is active, damage can only be dealt by Gravitational Field and Autospells
-	if(sd && sc && sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 == BCT_SELF && skill_id != HW_GRAVITATION && !sd->state.autocast)
+	if(sd && sc && sc->getSCE(SC_GRAVITATION) && sc->getSCE(SC_GRAVITATION)->val3 == BCT_SELF && skill_id != HW_GRAVITATION && !sd->state.autocast)
 		return 0;
 #endif
 
@@ -3355,7 +3355,7 @@ int64 skill_attack (int attack_type, struct block_list* src, struct block_list *
 			//Reflected magic damage will not cause the caster to be knocked back [Playtester]
 			flag |= 4;
 			//Spirit of Wizard blocks Kaite's reflection
-			if( type == 2 && tsc && tsc->data[SC_SPIRIT] && tsc->data[SC_SPIRIT]->val2 == SL_WIZARD )
+			if( type == 2 && tsc && tsc->getSCE(SC_SPIRIT) && tsc->getSCE(SC_SPIRIT)->val2 == SL_WIZARD )
 			{	//Consume one Fragment per hit of the casted skill? [Skotlex]
 				type = tsd?pc_search_inventory (tsd, ITEMID_FRAGMENT_OF_CRYSTAL):0;
 				if (type >= 0) {
@@ -3363,8 +3363,8 @@ int64 skill_attack (int attack_type, struct block_list* src, struct block_list *
 						pc_delitem(tsd, type, 1, 0, 1, LOG_TYPE_CONSUME);
 					dmg.damage = dmg.damage2 = 0;
 					dmg.dmg_lv = ATK_MISS;
-					tsc->data[SC_SPIRIT]->val3 = skill_id;
-					tsc->data[SC_SPIRIT]->val4 = dsrc->id;
+					tsc->getSCE(SC_SPIRIT)->val3 = skill_id;
+					tsc->getSCE(SC_SPIRIT)->val4 = dsrc->id;
 				}
 			} else if( type != 2 ) /* Kaite bypasses */
 				additional_effects = false;
@@ -3389,7 +3389,7 @@ int64 skill_attack (int attack_type, struct block_list* src, struct block_list *
 
 				dmg.damage = battle_attr_fix(bl, bl, dmg.damage, s_ele, status_get_element(bl), status_get_element_level(bl));
 
-				if( tsc && tsc->data[SC_ENERGYCOAT] ) {
+				if( tsc && tsc->getSCE(SC_ENERGYCOAT) ) {
 					struct status_data *status = status_get_status_data(bl);
 					int per = 100*status->sp / status->max_sp -1; //100% should be counted as the 80~99% interval
 					per /=20; //Uses 20% SP intervals.
@@ -3408,19 +3408,19 @@ int64 skill_attack (int attack_type, struct block_list* src, struct block_list *
 #endif
 		}
 
-		if(tsc && tsc->data[SC_MAGICROD] && src == dsrc) {
+		if(tsc && tsc->getSCE(SC_MAGICROD) && src == dsrc) {
 			int sp = skill_get_sp(skill_id,skill_lv);
 #ifndef RENEWAL 
 			clif_skill_nodamage(bl,bl,SA_MAGICROD,skill_lv,1);
 #endif
 			dmg.damage = dmg.damage2 = 0;
 			dmg.dmg_lv = ATK_MISS; //This will prevent skill additional effect from taking effect. [Skotlex]
-			sp = sp * tsc->data[SC_MAGICROD]->val2 / 100;
+			sp = sp * tsc->getSCE(SC_MAGICROD)->val2 / 100;
 			if(skill_id == WZ_WATERBALL && skill_lv > 1)
 				sp = sp/((skill_lv|1)*(skill_lv|1)); //Estimate SP cost of a single water-ball
 			status_heal(bl, 0, sp, 2);
 		}
-		if( (dmg.damage || dmg.damage2) && tsc && (tsc->data[SC_HALLUCINATIONWALK] && rnd()%100 < tsc->data[SC_HALLUCINATIONWALK]->val3 || tsc->data[SC_NPC_HALLUCINATIONWALK] && rnd()%100 < tsc->data[SC_NPC_HALLUCINATIONWALK]->val3) ) {
+		if( (dmg.damage || dmg.damage2) && tsc && (tsc->getSCE(SC_HALLUCINATIONWALK) && rnd()%100 < tsc->getSCE(SC_HALLUCINATIONWALK)->val3 || tsc->getSCE(SC_NPC_HALLUCINATIONWALK) && rnd()%100 < tsc->getSCE(SC_NPC_HALLUCINATIONWALK)->val3) ) {
 			dmg.damage = dmg.damage2 = 0;
 			dmg.dmg_lv = ATK_MISS;
 		}
@@ -3430,10 +3430,10 @@ int64 skill_attack (int attack_type, struct block_list* src, struct block_list *
 
 	if( (skill_id == AL_INCAGI || skill_id == AL_BLESSING ||
 		skill_id == CASH_BLESSING || skill_id == CASH_INCAGI ||
-		skill_id == MER_INCAGI || skill_id == MER_BLESSING) && tsd->sc.data[SC_CHANGEUNDEAD] )
+		skill_id == MER_INCAGI || skill_id == MER_BLESSING) && tsd->sc.getSCE(SC_CHANGEUNDEAD) )
 		damage = 1;
 
-	if( damage && tsc && tsc->data[SC_GENSOU] && dmg.flag&BF_MAGIC ){
+	if( damage && tsc && tsc->getSCE(SC_GENSOU) && dmg.flag&BF_MAGIC ){
 		struct block_list *nbl;
 		nbl = battle_getenemyarea(bl,bl->x,bl->y,2,BL_CHAR,bl->id);
 		if( nbl ){ // Only one target is chosen.
@@ -3480,7 +3480,7 @@ int64 skill_attack (int attack_type, struct block_list* src, struct block_list *
 		case SL_STUN:
 			if (skill_lv >= 7) {
 				struct status_change *sc_cur = status_get_sc(src);
-				if (sc_cur && !sc_cur->data[SC_SMA])
+				if (sc_cur && !sc_cur->getSCE(SC_SMA))
 					sc_start(src,src,SC_SMA,100,skill_lv,skill_get_time(SL_SMA, skill_lv));
 			}
 			break;
@@ -3649,7 +3649,7 @@ int64 skill_attack (int attack_type, struct block_list* src, struct block_list *
 
 	// Instant damage
 	if( !dmg.amotion ) {
-		if( (!tsc || (!tsc->data[SC_DEVOTION] && skill_id != CR_REFLECTSHIELD && !tsc->data[SC_WATER_SCREEN_OPTION])
+		if( (!tsc || (!tsc->getSCE(SC_DEVOTION) && skill_id != CR_REFLECTSHIELD && !tsc->getSCE(SC_WATER_SCREEN_OPTION))
 #ifndef RENEWAL
 			|| skill_id == HW_GRAVITATION
 #endif
@@ -3681,8 +3681,8 @@ int64 skill_attack (int attack_type, struct block_list* src, struct block_list *
 		&& skill_id != PA_PRESSURE && skill_id != HW_GRAVITATION
 #endif
 		) {
-		if (tsc->data[SC_DEVOTION]) {
-			struct status_change_entry *sce = tsc->data[SC_DEVOTION];
+		if (tsc->getSCE(SC_DEVOTION)) {
+			struct status_change_entry *sce = tsc->getSCE(SC_DEVOTION);
 			struct block_list *d_bl = map_id2bl(sce->val1);
 
 			if (d_bl && (
@@ -3710,8 +3710,8 @@ int64 skill_attack (int attack_type, struct block_list* src, struct block_list *
 					status_fix_damage(src, bl, damage, dmg.dmotion, 0);
 			}
 		}
-		if (tsc->data[SC_WATER_SCREEN_OPTION]) {
-			struct status_change_entry *sce = tsc->data[SC_WATER_SCREEN_OPTION];
+		if (tsc->getSCE(SC_WATER_SCREEN_OPTION)) {
+			struct status_change_entry *sce = tsc->getSCE(SC_WATER_SCREEN_OPTION);
 			struct block_list *e_bl = map_id2bl(sce->val1);
 
 			if (e_bl) {
@@ -3751,8 +3751,8 @@ int64 skill_attack (int attack_type, struct block_list* src, struct block_list *
 		switch( skill_id ) {
 			case GC_VENOMPRESSURE: {
 					struct status_change *ssc = status_get_sc(src);
-					if( ssc && ssc->data[SC_POISONINGWEAPON] && rnd()%100 < 70 + 5*skill_lv ) {
-						sc_start4(src, bl, (sc_type)ssc->data[SC_POISONINGWEAPON]->val2, 100, ssc->data[SC_POISONINGWEAPON]->val1, 0, 1, 0, skill_get_time2(GC_POISONINGWEAPON, 1));
+					if( ssc && ssc->getSCE(SC_POISONINGWEAPON) && rnd()%100 < 70 + 5*skill_lv ) {
+						sc_start4(src, bl, (sc_type)ssc->getSCE(SC_POISONINGWEAPON)->val2, 100, ssc->getSCE(SC_POISONINGWEAPON)->val1, 0, 1, 0, skill_get_time2(GC_POISONINGWEAPON, 1));
 						status_change_end(src,SC_POISONINGWEAPON,INVALID_TIMER);
 						clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
 					}
@@ -3768,7 +3768,7 @@ int64 skill_attack (int attack_type, struct block_list* src, struct block_list *
 			case MG_COLDBOLT:
 			case MG_FIREBOLT:
 			case MG_LIGHTNINGBOLT:
-				if (sc && sc->data[SC_DOUBLECAST] && rnd() % 100 < sc->data[SC_DOUBLECAST]->val2)
+				if (sc && sc->getSCE(SC_DOUBLECAST) && rnd() % 100 < sc->getSCE(SC_DOUBLECAST)->val2)
 					//skill_addtimerskill(src, tick + dmg.div_*dmg.amotion, bl->id, 0, 0, skill_id, skill_lv, BF_MAGIC, flag|2);
 					skill_addtimerskill(src, tick + dmg.amotion, bl->id, 0, 0, skill_id, skill_lv, BF_MAGIC, flag|2);
 				break;
@@ -4247,10 +4247,10 @@ static TIMER_FUNC(skill_timerskill){
 					} else {
 						struct status_change *sc = status_get_sc(src);
 						if(sc) {
-							if(sc->data[SC_SPIRIT] &&
-								sc->data[SC_SPIRIT]->val2 == SL_WIZARD &&
-								sc->data[SC_SPIRIT]->val3 == skl->skill_id)
-								sc->data[SC_SPIRIT]->val3 = 0; //Clear bounced spell check.
+							if(sc->getSCE(SC_SPIRIT) &&
+								sc->getSCE(SC_SPIRIT)->val2 == SL_WIZARD &&
+								sc->getSCE(SC_SPIRIT)->val3 == skl->skill_id)
+								sc->getSCE(SC_SPIRIT)->val3 = 0; //Clear bounced spell check.
 						}
 					}
 					break;
@@ -4339,7 +4339,7 @@ static TIMER_FUNC(skill_timerskill){
 				case SU_SV_ROOTTWIST_ATK: {
 						struct status_change *tsc = status_get_sc(target);
 
-						if (tsc && tsc->data[SC_SV_ROOTTWIST]) {
+						if (tsc && tsc->getSCE(SC_SV_ROOTTWIST)) {
 							if (check_distance_bl(src, target, 32)) // Only damage if caster is within 32x32 area
 								skill_attack(skl->type, src, target, target, skl->skill_id, skl->skill_lv, tick, skl->flag);
 							skill_addtimerskill(src, tick + 1000, target->id, 0, 0, skl->skill_id, skl->skill_lv, skl->type, skl->flag);
@@ -4819,14 +4819,14 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 
 	case LK_JOINTBEAT:
 		flag = 1 << rnd() % 6;
-		if (flag != BREAK_NECK && tsc && tsc->data[SC_JOINTBEAT] && tsc->data[SC_JOINTBEAT]->val2 & BREAK_NECK)
+		if (flag != BREAK_NECK && tsc && tsc->getSCE(SC_JOINTBEAT) && tsc->getSCE(SC_JOINTBEAT)->val2 & BREAK_NECK)
 			flag = BREAK_NECK; // Target should always receive double damage if neck is already broken
 		if (skill_attack(BF_WEAPON, src, src, bl, skill_id, skill_lv, tick, flag))
 			sc_start4(src, bl, SC_JOINTBEAT, 50 + (skill_lv + 1), skill_lv, flag&BREAK_FLAGS, src->id, 0, skill_get_time2(skill_id, skill_lv));
 		break;
 
 	case MO_COMBOFINISH:
-		if (!(flag&1) && sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_MONK)
+		if (!(flag&1) && sc && sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_MONK)
 		{	//Becomes a splash attack when Soul Linked.
 			map_foreachinshootrange(skill_area_sub, bl,
 				skill_get_splash(skill_id, skill_lv),BL_CHAR|BL_SKILL,
@@ -5127,7 +5127,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 			int heal = 0;
 			std::bitset<INF2_MAX> inf2 = skill_db.find(skill_id)->inf2;
 
-			if (tsc && tsc->data[SC_HOVERING] && inf2[INF2_IGNOREHOVERING])
+			if (tsc && tsc->getSCE(SC_HOVERING) && inf2[INF2_IGNOREHOVERING])
 				break; // Under Hovering characters are immune to select trap and ground target skills.
 
 			if (skill_id == AB_ADORAMUS && map_getcell(bl->m, bl->x, bl->y, CELL_CHKLANDPROTECTOR))
@@ -5456,14 +5456,14 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 		skill_attack(BF_MISC, src, src, bl, skill_id, skill_lv, tick, flag);
 
 		// We can end Dimension here since the cooldown code is processed before this point.
-		if (sc && sc->data[SC_DIMENSION])
+		if (sc && sc->getSCE(SC_DIMENSION))
 			status_change_end(src, SC_DIMENSION, INVALID_TIMER);
 		else // Dimension not active? Activate the 2 second skill block penalty.
 			sc_start(src, &sd->bl, SC_NOVAEXPLOSING, 100, skill_lv, skill_get_time(skill_id, skill_lv));
 		break;
 		
 	case SP_SOULEXPLOSION:
-		if (!(tsc && (tsc->data[SC_SPIRIT] || tsc->data[SC_SOULGOLEM] || tsc->data[SC_SOULSHADOW] || tsc->data[SC_SOULFALCON] || tsc->data[SC_SOULFAIRY])) || tstatus->hp < 10 * tstatus->max_hp / 100) { // Requires target to have a soul link and more then 10% of MaxHP.
+		if (!(tsc && (tsc->getSCE(SC_SPIRIT) || tsc->getSCE(SC_SOULGOLEM) || tsc->getSCE(SC_SOULSHADOW) || tsc->getSCE(SC_SOULFALCON) || tsc->getSCE(SC_SOULFAIRY))) || tstatus->hp < 10 * tstatus->max_hp / 100) { // Requires target to have a soul link and more then 10% of MaxHP.
 			// With this skill requiring a soul link, and the target to have more then 10% if MaxHP, I wonder
 			// if the cooldown still happens after it fails. Need a confirm. [Rytech] 
 			if (sd)
@@ -5536,7 +5536,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 #endif
 	case RK_DRAGONBREATH_WATER:
 	case RK_DRAGONBREATH:
-		if( tsc && tsc->data[SC_HIDING] )
+		if( tsc && tsc->getSCE(SC_HIDING) )
 			clif_skill_nodamage(src,src,skill_id,skill_lv,1);
 		else {
 			skill_attack(BF_WEAPON,src,src,bl,skill_id,skill_lv,tick,flag);
@@ -5544,7 +5544,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 		break;
 
 	case NPC_SELFDESTRUCTION:
-		if( tsc && tsc->data[SC_HIDING] )
+		if( tsc && tsc->getSCE(SC_HIDING) )
 			break;
 	case HVAN_EXPLOSION:
 		if (src != bl)
@@ -5639,7 +5639,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 		break;
 
 	case GC_CROSSRIPPERSLASHER:
-		if( sd && !(sc && sc->data[SC_ROLLINGCUTTER]) )
+		if( sd && !(sc && sc->getSCE(SC_ROLLINGCUTTER)) )
 			clif_skill_fail(sd,skill_id,USESKILL_FAIL_CONDITION,0);
 		else
 		{
@@ -5658,11 +5658,11 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 
 	case GC_PHANTOMMENACE:
 		if (flag&1) { // Only Hits Invisible Targets
-			if(tsc && (tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK) || tsc->data[SC_CAMOUFLAGE] || tsc->data[SC_STEALTHFIELD])) {
+			if(tsc && (tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK) || tsc->getSCE(SC_CAMOUFLAGE) || tsc->getSCE(SC_STEALTHFIELD))) {
 				status_change_end(bl, SC_CLOAKINGEXCEED, INVALID_TIMER);
 				skill_attack(BF_WEAPON,src,src,bl,skill_id,skill_lv,tick,flag);
 			}
-			if (tsc && tsc->data[SC__SHADOWFORM] && rnd() % 100 < 100 - tsc->data[SC__SHADOWFORM]->val1 * 10) // [100 - (Skill Level x 10)] %
+			if (tsc && tsc->getSCE(SC__SHADOWFORM) && rnd() % 100 < 100 - tsc->getSCE(SC__SHADOWFORM)->val1 * 10) // [100 - (Skill Level x 10)] %
 				status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER); // Should only end, no damage dealt.
 		}
 		break;
@@ -5717,16 +5717,16 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 		} else if (sc) { // No SC? No spheres
 			int i, k = 0;
 
-			if (sc->data[SC_SPHERE_5]) // If 5 spheres, remove last one (based on reverse order) and only do 4 actions (Official behavior)
+			if (sc->getSCE(SC_SPHERE_5)) // If 5 spheres, remove last one (based on reverse order) and only do 4 actions (Official behavior)
 				status_change_end(src, SC_SPHERE_1, INVALID_TIMER);
 
 			for (i = SC_SPHERE_5; i >= SC_SPHERE_1; i--) { // Loop should always be 4 for regular players, but unconditional_skill could be less
-				if (sc->data[static_cast<sc_type>(i)] == nullptr)
+				if (sc->getSCE(static_cast<sc_type>(i)) == nullptr)
 					continue;
 
 				uint16 subskill = 0;
 
-				switch (sc->data[static_cast<sc_type>(i)]->val1) {
+				switch (sc->getSCE(static_cast<sc_type>(i))->val1) {
 					case WLS_FIRE:
 						subskill = WL_TETRAVORTEX_FIRE;
 						k |= 1;
@@ -5766,13 +5766,13 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 			skill_toggle_magicpower(src, skill_id); // No hit will be amplified
 #endif
 			if (skill_lv == 1) { // SpellBook
-				if (sc->data[SC_FREEZE_SP] == nullptr)
+				if (sc->getSCE(SC_FREEZE_SP) == nullptr)
 					break;
 
 				bool found_spell = false;
 
 				for (i = SC_MAXSPELLBOOK; i >= SC_SPELLBOOK1; i--) { // List all available spell to be released
-					if (sc->data[i] != nullptr) {
+					if (sc->getSCE(i) != nullptr) {
 						found_spell = true;
 						break;
 					}
@@ -5782,14 +5782,14 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 					break;
 
 				// Now extract the data from the preserved spell
-				uint16 pres_skill_id = sc->data[i]->val1;
-				uint16 pres_skill_lv = sc->data[i]->val2;
-				uint16 point = sc->data[i]->val3;
+				uint16 pres_skill_id = sc->getSCE(i)->val1;
+				uint16 pres_skill_lv = sc->getSCE(i)->val2;
+				uint16 point = sc->getSCE(i)->val3;
 
 				status_change_end(src, static_cast<sc_type>(i), INVALID_TIMER);
 
-				if( sc->data[SC_FREEZE_SP]->val2 > point )
-					sc->data[SC_FREEZE_SP]->val2 -= point;
+				if( sc->getSCE(SC_FREEZE_SP)->val2 > point )
+					sc->getSCE(SC_FREEZE_SP)->val2 -= point;
 				else // Last spell to be released
 					status_change_end(src, SC_FREEZE_SP, INVALID_TIMER);
 
@@ -5821,13 +5821,13 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 					skill_blockpc_start(sd, pres_skill_id, cooldown);
 			} else { // Summoned Balls
 				for (i = SC_SPHERE_5; i >= SC_SPHERE_1; i--) {
-					if (sc->data[static_cast<sc_type>(i)] == nullptr)
+					if (sc->getSCE(static_cast<sc_type>(i)) == nullptr)
 						continue;
 
-					int skele = WL_RELEASE - 5 + sc->data[static_cast<sc_type>(i)]->val1 - WLS_FIRE; // Convert Ball Element into Skill ATK for balls
+					int skele = WL_RELEASE - 5 + sc->getSCE(static_cast<sc_type>(i))->val1 - WLS_FIRE; // Convert Ball Element into Skill ATK for balls
 
 					// WL_SUMMON_ATK_FIRE, WL_SUMMON_ATK_WIND, WL_SUMMON_ATK_WATER, WL_SUMMON_ATK_GROUND
-					skill_addtimerskill(src, tick + (t_tick)status_get_adelay(src) * abs(i - SC_SPHERE_1), bl->id, 0, 0, skele, sc->data[static_cast<sc_type>(i)]->val2, BF_MAGIC, flag | SD_LEVEL);
+					skill_addtimerskill(src, tick + (t_tick)status_get_adelay(src) * abs(i - SC_SPHERE_1), bl->id, 0, 0, skele, sc->getSCE(static_cast<sc_type>(i))->val2, BF_MAGIC, flag | SD_LEVEL);
 					status_change_end(src, static_cast<sc_type>(i), INVALID_TIMER); // Eliminate ball
 				}
 				clif_skill_nodamage(src, bl, skill_id, 0, 1);
@@ -5873,11 +5873,11 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 
 	case RA_SENSITIVEKEEN:
 		if( bl->type != BL_SKILL ) { // Only Hits Invisible Targets
-			if (tsc && ((tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK)) || tsc->data[SC_CAMOUFLAGE] || tsc->data[SC_STEALTHFIELD])) {
+			if (tsc && ((tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK)) || tsc->getSCE(SC_CAMOUFLAGE) || tsc->getSCE(SC_STEALTHFIELD))) {
 				status_change_end(bl, SC_CLOAKINGEXCEED, INVALID_TIMER);
 				skill_attack(BF_WEAPON,src,src,bl,skill_id,skill_lv,tick,flag);
 			}
-			if (tsc && tsc->data[SC__SHADOWFORM] && rnd() % 100 < 100 - tsc->data[SC__SHADOWFORM]->val1 * 10) // [100 - (Skill Level x 10)] %
+			if (tsc && tsc->getSCE(SC__SHADOWFORM) && rnd() % 100 < 100 - tsc->getSCE(SC__SHADOWFORM)->val1 * 10) // [100 - (Skill Level x 10)] %
 				status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER); // Should only end, no damage dealt.
 		} else {
 			skill_unit *su = BL_CAST(BL_SKILL, bl);
@@ -5904,7 +5904,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 			status_change_end(bl, SC_CLOAKINGEXCEED, INVALID_TIMER);
 			status_change_end(bl, SC_CAMOUFLAGE, INVALID_TIMER);
 			status_change_end(bl, SC_NEWMOON, INVALID_TIMER);
-			if (tsc && tsc->data[SC__SHADOWFORM] && rnd() % 100 < 100 - tsc->data[SC__SHADOWFORM]->val1 * 10) // [100 - (Skill Level x 10)] %
+			if (tsc && tsc->getSCE(SC__SHADOWFORM) && rnd() % 100 < 100 - tsc->getSCE(SC__SHADOWFORM)->val1 * 10) // [100 - (Skill Level x 10)] %
 				status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 			sc_start(src,bl, SC_INFRAREDSCAN, 10000, skill_lv, skill_get_time(skill_id, skill_lv));
 		} else {
@@ -5962,7 +5962,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 		if( flag&1 ) { //by default cloaking skills are remove by aoe skills so no more checking/removing except hiding and cloaking exceed.
 			skill_attack(BF_WEAPON, src, src, bl, skill_id, skill_lv, tick, flag);
 			status_change_end(bl, SC_CLOAKINGEXCEED, INVALID_TIMER);
-			if (tsc && tsc->data[SC__SHADOWFORM] && rnd() % 100 < 100 - tsc->data[SC__SHADOWFORM]->val1 * 10) // [100 - (Skill Level x 10)] %
+			if (tsc && tsc->getSCE(SC__SHADOWFORM) && rnd() % 100 < 100 - tsc->getSCE(SC__SHADOWFORM)->val1 * 10) // [100 - (Skill Level x 10)] %
 				status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 		} else {
 			map_foreachinrange(skill_area_sub, bl, skill_get_splash(skill_id, skill_lv), BL_CHAR|BL_SKILL, src, skill_id, skill_lv, tick, flag|BCT_ENEMY|SD_SPLASH|1, skill_castend_damage_id);
@@ -5974,7 +5974,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 		if (flag & 1) {
 			skill_attack(BF_WEAPON, src, src, bl, skill_id, skill_lv, tick, flag);
 		} else if (sd) {
-			if (sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == SR_FALLENEMPIRE && !sc->data[SC_FLASHCOMBO])
+			if (sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == SR_FALLENEMPIRE && !sc->getSCE(SC_FLASHCOMBO))
 				flag |= 8; // Only apply Combo bonus when Tiger Cannon is not used through Flash Combo
 			map_foreachinrange(skill_area_sub, bl, skill_get_splash(skill_id, skill_lv), BL_CHAR | BL_SKILL, src, skill_id, skill_lv, tick, flag | BCT_ENEMY | SD_SPLASH | 1, skill_castend_damage_id);
 		}
@@ -5991,7 +5991,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 		break;
 
 	case NPC_POISON_BUSTER:
-		if( tsc && tsc->data[SC_POISON] ) {
+		if( tsc && tsc->getSCE(SC_POISON) ) {
 			skill_attack(skill_get_type(skill_id), src, src, bl, skill_id, skill_lv, tick, flag);
 			status_change_end(bl, SC_POISON, INVALID_TIMER);
 		}
@@ -6082,7 +6082,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 
 			clif_skill_nodamage(src,battle_get_master(src),skill_id,skill_lv,1);
 			clif_skill_damage(src, src, tick, status_get_amotion(src), 0, -30000, 1, skill_id, skill_lv, DMG_SINGLE);
-			if( (tsc_ele && tsc_ele->data[type2]) || (tsc && tsc->data[type]) ) {
+			if( (tsc_ele && tsc_ele->getSCE(type2)) || (tsc && tsc->getSCE(type)) ) {
 				elemental_clean_single_effect(ele, skill_id);
 			}
 			if( rnd()%100 < 50 )
@@ -6140,12 +6140,12 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 				break;
 			}
 			// Triggered by RL_FLICKER
-			if (sd && sd->flicker && tsc && tsc->data[SC_H_MINE] && tsc->data[SC_H_MINE]->val2 == src->id) {
+			if (sd && sd->flicker && tsc && tsc->getSCE(SC_H_MINE) && tsc->getSCE(SC_H_MINE)->val2 == src->id) {
 				// Splash damage around it!
 				map_foreachinrange(skill_area_sub, bl, skill_get_splash(skill_id, skill_lv), BL_CHAR|BL_SKILL,
 					src, skill_id, skill_lv, tick, flag|BCT_ENEMY|1, skill_castend_damage_id);
 				flag |= 1; // Don't consume requirement
-				tsc->data[SC_H_MINE]->val3 = 1; // Mark the SC end because not expired
+				tsc->getSCE(SC_H_MINE)->val3 = 1; // Mark the SC end because not expired
 				status_change_end(bl, SC_H_MINE, INVALID_TIMER);
 				sc_start4(src, bl, SC_BURNING, 10 * skill_lv, skill_lv, 1000, src->id, 0, skill_get_time2(skill_id,skill_lv));
 			}
@@ -6159,7 +6159,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 	case RL_QD_SHOT:
 		if (skill_area_temp[1] == bl->id)
 			break;
-		if (flag&1 && tsc && tsc->data[SC_C_MARKER])
+		if (flag&1 && tsc && tsc->getSCE(SC_C_MARKER))
 			skill_attack(skill_get_type(skill_id), src, src, bl, skill_id, skill_lv, tick, flag|SD_ANIMATION);
 		break;
 	case RL_D_TAIL:
@@ -6167,7 +6167,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 		if (flag&1)
 			skill_attack(skill_get_type(skill_id), src, src, bl, skill_id, skill_lv, tick, flag|SD_ANIMATION);
 		else {
-			if (sd && tsc && tsc->data[SC_C_MARKER]) {
+			if (sd && tsc && tsc->getSCE(SC_C_MARKER)) {
 				int i;
 
 				ARR_FIND(0, MAX_SKILL_CRIMSON_MARKER, i, sd->c_marker[i] == bl->id);
@@ -6214,7 +6214,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 
 	case SJ_FALLINGSTAR_ATK:
 		if (sd) { // If a player used the skill it will search for targets marked by that player. 
-			if (tsc && tsc->data[SC_FLASHKICK] && tsc->data[SC_FLASHKICK]->val4 == 1) { // Mark placed by a player.
+			if (tsc && tsc->getSCE(SC_FLASHKICK) && tsc->getSCE(SC_FLASHKICK)->val4 == 1) { // Mark placed by a player.
 				int8 i = 0;
 
 				ARR_FIND(0, MAX_STELLAR_MARKS, i, sd->stellar_mark[i] == bl->id);
@@ -6223,7 +6223,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 					skill_castend_damage_id(src, bl, SJ_FALLINGSTAR_ATK2, skill_lv, tick, 0);
 				}
 			}
-		} else if ( tsc && tsc->data[SC_FLASHKICK] && tsc->data[SC_FLASHKICK]->val4 == 2 ) { // Mark placed by a monster.
+		} else if ( tsc && tsc->getSCE(SC_FLASHKICK) && tsc->getSCE(SC_FLASHKICK)->val4 == 2 ) { // Mark placed by a monster.
 			// If a monster used the skill it will search for targets marked by any monster since they can't track their own targets.
 			skill_attack(BF_WEAPON, src, src, bl, skill_id, skill_lv, tick, flag);
 			skill_castend_damage_id(src, bl, SJ_FALLINGSTAR_ATK2, skill_lv, tick, 0);
@@ -6242,7 +6242,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 			}
 
 			// Check if the target is already tagged by another source.
-			if ((tsd && tsd->sc.data[SC_FLASHKICK] && tsd->sc.data[SC_FLASHKICK]->val1 != src->id) || (tmd && tmd->sc.data[SC_FLASHKICK] && tmd->sc.data[SC_FLASHKICK]->val1 != src->id)) { // Same as the above check, but for monsters.
+			if ((tsd && tsd->sc.getSCE(SC_FLASHKICK) && tsd->sc.getSCE(SC_FLASHKICK)->val1 != src->id) || (tmd && tmd->sc.getSCE(SC_FLASHKICK) && tmd->sc.getSCE(SC_FLASHKICK)->val1 != src->id)) { // Same as the above check, but for monsters.
 				// Can't tag a player that was already tagged from another source.
 				if (sd)
 					clif_skill_fail(sd,skill_id, USESKILL_FAIL, 0);
@@ -6292,7 +6292,7 @@ int skill_castend_damage_id (struct block_list* src, struct block_list *bl, uint
 		return 1;
 	}
 
-	if( sc && sc->data[SC_CURSEDCIRCLE_ATKER] ) //Should only remove after the skill has been casted.
+	if( sc && sc->getSCE(SC_CURSEDCIRCLE_ATKER) ) //Should only remove after the skill has been casted.
 		status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 
 	map_freeblock_unlock();
@@ -6502,7 +6502,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 
 	type = status_skill2sc(skill_id);
 	tsc = status_get_sc(bl);
-	tsce = (tsc && type != -1)?tsc->data[type]:NULL;
+	tsce = (tsc && type != -1)?tsc->getSCE(type):NULL;
 
 	if (src!=bl && type > -1 &&
 		CHK_ELEMENT((i = skill_get_ele(skill_id, skill_lv))) && i > ELE_NEUTRAL &&
@@ -6523,8 +6523,8 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 				heal = 0;
 
 			if( tsc && tsc->count ) {
-				if( tsc->data[SC_KAITE] && !status_has_mode(sstatus,MD_STATUSIMMUNE) ) { //Bounce back heal
-					if (--tsc->data[SC_KAITE]->val2 <= 0)
+				if( tsc->getSCE(SC_KAITE) && !status_has_mode(sstatus,MD_STATUSIMMUNE) ) { //Bounce back heal
+					if (--tsc->getSCE(SC_KAITE)->val2 <= 0)
 						status_change_end(bl, SC_KAITE, INVALID_TIMER);
 					if (src == bl)
 						heal=0; //When you try to heal yourself under Kaite, the heal is voided.
@@ -6533,13 +6533,13 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 						dstsd = sd;
 					}
 				}
-				else if (tsc->data[SC_BERSERK] || tsc->data[SC_SATURDAYNIGHTFEVER])
+				else if (tsc->getSCE(SC_BERSERK) || tsc->getSCE(SC_SATURDAYNIGHTFEVER))
 					heal = 0; //Needed so that it actually displays 0 when healing.
 			}
 			if (skill_id == AL_HEAL)
 				status_change_end(bl, SC_BITESCAR, INVALID_TIMER);
 			clif_skill_nodamage (src, bl, skill_id, heal, 1);
-			if( tsc && tsc->data[SC_AKAITSUKI] && heal && skill_id != HLIF_HEAL )
+			if( tsc && tsc->getSCE(SC_AKAITSUKI) && heal && skill_id != HLIF_HEAL )
 				heal = ~heal + 1;
 			t_exp heal_get_jobexp = status_heal(bl,heal,0,0);
 
@@ -6591,7 +6591,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			break;
 		{
 			int per = 0, sper = 0;
-			if (tsc && tsc->data[SC_HELLPOWER]) {
+			if (tsc && tsc->getSCE(SC_HELLPOWER)) {
 				clif_skill_nodamage(src, bl, ALL_RESURRECTION, skill_lv, 1);
 				break;
 			}
@@ -6781,9 +6781,9 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			if( tsc && status_has_mode(&dstmd->status,MD_STATUSIMMUNE) ) {
 				const enum sc_type scs[] = { SC_QUAGMIRE, SC_PROVOKE, SC_ROKISWEIL, SC_GRAVITATION, SC_SUITON, SC_STRIPWEAPON, SC_STRIPSHIELD, SC_STRIPARMOR, SC_STRIPHELM, SC_BLADESTOP };
 				for (i = SC_COMMON_MIN; i <= SC_COMMON_MAX; i++)
-					if (tsc->data[i]) status_change_end(bl, (sc_type)i, INVALID_TIMER);
+					if (tsc->getSCE(i)) status_change_end(bl, (sc_type)i, INVALID_TIMER);
 				for (i = 0; i < ARRAYLENGTH(scs); i++)
-					if (tsc->data[scs[i]]) status_change_end(bl, scs[i], INVALID_TIMER);
+					if (tsc->getSCE(scs[i])) status_change_end(bl, scs[i], INVALID_TIMER);
 			}
 		}
 		break;
@@ -6825,7 +6825,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 
 	case CG_MARIONETTE:
 		{
-			if( (sd && dstsd && (dstsd->class_&MAPID_UPPERMASK) == MAPID_BARDDANCER && dstsd->status.sex == sd->status.sex) || (tsc && (tsc->data[SC_CURSE] || tsc->data[SC_QUAGMIRE])) )
+			if( (sd && dstsd && (dstsd->class_&MAPID_UPPERMASK) == MAPID_BARDDANCER && dstsd->status.sex == sd->status.sex) || (tsc && (tsc->getSCE(SC_CURSE) || tsc->getSCE(SC_QUAGMIRE))) )
 			{// Cannot cast on another bard/dancer-type class of the same gender as caster, or targets under Curse/Quagmire
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
 				map_freeblock_unlock();
@@ -6836,15 +6836,15 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 
 			if( sc && tsc )
 			{
-				if( !sc->data[SC_MARIONETTE] && !tsc->data[SC_MARIONETTE2] )
+				if( !sc->getSCE(SC_MARIONETTE) && !tsc->getSCE(SC_MARIONETTE2) )
 				{
 					sc_start(src,src,SC_MARIONETTE,100,bl->id,skill_get_time(skill_id,skill_lv));
 					sc_start(src,bl,SC_MARIONETTE2,100,src->id,skill_get_time(skill_id,skill_lv));
 					clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
 				}
 				else
-				if(  sc->data[SC_MARIONETTE ] &&  sc->data[SC_MARIONETTE ]->val1 == bl->id &&
-					tsc->data[SC_MARIONETTE2] && tsc->data[SC_MARIONETTE2]->val1 == src->id )
+				if(  sc->getSCE(SC_MARIONETTE ) &&  sc->getSCE(SC_MARIONETTE )->val1 == bl->id &&
+					tsc->getSCE(SC_MARIONETTE2) && tsc->getSCE(SC_MARIONETTE2)->val1 == src->id )
 				{
 					status_change_end(src, SC_MARIONETTE, INVALID_TIMER);
 					status_change_end(bl, SC_MARIONETTE2, INVALID_TIMER);
@@ -6959,7 +6959,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 	case AL_BLESSING:
 	case MER_INCAGI:
 	case MER_BLESSING:
-		if (dstsd != NULL && tsc->data[SC_CHANGEUNDEAD]) {
+		if (dstsd != NULL && tsc->getSCE(SC_CHANGEUNDEAD)) {
 			skill_attack(BF_MISC,src,src,bl,skill_id,skill_lv,tick,flag);
 			break;
 		}
@@ -7170,13 +7170,13 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 
 	case AS_ENCHANTPOISON: // Prevent spamming [Valaris]
 		if (sd && dstsd && dstsd->sc.count) {
-			if (dstsd->sc.data[SC_FIREWEAPON] ||
-				dstsd->sc.data[SC_WATERWEAPON] ||
-				dstsd->sc.data[SC_WINDWEAPON] ||
-				dstsd->sc.data[SC_EARTHWEAPON] ||
-				dstsd->sc.data[SC_SHADOWWEAPON] ||
-				dstsd->sc.data[SC_GHOSTWEAPON]
-			//	dstsd->sc.data[SC_ENCPOISON] //People say you should be able to recast to lengthen the timer. [Skotlex]
+			if (dstsd->sc.getSCE(SC_FIREWEAPON) ||
+				dstsd->sc.getSCE(SC_WATERWEAPON) ||
+				dstsd->sc.getSCE(SC_WINDWEAPON) ||
+				dstsd->sc.getSCE(SC_EARTHWEAPON) ||
+				dstsd->sc.getSCE(SC_SHADOWWEAPON) ||
+				dstsd->sc.getSCE(SC_GHOSTWEAPON)
+			//	dstsd->sc.getSCE(SC_ENCPOISON) //People say you should be able to recast to lengthen the timer. [Skotlex]
 			) {
 					clif_skill_nodamage(src,bl,skill_id,skill_lv,0);
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
@@ -7258,7 +7258,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 		if( tsc && tsc->count )
 		{
 			status_change_end(bl, SC_FREEZE, INVALID_TIMER);
-			if( tsc->data[SC_STONE] && tsc->opt1 == OPT1_STONE )
+			if( tsc->getSCE(SC_STONE) && tsc->opt1 == OPT1_STONE )
 				status_change_end(bl, SC_STONE, INVALID_TIMER);
 			status_change_end(bl, SC_SLEEP, INVALID_TIMER);
 			status_change_end(bl, SC_TRICKDEAD, INVALID_TIMER);
@@ -7285,10 +7285,10 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			if( (lv = status_get_lv(src) - dstsd->status.base_level) < 0 )
 				lv = -lv;
 			if( lv > battle_config.devotion_level_difference || // Level difference requeriments
-				(dstsd->sc.data[type] && dstsd->sc.data[type]->val1 != src->id) || // Cannot Devote a player devoted from another source
+				(dstsd->sc.getSCE(type) && dstsd->sc.getSCE(type)->val1 != src->id) || // Cannot Devote a player devoted from another source
 				(skill_id == ML_DEVOTION && (!mer || mer != dstsd->md)) || // Mercenary only can devote owner
 				(dstsd->class_&MAPID_UPPERMASK) == MAPID_CRUSADER || // Crusader Cannot be devoted
-				(dstsd->sc.data[SC_HELLPOWER])) // Players affected by SC_HELLPOWER cannot be devoted.
+				(dstsd->sc.getSCE(SC_HELLPOWER))) // Players affected by SC_HELLPOWER cannot be devoted.
 			{
 				if( sd )
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
@@ -7333,7 +7333,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 					break;
 				}
 
-				if (dstsd->sc.data[type] && dstsd->sc.data[type]->val2 != src->id) { // Fail if a player is in unity with another source.
+				if (dstsd->sc.getSCE(type) && dstsd->sc.getSCE(type)->val2 != src->id) { // Fail if a player is in unity with another source.
 					if (sd)
 						clif_skill_fail(sd, skill_id, USESKILL_FAIL, 0);
 					map_freeblock_unlock();
@@ -7365,8 +7365,8 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 	case MO_CALLSPIRITS:
 		if(sd) {
 			int limit = skill_lv;
-			if( sd->sc.data[SC_RAISINGDRAGON] )
-				limit += sd->sc.data[SC_RAISINGDRAGON]->val1;
+			if( sd->sc.getSCE(SC_RAISINGDRAGON) )
+				limit += sd->sc.getSCE(SC_RAISINGDRAGON)->val1;
 			clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
 			pc_addspiritball(sd,skill_get_time(skill_id,skill_lv),limit);
 		}
@@ -7375,8 +7375,8 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 	case CH_SOULCOLLECT:
 		if(sd) {
 			int limit = 5;
-			if( sd->sc.data[SC_RAISINGDRAGON] )
-				limit += sd->sc.data[SC_RAISINGDRAGON]->val1;
+			if( sd->sc.getSCE(SC_RAISINGDRAGON) )
+				limit += sd->sc.getSCE(SC_RAISINGDRAGON)->val1;
 			clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
 			for (i = 0; i < limit; i++)
 				pc_addspiritball(sd,skill_get_time(skill_id,skill_lv),limit);
@@ -7501,7 +7501,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			} else
 				sc_start(src, bl, type, 100, skill_lv, skill_get_time(skill_id, skill_lv));
 		}
-		if (skill_id == SJ_STAREMPEROR && sc && sc->data[SC_DIMENSION]) {
+		if (skill_id == SJ_STAREMPEROR && sc && sc->getSCE(SC_DIMENSION)) {
 			if (sd) {
 				// Remove old shields if any exist.
 				pc_delspiritball(sd, sd->spiritball, 0);
@@ -7714,12 +7714,12 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 	case SP_KAUTE:
 		if (sd) {
 			if (!dstsd || !(
-				(sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_SOULLINKER) ||
+				(sd->sc.getSCE(SC_SPIRIT) && sd->sc.getSCE(SC_SPIRIT)->val2 == SL_SOULLINKER) ||
 				(dstsd->class_&MAPID_UPPERMASK) == MAPID_SOUL_LINKER ||
 				dstsd->status.char_id == sd->status.char_id ||
 				dstsd->status.char_id == sd->status.partner_id ||
 				dstsd->status.char_id == sd->status.child ||
-				(skill_id == SP_KAUTE && dstsd->sc.data[SC_SOULUNITY])
+				(skill_id == SP_KAUTE && dstsd->sc.getSCE(SC_SOULUNITY))
 			)) {
 				status_change_start(src,src,SC_STUN,10000,skill_lv,0,0,0,500,SCSTART_NORATEDEF);
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
@@ -7791,7 +7791,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 		break;
 
 	case CG_SPECIALSINGER:
-		if (tsc && tsc->data[SC_ENSEMBLEFATIGUE]) {
+		if (tsc && tsc->getSCE(SC_ENSEMBLEFATIGUE)) {
 			clif_skill_nodamage(src, bl, skill_id, skill_lv, 1);
 			status_change_end(bl, SC_ENSEMBLEFATIGUE, INVALID_TIMER);
 		}
@@ -7802,7 +7802,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 		clif_skill_nodamage(src, bl, skill_id, skill_lv, 1);
 		sc_start(src, bl, type, 100, skill_lv, skill_get_time(skill_id, skill_lv));
 #else
-		if(tsc && tsc->data[SC_DANCING]){
+		if(tsc && tsc->getSCE(SC_DANCING)){
 			clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
 			status_change_end(bl, SC_DANCING, INVALID_TIMER);
 		}
@@ -7901,10 +7901,10 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			if(status_isimmune(bl) || !tsc)
 				break;
 
-			if (sd && sd->sc.data[SC_PETROLOGY_OPTION])
-				brate = sd->sc.data[SC_PETROLOGY_OPTION]->val3;
+			if (sd && sd->sc.getSCE(SC_PETROLOGY_OPTION))
+				brate = sd->sc.getSCE(SC_PETROLOGY_OPTION)->val3;
 
-			if (tsc && tsc->data[type]) {
+			if (tsc && tsc->getSCE(type)) {
 				status_change_end(bl, type, INVALID_TIMER);
 				if (sd) clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
 				break;
@@ -8166,7 +8166,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 		bool i;
 
 		//Special message when trying to use strip on FCP [Jobbie]
-		if( sd && skill_id == ST_FULLSTRIP && tsc && tsc->data[SC_CP_WEAPON] && tsc->data[SC_CP_HELM] && tsc->data[SC_CP_ARMOR] && tsc->data[SC_CP_SHIELD])
+		if( sd && skill_id == ST_FULLSTRIP && tsc && tsc->getSCE(SC_CP_WEAPON) && tsc->getSCE(SC_CP_HELM) && tsc->getSCE(SC_CP_ARMOR) && tsc->getSCE(SC_CP_SHIELD))
 		{
 			clif_gospel_info(sd, 0x28);
 			break;
@@ -8216,7 +8216,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 				potion_target = bl->id;
 				run_script(sd->inventory_data[j]->script,0,sd->bl.id,0);
 				potion_flag = potion_target = 0;
-				if( sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_ALCHEMIST )
+				if( sd->sc.getSCE(SC_SPIRIT) && sd->sc.getSCE(SC_SPIRIT)->val2 == SL_ALCHEMIST )
 					bonus += sd->status.base_level;
 				if( potion_per_hp > 0 || potion_per_sp > 0 ) {
 					hp = tstatus->max_hp * potion_per_hp / 100;
@@ -8272,15 +8272,15 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			if (tsc && tsc->count) {
 				uint8 penalty = 0;
 
-				if (tsc->data[SC_WATER_INSIGNIA] && tsc->data[SC_WATER_INSIGNIA]->val1 == 2) {
+				if (tsc->getSCE(SC_WATER_INSIGNIA) && tsc->getSCE(SC_WATER_INSIGNIA)->val1 == 2) {
 					hp += hp / 10;
 					sp += sp / 10;
 				}
-				if (tsc->data[SC_CRITICALWOUND])
-					penalty += tsc->data[SC_CRITICALWOUND]->val2;
-				if (tsc->data[SC_DEATHHURT] && tsc->data[SC_DEATHHURT]->val3)
+				if (tsc->getSCE(SC_CRITICALWOUND))
+					penalty += tsc->getSCE(SC_CRITICALWOUND)->val2;
+				if (tsc->getSCE(SC_DEATHHURT) && tsc->getSCE(SC_DEATHHURT)->val3)
 					penalty += 20;
-				if (tsc->data[SC_NORECOVER_STATE])
+				if (tsc->getSCE(SC_NORECOVER_STATE))
 					penalty = 100;
 				if (penalty > 0) {
 					hp -= hp * penalty / 100;
@@ -8300,10 +8300,10 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 				clif_skill_nodamage(NULL,bl,MG_SRECOVERY,sp,1);
 			if (tsc) {
 #ifdef RENEWAL
-				if (tsc->data[SC_EXTREMITYFIST2])
+				if (tsc->getSCE(SC_EXTREMITYFIST2))
 					sp = 0;
 #endif
-				if (tsc->data[SC_NORECOVER_STATE]) {
+				if (tsc->getSCE(SC_NORECOVER_STATE)) {
 					hp = 0;
 					sp = 0;
 				}
@@ -8370,7 +8370,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 				break; // Outside PvP it should only affect party members and no skill fail message
 			clif_skill_nodamage(src,bl,skill_id,skill_lv,1);
 			if((dstsd && (dstsd->class_&MAPID_UPPERMASK) == MAPID_SOUL_LINKER)
-				|| (tsc && tsc->data[SC_SPIRIT] && tsc->data[SC_SPIRIT]->val2 == SL_ROGUE) //Rogue's spirit defends againt dispel.
+				|| (tsc && tsc->getSCE(SC_SPIRIT) && tsc->getSCE(SC_SPIRIT)->val2 == SL_ROGUE) //Rogue's spirit defends againt dispel.
 				|| rnd()%100 >= 50+10*skill_lv)
 			{
 				if (sd)
@@ -8388,7 +8388,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 				break;
 
 			for(i=0;i<SC_MAX;i++) {
-				if (!tsc->data[i])
+				if (!tsc->getSCE(i))
 					continue;
 				switch (i) {
 					case SC_WEIGHT50:		case SC_WEIGHT90:		case SC_HALLUCINATION:
@@ -8492,7 +8492,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 					case SC_DONTFORGETME:
 					case SC_FORTUNE:
 					case SC_SERVICE4U:
-						if (!battle_config.dispel_song || tsc->data[i]->val4 == 0)
+						if (!battle_config.dispel_song || tsc->getSCE(i)->val4 == 0)
 							continue; //If in song area don't end it, even if config enabled
 						break;
 					case SC_ASSUMPTIO:
@@ -8500,7 +8500,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 							continue;
 						break;
 				}
-				if(i == SC_BERSERK) tsc->data[i]->val2=0; //Mark a dispelled berserk to avoid setting hp to 100 by setting hp penalty to 0.
+				if(i == SC_BERSERK) tsc->getSCE(i)->val2=0; //Mark a dispelled berserk to avoid setting hp to 100 by setting hp penalty to 0.
 				status_change_end(bl, (sc_type)i, INVALID_TIMER);
 			}
 			break;
@@ -8576,9 +8576,9 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 	case SA_SPELLBREAKER:
 		{
 			int sp;
-			if(tsc && tsc->data[SC_MAGICROD]) {
+			if(tsc && tsc->getSCE(SC_MAGICROD)) {
 				sp = skill_get_sp(skill_id,skill_lv);
-				sp = sp * tsc->data[SC_MAGICROD]->val2 / 100;
+				sp = sp * tsc->getSCE(SC_MAGICROD)->val2 / 100;
 				if(sp < 1) sp = 1;
 				status_heal(bl,0,sp,2);
 				status_percent_damage(bl, src, 0, -20, false); //20% max SP damage.
@@ -8633,7 +8633,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 
 			if(skill_lv >= 10) {
 				spellid = MG_FROSTDIVER;
-//				if (tsc && tsc->data[SC_SPIRIT] && tsc->data[SC_SPIRIT]->val2 == SA_SAGE)
+//				if (tsc && tsc->getSCE(SC_SPIRIT) && tsc->getSCE(SC_SPIRIT)->val2 == SA_SAGE)
 //					maxlv = 10;
 //				else
 					maxlv = skill_lv - 9;
@@ -8925,7 +8925,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 
 				if (battle_check_undead(tstatus->race, tstatus->def_ele))
 					break;
-				if (tsc && tsc->data[SC_HELLPOWER])
+				if (tsc && tsc->getSCE(SC_HELLPOWER))
 					break;
 				if (map_getmapflag(bl->m, MF_PVP) && dstsd->pvp_point < 0)
 					break;
@@ -9101,7 +9101,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 
 			if(tsc && tsc->count){
 				status_change_end(bl, SC_FREEZE, INVALID_TIMER);
-				if(tsc->data[SC_STONE] && tsc->opt1 == OPT1_STONE)
+				if(tsc->getSCE(SC_STONE) && tsc->opt1 == OPT1_STONE)
 					status_change_end(bl, SC_STONE, INVALID_TIMER);
 				status_change_end(bl, SC_SLEEP, INVALID_TIMER);
 			}
@@ -9130,10 +9130,10 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 #ifdef	RENEWAL
 			sp1 = sp1 / 2;
 			sp2 = sp2 / 2;
-			if (tsc && tsc->data[SC_EXTREMITYFIST2])
+			if (tsc && tsc->getSCE(SC_EXTREMITYFIST2))
 				sp1 = tstatus->sp;
 #endif
-			if (tsc && tsc->data[SC_NORECOVER_STATE])
+			if (tsc && tsc->getSCE(SC_NORECOVER_STATE))
 				sp1 = tstatus->sp;
 			status_set_sp(src, sp2, 3);
 			status_set_sp(bl, sp1, 3);
@@ -9159,15 +9159,15 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			if (tsc && tsc->count) {
 				uint8 penalty = 0;
 
-				if (tsc->data[SC_WATER_INSIGNIA] && tsc->data[SC_WATER_INSIGNIA]->val1 == 2) {
+				if (tsc->getSCE(SC_WATER_INSIGNIA) && tsc->getSCE(SC_WATER_INSIGNIA)->val1 == 2) {
 					hp += hp / 10;
 					sp += sp / 10;
 				}
-				if (tsc->data[SC_CRITICALWOUND])
-					penalty += tsc->data[SC_CRITICALWOUND]->val2;
-				if (tsc->data[SC_DEATHHURT] && tsc->data[SC_DEATHHURT]->val3 == 1)
+				if (tsc->getSCE(SC_CRITICALWOUND))
+					penalty += tsc->getSCE(SC_CRITICALWOUND)->val2;
+				if (tsc->getSCE(SC_DEATHHURT) && tsc->getSCE(SC_DEATHHURT)->val3 == 1)
 					penalty += 20;
-				if (tsc->data[SC_NORECOVER_STATE])
+				if (tsc->getSCE(SC_NORECOVER_STATE))
 					penalty = 100;
 				if (penalty > 0) {
 					hp -= hp * penalty / 100;
@@ -9209,7 +9209,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 #ifndef RENEWAL
 	case CG_LONGINGFREEDOM:
 		{
-			if (tsc && !tsce && (tsce=tsc->data[SC_DANCING]) && tsce->val4
+			if (tsc && !tsce && (tsce=tsc->getSCE(SC_DANCING)) && tsce->val4
 				&& (tsce->val1&0xFFFF) != CG_MOONLIT) //Can't use Longing for Freedom while under Moonlight Petals. [Skotlex]
 			{
 				clif_skill_nodamage(src,bl,skill_id,skill_lv,
@@ -9222,14 +9222,14 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 	case CG_TAROTCARD:
 		{
 			int card = -1;
-			if (tsc && tsc->data[SC_TAROTCARD]) {
+			if (tsc && tsc->getSCE(SC_TAROTCARD)) {
 				//Target currently has the SUN tarot card effect and is immune to any other effect
 				map_freeblock_unlock();
 				return 0;
 			}
 			if( rnd() % 100 > skill_lv * 8 ||
 #ifndef RENEWAL
-			(tsc && tsc->data[SC_BASILICA]) ||
+			(tsc && tsc->getSCE(SC_BASILICA)) ||
 #endif
 			(dstmd && ((dstmd->guardian_data && dstmd->mob_id == MOBID_EMPERIUM) || status_get_class_(bl) == CLASS_BATTLEFIELD)) ) {
 				if( sd )
@@ -9260,7 +9260,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 	case SL_STAR:
 	case SL_SUPERNOVICE:
 	case SL_WIZARD:
-		if (sd && tsc && (tsc->data[SC_SOULGOLEM] || tsc->data[SC_SOULSHADOW] || tsc->data[SC_SOULFALCON] || tsc->data[SC_SOULFAIRY])) { // Soul links from Soul Linker and Soul Reaper skills don't stack.
+		if (sd && tsc && (tsc->getSCE(SC_SOULGOLEM) || tsc->getSCE(SC_SOULSHADOW) || tsc->getSCE(SC_SOULFALCON) || tsc->getSCE(SC_SOULFAIRY))) { // Soul links from Soul Linker and Soul Reaper skills don't stack.
 			clif_skill_fail(sd, skill_id, USESKILL_FAIL,0);
 			break;
 		}
@@ -9280,7 +9280,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 		sc_start(src,src,SC_SMA,100,skill_lv,skill_get_time(SL_SMA,skill_lv));
 		break;
 	case SL_HIGH:
-		if (sd && tsc && (tsc->data[SC_SOULGOLEM] || tsc->data[SC_SOULSHADOW] || tsc->data[SC_SOULFALCON] || tsc->data[SC_SOULFAIRY])) { // Soul links from Soul Linker and Soul Reaper skills don't stack.
+		if (sd && tsc && (tsc->getSCE(SC_SOULGOLEM) || tsc->getSCE(SC_SOULSHADOW) || tsc->getSCE(SC_SOULFALCON) || tsc->getSCE(SC_SOULFAIRY))) { // Soul links from Soul Linker and Soul Reaper skills don't stack.
 			clif_skill_fail(sd, skill_id, USESKILL_FAIL,0);
 			break;
 		}
@@ -9301,10 +9301,10 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			break;
 		}
 		if (tsc) {
-			if (tsc->data[status_skill2sc(skill_id)]) { // Allow refreshing an already active soul link.
+			if (tsc->getSCE(status_skill2sc(skill_id))) { // Allow refreshing an already active soul link.
 				clif_skill_nodamage(src, bl, skill_id, skill_lv, sc_start(src, bl, type, 100, skill_lv, skill_get_time(skill_id, skill_lv)));
 				break;
-			} else if (tsc->data[SC_SPIRIT] || tsc->data[SC_SOULGOLEM] || tsc->data[SC_SOULSHADOW] || tsc->data[SC_SOULFALCON] || tsc->data[SC_SOULFAIRY]) { // Soul links from Soul Linker and Soul Reaper skills don't stack.
+			} else if (tsc->getSCE(SC_SPIRIT) || tsc->getSCE(SC_SOULGOLEM) || tsc->getSCE(SC_SOULSHADOW) || tsc->getSCE(SC_SOULFALCON) || tsc->getSCE(SC_SOULFAIRY)) { // Soul links from Soul Linker and Soul Reaper skills don't stack.
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL, 0);
 				break;
 			}
@@ -9313,7 +9313,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 		break;
 
 	case SP_SOULREVOLVE:
-		if (!(tsc && (tsc->data[SC_SPIRIT] || tsc->data[SC_SOULGOLEM] || tsc->data[SC_SOULSHADOW] || tsc->data[SC_SOULFALCON] || tsc->data[SC_SOULFAIRY]))) {
+		if (!(tsc && (tsc->getSCE(SC_SPIRIT) || tsc->getSCE(SC_SOULGOLEM) || tsc->getSCE(SC_SOULSHADOW) || tsc->getSCE(SC_SOULFALCON) || tsc->getSCE(SC_SOULFAIRY)))) {
 			if (sd)
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL, 0);
 			break;
@@ -9734,9 +9734,9 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			short count = 1;
 			skill_area_temp[2] = 0;
 			map_foreachinrange(skill_area_sub,src,skill_get_splash(skill_id,skill_lv),BL_CHAR,src,skill_id,skill_lv,tick,flag|BCT_ENEMY|SD_PREAMBLE|SD_SPLASH|1,skill_castend_damage_id);
-			if( tsc && tsc->data[SC_ROLLINGCUTTER] )
+			if( tsc && tsc->getSCE(SC_ROLLINGCUTTER) )
 			{ // Every time the skill is casted the status change is reseted adding a counter.
-				count += (short)tsc->data[SC_ROLLINGCUTTER]->val1;
+				count += (short)tsc->getSCE(SC_ROLLINGCUTTER)->val1;
 				if( count > 10 )
 					count = 10; // Max coounter
 				status_change_end(bl, SC_ROLLINGCUTTER, INVALID_TIMER);
@@ -9747,7 +9747,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 		break;
 
 	case GC_WEAPONBLOCKING:
-		if( tsc && tsc->data[SC_WEAPONBLOCKING] )
+		if( tsc && tsc->getSCE(SC_WEAPONBLOCKING) )
 			status_change_end(bl, SC_WEAPONBLOCKING, INVALID_TIMER);
 		else
 			sc_start(src,bl,SC_WEAPONBLOCKING,100,skill_lv,skill_get_time(skill_id,skill_lv));
@@ -9840,7 +9840,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 
 	case AB_CHEAL:
 		if( !sd || sd->status.party_id == 0 || flag&1 ) {
-			if( sd && tstatus && !battle_check_undead(tstatus->race, tstatus->def_ele) && !tsc->data[SC_BERSERK] ) {
+			if( sd && tstatus && !battle_check_undead(tstatus->race, tstatus->def_ele) && !tsc->getSCE(SC_BERSERK) ) {
 				int partycount = (sd->status.party_id ? party_foreachsamemap(party_sub_count, sd, 0) : 0);
 
 				i = skill_calc_heal(src, bl, AL_HEAL, pc_checkskill(sd, AL_HEAL), true);
@@ -9851,7 +9851,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 					i = 0; // Should heal by 0 or won't do anything?? in iRO it breaks the healing to members.. [malufett]
 
 				clif_skill_nodamage(src, bl, skill_id, i, 1);
-				if( tsc && tsc->data[SC_AKAITSUKI] && i )
+				if( tsc && tsc->getSCE(SC_AKAITSUKI) && i )
 					i = ~i + 1;
 				status_heal(bl, i, 0, 0);
 			}
@@ -9871,8 +9871,8 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 
 	case AB_LAUDAAGNUS:
 		if( flag&1 || !sd || !sd->status.party_id ) {
-			if( tsc && (tsc->data[SC_FREEZE] || tsc->data[SC_STONE] || tsc->data[SC_BLIND] ||
-				tsc->data[SC_BURNING] || tsc->data[SC_FREEZING] || tsc->data[SC_CRYSTALIZE])) {
+			if( tsc && (tsc->getSCE(SC_FREEZE) || tsc->getSCE(SC_STONE) || tsc->getSCE(SC_BLIND) ||
+				tsc->getSCE(SC_BURNING) || tsc->getSCE(SC_FREEZING) || tsc->getSCE(SC_CRYSTALIZE))) {
 				// Success Chance: (60 + 10 * Skill Level) %
 				if( rnd()%100 > 60+10*skill_lv ) break;
 				status_change_end(bl, SC_FREEZE, INVALID_TIMER);
@@ -9891,7 +9891,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 
 	case AB_LAUDARAMUS:
 		if( flag&1 || !sd || !sd->status.party_id ) {
-			if( tsc && (tsc->data[SC_SLEEP] || tsc->data[SC_STUN] || tsc->data[SC_MANDRAGORA] || tsc->data[SC_SILENCE] || tsc->data[SC_DEEPSLEEP]) ){
+			if( tsc && (tsc->getSCE(SC_SLEEP) || tsc->getSCE(SC_STUN) || tsc->getSCE(SC_MANDRAGORA) || tsc->getSCE(SC_SILENCE) || tsc->getSCE(SC_DEEPSLEEP)) ){
 				// Success Chance: (60 + 10 * Skill Level) %
 				if( rnd()%100 > 60+10*skill_lv )  break;
 				status_change_end(bl, SC_SLEEP, INVALID_TIMER);
@@ -9931,7 +9931,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			if(!tsc || !tsc->count)
 				break;
 			for( i = 0; i < SC_MAX; i++ ) {
-				if (!tsc->data[i])
+				if (!tsc->getSCE(i))
 					continue;
 				switch (i) {
 					case SC_WEIGHT50:		case SC_WEIGHT90:		case SC_HALLUCINATION:
@@ -10024,7 +10024,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 						continue;
 					break;
 				}
-				if(i == SC_BERSERK) tsc->data[i]->val2=0; //Mark a dispelled berserk to avoid setting hp to 100 by setting hp penalty to 0.
+				if(i == SC_BERSERK) tsc->getSCE(i)->val2=0; //Mark a dispelled berserk to avoid setting hp to 100 by setting hp penalty to 0.
 				status_change_end(bl,(sc_type)i,INVALID_TIMER);
 			}
 			break;
@@ -10067,7 +10067,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			if( sd )
 				skill_blockpc_start(sd,skill_id,4000);
 
-			if( !(tsc && tsc->data[type]) ){
+			if( !(tsc && tsc->getSCE(type)) ){
 				i = sc_start2(src,bl,type,rate,skill_lv,src->id,(src == bl)?5000:(bl->type == BL_PC)?skill_get_time(skill_id,skill_lv):skill_get_time2(skill_id, skill_lv));
 				clif_skill_nodamage(src,bl,skill_id,skill_lv,i);
 				if( !i )
@@ -10091,7 +10091,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			if( bl->id == skill_area_temp[1] )
 				break; // Already work on this target
 
-			if( tsc && tsc->data[type] )
+			if( tsc && tsc->getSCE(type) )
 				status_change_end(bl,type,INVALID_TIMER);
 			else
 				status_change_start(src,bl,type,10000,skill_lv,src->id,0,0,skill_get_time(skill_id, skill_lv),SCSTART_NOTICKDEF);
@@ -10099,7 +10099,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			int rate = 45 + 5 * skill_lv + ( sd? sd->status.job_level : 50 ) / 4;
 			// IroWiki says Rate should be reduced by target stats, but currently unknown
 			if( rnd()%100 < rate ) { // Success on First Target
-				if( !tsc->data[type] )
+				if( !tsc->getSCE(type) )
 					rate = status_change_start(src,bl,type,10000,skill_lv,src->id,0,0,skill_get_time(skill_id, skill_lv),SCSTART_NOTICKDEF);
 				else {
 					rate = 1;
@@ -10149,7 +10149,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 				sc_type sphere = SC_NONE;
 
 				for (i = SC_SPHERE_1; i <= SC_SPHERE_5; i++) {
-					if (sc->data[i] == nullptr) {
+					if (sc->getSCE(i) == nullptr) {
 						sphere = static_cast<sc_type>(i); // Take the free SC
 						break;
 					}
@@ -10338,13 +10338,13 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 
 	case SC_BODYPAINT:
 		if( flag&1 ) {
-			if (tsc && ((tsc->option&(OPTION_HIDE|OPTION_CLOAK)) || tsc->data[SC_CAMOUFLAGE] || tsc->data[SC_STEALTHFIELD])) {
+			if (tsc && ((tsc->option&(OPTION_HIDE|OPTION_CLOAK)) || tsc->getSCE(SC_CAMOUFLAGE) || tsc->getSCE(SC_STEALTHFIELD))) {
 				status_change_end(bl,SC_HIDING,INVALID_TIMER);
 				status_change_end(bl,SC_CLOAKING,INVALID_TIMER);
 				status_change_end(bl,SC_CLOAKINGEXCEED,INVALID_TIMER);
 				status_change_end(bl,SC_CAMOUFLAGE,INVALID_TIMER);
 				status_change_end(bl,SC_NEWMOON,INVALID_TIMER);
-				if (tsc && tsc->data[SC__SHADOWFORM] && rnd() % 100 < 100 - tsc->data[SC__SHADOWFORM]->val1 * 10) // [100 - (Skill Level x 10)] %
+				if (tsc && tsc->getSCE(SC__SHADOWFORM) && rnd() % 100 < 100 - tsc->getSCE(SC__SHADOWFORM)->val1 * 10) // [100 - (Skill Level x 10)] %
 					status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 			}
 			// Attack Speed decrease and Blind happen to everyone around caster, not just hidden targets.
@@ -10362,7 +10362,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 	case SC_LAZINESS:
 	case SC_UNLUCKY:
 	case SC_WEAKNESS:
-		if( !(tsc && tsc->data[type]) ) {
+		if( !(tsc && tsc->getSCE(type)) ) {
 			int rate;
 
 			if (status_get_class_(bl) == CLASS_BOSS)
@@ -10376,7 +10376,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 		break;
 
 	case SC_IGNORANCE:
-		if( !(tsc && tsc->data[type]) ) {
+		if( !(tsc && tsc->getSCE(type)) ) {
 			int rate;
 
 			if (status_get_class_(bl) == CLASS_BOSS)
@@ -10407,7 +10407,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 		break;
 
 	case LG_REFLECTDAMAGE:
-		if( tsc && tsc->data[type] )
+		if( tsc && tsc->getSCE(type) )
 			status_change_end(bl,type,INVALID_TIMER);
 		else
 			sc_start(src,bl,type,100,skill_lv,skill_get_time(skill_id,skill_lv));
@@ -10613,7 +10613,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 	case WM_UNLIMITED_HUMMING_VOICE:
 		if( flag&1 ) {	// These affect to to all party members near the caster.
 			struct status_change *sc = status_get_sc(src);
-			if( sc && sc->data[type] ) {
+			if( sc && sc->getSCE(type) ) {
 				sc_start2(src,bl,type,100,skill_lv,pc_checkskill(sd, WM_LESSON),skill_get_time(skill_id,skill_lv));
 			}
 		} else if( sd ) {
@@ -10884,7 +10884,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 
 			if (rate < 10)
 				rate = 10;
-			if (bl->type == BL_MOB || (tsc && tsc->data[type]))
+			if (bl->type == BL_MOB || (tsc && tsc->getSCE(type)))
 				break; // Don't activate if target is a monster or zap SP if target already has Mandragora active.
 			if (rnd()%100 < rate) {
 				sc_start(src,bl,type,100,skill_lv,skill_get_time(skill_id,skill_lv));
@@ -10986,7 +10986,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 				sc_type type2 = (sc_type)(type-1);
 				struct status_change *sc = status_get_sc(&ele->bl);
 
-				if( (sc && sc->data[type2]) || (tsc && tsc->data[type]) ) {
+				if( (sc && sc->getSCE(type2)) || (tsc && tsc->getSCE(type)) ) {
 					elemental_clean_single_effect(ele, skill_id);
 				} else {
 					clif_skill_nodamage(src,src,skill_id,skill_lv,1);
@@ -11013,7 +11013,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 				sc_type type2 = (sc_type)(type-1);
 
 				clif_skill_nodamage(src,src,skill_id,skill_lv,1);
-				if( (sc && sc->data[type2]) || (tsc && tsc->data[type]) ) {
+				if( (sc && sc->getSCE(type2)) || (tsc && tsc->getSCE(type)) ) {
 					elemental_clean_single_effect(ele, skill_id);
 				} else {
 					// This not heals at the end.
@@ -11055,14 +11055,14 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 		}
 		break;
 	case KO_KYOUGAKU:
-		if( dstsd && tsc && !tsc->data[type] && rnd()%100 < tstatus->int_/2 ){
+		if( dstsd && tsc && !tsc->getSCE(type) && rnd()%100 < tstatus->int_/2 ){
 			clif_skill_nodamage(src,bl,skill_id,skill_lv,
 				sc_start(src,bl,type,100,skill_lv,skill_get_time(skill_id,skill_lv)));
 		}else if( sd )
 			clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
 		break;
 	case KO_JYUSATSU:
-		if( dstsd && tsc && !tsc->data[type] &&
+		if( dstsd && tsc && !tsc->getSCE(type) &&
 			rnd()%100 < ((45+5*skill_lv) + skill_lv*5 - status_get_int(bl)/2) ){//[(Base chance of success) + (Skill Level x 5) - (int / 2)]%.
 			clif_skill_nodamage(src,bl,skill_id,skill_lv,
 				status_change_start(src,bl,type,10000,skill_lv,0,0,0,skill_get_time(skill_id,skill_lv),SCSTART_NOAVOID|SCSTART_NOTICKDEF));
@@ -11125,13 +11125,13 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 		if( flag&1 ){
 			if (bl->type != BL_PC)
 				break;
-			if (tsc && (tsc->option & (OPTION_CLOAK | OPTION_HIDE) || tsc->data[SC_CAMOUFLAGE] || tsc->data[SC__SHADOWFORM] || tsc->data[SC_MARIONETTE] || tsc->data[SC_HARMONIZE])) {
+			if (tsc && (tsc->option & (OPTION_CLOAK | OPTION_HIDE) || tsc->getSCE(SC_CAMOUFLAGE) || tsc->getSCE(SC__SHADOWFORM) || tsc->getSCE(SC_MARIONETTE) || tsc->getSCE(SC_HARMONIZE))) {
 					status_change_end(bl, SC_HIDING, INVALID_TIMER);
 					status_change_end(bl, SC_CLOAKING, INVALID_TIMER);
 					status_change_end(bl, SC_CLOAKINGEXCEED, INVALID_TIMER);
 					status_change_end(bl, SC_CAMOUFLAGE, INVALID_TIMER);
 					status_change_end(bl, SC_NEWMOON, INVALID_TIMER);
-					if (tsc && tsc->data[SC__SHADOWFORM] && rnd() % 100 < 100 - tsc->data[SC__SHADOWFORM]->val1 * 10) // [100 - (Skill Level x 10)] %
+					if (tsc && tsc->getSCE(SC__SHADOWFORM) && rnd() % 100 < 100 - tsc->getSCE(SC__SHADOWFORM)->val1 * 10) // [100 - (Skill Level x 10)] %
 						status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 					status_change_end(bl, SC_MARIONETTE, INVALID_TIMER);
 					status_change_end(bl, SC_HARMONIZE, INVALID_TIMER);
@@ -11165,7 +11165,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 					SC_MANDRAGORA, SC_HARMONIZE, SC_DEEPSLEEP, SC_VOICEOFSIREN, SC_SLEEP, SC_CONFUSION, SC_HALLUCINATION
 				};
 				for (i = 0; i < ARRAYLENGTH(scs); i++)
-					if (tsc->data[scs[i]]) status_change_end(bl, scs[i], INVALID_TIMER);
+					if (tsc->getSCE(scs[i])) status_change_end(bl, scs[i], INVALID_TIMER);
 			}
 			if (hd)
 				skill_blockhomun_start(hd, skill_id, skill_get_cooldown(skill_id, skill_lv));
@@ -11198,10 +11198,10 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 	case MH_STYLE_CHANGE:
 		if(hd){
 			struct status_change_entry *sce;
-			if((sce=hd->sc.data[SC_STYLE_CHANGE])!=NULL){ //in preparation for other bl usage
+			if((sce=hd->sc.getSCE(SC_STYLE_CHANGE))!=NULL){ //in preparation for other bl usage
 				if(sce->val1 == MH_MD_FIGHTING) sce->val1 = MH_MD_GRAPPLING;
 				else sce->val1 = MH_MD_FIGHTING;
-				//if(hd->master && hd->sc.data[SC_STYLE_CHANGE]) { // Aegis does not show any message when switching fighting style
+				//if(hd->master && hd->sc.getSCE(SC_STYLE_CHANGE)) { // Aegis does not show any message when switching fighting style
 				//	char output[128];
 				//	safesnprintf(output,sizeof(output),msg_txt(sd,378),(sce->val1==MH_MD_FIGHTING?"fighthing":"grappling"));
 				//	clif_messagecolor(&hd->master->bl, color_table[COLOR_RED], output, false, SELF);
@@ -11360,7 +11360,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 			clif_skill_fail(sd, skill_id, USESKILL_FAIL_TOTARGET, 0);
 			break;
 		}
-		if (tsc && tsc->count && tsc->data[type]) // Refresh the status only if it's already active.
+		if (tsc && tsc->count && tsc->getSCE(type)) // Refresh the status only if it's already active.
 			sc_start(src, bl, type, 100, skill_lv, skill_get_time(skill_id, skill_lv));
 		else {
 			sc_start(src, bl, type, 100, skill_lv, skill_get_time(skill_id, skill_lv));
@@ -11488,7 +11488,7 @@ int skill_castend_nodamage_id (struct block_list *src, struct block_list *bl, ui
 	if (skill_id != SR_CURSEDCIRCLE) {
 		struct status_change *sc = status_get_sc(src);
 
-		if (sc && sc->data[SC_CURSEDCIRCLE_ATKER]) // Should only remove after the skill had been casted.
+		if (sc && sc->getSCE(SC_CURSEDCIRCLE_ATKER)) // Should only remove after the skill had been casted.
 			status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 	}
 
@@ -11564,7 +11564,7 @@ static int8 skill_castend_id_check(struct block_list *src, struct block_list *ta
 		case MER_LEXDIVINA:
 			{
 				//If it's not an enemy, and not silenced, you can't use the skill on them. [Skotlex]
-				if (battle_check_target(src,target, BCT_ENEMY) <= 0 && (!tsc || !tsc->data[SC_SILENCE]))
+				if (battle_check_target(src,target, BCT_ENEMY) <= 0 && (!tsc || !tsc->getSCE(SC_SILENCE)))
 					return USESKILL_FAIL_LEVEL;
 				else
 					return -1; //Works on silenced allies
@@ -11635,7 +11635,7 @@ static int8 skill_castend_id_check(struct block_list *src, struct block_list *ta
 
 	// Fogwall makes all offensive-type targetted skills fail at 75%
 	// Jump Kick can still fail even though you can jump to friendly targets.
-	if ((inf&BCT_ENEMY || skill_id == TK_JUMPKICK) && tsc && tsc->data[SC_FOGWALL] && rnd() % 100 < 75)
+	if ((inf&BCT_ENEMY || skill_id == TK_JUMPKICK) && tsc && tsc->getSCE(SC_FOGWALL) && rnd() % 100 < 75)
 		return USESKILL_FAIL_LEVEL;
 
 	return -1;
@@ -11851,8 +11851,8 @@ TIMER_FUNC(skill_castend_id){
 				else
 					type = SC_STRIPSHIELD;
 
-				if ((sc = status_get_sc(src)) && sc->data[type]) {
-					const struct TimerData* timer = get_timer(sc->data[type]->timer);
+				if ((sc = status_get_sc(src)) && sc->getSCE(type)) {
+					const struct TimerData* timer = get_timer(sc->getSCE(type)->timer);
 
 					if (timer && timer->func == status_change_timer && DIFF_TICK(timer->tick, gettick() + skill_get_time(ud->skill_id, ud->skill_lv)) > 0)
 						break;
@@ -11885,13 +11885,13 @@ TIMER_FUNC(skill_castend_id){
 			if (ud->skill_id != RA_CAMOUFLAGE)
 				status_change_end(src, SC_CAMOUFLAGE, INVALID_TIMER); // Applies to the first skill if active
 
-			if(sc->data[SC_SPIRIT] &&
-				sc->data[SC_SPIRIT]->val2 == SL_WIZARD &&
-				sc->data[SC_SPIRIT]->val3 == ud->skill_id &&
+			if(sc->getSCE(SC_SPIRIT) &&
+				sc->getSCE(SC_SPIRIT)->val2 == SL_WIZARD &&
+				sc->getSCE(SC_SPIRIT)->val3 == ud->skill_id &&
 				ud->skill_id != WZ_WATERBALL)
-				sc->data[SC_SPIRIT]->val3 = 0; //Clear bounced spell check.
+				sc->getSCE(SC_SPIRIT)->val3 = 0; //Clear bounced spell check.
 #ifndef RENEWAL
-			if( sc->data[SC_DANCING] && sd && skill_get_inf2(ud->skill_id, INF2_ISSONG) )
+			if( sc->getSCE(SC_DANCING) && sd && skill_get_inf2(ud->skill_id, INF2_ISSONG) )
 				skill_blockpc_start(sd,BD_ADAPTATION,3000);
 #endif
 		}
@@ -11909,7 +11909,7 @@ TIMER_FUNC(skill_castend_id){
 	} while(0);
 
 	//Skill failed.
-	if (ud->skill_id == MO_EXTREMITYFIST && sd && !(sc && sc->data[SC_FOGWALL]))
+	if (ud->skill_id == MO_EXTREMITYFIST && sd && !(sc && sc->getSCE(SC_FOGWALL)))
 	{	//When Asura fails... (except when it fails from Wall of Fog)
 		//Consume SP/spheres
 		skill_consume_requirement(sd,ud->skill_id, ud->skill_lv,1);
@@ -12125,7 +12125,7 @@ int skill_castend_pos2(struct block_list* src, int x, int y, uint16 skill_id, ui
 
 	sc = status_get_sc(src);
 	type = status_skill2sc(skill_id);
-	sce = (sc && type != -1)?sc->data[type]:NULL;
+	sce = (sc && type != -1)?sc->getSCE(type):NULL;
 
 	switch (skill_id) { //Skill effect.
 		case WZ_METEOR:
@@ -12341,7 +12341,7 @@ int skill_castend_pos2(struct block_list* src, int x, int y, uint16 skill_id, ui
 		break;
 #ifndef RENEWAL
 	case HP_BASILICA:
-		if( sc->data[SC_BASILICA] ) {
+		if( sc->getSCE(SC_BASILICA) ) {
 			status_change_end(src, SC_BASILICA, INVALID_TIMER); // Cancel Basilica and return so requirement isn't consumed again
 			return 0;
 		} else { // Create Basilica. Start SC on caster. Unit timer start SC on others.
@@ -12420,7 +12420,7 @@ int skill_castend_pos2(struct block_list* src, int x, int y, uint16 skill_id, ui
 				(skill_lv >= 4) ? sd->status.memo_point[2].map : 0
 			);
 		}
-		if( sc && sc->data[SC_CURSEDCIRCLE_ATKER] ) //Should only remove after the skill has been casted.
+		if( sc && sc->getSCE(SC_CURSEDCIRCLE_ATKER) ) //Should only remove after the skill has been casted.
 			status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 		return 0; // not to consume item.
 
@@ -12647,7 +12647,7 @@ int skill_castend_pos2(struct block_list* src, int x, int y, uint16 skill_id, ui
 		break;
 
 	case GC_POISONSMOKE:
-		if( !(sc && sc->data[SC_POISONINGWEAPON]) ) {
+		if( !(sc && sc->getSCE(SC_POISONINGWEAPON)) ) {
 			if( sd )
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_GC_POISONINGWEAPON,0);
 			return 0;
@@ -12689,7 +12689,7 @@ int skill_castend_pos2(struct block_list* src, int x, int y, uint16 skill_id, ui
 
 	case NC_NEUTRALBARRIER:
 	case NC_STEALTHFIELD:
-		if( (sc->data[SC_NEUTRALBARRIER_MASTER] && skill_id == NC_NEUTRALBARRIER) || (sc->data[SC_STEALTHFIELD_MASTER] && skill_id == NC_STEALTHFIELD) ) {
+		if( (sc->getSCE(SC_NEUTRALBARRIER_MASTER) && skill_id == NC_NEUTRALBARRIER) || (sc->getSCE(SC_STEALTHFIELD_MASTER) && skill_id == NC_STEALTHFIELD) ) {
 			skill_clear_unitgroup(src);
 			return 0;
 		}
@@ -12741,7 +12741,7 @@ int skill_castend_pos2(struct block_list* src, int x, int y, uint16 skill_id, ui
 		break;
 
 	case LG_BANDING:
-		if( sc && sc->data[SC_BANDING] )
+		if( sc && sc->getSCE(SC_BANDING) )
 			status_change_end(src,SC_BANDING,INVALID_TIMER);
 		else if( (sg = skill_unitsetting(src,skill_id,skill_lv,src->x,src->y,0)) != NULL )
 			sc_start4(src,src,SC_BANDING,100,skill_lv,0,0,sg->group_id,skill_get_time(skill_id,skill_lv));
@@ -12829,7 +12829,7 @@ int skill_castend_pos2(struct block_list* src, int x, int y, uint16 skill_id, ui
 	case SO_ELECTRICWALK:
 	case NPC_FIREWALK:
 	case NPC_ELECTRICWALK:
-		if( sc && sc->data[type] )
+		if( sc && sc->getSCE(type) )
 			status_change_end(src,type,INVALID_TIMER);
 		sc_start2(src, src, type, 100, skill_id, skill_lv, skill_get_time(skill_id, skill_lv));
 		break;
@@ -12922,7 +12922,7 @@ int skill_castend_pos2(struct block_list* src, int x, int y, uint16 skill_id, ui
 		return 1;
 	}
 
-	if( sc && sc->data[SC_CURSEDCIRCLE_ATKER] ) //Should only remove after the skill has been casted.
+	if( sc && sc->getSCE(SC_CURSEDCIRCLE_ATKER) ) //Should only remove after the skill has been casted.
 		status_change_end(src,SC_CURSEDCIRCLE_ATKER,INVALID_TIMER);
 
 	if( sd )
@@ -13223,7 +13223,7 @@ std::shared_ptr<s_skill_unit_group> skill_unitsetting(struct block_list *src, ui
 #endif
 		break;
 	case MG_FIREWALL:
-		if(sc && sc->data[SC_VIOLENTGALE])
+		if(sc && sc->getSCE(SC_VIOLENTGALE))
 			limit = limit*3/2;
 		val2 = 4+skill_lv;
 		break;
@@ -13439,8 +13439,8 @@ std::shared_ptr<s_skill_unit_group> skill_unitsetting(struct block_list *src, ui
 				val1 = status_get_attack_sc_element(src,sc);
 			else if (ele == ELE_WEAPON) {
 				val1 = status->rhw.ele;
-				if (sc && sc->data[SC_ENCHANTARMS])
-					val1 = sc->data[SC_ENCHANTARMS]->val1;
+				if (sc && sc->getSCE(SC_ENCHANTARMS))
+					val1 = sc->getSCE(SC_ENCHANTARMS)->val1;
 			}
 
 			switch (val1) {
@@ -13462,10 +13462,10 @@ std::shared_ptr<s_skill_unit_group> skill_unitsetting(struct block_list *src, ui
 			break;
 		}
 	case GC_POISONSMOKE:
-		if( !(sc && sc->data[SC_POISONINGWEAPON]) )
+		if( !(sc && sc->getSCE(SC_POISONINGWEAPON)) )
 			return nullptr;
-		val2 = sc->data[SC_POISONINGWEAPON]->val2; // Type of Poison
-		val3 = sc->data[SC_POISONINGWEAPON]->val1;
+		val2 = sc->getSCE(SC_POISONINGWEAPON)->val2; // Type of Poison
+		val3 = sc->getSCE(SC_POISONINGWEAPON)->val1;
 		limit = skill_get_time(skill_id, skill_lv);
 		break;
 	case NPC_COMET:
@@ -13533,8 +13533,8 @@ std::shared_ptr<s_skill_unit_group> skill_unitsetting(struct block_list *src, ui
 		break;
 #ifndef RENEWAL
 	case HW_GRAVITATION:
-		if(sc && sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 == BCT_SELF)
-			link_group_id = sc->data[SC_GRAVITATION]->val4;
+		if(sc && sc->getSCE(SC_GRAVITATION) && sc->getSCE(SC_GRAVITATION)->val3 == BCT_SELF)
+			link_group_id = sc->getSCE(SC_GRAVITATION)->val4;
 		break;
 #endif
 	case SO_VACUUM_EXTREME:
@@ -13780,14 +13780,14 @@ static int skill_unit_onplace(struct skill_unit *unit, struct block_list *bl, t_
 	if (sc && sc->option&OPTION_HIDE && !skill->inf2[INF2_TARGETHIDDEN])
 		return 0; //Hidden characters are immune to AoE skills except to these. [Skotlex]
 
-	if (sc && sc->data[SC_VACUUM_EXTREME] && map_getcell(bl->m, bl->x, bl->y, CELL_CHKLANDPROTECTOR))
+	if (sc && sc->getSCE(SC_VACUUM_EXTREME) && map_getcell(bl->m, bl->x, bl->y, CELL_CHKLANDPROTECTOR))
 		status_change_end(bl, SC_VACUUM_EXTREME, INVALID_TIMER);
 
-	if (sc && sc->data[SC_HOVERING] && skill->inf2[INF2_IGNOREHOVERING])
+	if (sc && sc->getSCE(SC_HOVERING) && skill->inf2[INF2_IGNOREHOVERING])
 		return 0; // Under Hovering characters are immune to select trap and ground target skills.
 
 	type = status_skill2sc(sg->skill_id);
-	sce = (sc && type != SC_NONE) ? sc->data[type] : NULL;
+	sce = (sc && type != SC_NONE) ? sc->getSCE(type) : NULL;
 	skill_id = sg->skill_id; //In case the group is deleted, we need to return the correct skill id, still.
 	switch (sg->unit_id) {
 		case UNT_SPIDERWEB:
@@ -13800,32 +13800,32 @@ static int skill_unit_onplace(struct skill_unit *unit, struct block_list *bl, t_
 
 				if (mapdata_flag_vs(mapdata))
 					sec /= 2;
-				if (sc->data[type]) {
-					if (sc->data[type]->val2 && sc->data[type]->val3 && sc->data[type]->val4) {
+				if (sc->getSCE(type)) {
+					if (sc->getSCE(type)->val2 && sc->getSCE(type)->val3 && sc->getSCE(type)->val4) {
 						//Already triple affected, immune
 						sg->limit = DIFF_TICK(tick, sg->tick);
 						break;
 					}
 					//Don't increase val1 here, we need a higher val in status_change_start so it overwrites the old one
-					if (mapdata_flag_vs(mapdata) && sc->data[type]->val1 < 3)
-						sec *= (sc->data[type]->val1 + 1);
-					else if(!mapdata_flag_vs(mapdata) && sc->data[type]->val1 < 2)
-						sec *= (sc->data[type]->val1 + 1);
+					if (mapdata_flag_vs(mapdata) && sc->getSCE(type)->val1 < 3)
+						sec *= (sc->getSCE(type)->val1 + 1);
+					else if(!mapdata_flag_vs(mapdata) && sc->getSCE(type)->val1 < 2)
+						sec *= (sc->getSCE(type)->val1 + 1);
 					//Add group id to status change
-					if (sc->data[type]->val2 == 0)
-						sc->data[type]->val2 = sg->group_id;
-					else if (sc->data[type]->val3 == 0)
-						sc->data[type]->val3 = sg->group_id;
-					else if (sc->data[type]->val4 == 0)
-						sc->data[type]->val4 = sg->group_id;
+					if (sc->getSCE(type)->val2 == 0)
+						sc->getSCE(type)->val2 = sg->group_id;
+					else if (sc->getSCE(type)->val3 == 0)
+						sc->getSCE(type)->val3 = sg->group_id;
+					else if (sc->getSCE(type)->val4 == 0)
+						sc->getSCE(type)->val4 = sg->group_id;
 					//Overwrite status change with new duration
-					if ((td = get_timer(sc->data[type]->timer))!=NULL)
-						status_change_start(ss, bl, type, 10000, sc->data[type]->val1 + 1, sc->data[type]->val2, sc->data[type]->val3, sc->data[type]->val4,
+					if ((td = get_timer(sc->getSCE(type)->timer))!=NULL)
+						status_change_start(ss, bl, type, 10000, sc->getSCE(type)->val1 + 1, sc->getSCE(type)->val2, sc->getSCE(type)->val3, sc->getSCE(type)->val4,
 							i64max(DIFF_TICK(td->tick, tick), sec), SCSTART_NORATEDEF);
 				}
 				else {
 					if (status_change_start(ss, bl, type, 10000, 1, sg->group_id, 0, 0, sec, SCSTART_NORATEDEF)) {
-						td = sc->data[type] ? get_timer(sc->data[type]->timer) : NULL;
+						td = sc->getSCE(type) ? get_timer(sc->getSCE(type)->timer) : NULL;
 						if (td)
 							sec = DIFF_TICK(td->tick, tick);
 						map_moveblock(bl, unit->bl.x, unit->bl.y, tick);
@@ -13936,7 +13936,7 @@ static int skill_unit_onplace(struct skill_unit *unit, struct block_list *bl, t_
 		case UNT_INTOABYSS:
 		case UNT_SIEGFRIED:
 			 //Needed to check when a dancer/bard leaves their ensemble area.
-			if (sg->src_id==bl->id && !(sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_BARDDANCER))
+			if (sg->src_id==bl->id && !(sc && sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_BARDDANCER))
 				return skill_id;
 			if (!sce)
 				sc_start4(ss, bl,type,100,sg->skill_lv,sg->val1,sg->val2,0,sg->limit);
@@ -13949,7 +13949,7 @@ static int skill_unit_onplace(struct skill_unit *unit, struct block_list *bl, t_
 		case UNT_DONTFORGETME:
 		case UNT_FORTUNEKISS:
 		case UNT_SERVICEFORYOU:
-			if (sg->src_id==bl->id && !(sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_BARDDANCER))
+			if (sg->src_id==bl->id && !(sc && sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_BARDDANCER))
 				return 0;
 
 			if (!sc) return 0;
@@ -13993,7 +13993,7 @@ static int skill_unit_onplace(struct skill_unit *unit, struct block_list *bl, t_
 
 		case UNT_MOONLIT:
 			//Knockback out of area if affected char isn't in Moonlit effect
-			if (sc && sc->data[SC_DANCING] && (sc->data[SC_DANCING]->val1&0xFFFF) == CG_MOONLIT)
+			if (sc && sc->getSCE(SC_DANCING) && (sc->getSCE(SC_DANCING)->val1&0xFFFF) == CG_MOONLIT)
 				break;
 			if (ss == bl) //Also needed to prevent infinite loop crash.
 				break;
@@ -14120,10 +14120,10 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 
 	std::bitset<INF2_MAX> inf2 = skill_db.find(skill_id)->inf2;
 
-	if (sc && sc->data[SC_VOICEOFSIREN] && sc->data[SC_VOICEOFSIREN]->val2 == bl->id && inf2[INF2_ISTRAP])
+	if (sc && sc->getSCE(SC_VOICEOFSIREN) && sc->getSCE(SC_VOICEOFSIREN)->val2 == bl->id && inf2[INF2_ISTRAP])
 		return 0; // Traps cannot be activated by the Maestro or Wanderer that enticed the trapper with this skill.
 
-	if (tsc && tsc->data[SC_HOVERING] && inf2[INF2_IGNOREHOVERING])
+	if (tsc && tsc->getSCE(SC_HOVERING) && inf2[INF2_IGNOREHOVERING])
 		return 0; // Under Hovering characters are immune to trap and ground target skills.
 
 	if (sg->interval == -1) {
@@ -14262,7 +14262,7 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 				if( status_isimmune(bl) )
 					heal = 0;
 				clif_skill_nodamage(&unit->bl, bl, AL_HEAL, heal, 1);
-				if( tsc && tsc->data[SC_AKAITSUKI] && heal )
+				if( tsc && tsc->getSCE(SC_AKAITSUKI) && heal )
 					heal = ~heal + 1;
 				status_heal(bl, heal, 0, 0);
 			}
@@ -14317,7 +14317,7 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 				t_tick sec = skill_get_time2(sg->skill_id,sg->skill_lv);
 
 				if( status_change_start(ss, bl,type,10000,sg->skill_lv,sg->group_id,0,0,sec, SCSTART_NORATEDEF) ) {
-					const struct TimerData* td = tsc->data[type]?get_timer(tsc->data[type]->timer):NULL;
+					const struct TimerData* td = tsc->getSCE(type)?get_timer(tsc->getSCE(type)->timer):NULL;
 
 					if( td )
 						sec = DIFF_TICK(td->tick, tick);
@@ -14362,7 +14362,7 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 			break;
 
 		case UNT_VENOMDUST:
-			if(tsc && !tsc->data[type])
+			if(tsc && !tsc->getSCE(type))
 				status_change_start(ss,bl,type,10000,sg->skill_lv,sg->src_id,0,0,skill_get_time2(sg->skill_id,sg->skill_lv),SCSTART_NONE);
 			break;
 
@@ -14392,7 +14392,7 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 		case UNT_CLAYMORETRAP:
 		{
 			int bl_flag = sg->bl_flag;
-			if (tsc && tsc->data[SC__MANHOLE])
+			if (tsc && tsc->getSCE(SC__MANHOLE))
 				break;
 			if (sg->unit_id == UNT_FIRINGTRAP || sg->unit_id == UNT_ICEBOUNDTRAP || sg->unit_id == UNT_CLAYMORETRAP)
 				bl_flag = bl_flag|BL_SKILL|~BCT_SELF;
@@ -14441,10 +14441,10 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 				if (md && md->mob_id == MOBID_EMPERIUM)
 					break;
 #endif
-				if (sg->src_id == bl->id && !(tsc && tsc->data[SC_SPIRIT] && tsc->data[SC_SPIRIT]->val2 == SL_BARDDANCER))
+				if (sg->src_id == bl->id && !(tsc && tsc->getSCE(SC_SPIRIT) && tsc->getSCE(SC_SPIRIT)->val2 == SL_BARDDANCER))
 					break; // affects self only when soullinked
 				heal = skill_calc_heal(ss,bl,sg->skill_id, sg->skill_lv, true);
-				if (tsc->data[SC_AKAITSUKI] && heal)
+				if (tsc->getSCE(SC_AKAITSUKI) && heal)
 					heal = ~heal + 1;
 				clif_skill_nodamage(&unit->bl, bl, AL_HEAL, heal, 1);
 				status_heal(bl, heal, 0, 0);
@@ -14566,7 +14566,7 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 					skill_blown(&unit->bl, bl, skill_get_blewcount(skill_id, sg->skill_lv), unit_getdir(bl), BLOWN_NONE);
 					break;
 				}
-				if (i <= 0 && (!tsc || !tsc->data[SC_BASILICA]))
+				if (i <= 0 && (!tsc || !tsc->getSCE(SC_BASILICA)))
 					sc_start4(ss, bl, type, 100, 0, 0, sg->group_id, ss->id, sg->limit);
 			}
 			break;
@@ -14586,7 +14586,7 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 			break;
 
 		case UNT_POISONSMOKE:
-			if( battle_check_target(ss,bl,BCT_ENEMY) > 0 && !(tsc && tsc->data[sg->val2]) && rnd()%100 < 20 )
+			if( battle_check_target(ss,bl,BCT_ENEMY) > 0 && !(tsc && tsc->getSCE(sg->val2)) && rnd()%100 < 20 )
 				sc_start(ss,bl,(sc_type)sg->val2,100,sg->val3,skill_get_time2(GC_POISONINGWEAPON, 1));
 			break;
 
@@ -14607,7 +14607,7 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 						clif_skill_nodamage(&unit->bl, bl, AL_HEAL, hp, 1);
 					if (tstatus->sp < tstatus->max_sp)
 						clif_skill_nodamage(&unit->bl, bl, MG_SRECOVERY, sp, 1);
-					if (tsc && tsc->data[SC_AKAITSUKI] && hp)
+					if (tsc && tsc->getSCE(SC_AKAITSUKI) && hp)
 						hp = ~hp + 1;
 					status_heal(bl, hp, sp, 3);
 				}
@@ -14618,7 +14618,7 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 					status_change_end(bl,SC_CLOAKINGEXCEED,INVALID_TIMER);
 					status_change_end(bl,SC_CAMOUFLAGE,INVALID_TIMER);
 					status_change_end(bl,SC_NEWMOON,INVALID_TIMER);
-					if (tsc && tsc->data[SC__SHADOWFORM] && rnd() % 100 < 100 - tsc->data[SC__SHADOWFORM]->val1 * 10) // [100 - (Skill Level x 10)] %
+					if (tsc && tsc->getSCE(SC__SHADOWFORM) && rnd() % 100 < 100 - tsc->getSCE(SC__SHADOWFORM)->val1 * 10) // [100 - (Skill Level x 10)] %
 						status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 				}
 				sc_start(ss, bl, type, 100, sg->skill_lv, sg->interval + 100);
@@ -14648,7 +14648,7 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 			break;
 		case UNT_NETHERWORLD:
 			if (!status_bl_has_mode(bl,MD_STATUSIMMUNE) || (!map_flag_gvg2(ss->m) && battle_check_target(&unit->bl,bl,BCT_PARTY) < 0)) {
-				if (!(tsc && tsc->data[type])) {
+				if (!(tsc && tsc->getSCE(type))) {
 					sc_start(ss, bl, type, 100, sg->skill_lv, skill_get_time2(sg->skill_id,sg->skill_lv));
 					sg->limit = DIFF_TICK(tick,sg->tick);
 					sg->unit_id = UNT_USED_TRAPS;
@@ -14660,7 +14660,7 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 				if( !sg->val2 ) {
 					t_tick sec = skill_get_time2(sg->skill_id, sg->skill_lv);
 					if( sc_start(ss, bl, type, 100, sg->skill_lv, sec) ) {
-						const struct TimerData* td = tsc->data[type]?get_timer(tsc->data[type]->timer):NULL;
+						const struct TimerData* td = tsc->getSCE(type)?get_timer(tsc->getSCE(type)->timer):NULL;
 						if( td )
 							sec = DIFF_TICK(td->tick, tick);
 						///map_moveblock(bl, src->bl.x, src->bl.y, tick); // in official server it doesn't behave like this. [malufett]
@@ -14669,7 +14669,7 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 					} else
 						sec = 3000;	// Couldn't trap it?
 					sg->limit = DIFF_TICK(tick, sg->tick) + sec;
-				} else if( tsc->data[SC_THORNSTRAP] && bl->id == sg->val2 )
+				} else if( tsc->getSCE(SC_THORNSTRAP) && bl->id == sg->val2 )
 					skill_attack(skill_get_type(GN_THORNS_TRAP), ss, ss, bl, sg->skill_id, sg->skill_lv, tick, SD_LEVEL|SD_ANIMATION);
 			}
 			break;
@@ -14700,14 +14700,14 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 			break;
 
 		case UNT_CLOUD_KILL:
-			if (tsc && !tsc->data[type])
+			if (tsc && !tsc->getSCE(type))
 				status_change_start(ss, bl, type, 10000, sg->skill_lv, ss->id, 0, 0, skill_get_time(sg->skill_id, sg->skill_lv), SCSTART_NOTICKDEF);
 			skill_attack(skill_get_type(sg->skill_id), ss, &unit->bl, bl, sg->skill_id, sg->skill_lv, tick, 0);
 			break;
 
 		case UNT_VACUUM_EXTREME:
-			if (tsc && (tsc->data[SC_HALLUCINATIONWALK] || tsc->data[SC_NPC_HALLUCINATIONWALK] || tsc->data[SC_HOVERING] || tsc->data[SC_VACUUM_EXTREME] ||
-				(tsc->data[SC_VACUUM_EXTREME_POSTDELAY] && tsc->data[SC_VACUUM_EXTREME_POSTDELAY]->val2 == sg->group_id))) // Ignore post delay from other vacuum (this will make stack effect enabled)
+			if (tsc && (tsc->getSCE(SC_HALLUCINATIONWALK) || tsc->getSCE(SC_NPC_HALLUCINATIONWALK) || tsc->getSCE(SC_HOVERING) || tsc->getSCE(SC_VACUUM_EXTREME) ||
+				(tsc->getSCE(SC_VACUUM_EXTREME_POSTDELAY) && tsc->getSCE(SC_VACUUM_EXTREME_POSTDELAY)->val2 == sg->group_id))) // Ignore post delay from other vacuum (this will make stack effect enabled)
 				return 0;
 
 			// Apply effect and suck targets one-by-one each n seconds
@@ -14715,7 +14715,7 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 			break;
 
 		case UNT_BANDING:
-			if( battle_check_target(&unit->bl, bl, BCT_ENEMY) > 0 && !(tsc && tsc->data[SC_BANDING_DEFENCE]) )
+			if( battle_check_target(&unit->bl, bl, BCT_ENEMY) > 0 && !(tsc && tsc->getSCE(SC_BANDING_DEFENCE)) )
 				sc_start(ss, bl, SC_BANDING_DEFENCE, (status_get_lv(&unit->bl) / 5) + (sg->skill_lv * 5) - (status_get_agi(bl) / 10), 90, skill_get_time2(sg->skill_id, sg->skill_lv));
 			break;
 
@@ -14777,13 +14777,13 @@ int skill_unit_onplace_timer(struct skill_unit *unit, struct block_list *bl, t_t
 			break;
 
 		case UNT_CHAOSPANIC:
-			if (tsc && tsc->data[type])
+			if (tsc && tsc->getSCE(type))
 				break;
 			status_change_start(ss, bl, type, 3500 + (sg->skill_lv * 1500), sg->skill_lv, 0, 0, 1, sg->skill_lv * 4000, SCSTART_NOAVOID|SCSTART_NORATEDEF|SCSTART_NOTICKDEF);
 			break;
 
 		case UNT_B_TRAP:
-			if (tsc && tsc->data[type])
+			if (tsc && tsc->getSCE(type))
 				break;
 			sc_start(ss, bl, type, 100, sg->skill_lv, skill_get_time2(sg->skill_id,sg->skill_lv));
 			unit->val2++; // Mark as ever been used
@@ -14828,7 +14828,7 @@ int skill_unit_onout(struct skill_unit *src, struct block_list *bl, t_tick tick)
 
 	sc = status_get_sc(bl);
 	type = status_skill2sc(sg->skill_id);
-	sce = (sc && type != -1)?sc->data[type]:NULL;
+	sce = (sc && type != -1)?sc->getSCE(type):NULL;
 
 	if (bl->prev == NULL || (status_isdead(bl) && sg->unit_id != UNT_ANKLESNARE)) //Need to delete the trap if the source died.
 		return 0;
@@ -14859,7 +14859,7 @@ int skill_unit_onout(struct skill_unit *src, struct block_list *bl, t_tick tick)
 				for(uint16 i = BA_WHISTLE; i <= DC_SERVICEFORYOU; i++) {
 					if(skill_get_inf2(i, INF2_ISSONG)) {
 						type = status_skill2sc(i);
-						sce = (sc && type != -1)?sc->data[type]:NULL;
+						sce = (sc && type != -1)?sc->getSCE(type):NULL;
 						if(sce)
 							return i;
 					}
@@ -14873,7 +14873,7 @@ int skill_unit_onout(struct skill_unit *src, struct block_list *bl, t_tick tick)
 		case UNT_DONTFORGETME:
 		case UNT_FORTUNEKISS:
 		case UNT_SERVICEFORYOU:
-			if (sg->src_id==bl->id && !(sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_BARDDANCER))
+			if (sg->src_id==bl->id && !(sc && sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_BARDDANCER))
 				return -1;
 	}
 	return sg->skill_id;
@@ -14896,7 +14896,7 @@ int skill_unit_onleft(uint16 skill_id, struct block_list *bl, t_tick tick)
 		sc = NULL;
 
 	type = status_skill2sc(skill_id);
-	sce = (sc && type != -1)?sc->data[type]:NULL;
+	sce = (sc && type != -1)?sc->getSCE(type):NULL;
 
 	switch (skill_id)
 	{
@@ -14915,7 +14915,7 @@ int skill_unit_onleft(uint16 skill_id, struct block_list *bl, t_tick tick)
 		case BD_ROKISWEIL:
 		case BD_INTOABYSS:
 		case BD_SIEGFRIED:
-			if(sc && sc->data[SC_DANCING] && (sc->data[SC_DANCING]->val1&0xFFFF) == skill_id)
+			if(sc && sc->getSCE(SC_DANCING) && (sc->getSCE(SC_DANCING)->val1&0xFFFF) == skill_id)
 			{	//Check if you just stepped out of your ensemble skill to cancel dancing. [Skotlex]
 				//We don't check for SC_LONGING because someone could always have knocked you back and out of the song/dance.
 				//FIXME: This code is not perfect, it doesn't checks for the real ensemble's owner,
@@ -14962,7 +14962,7 @@ int skill_unit_onleft(uint16 skill_id, struct block_list *bl, t_tick tick)
 				for(uint16 i = BA_WHISTLE; i <= DC_SERVICEFORYOU; i++){
 					if(skill_get_inf2(i, INF2_ISSONG)){
 						type = status_skill2sc(i);
-						sce = (sc && type != -1)?sc->data[type]:NULL;
+						sce = (sc && type != -1)?sc->getSCE(type):NULL;
 						if(sce && !sce->val4){ //We don't want dissonance updating this anymore
 							delete_timer(sce->timer, status_change_timer);
 							sce->val4 = 1; //Store the fact that this is a "reduced" duration effect.
@@ -14993,7 +14993,7 @@ int skill_unit_onleft(uint16 skill_id, struct block_list *bl, t_tick tick)
 			if (sce)
 			{
 				status_change_end(bl, type, INVALID_TIMER);
-				if ((sce=sc->data[SC_BLIND]))
+				if ((sce=sc->getSCE(SC_BLIND)))
 				{
 					if (bl->type == BL_PC) //Players get blind ended inmediately, others have it still for 30 secs. [Skotlex]
 						status_change_end(bl, SC_BLIND, INVALID_TIMER);
@@ -15153,7 +15153,7 @@ int skill_check_condition_char_sub (struct block_list *bl, va_list ap)
 	if(pc_isdead(tsd))
 		return 0;
 
-	if (tsd->sc.data[SC_SILENCE] || ( tsd->sc.opt1 && tsd->sc.opt1 != OPT1_BURNING ))
+	if (tsd->sc.getSCE(SC_SILENCE) || ( tsd->sc.opt1 && tsd->sc.opt1 != OPT1_BURNING ))
 		return 0;
 
 	if( is_chorus ) {
@@ -15189,7 +15189,7 @@ int skill_check_condition_char_sub (struct block_list *bl, va_list ap)
 							(tsd->weapontype1==W_MUSICAL || tsd->weapontype1==W_WHIP) &&
 							sd->status.party_id && tsd->status.party_id &&
 							sd->status.party_id == tsd->status.party_id &&
-							!tsd->sc.data[SC_DANCING])
+							!tsd->sc.getSCE(SC_DANCING))
 					{
 						p_sd[(*c)++]=tsd->bl.id;
 						return skill_lv;
@@ -15244,9 +15244,9 @@ int skill_check_pc_partner(struct map_session_data *sd, uint16 skill_id, uint16
 				if( is_chorus )
 					break;//Chorus skills are not to be parsed as ensembles
 				if (skill_get_inf2(skill_id, INF2_ISENSEMBLE)) {
-					if (c > 0 && sd->sc.data[SC_DANCING] && (tsd = map_id2sd(p_sd[0])) != NULL) {
-						sd->sc.data[SC_DANCING]->val4 = tsd->bl.id;
-						sc_start4(&sd->bl,&tsd->bl,SC_DANCING,100,skill_id,sd->sc.data[SC_DANCING]->val2,*skill_lv,sd->bl.id,skill_get_time(skill_id,*skill_lv)+1000);
+					if (c > 0 && sd->sc.getSCE(SC_DANCING) && (tsd = map_id2sd(p_sd[0])) != NULL) {
+						sd->sc.getSCE(SC_DANCING)->val4 = tsd->bl.id;
+						sc_start4(&sd->bl,&tsd->bl,SC_DANCING,100,skill_id,sd->sc.getSCE(SC_DANCING)->val2,*skill_lv,sd->bl.id,skill_get_time(skill_id,*skill_lv)+1000);
 						clif_skill_nodamage(&tsd->bl, &sd->bl, skill_id, *skill_lv, 1);
 						tsd->skill_id_dance = skill_id;
 						tsd->skill_lv_dance = *skill_lv;
@@ -15363,7 +15363,7 @@ static bool skill_check_condition_sc_required(struct map_session_data *sd, unsig
 				break;
 		}
 
-		if (!sc->data[reqStatus]) {
+		if (!sc->getSCE(reqStatus)) {
 			clif_skill_fail(sd, skill_id, cause, 0);
 			return false;
 		}
@@ -15446,7 +15446,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			//Consume
 			sd->itemid = 0;
 			sd->itemindex = -1;
-			if( (skill_id == WZ_EARTHSPIKE && sc && sc->data[SC_EARTHSCROLL] && rnd()%100 > sc->data[SC_EARTHSCROLL]->val2) || sd->inventory_data[i]->flag.delay_consume & DELAYCONSUME_NOCONSUME ) // [marquis007]
+			if( (skill_id == WZ_EARTHSPIKE && sc && sc->getSCE(SC_EARTHSCROLL) && rnd()%100 > sc->getSCE(SC_EARTHSCROLL)->val2) || sd->inventory_data[i]->flag.delay_consume & DELAYCONSUME_NOCONSUME ) // [marquis007]
 				; //Do not consume item.
 			else if( sd->inventory.u.items_inventory[i].expire_time == 0 )
 				pc_delitem(sd,i,1,0,0,LOG_TYPE_CONSUME); // Rental usable items are not consumed until expiration
@@ -15460,7 +15460,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 		return false;
 	}
 
-	if( sc && ( sc->data[SC__SHADOWFORM] || sc->data[SC__IGNORANCE] ) )
+	if( sc && ( sc->getSCE(SC__SHADOWFORM) || sc->getSCE(SC__IGNORANCE) ) )
 		return false;
 
 	//Checks if disabling skill - in which case no SP requirements are necessary
@@ -15551,8 +15551,8 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			}
 			break;
 		case MO_CALLSPIRITS:
-			if(sc && sc->data[SC_RAISINGDRAGON])
-				skill_lv += sc->data[SC_RAISINGDRAGON]->val1;
+			if(sc && sc->getSCE(SC_RAISINGDRAGON))
+				skill_lv += sc->getSCE(SC_RAISINGDRAGON)->val1;
 			if(sd->spiritball >= skill_lv) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
 				return false;
@@ -15569,36 +15569,36 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 		case MO_CHAINCOMBO:
 			if(!sc)
 				return false;
-			if(sc->data[SC_BLADESTOP])
+			if(sc->getSCE(SC_BLADESTOP))
 				break;
-			if(sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MO_TRIPLEATTACK)
+			if(sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == MO_TRIPLEATTACK)
 				break;
 			return false;
 		case MO_COMBOFINISH:
-			if(!(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MO_CHAINCOMBO))
+			if(!(sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == MO_CHAINCOMBO))
 				return false;
 			break;
 		case CH_TIGERFIST:
-			if(!(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == MO_COMBOFINISH))
+			if(!(sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == MO_COMBOFINISH))
 				return false;
 			break;
 		case CH_CHAINCRUSH:
-			if(!(sc && sc->data[SC_COMBO]))
+			if(!(sc && sc->getSCE(SC_COMBO)))
 				return false;
-			if(sc->data[SC_COMBO]->val1 != MO_COMBOFINISH && sc->data[SC_COMBO]->val1 != CH_TIGERFIST)
+			if(sc->getSCE(SC_COMBO)->val1 != MO_COMBOFINISH && sc->getSCE(SC_COMBO)->val1 != CH_TIGERFIST)
 				return false;
 			break;
 		case SJ_SOLARBURST:
-			if (!(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == SJ_PROMINENCEKICK))
+			if (!(sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == SJ_PROMINENCEKICK))
 				return 0;
 			break;
 		case MO_EXTREMITYFIST:
-	//		if(sc && sc->data[SC_EXTREMITYFIST]) //To disable Asura during the 5 min skill block uncomment this...
+	//		if(sc && sc->getSCE(SC_EXTREMITYFIST)) //To disable Asura during the 5 min skill block uncomment this...
 	//			return false;
-			if( sc && (sc->data[SC_BLADESTOP] || sc->data[SC_CURSEDCIRCLE_ATKER]) )
+			if( sc && (sc->getSCE(SC_BLADESTOP) || sc->getSCE(SC_CURSEDCIRCLE_ATKER)) )
 				break;
-			if( sc && sc->data[SC_COMBO] ) {
-				switch(sc->data[SC_COMBO]->val1) {
+			if( sc && sc->getSCE(SC_COMBO) ) {
+				switch(sc->getSCE(SC_COMBO)->val1) {
 					case MO_COMBOFINISH:
 					case CH_TIGERFIST:
 					case CH_CHAINCRUSH:
@@ -15647,17 +15647,17 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 		case TK_COUNTER:
 			if ((sd->class_&MAPID_UPPERMASK) == MAPID_SOUL_LINKER)
 				return false; //Anti-Soul Linker check in case you job-changed with Stances active.
-			if(!(sc && sc->data[SC_COMBO]) || sc->data[SC_COMBO]->val1 == TK_JUMPKICK)
+			if(!(sc && sc->getSCE(SC_COMBO)) || sc->getSCE(SC_COMBO)->val1 == TK_JUMPKICK)
 				return false; //Combo needs to be ready
 
-			if (sc->data[SC_COMBO]->val3) {	//Kick chain
+			if (sc->getSCE(SC_COMBO)->val3) {	//Kick chain
 				//Do not repeat a kick.
-				if (sc->data[SC_COMBO]->val3 != skill_id)
+				if (sc->getSCE(SC_COMBO)->val3 != skill_id)
 					break;
 				status_change_end(&sd->bl, SC_COMBO, INVALID_TIMER);
 				return false;
 			}
-			if(sc->data[SC_COMBO]->val1 != skill_id && !pc_is_taekwon_ranker(sd)) {	//Cancel combo wait.
+			if(sc->getSCE(SC_COMBO)->val1 != skill_id && !pc_is_taekwon_ranker(sd)) {	//Cancel combo wait.
 				unit_cancel_combo(&sd->bl);
 				return false;
 			}
@@ -15666,14 +15666,14 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 		case BD_ADAPTATION:
 			{
 				int time;
-				if(!(sc && sc->data[SC_DANCING])) {
+				if(!(sc && sc->getSCE(SC_DANCING))) {
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
 					return false;
 				}
-				time = 1000*(sc->data[SC_DANCING]->val3>>16);
+				time = 1000*(sc->getSCE(SC_DANCING)->val3>>16);
 				if (skill_get_time(
-					(sc->data[SC_DANCING]->val1&0xFFFF), //Dance Skill ID
-					(sc->data[SC_DANCING]->val1>>16)) //Dance Skill LV
+					(sc->getSCE(SC_DANCING)->val1&0xFFFF), //Dance Skill ID
+					(sc->getSCE(SC_DANCING)->val1>>16)) //Dance Skill LV
 					- time < skill_get_time2(skill_id,skill_lv))
 				{
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
@@ -15689,11 +15689,11 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			}
 			break;
 		case SL_SMA:
-			if(sc && !(sc->data[SC_SMA] || sc->data[SC_USE_SKILL_SP_SHA]))
+			if(sc && !(sc->getSCE(SC_SMA) || sc->getSCE(SC_USE_SKILL_SP_SHA)))
 				return false;
 			break;
 		case HT_POWER:
-			if(!(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == AC_DOUBLE))
+			if(!(sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == AC_DOUBLE))
 				return false;
 			break;
 #ifndef RENEWAL
@@ -15706,15 +15706,11 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 #endif
 		case CG_MOONLIT: //Check there's no wall in the range+1 area around the caster. [Skotlex]
 			{
-				int s,range = skill_get_splash(skill_id, skill_lv)+1;
-				int size = range*2+1;
-				for (s=0;s<size*size;s++) {
-					int x = sd->bl.x+(s%size-range);
-					int y = sd->bl.y+(s/size-range);
-					if (map_getcell(sd->bl.m,x,y,CELL_CHKWALL)) {
-						clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
-						return false;
-					}
+				int range = skill_get_splash(skill_id, skill_lv)+1;
+
+				if (map_getcell_count(sd->bl.m,sd->bl.x-range,sd->bl.y-range,sd->bl.x+range,sd->bl.y+range,CELL_CHKWALL)) {
+					clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
+					return false;
 				}
 			}
 			break;
@@ -15731,18 +15727,14 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			}
 #ifndef RENEWAL
 		case HP_BASILICA:
-			if( !sc || (sc && !sc->data[SC_BASILICA])) {
+			if( !sc || (sc && !sc->getSCE(SC_BASILICA))) {
 				if( sd ) {
 					// When castbegin, needs 7x7 clear area
-					int s,range = skill_get_unit_layout_type(skill_id,skill_lv)+1;
-					int size = range*2+1;
-					for( s=0;s<size*size;s++ ) {
-						int x = sd->bl.x+(s%size-range);
-						int y = sd->bl.y+(s/size-range);
-						if( map_getcell(sd->bl.m,x,y,CELL_CHKWALL) ) {
-							clif_skill_fail(sd,skill_id,USESKILL_FAIL,0);
-							return false;
-						}
+					int range = skill_get_unit_layout_type(skill_id,skill_lv)+1;
+
+					if( map_getcell_count(sd->bl.m,sd->bl.x-range,sd->bl.y-range,sd->bl.x+range,sd->bl.y+range,CELL_CHKWALL) ) {
+						clif_skill_fail(sd,skill_id,USESKILL_FAIL,0);
+						return false;
 					}
 					if( map_foreachinallrange(skill_count_wos, &sd->bl, range, BL_MOB|BL_PC, &sd->bl) ) {
 						clif_skill_fail(sd,skill_id,USESKILL_FAIL,0);
@@ -15762,7 +15754,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 		case SG_SUN_WARM:
 		case SG_MOON_WARM:
 		case SG_STAR_WARM:
-			if (sc && sc->data[SC_MIRACLE])
+			if (sc && sc->getSCE(SC_MIRACLE))
 				break;
 			i = skill_id-SG_SUN_WARM;
 			if (sd->bl.m == sd->feel_map[i].m)
@@ -15773,7 +15765,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 		case SG_SUN_COMFORT:
 		case SG_MOON_COMFORT:
 		case SG_STAR_COMFORT:
-			if (sc && sc->data[SC_MIRACLE])
+			if (sc && sc->getSCE(SC_MIRACLE))
 				break;
 			i = skill_id-SG_SUN_COMFORT;
 			if (sd->bl.m == sd->feel_map[i].m &&
@@ -15782,7 +15774,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
 			return false;
 		case SG_FUSION:
-			if (sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_STAR)
+			if (sc && sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_STAR)
 				break;
 			//Auron insists we should implement SP consumption when you are not Soul Linked. [Skotlex]
 			//Only invoke on skill begin cast (instant cast skill). [Kevin]
@@ -15827,7 +15819,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 				return false;
 			}
 		case NJ_BUNSINJYUTSU:
-			if (!(sc && sc->data[SC_NEN])) {
+			if (!(sc && sc->getSCE(SC_NEN))) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
 				return false;
 			}
@@ -15886,7 +15878,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 		case WL_SUMMONWB:
 		case WL_SUMMONSTONE:
 			if (skill_lv == 1 && sc) { // Failure only happens on level 1
-				ARR_FIND(SC_SPHERE_1, SC_SPHERE_5 + 1, i, !sc->data[i]);
+				ARR_FIND(SC_SPHERE_1, SC_SPHERE_5 + 1, i, !sc->getSCE(i));
 
 				if (i == SC_SPHERE_5 + 1) { // No more free slots
 					clif_skill_fail(sd, skill_id, USESKILL_FAIL_SUMMON, 0);
@@ -15899,7 +15891,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 				int active_spheres = 0, req_spheres = 0;
 
 				for (i = SC_SPHERE_1; i <= SC_SPHERE_5; i++) {
-					if (sc && sc->data[i])
+					if (sc && sc->getSCE(i))
 						active_spheres++;
 				}
 
@@ -15916,18 +15908,18 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			}
 			break;
 		case GC_HALLUCINATIONWALK:
-			if( sc && (sc->data[SC_HALLUCINATIONWALK] || sc->data[SC_HALLUCINATIONWALK_POSTDELAY]) ) {
+			if( sc && (sc->getSCE(SC_HALLUCINATIONWALK) || sc->getSCE(SC_HALLUCINATIONWALK_POSTDELAY)) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
 				return false;
 			}
 			break;
 		case NPC_HALLUCINATIONWALK:
-			if( sc && sc->data[SC_NPC_HALLUCINATIONWALK] ) {
+			if( sc && sc->getSCE(SC_NPC_HALLUCINATIONWALK) ) {
 				return false;
 			}
 			break;
 		case RA_WUGMASTERY:
-			if( (pc_isfalcon(sd) && !battle_config.warg_can_falcon) || pc_isridingwug(sd) || sd->sc.data[SC__GROOMY]) {
+			if( (pc_isfalcon(sd) && !battle_config.warg_can_falcon) || pc_isridingwug(sd) || sd->sc.getSCE(SC__GROOMY)) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
 				return false;
 			}
@@ -15971,13 +15963,13 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			break;
 		case LG_RAYOFGENESIS:
 		case LG_BANDING:
-			if( sc && sc->data[SC_INSPIRATION] )
+			if( sc && sc->getSCE(SC_INSPIRATION) )
 				return true; // Don't check for partner.
 			break;
 		case LG_PRESTIGE:
-			if( sc && sc->data[SC_INSPIRATION] )
+			if( sc && sc->getSCE(SC_INSPIRATION) )
 				return true; // Don't check for partner.
-			if( sc && sc->data[SC_BANDING] ) {
+			if( sc && sc->getSCE(SC_BANDING) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
 				return false;
 			}
@@ -15990,12 +15982,12 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			sd->spiritball_old = require.spiritball = sd->spiritball;
 			break;
 		case SR_FALLENEMPIRE:
-			if( !(sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == SR_DRAGONCOMBO) )
+			if( !(sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == SR_DRAGONCOMBO) )
 				return false;
 			break;
 
 		case SR_CRESCENTELBOW:
-			if( sc && sc->data[SC_CRESCENTELBOW] ) {
+			if( sc && sc->getSCE(SC_CRESCENTELBOW) ) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL_DUPLICATE, 0);
 				return false;
 			}
@@ -16024,7 +16016,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			break;
 		case SC_MANHOLE:
 		case SC_DIMENSIONDOOR:
-			if( sc && sc->data[SC_MAGNETICFIELD] ) {
+			if( sc && sc->getSCE(SC_MAGNETICFIELD) ) {
 				clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
 				return false;
 			}
@@ -16046,8 +16038,8 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 		case SO_ELECTRICWALK:
 		case NPC_FIREWALK:
 		case NPC_ELECTRICWALK:	// Can't be casted until you've walked all cells.
-			if( sc && sc->data[SC_PROPERTYWALK] &&
-			   sc->data[SC_PROPERTYWALK]->val3 < skill_get_maxcount(sc->data[SC_PROPERTYWALK]->val1,sc->data[SC_PROPERTYWALK]->val2) ) {
+			if( sc && sc->getSCE(SC_PROPERTYWALK) &&
+			   sc->getSCE(SC_PROPERTYWALK)->val3 < skill_get_maxcount(sc->getSCE(SC_PROPERTYWALK)->val1,sc->getSCE(SC_PROPERTYWALK)->val2) ) {
 				if( sd )
 					clif_skill_fail(sd,skill_id,USESKILL_FAIL_LEVEL,0);
 				return false;
@@ -16084,7 +16076,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			}
 			break;
 		case SJ_FULLMOONKICK:
-			if (!(sc && sc->data[SC_NEWMOON])) {
+			if (!(sc && sc->getSCE(SC_NEWMOON))) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL_LEVEL, 0);
 				return false;
 			}
@@ -16102,7 +16094,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			}
 			break;
 		case SP_SWHOO:
-			if (!(sc && sc->data[SC_USE_SKILL_SP_SPA]))
+			if (!(sc && sc->getSCE(SC_USE_SKILL_SP_SPA)))
 				return false;
 			break;
 	}
@@ -16150,7 +16142,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			}
 			break;
 		case ST_MOVE_ENABLE:
-			if (sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == skill_id)
+			if (sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == skill_id)
 				sd->ud.canmove_tick = gettick(); //When using a combo, cancel the can't move delay to enable the skill. [Skotlex]
 
 			if (!unit_can_move(&sd->bl)) {
@@ -16159,7 +16151,7 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			}
 			break;
 		case ST_WATER:
-			if (sc && (sc->data[SC_DELUGE] || sc->data[SC_SUITON]))
+			if (sc && (sc->getSCE(SC_DELUGE) || sc->getSCE(SC_SUITON)))
 				break;
 			if (map_getcell(sd->bl.m,sd->bl.x,sd->bl.y,CELL_CHKWATER) && !map_getcell(sd->bl.m,sd->bl.x,sd->bl.y,CELL_CHKLANDPROTECTOR))
 				break;
@@ -16203,25 +16195,25 @@ bool skill_check_condition_castbegin(struct map_session_data* sd, uint16 skill_i
 			}
 			break;
 		case ST_SUNSTANCE:
-			if (!(sc && (sc->data[SC_SUNSTANCE] || sc->data[SC_UNIVERSESTANCE]))) {
+			if (!(sc && (sc->getSCE(SC_SUNSTANCE) || sc->getSCE(SC_UNIVERSESTANCE)))) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL, 0);
 				return false;
 			}
 			break;
 		case ST_MOONSTANCE:
-			if (!(sc && (sc->data[SC_LUNARSTANCE] || sc->data[SC_UNIVERSESTANCE]))) {
+			if (!(sc && (sc->getSCE(SC_LUNARSTANCE) || sc->getSCE(SC_UNIVERSESTANCE)))) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL, 0);
 				return false;
 			}
 			break;
 		case ST_STARSTANCE:
-			if (!(sc && (sc->data[SC_STARSTANCE] || sc->data[SC_UNIVERSESTANCE]))) {
+			if (!(sc && (sc->getSCE(SC_STARSTANCE) || sc->getSCE(SC_UNIVERSESTANCE)))) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL, 0);
 				return false;
 			}
 			break;
 		case ST_UNIVERSESTANCE:
-			if (!(sc && sc->data[SC_UNIVERSESTANCE])) {
+			if (!(sc && sc->getSCE(SC_UNIVERSESTANCE))) {
 				clif_skill_fail(sd, skill_id, USESKILL_FAIL, 0);
 				return false;
 			}
@@ -16662,27 +16654,27 @@ void skill_consume_requirement(struct map_session_data *sd, uint16 skill_id, uin
 			if( !require.itemid[i] )
 				continue;
 
-			if( itemdb_group.item_exists(IG_GEMSTONE, require.itemid[i]) && skill_id != HW_GANBANTEIN && sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_WIZARD )
+			if( itemdb_group.item_exists(IG_GEMSTONE, require.itemid[i]) && skill_id != HW_GANBANTEIN && sc && sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_WIZARD )
 				continue; //Gemstones are checked, but not substracted from inventory.
 
 			switch( skill_id ){
 				case SA_SEISMICWEAPON:
-					if( sc && sc->data[SC_UPHEAVAL_OPTION] && rnd()%100 < 50 )
+					if( sc && sc->getSCE(SC_UPHEAVAL_OPTION) && rnd()%100 < 50 )
 						continue;
 					break;
 				case SA_FLAMELAUNCHER:
 				case SA_VOLCANO:
-					if( sc && sc->data[SC_TROPIC_OPTION] && rnd()%100 < 50 )
+					if( sc && sc->getSCE(SC_TROPIC_OPTION) && rnd()%100 < 50 )
 						continue;
 					break;
 				case SA_FROSTWEAPON:
 				case SA_DELUGE:
-					if( sc && sc->data[SC_CHILLY_AIR_OPTION] && rnd()%100 < 50 )
+					if( sc && sc->getSCE(SC_CHILLY_AIR_OPTION) && rnd()%100 < 50 )
 						continue;
 					break;
 				case SA_LIGHTNINGLOADER:
 				case SA_VIOLENTGALE:
-					if( sc && sc->data[SC_WILD_STORM_OPTION] && rnd()%100 < 50 )
+					if( sc && sc->getSCE(SC_WILD_STORM_OPTION) && rnd()%100 < 50 )
 						continue;
 					break;
 			}
@@ -16767,29 +16759,29 @@ struct s_skill_condition skill_get_requirement(struct map_session_data* sd, uint
 	req.sp = cap_value(req.sp * sp_skill_rate_bonus / 100, 0, SHRT_MAX);
 
 	if( sc ) {
-		if( sc->data[SC__LAZINESS] )
-			req.sp += req.sp + sc->data[SC__LAZINESS]->val1 * 10;
-		if( sc->data[SC_RECOGNIZEDSPELL] )
+		if( sc->getSCE(SC__LAZINESS) )
+			req.sp += req.sp + sc->getSCE(SC__LAZINESS)->val1 * 10;
+		if( sc->getSCE(SC_RECOGNIZEDSPELL) )
 			req.sp += req.sp / 4;
-		if( sc->data[SC_OFFERTORIUM])
-			req.sp += req.sp * sc->data[SC_OFFERTORIUM]->val3 / 100;
-		if( sc->data[SC_TELEKINESIS_INTENSE] && skill_get_ele(skill_id, skill_lv) == ELE_GHOST)
-			req.sp -= req.sp * sc->data[SC_TELEKINESIS_INTENSE]->val2 / 100;
+		if( sc->getSCE(SC_OFFERTORIUM))
+			req.sp += req.sp * sc->getSCE(SC_OFFERTORIUM)->val3 / 100;
+		if( sc->getSCE(SC_TELEKINESIS_INTENSE) && skill_get_ele(skill_id, skill_lv) == ELE_GHOST)
+			req.sp -= req.sp * sc->getSCE(SC_TELEKINESIS_INTENSE)->val2 / 100;
 #ifdef RENEWAL
-		if (sc->data[SC_ADAPTATION] && (skill_get_inf2(skill_id, INF2_ISSONG)))
+		if (sc->getSCE(SC_ADAPTATION) && (skill_get_inf2(skill_id, INF2_ISSONG)))
 			req.sp -= req.sp * 20 / 100;
-		if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_SPCONSUM)
+		if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_SPCONSUM)
 			req.sp -= req.sp * 30 / 100;
 #endif
-		if (sc->data[SC_GLOOMYDAY])
+		if (sc->getSCE(SC_GLOOMYDAY))
 			req.sp += req.sp * (skill_lv * 10) / 100;
 	}
 
 	req.zeny = skill->require.zeny[skill_lv-1];
 
-	if( sc && sc->data[SC__UNLUCKY] ) {
-		if(sc->data[SC__UNLUCKY]->val1 < 3)
-			req.zeny += sc->data[SC__UNLUCKY]->val1 * 250;
+	if( sc && sc->getSCE(SC__UNLUCKY) ) {
+		if(sc->getSCE(SC__UNLUCKY)->val1 < 3)
+			req.zeny += sc->getSCE(SC__UNLUCKY)->val1 * 250;
 		else
 			req.zeny += 1000;
 	}
@@ -16887,7 +16879,7 @@ struct s_skill_condition skill_get_requirement(struct map_session_data* sd, uint
 					if( sd->special_state.no_gemstone == 2 ) // Remove all Magic Stone required for all skills for VIP.
 						req.itemid[i] = req.amount[i] = 0;
 					else {
-						if( sd->special_state.no_gemstone || (sc && sc->data[SC_INTOABYSS]) )
+						if( sd->special_state.no_gemstone || (sc && sc->getSCE(SC_INTOABYSS)) )
 						{	// All gem skills except Hocus Pocus and Ganbantein can cast for free with Mistress card -helvetica
 							if( skill_id != SA_ABRACADABRA )
 		 						req.itemid[i] = req.amount[i] = 0;
@@ -16910,7 +16902,7 @@ struct s_skill_condition skill_get_requirement(struct map_session_data* sd, uint
 				req.zeny -= req.zeny*10/100;
 			break;
 		case AL_HOLYLIGHT:
-			if(sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_PRIEST)
+			if(sc && sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_PRIEST)
 				req.sp *= 5;
 			break;
 		case SL_SMA:
@@ -16933,20 +16925,20 @@ struct s_skill_condition skill_get_requirement(struct map_session_data* sd, uint
 		case MO_COMBOFINISH:
 		case CH_TIGERFIST:
 		case CH_CHAINCRUSH:
-			if(sc && sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_MONK)
+			if(sc && sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_MONK)
 				req.sp = 2; //Monk Spirit makes monk/champion combo skills cost 2 SP regardless of original cost
 			break;
 		case MO_BODYRELOCATION:
-			if( sc && sc->data[SC_EXPLOSIONSPIRITS] )
+			if( sc && sc->getSCE(SC_EXPLOSIONSPIRITS) )
 				req.spiritball = 0;
 			break;
 		case MO_EXTREMITYFIST:
 			if( sc ) {
-				if( sc->data[SC_BLADESTOP] )
+				if( sc->getSCE(SC_BLADESTOP) )
 					req.spiritball--;
-				else if( sc->data[SC_COMBO] ) {
+				else if( sc->getSCE(SC_COMBO) ) {
 #ifndef RENEWAL
-					switch( sc->data[SC_COMBO]->val1 ) {
+					switch( sc->getSCE(SC_COMBO)->val1 ) {
 						case MO_COMBOFINISH:
 							req.spiritball = 4;
 							break;
@@ -16960,7 +16952,7 @@ struct s_skill_condition skill_get_requirement(struct map_session_data* sd, uint
 #else
 					req.spiritball = sd->spiritball ? sd->spiritball : 1;
 #endif
-				} else if( sc->data[SC_RAISINGDRAGON] && sd->spiritball > 5)
+				} else if( sc->getSCE(SC_RAISINGDRAGON) && sd->spiritball > 5)
 					req.spiritball = sd->spiritball; // must consume all regardless of the amount required
 			}
 			break;
@@ -16968,7 +16960,7 @@ struct s_skill_condition skill_get_requirement(struct map_session_data* sd, uint
 			req.spiritball = sd->spiritball?sd->spiritball:1;
 			break;
 		case SR_GATEOFHELL:
-			if( sc && sc->data[SC_COMBO] && sc->data[SC_COMBO]->val1 == SR_FALLENEMPIRE )
+			if( sc && sc->getSCE(SC_COMBO) && sc->getSCE(SC_COMBO)->val1 == SR_FALLENEMPIRE )
 				req.sp -= req.sp * 10 / 100;
 			break;
 		case SO_SUMMON_AGNI:
@@ -16982,7 +16974,7 @@ struct s_skill_condition skill_get_requirement(struct map_session_data* sd, uint
 			}
 			break;
 		case SO_PSYCHIC_WAVE:
-			if( sc && (sc->data[SC_HEATER_OPTION] || sc->data[SC_COOLER_OPTION] || sc->data[SC_CURSED_SOIL_OPTION] || sc->data[SC_BLAST_OPTION]) )
+			if( sc && (sc->getSCE(SC_HEATER_OPTION) || sc->getSCE(SC_COOLER_OPTION) || sc->getSCE(SC_CURSED_SOIL_OPTION) || sc->getSCE(SC_BLAST_OPTION)) )
 				req.sp += req.sp / 2; // 1.5x SP cost
 			break;
 	}
@@ -17083,15 +17075,15 @@ int skill_castfix(struct block_list *bl, uint16 skill_id, uint16 skill_lv) {
 		// These cast time reductions are processed even if the skill fails
 		if (sc && sc->count) {
 			// Magic Strings stacks additively with item bonuses
-			if (!(flag&2) && sc->data[SC_POEMBRAGI])
-				reduce_cast_rate += sc->data[SC_POEMBRAGI]->val2;
+			if (!(flag&2) && sc->getSCE(SC_POEMBRAGI))
+				reduce_cast_rate += sc->getSCE(SC_POEMBRAGI)->val2;
 			// Foresight halves the cast time, it does not stack additively
-			if (sc->data[SC_MEMORIZE]) {
+			if (sc->getSCE(SC_MEMORIZE)) {
 				if (!sd || pc_checkskill(sd, skill_id) > 0) { // Foresight only decreases cast times from learned skills, not skills granted by items
 					if(!(flag&2))
 						time -= time * 50 / 100;
 					// Foresight counter gets reduced even if the skill is not affected by it
-					if ((--sc->data[SC_MEMORIZE]->val2) <= 0)
+					if ((--sc->getSCE(SC_MEMORIZE)->val2) <= 0)
 						status_change_end(bl, SC_MEMORIZE, INVALID_TIMER);
 				}
 			}
@@ -17130,16 +17122,16 @@ int skill_castfix_sc(struct block_list *bl, double time, uint8 flag)
 
 	if (sc && sc->count) {
 		if (!(flag&2)) {
-			if (sc->data[SC_SLOWCAST])
-				time += time * sc->data[SC_SLOWCAST]->val2 / 100;
-			if (sc->data[SC_PARALYSIS])
-				time += sc->data[SC_PARALYSIS]->val3;
-			if (sc->data[SC_IZAYOI])
+			if (sc->getSCE(SC_SLOWCAST))
+				time += time * sc->getSCE(SC_SLOWCAST)->val2 / 100;
+			if (sc->getSCE(SC_PARALYSIS))
+				time += sc->getSCE(SC_PARALYSIS)->val3;
+			if (sc->getSCE(SC_IZAYOI))
 				time -= time * 50 / 100;
 		}
-		if (sc->data[SC_SUFFRAGIUM]) {
+		if (sc->getSCE(SC_SUFFRAGIUM)) {
 			if(!(flag&2))
-				time -= time * sc->data[SC_SUFFRAGIUM]->val2 / 100;
+				time -= time * sc->getSCE(SC_SUFFRAGIUM)->val2 / 100;
 			//Suffragium ends even if the skill is not affected by it
 			status_change_end(bl, SC_SUFFRAGIUM, INVALID_TIMER);
 		}
@@ -17228,60 +17220,60 @@ int skill_vfcastfix(struct block_list *bl, double time, uint16 skill_id, uint16
 	// Adjusted by active statuses
 	if (sc && sc->count && !(flag&2)) {
 		// Multiplicative Variable CastTime values
-		if (sc->data[SC_SLOWCAST])
-			VARCAST_REDUCTION(-sc->data[SC_SLOWCAST]->val2);
-		if (sc->data[SC__LAZINESS])
-			VARCAST_REDUCTION(-sc->data[SC__LAZINESS]->val2);
-		if (sc->data[SC_SUFFRAGIUM]) {
-			VARCAST_REDUCTION(sc->data[SC_SUFFRAGIUM]->val2);
+		if (sc->getSCE(SC_SLOWCAST))
+			VARCAST_REDUCTION(-sc->getSCE(SC_SLOWCAST)->val2);
+		if (sc->getSCE(SC__LAZINESS))
+			VARCAST_REDUCTION(-sc->getSCE(SC__LAZINESS)->val2);
+		if (sc->getSCE(SC_SUFFRAGIUM)) {
+			VARCAST_REDUCTION(sc->getSCE(SC_SUFFRAGIUM)->val2);
 #ifndef RENEWAL
 			status_change_end(bl, SC_SUFFRAGIUM, INVALID_TIMER);
 #endif
 		}
-		if (sc->data[SC_MEMORIZE]) {
+		if (sc->getSCE(SC_MEMORIZE)) {
 			if (!sd || pc_checkskill(sd, skill_id) > 0) { // Foresight only decreases cast times from learned skills, not skills granted by items
 				reduce_cast_rate += 50;
-				if ((--sc->data[SC_MEMORIZE]->val2) <= 0)
+				if ((--sc->getSCE(SC_MEMORIZE)->val2) <= 0)
 					status_change_end(bl, SC_MEMORIZE, INVALID_TIMER);
 			}
 		}
-		if (sc->data[SC_POEMBRAGI])
-			reduce_cast_rate += sc->data[SC_POEMBRAGI]->val2;
-		if (sc->data[SC_IZAYOI])
+		if (sc->getSCE(SC_POEMBRAGI))
+			reduce_cast_rate += sc->getSCE(SC_POEMBRAGI)->val2;
+		if (sc->getSCE(SC_IZAYOI))
 			VARCAST_REDUCTION(50);
-		if (sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 3 && skill_get_type(skill_id) == BF_MAGIC && skill_get_ele(skill_id, skill_lv) == ELE_WATER)
+		if (sc->getSCE(SC_WATER_INSIGNIA) && sc->getSCE(SC_WATER_INSIGNIA)->val1 == 3 && skill_get_type(skill_id) == BF_MAGIC && skill_get_ele(skill_id, skill_lv) == ELE_WATER)
 			VARCAST_REDUCTION(30); //Reduces 30% Variable Cast Time of magic Water spells.
-		if (sc->data[SC_TELEKINESIS_INTENSE])
-			VARCAST_REDUCTION(sc->data[SC_TELEKINESIS_INTENSE]->val2);
-		if (sc->data[SC_SOULFAIRY])
-			VARCAST_REDUCTION(sc->data[SC_SOULFAIRY]->val3);
-		if (sc->data[SC_EP16_2_BUFF_AC])
+		if (sc->getSCE(SC_TELEKINESIS_INTENSE))
+			VARCAST_REDUCTION(sc->getSCE(SC_TELEKINESIS_INTENSE)->val2);
+		if (sc->getSCE(SC_SOULFAIRY))
+			VARCAST_REDUCTION(sc->getSCE(SC_SOULFAIRY)->val3);
+		if (sc->getSCE(SC_EP16_2_BUFF_AC))
 			VARCAST_REDUCTION(80);
 		// Multiplicative Fixed CastTime values
-		if (sc->data[SC_SECRAMENT])
-			fixcast_r = max(fixcast_r, sc->data[SC_SECRAMENT]->val2);
+		if (sc->getSCE(SC_SECRAMENT))
+			fixcast_r = max(fixcast_r, sc->getSCE(SC_SECRAMENT)->val2);
 		if (sd && (skill_lv = pc_checkskill(sd, WL_RADIUS) ) && skill_id >= WL_WHITEIMPRISON && skill_id <= WL_FREEZE_SP)
 			fixcast_r = max(fixcast_r, ((status_get_int(bl) + status_get_lv(bl)) / 15 + skill_lv * 5));
-		if (sc->data[SC_DANCEWITHWUG])
-			fixcast_r = max(fixcast_r, sc->data[SC_DANCEWITHWUG]->val4);
-		if (sc->data[SC_HEAT_BARREL])
-			fixcast_r = max(fixcast_r, sc->data[SC_HEAT_BARREL]->val2);
-		if (sc->data[SC_FREEZING])
+		if (sc->getSCE(SC_DANCEWITHWUG))
+			fixcast_r = max(fixcast_r, sc->getSCE(SC_DANCEWITHWUG)->val4);
+		if (sc->getSCE(SC_HEAT_BARREL))
+			fixcast_r = max(fixcast_r, sc->getSCE(SC_HEAT_BARREL)->val2);
+		if (sc->getSCE(SC_FREEZING))
 			fixcast_r -= 50;
-		if (sc->data[SC_SWINGDANCE])
+		if (sc->getSCE(SC_SWINGDANCE))
 			fixcast_r = max(fixcast_r, skill_lv * 6);
 		// Additive Fixed CastTime values
-		if (sc->data[SC_MANDRAGORA])
-			fixed += sc->data[SC_MANDRAGORA]->val1 * 500;
-		if (sc->data[SC_GUST_OPTION] || sc->data[SC_BLAST_OPTION] || sc->data[SC_WILD_STORM_OPTION])
+		if (sc->getSCE(SC_MANDRAGORA))
+			fixed += sc->getSCE(SC_MANDRAGORA)->val1 * 500;
+		if (sc->getSCE(SC_GUST_OPTION) || sc->getSCE(SC_BLAST_OPTION) || sc->getSCE(SC_WILD_STORM_OPTION))
 			fixed -= 1000;
-		if (sc->data[SC_IZAYOI])
+		if (sc->getSCE(SC_IZAYOI))
 			fixed = 0;
-		if (sc->data[SC_GLOOMYDAY])
+		if (sc->getSCE(SC_GLOOMYDAY))
 			fixed += skill_lv * 500;
 	}
-	if (sc && sc->data[SC_SECRAMENT] && skill_id == HW_MAGICPOWER && (flag&2)) // Sacrament lowers Mystical Amplification cast time
-		fixcast_r = max(fixcast_r, sc->data[SC_SECRAMENT]->val2);
+	if (sc && sc->getSCE(SC_SECRAMENT) && skill_id == HW_MAGICPOWER && (flag&2)) // Sacrament lowers Mystical Amplification cast time
+		fixcast_r = max(fixcast_r, sc->getSCE(SC_SECRAMENT)->val2);
 
 	if (varcast_r < 0)
 		time = time * (1 - (float)min(varcast_r, 100) / 100);
@@ -17335,7 +17327,7 @@ int skill_delayfix(struct block_list *bl, uint16 skill_id, uint16 skill_lv)
 			break;
 #ifndef RENEWAL
 		case HP_BASILICA:
-			if (sc && !sc->data[SC_BASILICA])
+			if (sc && !sc->getSCE(SC_BASILICA))
 				time = 0; // There is no Delay on Basilica creation, only on cancel
 			break;
 #endif
@@ -17359,14 +17351,14 @@ int skill_delayfix(struct block_list *bl, uint16 skill_id, uint16 skill_lv)
 	}
 
 	if (sc && sc->count) {
-		if (sc->data[SC_SPIRIT]) {
+		if (sc->getSCE(SC_SPIRIT)) {
 			switch (skill_id) {
 				case CR_SHIELDBOOMERANG:
-					if (sc->data[SC_SPIRIT]->val2 == SL_CRUSADER)
+					if (sc->getSCE(SC_SPIRIT)->val2 == SL_CRUSADER)
 						time /= 2;
 					break;
 				case AS_SONICBLOW:
-					if (!map_flag_gvg2(bl->m) && !map_getmapflag(bl->m, MF_BATTLEGROUND) && sc->data[SC_SPIRIT]->val2 == SL_ASSASIN)
+					if (!map_flag_gvg2(bl->m) && !map_getmapflag(bl->m, MF_BATTLEGROUND) && sc->getSCE(SC_SPIRIT)->val2 == SL_ASSASIN)
 						time /= 2;
 					break;
 			}
@@ -17377,12 +17369,12 @@ int skill_delayfix(struct block_list *bl, uint16 skill_id, uint16 skill_lv)
 
 	if (!(delaynodex&2)) {
 		if (sc && sc->count) {
-			if (sc->data[SC_POEMBRAGI])
-				delay += sc->data[SC_POEMBRAGI]->val3;
-			if (sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 3 && skill_get_type(skill_id) == BF_MAGIC && skill_get_ele(skill_id, skill_lv) == ELE_WIND)
+			if (sc->getSCE(SC_POEMBRAGI))
+				delay += sc->getSCE(SC_POEMBRAGI)->val3;
+			if (sc->getSCE(SC_WIND_INSIGNIA) && sc->getSCE(SC_WIND_INSIGNIA)->val1 == 3 && skill_get_type(skill_id) == BF_MAGIC && skill_get_ele(skill_id, skill_lv) == ELE_WIND)
 				delay += 50; // After Delay of Wind element spells reduced by 50%.
-			if (sc->data[SC_MAGICMUSHROOM] && sc->data[SC_MAGICMUSHROOM]->val3 == 0)
-				delay += sc->data[SC_MAGICMUSHROOM]->val2;
+			if (sc->getSCE(SC_MAGICMUSHROOM) && sc->getSCE(SC_MAGICMUSHROOM)->val3 == 0)
+				delay += sc->getSCE(SC_MAGICMUSHROOM)->val2;
 		}
 	}
 
@@ -17636,14 +17628,14 @@ int skill_autospell(struct map_session_data *sd, uint16 skill_id)
 		return 0; // Player must learn the skill before doing auto-spell [Lance]
 
 #ifdef RENEWAL
-	if ((skill_id == MG_COLDBOLT || skill_id == MG_FIREBOLT || skill_id == MG_LIGHTNINGBOLT) && sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_SAGE)
+	if ((skill_id == MG_COLDBOLT || skill_id == MG_FIREBOLT || skill_id == MG_LIGHTNINGBOLT) && sd->sc.getSCE(SC_SPIRIT) && sd->sc.getSCE(SC_SPIRIT)->val2 == SL_SAGE)
 		maxlv = 10; //Soul Linker bonus. [Skotlex]
 	else
 		maxlv = skill_lv / 2; // Half of Autospell's level unless player learned a lower level (capped below)
 #else
 	if(skill_id==MG_NAPALMBEAT)	maxlv=3;
 	else if(skill_id==MG_COLDBOLT || skill_id==MG_FIREBOLT || skill_id==MG_LIGHTNINGBOLT){
-		if (sd->sc.data[SC_SPIRIT] && sd->sc.data[SC_SPIRIT]->val2 == SL_SAGE)
+		if (sd->sc.getSCE(SC_SPIRIT) && sd->sc.getSCE(SC_SPIRIT)->val2 == SL_SAGE)
 			maxlv = 10; //Soul Linker bonus. [Skotlex]
 		else if(skill_lv==2) maxlv=1;
 		else if(skill_lv==3) maxlv=2;
@@ -18433,12 +18425,12 @@ void skill_enchant_elemental_end(struct block_list *bl, int type)
 		status_change_end(bl, SC_ENCHANTARMS, INVALID_TIMER); // Should always end except on equip change
 	else {
 		// Check for seven wind (but not level seven!)
-		if (sc->data[SC_SEVENWIND] && sc->data[SC_SEVENWIND]->val1 < 7)
+		if (sc->getSCE(SC_SEVENWIND) && sc->getSCE(SC_SEVENWIND)->val1 < 7)
 			return;
 	}
 
 	for (i = 0; i < ARRAYLENGTH(scs); i++)
-		if (type != scs[i] && sc->data[scs[i]])
+		if (type != scs[i] && sc->getSCE(scs[i]))
 			status_change_end(bl, scs[i], INVALID_TIMER);
 }
 
@@ -18499,8 +18491,8 @@ bool skill_check_shadowform(struct block_list *bl, int64 damage, int hit)
 
 	sc = status_get_sc(bl);
 
-	if( sc && sc->data[SC__SHADOWFORM] ) {
-		struct block_list *src = map_id2bl(sc->data[SC__SHADOWFORM]->val2);
+	if( sc && sc->getSCE(SC__SHADOWFORM) ) {
+		struct block_list *src = map_id2bl(sc->getSCE(SC__SHADOWFORM)->val2);
 
 		if( !src || src->m != bl->m ) { 
 			status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
@@ -18515,7 +18507,7 @@ bool skill_check_shadowform(struct block_list *bl, int64 damage, int hit)
 		}
 
 		status_damage(bl, src, damage, 0, clif_damage(src, src, gettick(), 500, 500, damage, hit, (hit > 1 ? DMG_MULTI_HIT : DMG_NORMAL), 0, false), 0, SC__SHADOWFORM);
-		if( sc && sc->data[SC__SHADOWFORM] && (--sc->data[SC__SHADOWFORM]->val3) <= 0 ) {
+		if( sc && sc->getSCE(SC__SHADOWFORM) && (--sc->getSCE(SC__SHADOWFORM)->val3) <= 0 ) {
 			status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 			if( src->type == BL_PC )
 				((TBL_PC*)src)->shadowform_id = 0;
@@ -18759,8 +18751,8 @@ int skill_delunit(struct skill_unit* unit)
 		case SC_MANHOLE: // Note : Removing the unit don't remove the status (official info)
 			if( group->val2 ) { // Someone Traped
 				struct status_change *tsc = status_get_sc( map_id2bl(group->val2));
-				if( tsc && tsc->data[SC__MANHOLE] )
-					tsc->data[SC__MANHOLE]->val4 = 0; // Remove the Unit ID
+				if( tsc && tsc->getSCE(SC__MANHOLE) )
+					tsc->getSCE(SC__MANHOLE)->val4 = 0; // Remove the Unit ID
 			}
 			break;
 	}
@@ -18910,8 +18902,8 @@ int skill_delunitgroup_(std::shared_ptr<s_skill_unit_group> group, const char* f
 
 	if (skill_get_unit_flag_(group->skill_id, { UF_DANCE, UF_SONG, UF_ENSEMBLE })) {
 		struct status_change* sc = status_get_sc(src);
-		if (sc && sc->data[SC_DANCING]) {
-			sc->data[SC_DANCING]->val2 = 0 ; //This prevents status_change_end attempting to redelete the group. [Skotlex]
+		if (sc && sc->getSCE(SC_DANCING)) {
+			sc->getSCE(SC_DANCING)->val2 = 0 ; //This prevents status_change_end attempting to redelete the group. [Skotlex]
 			status_change_end(src, SC_DANCING, INVALID_TIMER);
 		}
 	}
@@ -18926,8 +18918,8 @@ int skill_delunitgroup_(std::shared_ptr<s_skill_unit_group> group, const char* f
 	}
 	if (i != SC_NONE) {
 		struct status_change *sc = status_get_sc(src);
-		if (sc && sc->data[i]) {
-			sc->data[i]->val3 = 0; //Remove reference to this group. [Skotlex]
+		if (sc && sc->getSCE(i)) {
+			sc->getSCE(i)->val3 = 0; //Remove reference to this group. [Skotlex]
 			status_change_end(src, (sc_type)i, INVALID_TIMER);
 		}
 	}
@@ -18939,18 +18931,18 @@ int skill_delunitgroup_(std::shared_ptr<s_skill_unit_group> group, const char* f
 			struct status_change *sc;
 			bool removed = true;
 			//Clear group id from status change
-			if (target && (sc = status_get_sc(target)) != NULL && sc->data[SC_SPIDERWEB]) {
-				if (sc->data[SC_SPIDERWEB]->val2 == group->group_id)
-					sc->data[SC_SPIDERWEB]->val2 = 0;
-				else if (sc->data[SC_SPIDERWEB]->val3 == group->group_id)
-					sc->data[SC_SPIDERWEB]->val3 = 0;
-				else if (sc->data[SC_SPIDERWEB]->val4 == group->group_id)
-					sc->data[SC_SPIDERWEB]->val4 = 0;
+			if (target && (sc = status_get_sc(target)) != NULL && sc->getSCE(SC_SPIDERWEB)) {
+				if (sc->getSCE(SC_SPIDERWEB)->val2 == group->group_id)
+					sc->getSCE(SC_SPIDERWEB)->val2 = 0;
+				else if (sc->getSCE(SC_SPIDERWEB)->val3 == group->group_id)
+					sc->getSCE(SC_SPIDERWEB)->val3 = 0;
+				else if (sc->getSCE(SC_SPIDERWEB)->val4 == group->group_id)
+					sc->getSCE(SC_SPIDERWEB)->val4 = 0;
 				else //Group was already removed in status_change_end, don't call it again!
 					removed = false;
 
 				//The last group was cleared, end status change
-				if(removed && sc->data[SC_SPIDERWEB]->val2 == 0 && sc->data[SC_SPIDERWEB]->val3 == 0 && sc->data[SC_SPIDERWEB]->val4 == 0)
+				if(removed && sc->getSCE(SC_SPIDERWEB)->val2 == 0 && sc->getSCE(SC_SPIDERWEB)->val3 == 0 && sc->getSCE(SC_SPIDERWEB)->val4 == 0)
 					status_change_end(target, SC_SPIDERWEB, INVALID_TIMER);
 			}
 		}
@@ -18963,8 +18955,8 @@ int skill_delunitgroup_(std::shared_ptr<s_skill_unit_group> group, const char* f
 				status_change *sc = status_get_sc(src);
 				sc_type type = status_skill2sc(group->skill_id);
 
-				if (sc && sc->data[type]) {
-					sc->data[type]->val4 = 0;
+				if (sc && sc->getSCE(type)) {
+					sc->getSCE(type)->val4 = 0;
 					status_change_end(src, type, INVALID_TIMER);
 				}
 			}
@@ -18973,9 +18965,9 @@ int skill_delunitgroup_(std::shared_ptr<s_skill_unit_group> group, const char* f
 			{
 				struct status_change *sc = NULL;
 				if( (sc = status_get_sc(src)) != NULL ) {
-					if ( sc->data[SC_NEUTRALBARRIER_MASTER] )
+					if ( sc->getSCE(SC_NEUTRALBARRIER_MASTER) )
 					{
-						sc->data[SC_NEUTRALBARRIER_MASTER]->val2 = 0;
+						sc->getSCE(SC_NEUTRALBARRIER_MASTER)->val2 = 0;
 						status_change_end(src,SC_NEUTRALBARRIER_MASTER,INVALID_TIMER);
 					}
 					status_change_end(src,SC_NEUTRALBARRIER,INVALID_TIMER);
@@ -18985,8 +18977,8 @@ int skill_delunitgroup_(std::shared_ptr<s_skill_unit_group> group, const char* f
 		case NC_STEALTHFIELD:
 			{
 				struct status_change *sc = NULL;
-				if( (sc = status_get_sc(src)) != NULL && sc->data[SC_STEALTHFIELD_MASTER] ) {
-					sc->data[SC_STEALTHFIELD_MASTER]->val2 = 0;
+				if( (sc = status_get_sc(src)) != NULL && sc->getSCE(SC_STEALTHFIELD_MASTER) ) {
+					sc->getSCE(SC_STEALTHFIELD_MASTER)->val2 = 0;
 					status_change_end(src,SC_STEALTHFIELD_MASTER,INVALID_TIMER);
 				}
 			}
@@ -19262,7 +19254,7 @@ static int skill_unit_timer_sub(DBKey key, DBData *data, va_list ap)
 			{
 				struct block_list *src = map_id2bl(group->src_id);
 				struct status_change *sc;
-				if( !src || (sc = status_get_sc(src)) == NULL || !sc->data[SC_BANDING] ) {
+				if( !src || (sc = status_get_sc(src)) == NULL || !sc->getSCE(SC_BANDING) ) {
 					skill_delunit(unit);
 					break;
 				}
@@ -20508,11 +20500,11 @@ void skill_toggle_magicpower(struct block_list *bl, uint16 skill_id)
 	if (skill_get_nk(skill_id, NK_NODAMAGE) || !(skill_get_type(skill_id)&BF_MAGIC))
 		return;
 
-	if (sc && sc->count && sc->data[SC_MAGICPOWER]) {
-		if (sc->data[SC_MAGICPOWER]->val4) {
+	if (sc && sc->count && sc->getSCE(SC_MAGICPOWER)) {
+		if (sc->getSCE(SC_MAGICPOWER)->val4) {
 			status_change_end(bl, SC_MAGICPOWER, INVALID_TIMER);
 		} else {
-			sc->data[SC_MAGICPOWER]->val4 = 1;
+			sc->getSCE(SC_MAGICPOWER)->val4 = 1;
 			status_calc_bl(bl, status_sc2scb_flag(SC_MAGICPOWER));
 			if(bl->type == BL_PC){// update current display.
 				clif_updatestatus(((TBL_PC *)bl),SP_MATK1);
@@ -20585,7 +20577,7 @@ void skill_spellbook(struct map_session_data *sd, t_itemid nameid) {
 	struct status_change *sc = status_get_sc(&sd->bl);
 
 	for (int i = SC_SPELLBOOK1; i <= SC_MAXSPELLBOOK; i++) {
-		if (sc == nullptr || sc->data[i] == nullptr)
+		if (sc == nullptr || sc->getSCE(i) == nullptr)
 			break;
 		if (i == SC_MAXSPELLBOOK) {
 			clif_skill_fail(sd, WL_READING_SB, USESKILL_FAIL_SPELLBOOK_READING, 0);
@@ -20608,14 +20600,14 @@ void skill_spellbook(struct map_session_data *sd, t_itemid nameid) {
 
 	int points = spell->points;
 
-	if (sc && sc->data[SC_FREEZE_SP]) {
-		if ((sc->data[SC_FREEZE_SP]->val2 + points) > 8 * pc_checkskill(sd, WL_FREEZE_SP) + status_get_int(&sd->bl) / 10 + sd->status.base_level / 10) {
+	if (sc && sc->getSCE(SC_FREEZE_SP)) {
+		if ((sc->getSCE(SC_FREEZE_SP)->val2 + points) > 8 * pc_checkskill(sd, WL_FREEZE_SP) + status_get_int(&sd->bl) / 10 + sd->status.base_level / 10) {
 			clif_skill_fail(sd, WL_READING_SB, USESKILL_FAIL_SPELLBOOK_PRESERVATION_POINT, 0);
 			return;
 		}
 		for (int i = SC_MAXSPELLBOOK; i >= SC_SPELLBOOK1; i--) { // This is how official saves spellbook. [malufett]
-			if (!sc->data[i]) {
-				sc->data[SC_FREEZE_SP]->val2 += points; // increase points
+			if (!sc->getSCE(i)) {
+				sc->getSCE(SC_FREEZE_SP)->val2 += points; // increase points
 				sc_start4(&sd->bl,&sd->bl, (sc_type)i, 100, skill_id, skill_lv, points, 0, INFINITE_TICK);
 				break;
 			}
@@ -20634,8 +20626,8 @@ int skill_select_menu(struct map_session_data *sd,uint16 skill_id) {
 	uint16 id, sk_idx = 0;
 	nullpo_ret(sd);
 
-	if (sd->sc.data[SC_STOP]) {
-		aslvl = sd->sc.data[SC_STOP]->val1;
+	if (sd->sc.getSCE(SC_STOP)) {
+		aslvl = sd->sc.getSCE(SC_STOP)->val1;
 		status_change_end(&sd->bl,SC_STOP,INVALID_TIMER);
 	}
 
@@ -21561,17 +21553,17 @@ int skill_disable_check(struct status_change *sc, uint16 skill_id)
 		case SJ_UNIVERSESTANCE:
 		case SJ_SUNSTANCE:
 		case SP_SOULCOLLECT:
-			if( sc->data[status_skill2sc(skill_id)] )
+			if( sc->getSCE(status_skill2sc(skill_id)) )
 				return 1;
 			break;
 
 		// These 2 skills contain a master and are not correctly pulled using skill2sc
 		case NC_NEUTRALBARRIER:
-			if( sc->data[SC_NEUTRALBARRIER_MASTER] )
+			if( sc->getSCE(SC_NEUTRALBARRIER_MASTER) )
 				return 1;
 			break;
 		case NC_STEALTHFIELD:
-			if( sc->data[SC_STEALTHFIELD_MASTER] )
+			if( sc->getSCE(SC_STEALTHFIELD_MASTER) )
 				return 1;
 			break;
 	}
@@ -21614,7 +21606,7 @@ static bool skill_check_unit_movepos(uint8 check_flag, struct block_list *bl, sh
 		return false;
 
 	sc = status_get_sc(bl);
-	if (sc && sc->data[SC_SV_ROOTTWIST])
+	if (sc && sc->getSCE(SC_SV_ROOTTWIST))
 		return false;
 
 	return unit_movepos(bl, dst_x, dst_y, easy, checkpath);
@@ -23132,6 +23124,7 @@ void skill_reload (void) {
 
 	skill_readdb();
 	initChangeTables(); // Re-init Status Change tables
+	pc_skilltree_cache_clear();
 
 	/* lets update all players skill tree : so that if any skill modes were changed they're properly updated */
 	s_mapiterator *iter = mapit_getallusers();
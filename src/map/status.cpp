@@ -2325,13 +2325,13 @@ int status_damage(struct block_list *src,struct block_list *target,int64 dhp, in
 		flag |= 8;
 
 	sc = status_get_sc(target);
-	if( hp && battle_config.invincible_nodamage && src && sc && sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+	if( hp && battle_config.invincible_nodamage && src && sc && sc->getSCE(SC_INVINCIBLE) && !sc->getSCE(SC_INVINCIBLEOFF) )
 		hp = 1;
 
 	if( hp && !(flag&1) ) {
 		if( sc ) {
 			struct status_change_entry *sce;
-			if (sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+			if (sc->getSCE(SC_STONE) && sc->opt1 == OPT1_STONE)
 				status_change_end(target, SC_STONE, INVALID_TIMER);
 			status_change_end(target, SC_FREEZE, INVALID_TIMER);
 			status_change_end(target, SC_SLEEP, INVALID_TIMER);
@@ -2345,7 +2345,7 @@ int status_damage(struct block_list *src,struct block_list *target,int64 dhp, in
 			status_change_end(target, SC_DEEPSLEEP, INVALID_TIMER);
 			status_change_end(target, SC_SUHIDE, INVALID_TIMER);
 			status_change_end(target, SC_NEWMOON, INVALID_TIMER);
-			if ((sce=sc->data[SC_ENDURE]) && !sce->val4) {
+			if ((sce=sc->getSCE(SC_ENDURE)) && !sce->val4) {
 				/** [Skotlex]
 				* Endure count is only reduced by non-players on non-gvg maps.
 				* val4 signals infinite endure.
@@ -2354,7 +2354,7 @@ int status_damage(struct block_list *src,struct block_list *target,int64 dhp, in
 					status_change_end(target, SC_ENDURE, INVALID_TIMER);
 			}
 #ifndef RENEWAL
-			if ((sce=sc->data[SC_GRAVITATION]) && sce->val3 == BCT_SELF) {
+			if ((sce=sc->getSCE(SC_GRAVITATION)) && sce->val3 == BCT_SELF) {
 				std::shared_ptr<s_skill_unit_group> sg = skill_id2group(sce->val4);
 
 				if (sg) {
@@ -2364,11 +2364,11 @@ int status_damage(struct block_list *src,struct block_list *target,int64 dhp, in
 				}
 			}
 #endif
-			if(sc->data[SC_DANCING] && (unsigned int)hp > status->max_hp>>2)
+			if(sc->getSCE(SC_DANCING) && (unsigned int)hp > status->max_hp>>2)
 				status_change_end(target, SC_DANCING, INVALID_TIMER);
-			if(sc->data[SC_CLOAKINGEXCEED] && --(sc->data[SC_CLOAKINGEXCEED]->val2) <= 0)
+			if(sc->getSCE(SC_CLOAKINGEXCEED) && --(sc->getSCE(SC_CLOAKINGEXCEED)->val2) <= 0)
 				status_change_end(target, SC_CLOAKINGEXCEED, INVALID_TIMER);
-			if(sc->data[SC_KAGEMUSYA] && --(sc->data[SC_KAGEMUSYA]->val3) <= 0)
+			if(sc->getSCE(SC_KAGEMUSYA) && --(sc->getSCE(SC_KAGEMUSYA)->val3) <= 0)
 				status_change_end(target, SC_KAGEMUSYA, INVALID_TIMER);
 		}
 
@@ -2381,15 +2381,15 @@ int status_damage(struct block_list *src,struct block_list *target,int64 dhp, in
 	status->sp-= sp;
 
 	if (sc && hp && status->hp) {
-		if (sc->data[SC_AUTOBERSERK] &&
-			(!sc->data[SC_PROVOKE] || !sc->data[SC_PROVOKE]->val2) &&
+		if (sc->getSCE(SC_AUTOBERSERK) &&
+			(!sc->getSCE(SC_PROVOKE) || !sc->getSCE(SC_PROVOKE)->val2) &&
 			status->hp < status->max_hp>>2)
 			sc_start4(src,target,SC_PROVOKE,100,10,1,0,0,0);
-		if (sc->data[SC_BERSERK] && status->hp <= 100)
+		if (sc->getSCE(SC_BERSERK) && status->hp <= 100)
 			status_change_end(target, SC_BERSERK, INVALID_TIMER);
-		if( sc->data[SC_RAISINGDRAGON] && status->hp <= 1000 )
+		if( sc->getSCE(SC_RAISINGDRAGON) && status->hp <= 1000 )
 			status_change_end(target, SC_RAISINGDRAGON, INVALID_TIMER);
-		if (sc->data[SC_SATURDAYNIGHTFEVER] && status->hp <= 100)
+		if (sc->getSCE(SC_SATURDAYNIGHTFEVER) && status->hp <= 100)
 			status_change_end(target, SC_SATURDAYNIGHTFEVER, INVALID_TIMER);
 	}
 
@@ -2449,13 +2449,13 @@ int status_damage(struct block_list *src,struct block_list *target,int64 dhp, in
 		}
 	}
 
-	if( sc && sc->data[SC_KAIZEL] && !map_flag_gvg2(target->m) ) { // flag&8 = disable Kaizel
-		int time = skill_get_time2(SL_KAIZEL,sc->data[SC_KAIZEL]->val1);
+	if( sc && sc->getSCE(SC_KAIZEL) && !map_flag_gvg2(target->m) ) { // flag&8 = disable Kaizel
+		int time = skill_get_time2(SL_KAIZEL,sc->getSCE(SC_KAIZEL)->val1);
 		// Look for Osiris Card's bonus effect on the character and revive 100% or revive normally
 		if ( target->type == BL_PC && BL_CAST(BL_PC,target)->special_state.restart_full_recover )
 			status_revive(target, 100, 100);
 		else
-			status_revive(target, sc->data[SC_KAIZEL]->val2, 0);
+			status_revive(target, sc->getSCE(SC_KAIZEL)->val2, 0);
 		status_change_clear(target,0);
 		clif_skill_nodamage(target,target,ALL_RESURRECTION,1,1);
 		sc_start(src,target,status_skill2sc(PR_KYRIE),100,10,time);
@@ -2465,8 +2465,8 @@ int status_damage(struct block_list *src,struct block_list *target,int64 dhp, in
 
 		return (int)(hp+sp);
 	}
-	if (target->type == BL_MOB && sc && sc->data[SC_REBIRTH] && !((TBL_MOB*) target)->state.rebirth) { // Ensure the monster has not already rebirthed before doing so.
-		status_revive(target, sc->data[SC_REBIRTH]->val2, 0);
+	if (target->type == BL_MOB && sc && sc->getSCE(SC_REBIRTH) && !((TBL_MOB*) target)->state.rebirth) { // Ensure the monster has not already rebirthed before doing so.
+		status_revive(target, sc->getSCE(SC_REBIRTH)->val2, 0);
 		status_change_clear(target,0);
 		((TBL_MOB*)target)->state.rebirth = 1;
 
@@ -2540,7 +2540,7 @@ int status_heal(struct block_list *bl,int64 hhp,int64 hsp, int flag)
 	}
 
 	if(hp) {
-		if( sc && (sc->data[SC_BERSERK]) ) {
+		if( sc && (sc->getSCE(SC_BERSERK)) ) {
 			if( flag&1 )
 				flag &= ~2;
 			else
@@ -2570,9 +2570,9 @@ int status_heal(struct block_list *bl,int64 hhp,int64 hsp, int flag)
 	status->sp += sp;
 
 	if(hp && sc &&
-		sc->data[SC_AUTOBERSERK] &&
-		sc->data[SC_PROVOKE] &&
-		sc->data[SC_PROVOKE]->val2==1 &&
+		sc->getSCE(SC_AUTOBERSERK) &&
+		sc->getSCE(SC_PROVOKE) &&
+		sc->getSCE(SC_PROVOKE)->val2==1 &&
 		status->hp>=status->max_hp>>2
 	)	// End auto berserk.
 		status_change_end(bl, SC_PROVOKE, INVALID_TIMER);
@@ -2769,12 +2769,12 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 		sc = status_get_sc(src);
 
 	if( sc && sc->count ) {
-		if (sc->data[SC_ALL_RIDING])
+		if (sc->getSCE(SC_ALL_RIDING))
 			return false; //You can't use skills while in the new mounts (The client doesn't let you, this is to make cheat-safe)
 
 		if (flag == 1 && !status_has_mode(status,MD_STATUSIMMUNE) && ( // Applies to after cast completion only and doesn't apply to Boss monsters.
-			(sc->data[SC_ASH] && rnd()%2) || // Volcanic Ash has a 50% chance of causing skills to fail.
-			(sc->data[SC_KYOMU] && rnd()%100 < 25) // Kyomu has a 25% chance of causing skills fail.
+			(sc->getSCE(SC_ASH) && rnd()%2) || // Volcanic Ash has a 50% chance of causing skills to fail.
+			(sc->getSCE(SC_KYOMU) && rnd()%100 < 25) // Kyomu has a 25% chance of causing skills fail.
 		)) {
 			if (src->type == BL_PC)
 				clif_skill_fail((TBL_PC*)src,skill_id,USESKILL_FAIL_LEVEL,0);
@@ -2789,22 +2789,22 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 		}
 
 		if (
-			(sc->data[SC_TRICKDEAD] && skill_id != NV_TRICKDEAD)
-			|| (sc->data[SC_AUTOCOUNTER] && !flag && skill_id)
-			|| (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF && skill_id != PA_GOSPEL)
-			|| (sc->data[SC_SUHIDE] && skill_id != SU_HIDE)
+			(sc->getSCE(SC_TRICKDEAD) && skill_id != NV_TRICKDEAD)
+			|| (sc->getSCE(SC_AUTOCOUNTER) && !flag && skill_id)
+			|| (sc->getSCE(SC_GOSPEL) && sc->getSCE(SC_GOSPEL)->val4 == BCT_SELF && skill_id != PA_GOSPEL)
+			|| (sc->getSCE(SC_SUHIDE) && skill_id != SU_HIDE)
 		)
 			return false;
 
-		if (sc->data[SC_WINKCHARM] && target && !flag) { // Prevents skill usage
+		if (sc->getSCE(SC_WINKCHARM) && target && !flag) { // Prevents skill usage
 			if (unit_bl2ud(src) && (unit_bl2ud(src))->walktimer == INVALID_TIMER)
-				unit_walktobl(src, map_id2bl(sc->data[SC_WINKCHARM]->val2), 3, 1);
+				unit_walktobl(src, map_id2bl(sc->getSCE(SC_WINKCHARM)->val2), 3, 1);
 			clif_emotion(src, ET_THROB);
 			return false;
 		}
 
-		if (sc->data[SC_BLADESTOP]) {
-			switch (sc->data[SC_BLADESTOP]->val1) {
+		if (sc->getSCE(SC_BLADESTOP)) {
+			switch (sc->getSCE(SC_BLADESTOP)->val1) {
 				case 5: if (skill_id == MO_EXTREMITYFIST) break;
 				case 4: if (skill_id == MO_CHAINCOMBO) break;
 				case 3: if (skill_id == MO_INVESTIGATE) break;
@@ -2813,7 +2813,7 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 			}
 		}
 
-		if (sc->data[SC_DANCING] && flag!=2) {
+		if (sc->getSCE(SC_DANCING) && flag!=2) {
 			std::shared_ptr<s_skill_db> skill = skill_db.find(skill_id);
 
 			if (!skill)
@@ -2825,14 +2825,14 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 				if( pc_checkskill((TBL_PC*)src,WM_LESSON) < 5 )
 					return false;
 #ifndef RENEWAL
-			} else if(sc->data[SC_LONGING]) { // Allow everything except dancing/re-dancing. [Skotlex]
+			} else if(sc->getSCE(SC_LONGING)) { // Allow everything except dancing/re-dancing. [Skotlex]
 				if (skill_id == BD_ENCORE || skill->inf2[INF2_ISSONG] || skill->inf2[INF2_ISENSEMBLE])
 					return false;
 #endif
 			} else if(!skill->inf2[INF2_ALLOWWHENPERFORMING]) // Skills that can be used in dancing state
 				return false;
 #ifndef RENEWAL
-			if ((sc->data[SC_DANCING]->val1&0xFFFF) == CG_HERMODE && skill_id == BD_ADAPTATION)
+			if ((sc->getSCE(SC_DANCING)->val1&0xFFFF) == CG_HERMODE && skill_id == BD_ADAPTATION)
 				return false; // Can't amp out of Wand of Hermode :/ [Skotlex]
 #endif
 		}
@@ -2843,30 +2843,30 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 			if (!flag && ( // Blocked only from using the skill (stuff like autospell may still go through
 				sc->cant.cast ||
 #ifndef RENEWAL
-				(sc->data[SC_BASILICA] && (sc->data[SC_BASILICA]->val4 != src->id || skill_id != HP_BASILICA)) || // Only Basilica caster that can cast, and only Basilica to cancel it
-#endif
-				(sc->data[SC_MARIONETTE] && skill_id != CG_MARIONETTE) || // Only skill you can use is marionette again to cancel it
-				(sc->data[SC_MARIONETTE2] && skill_id == CG_MARIONETTE) || // Cannot use marionette if you are being buffed by another
-				(sc->data[SC_ANKLE] && skill_block_check(src, SC_ANKLE, skill_id)) ||
-				(sc->data[SC_STASIS] && skill_block_check(src, SC_STASIS, skill_id)) ||
-				(sc->data[SC_BITE] && skill_block_check(src, SC_BITE, skill_id)) ||
-				(sc->data[SC_NOVAEXPLOSING] && skill_block_check(src, SC_NOVAEXPLOSING, skill_id)) ||
-				(sc->data[SC_GRAVITYCONTROL] && skill_block_check(src, SC_GRAVITYCONTROL, skill_id)) ||
-				(sc->data[SC_KAGEHUMI] && skill_block_check(src, SC_KAGEHUMI, skill_id))
+				(sc->getSCE(SC_BASILICA) && (sc->getSCE(SC_BASILICA)->val4 != src->id || skill_id != HP_BASILICA)) || // Only Basilica caster that can cast, and only Basilica to cancel it
+#endif
+				(sc->getSCE(SC_MARIONETTE) && skill_id != CG_MARIONETTE) || // Only skill you can use is marionette again to cancel it
+				(sc->getSCE(SC_MARIONETTE2) && skill_id == CG_MARIONETTE) || // Cannot use marionette if you are being buffed by another
+				(sc->getSCE(SC_ANKLE) && skill_block_check(src, SC_ANKLE, skill_id)) ||
+				(sc->getSCE(SC_STASIS) && skill_block_check(src, SC_STASIS, skill_id)) ||
+				(sc->getSCE(SC_BITE) && skill_block_check(src, SC_BITE, skill_id)) ||
+				(sc->getSCE(SC_NOVAEXPLOSING) && skill_block_check(src, SC_NOVAEXPLOSING, skill_id)) ||
+				(sc->getSCE(SC_GRAVITYCONTROL) && skill_block_check(src, SC_GRAVITYCONTROL, skill_id)) ||
+				(sc->getSCE(SC_KAGEHUMI) && skill_block_check(src, SC_KAGEHUMI, skill_id))
 #ifdef RENEWAL
-				|| (sc->data[SC_ENSEMBLEFATIGUE] && skill_id != CG_SPECIALSINGER)
+				|| (sc->getSCE(SC_ENSEMBLEFATIGUE) && skill_id != CG_SPECIALSINGER)
 #endif
 			))
 				return false;
 
 			// Skill blocking.
 			if (
-				(sc->data[SC_VOLCANO] && skill_id == WZ_ICEWALL) ||
+				(sc->getSCE(SC_VOLCANO) && skill_id == WZ_ICEWALL) ||
 #ifndef RENEWAL
-				(sc->data[SC_ROKISWEIL] && skill_id != BD_ADAPTATION) ||
+				(sc->getSCE(SC_ROKISWEIL) && skill_id != BD_ADAPTATION) ||
 #endif
-				(sc->data[SC_HERMODE] && skill_get_inf(skill_id) & INF_SUPPORT_SKILL) ||
-				(sc->data[SC_NOCHAT] && sc->data[SC_NOCHAT]->val1&MANNER_NOSKILL)
+				(sc->getSCE(SC_HERMODE) && skill_get_inf(skill_id) & INF_SUPPORT_SKILL) ||
+				(sc->getSCE(SC_NOCHAT) && sc->getSCE(SC_NOCHAT)->val1&MANNER_NOSKILL)
 			)
 				return false;
 		}
@@ -2891,16 +2891,16 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 		* Attacks in invincible are capped to 1 damage and handled in battle.cpp.
 		* Allow spell break and eske for sealed shrine GDB when in INVINCIBLE state.
 		**/
-		if( tsc->data[SC_INVINCIBLE] && !tsc->data[SC_INVINCIBLEOFF] && skill_id && !(skill_id&(SA_SPELLBREAKER|SL_SKE)) )
+		if( tsc->getSCE(SC_INVINCIBLE) && !tsc->getSCE(SC_INVINCIBLEOFF) && skill_id && !(skill_id&(SA_SPELLBREAKER|SL_SKE)) )
 			return false;
-		if(!skill_id && tsc->data[SC_TRICKDEAD])
+		if(!skill_id && tsc->getSCE(SC_TRICKDEAD))
 			return false;
 		if((skill_id == WZ_STORMGUST || skill_id == WZ_FROSTNOVA || skill_id == NJ_HYOUSYOURAKU)
-			&& tsc->data[SC_FREEZE])
+			&& tsc->getSCE(SC_FREEZE))
 			return false;
-		if(skill_id == PR_LEXAETERNA && (tsc->data[SC_FREEZE] || (tsc->data[SC_STONE] && tsc->opt1 == OPT1_STONE)))
+		if(skill_id == PR_LEXAETERNA && (tsc->getSCE(SC_FREEZE) || (tsc->getSCE(SC_STONE) && tsc->opt1 == OPT1_STONE)))
 			return false;
-		if (tsc->data[SC__MANHOLE] && !skill_get_inf2(skill_id, INF2_TARGETMANHOLE))
+		if (tsc->getSCE(SC__MANHOLE) && !skill_get_inf2(skill_id, INF2_TARGETMANHOLE))
 			return false;
 	}
 
@@ -2922,11 +2922,11 @@ bool status_check_skilluse(struct block_list *src, struct block_list *target, ui
 				if (tsc) {
 					if ((tsc->option&hide_flag) && !is_boss && (tsd->special_state.perfect_hiding || !is_detect))
 						return false;
-					if ((tsc->data[SC_CLOAKINGEXCEED] || tsc->data[SC_NEWMOON]) && !is_boss && (tsd->special_state.perfect_hiding || is_detect))
+					if ((tsc->getSCE(SC_CLOAKINGEXCEED) || tsc->getSCE(SC_NEWMOON)) && !is_boss && (tsd->special_state.perfect_hiding || is_detect))
 						return false; // Works against insect and demon but not against bosses
-					if (tsc->data[SC__FEINTBOMB] && (is_boss || is_detect))
+					if (tsc->getSCE(SC__FEINTBOMB) && (is_boss || is_detect))
 						return false; // Works against all
-					if ((tsc->data[SC_CAMOUFLAGE] || tsc->data[SC_STEALTHFIELD] || tsc->data[SC_SUHIDE]) && !(is_boss || is_detect) && (!skill_id || (!flag && src)))
+					if ((tsc->getSCE(SC_CAMOUFLAGE) || tsc->getSCE(SC_STEALTHFIELD) || tsc->getSCE(SC_SUHIDE)) && !(is_boss || is_detect) && (!skill_id || (!flag && src)))
 						return false; // Insect, demon, and boss can detect
 				}
 			}
@@ -2992,16 +2992,16 @@ int status_check_visibility(struct block_list *src, struct block_list *target)
 			case BL_PC: {
 					struct map_session_data *tsd = (TBL_PC*)target;
 
-					if (((tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK)) || tsc->data[SC_CAMOUFLAGE] || tsc->data[SC_STEALTHFIELD] || tsc->data[SC_SUHIDE]) && !is_boss && (tsd->special_state.perfect_hiding || !is_detector))
+					if (((tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK)) || tsc->getSCE(SC_CAMOUFLAGE) || tsc->getSCE(SC_STEALTHFIELD) || tsc->getSCE(SC_SUHIDE)) && !is_boss && (tsd->special_state.perfect_hiding || !is_detector))
 						return 0;
-					if ((tsc->data[SC_CLOAKINGEXCEED] || tsc->data[SC_NEWMOON]) && !is_boss && ((tsd && tsd->special_state.perfect_hiding) || is_detector))
+					if ((tsc->getSCE(SC_CLOAKINGEXCEED) || tsc->getSCE(SC_NEWMOON)) && !is_boss && ((tsd && tsd->special_state.perfect_hiding) || is_detector))
 						return 0;
-					if (tsc->data[SC__FEINTBOMB] && !is_boss && !is_detector)
+					if (tsc->getSCE(SC__FEINTBOMB) && !is_boss && !is_detector)
 						return 0;
 				}
 				break;
 			default:
-				if (((tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK)) || tsc->data[SC_CAMOUFLAGE] || tsc->data[SC_STEALTHFIELD] || tsc->data[SC_SUHIDE]) && !is_boss && !is_detector)
+				if (((tsc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK)) || tsc->getSCE(SC_CAMOUFLAGE) || tsc->getSCE(SC_STEALTHFIELD) || tsc->getSCE(SC_SUHIDE)) && !is_boss && !is_detector)
 					return 0;
 		}
 	}
@@ -3716,29 +3716,29 @@ static int status_get_hpbonus(struct block_list *bl, enum e_status_bonus type) {
 
 		//Bonus by SC
 		if (sc) {
-			if(sc->data[SC_INCMHP])
-				bonus += sc->data[SC_INCMHP]->val1;
-			if(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 2)
+			if(sc->getSCE(SC_INCMHP))
+				bonus += sc->getSCE(SC_INCMHP)->val1;
+			if(sc->getSCE(SC_EARTH_INSIGNIA) && sc->getSCE(SC_EARTH_INSIGNIA)->val1 == 2)
 				bonus += 500;
-			if (sc->data[SC_PROMOTE_HEALTH_RESERCH])
-				bonus += sc->data[SC_PROMOTE_HEALTH_RESERCH]->val3;
-			if(sc->data[SC_SOLID_SKIN_OPTION])
+			if (sc->getSCE(SC_PROMOTE_HEALTH_RESERCH))
+				bonus += sc->getSCE(SC_PROMOTE_HEALTH_RESERCH)->val3;
+			if(sc->getSCE(SC_SOLID_SKIN_OPTION))
 				bonus += 2000;
-			if(sc->data[SC_MARIONETTE])
+			if(sc->getSCE(SC_MARIONETTE))
 				bonus -= 1000;
-			if(sc->data[SC_SWORDCLAN])
+			if(sc->getSCE(SC_SWORDCLAN))
 				bonus += 30;
-			if(sc->data[SC_ARCWANDCLAN])
+			if(sc->getSCE(SC_ARCWANDCLAN))
 				bonus += 30;
-			if(sc->data[SC_GOLDENMACECLAN])
+			if(sc->getSCE(SC_GOLDENMACECLAN))
 				bonus += 30;
-			if(sc->data[SC_CROSSBOWCLAN])
+			if(sc->getSCE(SC_CROSSBOWCLAN))
 				bonus += 30;
-			if(sc->data[SC_GLASTHEIM_HPSP])
-				bonus += sc->data[SC_GLASTHEIM_HPSP]->val1;
+			if(sc->getSCE(SC_GLASTHEIM_HPSP))
+				bonus += sc->getSCE(SC_GLASTHEIM_HPSP)->val1;
 #ifdef RENEWAL
-			if (sc->data[SC_ANGELUS])
-				bonus += sc->data[SC_ANGELUS]->val1 * 50;
+			if (sc->getSCE(SC_ANGELUS))
+				bonus += sc->getSCE(SC_ANGELUS)->val1 * 50;
 #endif
 		}
 	} else if (type == STATUS_BONUS_RATE) {
@@ -3747,64 +3747,64 @@ static int status_get_hpbonus(struct block_list *bl, enum e_status_bonus type) {
 		//Bonus by SC
 		if (sc) {
 			//Increasing
-			if(sc->data[SC_INCMHPRATE])
-				bonus += sc->data[SC_INCMHPRATE]->val1;
-			if(sc->data[SC_APPLEIDUN])
-				bonus += sc->data[SC_APPLEIDUN]->val2;
-			if(sc->data[SC_DELUGE])
-				bonus += sc->data[SC_DELUGE]->val2;
-			if(sc->data[SC_BERSERK])
+			if(sc->getSCE(SC_INCMHPRATE))
+				bonus += sc->getSCE(SC_INCMHPRATE)->val1;
+			if(sc->getSCE(SC_APPLEIDUN))
+				bonus += sc->getSCE(SC_APPLEIDUN)->val2;
+			if(sc->getSCE(SC_DELUGE))
+				bonus += sc->getSCE(SC_DELUGE)->val2;
+			if(sc->getSCE(SC_BERSERK))
 				bonus += 200; //+200%
-			if(sc->data[SC_MERC_HPUP])
-				bonus += sc->data[SC_MERC_HPUP]->val2;
-			if(sc->data[SC_EPICLESIS])
-				bonus += sc->data[SC_EPICLESIS]->val2;
-			if(sc->data[SC_FRIGG_SONG])
-				bonus += sc->data[SC_FRIGG_SONG]->val2;
-			if(sc->data[SC_LERADSDEW])
-				bonus += sc->data[SC_LERADSDEW]->val3;
-			if(sc->data[SC_FORCEOFVANGUARD])
-				bonus += (3 * sc->data[SC_FORCEOFVANGUARD]->val1);
-			if(sc->data[SC_INSPIRATION])
-				bonus += (4 * sc->data[SC_INSPIRATION]->val1);
-			if(sc->data[SC_RAISINGDRAGON])
-				bonus += sc->data[SC_RAISINGDRAGON]->val1;
-			if(sc->data[SC_GT_REVITALIZE])
-				bonus += sc->data[SC_GT_REVITALIZE]->val2;
-			if(sc->data[SC_ANGRIFFS_MODUS])
-				bonus += (5 * sc->data[SC_ANGRIFFS_MODUS]->val1);
-			if(sc->data[SC_PETROLOGY_OPTION])
-				bonus += sc->data[SC_PETROLOGY_OPTION]->val2;
-			if(sc->data[SC_POWER_OF_GAIA])
-				bonus += sc->data[SC_POWER_OF_GAIA]->val3;
-			if(sc->data[SC_CURSED_SOIL_OPTION])
-				bonus += sc->data[SC_CURSED_SOIL_OPTION]->val2;
-			if(sc->data[SC_UPHEAVAL_OPTION])
-				bonus += sc->data[SC_UPHEAVAL_OPTION]->val2;
-			if(sc->data[SC_LAUDAAGNUS])
-				bonus += 2 + (sc->data[SC_LAUDAAGNUS]->val1 * 2);
+			if(sc->getSCE(SC_MERC_HPUP))
+				bonus += sc->getSCE(SC_MERC_HPUP)->val2;
+			if(sc->getSCE(SC_EPICLESIS))
+				bonus += sc->getSCE(SC_EPICLESIS)->val2;
+			if(sc->getSCE(SC_FRIGG_SONG))
+				bonus += sc->getSCE(SC_FRIGG_SONG)->val2;
+			if(sc->getSCE(SC_LERADSDEW))
+				bonus += sc->getSCE(SC_LERADSDEW)->val3;
+			if(sc->getSCE(SC_FORCEOFVANGUARD))
+				bonus += (3 * sc->getSCE(SC_FORCEOFVANGUARD)->val1);
+			if(sc->getSCE(SC_INSPIRATION))
+				bonus += (4 * sc->getSCE(SC_INSPIRATION)->val1);
+			if(sc->getSCE(SC_RAISINGDRAGON))
+				bonus += sc->getSCE(SC_RAISINGDRAGON)->val1;
+			if(sc->getSCE(SC_GT_REVITALIZE))
+				bonus += sc->getSCE(SC_GT_REVITALIZE)->val2;
+			if(sc->getSCE(SC_ANGRIFFS_MODUS))
+				bonus += (5 * sc->getSCE(SC_ANGRIFFS_MODUS)->val1);
+			if(sc->getSCE(SC_PETROLOGY_OPTION))
+				bonus += sc->getSCE(SC_PETROLOGY_OPTION)->val2;
+			if(sc->getSCE(SC_POWER_OF_GAIA))
+				bonus += sc->getSCE(SC_POWER_OF_GAIA)->val3;
+			if(sc->getSCE(SC_CURSED_SOIL_OPTION))
+				bonus += sc->getSCE(SC_CURSED_SOIL_OPTION)->val2;
+			if(sc->getSCE(SC_UPHEAVAL_OPTION))
+				bonus += sc->getSCE(SC_UPHEAVAL_OPTION)->val2;
+			if(sc->getSCE(SC_LAUDAAGNUS))
+				bonus += 2 + (sc->getSCE(SC_LAUDAAGNUS)->val1 * 2);
 #ifdef RENEWAL
-			if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_HPRATE)
+			if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_HPRATE)
 				bonus += 30;
 #endif
-			if(sc->data[SC_LUNARSTANCE])
-				bonus += sc->data[SC_LUNARSTANCE]->val2;
-			if (sc->data[SC_LUXANIMA])
-				bonus += sc->data[SC_LUXANIMA]->val3;
-			if (sc->data[SC_MTF_MHP])
-				bonus += sc->data[SC_MTF_MHP]->val1;
+			if(sc->getSCE(SC_LUNARSTANCE))
+				bonus += sc->getSCE(SC_LUNARSTANCE)->val2;
+			if (sc->getSCE(SC_LUXANIMA))
+				bonus += sc->getSCE(SC_LUXANIMA)->val3;
+			if (sc->getSCE(SC_MTF_MHP))
+				bonus += sc->getSCE(SC_MTF_MHP)->val1;
 
 			//Decreasing
-			if (sc->data[SC_VENOMBLEED] && sc->data[SC_VENOMBLEED]->val3 == 1)
+			if (sc->getSCE(SC_VENOMBLEED) && sc->getSCE(SC_VENOMBLEED)->val3 == 1)
 				bonus -= 15;
-			if(sc->data[SC_BEYONDOFWARCRY])
-				bonus -= sc->data[SC_BEYONDOFWARCRY]->val3;
-			if(sc->data[SC__WEAKNESS])
-				bonus -= sc->data[SC__WEAKNESS]->val2;
-			if(sc->data[SC_EQC])
-				bonus -= sc->data[SC_EQC]->val3;
-			if(sc->data[SC_PACKING_ENVELOPE3])
-				bonus += sc->data[SC_PACKING_ENVELOPE3]->val1;
+			if(sc->getSCE(SC_BEYONDOFWARCRY))
+				bonus -= sc->getSCE(SC_BEYONDOFWARCRY)->val3;
+			if(sc->getSCE(SC__WEAKNESS))
+				bonus -= sc->getSCE(SC__WEAKNESS)->val2;
+			if(sc->getSCE(SC_EQC))
+				bonus -= sc->getSCE(SC_EQC)->val3;
+			if(sc->getSCE(SC_PACKING_ENVELOPE3))
+				bonus += sc->getSCE(SC_PACKING_ENVELOPE3)->val1;
 		}
 		// Max rate reduce is -100%
 		bonus = cap_value(bonus,-100,INT_MAX);
@@ -3834,13 +3834,13 @@ static int status_get_hpbonus_item(block_list *bl) {
 
 	//Bonus by SC
 	if (sc) {
-		if (sc->data[SC_INCREASE_MAXHP])
-			bonus += sc->data[SC_INCREASE_MAXHP]->val1;
-		if (sc->data[SC_MUSTLE_M])
-			bonus += sc->data[SC_MUSTLE_M]->val1;
+		if (sc->getSCE(SC_INCREASE_MAXHP))
+			bonus += sc->getSCE(SC_INCREASE_MAXHP)->val1;
+		if (sc->getSCE(SC_MUSTLE_M))
+			bonus += sc->getSCE(SC_MUSTLE_M)->val1;
 
-		if (sc->data[SC_MYSTERIOUS_POWDER])
-			bonus -= sc->data[SC_MYSTERIOUS_POWDER]->val1;
+		if (sc->getSCE(SC_MYSTERIOUS_POWDER))
+			bonus -= sc->getSCE(SC_MYSTERIOUS_POWDER)->val1;
 	}
 
 	// Max rate reduce is -100%
@@ -3887,20 +3887,20 @@ static int status_get_spbonus(struct block_list *bl, enum e_status_bonus type) {
 
 		//Bonus by SC
 		if (sc) {
-			if(sc->data[SC_INCMSP])
-				bonus += sc->data[SC_INCMSP]->val1;
-			if(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 3)
+			if(sc->getSCE(SC_INCMSP))
+				bonus += sc->getSCE(SC_INCMSP)->val1;
+			if(sc->getSCE(SC_EARTH_INSIGNIA) && sc->getSCE(SC_EARTH_INSIGNIA)->val1 == 3)
 				bonus += 50;
-			if(sc->data[SC_SWORDCLAN])
+			if(sc->getSCE(SC_SWORDCLAN))
 				bonus += 10;
-			if(sc->data[SC_ARCWANDCLAN])
+			if(sc->getSCE(SC_ARCWANDCLAN))
 				bonus += 10;
-			if(sc->data[SC_GOLDENMACECLAN])
+			if(sc->getSCE(SC_GOLDENMACECLAN))
 				bonus += 10;
-			if(sc->data[SC_CROSSBOWCLAN])
+			if(sc->getSCE(SC_CROSSBOWCLAN))
 				bonus += 10;
-			if(sc->data[SC_GLASTHEIM_HPSP])
-				bonus += sc->data[SC_GLASTHEIM_HPSP]->val2;
+			if(sc->getSCE(SC_GLASTHEIM_HPSP))
+				bonus += sc->getSCE(SC_GLASTHEIM_HPSP)->val2;
 		}
 	} else if (type == STATUS_BONUS_RATE) {
 		struct status_change *sc = status_get_sc(bl);
@@ -3917,7 +3917,7 @@ static int status_get_spbonus(struct block_list *bl, enum e_status_bonus type) {
 #ifdef RENEWAL
 			if ((i = pc_checkskill(sd, (sd->status.sex ? BA_MUSICALLESSON : DC_DANCINGLESSON))) > 0)
 				bonus += i;
-			if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_SPRATE)
+			if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_SPRATE)
 				bonus += 30;
 #endif
 		}
@@ -3925,24 +3925,24 @@ static int status_get_spbonus(struct block_list *bl, enum e_status_bonus type) {
 		//Bonus by SC
 		if (sc) {
 			//Increasing
-			if(sc->data[SC_INCMSPRATE])
-				bonus += sc->data[SC_INCMSPRATE]->val1;
-			if(sc->data[SC_RAISINGDRAGON])
-				bonus += sc->data[SC_RAISINGDRAGON]->val1;
-			if(sc->data[SC_SERVICE4U])
-				bonus += sc->data[SC_SERVICE4U]->val2;
-			if(sc->data[SC_MERC_SPUP])
-				bonus += sc->data[SC_MERC_SPUP]->val2;
-			if (sc->data[SC_LUXANIMA])
-				bonus += sc->data[SC_LUXANIMA]->val3;
-			if (sc->data[SC_MTF_MSP])
-				bonus += sc->data[SC_MTF_MSP]->val1;
-			if(sc->data[SC_PACKING_ENVELOPE4])
-				bonus += sc->data[SC_PACKING_ENVELOPE4]->val1;
+			if(sc->getSCE(SC_INCMSPRATE))
+				bonus += sc->getSCE(SC_INCMSPRATE)->val1;
+			if(sc->getSCE(SC_RAISINGDRAGON))
+				bonus += sc->getSCE(SC_RAISINGDRAGON)->val1;
+			if(sc->getSCE(SC_SERVICE4U))
+				bonus += sc->getSCE(SC_SERVICE4U)->val2;
+			if(sc->getSCE(SC_MERC_SPUP))
+				bonus += sc->getSCE(SC_MERC_SPUP)->val2;
+			if (sc->getSCE(SC_LUXANIMA))
+				bonus += sc->getSCE(SC_LUXANIMA)->val3;
+			if (sc->getSCE(SC_MTF_MSP))
+				bonus += sc->getSCE(SC_MTF_MSP)->val1;
+			if(sc->getSCE(SC_PACKING_ENVELOPE4))
+				bonus += sc->getSCE(SC_PACKING_ENVELOPE4)->val1;
 
 			//Decreasing
-			if (sc->data[SC_MELODYOFSINK])
-				bonus -= sc->data[SC_MELODYOFSINK]->val3;
+			if (sc->getSCE(SC_MELODYOFSINK))
+				bonus -= sc->getSCE(SC_MELODYOFSINK)->val3;
 		}
 		// Max rate reduce is -100%
 		bonus = cap_value(bonus,-100,INT_MAX);
@@ -3972,14 +3972,14 @@ static int status_get_spbonus_item(block_list *bl) {
 
 	//Bonus by SC
 	if (sc) {
-		if (sc->data[SC_INCREASE_MAXSP])
-			bonus += sc->data[SC_INCREASE_MAXSP]->val1;
-		if (sc->data[SC_LIFE_FORCE_F])
-			bonus += sc->data[SC_LIFE_FORCE_F]->val1;
-		if (sc->data[SC_VITATA_500])
-			bonus += sc->data[SC_VITATA_500]->val2;
-		if (sc->data[SC_ENERGY_DRINK_RESERCH])
-			bonus += sc->data[SC_ENERGY_DRINK_RESERCH]->val3;
+		if (sc->getSCE(SC_INCREASE_MAXSP))
+			bonus += sc->getSCE(SC_INCREASE_MAXSP)->val1;
+		if (sc->getSCE(SC_LIFE_FORCE_F))
+			bonus += sc->getSCE(SC_LIFE_FORCE_F)->val1;
+		if (sc->getSCE(SC_VITATA_500))
+			bonus += sc->getSCE(SC_VITATA_500)->val2;
+		if (sc->getSCE(SC_ENERGY_DRINK_RESERCH))
+			bonus += sc->getSCE(SC_ENERGY_DRINK_RESERCH)->val3;
 	}
 
 	// Max rate reduce is -100%
@@ -4068,8 +4068,8 @@ bool status_calc_weight(struct map_session_data *sd, enum e_status_calc_weight_o
 			sd->max_weight += 10000;
 		else if (pc_isridingdragon(sd))
 			sd->max_weight += 5000 + 2000 * pc_checkskill(sd, RK_DRAGONTRAINING);
-		if (sc->data[SC_KNOWLEDGE])
-			sd->max_weight += sd->max_weight * sc->data[SC_KNOWLEDGE]->val1 / 10;
+		if (sc->getSCE(SC_KNOWLEDGE))
+			sd->max_weight += sd->max_weight * sc->getSCE(SC_KNOWLEDGE)->val1 / 10;
 		if ((skill = pc_checkskill(sd, ALL_INCCARRY)) > 0)
 			sd->max_weight += 2000 * skill;
 		if (pc_ismadogear(sd))
@@ -4353,10 +4353,10 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 			if(sd->inventory_data[index]->script && (pc_has_permission(sd,PC_PERM_USE_ALL_EQUIPMENT) || !itemdb_isNoEquip(sd->inventory_data[index],sd->bl.m))) {
 				if (wd == &sd->left_weapon) {
 					sd->state.lr_flag = 1;
-					run_script(sd->inventory_data[index]->script,0,sd->bl.id,0);
+					script_run_bonus(sd->inventory_data[index]->script, sd);
 					sd->state.lr_flag = 0;
 				} else
-					run_script(sd->inventory_data[index]->script,0,sd->bl.id,0);
+					script_run_bonus(sd->inventory_data[index]->script, sd);
 				if (!calculating) // Abort, run_script retriggered this. [Skotlex]
 					return 1;
 			}
@@ -4387,7 +4387,7 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 			if(sd->inventory_data[index]->script && (pc_has_permission(sd,PC_PERM_USE_ALL_EQUIPMENT) || !itemdb_isNoEquip(sd->inventory_data[index],sd->bl.m))) {
 				if( i == EQI_HAND_L ) // Shield
 					sd->state.lr_flag = 3;
-				run_script(sd->inventory_data[index]->script,0,sd->bl.id,0);
+				script_run_bonus(sd->inventory_data[index]->script, sd);
 				if( i == EQI_HAND_L ) // Shield
 					sd->state.lr_flag = 0;
 				if (!calculating) // Abort, run_script retriggered this. [Skotlex]
@@ -4395,7 +4395,7 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 			}
 		} else if( sd->inventory_data[index]->type == IT_SHADOWGEAR ) { // Shadow System
 			if (sd->inventory_data[index]->script && (pc_has_permission(sd,PC_PERM_USE_ALL_EQUIPMENT) || !itemdb_isNoEquip(sd->inventory_data[index],sd->bl.m))) {
-				run_script(sd->inventory_data[index]->script,0,sd->bl.id,0);
+				script_run_bonus(sd->inventory_data[index]->script, sd);
 				if( !calculating )
 					return 1;
 			}
@@ -4408,7 +4408,7 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 			sd->bonus.arrow_atk += sd->inventory_data[index]->atk;
 			sd->state.lr_flag = 2;
 			if( !itemdb_group.item_exists(IG_THROWABLE, sd->inventory_data[index]->nameid) ) // Don't run scripts on throwable items
-				run_script(sd->inventory_data[index]->script,0,sd->bl.id,0);
+				script_run_bonus(sd->inventory_data[index]->script, sd);
 			sd->state.lr_flag = 0;
 			if (!calculating) // Abort, run_script retriggered status_calc_pc. [Skotlex]
 				return 1;
@@ -4445,7 +4445,7 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 			if (no_run)
 				continue;
 
-			run_script(combo->bonus, 0, sd->bl.id, 0);
+			script_run_bonus(combo->bonus, sd);
 
 			if (!calculating) // Abort, run_script retriggered this
 				return 1;
@@ -4495,10 +4495,10 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 					continue;
 				if(i == EQI_HAND_L && sd->inventory.u.items_inventory[index].equip == EQP_HAND_L) { // Left hand status.
 					sd->state.lr_flag = 1;
-					run_script(data->script,0,sd->bl.id,0);
+					script_run_bonus(data->script, sd);
 					sd->state.lr_flag = 0;
 				} else
-					run_script(data->script,0,sd->bl.id,0);
+					script_run_bonus(data->script, sd);
 				if (!calculating) // Abort, run_script his function. [Skotlex]
 					return 1;
 			}
@@ -4535,11 +4535,11 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 					continue;
 				if (i == EQI_HAND_L && sd->inventory.u.items_inventory[index].equip == EQP_HAND_L) { // Left hand status.
 					sd->state.lr_flag = 1;
-					run_script(data->script, 0, sd->bl.id, 0);
+					script_run_bonus(data->script, sd);
 					sd->state.lr_flag = 0;
 				}
 				else
-					run_script(data->script, 0, sd->bl.id, 0);
+					script_run_bonus(data->script, sd);
 				if (!calculating)
 					return 1;
 			}
@@ -4547,10 +4547,10 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 		current_equip_opt_index = -1;
 	}
 
-	if (sc->count && sc->data[SC_ITEMSCRIPT]) {
-		struct item_data *data = itemdb_exists(sc->data[SC_ITEMSCRIPT]->val1);
+	if (sc->count && sc->getSCE(SC_ITEMSCRIPT)) {
+		struct item_data *data = itemdb_exists(sc->getSCE(SC_ITEMSCRIPT)->val1);
 		if (data && data->script)
-			run_script(data->script, 0, sd->bl.id, 0);
+			script_run_bonus(data->script, sd);
 	}
 
 	pc_bonus_script(sd);
@@ -4648,9 +4648,9 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 	base_status->luk = cap_value(i,0,USHRT_MAX);
 
 	if (sd->special_state.no_walk_delay) {
-		if (sc->data[SC_ENDURE]) {
-			if (sc->data[SC_ENDURE]->val4)
-				sc->data[SC_ENDURE]->val4 = 0;
+		if (sc->getSCE(SC_ENDURE)) {
+			if (sc->getSCE(SC_ENDURE)->val4)
+				sc->getSCE(SC_ENDURE)->val4 = 0;
 			status_change_end(&sd->bl, SC_ENDURE, INVALID_TIMER);
 		}
 		clif_status_load(&sd->bl, EFST_ENDURE, 1);
@@ -4895,11 +4895,11 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 	if((skill=pc_checkskill(sd,HP_MANARECHARGE))>0 )
 		sd->dsprate -= 4*skill;
 
-	if(sc->data[SC_SERVICE4U])
-		sd->dsprate -= sc->data[SC_SERVICE4U]->val3;
+	if(sc->getSCE(SC_SERVICE4U))
+		sd->dsprate -= sc->getSCE(SC_SERVICE4U)->val3;
 
-	if(sc->data[SC_SPCOST_RATE])
-		sd->dsprate -= sc->data[SC_SPCOST_RATE]->val1;
+	if(sc->getSCE(SC_SPCOST_RATE))
+		sd->dsprate -= sc->getSCE(SC_SPCOST_RATE)->val1;
 
 	// Underflow protections.
 	if(sd->dsprate < 0)
@@ -4941,12 +4941,12 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 	}
 
 	if(sc->count) {
-		if(sc->data[SC_CONCENTRATE]) { // Update the card-bonus data
-			sc->data[SC_CONCENTRATE]->val3 = sd->indexed_bonus.param_bonus[1]; // Agi
-			sc->data[SC_CONCENTRATE]->val4 = sd->indexed_bonus.param_bonus[4]; // Dex
+		if(sc->getSCE(SC_CONCENTRATE)) { // Update the card-bonus data
+			sc->getSCE(SC_CONCENTRATE)->val3 = sd->indexed_bonus.param_bonus[1]; // Agi
+			sc->getSCE(SC_CONCENTRATE)->val4 = sd->indexed_bonus.param_bonus[4]; // Dex
 		}
-		if(sc->data[SC_SIEGFRIED]) {
-			i = sc->data[SC_SIEGFRIED]->val2;
+		if(sc->getSCE(SC_SIEGFRIED)) {
+			i = sc->getSCE(SC_SIEGFRIED)->val2;
 			sd->indexed_bonus.subele[ELE_WATER] += i;
 			sd->indexed_bonus.subele[ELE_EARTH] += i;
 			sd->indexed_bonus.subele[ELE_FIRE] += i;
@@ -4960,118 +4960,118 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 #endif
 		}
 #ifdef RENEWAL
-		if (sc->data[SC_BASILICA]) {
-			i = sc->data[SC_BASILICA]->val1 * 5;
+		if (sc->getSCE(SC_BASILICA)) {
+			i = sc->getSCE(SC_BASILICA)->val1 * 5;
 			sd->right_weapon.addele[ELE_DARK] += i;
 			sd->right_weapon.addele[ELE_UNDEAD] += i;
 			sd->left_weapon.addele[ELE_DARK] += i;
 			sd->left_weapon.addele[ELE_UNDEAD] += i;
-			sd->indexed_bonus.magic_atk_ele[ELE_HOLY] += sc->data[SC_BASILICA]->val1 * 3;
-		}
-		if (sc->data[SC_FIREWEAPON])
-			sd->indexed_bonus.magic_atk_ele[ELE_FIRE] += sc->data[SC_FIREWEAPON]->val1;
-		if (sc->data[SC_WINDWEAPON])
-			sd->indexed_bonus.magic_atk_ele[ELE_WIND] += sc->data[SC_WINDWEAPON]->val1;
-		if (sc->data[SC_WATERWEAPON])
-			sd->indexed_bonus.magic_atk_ele[ELE_WATER] += sc->data[SC_WATERWEAPON]->val1;
-		if (sc->data[SC_EARTHWEAPON])
-			sd->indexed_bonus.magic_atk_ele[ELE_EARTH] += sc->data[SC_EARTHWEAPON]->val1;
-#endif
-		if(sc->data[SC_PROVIDENCE]) {
-			sd->indexed_bonus.subele[ELE_HOLY] += sc->data[SC_PROVIDENCE]->val2;
-			sd->indexed_bonus.subrace[RC_DEMON] += sc->data[SC_PROVIDENCE]->val2;
-		}
-        if (sc->data[SC_GEFFEN_MAGIC1]) {
-            sd->right_weapon.addrace[RC_PLAYER_HUMAN] += sc->data[SC_GEFFEN_MAGIC1]->val1;
-            sd->right_weapon.addrace[RC_DEMIHUMAN] += sc->data[SC_GEFFEN_MAGIC1]->val1;
-            sd->left_weapon.addrace[RC_PLAYER_HUMAN] += sc->data[SC_GEFFEN_MAGIC1]->val1;
-            sd->left_weapon.addrace[RC_DEMIHUMAN] += sc->data[SC_GEFFEN_MAGIC1]->val1;
+			sd->indexed_bonus.magic_atk_ele[ELE_HOLY] += sc->getSCE(SC_BASILICA)->val1 * 3;
+		}
+		if (sc->getSCE(SC_FIREWEAPON))
+			sd->indexed_bonus.magic_atk_ele[ELE_FIRE] += sc->getSCE(SC_FIREWEAPON)->val1;
+		if (sc->getSCE(SC_WINDWEAPON))
+			sd->indexed_bonus.magic_atk_ele[ELE_WIND] += sc->getSCE(SC_WINDWEAPON)->val1;
+		if (sc->getSCE(SC_WATERWEAPON))
+			sd->indexed_bonus.magic_atk_ele[ELE_WATER] += sc->getSCE(SC_WATERWEAPON)->val1;
+		if (sc->getSCE(SC_EARTHWEAPON))
+			sd->indexed_bonus.magic_atk_ele[ELE_EARTH] += sc->getSCE(SC_EARTHWEAPON)->val1;
+#endif
+		if(sc->getSCE(SC_PROVIDENCE)) {
+			sd->indexed_bonus.subele[ELE_HOLY] += sc->getSCE(SC_PROVIDENCE)->val2;
+			sd->indexed_bonus.subrace[RC_DEMON] += sc->getSCE(SC_PROVIDENCE)->val2;
+		}
+        if (sc->getSCE(SC_GEFFEN_MAGIC1)) {
+            sd->right_weapon.addrace[RC_PLAYER_HUMAN] += sc->getSCE(SC_GEFFEN_MAGIC1)->val1;
+            sd->right_weapon.addrace[RC_DEMIHUMAN] += sc->getSCE(SC_GEFFEN_MAGIC1)->val1;
+            sd->left_weapon.addrace[RC_PLAYER_HUMAN] += sc->getSCE(SC_GEFFEN_MAGIC1)->val1;
+            sd->left_weapon.addrace[RC_DEMIHUMAN] += sc->getSCE(SC_GEFFEN_MAGIC1)->val1;
         }
-        if (sc->data[SC_GEFFEN_MAGIC2]) {
-            sd->indexed_bonus.magic_addrace[RC_PLAYER_HUMAN] += sc->data[SC_GEFFEN_MAGIC2]->val1;
-            sd->indexed_bonus.magic_addrace[RC_DEMIHUMAN] += sc->data[SC_GEFFEN_MAGIC2]->val1;
+        if (sc->getSCE(SC_GEFFEN_MAGIC2)) {
+            sd->indexed_bonus.magic_addrace[RC_PLAYER_HUMAN] += sc->getSCE(SC_GEFFEN_MAGIC2)->val1;
+            sd->indexed_bonus.magic_addrace[RC_DEMIHUMAN] += sc->getSCE(SC_GEFFEN_MAGIC2)->val1;
         }
-        if(sc->data[SC_GEFFEN_MAGIC3]) {
-            sd->indexed_bonus.subrace[RC_PLAYER_HUMAN] += sc->data[SC_GEFFEN_MAGIC3]->val1;
-            sd->indexed_bonus.subrace[RC_DEMIHUMAN] += sc->data[SC_GEFFEN_MAGIC3]->val1;
+        if(sc->getSCE(SC_GEFFEN_MAGIC3)) {
+            sd->indexed_bonus.subrace[RC_PLAYER_HUMAN] += sc->getSCE(SC_GEFFEN_MAGIC3)->val1;
+            sd->indexed_bonus.subrace[RC_DEMIHUMAN] += sc->getSCE(SC_GEFFEN_MAGIC3)->val1;
         }
-		if(sc->data[SC_ARMOR_ELEMENT_WATER]) {	// This status change should grant card-type elemental resist.
-			sd->indexed_bonus.subele[ELE_WATER] += sc->data[SC_ARMOR_ELEMENT_WATER]->val1;
-			sd->indexed_bonus.subele[ELE_EARTH] += sc->data[SC_ARMOR_ELEMENT_WATER]->val2;
-			sd->indexed_bonus.subele[ELE_FIRE] += sc->data[SC_ARMOR_ELEMENT_WATER]->val3;
-			sd->indexed_bonus.subele[ELE_WIND] += sc->data[SC_ARMOR_ELEMENT_WATER]->val4;
-		}
-		if(sc->data[SC_ARMOR_ELEMENT_EARTH]) {	// This status change should grant card-type elemental resist.
-			sd->indexed_bonus.subele[ELE_WATER] += sc->data[SC_ARMOR_ELEMENT_EARTH]->val1;
-			sd->indexed_bonus.subele[ELE_EARTH] += sc->data[SC_ARMOR_ELEMENT_EARTH]->val2;
-			sd->indexed_bonus.subele[ELE_FIRE] += sc->data[SC_ARMOR_ELEMENT_EARTH]->val3;
-			sd->indexed_bonus.subele[ELE_WIND] += sc->data[SC_ARMOR_ELEMENT_EARTH]->val4;
-		}
-		if(sc->data[SC_ARMOR_ELEMENT_FIRE]) {	// This status change should grant card-type elemental resist.
-			sd->indexed_bonus.subele[ELE_WATER] += sc->data[SC_ARMOR_ELEMENT_FIRE]->val1;
-			sd->indexed_bonus.subele[ELE_EARTH] += sc->data[SC_ARMOR_ELEMENT_FIRE]->val2;
-			sd->indexed_bonus.subele[ELE_FIRE] += sc->data[SC_ARMOR_ELEMENT_FIRE]->val3;
-			sd->indexed_bonus.subele[ELE_WIND] += sc->data[SC_ARMOR_ELEMENT_FIRE]->val4;
-		}
-		if(sc->data[SC_ARMOR_ELEMENT_WIND]) {	// This status change should grant card-type elemental resist.
-			sd->indexed_bonus.subele[ELE_WATER] += sc->data[SC_ARMOR_ELEMENT_WIND]->val1;
-			sd->indexed_bonus.subele[ELE_EARTH] += sc->data[SC_ARMOR_ELEMENT_WIND]->val2;
-			sd->indexed_bonus.subele[ELE_FIRE] += sc->data[SC_ARMOR_ELEMENT_WIND]->val3;
-			sd->indexed_bonus.subele[ELE_WIND] += sc->data[SC_ARMOR_ELEMENT_WIND]->val4;
-		}
-		if(sc->data[SC_ARMOR_RESIST]) { // Undead Scroll
-			sd->indexed_bonus.subele[ELE_WATER] += sc->data[SC_ARMOR_RESIST]->val1;
-			sd->indexed_bonus.subele[ELE_EARTH] += sc->data[SC_ARMOR_RESIST]->val2;
-			sd->indexed_bonus.subele[ELE_FIRE] += sc->data[SC_ARMOR_RESIST]->val3;
-			sd->indexed_bonus.subele[ELE_WIND] += sc->data[SC_ARMOR_RESIST]->val4;
-		}
-		if( sc->data[SC_FIRE_CLOAK_OPTION] ) {
-			i = sc->data[SC_FIRE_CLOAK_OPTION]->val2;
+		if(sc->getSCE(SC_ARMOR_ELEMENT_WATER)) {	// This status change should grant card-type elemental resist.
+			sd->indexed_bonus.subele[ELE_WATER] += sc->getSCE(SC_ARMOR_ELEMENT_WATER)->val1;
+			sd->indexed_bonus.subele[ELE_EARTH] += sc->getSCE(SC_ARMOR_ELEMENT_WATER)->val2;
+			sd->indexed_bonus.subele[ELE_FIRE] += sc->getSCE(SC_ARMOR_ELEMENT_WATER)->val3;
+			sd->indexed_bonus.subele[ELE_WIND] += sc->getSCE(SC_ARMOR_ELEMENT_WATER)->val4;
+		}
+		if(sc->getSCE(SC_ARMOR_ELEMENT_EARTH)) {	// This status change should grant card-type elemental resist.
+			sd->indexed_bonus.subele[ELE_WATER] += sc->getSCE(SC_ARMOR_ELEMENT_EARTH)->val1;
+			sd->indexed_bonus.subele[ELE_EARTH] += sc->getSCE(SC_ARMOR_ELEMENT_EARTH)->val2;
+			sd->indexed_bonus.subele[ELE_FIRE] += sc->getSCE(SC_ARMOR_ELEMENT_EARTH)->val3;
+			sd->indexed_bonus.subele[ELE_WIND] += sc->getSCE(SC_ARMOR_ELEMENT_EARTH)->val4;
+		}
+		if(sc->getSCE(SC_ARMOR_ELEMENT_FIRE)) {	// This status change should grant card-type elemental resist.
+			sd->indexed_bonus.subele[ELE_WATER] += sc->getSCE(SC_ARMOR_ELEMENT_FIRE)->val1;
+			sd->indexed_bonus.subele[ELE_EARTH] += sc->getSCE(SC_ARMOR_ELEMENT_FIRE)->val2;
+			sd->indexed_bonus.subele[ELE_FIRE] += sc->getSCE(SC_ARMOR_ELEMENT_FIRE)->val3;
+			sd->indexed_bonus.subele[ELE_WIND] += sc->getSCE(SC_ARMOR_ELEMENT_FIRE)->val4;
+		}
+		if(sc->getSCE(SC_ARMOR_ELEMENT_WIND)) {	// This status change should grant card-type elemental resist.
+			sd->indexed_bonus.subele[ELE_WATER] += sc->getSCE(SC_ARMOR_ELEMENT_WIND)->val1;
+			sd->indexed_bonus.subele[ELE_EARTH] += sc->getSCE(SC_ARMOR_ELEMENT_WIND)->val2;
+			sd->indexed_bonus.subele[ELE_FIRE] += sc->getSCE(SC_ARMOR_ELEMENT_WIND)->val3;
+			sd->indexed_bonus.subele[ELE_WIND] += sc->getSCE(SC_ARMOR_ELEMENT_WIND)->val4;
+		}
+		if(sc->getSCE(SC_ARMOR_RESIST)) { // Undead Scroll
+			sd->indexed_bonus.subele[ELE_WATER] += sc->getSCE(SC_ARMOR_RESIST)->val1;
+			sd->indexed_bonus.subele[ELE_EARTH] += sc->getSCE(SC_ARMOR_RESIST)->val2;
+			sd->indexed_bonus.subele[ELE_FIRE] += sc->getSCE(SC_ARMOR_RESIST)->val3;
+			sd->indexed_bonus.subele[ELE_WIND] += sc->getSCE(SC_ARMOR_RESIST)->val4;
+		}
+		if( sc->getSCE(SC_FIRE_CLOAK_OPTION) ) {
+			i = sc->getSCE(SC_FIRE_CLOAK_OPTION)->val2;
 			sd->indexed_bonus.subele[ELE_FIRE] += i;
 			sd->indexed_bonus.subele[ELE_WATER] -= i;
 		}
-		if( sc->data[SC_WATER_DROP_OPTION] ) {
-			i = sc->data[SC_WATER_DROP_OPTION]->val2;
+		if( sc->getSCE(SC_WATER_DROP_OPTION) ) {
+			i = sc->getSCE(SC_WATER_DROP_OPTION)->val2;
 			sd->indexed_bonus.subele[ELE_WATER] += i;
 			sd->indexed_bonus.subele[ELE_WIND] -= i;
 		}
-		if( sc->data[SC_WIND_CURTAIN_OPTION] ) {
-			i = sc->data[SC_WIND_CURTAIN_OPTION]->val2;
+		if( sc->getSCE(SC_WIND_CURTAIN_OPTION) ) {
+			i = sc->getSCE(SC_WIND_CURTAIN_OPTION)->val2;
 			sd->indexed_bonus.subele[ELE_WIND] += i;
 			sd->indexed_bonus.subele[ELE_EARTH] -= i;
 		}
-		if( sc->data[SC_STONE_SHIELD_OPTION] ) {
-			i = sc->data[SC_STONE_SHIELD_OPTION]->val2;
+		if( sc->getSCE(SC_STONE_SHIELD_OPTION) ) {
+			i = sc->getSCE(SC_STONE_SHIELD_OPTION)->val2;
 			sd->indexed_bonus.subele[ELE_EARTH] += i;
 			sd->indexed_bonus.subele[ELE_FIRE] -= i;
 		}
-		if (sc->data[SC_MTF_MLEATKED] )
-			sd->indexed_bonus.subele[ELE_NEUTRAL] += sc->data[SC_MTF_MLEATKED]->val3;
-		if (sc->data[SC_MTF_CRIDAMAGE])
-			sd->bonus.crit_atk_rate += sc->data[SC_MTF_CRIDAMAGE]->val1;
-		if (sc->data[SC_GLASTHEIM_ATK]) {
-			sd->indexed_bonus.ignore_mdef_by_race[RC_UNDEAD] += sc->data[SC_GLASTHEIM_ATK]->val1;
-			sd->indexed_bonus.ignore_mdef_by_race[RC_DEMON] += sc->data[SC_GLASTHEIM_ATK]->val1;
+		if (sc->getSCE(SC_MTF_MLEATKED) )
+			sd->indexed_bonus.subele[ELE_NEUTRAL] += sc->getSCE(SC_MTF_MLEATKED)->val3;
+		if (sc->getSCE(SC_MTF_CRIDAMAGE))
+			sd->bonus.crit_atk_rate += sc->getSCE(SC_MTF_CRIDAMAGE)->val1;
+		if (sc->getSCE(SC_GLASTHEIM_ATK)) {
+			sd->indexed_bonus.ignore_mdef_by_race[RC_UNDEAD] += sc->getSCE(SC_GLASTHEIM_ATK)->val1;
+			sd->indexed_bonus.ignore_mdef_by_race[RC_DEMON] += sc->getSCE(SC_GLASTHEIM_ATK)->val1;
 		}
-		if (sc->data[SC_LAUDARAMUS])
-			sd->bonus.crit_atk_rate += 5 * sc->data[SC_LAUDARAMUS]->val1;
+		if (sc->getSCE(SC_LAUDARAMUS))
+			sd->bonus.crit_atk_rate += 5 * sc->getSCE(SC_LAUDARAMUS)->val1;
 #ifdef RENEWAL
-		if (sc->data[SC_FORTUNE])
-			sd->bonus.crit_atk_rate += 2 * sc->data[SC_FORTUNE]->val1;
-#endif
-		if (sc->data[SC_SYMPHONYOFLOVER]) {
-			sd->indexed_bonus.subele[ELE_GHOST] += sc->data[SC_SYMPHONYOFLOVER]->val1 * 3;
-			sd->indexed_bonus.subele[ELE_HOLY] += sc->data[SC_SYMPHONYOFLOVER]->val1 * 3;
-		}
-		if (sc->data[SC_PYREXIA] && sc->data[SC_PYREXIA]->val3 == 0)
-			sd->bonus.crit_atk_rate += sc->data[SC_PYREXIA]->val2;
-		if (sc->data[SC_LUXANIMA]) {
-			pc_bonus2(sd, SP_ADDSIZE, SZ_ALL, sc->data[SC_LUXANIMA]->val3);
-			sd->bonus.crit_atk_rate += sc->data[SC_LUXANIMA]->val3;
-			sd->bonus.short_attack_atk_rate += sc->data[SC_LUXANIMA]->val3;
-			sd->bonus.long_attack_atk_rate += sc->data[SC_LUXANIMA]->val3;
-		}
-		if (sc->data[SC_STRIKING])
+		if (sc->getSCE(SC_FORTUNE))
+			sd->bonus.crit_atk_rate += 2 * sc->getSCE(SC_FORTUNE)->val1;
+#endif
+		if (sc->getSCE(SC_SYMPHONYOFLOVER)) {
+			sd->indexed_bonus.subele[ELE_GHOST] += sc->getSCE(SC_SYMPHONYOFLOVER)->val1 * 3;
+			sd->indexed_bonus.subele[ELE_HOLY] += sc->getSCE(SC_SYMPHONYOFLOVER)->val1 * 3;
+		}
+		if (sc->getSCE(SC_PYREXIA) && sc->getSCE(SC_PYREXIA)->val3 == 0)
+			sd->bonus.crit_atk_rate += sc->getSCE(SC_PYREXIA)->val2;
+		if (sc->getSCE(SC_LUXANIMA)) {
+			pc_bonus2(sd, SP_ADDSIZE, SZ_ALL, sc->getSCE(SC_LUXANIMA)->val3);
+			sd->bonus.crit_atk_rate += sc->getSCE(SC_LUXANIMA)->val3;
+			sd->bonus.short_attack_atk_rate += sc->getSCE(SC_LUXANIMA)->val3;
+			sd->bonus.long_attack_atk_rate += sc->getSCE(SC_LUXANIMA)->val3;
+		}
+		if (sc->getSCE(SC_STRIKING))
 			sd->bonus.perfect_hit += 20 + 10 * pc_checkskill(sd, SO_STRIKING);
 	}
 	status_cpy(&sd->battle_status, base_status);
@@ -5086,9 +5086,9 @@ int status_calc_pc_sub(struct map_session_data* sd, enum e_status_calc_opt opt)
 		clif_skillinfoblock(sd);
 
 	// If the skill is learned, the status is infinite.
-	if (pc_checkskill(sd, SU_SPRITEMABLE) > 0 && !sd->sc.data[SC_SPRITEMABLE])
+	if (pc_checkskill(sd, SU_SPRITEMABLE) > 0 && !sd->sc.getSCE(SC_SPRITEMABLE))
 		sc_start(&sd->bl, &sd->bl, SC_SPRITEMABLE, 100, 1, INFINITE_TICK);
-	if (pc_checkskill(sd, SU_SOULATTACK) > 0 && !sd->sc.data[SC_SOULATTACK])
+	if (pc_checkskill(sd, SU_SOULATTACK) > 0 && !sd->sc.getSCE(SC_SOULATTACK))
 		sc_start(&sd->bl, &sd->bl, SC_SOULATTACK, 100, 1, INFINITE_TICK);
 
 	calculating = 0;
@@ -5380,8 +5380,8 @@ void status_calc_regen(struct block_list *bl, struct status_data *status, struct
 			val += skill*5 + skill*status->max_hp/500;
 
 		if (sc && sc->count) {
-			if (sc->data[SC_INCREASE_MAXHP])
-				val += val * sc->data[SC_INCREASE_MAXHP]->val2 / 100;
+			if (sc->getSCE(SC_INCREASE_MAXHP))
+				val += val * sc->getSCE(SC_INCREASE_MAXHP)->val2 / 100;
 		}
 
 		sregen->hp = cap_value(val, 0, SHRT_MAX);
@@ -5395,12 +5395,12 @@ void status_calc_regen(struct block_list *bl, struct status_data *status, struct
 			val += 3 + 3 * skill;
 
 		if (sc && sc->count) {
-			if (sc->data[SC_SHRIMPBLESSING])
+			if (sc->getSCE(SC_SHRIMPBLESSING))
 				val *= 150 / 100;
-			if (sc->data[SC_ANCILLA])
-				val += sc->data[SC_ANCILLA]->val2 / 100;
-			if (sc->data[SC_INCREASE_MAXSP])
-				val += val * sc->data[SC_INCREASE_MAXSP]->val2 / 100;
+			if (sc->getSCE(SC_ANCILLA))
+				val += sc->getSCE(SC_ANCILLA)->val2 / 100;
+			if (sc->getSCE(SC_INCREASE_MAXSP))
+				val += val * sc->getSCE(SC_INCREASE_MAXSP)->val2 / 100;
 		}
 
 		sregen->sp = cap_value(val, 0, SHRT_MAX);
@@ -5486,33 +5486,33 @@ void status_calc_regen_rate(struct block_list *bl, struct regen_data *regen, str
 		return;
 
 	// No HP or SP regen
-	if ((sc->data[SC_POISON] && !sc->data[SC_SLOWPOISON])
-		|| (sc->data[SC_DPOISON] && !sc->data[SC_SLOWPOISON])
-		|| sc->data[SC_BERSERK]
-		|| sc->data[SC_TRICKDEAD]
-		|| sc->data[SC_BLEEDING]
-		|| (sc->data[SC_MAGICMUSHROOM] && sc->data[SC_MAGICMUSHROOM]->val3 == 1)
-		|| sc->data[SC_SATURDAYNIGHTFEVER]
-		|| sc->data[SC_REBOUND])
+	if ((sc->getSCE(SC_POISON) && !sc->getSCE(SC_SLOWPOISON))
+		|| (sc->getSCE(SC_DPOISON) && !sc->getSCE(SC_SLOWPOISON))
+		|| sc->getSCE(SC_BERSERK)
+		|| sc->getSCE(SC_TRICKDEAD)
+		|| sc->getSCE(SC_BLEEDING)
+		|| (sc->getSCE(SC_MAGICMUSHROOM) && sc->getSCE(SC_MAGICMUSHROOM)->val3 == 1)
+		|| sc->getSCE(SC_SATURDAYNIGHTFEVER)
+		|| sc->getSCE(SC_REBOUND))
 		regen->flag = RGN_NONE;
 
 	// No natural SP regen
-	if (sc->data[SC_DANCING] ||
+	if (sc->getSCE(SC_DANCING) ||
 #ifdef RENEWAL
-		sc->data[SC_MAXIMIZEPOWER] ||
+		sc->getSCE(SC_MAXIMIZEPOWER) ||
 #endif
 #ifndef RENEWAL
 		(bl->type == BL_PC && (((TBL_PC*)bl)->class_&MAPID_UPPERMASK) == MAPID_MONK &&
-		(sc->data[SC_EXTREMITYFIST] || sc->data[SC_EXPLOSIONSPIRITS]) && (!sc->data[SC_SPIRIT] || sc->data[SC_SPIRIT]->val2 != SL_MONK)) ||
+		(sc->getSCE(SC_EXTREMITYFIST) || sc->getSCE(SC_EXPLOSIONSPIRITS)) && (!sc->getSCE(SC_SPIRIT) || sc->getSCE(SC_SPIRIT)->val2 != SL_MONK)) ||
 #else
 		(bl->type == BL_PC && (((TBL_PC*)bl)->class_&MAPID_UPPERMASK) == MAPID_MONK &&
-		sc->data[SC_EXTREMITYFIST] && (!sc->data[SC_SPIRIT] || sc->data[SC_SPIRIT]->val2 != SL_MONK)) ||
+		sc->getSCE(SC_EXTREMITYFIST) && (!sc->getSCE(SC_SPIRIT) || sc->getSCE(SC_SPIRIT)->val2 != SL_MONK)) ||
 #endif
-		(sc->data[SC_OBLIVIONCURSE] && sc->data[SC_OBLIVIONCURSE]->val3 == 1))
+		(sc->getSCE(SC_OBLIVIONCURSE) && sc->getSCE(SC_OBLIVIONCURSE)->val3 == 1))
 		regen->flag &= ~RGN_SP;
 
-	if (sc->data[SC_TENSIONRELAX]) {
-		if (sc->data[SC_WEIGHT50] || sc->data[SC_WEIGHT90])
+	if (sc->getSCE(SC_TENSIONRELAX)) {
+		if (sc->getSCE(SC_WEIGHT50) || sc->getSCE(SC_WEIGHT90))
 			regen->state.overweight = 0; // 1x HP regen
 		else {
 			regen->rate.hp += 200;
@@ -5521,25 +5521,25 @@ void status_calc_regen_rate(struct block_list *bl, struct regen_data *regen, str
 		}
 	}
 
-	if (sc->data[SC_MAGNIFICAT])
+	if (sc->getSCE(SC_MAGNIFICAT))
 		regen->rate.sp += 100;
 
-	if (sc->data[SC_REGENERATION]) {
-		const struct status_change_entry *sce = sc->data[SC_REGENERATION];
+	if (sc->getSCE(SC_REGENERATION)) {
+		const struct status_change_entry *sce = sc->getSCE(SC_REGENERATION);
 		if (!sce->val4) {
 			regen->rate.hp += (sce->val2*100);
 			regen->rate.sp += (sce->val3*100);
 		} else
 			regen->flag &= ~sce->val4; // Remove regen as specified by val4
 	}
-	if(sc->data[SC_GT_REVITALIZE]) {
-		regen->hp += cap_value(regen->hp * sc->data[SC_GT_REVITALIZE]->val3/100, 1, SHRT_MAX);
+	if(sc->getSCE(SC_GT_REVITALIZE)) {
+		regen->hp += cap_value(regen->hp * sc->getSCE(SC_GT_REVITALIZE)->val3/100, 1, SHRT_MAX);
 		regen->state.walk = 1;
 	}
-	if (sc->data[SC_EXTRACT_WHITE_POTION_Z])
-		regen->hp += cap_value(regen->hp * sc->data[SC_EXTRACT_WHITE_POTION_Z]->val1 / 100, 1, SHRT_MAX);
-	if (sc->data[SC_VITATA_500])
-		regen->sp += cap_value(regen->sp * sc->data[SC_VITATA_500]->val1 / 100, 1, SHRT_MAX);
+	if (sc->getSCE(SC_EXTRACT_WHITE_POTION_Z))
+		regen->hp += cap_value(regen->hp * sc->getSCE(SC_EXTRACT_WHITE_POTION_Z)->val1 / 100, 1, SHRT_MAX);
+	if (sc->getSCE(SC_VITATA_500))
+		regen->sp += cap_value(regen->sp * sc->getSCE(SC_VITATA_500)->val1 / 100, 1, SHRT_MAX);
 	if (bl->type == BL_ELEM) { // Recovery bonus only applies to the Elementals.
 		int ele_class = status_get_class(bl);
 
@@ -5547,46 +5547,46 @@ void status_calc_regen_rate(struct block_list *bl, struct regen_data *regen, str
 		case ELEMENTALID_AGNI_S:
 		case ELEMENTALID_AGNI_M:
 		case ELEMENTALID_AGNI_L:
-			if (sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 1)
+			if (sc->getSCE(SC_FIRE_INSIGNIA) && sc->getSCE(SC_FIRE_INSIGNIA)->val1 == 1)
 				regen->rate.hp += 100;
 			break;
 		case ELEMENTALID_AQUA_S:
 		case ELEMENTALID_AQUA_M:
 		case ELEMENTALID_AQUA_L:
-			if (sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 1)
+			if (sc->getSCE(SC_WATER_INSIGNIA) && sc->getSCE(SC_WATER_INSIGNIA)->val1 == 1)
 				regen->rate.hp += 100;
 			break;
 		case ELEMENTALID_VENTUS_S:
 		case ELEMENTALID_VENTUS_M:
 		case ELEMENTALID_VENTUS_L:
-			if (sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 1)
+			if (sc->getSCE(SC_WIND_INSIGNIA) && sc->getSCE(SC_WIND_INSIGNIA)->val1 == 1)
 				regen->rate.hp += 100;
 			break;
 		case ELEMENTALID_TERA_S:
 		case ELEMENTALID_TERA_M:
 		case ELEMENTALID_TERA_L:
-			if (sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 1)
+			if (sc->getSCE(SC_EARTH_INSIGNIA) && sc->getSCE(SC_EARTH_INSIGNIA)->val1 == 1)
 				regen->rate.hp += 100;
 			break;
 		}
 	}
 
-	if (sc->data[SC_CATNIPPOWDER]) {
+	if (sc->getSCE(SC_CATNIPPOWDER)) {
 		regen->rate.hp *= 2;
 		regen->rate.sp *= 2;
 	}
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN]) {
-		if (sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_HPREGEN)
+	if (sc->getSCE(SC_NIBELUNGEN)) {
+		if (sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_HPREGEN)
 			regen->rate.hp += 100;
-		else if (sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_SPREGEN)
+		else if (sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_SPREGEN)
 			regen->rate.sp += 100;
 	}
 #endif
-	if (sc->data[SC_SIRCLEOFNATURE])
-		regen->rate.hp += sc->data[SC_SIRCLEOFNATURE]->val2;
-	if (sc->data[SC_SONGOFMANA])
-		regen->rate.sp += sc->data[SC_SONGOFMANA]->val3;
+	if (sc->getSCE(SC_SIRCLEOFNATURE))
+		regen->rate.hp += sc->getSCE(SC_SIRCLEOFNATURE)->val2;
+	if (sc->getSCE(SC_SONGOFMANA))
+		regen->rate.sp += sc->getSCE(SC_SONGOFMANA)->val3;
 }
 
 /**
@@ -5610,12 +5610,12 @@ void status_calc_state( struct block_list *bl, struct status_change *sc, enum sc
 		if( !(flag&SCS_NOMOVECOND) )
 			sc->cant.move += ( start ? 1 : ((sc->cant.move)? -1:0) );
 		else if(
-				     (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF)	// cannot move while gospel is in effect
+				     (sc->getSCE(SC_GOSPEL) && sc->getSCE(SC_GOSPEL)->val4 == BCT_SELF)	// cannot move while gospel is in effect
 #ifndef RENEWAL
-				  || (sc->data[SC_BASILICA] && sc->data[SC_BASILICA]->val4 == bl->id) // Basilica caster cannot move
-				  || (sc->data[SC_GRAVITATION] && sc->data[SC_GRAVITATION]->val3 == BCT_SELF)
+				  || (sc->getSCE(SC_BASILICA) && sc->getSCE(SC_BASILICA)->val4 == bl->id) // Basilica caster cannot move
+				  || (sc->getSCE(SC_GRAVITATION) && sc->getSCE(SC_GRAVITATION)->val3 == BCT_SELF)
 #endif
-				  || (sc->data[SC_CAMOUFLAGE] && sc->data[SC_CAMOUFLAGE]->val1 < 3)
+				  || (sc->getSCE(SC_CAMOUFLAGE) && sc->getSCE(SC_CAMOUFLAGE)->val1 < 3)
 				)
 			sc->cant.move += ( start ? 1 : ((sc->cant.move)? -1:0) );
 	}
@@ -5624,7 +5624,7 @@ void status_calc_state( struct block_list *bl, struct status_change *sc, enum sc
 	if( flag&SCS_NOCAST ) {
 		if( !(flag&SCS_NOCASTCOND) )
 			sc->cant.cast += ( start ? 1 : -1 );
-		else if (sc->data[SC_OBLIVIONCURSE] && sc->data[SC_OBLIVIONCURSE]->val3 == 1)
+		else if (sc->getSCE(SC_OBLIVIONCURSE) && sc->getSCE(SC_OBLIVIONCURSE)->val3 == 1)
 			sc->cant.cast += (start ? 1 : -1);
 	}
 
@@ -5632,7 +5632,7 @@ void status_calc_state( struct block_list *bl, struct status_change *sc, enum sc
 	if( flag&SCS_NOCHAT ) {
 		if( !(flag&SCS_NOCHATCOND) )
 			sc->cant.chat += ( start ? 1 : -1 );
-		else if(sc->data[SC_NOCHAT] && sc->data[SC_NOCHAT]->val1&MANNER_NOCHAT)
+		else if(sc->getSCE(SC_NOCHAT) && sc->getSCE(SC_NOCHAT)->val1&MANNER_NOCHAT)
 			sc->cant.chat += ( start ? 1 : -1 );
 	}
 
@@ -5642,7 +5642,7 @@ void status_calc_state( struct block_list *bl, struct status_change *sc, enum sc
 		if( flag&SCS_NOPICKITEM ) {
 			if( !(flag&SCS_NOPICKITEMCOND) )
 				sc->cant.pickup += ( start ? 1 : -1 );
-			else if( (sc->data[SC_NOCHAT] && sc->data[SC_NOCHAT]->val1&MANNER_NOITEM) )
+			else if( (sc->getSCE(SC_NOCHAT) && sc->getSCE(SC_NOCHAT)->val1&MANNER_NOITEM) )
 				sc->cant.pickup += ( start ? 1 : -1 );
 		}
 
@@ -5650,7 +5650,7 @@ void status_calc_state( struct block_list *bl, struct status_change *sc, enum sc
 		if( flag&SCS_NODROPITEM ) {
 			if( !(flag&SCS_NODROPITEMCOND) )
 				sc->cant.drop += ( start ? 1 : -1 );
-			else if( (sc->data[SC_NOCHAT] && sc->data[SC_NOCHAT]->val1&MANNER_NOITEM) )
+			else if( (sc->getSCE(SC_NOCHAT) && sc->getSCE(SC_NOCHAT)->val1&MANNER_NOITEM) )
 				sc->cant.drop += ( start ? 1 : -1 );
 		}
 	}
@@ -6050,7 +6050,7 @@ void status_calc_bl_main(struct block_list *bl, /*enum scb_flag*/int flag)
 		}
 
 		if ((bl->type&BL_HOM && battle_config.hom_setting&HOMSET_SAME_MATK)  /// Hom Min Matk is always the same as Max Matk
-				|| (sc && sc->data[SC_RECOGNIZEDSPELL]))
+				|| (sc && sc->getSCE(SC_RECOGNIZEDSPELL)))
 			status->matk_min = status->matk_max;
 
 #ifdef RENEWAL
@@ -6360,74 +6360,74 @@ static unsigned short status_calc_str(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(str,0,USHRT_MAX);
 
-	if(sc->data[SC_HARMONIZE]) {
-		str -= sc->data[SC_HARMONIZE]->val2;
+	if(sc->getSCE(SC_HARMONIZE)) {
+		str -= sc->getSCE(SC_HARMONIZE)->val2;
 		return (unsigned short)cap_value(str,0,USHRT_MAX);
 	}
-	if(sc->data[SC_INCALLSTATUS])
-		str += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_CHASEWALK2])
-		str += sc->data[SC_CHASEWALK2]->val1;
-	if(sc->data[SC_INCSTR])
-		str += sc->data[SC_INCSTR]->val1;
-	if(sc->data[SC_STRFOOD])
-		str += sc->data[SC_STRFOOD]->val1;
-	if(sc->data[SC_FOOD_STR_CASH])
-		str += sc->data[SC_FOOD_STR_CASH]->val1;
-	if(sc->data[SC_BATTLEORDERS])
+	if(sc->getSCE(SC_INCALLSTATUS))
+		str += sc->getSCE(SC_INCALLSTATUS)->val1;
+	if(sc->getSCE(SC_CHASEWALK2))
+		str += sc->getSCE(SC_CHASEWALK2)->val1;
+	if(sc->getSCE(SC_INCSTR))
+		str += sc->getSCE(SC_INCSTR)->val1;
+	if(sc->getSCE(SC_STRFOOD))
+		str += sc->getSCE(SC_STRFOOD)->val1;
+	if(sc->getSCE(SC_FOOD_STR_CASH))
+		str += sc->getSCE(SC_FOOD_STR_CASH)->val1;
+	if(sc->getSCE(SC_BATTLEORDERS))
 		str += 5;
-	if(sc->data[SC_LEADERSHIP])
-		str += sc->data[SC_LEADERSHIP]->val1;
-	if(sc->data[SC_LOUD])
+	if(sc->getSCE(SC_LEADERSHIP))
+		str += sc->getSCE(SC_LEADERSHIP)->val1;
+	if(sc->getSCE(SC_LOUD))
 		str += 4;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc->getSCE(SC_TRUESIGHT))
 		str += 5;
-	if(sc->data[SC_SPURT])
+	if(sc->getSCE(SC_SPURT))
 		str += 10;
-	if(sc->data[SC_NEN])
-		str += sc->data[SC_NEN]->val1;
-	if(sc->data[SC_BLESSING]) {
-		if(sc->data[SC_BLESSING]->val2)
-			str += sc->data[SC_BLESSING]->val2;
+	if(sc->getSCE(SC_NEN))
+		str += sc->getSCE(SC_NEN)->val1;
+	if(sc->getSCE(SC_BLESSING)) {
+		if(sc->getSCE(SC_BLESSING)->val2)
+			str += sc->getSCE(SC_BLESSING)->val2;
 		else
 			str >>= 1;
 	}
-	if(sc->data[SC_MARIONETTE])
-		str -= ((sc->data[SC_MARIONETTE]->val3)>>16)&0xFF;
-	if(sc->data[SC_MARIONETTE2])
-		str += ((sc->data[SC_MARIONETTE2]->val3)>>16)&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
-		str += ((sc->data[SC_SPIRIT]->val3)>>16)&0xFF;
-	if(sc->data[SC_GIANTGROWTH])
-		str += sc->data[SC_GIANTGROWTH]->val2;
-	if(sc->data[SC_BEYONDOFWARCRY])
-		str -= sc->data[SC_BEYONDOFWARCRY]->val2;
-	if(sc->data[SC_SAVAGE_STEAK])
-		str += sc->data[SC_SAVAGE_STEAK]->val1;
-	if(sc->data[SC_INSPIRATION])
-		str += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_2011RWC_SCROLL])
-		str += sc->data[SC_2011RWC_SCROLL]->val1;
-	if(sc->data[SC_STOMACHACHE])
-		str -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		str -= sc->data[SC_KYOUGAKU]->val2;
-	if(sc->data[SC_SWORDCLAN])
+	if(sc->getSCE(SC_MARIONETTE))
+		str -= ((sc->getSCE(SC_MARIONETTE)->val3)>>16)&0xFF;
+	if(sc->getSCE(SC_MARIONETTE2))
+		str += ((sc->getSCE(SC_MARIONETTE2)->val3)>>16)&0xFF;
+	if(sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_HIGH)
+		str += ((sc->getSCE(SC_SPIRIT)->val3)>>16)&0xFF;
+	if(sc->getSCE(SC_GIANTGROWTH))
+		str += sc->getSCE(SC_GIANTGROWTH)->val2;
+	if(sc->getSCE(SC_BEYONDOFWARCRY))
+		str -= sc->getSCE(SC_BEYONDOFWARCRY)->val2;
+	if(sc->getSCE(SC_SAVAGE_STEAK))
+		str += sc->getSCE(SC_SAVAGE_STEAK)->val1;
+	if(sc->getSCE(SC_INSPIRATION))
+		str += sc->getSCE(SC_INSPIRATION)->val3;
+	if(sc->getSCE(SC_2011RWC_SCROLL))
+		str += sc->getSCE(SC_2011RWC_SCROLL)->val1;
+	if(sc->getSCE(SC_STOMACHACHE))
+		str -= sc->getSCE(SC_STOMACHACHE)->val1;
+	if(sc->getSCE(SC_KYOUGAKU))
+		str -= sc->getSCE(SC_KYOUGAKU)->val2;
+	if(sc->getSCE(SC_SWORDCLAN))
 		str += 1;
-	if(sc->data[SC_JUMPINGCLAN])
+	if(sc->getSCE(SC_JUMPINGCLAN))
 		str += 1;
-	if(sc->data[SC_FULL_THROTTLE])
-		str += str * sc->data[SC_FULL_THROTTLE]->val3 / 100;
-	if(sc->data[SC_CHEERUP])
+	if(sc->getSCE(SC_FULL_THROTTLE))
+		str += str * sc->getSCE(SC_FULL_THROTTLE)->val3 / 100;
+	if(sc->getSCE(SC_CHEERUP))
 		str += 3;
-	if(sc->data[SC_GLASTHEIM_STATE])
-		str += sc->data[SC_GLASTHEIM_STATE]->val1;
+	if(sc->getSCE(SC_GLASTHEIM_STATE))
+		str += sc->getSCE(SC_GLASTHEIM_STATE)->val1;
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_ALLSTAT)
+	if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_ALLSTAT)
 		str += 15;
 #endif
-	if (sc->data[SC_UNIVERSESTANCE])
-		str += sc->data[SC_UNIVERSESTANCE]->val2;
+	if (sc->getSCE(SC_UNIVERSESTANCE))
+		str += sc->getSCE(SC_UNIVERSESTANCE)->val2;
 
 	return (unsigned short)cap_value(str,0,USHRT_MAX);
 }
@@ -6444,72 +6444,72 @@ static unsigned short status_calc_agi(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(agi,0,USHRT_MAX);
 
-	if(sc->data[SC_HARMONIZE]) {
-		agi -= sc->data[SC_HARMONIZE]->val2;
+	if(sc->getSCE(SC_HARMONIZE)) {
+		agi -= sc->getSCE(SC_HARMONIZE)->val2;
 		return (unsigned short)cap_value(agi,0,USHRT_MAX);
 	}
-	if(sc->data[SC_CONCENTRATE] && !sc->data[SC_QUAGMIRE])
-		agi += (agi-sc->data[SC_CONCENTRATE]->val3)*sc->data[SC_CONCENTRATE]->val2/100;
-	if(sc->data[SC_INCALLSTATUS])
-		agi += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCAGI])
-		agi += sc->data[SC_INCAGI]->val1;
-	if(sc->data[SC_AGIFOOD])
-		agi += sc->data[SC_AGIFOOD]->val1;
-	if(sc->data[SC_FOOD_AGI_CASH])
-		agi += sc->data[SC_FOOD_AGI_CASH]->val1;
-	if(sc->data[SC_SOULCOLD])
-		agi += sc->data[SC_SOULCOLD]->val1;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc->getSCE(SC_CONCENTRATE) && !sc->getSCE(SC_QUAGMIRE))
+		agi += (agi-sc->getSCE(SC_CONCENTRATE)->val3)*sc->getSCE(SC_CONCENTRATE)->val2/100;
+	if(sc->getSCE(SC_INCALLSTATUS))
+		agi += sc->getSCE(SC_INCALLSTATUS)->val1;
+	if(sc->getSCE(SC_INCAGI))
+		agi += sc->getSCE(SC_INCAGI)->val1;
+	if(sc->getSCE(SC_AGIFOOD))
+		agi += sc->getSCE(SC_AGIFOOD)->val1;
+	if(sc->getSCE(SC_FOOD_AGI_CASH))
+		agi += sc->getSCE(SC_FOOD_AGI_CASH)->val1;
+	if(sc->getSCE(SC_SOULCOLD))
+		agi += sc->getSCE(SC_SOULCOLD)->val1;
+	if(sc->getSCE(SC_TRUESIGHT))
 		agi += 5;
-	if(sc->data[SC_INCREASEAGI])
-		agi += sc->data[SC_INCREASEAGI]->val2;
-	if(sc->data[SC_INCREASING])
+	if(sc->getSCE(SC_INCREASEAGI))
+		agi += sc->getSCE(SC_INCREASEAGI)->val2;
+	if(sc->getSCE(SC_INCREASING))
 		agi += 4; // Added based on skill updates [Reddozen]
-	if(sc->data[SC_2011RWC_SCROLL])
-		agi += sc->data[SC_2011RWC_SCROLL]->val1;
-	if(sc->data[SC_DECREASEAGI])
-		agi -= sc->data[SC_DECREASEAGI]->val2;
-	if(sc->data[SC_QUAGMIRE])
-		agi -= sc->data[SC_QUAGMIRE]->val2;
-	if(sc->data[SC_SUITON] && sc->data[SC_SUITON]->val3)
-		agi -= sc->data[SC_SUITON]->val2;
-	if(sc->data[SC_MARIONETTE])
-		agi -= ((sc->data[SC_MARIONETTE]->val3)>>8)&0xFF;
-	if(sc->data[SC_MARIONETTE2])
-		agi += ((sc->data[SC_MARIONETTE2]->val3)>>8)&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
-		agi += ((sc->data[SC_SPIRIT]->val3)>>8)&0xFF;
-	if(sc->data[SC_ADORAMUS])
-		agi -= sc->data[SC_ADORAMUS]->val2;
-	if(sc->data[SC_MARSHOFABYSS])
-		agi -= agi * sc->data[SC_MARSHOFABYSS]->val2 / 100;
-	if(sc->data[SC_DROCERA_HERB_STEAMED])
-		agi += sc->data[SC_DROCERA_HERB_STEAMED]->val1;
-	if(sc->data[SC_INSPIRATION])
-		agi += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_STOMACHACHE])
-		agi -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		agi -= sc->data[SC_KYOUGAKU]->val2;
-	if(sc->data[SC_CROSSBOWCLAN])
+	if(sc->getSCE(SC_2011RWC_SCROLL))
+		agi += sc->getSCE(SC_2011RWC_SCROLL)->val1;
+	if(sc->getSCE(SC_DECREASEAGI))
+		agi -= sc->getSCE(SC_DECREASEAGI)->val2;
+	if(sc->getSCE(SC_QUAGMIRE))
+		agi -= sc->getSCE(SC_QUAGMIRE)->val2;
+	if(sc->getSCE(SC_SUITON) && sc->getSCE(SC_SUITON)->val3)
+		agi -= sc->getSCE(SC_SUITON)->val2;
+	if(sc->getSCE(SC_MARIONETTE))
+		agi -= ((sc->getSCE(SC_MARIONETTE)->val3)>>8)&0xFF;
+	if(sc->getSCE(SC_MARIONETTE2))
+		agi += ((sc->getSCE(SC_MARIONETTE2)->val3)>>8)&0xFF;
+	if(sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_HIGH)
+		agi += ((sc->getSCE(SC_SPIRIT)->val3)>>8)&0xFF;
+	if(sc->getSCE(SC_ADORAMUS))
+		agi -= sc->getSCE(SC_ADORAMUS)->val2;
+	if(sc->getSCE(SC_MARSHOFABYSS))
+		agi -= agi * sc->getSCE(SC_MARSHOFABYSS)->val2 / 100;
+	if(sc->getSCE(SC_DROCERA_HERB_STEAMED))
+		agi += sc->getSCE(SC_DROCERA_HERB_STEAMED)->val1;
+	if(sc->getSCE(SC_INSPIRATION))
+		agi += sc->getSCE(SC_INSPIRATION)->val3;
+	if(sc->getSCE(SC_STOMACHACHE))
+		agi -= sc->getSCE(SC_STOMACHACHE)->val1;
+	if(sc->getSCE(SC_KYOUGAKU))
+		agi -= sc->getSCE(SC_KYOUGAKU)->val2;
+	if(sc->getSCE(SC_CROSSBOWCLAN))
 		agi += 1;
-	if(sc->data[SC_JUMPINGCLAN])
+	if(sc->getSCE(SC_JUMPINGCLAN))
 		agi += 1;
-	if(sc->data[SC_FULL_THROTTLE])
-		agi += agi * sc->data[SC_FULL_THROTTLE]->val3 / 100;
-	if (sc->data[SC_ARCLOUSEDASH])
-		agi += sc->data[SC_ARCLOUSEDASH]->val2;
-	if(sc->data[SC_CHEERUP])
+	if(sc->getSCE(SC_FULL_THROTTLE))
+		agi += agi * sc->getSCE(SC_FULL_THROTTLE)->val3 / 100;
+	if (sc->getSCE(SC_ARCLOUSEDASH))
+		agi += sc->getSCE(SC_ARCLOUSEDASH)->val2;
+	if(sc->getSCE(SC_CHEERUP))
 		agi += 3;
-	if(sc->data[SC_GLASTHEIM_STATE])
-		agi += sc->data[SC_GLASTHEIM_STATE]->val1;
+	if(sc->getSCE(SC_GLASTHEIM_STATE))
+		agi += sc->getSCE(SC_GLASTHEIM_STATE)->val1;
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_ALLSTAT)
+	if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_ALLSTAT)
 		agi += 15;
 #endif
-	if (sc->data[SC_UNIVERSESTANCE])
-		agi += sc->data[SC_UNIVERSESTANCE]->val2;
+	if (sc->getSCE(SC_UNIVERSESTANCE))
+		agi += sc->getSCE(SC_UNIVERSESTANCE)->val2;
 
 	return (unsigned short)cap_value(agi,0,USHRT_MAX);
 }
@@ -6526,62 +6526,62 @@ static unsigned short status_calc_vit(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(vit,0,USHRT_MAX);
 
-	if(sc->data[SC_HARMONIZE]) {
-		vit -= sc->data[SC_HARMONIZE]->val2;
+	if(sc->getSCE(SC_HARMONIZE)) {
+		vit -= sc->getSCE(SC_HARMONIZE)->val2;
 		return (unsigned short)cap_value(vit,0,USHRT_MAX);
 	}
-	if(sc->data[SC_INCALLSTATUS])
-		vit += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCVIT])
-		vit += sc->data[SC_INCVIT]->val1;
-	if(sc->data[SC_VITFOOD])
-		vit += sc->data[SC_VITFOOD]->val1;
-	if(sc->data[SC_FOOD_VIT_CASH])
-		vit += sc->data[SC_FOOD_VIT_CASH]->val1;
-	if(sc->data[SC_CHANGE])
-		vit += sc->data[SC_CHANGE]->val2;
-	if(sc->data[SC_GLORYWOUNDS])
-		vit += sc->data[SC_GLORYWOUNDS]->val1;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc->getSCE(SC_INCALLSTATUS))
+		vit += sc->getSCE(SC_INCALLSTATUS)->val1;
+	if(sc->getSCE(SC_INCVIT))
+		vit += sc->getSCE(SC_INCVIT)->val1;
+	if(sc->getSCE(SC_VITFOOD))
+		vit += sc->getSCE(SC_VITFOOD)->val1;
+	if(sc->getSCE(SC_FOOD_VIT_CASH))
+		vit += sc->getSCE(SC_FOOD_VIT_CASH)->val1;
+	if(sc->getSCE(SC_CHANGE))
+		vit += sc->getSCE(SC_CHANGE)->val2;
+	if(sc->getSCE(SC_GLORYWOUNDS))
+		vit += sc->getSCE(SC_GLORYWOUNDS)->val1;
+	if(sc->getSCE(SC_TRUESIGHT))
 		vit += 5;
-	if(sc->data[SC_MARIONETTE])
-		vit -= sc->data[SC_MARIONETTE]->val3&0xFF;
-	if(sc->data[SC_MARIONETTE2])
-		vit += sc->data[SC_MARIONETTE2]->val3&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
-		vit += sc->data[SC_SPIRIT]->val3&0xFF;
-	if(sc->data[SC_MINOR_BBQ])
-		vit += sc->data[SC_MINOR_BBQ]->val1;
-	if(sc->data[SC_INSPIRATION])
-		vit += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_2011RWC_SCROLL])
-		vit += sc->data[SC_2011RWC_SCROLL]->val1;
-	if(sc->data[SC_STOMACHACHE])
-		vit -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		vit -= sc->data[SC_KYOUGAKU]->val2;
-	if(sc->data[SC_SWORDCLAN])
+	if(sc->getSCE(SC_MARIONETTE))
+		vit -= sc->getSCE(SC_MARIONETTE)->val3&0xFF;
+	if(sc->getSCE(SC_MARIONETTE2))
+		vit += sc->getSCE(SC_MARIONETTE2)->val3&0xFF;
+	if(sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_HIGH)
+		vit += sc->getSCE(SC_SPIRIT)->val3&0xFF;
+	if(sc->getSCE(SC_MINOR_BBQ))
+		vit += sc->getSCE(SC_MINOR_BBQ)->val1;
+	if(sc->getSCE(SC_INSPIRATION))
+		vit += sc->getSCE(SC_INSPIRATION)->val3;
+	if(sc->getSCE(SC_2011RWC_SCROLL))
+		vit += sc->getSCE(SC_2011RWC_SCROLL)->val1;
+	if(sc->getSCE(SC_STOMACHACHE))
+		vit -= sc->getSCE(SC_STOMACHACHE)->val1;
+	if(sc->getSCE(SC_KYOUGAKU))
+		vit -= sc->getSCE(SC_KYOUGAKU)->val2;
+	if(sc->getSCE(SC_SWORDCLAN))
 		vit += 1;
-	if(sc->data[SC_JUMPINGCLAN])
+	if(sc->getSCE(SC_JUMPINGCLAN))
 		vit += 1;
-	if(sc->data[SC_STRIPARMOR] && bl->type != BL_PC)
-		vit -= vit * sc->data[SC_STRIPARMOR]->val2/100;
-	if(sc->data[SC_FULL_THROTTLE])
-		vit += vit * sc->data[SC_FULL_THROTTLE]->val3 / 100;
+	if(sc->getSCE(SC_STRIPARMOR) && bl->type != BL_PC)
+		vit -= vit * sc->getSCE(SC_STRIPARMOR)->val2/100;
+	if(sc->getSCE(SC_FULL_THROTTLE))
+		vit += vit * sc->getSCE(SC_FULL_THROTTLE)->val3 / 100;
 #ifdef RENEWAL
-	if(sc->data[SC_DEFENCE])
-		vit += sc->data[SC_DEFENCE]->val2;
+	if(sc->getSCE(SC_DEFENCE))
+		vit += sc->getSCE(SC_DEFENCE)->val2;
 #endif
-	if(sc->data[SC_CHEERUP])
+	if(sc->getSCE(SC_CHEERUP))
 		vit += 3;
-	if(sc->data[SC_GLASTHEIM_STATE])
-		vit += sc->data[SC_GLASTHEIM_STATE]->val1;
+	if(sc->getSCE(SC_GLASTHEIM_STATE))
+		vit += sc->getSCE(SC_GLASTHEIM_STATE)->val1;
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_ALLSTAT)
+	if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_ALLSTAT)
 		vit += 15;
 #endif
-	if (sc->data[SC_UNIVERSESTANCE])
-		vit += sc->data[SC_UNIVERSESTANCE]->val2;
+	if (sc->getSCE(SC_UNIVERSESTANCE))
+		vit += sc->getSCE(SC_UNIVERSESTANCE)->val2;
 
 	return (unsigned short)cap_value(vit,0,USHRT_MAX);
 }
@@ -6598,75 +6598,75 @@ static unsigned short status_calc_int(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(int_,0,USHRT_MAX);
 
-	if(sc->data[SC_HARMONIZE]) {
-		int_ -= sc->data[SC_HARMONIZE]->val2;
+	if(sc->getSCE(SC_HARMONIZE)) {
+		int_ -= sc->getSCE(SC_HARMONIZE)->val2;
 		return (unsigned short)cap_value(int_,0,USHRT_MAX);
 	}
-	if(sc->data[SC_INCALLSTATUS])
-		int_ += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCINT])
-		int_ += sc->data[SC_INCINT]->val1;
-	if(sc->data[SC_INTFOOD])
-		int_ += sc->data[SC_INTFOOD]->val1;
-	if(sc->data[SC_FOOD_INT_CASH])
-		int_ += sc->data[SC_FOOD_INT_CASH]->val1;
-	if(sc->data[SC_CHANGE])
-		int_ += sc->data[SC_CHANGE]->val3;
-	if(sc->data[SC_BATTLEORDERS])
+	if(sc->getSCE(SC_INCALLSTATUS))
+		int_ += sc->getSCE(SC_INCALLSTATUS)->val1;
+	if(sc->getSCE(SC_INCINT))
+		int_ += sc->getSCE(SC_INCINT)->val1;
+	if(sc->getSCE(SC_INTFOOD))
+		int_ += sc->getSCE(SC_INTFOOD)->val1;
+	if(sc->getSCE(SC_FOOD_INT_CASH))
+		int_ += sc->getSCE(SC_FOOD_INT_CASH)->val1;
+	if(sc->getSCE(SC_CHANGE))
+		int_ += sc->getSCE(SC_CHANGE)->val3;
+	if(sc->getSCE(SC_BATTLEORDERS))
 		int_ += 5;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc->getSCE(SC_TRUESIGHT))
 		int_ += 5;
-	if(sc->data[SC_BLESSING]) {
-		if (sc->data[SC_BLESSING]->val2)
-			int_ += sc->data[SC_BLESSING]->val2;
+	if(sc->getSCE(SC_BLESSING)) {
+		if (sc->getSCE(SC_BLESSING)->val2)
+			int_ += sc->getSCE(SC_BLESSING)->val2;
 		else
 			int_ >>= 1;
 	}
-	if(sc->data[SC_NEN])
-		int_ += sc->data[SC_NEN]->val1;
-	if(sc->data[SC_MARIONETTE])
-		int_ -= ((sc->data[SC_MARIONETTE]->val4)>>16)&0xFF;
-	if(sc->data[SC_2011RWC_SCROLL])
-		int_ += sc->data[SC_2011RWC_SCROLL]->val1;
-	if(sc->data[SC_MARIONETTE2])
-		int_ += ((sc->data[SC_MARIONETTE2]->val4)>>16)&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
-		int_ += ((sc->data[SC_SPIRIT]->val4)>>16)&0xFF;
-	if(sc->data[SC_INSPIRATION])
-		int_ += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_MELODYOFSINK])
-		int_ -= sc->data[SC_MELODYOFSINK]->val2;
-	if(sc->data[SC_MANDRAGORA])
-		int_ -= 4 * sc->data[SC_MANDRAGORA]->val1;
-	if(sc->data[SC_COCKTAIL_WARG_BLOOD])
-		int_ += sc->data[SC_COCKTAIL_WARG_BLOOD]->val1;
-	if(sc->data[SC_STOMACHACHE])
-		int_ -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		int_ -= sc->data[SC_KYOUGAKU]->val2;
-	if(sc->data[SC_ARCWANDCLAN])
+	if(sc->getSCE(SC_NEN))
+		int_ += sc->getSCE(SC_NEN)->val1;
+	if(sc->getSCE(SC_MARIONETTE))
+		int_ -= ((sc->getSCE(SC_MARIONETTE)->val4)>>16)&0xFF;
+	if(sc->getSCE(SC_2011RWC_SCROLL))
+		int_ += sc->getSCE(SC_2011RWC_SCROLL)->val1;
+	if(sc->getSCE(SC_MARIONETTE2))
+		int_ += ((sc->getSCE(SC_MARIONETTE2)->val4)>>16)&0xFF;
+	if(sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_HIGH)
+		int_ += ((sc->getSCE(SC_SPIRIT)->val4)>>16)&0xFF;
+	if(sc->getSCE(SC_INSPIRATION))
+		int_ += sc->getSCE(SC_INSPIRATION)->val3;
+	if(sc->getSCE(SC_MELODYOFSINK))
+		int_ -= sc->getSCE(SC_MELODYOFSINK)->val2;
+	if(sc->getSCE(SC_MANDRAGORA))
+		int_ -= 4 * sc->getSCE(SC_MANDRAGORA)->val1;
+	if(sc->getSCE(SC_COCKTAIL_WARG_BLOOD))
+		int_ += sc->getSCE(SC_COCKTAIL_WARG_BLOOD)->val1;
+	if(sc->getSCE(SC_STOMACHACHE))
+		int_ -= sc->getSCE(SC_STOMACHACHE)->val1;
+	if(sc->getSCE(SC_KYOUGAKU))
+		int_ -= sc->getSCE(SC_KYOUGAKU)->val2;
+	if(sc->getSCE(SC_ARCWANDCLAN))
 		int_ += 1;
-	if(sc->data[SC_GOLDENMACECLAN])
+	if(sc->getSCE(SC_GOLDENMACECLAN))
 		int_ += 1;
-	if(sc->data[SC_JUMPINGCLAN])
+	if(sc->getSCE(SC_JUMPINGCLAN))
 		int_ += 1;
-	if(sc->data[SC_FULL_THROTTLE])
-		int_ += int_ * sc->data[SC_FULL_THROTTLE]->val3 / 100;
-	if(sc->data[SC_CHEERUP])
+	if(sc->getSCE(SC_FULL_THROTTLE))
+		int_ += int_ * sc->getSCE(SC_FULL_THROTTLE)->val3 / 100;
+	if(sc->getSCE(SC_CHEERUP))
 		int_ += 3;
-	if(sc->data[SC_GLASTHEIM_STATE])
-		int_ += sc->data[SC_GLASTHEIM_STATE]->val1;
-	if (sc->data[SC_UNIVERSESTANCE])
-		int_ += sc->data[SC_UNIVERSESTANCE]->val2;
+	if(sc->getSCE(SC_GLASTHEIM_STATE))
+		int_ += sc->getSCE(SC_GLASTHEIM_STATE)->val1;
+	if (sc->getSCE(SC_UNIVERSESTANCE))
+		int_ += sc->getSCE(SC_UNIVERSESTANCE)->val2;
 
 	if(bl->type != BL_PC) {
-		if(sc->data[SC_STRIPHELM])
-			int_ -= int_ * sc->data[SC_STRIPHELM]->val2/100;
-		if(sc->data[SC__STRIPACCESSORY])
-			int_ -= int_ * sc->data[SC__STRIPACCESSORY]->val2 / 100;
+		if(sc->getSCE(SC_STRIPHELM))
+			int_ -= int_ * sc->getSCE(SC_STRIPHELM)->val2/100;
+		if(sc->getSCE(SC__STRIPACCESSORY))
+			int_ -= int_ * sc->getSCE(SC__STRIPACCESSORY)->val2 / 100;
 	}
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_ALLSTAT)
+	if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_ALLSTAT)
 		int_ += 15;
 #endif
 
@@ -6685,74 +6685,74 @@ static unsigned short status_calc_dex(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(dex,0,USHRT_MAX);
 
-	if(sc->data[SC_HARMONIZE]) {
-		dex -= sc->data[SC_HARMONIZE]->val2;
+	if(sc->getSCE(SC_HARMONIZE)) {
+		dex -= sc->getSCE(SC_HARMONIZE)->val2;
 		return (unsigned short)cap_value(dex,0,USHRT_MAX);
 	}
-	if(sc->data[SC_CONCENTRATE] && !sc->data[SC_QUAGMIRE])
-		dex += (dex-sc->data[SC_CONCENTRATE]->val4)*sc->data[SC_CONCENTRATE]->val2/100;
-	if(sc->data[SC_INCALLSTATUS])
-		dex += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCDEX])
-		dex += sc->data[SC_INCDEX]->val1;
-	if(sc->data[SC_DEXFOOD])
-		dex += sc->data[SC_DEXFOOD]->val1;
-	if(sc->data[SC_FOOD_DEX_CASH])
-		dex += sc->data[SC_FOOD_DEX_CASH]->val1;
-	if(sc->data[SC_BATTLEORDERS])
+	if(sc->getSCE(SC_CONCENTRATE) && !sc->getSCE(SC_QUAGMIRE))
+		dex += (dex-sc->getSCE(SC_CONCENTRATE)->val4)*sc->getSCE(SC_CONCENTRATE)->val2/100;
+	if(sc->getSCE(SC_INCALLSTATUS))
+		dex += sc->getSCE(SC_INCALLSTATUS)->val1;
+	if(sc->getSCE(SC_INCDEX))
+		dex += sc->getSCE(SC_INCDEX)->val1;
+	if(sc->getSCE(SC_DEXFOOD))
+		dex += sc->getSCE(SC_DEXFOOD)->val1;
+	if(sc->getSCE(SC_FOOD_DEX_CASH))
+		dex += sc->getSCE(SC_FOOD_DEX_CASH)->val1;
+	if(sc->getSCE(SC_BATTLEORDERS))
 		dex += 5;
-	if(sc->data[SC_HAWKEYES])
-		dex += sc->data[SC_HAWKEYES]->val1;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc->getSCE(SC_HAWKEYES))
+		dex += sc->getSCE(SC_HAWKEYES)->val1;
+	if(sc->getSCE(SC_TRUESIGHT))
 		dex += 5;
-	if(sc->data[SC_QUAGMIRE])
-		dex -= sc->data[SC_QUAGMIRE]->val2;
-	if(sc->data[SC_BLESSING]) {
-		if (sc->data[SC_BLESSING]->val2)
-			dex += sc->data[SC_BLESSING]->val2;
+	if(sc->getSCE(SC_QUAGMIRE))
+		dex -= sc->getSCE(SC_QUAGMIRE)->val2;
+	if(sc->getSCE(SC_BLESSING)) {
+		if (sc->getSCE(SC_BLESSING)->val2)
+			dex += sc->getSCE(SC_BLESSING)->val2;
 		else
 			dex >>= 1;
 	}
-	if(sc->data[SC_INCREASING])
+	if(sc->getSCE(SC_INCREASING))
 		dex += 4; // Added based on skill updates [Reddozen]
-	if(sc->data[SC_MARIONETTE])
-		dex -= ((sc->data[SC_MARIONETTE]->val4)>>8)&0xFF;
-	if(sc->data[SC_2011RWC_SCROLL])
-		dex += sc->data[SC_2011RWC_SCROLL]->val1;
-	if(sc->data[SC_MARIONETTE2])
-		dex += ((sc->data[SC_MARIONETTE2]->val4)>>8)&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
-		dex += ((sc->data[SC_SPIRIT]->val4)>>8)&0xFF;
-	if(sc->data[SC_SIROMA_ICE_TEA])
-		dex += sc->data[SC_SIROMA_ICE_TEA]->val1;
-	if(sc->data[SC_INSPIRATION])
-		dex += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_STOMACHACHE])
-		dex -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		dex -= sc->data[SC_KYOUGAKU]->val2;
-	if(sc->data[SC_ARCWANDCLAN])
+	if(sc->getSCE(SC_MARIONETTE))
+		dex -= ((sc->getSCE(SC_MARIONETTE)->val4)>>8)&0xFF;
+	if(sc->getSCE(SC_2011RWC_SCROLL))
+		dex += sc->getSCE(SC_2011RWC_SCROLL)->val1;
+	if(sc->getSCE(SC_MARIONETTE2))
+		dex += ((sc->getSCE(SC_MARIONETTE2)->val4)>>8)&0xFF;
+	if(sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_HIGH)
+		dex += ((sc->getSCE(SC_SPIRIT)->val4)>>8)&0xFF;
+	if(sc->getSCE(SC_SIROMA_ICE_TEA))
+		dex += sc->getSCE(SC_SIROMA_ICE_TEA)->val1;
+	if(sc->getSCE(SC_INSPIRATION))
+		dex += sc->getSCE(SC_INSPIRATION)->val3;
+	if(sc->getSCE(SC_STOMACHACHE))
+		dex -= sc->getSCE(SC_STOMACHACHE)->val1;
+	if(sc->getSCE(SC_KYOUGAKU))
+		dex -= sc->getSCE(SC_KYOUGAKU)->val2;
+	if(sc->getSCE(SC_ARCWANDCLAN))
 		dex += 1;
-	if(sc->data[SC_CROSSBOWCLAN])
+	if(sc->getSCE(SC_CROSSBOWCLAN))
 		dex += 1;
-	if(sc->data[SC_JUMPINGCLAN])
+	if(sc->getSCE(SC_JUMPINGCLAN))
 		dex += 1;
-	if(sc->data[SC__STRIPACCESSORY] && bl->type != BL_PC)
-		dex -= dex * sc->data[SC__STRIPACCESSORY]->val2 / 100;
-	if(sc->data[SC_MARSHOFABYSS])
-		dex -= dex * sc->data[SC_MARSHOFABYSS]->val2 / 100;
-	if(sc->data[SC_FULL_THROTTLE])
-		dex += dex * sc->data[SC_FULL_THROTTLE]->val3 / 100;
-	if(sc->data[SC_CHEERUP])
+	if(sc->getSCE(SC__STRIPACCESSORY) && bl->type != BL_PC)
+		dex -= dex * sc->getSCE(SC__STRIPACCESSORY)->val2 / 100;
+	if(sc->getSCE(SC_MARSHOFABYSS))
+		dex -= dex * sc->getSCE(SC_MARSHOFABYSS)->val2 / 100;
+	if(sc->getSCE(SC_FULL_THROTTLE))
+		dex += dex * sc->getSCE(SC_FULL_THROTTLE)->val3 / 100;
+	if(sc->getSCE(SC_CHEERUP))
 		dex += 3;
-	if(sc->data[SC_GLASTHEIM_STATE])
-		dex += sc->data[SC_GLASTHEIM_STATE]->val1;
+	if(sc->getSCE(SC_GLASTHEIM_STATE))
+		dex += sc->getSCE(SC_GLASTHEIM_STATE)->val1;
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_ALLSTAT)
+	if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_ALLSTAT)
 		dex += 15;
 #endif
-	if (sc->data[SC_UNIVERSESTANCE])
-		dex += sc->data[SC_UNIVERSESTANCE]->val2;
+	if (sc->getSCE(SC_UNIVERSESTANCE))
+		dex += sc->getSCE(SC_UNIVERSESTANCE)->val2;
 
 	return (unsigned short)cap_value(dex,0,USHRT_MAX);
 }
@@ -6769,60 +6769,60 @@ static unsigned short status_calc_luk(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(luk,0,USHRT_MAX);
 
-	if(sc->data[SC_HARMONIZE]) {
-		luk -= sc->data[SC_HARMONIZE]->val2;
+	if(sc->getSCE(SC_HARMONIZE)) {
+		luk -= sc->getSCE(SC_HARMONIZE)->val2;
 		return (unsigned short)cap_value(luk,0,USHRT_MAX);
 	}
-	if(sc->data[SC_CURSE])
+	if(sc->getSCE(SC_CURSE))
 		return 0;
-	if(sc->data[SC_INCALLSTATUS])
-		luk += sc->data[SC_INCALLSTATUS]->val1;
-	if(sc->data[SC_INCLUK])
-		luk += sc->data[SC_INCLUK]->val1;
-	if(sc->data[SC_LUKFOOD])
-		luk += sc->data[SC_LUKFOOD]->val1;
-	if(sc->data[SC_FOOD_LUK_CASH])
-		luk += sc->data[SC_FOOD_LUK_CASH]->val1;
-	if(sc->data[SC_TRUESIGHT])
+	if(sc->getSCE(SC_INCALLSTATUS))
+		luk += sc->getSCE(SC_INCALLSTATUS)->val1;
+	if(sc->getSCE(SC_INCLUK))
+		luk += sc->getSCE(SC_INCLUK)->val1;
+	if(sc->getSCE(SC_LUKFOOD))
+		luk += sc->getSCE(SC_LUKFOOD)->val1;
+	if(sc->getSCE(SC_FOOD_LUK_CASH))
+		luk += sc->getSCE(SC_FOOD_LUK_CASH)->val1;
+	if(sc->getSCE(SC_TRUESIGHT))
 		luk += 5;
-	if(sc->data[SC_GLORIA])
+	if(sc->getSCE(SC_GLORIA))
 		luk += 30;
-	if(sc->data[SC_MARIONETTE])
-		luk -= sc->data[SC_MARIONETTE]->val4&0xFF;
-	if(sc->data[SC_MARIONETTE2])
-		luk += sc->data[SC_MARIONETTE2]->val4&0xFF;
-	if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
-		luk += sc->data[SC_SPIRIT]->val4&0xFF;
-	if(sc->data[SC_PUTTI_TAILS_NOODLES])
-		luk += sc->data[SC_PUTTI_TAILS_NOODLES]->val1;
-	if(sc->data[SC_INSPIRATION])
-		luk += sc->data[SC_INSPIRATION]->val3;
-	if(sc->data[SC_STOMACHACHE])
-		luk -= sc->data[SC_STOMACHACHE]->val1;
-	if(sc->data[SC_KYOUGAKU])
-		luk -= sc->data[SC_KYOUGAKU]->val2;
-	if(sc->data[SC_2011RWC_SCROLL])
-		luk += sc->data[SC_2011RWC_SCROLL]->val1;
-	if(sc->data[SC__STRIPACCESSORY] && bl->type != BL_PC)
-		luk -= luk * sc->data[SC__STRIPACCESSORY]->val2 / 100;
-	if(sc->data[SC_BANANA_BOMB])
+	if(sc->getSCE(SC_MARIONETTE))
+		luk -= sc->getSCE(SC_MARIONETTE)->val4&0xFF;
+	if(sc->getSCE(SC_MARIONETTE2))
+		luk += sc->getSCE(SC_MARIONETTE2)->val4&0xFF;
+	if(sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_HIGH)
+		luk += sc->getSCE(SC_SPIRIT)->val4&0xFF;
+	if(sc->getSCE(SC_PUTTI_TAILS_NOODLES))
+		luk += sc->getSCE(SC_PUTTI_TAILS_NOODLES)->val1;
+	if(sc->getSCE(SC_INSPIRATION))
+		luk += sc->getSCE(SC_INSPIRATION)->val3;
+	if(sc->getSCE(SC_STOMACHACHE))
+		luk -= sc->getSCE(SC_STOMACHACHE)->val1;
+	if(sc->getSCE(SC_KYOUGAKU))
+		luk -= sc->getSCE(SC_KYOUGAKU)->val2;
+	if(sc->getSCE(SC_2011RWC_SCROLL))
+		luk += sc->getSCE(SC_2011RWC_SCROLL)->val1;
+	if(sc->getSCE(SC__STRIPACCESSORY) && bl->type != BL_PC)
+		luk -= luk * sc->getSCE(SC__STRIPACCESSORY)->val2 / 100;
+	if(sc->getSCE(SC_BANANA_BOMB))
 		luk -= 75;
-	if(sc->data[SC_GOLDENMACECLAN])
+	if(sc->getSCE(SC_GOLDENMACECLAN))
 		luk += 1;
-	if(sc->data[SC_JUMPINGCLAN])
+	if(sc->getSCE(SC_JUMPINGCLAN))
 		luk += 1;
-	if(sc->data[SC_FULL_THROTTLE])
-		luk += luk * sc->data[SC_FULL_THROTTLE]->val3 / 100;
-	if(sc->data[SC_CHEERUP])
+	if(sc->getSCE(SC_FULL_THROTTLE))
+		luk += luk * sc->getSCE(SC_FULL_THROTTLE)->val3 / 100;
+	if(sc->getSCE(SC_CHEERUP))
 		luk += 3;
-	if(sc->data[SC_GLASTHEIM_STATE])
-		luk += sc->data[SC_GLASTHEIM_STATE]->val1;
+	if(sc->getSCE(SC_GLASTHEIM_STATE))
+		luk += sc->getSCE(SC_GLASTHEIM_STATE)->val1;
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_ALLSTAT)
+	if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_ALLSTAT)
 		luk += 15;
 #endif
-	if (sc->data[SC_UNIVERSESTANCE])
-		luk += sc->data[SC_UNIVERSESTANCE]->val2;
+	if (sc->getSCE(SC_UNIVERSESTANCE))
+		luk += sc->getSCE(SC_UNIVERSESTANCE)->val2;
 
 	return (unsigned short)cap_value(luk,0,USHRT_MAX);
 }
@@ -6839,67 +6839,67 @@ static unsigned short status_calc_batk(struct block_list *bl, struct status_chan
 	if(!sc || !sc->count)
 		return cap_value(batk,0,USHRT_MAX);
 
-	if(sc->data[SC_ATKPOTION])
-		batk += sc->data[SC_ATKPOTION]->val1;
-	if(sc->data[SC_BATKFOOD])
-		batk += sc->data[SC_BATKFOOD]->val1;
+	if(sc->getSCE(SC_ATKPOTION))
+		batk += sc->getSCE(SC_ATKPOTION)->val1;
+	if(sc->getSCE(SC_BATKFOOD))
+		batk += sc->getSCE(SC_BATKFOOD)->val1;
 #ifndef RENEWAL
-	if(sc->data[SC_GATLINGFEVER])
-		batk += sc->data[SC_GATLINGFEVER]->val3;
-	if(sc->data[SC_MADNESSCANCEL])
+	if(sc->getSCE(SC_GATLINGFEVER))
+		batk += sc->getSCE(SC_GATLINGFEVER)->val3;
+	if(sc->getSCE(SC_MADNESSCANCEL))
 		batk += 100;
 #endif
-	if(sc->data[SC_FULL_SWING_K])
-		batk += sc->data[SC_FULL_SWING_K]->val1;
-	if(sc->data[SC_ASH])
-		batk -= batk * sc->data[SC_ASH]->val4 / 100;
-	if(bl->type == BL_HOM && sc->data[SC_PYROCLASTIC])
-		batk += sc->data[SC_PYROCLASTIC]->val2;
-	if (sc->data[SC_ANGRIFFS_MODUS])
-		batk += sc->data[SC_ANGRIFFS_MODUS]->val2;
-	if(sc->data[SC_2011RWC_SCROLL])
+	if(sc->getSCE(SC_FULL_SWING_K))
+		batk += sc->getSCE(SC_FULL_SWING_K)->val1;
+	if(sc->getSCE(SC_ASH))
+		batk -= batk * sc->getSCE(SC_ASH)->val4 / 100;
+	if(bl->type == BL_HOM && sc->getSCE(SC_PYROCLASTIC))
+		batk += sc->getSCE(SC_PYROCLASTIC)->val2;
+	if (sc->getSCE(SC_ANGRIFFS_MODUS))
+		batk += sc->getSCE(SC_ANGRIFFS_MODUS)->val2;
+	if(sc->getSCE(SC_2011RWC_SCROLL))
 		batk += 30;
-	if(sc->data[SC_INCATKRATE])
-		batk += batk * sc->data[SC_INCATKRATE]->val1/100;
-	if(sc->data[SC_PROVOKE])
-		batk += batk * sc->data[SC_PROVOKE]->val3/100;
+	if(sc->getSCE(SC_INCATKRATE))
+		batk += batk * sc->getSCE(SC_INCATKRATE)->val1/100;
+	if(sc->getSCE(SC_PROVOKE))
+		batk += batk * sc->getSCE(SC_PROVOKE)->val3/100;
 #ifndef RENEWAL
-	if(sc->data[SC_CONCENTRATION])
-		batk += batk * sc->data[SC_CONCENTRATION]->val2/100;
+	if(sc->getSCE(SC_CONCENTRATION))
+		batk += batk * sc->getSCE(SC_CONCENTRATION)->val2/100;
 #endif
-	if(sc->data[SC_SKE])
+	if(sc->getSCE(SC_SKE))
 		batk += batk * 3;
-	if(sc->data[SC_BLOODLUST])
-		batk += batk * sc->data[SC_BLOODLUST]->val2/100;
-	if(sc->data[SC_JOINTBEAT] && sc->data[SC_JOINTBEAT]->val2&BREAK_WAIST)
+	if(sc->getSCE(SC_BLOODLUST))
+		batk += batk * sc->getSCE(SC_BLOODLUST)->val2/100;
+	if(sc->getSCE(SC_JOINTBEAT) && sc->getSCE(SC_JOINTBEAT)->val2&BREAK_WAIST)
 		batk -= batk * 25/100;
-	if(sc->data[SC_CURSE])
+	if(sc->getSCE(SC_CURSE))
 		batk -= batk * 25/100;
 	/* Curse shouldn't effect on this? <- Curse OR Bleeding??
-	if(sc->data[SC_BLEEDING])
+	if(sc->getSCE(SC_BLEEDING))
 		batk -= batk * 25 / 100; */
-	if(sc->data[SC_FLEET])
-		batk += batk * sc->data[SC_FLEET]->val3/100;
-	if(sc->data[SC__ENERVATION])
-		batk -= batk * sc->data[SC__ENERVATION]->val2 / 100;
-	if( sc->data[SC_ZANGETSU] )
-		batk += sc->data[SC_ZANGETSU]->val2;
-	if(sc->data[SC_QUEST_BUFF1])
-		batk += sc->data[SC_QUEST_BUFF1]->val1;
-	if(sc->data[SC_QUEST_BUFF2])
-		batk += sc->data[SC_QUEST_BUFF2]->val1;
-	if(sc->data[SC_QUEST_BUFF3])
-		batk += sc->data[SC_QUEST_BUFF3]->val1;
-	if (sc->data[SC_SHRIMP])
-		batk += batk * sc->data[SC_SHRIMP]->val2 / 100;
+	if(sc->getSCE(SC_FLEET))
+		batk += batk * sc->getSCE(SC_FLEET)->val3/100;
+	if(sc->getSCE(SC__ENERVATION))
+		batk -= batk * sc->getSCE(SC__ENERVATION)->val2 / 100;
+	if( sc->getSCE(SC_ZANGETSU) )
+		batk += sc->getSCE(SC_ZANGETSU)->val2;
+	if(sc->getSCE(SC_QUEST_BUFF1))
+		batk += sc->getSCE(SC_QUEST_BUFF1)->val1;
+	if(sc->getSCE(SC_QUEST_BUFF2))
+		batk += sc->getSCE(SC_QUEST_BUFF2)->val1;
+	if(sc->getSCE(SC_QUEST_BUFF3))
+		batk += sc->getSCE(SC_QUEST_BUFF3)->val1;
+	if (sc->getSCE(SC_SHRIMP))
+		batk += batk * sc->getSCE(SC_SHRIMP)->val2 / 100;
 #ifdef RENEWAL
-	if (sc->data[SC_LOUD])
+	if (sc->getSCE(SC_LOUD))
 		batk += 30;
-	if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_ATKRATE)
+	if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_ATKRATE)
 		batk += batk * 20 / 100;
 #endif
-	if (sc->data[SC_SUNSTANCE])
-		batk += batk * sc->data[SC_SUNSTANCE]->val2 / 100;
+	if (sc->getSCE(SC_SUNSTANCE))
+		batk += batk * sc->getSCE(SC_SUNSTANCE)->val2 / 100;
 
 	return (unsigned short)cap_value(batk,0,USHRT_MAX);
 }
@@ -6917,93 +6917,93 @@ static unsigned short status_calc_watk(struct block_list *bl, struct status_chan
 		return cap_value(watk,0,USHRT_MAX);
 
 #ifndef RENEWAL
-	if(sc->data[SC_DRUMBATTLE])
-		watk += sc->data[SC_DRUMBATTLE]->val2;
-#endif
-	if (sc->data[SC_IMPOSITIO])
-		watk += sc->data[SC_IMPOSITIO]->val2;
-	if(sc->data[SC_WATKFOOD])
-		watk += sc->data[SC_WATKFOOD]->val1;
-	if(sc->data[SC_VOLCANO])
-		watk += sc->data[SC_VOLCANO]->val2;
-	if(sc->data[SC_MERC_ATKUP])
-		watk += sc->data[SC_MERC_ATKUP]->val2;
-	if(sc->data[SC_WATER_BARRIER])
-		watk -= sc->data[SC_WATER_BARRIER]->val2;
+	if(sc->getSCE(SC_DRUMBATTLE))
+		watk += sc->getSCE(SC_DRUMBATTLE)->val2;
+#endif
+	if (sc->getSCE(SC_IMPOSITIO))
+		watk += sc->getSCE(SC_IMPOSITIO)->val2;
+	if(sc->getSCE(SC_WATKFOOD))
+		watk += sc->getSCE(SC_WATKFOOD)->val1;
+	if(sc->getSCE(SC_VOLCANO))
+		watk += sc->getSCE(SC_VOLCANO)->val2;
+	if(sc->getSCE(SC_MERC_ATKUP))
+		watk += sc->getSCE(SC_MERC_ATKUP)->val2;
+	if(sc->getSCE(SC_WATER_BARRIER))
+		watk -= sc->getSCE(SC_WATER_BARRIER)->val2;
 #ifndef RENEWAL
-	if(sc->data[SC_NIBELUNGEN]) {
+	if(sc->getSCE(SC_NIBELUNGEN)) {
 		if (bl->type != BL_PC)
-			watk += sc->data[SC_NIBELUNGEN]->val2;
+			watk += sc->getSCE(SC_NIBELUNGEN)->val2;
 		else {
 			TBL_PC *sd = (TBL_PC*)bl;
 			short index = sd->equip_index[sd->state.lr_flag?EQI_HAND_L:EQI_HAND_R];
 
 			if(index >= 0 && sd->inventory_data[index] && sd->inventory_data[index]->type == IT_WEAPON && sd->inventory_data[index]->weapon_level == 4)
-				watk += sc->data[SC_NIBELUNGEN]->val2;
+				watk += sc->getSCE(SC_NIBELUNGEN)->val2;
 		}
 	}
-	if(sc->data[SC_CONCENTRATION])
-		watk += watk * sc->data[SC_CONCENTRATION]->val2 / 100;
+	if(sc->getSCE(SC_CONCENTRATION))
+		watk += watk * sc->getSCE(SC_CONCENTRATION)->val2 / 100;
 #endif
-	if(sc->data[SC_INCATKRATE])
-		watk += watk * sc->data[SC_INCATKRATE]->val1/100;
-	if(sc->data[SC_PROVOKE])
-		watk += watk * sc->data[SC_PROVOKE]->val3/100;
-	if(sc->data[SC_SKE])
+	if(sc->getSCE(SC_INCATKRATE))
+		watk += watk * sc->getSCE(SC_INCATKRATE)->val1/100;
+	if(sc->getSCE(SC_PROVOKE))
+		watk += watk * sc->getSCE(SC_PROVOKE)->val3/100;
+	if(sc->getSCE(SC_SKE))
 		watk += watk * 3;
-	if(sc->data[SC_FLEET])
-		watk += watk * sc->data[SC_FLEET]->val3/100;
-	if(sc->data[SC_CURSE])
+	if(sc->getSCE(SC_FLEET))
+		watk += watk * sc->getSCE(SC_FLEET)->val3/100;
+	if(sc->getSCE(SC_CURSE))
 		watk -= watk * 25/100;
-	if(sc->data[SC_STRIPWEAPON] && bl->type != BL_PC)
-		watk -= watk * sc->data[SC_STRIPWEAPON]->val2/100;
-	if(sc->data[SC_FIGHTINGSPIRIT])
-		watk += sc->data[SC_FIGHTINGSPIRIT]->val1;
-	if (sc->data[SC_SHIELDSPELL_ATK])
-		watk += sc->data[SC_SHIELDSPELL_ATK]->val2;
-	if(sc->data[SC_INSPIRATION])
-		watk += sc->data[SC_INSPIRATION]->val2;
-	if(sc->data[SC_GT_CHANGE])
-		watk += sc->data[SC_GT_CHANGE]->val2;
-	if(sc->data[SC__ENERVATION])
-		watk -= watk * sc->data[SC__ENERVATION]->val2 / 100;
-	if(sc->data[SC_STRIKING])
-		watk += sc->data[SC_STRIKING]->val2;
-	if(sc->data[SC_RUSHWINDMILL])
-		watk += sc->data[SC_RUSHWINDMILL]->val3;
-	if(sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 2)
+	if(sc->getSCE(SC_STRIPWEAPON) && bl->type != BL_PC)
+		watk -= watk * sc->getSCE(SC_STRIPWEAPON)->val2/100;
+	if(sc->getSCE(SC_FIGHTINGSPIRIT))
+		watk += sc->getSCE(SC_FIGHTINGSPIRIT)->val1;
+	if (sc->getSCE(SC_SHIELDSPELL_ATK))
+		watk += sc->getSCE(SC_SHIELDSPELL_ATK)->val2;
+	if(sc->getSCE(SC_INSPIRATION))
+		watk += sc->getSCE(SC_INSPIRATION)->val2;
+	if(sc->getSCE(SC_GT_CHANGE))
+		watk += sc->getSCE(SC_GT_CHANGE)->val2;
+	if(sc->getSCE(SC__ENERVATION))
+		watk -= watk * sc->getSCE(SC__ENERVATION)->val2 / 100;
+	if(sc->getSCE(SC_STRIKING))
+		watk += sc->getSCE(SC_STRIKING)->val2;
+	if(sc->getSCE(SC_RUSHWINDMILL))
+		watk += sc->getSCE(SC_RUSHWINDMILL)->val3;
+	if(sc->getSCE(SC_FIRE_INSIGNIA) && sc->getSCE(SC_FIRE_INSIGNIA)->val1 == 2)
 		watk += 50;
-	if((sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 2)
-	   || (sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 2)
-	   || (sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 2)
-	   || (sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 2))
+	if((sc->getSCE(SC_FIRE_INSIGNIA) && sc->getSCE(SC_FIRE_INSIGNIA)->val1 == 2)
+	   || (sc->getSCE(SC_WATER_INSIGNIA) && sc->getSCE(SC_WATER_INSIGNIA)->val1 == 2)
+	   || (sc->getSCE(SC_WIND_INSIGNIA) && sc->getSCE(SC_WIND_INSIGNIA)->val1 == 2)
+	   || (sc->getSCE(SC_EARTH_INSIGNIA) && sc->getSCE(SC_EARTH_INSIGNIA)->val1 == 2))
 		watk += watk * 10 / 100;
-	if(sc->data[SC_PYROTECHNIC_OPTION])
-		watk += sc->data[SC_PYROTECHNIC_OPTION]->val2;
-	if(sc->data[SC_HEATER_OPTION])
-		watk += sc->data[SC_HEATER_OPTION]->val2;
-	if(sc->data[SC_TROPIC_OPTION])
-		watk += sc->data[SC_TROPIC_OPTION]->val2;
-	if( sc && sc->data[SC_TIDAL_WEAPON] )
-		watk += watk * sc->data[SC_TIDAL_WEAPON]->val2 / 100;
-	if(bl->type == BL_PC && sc->data[SC_PYROCLASTIC])
-		watk += sc->data[SC_PYROCLASTIC]->val2;
-	if(sc->data[SC_ANGRIFFS_MODUS])
-		watk += watk * sc->data[SC_ANGRIFFS_MODUS]->val2/100;
-	if(sc->data[SC_ODINS_POWER])
-		watk += 40 + 30 * sc->data[SC_ODINS_POWER]->val1;
-	if (sc->data[SC_FLASHCOMBO])
-		watk += sc->data[SC_FLASHCOMBO]->val2;
-	if (sc->data[SC_CATNIPPOWDER])
-		watk -= watk * sc->data[SC_CATNIPPOWDER]->val2 / 100;
-	if (sc->data[SC_CHATTERING])
-		watk += sc->data[SC_CHATTERING]->val2;
-	if (sc->data[SC_SUNSTANCE])
-		watk += watk * sc->data[SC_SUNSTANCE]->val2 / 100;
-	if (sc->data[SC_SOULFALCON])
-		watk += sc->data[SC_SOULFALCON]->val2;
-	if (sc->data[SC_PACKING_ENVELOPE1])
-		watk += sc->data[SC_PACKING_ENVELOPE1]->val1;
+	if(sc->getSCE(SC_PYROTECHNIC_OPTION))
+		watk += sc->getSCE(SC_PYROTECHNIC_OPTION)->val2;
+	if(sc->getSCE(SC_HEATER_OPTION))
+		watk += sc->getSCE(SC_HEATER_OPTION)->val2;
+	if(sc->getSCE(SC_TROPIC_OPTION))
+		watk += sc->getSCE(SC_TROPIC_OPTION)->val2;
+	if( sc && sc->getSCE(SC_TIDAL_WEAPON) )
+		watk += watk * sc->getSCE(SC_TIDAL_WEAPON)->val2 / 100;
+	if(bl->type == BL_PC && sc->getSCE(SC_PYROCLASTIC))
+		watk += sc->getSCE(SC_PYROCLASTIC)->val2;
+	if(sc->getSCE(SC_ANGRIFFS_MODUS))
+		watk += watk * sc->getSCE(SC_ANGRIFFS_MODUS)->val2/100;
+	if(sc->getSCE(SC_ODINS_POWER))
+		watk += 40 + 30 * sc->getSCE(SC_ODINS_POWER)->val1;
+	if (sc->getSCE(SC_FLASHCOMBO))
+		watk += sc->getSCE(SC_FLASHCOMBO)->val2;
+	if (sc->getSCE(SC_CATNIPPOWDER))
+		watk -= watk * sc->getSCE(SC_CATNIPPOWDER)->val2 / 100;
+	if (sc->getSCE(SC_CHATTERING))
+		watk += sc->getSCE(SC_CHATTERING)->val2;
+	if (sc->getSCE(SC_SUNSTANCE))
+		watk += watk * sc->getSCE(SC_SUNSTANCE)->val2 / 100;
+	if (sc->getSCE(SC_SOULFALCON))
+		watk += sc->getSCE(SC_SOULFALCON)->val2;
+	if (sc->getSCE(SC_PACKING_ENVELOPE1))
+		watk += sc->getSCE(SC_PACKING_ENVELOPE1)->val1;
 
 	return (unsigned short)cap_value(watk,0,USHRT_MAX);
 }
@@ -7021,54 +7021,54 @@ static unsigned short status_calc_ematk(struct block_list *bl, struct status_cha
 	if (!sc || !sc->count)
 		return cap_value(matk,0,USHRT_MAX);
 
-	if (sc->data[SC_IMPOSITIO])
-		matk += sc->data[SC_IMPOSITIO]->val2;
-	if (sc->data[SC_MATKPOTION])
-		matk += sc->data[SC_MATKPOTION]->val1;
-	if (sc->data[SC_MATKFOOD])
-		matk += sc->data[SC_MATKFOOD]->val1;
-	if(sc->data[SC_MANA_PLUS])
-		matk += sc->data[SC_MANA_PLUS]->val1;
-	if(sc->data[SC_COOLER_OPTION])
-		matk += sc->data[SC_COOLER_OPTION]->val2;
-	if(sc->data[SC_AQUAPLAY_OPTION])
-		matk += sc->data[SC_AQUAPLAY_OPTION]->val2;
-	if(sc->data[SC_CHILLY_AIR_OPTION])
-		matk += sc->data[SC_CHILLY_AIR_OPTION]->val2;
-	if(sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 3)
+	if (sc->getSCE(SC_IMPOSITIO))
+		matk += sc->getSCE(SC_IMPOSITIO)->val2;
+	if (sc->getSCE(SC_MATKPOTION))
+		matk += sc->getSCE(SC_MATKPOTION)->val1;
+	if (sc->getSCE(SC_MATKFOOD))
+		matk += sc->getSCE(SC_MATKFOOD)->val1;
+	if(sc->getSCE(SC_MANA_PLUS))
+		matk += sc->getSCE(SC_MANA_PLUS)->val1;
+	if(sc->getSCE(SC_COOLER_OPTION))
+		matk += sc->getSCE(SC_COOLER_OPTION)->val2;
+	if(sc->getSCE(SC_AQUAPLAY_OPTION))
+		matk += sc->getSCE(SC_AQUAPLAY_OPTION)->val2;
+	if(sc->getSCE(SC_CHILLY_AIR_OPTION))
+		matk += sc->getSCE(SC_CHILLY_AIR_OPTION)->val2;
+	if(sc->getSCE(SC_FIRE_INSIGNIA) && sc->getSCE(SC_FIRE_INSIGNIA)->val1 == 3)
 		matk += 50;
-	if(sc->data[SC_ODINS_POWER])
-		matk += 40 + 30 * sc->data[SC_ODINS_POWER]->val1; // 70 lvl1, 100lvl2
-	if(sc->data[SC_MOONLITSERENADE])
-		matk += sc->data[SC_MOONLITSERENADE]->val3;
-	if(sc->data[SC_IZAYOI])
-		matk += 25 * sc->data[SC_IZAYOI]->val1;
-	if(sc->data[SC_ZANGETSU])
-		matk += sc->data[SC_ZANGETSU]->val3;
-	if(sc->data[SC_QUEST_BUFF1])
-		matk += sc->data[SC_QUEST_BUFF1]->val1;
-	if(sc->data[SC_QUEST_BUFF2])
-		matk += sc->data[SC_QUEST_BUFF2]->val1;
-	if(sc->data[SC_QUEST_BUFF3])
-		matk += sc->data[SC_QUEST_BUFF3]->val1;
-	if(sc->data[SC_MTF_MATK2])
-		matk += sc->data[SC_MTF_MATK2]->val1;
-	if(sc->data[SC_2011RWC_SCROLL])
+	if(sc->getSCE(SC_ODINS_POWER))
+		matk += 40 + 30 * sc->getSCE(SC_ODINS_POWER)->val1; // 70 lvl1, 100lvl2
+	if(sc->getSCE(SC_MOONLITSERENADE))
+		matk += sc->getSCE(SC_MOONLITSERENADE)->val3;
+	if(sc->getSCE(SC_IZAYOI))
+		matk += 25 * sc->getSCE(SC_IZAYOI)->val1;
+	if(sc->getSCE(SC_ZANGETSU))
+		matk += sc->getSCE(SC_ZANGETSU)->val3;
+	if(sc->getSCE(SC_QUEST_BUFF1))
+		matk += sc->getSCE(SC_QUEST_BUFF1)->val1;
+	if(sc->getSCE(SC_QUEST_BUFF2))
+		matk += sc->getSCE(SC_QUEST_BUFF2)->val1;
+	if(sc->getSCE(SC_QUEST_BUFF3))
+		matk += sc->getSCE(SC_QUEST_BUFF3)->val1;
+	if(sc->getSCE(SC_MTF_MATK2))
+		matk += sc->getSCE(SC_MTF_MATK2)->val1;
+	if(sc->getSCE(SC_2011RWC_SCROLL))
 		matk += 30;
-	if (sc->data[SC_CATNIPPOWDER])
-		matk -= matk * sc->data[SC_CATNIPPOWDER]->val2 / 100;
-	if (sc->data[SC_CHATTERING])
-		matk += sc->data[SC_CHATTERING]->val2;
-	if (sc->data[SC_DORAM_MATK])
-		matk += sc->data[SC_DORAM_MATK]->val1;
-	if (sc->data[SC_SOULFAIRY])
-		matk += sc->data[SC_SOULFAIRY]->val2;
-	if (sc->data[SC__AUTOSHADOWSPELL])
-		matk += sc->data[SC__AUTOSHADOWSPELL]->val4 * 5;
-	if (sc->data[SC_INSPIRATION])
-		matk += sc->data[SC_INSPIRATION]->val2;
-	if (sc->data[SC_PACKING_ENVELOPE2])
-		matk += sc->data[SC_PACKING_ENVELOPE2]->val1;
+	if (sc->getSCE(SC_CATNIPPOWDER))
+		matk -= matk * sc->getSCE(SC_CATNIPPOWDER)->val2 / 100;
+	if (sc->getSCE(SC_CHATTERING))
+		matk += sc->getSCE(SC_CHATTERING)->val2;
+	if (sc->getSCE(SC_DORAM_MATK))
+		matk += sc->getSCE(SC_DORAM_MATK)->val1;
+	if (sc->getSCE(SC_SOULFAIRY))
+		matk += sc->getSCE(SC_SOULFAIRY)->val2;
+	if (sc->getSCE(SC__AUTOSHADOWSPELL))
+		matk += sc->getSCE(SC__AUTOSHADOWSPELL)->val4 * 5;
+	if (sc->getSCE(SC_INSPIRATION))
+		matk += sc->getSCE(SC_INSPIRATION)->val2;
+	if (sc->getSCE(SC_PACKING_ENVELOPE2))
+		matk += sc->getSCE(SC_PACKING_ENVELOPE2)->val1;
 
 	return (unsigned short)cap_value(matk,0,USHRT_MAX);
 }
@@ -7087,63 +7087,63 @@ static unsigned short status_calc_matk(struct block_list *bl, struct status_chan
 		return cap_value(matk,0,USHRT_MAX);
 #ifndef RENEWAL
 	/// Take note fixed value first before % modifiers [PRE-RENEWAL]
-	if (sc->data[SC_MATKPOTION])
-		matk += sc->data[SC_MATKPOTION]->val1;
-	if (sc->data[SC_MATKFOOD])
-		matk += sc->data[SC_MATKFOOD]->val1;
-	if (sc->data[SC_MANA_PLUS])
-		matk += sc->data[SC_MANA_PLUS]->val1;
-	if (sc->data[SC_AQUAPLAY_OPTION])
-		matk += sc->data[SC_AQUAPLAY_OPTION]->val2;
-	if (sc->data[SC_CHILLY_AIR_OPTION])
-		matk += sc->data[SC_CHILLY_AIR_OPTION]->val2;
-	if (sc->data[SC_COOLER_OPTION])
-		matk += sc->data[SC_COOLER_OPTION]->val2;
-	if (sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 3)
+	if (sc->getSCE(SC_MATKPOTION))
+		matk += sc->getSCE(SC_MATKPOTION)->val1;
+	if (sc->getSCE(SC_MATKFOOD))
+		matk += sc->getSCE(SC_MATKFOOD)->val1;
+	if (sc->getSCE(SC_MANA_PLUS))
+		matk += sc->getSCE(SC_MANA_PLUS)->val1;
+	if (sc->getSCE(SC_AQUAPLAY_OPTION))
+		matk += sc->getSCE(SC_AQUAPLAY_OPTION)->val2;
+	if (sc->getSCE(SC_CHILLY_AIR_OPTION))
+		matk += sc->getSCE(SC_CHILLY_AIR_OPTION)->val2;
+	if (sc->getSCE(SC_COOLER_OPTION))
+		matk += sc->getSCE(SC_COOLER_OPTION)->val2;
+	if (sc->getSCE(SC_FIRE_INSIGNIA) && sc->getSCE(SC_FIRE_INSIGNIA)->val1 == 3)
 		matk += 50;
-	if (sc->data[SC_ODINS_POWER])
-		matk += 40 + 30 * sc->data[SC_ODINS_POWER]->val1; // 70 lvl1, 100lvl2
-	if (sc->data[SC_IZAYOI])
-		matk += 25 * sc->data[SC_IZAYOI]->val1;
-	if (sc->data[SC_MTF_MATK2])
-		matk += sc->data[SC_MTF_MATK2]->val1;
-	if (sc->data[SC_2011RWC_SCROLL])
+	if (sc->getSCE(SC_ODINS_POWER))
+		matk += 40 + 30 * sc->getSCE(SC_ODINS_POWER)->val1; // 70 lvl1, 100lvl2
+	if (sc->getSCE(SC_IZAYOI))
+		matk += 25 * sc->getSCE(SC_IZAYOI)->val1;
+	if (sc->getSCE(SC_MTF_MATK2))
+		matk += sc->getSCE(SC_MTF_MATK2)->val1;
+	if (sc->getSCE(SC_2011RWC_SCROLL))
 		matk += 30;
 #endif
-	if (sc->data[SC_ZANGETSU])
-		matk += sc->data[SC_ZANGETSU]->val3;
-	if (sc->data[SC_QUEST_BUFF1])
-		matk += sc->data[SC_QUEST_BUFF1]->val1;
-	if (sc->data[SC_QUEST_BUFF2])
-		matk += sc->data[SC_QUEST_BUFF2]->val1;
-	if (sc->data[SC_QUEST_BUFF3])
-		matk += sc->data[SC_QUEST_BUFF3]->val1;
-	if (sc->data[SC_MAGICPOWER]
+	if (sc->getSCE(SC_ZANGETSU))
+		matk += sc->getSCE(SC_ZANGETSU)->val3;
+	if (sc->getSCE(SC_QUEST_BUFF1))
+		matk += sc->getSCE(SC_QUEST_BUFF1)->val1;
+	if (sc->getSCE(SC_QUEST_BUFF2))
+		matk += sc->getSCE(SC_QUEST_BUFF2)->val1;
+	if (sc->getSCE(SC_QUEST_BUFF3))
+		matk += sc->getSCE(SC_QUEST_BUFF3)->val1;
+	if (sc->getSCE(SC_MAGICPOWER)
 #ifndef RENEWAL
-		&& sc->data[SC_MAGICPOWER]->val4
+		&& sc->getSCE(SC_MAGICPOWER)->val4
 #endif
 		)
-		matk += matk * sc->data[SC_MAGICPOWER]->val3/100;
-	if (sc->data[SC_MINDBREAKER])
-		matk += matk * sc->data[SC_MINDBREAKER]->val2/100;
-	if (sc->data[SC_INCMATKRATE])
-		matk += matk * sc->data[SC_INCMATKRATE]->val1/100;
-	if (sc->data[SC_MOONLITSERENADE])
-		matk += sc->data[SC_MOONLITSERENADE]->val3/100;
-	if (sc->data[SC_MTF_MATK])
-		matk += matk * sc->data[SC_MTF_MATK]->val1 / 100;
-	if(sc->data[SC_2011RWC_SCROLL])
+		matk += matk * sc->getSCE(SC_MAGICPOWER)->val3/100;
+	if (sc->getSCE(SC_MINDBREAKER))
+		matk += matk * sc->getSCE(SC_MINDBREAKER)->val2/100;
+	if (sc->getSCE(SC_INCMATKRATE))
+		matk += matk * sc->getSCE(SC_INCMATKRATE)->val1/100;
+	if (sc->getSCE(SC_MOONLITSERENADE))
+		matk += sc->getSCE(SC_MOONLITSERENADE)->val3/100;
+	if (sc->getSCE(SC_MTF_MATK))
+		matk += matk * sc->getSCE(SC_MTF_MATK)->val1 / 100;
+	if(sc->getSCE(SC_2011RWC_SCROLL))
 		matk += 30;
-	if (sc->data[SC_SHRIMP])
-		matk += matk * sc->data[SC_SHRIMP]->val2 / 100;
-	if (sc->data[SC_VOLCANO])
-		matk += sc->data[SC_VOLCANO]->val2;
+	if (sc->getSCE(SC_SHRIMP))
+		matk += matk * sc->getSCE(SC_SHRIMP)->val2 / 100;
+	if (sc->getSCE(SC_VOLCANO))
+		matk += sc->getSCE(SC_VOLCANO)->val2;
 #ifdef RENEWAL
-	if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_MATKRATE)
+	if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_MATKRATE)
 		matk += matk * 20 / 100;
 #endif
-	if (sc->data[SC_SHIELDSPELL_ATK])
-		matk += sc->data[SC_SHIELDSPELL_ATK]->val2;
+	if (sc->getSCE(SC_SHIELDSPELL_ATK))
+		matk += sc->getSCE(SC_SHIELDSPELL_ATK)->val2;
 
 	return (unsigned short)cap_value(matk,0,USHRT_MAX);
 }
@@ -7160,38 +7160,38 @@ static signed short status_calc_critical(struct block_list *bl, struct status_ch
 	if(!sc || !sc->count)
 		return cap_value(critical,10,SHRT_MAX);
 
-	if (sc->data[SC_INCCRI])
-		critical += sc->data[SC_INCCRI]->val2;
-	if (sc->data[SC_EP16_2_BUFF_SC])
+	if (sc->getSCE(SC_INCCRI))
+		critical += sc->getSCE(SC_INCCRI)->val2;
+	if (sc->getSCE(SC_EP16_2_BUFF_SC))
 		critical += 300;// crit +30
-	if (sc->data[SC_CRIFOOD])
-		critical += sc->data[SC_CRIFOOD]->val1;
-	if (sc->data[SC_EXPLOSIONSPIRITS])
-		critical += sc->data[SC_EXPLOSIONSPIRITS]->val2;
-	if (sc->data[SC_FORTUNE])
-		critical += sc->data[SC_FORTUNE]->val2;
-	if (sc->data[SC_TRUESIGHT])
-		critical += sc->data[SC_TRUESIGHT]->val2;
-	if (sc->data[SC_CLOAKING])
+	if (sc->getSCE(SC_CRIFOOD))
+		critical += sc->getSCE(SC_CRIFOOD)->val1;
+	if (sc->getSCE(SC_EXPLOSIONSPIRITS))
+		critical += sc->getSCE(SC_EXPLOSIONSPIRITS)->val2;
+	if (sc->getSCE(SC_FORTUNE))
+		critical += sc->getSCE(SC_FORTUNE)->val2;
+	if (sc->getSCE(SC_TRUESIGHT))
+		critical += sc->getSCE(SC_TRUESIGHT)->val2;
+	if (sc->getSCE(SC_CLOAKING))
 		critical += critical;
 #ifdef RENEWAL
-	if (sc->data[SC_SPEARQUICKEN])
-		critical += 3*sc->data[SC_SPEARQUICKEN]->val1*10;
-	if (sc->data[SC_TWOHANDQUICKEN])
-		critical += (2 + sc->data[SC_TWOHANDQUICKEN]->val1) * 10;
-#endif
-	if (sc->data[SC__INVISIBILITY])
-		critical += sc->data[SC__INVISIBILITY]->val3 * 10;
-	if (sc->data[SC__UNLUCKY])
-		critical -= sc->data[SC__UNLUCKY]->val2;
-	if (sc->data[SC_SOULSHADOW])
-		critical += 10 * sc->data[SC_SOULSHADOW]->val3;
-	if(sc->data[SC_BEYONDOFWARCRY])
-		critical += sc->data[SC_BEYONDOFWARCRY]->val3;
-	if (sc->data[SC_MTF_HITFLEE])
-		critical += sc->data[SC_MTF_HITFLEE]->val1;
-	if (sc->data[SC_PACKING_ENVELOPE9])
-		critical += sc->data[SC_PACKING_ENVELOPE9]->val1 * 10;
+	if (sc->getSCE(SC_SPEARQUICKEN))
+		critical += 3*sc->getSCE(SC_SPEARQUICKEN)->val1*10;
+	if (sc->getSCE(SC_TWOHANDQUICKEN))
+		critical += (2 + sc->getSCE(SC_TWOHANDQUICKEN)->val1) * 10;
+#endif
+	if (sc->getSCE(SC__INVISIBILITY))
+		critical += sc->getSCE(SC__INVISIBILITY)->val3 * 10;
+	if (sc->getSCE(SC__UNLUCKY))
+		critical -= sc->getSCE(SC__UNLUCKY)->val2;
+	if (sc->getSCE(SC_SOULSHADOW))
+		critical += 10 * sc->getSCE(SC_SOULSHADOW)->val3;
+	if(sc->getSCE(SC_BEYONDOFWARCRY))
+		critical += sc->getSCE(SC_BEYONDOFWARCRY)->val3;
+	if (sc->getSCE(SC_MTF_HITFLEE))
+		critical += sc->getSCE(SC_MTF_HITFLEE)->val1;
+	if (sc->getSCE(SC_PACKING_ENVELOPE9))
+		critical += sc->getSCE(SC_PACKING_ENVELOPE9)->val1 * 10;
 
 	return (short)cap_value(critical,10,SHRT_MAX);
 }
@@ -7208,60 +7208,60 @@ static signed short status_calc_hit(struct block_list *bl, struct status_change
 	if(!sc || !sc->count)
 		return cap_value(hit,1,SHRT_MAX);
 
-	if(sc->data[SC_INCHIT])
-		hit += sc->data[SC_INCHIT]->val1;
-	if(sc->data[SC_HITFOOD])
-		hit += sc->data[SC_HITFOOD]->val1;
-	if(sc->data[SC_TRUESIGHT])
-		hit += sc->data[SC_TRUESIGHT]->val3;
-	if(sc->data[SC_HUMMING])
-		hit += sc->data[SC_HUMMING]->val2;
-	if(sc->data[SC_CONCENTRATION])
-		hit += sc->data[SC_CONCENTRATION]->val3;
-	if(sc->data[SC_INSPIRATION])
-		hit += 12 * sc->data[SC_INSPIRATION]->val1;
-	if(sc->data[SC_ADJUSTMENT])
+	if(sc->getSCE(SC_INCHIT))
+		hit += sc->getSCE(SC_INCHIT)->val1;
+	if(sc->getSCE(SC_HITFOOD))
+		hit += sc->getSCE(SC_HITFOOD)->val1;
+	if(sc->getSCE(SC_TRUESIGHT))
+		hit += sc->getSCE(SC_TRUESIGHT)->val3;
+	if(sc->getSCE(SC_HUMMING))
+		hit += sc->getSCE(SC_HUMMING)->val2;
+	if(sc->getSCE(SC_CONCENTRATION))
+		hit += sc->getSCE(SC_CONCENTRATION)->val3;
+	if(sc->getSCE(SC_INSPIRATION))
+		hit += 12 * sc->getSCE(SC_INSPIRATION)->val1;
+	if(sc->getSCE(SC_ADJUSTMENT))
 		hit -= 30;
-	if(sc->data[SC_INCREASING])
+	if(sc->getSCE(SC_INCREASING))
 		hit += 20; // RockmanEXE; changed based on updated [Reddozen]
-	if(sc->data[SC_MERC_HITUP])
-		hit += sc->data[SC_MERC_HITUP]->val2;
-	if(sc->data[SC_MTF_HITFLEE])
-		hit += sc->data[SC_MTF_HITFLEE]->val1;
-	if(sc->data[SC_INCHITRATE])
-		hit += hit * sc->data[SC_INCHITRATE]->val1/100;
-	if(sc->data[SC_BLIND])
+	if(sc->getSCE(SC_MERC_HITUP))
+		hit += sc->getSCE(SC_MERC_HITUP)->val2;
+	if(sc->getSCE(SC_MTF_HITFLEE))
+		hit += sc->getSCE(SC_MTF_HITFLEE)->val1;
+	if(sc->getSCE(SC_INCHITRATE))
+		hit += hit * sc->getSCE(SC_INCHITRATE)->val1/100;
+	if(sc->getSCE(SC_BLIND))
 		hit -= hit * 25/100;
-	if(sc->data[SC_HEAT_BARREL])
-		hit -= sc->data[SC_HEAT_BARREL]->val4;
-	if(sc->data[SC__GROOMY])
-		hit -= hit * sc->data[SC__GROOMY]->val3 / 100;
-	if(sc->data[SC_FEAR])
+	if(sc->getSCE(SC_HEAT_BARREL))
+		hit -= sc->getSCE(SC_HEAT_BARREL)->val4;
+	if(sc->getSCE(SC__GROOMY))
+		hit -= hit * sc->getSCE(SC__GROOMY)->val3 / 100;
+	if(sc->getSCE(SC_FEAR))
 		hit -= hit * 20 / 100;
-	if (sc->data[SC_ASH])
-		hit -= hit * sc->data[SC_ASH]->val2 / 100;
-	if (sc->data[SC_TEARGAS])
+	if (sc->getSCE(SC_ASH))
+		hit -= hit * sc->getSCE(SC_ASH)->val2 / 100;
+	if (sc->getSCE(SC_TEARGAS))
 		hit -= hit * 50 / 100;
-	if(sc->data[SC_ILLUSIONDOPING])
-		hit -= sc->data[SC_ILLUSIONDOPING]->val2;
-	if (sc->data[SC_MTF_ASPD])
-		hit += sc->data[SC_MTF_ASPD]->val2;
+	if(sc->getSCE(SC_ILLUSIONDOPING))
+		hit -= sc->getSCE(SC_ILLUSIONDOPING)->val2;
+	if (sc->getSCE(SC_MTF_ASPD))
+		hit += sc->getSCE(SC_MTF_ASPD)->val2;
 #ifdef RENEWAL
-	if (sc->data[SC_BLESSING])
-		hit += sc->data[SC_BLESSING]->val1 * 2;
-	if (sc->data[SC_TWOHANDQUICKEN])
-		hit += sc->data[SC_TWOHANDQUICKEN]->val1 * 2;
-	if (sc->data[SC_ADRENALINE])
-		hit += sc->data[SC_ADRENALINE]->val1 * 3 + 5;
-	if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_HIT)
+	if (sc->getSCE(SC_BLESSING))
+		hit += sc->getSCE(SC_BLESSING)->val1 * 2;
+	if (sc->getSCE(SC_TWOHANDQUICKEN))
+		hit += sc->getSCE(SC_TWOHANDQUICKEN)->val1 * 2;
+	if (sc->getSCE(SC_ADRENALINE))
+		hit += sc->getSCE(SC_ADRENALINE)->val1 * 3 + 5;
+	if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_HIT)
 		hit += 50;
 #endif
-	if (sc->data[SC_SOULFALCON])
-		hit += sc->data[SC_SOULFALCON]->val3;
-	if (sc->data[SC_SATURDAYNIGHTFEVER])
-		hit -= 50 + 50 * sc->data[SC_SATURDAYNIGHTFEVER]->val1;
-	if (sc->data[SC_PACKING_ENVELOPE10])
-		hit += sc->data[SC_PACKING_ENVELOPE10]->val1;
+	if (sc->getSCE(SC_SOULFALCON))
+		hit += sc->getSCE(SC_SOULFALCON)->val3;
+	if (sc->getSCE(SC_SATURDAYNIGHTFEVER))
+		hit -= 50 + 50 * sc->getSCE(SC_SATURDAYNIGHTFEVER)->val1;
+	if (sc->getSCE(SC_PACKING_ENVELOPE10))
+		hit += sc->getSCE(SC_PACKING_ENVELOPE10)->val1;
 
 	return (short)cap_value(hit,1,SHRT_MAX);
 }
@@ -7286,96 +7286,96 @@ static signed short status_calc_flee(struct block_list *bl, struct status_change
 
 	if(!sc || !sc->count)
 		return cap_value(flee,1,SHRT_MAX);
-	if (sc->data[SC_POISON_MIST])
+	if (sc->getSCE(SC_POISON_MIST))
 		return 0;
-	if(sc->data[SC_OVERED_BOOST]) //Should be final and unmodifiable by any means
-		return sc->data[SC_OVERED_BOOST]->val2;
+	if(sc->getSCE(SC_OVERED_BOOST)) //Should be final and unmodifiable by any means
+		return sc->getSCE(SC_OVERED_BOOST)->val2;
 
 	// Fixed value
-	if(sc->data[SC_INCFLEE])
-		flee += sc->data[SC_INCFLEE]->val1;
-	if(sc->data[SC_FLEEFOOD])
-		flee += sc->data[SC_FLEEFOOD]->val1;
-	if(sc->data[SC_WHISTLE])
-		flee += sc->data[SC_WHISTLE]->val2;
-	if(sc->data[SC_WINDWALK])
-		flee += sc->data[SC_WINDWALK]->val2;
-	if(sc->data[SC_VIOLENTGALE])
-		flee += sc->data[SC_VIOLENTGALE]->val2;
-	if(sc->data[SC_MOON_COMFORT]) // SG skill [Komurka]
-		flee += sc->data[SC_MOON_COMFORT]->val2;
-	if(sc->data[SC_CLOSECONFINE])
+	if(sc->getSCE(SC_INCFLEE))
+		flee += sc->getSCE(SC_INCFLEE)->val1;
+	if(sc->getSCE(SC_FLEEFOOD))
+		flee += sc->getSCE(SC_FLEEFOOD)->val1;
+	if(sc->getSCE(SC_WHISTLE))
+		flee += sc->getSCE(SC_WHISTLE)->val2;
+	if(sc->getSCE(SC_WINDWALK))
+		flee += sc->getSCE(SC_WINDWALK)->val2;
+	if(sc->getSCE(SC_VIOLENTGALE))
+		flee += sc->getSCE(SC_VIOLENTGALE)->val2;
+	if(sc->getSCE(SC_MOON_COMFORT)) // SG skill [Komurka]
+		flee += sc->getSCE(SC_MOON_COMFORT)->val2;
+	if(sc->getSCE(SC_CLOSECONFINE))
 		flee += 10;
-	if (sc->data[SC_ANGRIFFS_MODUS])
-		flee -= sc->data[SC_ANGRIFFS_MODUS]->val3;
-	if(sc->data[SC_ADJUSTMENT])
+	if (sc->getSCE(SC_ANGRIFFS_MODUS))
+		flee -= sc->getSCE(SC_ANGRIFFS_MODUS)->val3;
+	if(sc->getSCE(SC_ADJUSTMENT))
 		flee += 30;
-	if(sc->data[SC_SPEED])
-		flee += 10 + sc->data[SC_SPEED]->val1 * 10;
-	if(sc->data[SC_GATLINGFEVER])
-		flee -= sc->data[SC_GATLINGFEVER]->val4;
-	if(sc->data[SC_PARTYFLEE])
-		flee += sc->data[SC_PARTYFLEE]->val1 * 10;
-	if(sc->data[SC_MERC_FLEEUP])
-		flee += sc->data[SC_MERC_FLEEUP]->val2;
-	if( sc->data[SC_HALLUCINATIONWALK] )
-		flee += sc->data[SC_HALLUCINATIONWALK]->val2;
-	if( sc->data[SC_NPC_HALLUCINATIONWALK] )
-		flee += sc->data[SC_NPC_HALLUCINATIONWALK]->val2;
-	if(sc->data[SC_MTF_HITFLEE])
-		flee += sc->data[SC_MTF_HITFLEE]->val2;
-	if( sc->data[SC_WATER_BARRIER] )
-		flee -= sc->data[SC_WATER_BARRIER]->val2;
-	if( sc->data[SC_C_MARKER] )
-		flee -= sc->data[SC_C_MARKER]->val3;
+	if(sc->getSCE(SC_SPEED))
+		flee += 10 + sc->getSCE(SC_SPEED)->val1 * 10;
+	if(sc->getSCE(SC_GATLINGFEVER))
+		flee -= sc->getSCE(SC_GATLINGFEVER)->val4;
+	if(sc->getSCE(SC_PARTYFLEE))
+		flee += sc->getSCE(SC_PARTYFLEE)->val1 * 10;
+	if(sc->getSCE(SC_MERC_FLEEUP))
+		flee += sc->getSCE(SC_MERC_FLEEUP)->val2;
+	if( sc->getSCE(SC_HALLUCINATIONWALK) )
+		flee += sc->getSCE(SC_HALLUCINATIONWALK)->val2;
+	if( sc->getSCE(SC_NPC_HALLUCINATIONWALK) )
+		flee += sc->getSCE(SC_NPC_HALLUCINATIONWALK)->val2;
+	if(sc->getSCE(SC_MTF_HITFLEE))
+		flee += sc->getSCE(SC_MTF_HITFLEE)->val2;
+	if( sc->getSCE(SC_WATER_BARRIER) )
+		flee -= sc->getSCE(SC_WATER_BARRIER)->val2;
+	if( sc->getSCE(SC_C_MARKER) )
+		flee -= sc->getSCE(SC_C_MARKER)->val3;
 #ifdef RENEWAL
-	if( sc->data[SC_SPEARQUICKEN] )
-		flee += 2 * sc->data[SC_SPEARQUICKEN]->val1;
-	if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_FLEE)
+	if( sc->getSCE(SC_SPEARQUICKEN) )
+		flee += 2 * sc->getSCE(SC_SPEARQUICKEN)->val1;
+	if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_FLEE)
 		flee += 50;
 #endif
 
 	// Rate value
-	if(sc->data[SC_INCFLEERATE])
-		flee += flee * sc->data[SC_INCFLEERATE]->val1/100;
-	if(sc->data[SC_SPIDERWEB])
+	if(sc->getSCE(SC_INCFLEERATE))
+		flee += flee * sc->getSCE(SC_INCFLEERATE)->val1/100;
+	if(sc->getSCE(SC_SPIDERWEB))
 		flee -= flee * 50/100;
-	if(sc->data[SC_BERSERK])
+	if(sc->getSCE(SC_BERSERK))
 		flee -= flee * 50/100;
-	if(sc->data[SC_BLIND])
+	if(sc->getSCE(SC_BLIND))
 		flee -= flee * 25/100;
-	if(sc->data[SC_FEAR])
+	if(sc->getSCE(SC_FEAR))
 		flee -= flee * 20 / 100;
-	if(sc->data[SC_PARALYSE] && sc->data[SC_PARALYSE]->val3 == 1)
+	if(sc->getSCE(SC_PARALYSE) && sc->getSCE(SC_PARALYSE)->val3 == 1)
 		flee -= flee * 10 / 100;
-	if(sc->data[SC_INFRAREDSCAN])
+	if(sc->getSCE(SC_INFRAREDSCAN))
 		flee -= flee * 30 / 100;
-	if( sc->data[SC__LAZINESS] )
-		flee -= flee * sc->data[SC__LAZINESS]->val3 / 100;
-	if( sc->data[SC_GLOOMYDAY] )
-		flee -= flee * sc->data[SC_GLOOMYDAY]->val2 / 100;
-	if( sc->data[SC_SATURDAYNIGHTFEVER] )
-		flee -= 20 + 30 * sc->data[SC_SATURDAYNIGHTFEVER]->val1;
-	if( sc->data[SC_WIND_STEP_OPTION] )
-		flee += flee * sc->data[SC_WIND_STEP_OPTION]->val2 / 100;
-	if( sc->data[SC_TINDER_BREAKER] || sc->data[SC_TINDER_BREAKER2] )
+	if( sc->getSCE(SC__LAZINESS) )
+		flee -= flee * sc->getSCE(SC__LAZINESS)->val3 / 100;
+	if( sc->getSCE(SC_GLOOMYDAY) )
+		flee -= flee * sc->getSCE(SC_GLOOMYDAY)->val2 / 100;
+	if( sc->getSCE(SC_SATURDAYNIGHTFEVER) )
+		flee -= 20 + 30 * sc->getSCE(SC_SATURDAYNIGHTFEVER)->val1;
+	if( sc->getSCE(SC_WIND_STEP_OPTION) )
+		flee += flee * sc->getSCE(SC_WIND_STEP_OPTION)->val2 / 100;
+	if( sc->getSCE(SC_TINDER_BREAKER) || sc->getSCE(SC_TINDER_BREAKER2) )
 		flee -= flee * 50 / 100;
-	if( sc->data[SC_ZEPHYR] )
-		flee += sc->data[SC_ZEPHYR]->val2;
-	if(sc->data[SC_ASH])
-		flee -= flee * sc->data[SC_ASH]->val4 / 100;
-	if (sc->data[SC_GOLDENE_FERSE])
-		flee += flee * sc->data[SC_GOLDENE_FERSE]->val2 / 100;
-	if (sc->data[SC_SMOKEPOWDER])
+	if( sc->getSCE(SC_ZEPHYR) )
+		flee += sc->getSCE(SC_ZEPHYR)->val2;
+	if(sc->getSCE(SC_ASH))
+		flee -= flee * sc->getSCE(SC_ASH)->val4 / 100;
+	if (sc->getSCE(SC_GOLDENE_FERSE))
+		flee += flee * sc->getSCE(SC_GOLDENE_FERSE)->val2 / 100;
+	if (sc->getSCE(SC_SMOKEPOWDER))
 		flee += flee * 20 / 100;
-	if (sc->data[SC_TEARGAS])
+	if (sc->getSCE(SC_TEARGAS))
 		flee -= flee * 50 / 100;
-	//if( sc->data[SC_C_MARKER] )
-	//	flee -= (flee * sc->data[SC_C_MARKER]->val3) / 100;
-	if (sc->data[SC_GROOMING])
-		flee += sc->data[SC_GROOMING]->val2;
-	if (sc->data[SC_PACKING_ENVELOPE5])
-		flee += sc->data[SC_PACKING_ENVELOPE5]->val1;
+	//if( sc->getSCE(SC_C_MARKER) )
+	//	flee -= (flee * sc->getSCE(SC_C_MARKER)->val3) / 100;
+	if (sc->getSCE(SC_GROOMING))
+		flee += sc->getSCE(SC_GROOMING)->val2;
+	if (sc->getSCE(SC_PACKING_ENVELOPE5))
+		flee += sc->getSCE(SC_PACKING_ENVELOPE5)->val1;
 
 	return (short)cap_value(flee,1,SHRT_MAX);
 }
@@ -7392,16 +7392,16 @@ static signed short status_calc_flee2(struct block_list *bl, struct status_chang
 	if(!sc || !sc->count)
 		return cap_value(flee2,10,SHRT_MAX);
 
-	if(sc->data[SC_INCFLEE2])
-		flee2 += sc->data[SC_INCFLEE2]->val2;
-	if(sc->data[SC_WHISTLE])
-		flee2 += sc->data[SC_WHISTLE]->val3*10;
-	if(sc->data[SC__UNLUCKY])
-		flee2 -= flee2 * sc->data[SC__UNLUCKY]->val2 / 100;
-	if (sc->data[SC_HISS])
-		flee2 += sc->data[SC_HISS]->val2*10;
-	if (sc->data[SC_DORAM_FLEE2])
-		flee2 += sc->data[SC_DORAM_FLEE2]->val1;
+	if(sc->getSCE(SC_INCFLEE2))
+		flee2 += sc->getSCE(SC_INCFLEE2)->val2;
+	if(sc->getSCE(SC_WHISTLE))
+		flee2 += sc->getSCE(SC_WHISTLE)->val3*10;
+	if(sc->getSCE(SC__UNLUCKY))
+		flee2 -= flee2 * sc->getSCE(SC__UNLUCKY)->val2 / 100;
+	if (sc->getSCE(SC_HISS))
+		flee2 += sc->getSCE(SC_HISS)->val2*10;
+	if (sc->getSCE(SC_DORAM_FLEE2))
+		flee2 += sc->getSCE(SC_DORAM_FLEE2)->val1;
 
 	return (short)cap_value(flee2,10,SHRT_MAX);
 }
@@ -7418,92 +7418,92 @@ static defType status_calc_def(struct block_list *bl, struct status_change *sc,
 	if(!sc || !sc->count)
 		return (defType)cap_value(def,DEFTYPE_MIN,DEFTYPE_MAX);
 
-	if(sc->data[SC_BERSERK])
+	if(sc->getSCE(SC_BERSERK))
 		return 0;
-	if(sc->data[SC_BARRIER])
+	if(sc->getSCE(SC_BARRIER))
 		return 100;
-	if(sc->data[SC_KEEPING])
+	if(sc->getSCE(SC_KEEPING))
 		return 90;
 #ifndef RENEWAL /// Steel Body does not provide 90 DEF in [RENEWAL]
-	if(sc->data[SC_STEELBODY])
+	if(sc->getSCE(SC_STEELBODY))
 		return 90;
 #endif
-	if (sc->data[SC_NYANGGRASS]) {
+	if (sc->getSCE(SC_NYANGGRASS)) {
 		if (bl->type == BL_PC)
 			return 0;
 		else
 			return def >>= 1;
 	}
-	if(sc->data[SC_DEFSET])
-		return sc->data[SC_DEFSET]->val1;
+	if(sc->getSCE(SC_DEFSET))
+		return sc->getSCE(SC_DEFSET)->val1;
 
-	if(sc->data[SC_DRUMBATTLE])
-		def += sc->data[SC_DRUMBATTLE]->val3;
+	if(sc->getSCE(SC_DRUMBATTLE))
+		def += sc->getSCE(SC_DRUMBATTLE)->val3;
 #ifdef RENEWAL
-	if (sc->data[SC_ASSUMPTIO])
-		def += sc->data[SC_ASSUMPTIO]->val1 * 50;
+	if (sc->getSCE(SC_ASSUMPTIO))
+		def += sc->getSCE(SC_ASSUMPTIO)->val1 * 50;
 #else
-	if(sc->data[SC_DEFENCE])
-		def += sc->data[SC_DEFENCE]->val2;
+	if(sc->getSCE(SC_DEFENCE))
+		def += sc->getSCE(SC_DEFENCE)->val2;
 #endif
-	if(sc->data[SC_INCDEFRATE])
-		def += def * sc->data[SC_INCDEFRATE]->val1/100;
-	if(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 2)
+	if(sc->getSCE(SC_INCDEFRATE))
+		def += def * sc->getSCE(SC_INCDEFRATE)->val1/100;
+	if(sc->getSCE(SC_EARTH_INSIGNIA) && sc->getSCE(SC_EARTH_INSIGNIA)->val1 == 2)
 		def += 50;
-	if(sc->data[SC_ODINS_POWER])
-		def -= 20 * sc->data[SC_ODINS_POWER]->val1;
-	if( sc->data[SC_ANGRIFFS_MODUS] )
-		def -= 20 + 10 * sc->data[SC_ANGRIFFS_MODUS]->val1;
-	if(sc->data[SC_STONEHARDSKIN])
-		def += sc->data[SC_STONEHARDSKIN]->val1;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(sc->getSCE(SC_ODINS_POWER))
+		def -= 20 * sc->getSCE(SC_ODINS_POWER)->val1;
+	if( sc->getSCE(SC_ANGRIFFS_MODUS) )
+		def -= 20 + 10 * sc->getSCE(SC_ANGRIFFS_MODUS)->val1;
+	if(sc->getSCE(SC_STONEHARDSKIN))
+		def += sc->getSCE(SC_STONEHARDSKIN)->val1;
+	if(sc->getSCE(SC_STONE) && sc->opt1 == OPT1_STONE)
 		def >>=1;
-	if(sc->data[SC_FREEZE])
+	if(sc->getSCE(SC_FREEZE))
 		def >>=1;
-	if(sc->data[SC_SIGNUMCRUCIS])
-		def -= def * sc->data[SC_SIGNUMCRUCIS]->val2/100;
-	if(sc->data[SC_CONCENTRATION])
-		def -= def * sc->data[SC_CONCENTRATION]->val4/100;
-	if(sc->data[SC_SKE])
+	if(sc->getSCE(SC_SIGNUMCRUCIS))
+		def -= def * sc->getSCE(SC_SIGNUMCRUCIS)->val2/100;
+	if(sc->getSCE(SC_CONCENTRATION))
+		def -= def * sc->getSCE(SC_CONCENTRATION)->val4/100;
+	if(sc->getSCE(SC_SKE))
 		def >>=1;
-	if(sc->data[SC_PROVOKE] && bl->type != BL_PC) // Provoke doesn't alter player defense->
-		def -= def * sc->data[SC_PROVOKE]->val4/100;
-	if(sc->data[SC_STRIPSHIELD] && bl->type != BL_PC) // Player doesn't have def reduction only equip removed
-		def -= def * sc->data[SC_STRIPSHIELD]->val2/100;
-	if (sc->data[SC_FLING])
-		def -= def * (sc->data[SC_FLING]->val2)/100;
-	if( sc->data[SC_FREEZING] )
+	if(sc->getSCE(SC_PROVOKE) && bl->type != BL_PC) // Provoke doesn't alter player defense->
+		def -= def * sc->getSCE(SC_PROVOKE)->val4/100;
+	if(sc->getSCE(SC_STRIPSHIELD) && bl->type != BL_PC) // Player doesn't have def reduction only equip removed
+		def -= def * sc->getSCE(SC_STRIPSHIELD)->val2/100;
+	if (sc->getSCE(SC_FLING))
+		def -= def * (sc->getSCE(SC_FLING)->val2)/100;
+	if( sc->getSCE(SC_FREEZING) )
 		def -= def * (bl->type == BL_PC ? 30 : 10) / 100;
-	if( sc->data[SC_ANALYZE] )
-		def -= def * (14 * sc->data[SC_ANALYZE]->val1) / 100;
-	if( sc->data[SC_NEUTRALBARRIER] )
-		def += def * sc->data[SC_NEUTRALBARRIER]->val2 / 100;
-	if( sc->data[SC_PRESTIGE] )
-		def += sc->data[SC_PRESTIGE]->val3;
-	if( sc->data[SC_BANDING] && sc->data[SC_BANDING]->val2 > 1 )
-		def += 6 * sc->data[SC_BANDING]->val1;
-	if( sc->data[SC_ECHOSONG] )
-		def += sc->data[SC_ECHOSONG]->val3;
-	if( sc->data[SC_CAMOUFLAGE] )
-		def -= def * 5 * sc->data[SC_CAMOUFLAGE]->val3 / 100;
-	if( sc->data[SC_SOLID_SKIN_OPTION] )
-		def += def * sc->data[SC_SOLID_SKIN_OPTION]->val2 / 100;
-	if( sc->data[SC_ROCK_CRUSHER] )
-		def -= def * sc->data[SC_ROCK_CRUSHER]->val2 / 100;
-	if( sc->data[SC_POWER_OF_GAIA] )
-		def += def * sc->data[SC_POWER_OF_GAIA]->val2 / 100;
-	if(sc->data[SC_ASH])
-		def -= def * sc->data[SC_ASH]->val3/100;
-	if( sc->data[SC_OVERED_BOOST] && bl->type == BL_HOM )
-		def -= def * sc->data[SC_OVERED_BOOST]->val4 / 100;
-	if(sc->data[SC_GLASTHEIM_ITEMDEF])
-		def += sc->data[SC_GLASTHEIM_ITEMDEF]->val1;
-	if (sc->data[SC_SOULGOLEM])
-		def += sc->data[SC_SOULGOLEM]->val2;
-	if (sc->data[SC_STONE_WALL])
-		def += sc->data[SC_STONE_WALL]->val2;
-	if( sc->data[SC_PACKING_ENVELOPE7] )
-		def += sc->data[SC_PACKING_ENVELOPE7]->val1;
+	if( sc->getSCE(SC_ANALYZE) )
+		def -= def * (14 * sc->getSCE(SC_ANALYZE)->val1) / 100;
+	if( sc->getSCE(SC_NEUTRALBARRIER) )
+		def += def * sc->getSCE(SC_NEUTRALBARRIER)->val2 / 100;
+	if( sc->getSCE(SC_PRESTIGE) )
+		def += sc->getSCE(SC_PRESTIGE)->val3;
+	if( sc->getSCE(SC_BANDING) && sc->getSCE(SC_BANDING)->val2 > 1 )
+		def += 6 * sc->getSCE(SC_BANDING)->val1;
+	if( sc->getSCE(SC_ECHOSONG) )
+		def += sc->getSCE(SC_ECHOSONG)->val3;
+	if( sc->getSCE(SC_CAMOUFLAGE) )
+		def -= def * 5 * sc->getSCE(SC_CAMOUFLAGE)->val3 / 100;
+	if( sc->getSCE(SC_SOLID_SKIN_OPTION) )
+		def += def * sc->getSCE(SC_SOLID_SKIN_OPTION)->val2 / 100;
+	if( sc->getSCE(SC_ROCK_CRUSHER) )
+		def -= def * sc->getSCE(SC_ROCK_CRUSHER)->val2 / 100;
+	if( sc->getSCE(SC_POWER_OF_GAIA) )
+		def += def * sc->getSCE(SC_POWER_OF_GAIA)->val2 / 100;
+	if(sc->getSCE(SC_ASH))
+		def -= def * sc->getSCE(SC_ASH)->val3/100;
+	if( sc->getSCE(SC_OVERED_BOOST) && bl->type == BL_HOM )
+		def -= def * sc->getSCE(SC_OVERED_BOOST)->val4 / 100;
+	if(sc->getSCE(SC_GLASTHEIM_ITEMDEF))
+		def += sc->getSCE(SC_GLASTHEIM_ITEMDEF)->val1;
+	if (sc->getSCE(SC_SOULGOLEM))
+		def += sc->getSCE(SC_SOULGOLEM)->val2;
+	if (sc->getSCE(SC_STONE_WALL))
+		def += sc->getSCE(SC_STONE_WALL)->val2;
+	if( sc->getSCE(SC_PACKING_ENVELOPE7) )
+		def += sc->getSCE(SC_PACKING_ENVELOPE7)->val1;
 
 	return (defType)cap_value(def,DEFTYPE_MIN,DEFTYPE_MAX);
 }
@@ -7524,50 +7524,50 @@ static signed short status_calc_def2(struct block_list *bl, struct status_change
 		return (short)cap_value(def2,1,SHRT_MAX);
 #endif
 
-	if(sc->data[SC_BERSERK])
+	if(sc->getSCE(SC_BERSERK))
 		return 0;
-	if(sc->data[SC_ETERNALCHAOS])
+	if(sc->getSCE(SC_ETERNALCHAOS))
 		return 0;
-	if(sc->data[SC_DEFSET])
-		return sc->data[SC_DEFSET]->val1;
+	if(sc->getSCE(SC_DEFSET))
+		return sc->getSCE(SC_DEFSET)->val1;
 
-	if(sc->data[SC_SUN_COMFORT])
-		def2 += sc->data[SC_SUN_COMFORT]->val2;
+	if(sc->getSCE(SC_SUN_COMFORT))
+		def2 += sc->getSCE(SC_SUN_COMFORT)->val2;
 #ifdef RENEWAL
-	if (sc->data[SC_SKA])
+	if (sc->getSCE(SC_SKA))
 		def2 += 80;
 #endif
-	if(sc->data[SC_ANGELUS])
+	if(sc->getSCE(SC_ANGELUS))
 #ifdef RENEWAL /// The VIT stat bonus is boosted by angelus [RENEWAL]
-		def2 += status_get_vit(bl) / 2 * sc->data[SC_ANGELUS]->val2/100;
+		def2 += status_get_vit(bl) / 2 * sc->getSCE(SC_ANGELUS)->val2/100;
 #else
-		def2 += def2 * sc->data[SC_ANGELUS]->val2/100;
-	if(sc->data[SC_CONCENTRATION])
-		def2 -= def2 * sc->data[SC_CONCENTRATION]->val4/100;
+		def2 += def2 * sc->getSCE(SC_ANGELUS)->val2/100;
+	if(sc->getSCE(SC_CONCENTRATION))
+		def2 -= def2 * sc->getSCE(SC_CONCENTRATION)->val4/100;
 #endif
-	if(sc->data[SC_POISON])
+	if(sc->getSCE(SC_POISON))
 		def2 -= def2 * 25/100;
-	if(sc->data[SC_DPOISON])
+	if(sc->getSCE(SC_DPOISON))
 		def2 -= def2 * 25/100;
-	if(sc->data[SC_SKE])
+	if(sc->getSCE(SC_SKE))
 		def2 -= def2 * 50/100;
-	if(sc->data[SC_PROVOKE])
-		def2 -= def2 * sc->data[SC_PROVOKE]->val4/100;
-	if(sc->data[SC_JOINTBEAT])
-		def2 -= def2 * ( sc->data[SC_JOINTBEAT]->val2&BREAK_SHOULDER ? 50 : 0 ) / 100
-			  + def2 * ( sc->data[SC_JOINTBEAT]->val2&BREAK_WAIST ? 25 : 0 ) / 100;
-	if(sc->data[SC_FLING])
-		def2 -= def2 * (sc->data[SC_FLING]->val3)/100;
-	if(sc->data[SC_ANALYZE])
-		def2 -= def2 * (14 * sc->data[SC_ANALYZE]->val1) / 100;
-	if(sc->data[SC_ASH])
-		def2 -= def2 * sc->data[SC_ASH]->val3/100;
-	if (sc->data[SC_PARALYSIS])
-		def2 -= def2 * sc->data[SC_PARALYSIS]->val2 / 100;
-	if(sc->data[SC_EQC])
-		def2 -= def2 * sc->data[SC_EQC]->val2 / 100;
-	if( sc->data[SC_CAMOUFLAGE] )
-		def2 -= def2 * 5 * sc->data[SC_CAMOUFLAGE]->val3 / 100;
+	if(sc->getSCE(SC_PROVOKE))
+		def2 -= def2 * sc->getSCE(SC_PROVOKE)->val4/100;
+	if(sc->getSCE(SC_JOINTBEAT))
+		def2 -= def2 * ( sc->getSCE(SC_JOINTBEAT)->val2&BREAK_SHOULDER ? 50 : 0 ) / 100
+			  + def2 * ( sc->getSCE(SC_JOINTBEAT)->val2&BREAK_WAIST ? 25 : 0 ) / 100;
+	if(sc->getSCE(SC_FLING))
+		def2 -= def2 * (sc->getSCE(SC_FLING)->val3)/100;
+	if(sc->getSCE(SC_ANALYZE))
+		def2 -= def2 * (14 * sc->getSCE(SC_ANALYZE)->val1) / 100;
+	if(sc->getSCE(SC_ASH))
+		def2 -= def2 * sc->getSCE(SC_ASH)->val3/100;
+	if (sc->getSCE(SC_PARALYSIS))
+		def2 -= def2 * sc->getSCE(SC_PARALYSIS)->val2 / 100;
+	if(sc->getSCE(SC_EQC))
+		def2 -= def2 * sc->getSCE(SC_EQC)->val2 / 100;
+	if( sc->getSCE(SC_CAMOUFLAGE) )
+		def2 -= def2 * 5 * sc->getSCE(SC_CAMOUFLAGE)->val3 / 100;
 
 #ifdef RENEWAL
 	return (short)cap_value(def2,SHRT_MIN,SHRT_MAX);
@@ -7588,52 +7588,52 @@ static defType status_calc_mdef(struct block_list *bl, struct status_change *sc,
 	if(!sc || !sc->count)
 		return (defType)cap_value(mdef,DEFTYPE_MIN,DEFTYPE_MAX);
 
-	if(sc->data[SC_BERSERK])
+	if(sc->getSCE(SC_BERSERK))
 		return 0;
-	if(sc->data[SC_BARRIER])
+	if(sc->getSCE(SC_BARRIER))
 		return 100;
 
 #ifndef RENEWAL /// Steel Body does not provide 90 MDEF in [RENEWAL]
-	if(sc->data[SC_STEELBODY])
+	if(sc->getSCE(SC_STEELBODY))
 		return 90;
 #endif
-	if (sc->data[SC_NYANGGRASS]) {
+	if (sc->getSCE(SC_NYANGGRASS)) {
 		if (bl->type == BL_PC)
 			return 0;
 		else
 			return mdef >>= 1;
 	}
-	if(sc->data[SC_MDEFSET])
-		return sc->data[SC_MDEFSET]->val1;
+	if(sc->getSCE(SC_MDEFSET))
+		return sc->getSCE(SC_MDEFSET)->val1;
 
-	if(sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 3)
+	if(sc->getSCE(SC_EARTH_INSIGNIA) && sc->getSCE(SC_EARTH_INSIGNIA)->val1 == 3)
 		mdef += 50;
-	if(sc->data[SC_ENDURE] && !sc->data[SC_ENDURE]->val3) // It has been confirmed that Eddga card grants 1 MDEF, not 0, not 10, but 1.
-		mdef += (sc->data[SC_ENDURE]->val4 == 0) ? sc->data[SC_ENDURE]->val1 : 1;
-	if(sc->data[SC_STONEHARDSKIN])
-		mdef += sc->data[SC_STONEHARDSKIN]->val1;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(sc->getSCE(SC_ENDURE) && !sc->getSCE(SC_ENDURE)->val3) // It has been confirmed that Eddga card grants 1 MDEF, not 0, not 10, but 1.
+		mdef += (sc->getSCE(SC_ENDURE)->val4 == 0) ? sc->getSCE(SC_ENDURE)->val1 : 1;
+	if(sc->getSCE(SC_STONEHARDSKIN))
+		mdef += sc->getSCE(SC_STONEHARDSKIN)->val1;
+	if(sc->getSCE(SC_STONE) && sc->opt1 == OPT1_STONE)
 		mdef += 25 * mdef / 100;
-	if(sc->data[SC_FREEZE])
+	if(sc->getSCE(SC_FREEZE))
 		mdef += 25 * mdef / 100;
-	if(sc->data[SC_BURNING])
+	if(sc->getSCE(SC_BURNING))
 		mdef -= 25 * mdef / 100;
-	if( sc->data[SC_NEUTRALBARRIER] )
-		mdef += mdef * sc->data[SC_NEUTRALBARRIER]->val2 / 100;
-	if(sc->data[SC_ANALYZE])
-		mdef -= mdef * ( 14 * sc->data[SC_ANALYZE]->val1 ) / 100;
-	if(sc->data[SC_SYMPHONYOFLOVER])
-		mdef += mdef * sc->data[SC_SYMPHONYOFLOVER]->val3 / 100;
-	if (sc->data[SC_ODINS_POWER])
-		mdef -= 20 * sc->data[SC_ODINS_POWER]->val1;
-	if(sc->data[SC_GLASTHEIM_ITEMDEF])
-		mdef += sc->data[SC_GLASTHEIM_ITEMDEF]->val2;
-	if (sc->data[SC_SOULGOLEM])
-		mdef += sc->data[SC_SOULGOLEM]->val3;
-	if (sc->data[SC_STONE_WALL])
-		mdef += sc->data[SC_STONE_WALL]->val3;
-	if (sc->data[SC_PACKING_ENVELOPE8])
-		mdef += sc->data[SC_PACKING_ENVELOPE8]->val1;
+	if( sc->getSCE(SC_NEUTRALBARRIER) )
+		mdef += mdef * sc->getSCE(SC_NEUTRALBARRIER)->val2 / 100;
+	if(sc->getSCE(SC_ANALYZE))
+		mdef -= mdef * ( 14 * sc->getSCE(SC_ANALYZE)->val1 ) / 100;
+	if(sc->getSCE(SC_SYMPHONYOFLOVER))
+		mdef += mdef * sc->getSCE(SC_SYMPHONYOFLOVER)->val3 / 100;
+	if (sc->getSCE(SC_ODINS_POWER))
+		mdef -= 20 * sc->getSCE(SC_ODINS_POWER)->val1;
+	if(sc->getSCE(SC_GLASTHEIM_ITEMDEF))
+		mdef += sc->getSCE(SC_GLASTHEIM_ITEMDEF)->val2;
+	if (sc->getSCE(SC_SOULGOLEM))
+		mdef += sc->getSCE(SC_SOULGOLEM)->val3;
+	if (sc->getSCE(SC_STONE_WALL))
+		mdef += sc->getSCE(SC_STONE_WALL)->val3;
+	if (sc->getSCE(SC_PACKING_ENVELOPE8))
+		mdef += sc->getSCE(SC_PACKING_ENVELOPE8)->val1;
 
 	return (defType)cap_value(mdef,DEFTYPE_MIN,DEFTYPE_MAX);
 }
@@ -7654,19 +7654,19 @@ static signed short status_calc_mdef2(struct block_list *bl, struct status_chang
 		return (short)cap_value(mdef2,1,SHRT_MAX);
 #endif
 
-	if(sc->data[SC_BERSERK])
+	if(sc->getSCE(SC_BERSERK))
 		return 0;
-	if(sc->data[SC_SKA])
+	if(sc->getSCE(SC_SKA))
 		return 90;
-	if(sc->data[SC_MDEFSET])
-		return sc->data[SC_MDEFSET]->val1;
+	if(sc->getSCE(SC_MDEFSET))
+		return sc->getSCE(SC_MDEFSET)->val1;
 
-	if(sc->data[SC_MINDBREAKER])
-		mdef2 -= mdef2 * sc->data[SC_MINDBREAKER]->val3/100;
-	if(sc->data[SC_BURNING])
+	if(sc->getSCE(SC_MINDBREAKER))
+		mdef2 -= mdef2 * sc->getSCE(SC_MINDBREAKER)->val3/100;
+	if(sc->getSCE(SC_BURNING))
 		mdef2 -= mdef2 * 25 / 100;
-	if(sc->data[SC_ANALYZE])
-		mdef2 -= mdef2 * (14 * sc->data[SC_ANALYZE]->val1) / 100;
+	if(sc->getSCE(SC_ANALYZE))
+		mdef2 -= mdef2 * (14 * sc->getSCE(SC_ANALYZE)->val1) / 100;
 
 #ifdef RENEWAL
 	return (short)cap_value(mdef2,SHRT_MIN,SHRT_MAX);
@@ -7697,7 +7697,7 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 			val = 50 - 10 * pc_checkskill(sd, NC_MADOLICENCE);
 		else
 			val -= 25;
-		if (sc->data[SC_ACCELERATION])
+		if (sc->getSCE(SC_ACCELERATION))
 			val -= 25;
 		speed += speed * val / 100;
 
@@ -7713,90 +7713,90 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 		int val = 0;
 
 		// GetMoveHasteValue2()
-		if( sc->data[SC_FUSION] )
+		if( sc->getSCE(SC_FUSION) )
 			val = 25;
 		else if( sd ) {
 			if( pc_isriding(sd) || sd->sc.option&OPTION_DRAGON )
 				val = 25; // Same bonus
 			else if( pc_isridingwug(sd) )
 				val = 15 + 5 * pc_checkskill(sd, RA_WUGRIDER);
-			else if( sc->data[SC_ALL_RIDING] )
+			else if( sc->getSCE(SC_ALL_RIDING) )
 				val = battle_config.rental_mount_speed_boost;
 		}
 		speed_rate -= val;
 
 		// GetMoveSlowValue()
-		if( sd && sc->data[SC_HIDING] && pc_checkskill(sd,RG_TUNNELDRIVE) > 0 )
+		if( sd && sc->getSCE(SC_HIDING) && pc_checkskill(sd,RG_TUNNELDRIVE) > 0 )
 			val = 120 - 6 * pc_checkskill(sd,RG_TUNNELDRIVE);
-		else if( sd && sc->data[SC_CHASEWALK] && sc->data[SC_CHASEWALK]->val3 < 0 )
-			val = sc->data[SC_CHASEWALK]->val3;
+		else if( sd && sc->getSCE(SC_CHASEWALK) && sc->getSCE(SC_CHASEWALK)->val3 < 0 )
+			val = sc->getSCE(SC_CHASEWALK)->val3;
 		else {
 			val = 0;
 			// Longing for Freedom/Special Singer cancels song/dance penalty
 #ifdef RENEWAL
-			if (sc->data[SC_ENSEMBLEFATIGUE])
-				val = max(val, sc->data[SC_ENSEMBLEFATIGUE]->val2);
+			if (sc->getSCE(SC_ENSEMBLEFATIGUE))
+				val = max(val, sc->getSCE(SC_ENSEMBLEFATIGUE)->val2);
 #else
-			if( sc->data[SC_LONGING] )
-				val = max( val, 50 - 10 * sc->data[SC_LONGING]->val1 );
+			if( sc->getSCE(SC_LONGING) )
+				val = max( val, 50 - 10 * sc->getSCE(SC_LONGING)->val1 );
 #endif
 			else
-			if( sd && sc->data[SC_DANCING] )
-				val = max( val, 500 - (40 + 10 * (sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_BARDDANCER)) * pc_checkskill(sd,(sd->status.sex?BA_MUSICALLESSON:DC_DANCINGLESSON)) );
+			if( sd && sc->getSCE(SC_DANCING) )
+				val = max( val, 500 - (40 + 10 * (sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_BARDDANCER)) * pc_checkskill(sd,(sd->status.sex?BA_MUSICALLESSON:DC_DANCINGLESSON)) );
 
-			if( sc->data[SC_DECREASEAGI] )
+			if( sc->getSCE(SC_DECREASEAGI) )
 				val = max( val, 25 );
-			if( sc->data[SC_QUAGMIRE] || sc->data[SC_HALLUCINATIONWALK_POSTDELAY] || (sc->data[SC_GLOOMYDAY] && sc->data[SC_GLOOMYDAY]->val4) )
+			if( sc->getSCE(SC_QUAGMIRE) || sc->getSCE(SC_HALLUCINATIONWALK_POSTDELAY) || (sc->getSCE(SC_GLOOMYDAY) && sc->getSCE(SC_GLOOMYDAY)->val4) )
 				val = max( val, 50 );
-			if( sc->data[SC_DONTFORGETME] )
-				val = max( val, sc->data[SC_DONTFORGETME]->val3 );
-			if( sc->data[SC_CURSE] )
+			if( sc->getSCE(SC_DONTFORGETME) )
+				val = max( val, sc->getSCE(SC_DONTFORGETME)->val3 );
+			if( sc->getSCE(SC_CURSE) )
 				val = max( val, 300 );
-			if( sc->data[SC_CHASEWALK] )
-				val = max( val, sc->data[SC_CHASEWALK]->val3 );
-			if( sc->data[SC_WEDDING] )
+			if( sc->getSCE(SC_CHASEWALK) )
+				val = max( val, sc->getSCE(SC_CHASEWALK)->val3 );
+			if( sc->getSCE(SC_WEDDING) )
 				val = max( val, 100 );
-			if( sc->data[SC_JOINTBEAT] && sc->data[SC_JOINTBEAT]->val2&(BREAK_ANKLE|BREAK_KNEE) )
-				val = max( val, (sc->data[SC_JOINTBEAT]->val2&BREAK_ANKLE ? 50 : 0) + (sc->data[SC_JOINTBEAT]->val2&BREAK_KNEE ? 30 : 0) );
-			if( sc->data[SC_CLOAKING] && (sc->data[SC_CLOAKING]->val4&1) == 0 )
-				val = max( val, sc->data[SC_CLOAKING]->val1 < 3 ? 300 : 30 - 3 * sc->data[SC_CLOAKING]->val1 );
-			if( sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_ENEMY )
+			if( sc->getSCE(SC_JOINTBEAT) && sc->getSCE(SC_JOINTBEAT)->val2&(BREAK_ANKLE|BREAK_KNEE) )
+				val = max( val, (sc->getSCE(SC_JOINTBEAT)->val2&BREAK_ANKLE ? 50 : 0) + (sc->getSCE(SC_JOINTBEAT)->val2&BREAK_KNEE ? 30 : 0) );
+			if( sc->getSCE(SC_CLOAKING) && (sc->getSCE(SC_CLOAKING)->val4&1) == 0 )
+				val = max( val, sc->getSCE(SC_CLOAKING)->val1 < 3 ? 300 : 30 - 3 * sc->getSCE(SC_CLOAKING)->val1 );
+			if( sc->getSCE(SC_GOSPEL) && sc->getSCE(SC_GOSPEL)->val4 == BCT_ENEMY )
 				val = max( val, 75 );
-			if( sc->data[SC_SLOWDOWN] ) // Slow Potion
-				val = max( val, sc->data[SC_SLOWDOWN]->val1 );
-			if( sc->data[SC_GATLINGFEVER] )
+			if( sc->getSCE(SC_SLOWDOWN) ) // Slow Potion
+				val = max( val, sc->getSCE(SC_SLOWDOWN)->val1 );
+			if( sc->getSCE(SC_GATLINGFEVER) )
 				val = max( val, 100 );
-			if( sc->data[SC_SUITON] )
-				val = max( val, sc->data[SC_SUITON]->val3 );
-			if( sc->data[SC_SWOO] )
+			if( sc->getSCE(SC_SUITON) )
+				val = max( val, sc->getSCE(SC_SUITON)->val3 );
+			if( sc->getSCE(SC_SWOO) )
 				val = max( val, 300 );
-			if( sc->data[SC_SKA] )
+			if( sc->getSCE(SC_SKA) )
 				val = max( val, 25 );
-			if( sc->data[SC_FREEZING] )
+			if( sc->getSCE(SC_FREEZING) )
 				val = max( val, 30 );
-			if( sc->data[SC_MARSHOFABYSS] )
-				val = max( val, sc->data[SC_MARSHOFABYSS]->val3 );
-			if( sc->data[SC_CAMOUFLAGE] && sc->data[SC_CAMOUFLAGE]->val1 > 2 )
-				val = max( val, 25 * (5 - sc->data[SC_CAMOUFLAGE]->val1) );
-			if( sc->data[SC_STEALTHFIELD] )
+			if( sc->getSCE(SC_MARSHOFABYSS) )
+				val = max( val, sc->getSCE(SC_MARSHOFABYSS)->val3 );
+			if( sc->getSCE(SC_CAMOUFLAGE) && sc->getSCE(SC_CAMOUFLAGE)->val1 > 2 )
+				val = max( val, 25 * (5 - sc->getSCE(SC_CAMOUFLAGE)->val1) );
+			if( sc->getSCE(SC_STEALTHFIELD) )
 				val = max( val, 20 );
-			if( sc->data[SC__LAZINESS] )
+			if( sc->getSCE(SC__LAZINESS) )
 				val = max( val, 25 );
-			if( sc->data[SC_ROCK_CRUSHER_ATK] )
-				val = max( val, sc->data[SC_ROCK_CRUSHER_ATK]->val2 );
-			if( sc->data[SC_POWER_OF_GAIA] )
-				val = max( val, sc->data[SC_POWER_OF_GAIA]->val2 );
-			if( sc->data[SC_MELON_BOMB] )
-				val = max( val, sc->data[SC_MELON_BOMB]->val2 );
-			if( sc->data[SC_REBOUND] )
+			if( sc->getSCE(SC_ROCK_CRUSHER_ATK) )
+				val = max( val, sc->getSCE(SC_ROCK_CRUSHER_ATK)->val2 );
+			if( sc->getSCE(SC_POWER_OF_GAIA) )
+				val = max( val, sc->getSCE(SC_POWER_OF_GAIA)->val2 );
+			if( sc->getSCE(SC_MELON_BOMB) )
+				val = max( val, sc->getSCE(SC_MELON_BOMB)->val2 );
+			if( sc->getSCE(SC_REBOUND) )
 				val = max( val, 25 );
-			if( sc->data[SC_B_TRAP] )
-				val = max( val, sc->data[SC_B_TRAP]->val3 );
-			if (sc->data[SC_CATNIPPOWDER])
-				val = max(val, sc->data[SC_CATNIPPOWDER]->val3);
-			if (sc->data[SC_SP_SHA])
-				val = max(val, sc->data[SC_SP_SHA]->val2);
-			if (sc->data[SC_CREATINGSTAR])
+			if( sc->getSCE(SC_B_TRAP) )
+				val = max( val, sc->getSCE(SC_B_TRAP)->val3 );
+			if (sc->getSCE(SC_CATNIPPOWDER))
+				val = max(val, sc->getSCE(SC_CATNIPPOWDER)->val3);
+			if (sc->getSCE(SC_SP_SHA))
+				val = max(val, sc->getSCE(SC_SP_SHA)->val2);
+			if (sc->getSCE(SC_CREATINGSTAR))
 				val = max(val, 90);
 
 			if( sd && sd->bonus.speed_rate + sd->bonus.speed_add_rate > 0 ) // Permanent item-based speedup
@@ -7805,56 +7805,56 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 		speed_rate += val;
 		val = 0;
 
-		if( sc->data[SC_MARSHOFABYSS] && speed_rate > 150 )
+		if( sc->getSCE(SC_MARSHOFABYSS) && speed_rate > 150 )
 			speed_rate = 150;
 
 		// GetMoveHasteValue1()
-		if( sc->data[SC_SPEEDUP1] ) // !FIXME: used both by NPC_AGIUP and Speed Potion script
-			val = max( val, sc->data[SC_SPEEDUP1]->val1 );
-		if( sc->data[SC_INCREASEAGI] )
+		if( sc->getSCE(SC_SPEEDUP1) ) // !FIXME: used both by NPC_AGIUP and Speed Potion script
+			val = max( val, sc->getSCE(SC_SPEEDUP1)->val1 );
+		if( sc->getSCE(SC_INCREASEAGI) )
 			val = max( val, 25 );
-		if( sc->data[SC_WINDWALK] )
-			val = max( val, 2 * sc->data[SC_WINDWALK]->val1 );
-		if( sc->data[SC_CARTBOOST] )
+		if( sc->getSCE(SC_WINDWALK) )
+			val = max( val, 2 * sc->getSCE(SC_WINDWALK)->val1 );
+		if( sc->getSCE(SC_CARTBOOST) )
 			val = max( val, 20 );
 		if( sd && (sd->class_&MAPID_UPPERMASK) == MAPID_ASSASSIN && pc_checkskill(sd,TF_MISS) > 0 )
 			val = max( val, 1 * pc_checkskill(sd,TF_MISS) );
-		if( sc->data[SC_CLOAKING] && (sc->data[SC_CLOAKING]->val4&1) == 1 )
-			val = max( val, sc->data[SC_CLOAKING]->val1 >= 10 ? 25 : 3 * sc->data[SC_CLOAKING]->val1 - 3 );
-		if( sc->data[SC_BERSERK] )
+		if( sc->getSCE(SC_CLOAKING) && (sc->getSCE(SC_CLOAKING)->val4&1) == 1 )
+			val = max( val, sc->getSCE(SC_CLOAKING)->val1 >= 10 ? 25 : 3 * sc->getSCE(SC_CLOAKING)->val1 - 3 );
+		if( sc->getSCE(SC_BERSERK) )
 			val = max( val, 25 );
-		if( sc->data[SC_RUN] )
+		if( sc->getSCE(SC_RUN) )
 			val = max( val, 55 );
-		if( sc->data[SC_AVOID] )
-			val = max( val, 10 * sc->data[SC_AVOID]->val1 );
-		if( sc->data[SC_INVINCIBLE] && !sc->data[SC_INVINCIBLEOFF] )
+		if( sc->getSCE(SC_AVOID) )
+			val = max( val, 10 * sc->getSCE(SC_AVOID)->val1 );
+		if( sc->getSCE(SC_INVINCIBLE) && !sc->getSCE(SC_INVINCIBLEOFF) )
 			val = max( val, 75 );
-		if( sc->data[SC_CLOAKINGEXCEED] )
-			val = max( val, sc->data[SC_CLOAKINGEXCEED]->val3);
-		if (sc->data[SC_PARALYSE] && sc->data[SC_PARALYSE]->val3 == 0)
+		if( sc->getSCE(SC_CLOAKINGEXCEED) )
+			val = max( val, sc->getSCE(SC_CLOAKINGEXCEED)->val3);
+		if (sc->getSCE(SC_PARALYSE) && sc->getSCE(SC_PARALYSE)->val3 == 0)
 			val = max(val, 50);
-		if( sc->data[SC_HOVERING] )
+		if( sc->getSCE(SC_HOVERING) )
 			val = max( val, 10 );
-		if( sc->data[SC_GN_CARTBOOST] )
-			val = max( val, sc->data[SC_GN_CARTBOOST]->val2 );
-		if( sc->data[SC_SWINGDANCE] )
-			val = max( val, sc->data[SC_SWINGDANCE]->val3 );
-		if( sc->data[SC_WIND_STEP_OPTION] )
-			val = max( val, sc->data[SC_WIND_STEP_OPTION]->val2 );
-		if( sc->data[SC_FULL_THROTTLE] )
+		if( sc->getSCE(SC_GN_CARTBOOST) )
+			val = max( val, sc->getSCE(SC_GN_CARTBOOST)->val2 );
+		if( sc->getSCE(SC_SWINGDANCE) )
+			val = max( val, sc->getSCE(SC_SWINGDANCE)->val3 );
+		if( sc->getSCE(SC_WIND_STEP_OPTION) )
+			val = max( val, sc->getSCE(SC_WIND_STEP_OPTION)->val2 );
+		if( sc->getSCE(SC_FULL_THROTTLE) )
 			val = max( val, 25 );
-		if (sc->data[SC_ARCLOUSEDASH])
-			val = max(val, sc->data[SC_ARCLOUSEDASH]->val3);
-		if( sc->data[SC_DORAM_WALKSPEED] )
-			val = max(val, sc->data[SC_DORAM_WALKSPEED]->val1);
-		if (sc->data[SC_RUSHWINDMILL])
+		if (sc->getSCE(SC_ARCLOUSEDASH))
+			val = max(val, sc->getSCE(SC_ARCLOUSEDASH)->val3);
+		if( sc->getSCE(SC_DORAM_WALKSPEED) )
+			val = max(val, sc->getSCE(SC_DORAM_WALKSPEED)->val1);
+		if (sc->getSCE(SC_RUSHWINDMILL))
 			val = max(val, 25); // !TODO: Confirm bonus movement speed
-		if (sc->data[SC_EMERGENCY_MOVE])
-			val = max(val, sc->data[SC_EMERGENCY_MOVE]->val2);
+		if (sc->getSCE(SC_EMERGENCY_MOVE))
+			val = max(val, sc->getSCE(SC_EMERGENCY_MOVE)->val2);
 
 		// !FIXME: official items use a single bonus for this [ultramage]
-		if( sc->data[SC_SPEEDUP0] ) // Temporary item-based speedup
-			val = max( val, sc->data[SC_SPEEDUP0]->val1 );
+		if( sc->getSCE(SC_SPEEDUP0) ) // Temporary item-based speedup
+			val = max( val, sc->getSCE(SC_SPEEDUP0)->val1 );
 		if( sd && sd->bonus.speed_rate + sd->bonus.speed_add_rate < 0 ) // Permanent item-based speedup
 			val = max( val, -(sd->bonus.speed_rate + sd->bonus.speed_add_rate) );
 
@@ -7867,16 +7867,16 @@ static unsigned short status_calc_speed(struct block_list *bl, struct status_cha
 	// GetSpeed()
 	if( sd && pc_iscarton(sd) )
 		speed += speed * (50 - 5 * pc_checkskill(sd,MC_PUSHCART)) / 100;
-	if( sc->data[SC_PARALYSE] && sc->data[SC_PARALYSE]->val3 == 1 )
+	if( sc->getSCE(SC_PARALYSE) && sc->getSCE(SC_PARALYSE)->val3 == 1 )
 		speed += speed * 50 / 100;
 	if( speed_rate != 100 )
 		speed = speed * speed_rate / 100;
-	if( sc->data[SC_STEELBODY] )
+	if( sc->getSCE(SC_STEELBODY) )
 		speed = 200;
-	if( sc->data[SC_DEFENDER] )
+	if( sc->getSCE(SC_DEFENDER) )
 		speed = max(speed, 200);
-	if( sc->data[SC_WALKSPEED] && sc->data[SC_WALKSPEED]->val1 > 0 ) // ChangeSpeed
-		speed = speed * 100 / sc->data[SC_WALKSPEED]->val1;
+	if( sc->getSCE(SC_WALKSPEED) && sc->getSCE(SC_WALKSPEED)->val1 > 0 ) // ChangeSpeed
+		speed = speed * 100 / sc->getSCE(SC_WALKSPEED)->val1;
 
 	return (unsigned short)cap_value(speed, MIN_WALK_SPEED, MAX_WALK_SPEED);
 }
@@ -7901,22 +7901,22 @@ static short status_calc_aspd(struct block_list *bl, struct status_change *sc, b
 	if (fixed) {
 		enum sc_type sc_val;
 
-		if (!sc->data[SC_QUAGMIRE]) {
+		if (!sc->getSCE(SC_QUAGMIRE)) {
 			// !TODO: How does Two-Hand Quicken, Adrenaline Rush, and Spear quick change? (+10%)
-			if (bonus < 7 && (sc->data[SC_TWOHANDQUICKEN] || sc->data[SC_ONEHAND] || sc->data[SC_MERC_QUICKEN] || sc->data[SC_ADRENALINE] || sc->data[SC_SPEARQUICKEN]))
+			if (bonus < 7 && (sc->getSCE(SC_TWOHANDQUICKEN) || sc->getSCE(SC_ONEHAND) || sc->getSCE(SC_MERC_QUICKEN) || sc->getSCE(SC_ADRENALINE) || sc->getSCE(SC_SPEARQUICKEN)))
 				bonus = 7;
-			else if (bonus < 6 && sc->data[SC_ADRENALINE2])
+			else if (bonus < 6 && sc->getSCE(SC_ADRENALINE2))
 				bonus = 6;
-			else if (bonus < 5 && sc->data[SC_FLEET])
+			else if (bonus < 5 && sc->getSCE(SC_FLEET))
 				bonus = 5;
 		}
 
-		if (sc->data[SC_ASSNCROS] && bonus < sc->data[SC_ASSNCROS]->val2) {
+		if (sc->getSCE(SC_ASSNCROS) && bonus < sc->getSCE(SC_ASSNCROS)->val2) {
 #ifdef RENEWAL
-			bonus += sc->data[SC_ASSNCROS]->val2;
+			bonus += sc->getSCE(SC_ASSNCROS)->val2;
 #else
 			if (bl->type != BL_PC)
-				bonus += sc->data[SC_ASSNCROS]->val2;
+				bonus += sc->getSCE(SC_ASSNCROS)->val2;
 			else {
 				switch(((TBL_PC*)bl)->status.weapon) {
 					case W_BOW:
@@ -7927,92 +7927,92 @@ static short status_calc_aspd(struct block_list *bl, struct status_change *sc, b
 					case W_GRENADE:
 						break;
 					default:
-						bonus += sc->data[SC_ASSNCROS]->val2;
+						bonus += sc->getSCE(SC_ASSNCROS)->val2;
 						break;
 				}
 			}
 #endif
 		}
 
-		if (bonus < 20 && sc->data[SC_MADNESSCANCEL])
+		if (bonus < 20 && sc->getSCE(SC_MADNESSCANCEL))
 			bonus = 20;
-		else if (bonus < 15 && sc->data[SC_BERSERK])
+		else if (bonus < 15 && sc->getSCE(SC_BERSERK))
 			bonus = 15;
 
-		if (sc->data[sc_val = SC_ASPDPOTION3] || sc->data[sc_val = SC_ASPDPOTION2] || sc->data[sc_val = SC_ASPDPOTION1] || sc->data[sc_val = SC_ASPDPOTION0])
-			bonus += sc->data[sc_val]->val1;
-		if (sc->data[SC_ATTHASTE_CASH])
-			bonus += sc->data[SC_ATTHASTE_CASH]->val1;
+		if (sc->getSCE(sc_val = SC_ASPDPOTION3) || sc->getSCE(sc_val = SC_ASPDPOTION2) || sc->getSCE(sc_val = SC_ASPDPOTION1) || sc->getSCE(sc_val = SC_ASPDPOTION0))
+			bonus += sc->getSCE(sc_val)->val1;
+		if (sc->getSCE(SC_ATTHASTE_CASH))
+			bonus += sc->getSCE(SC_ATTHASTE_CASH)->val1;
 	} else {
-		if (sc->data[SC_DONTFORGETME])
-			bonus -= sc->data[SC_DONTFORGETME]->val2 / 10;
+		if (sc->getSCE(SC_DONTFORGETME))
+			bonus -= sc->getSCE(SC_DONTFORGETME)->val2 / 10;
 #ifdef RENEWAL
-		if (sc->data[SC_ENSEMBLEFATIGUE])
-			bonus -= sc->data[SC_ENSEMBLEFATIGUE]->val2 / 10;
+		if (sc->getSCE(SC_ENSEMBLEFATIGUE))
+			bonus -= sc->getSCE(SC_ENSEMBLEFATIGUE)->val2 / 10;
 #else
-		if (sc->data[SC_LONGING])
-			bonus -= sc->data[SC_LONGING]->val2 / 10;
+		if (sc->getSCE(SC_LONGING))
+			bonus -= sc->getSCE(SC_LONGING)->val2 / 10;
 #endif
-		if (sc->data[SC_STEELBODY])
+		if (sc->getSCE(SC_STEELBODY))
 			bonus -= 25;
-		if (sc->data[SC_SKA])
+		if (sc->getSCE(SC_SKA))
 			bonus -= 25;
-		if (sc->data[SC_DEFENDER])
-			bonus -= sc->data[SC_DEFENDER]->val4 / 10;
-		if (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_ENEMY)
+		if (sc->getSCE(SC_DEFENDER))
+			bonus -= sc->getSCE(SC_DEFENDER)->val4 / 10;
+		if (sc->getSCE(SC_GOSPEL) && sc->getSCE(SC_GOSPEL)->val4 == BCT_ENEMY)
 			bonus -= 75;
 #ifndef RENEWAL
-		if (sc->data[SC_GRAVITATION])
-			bonus -= sc->data[SC_GRAVITATION]->val2 / 10; // Needs more info
+		if (sc->getSCE(SC_GRAVITATION))
+			bonus -= sc->getSCE(SC_GRAVITATION)->val2 / 10; // Needs more info
 #endif
-		if (sc->data[SC_JOINTBEAT]) { // Needs more info
-			if (sc->data[SC_JOINTBEAT]->val2&BREAK_WRIST)
+		if (sc->getSCE(SC_JOINTBEAT)) { // Needs more info
+			if (sc->getSCE(SC_JOINTBEAT)->val2&BREAK_WRIST)
 				bonus -= 25;
-			if (sc->data[SC_JOINTBEAT]->val2&BREAK_KNEE)
+			if (sc->getSCE(SC_JOINTBEAT)->val2&BREAK_KNEE)
 				bonus -= 10;
 		}
-		if (sc->data[SC_FREEZING])
+		if (sc->getSCE(SC_FREEZING))
 			bonus -= 30;
-		if (sc->data[SC_HALLUCINATIONWALK_POSTDELAY])
+		if (sc->getSCE(SC_HALLUCINATIONWALK_POSTDELAY))
 			bonus -= 50;
-		if (sc->data[SC_PARALYSE] && sc->data[SC_PARALYSE]->val3 == 1)
+		if (sc->getSCE(SC_PARALYSE) && sc->getSCE(SC_PARALYSE)->val3 == 1)
 			bonus -= 10;
-		if (sc->data[SC__BODYPAINT])
-			bonus -= 5 * sc->data[SC__BODYPAINT]->val1;
-		if (sc->data[SC__INVISIBILITY])
-			bonus -= sc->data[SC__INVISIBILITY]->val2;
-		if (sc->data[SC__GROOMY])
-			bonus -= sc->data[SC__GROOMY]->val2;
-		if (sc->data[SC_SWINGDANCE])
-			bonus += sc->data[SC_SWINGDANCE]->val3;
-		if (sc->data[SC_DANCEWITHWUG])
-			bonus += sc->data[SC_DANCEWITHWUG]->val3;
-		if (sc->data[SC_GLOOMYDAY])
-			bonus -= sc->data[SC_GLOOMYDAY]->val3;
-		if (sc->data[SC_GT_CHANGE])
-			bonus += sc->data[SC_GT_CHANGE]->val3;
-		if (sc->data[SC_MELON_BOMB])
-			bonus -= sc->data[SC_MELON_BOMB]->val3;
-		if (sc->data[SC_BOOST500])
-			bonus += sc->data[SC_BOOST500]->val1;
-		if (sc->data[SC_EXTRACT_SALAMINE_JUICE])
-			bonus += sc->data[SC_EXTRACT_SALAMINE_JUICE]->val1;
-		if (sc->data[SC_GOLDENE_FERSE])
-			bonus += sc->data[SC_GOLDENE_FERSE]->val3;
-		if (sc->data[SC_INCASPDRATE])
-			bonus += sc->data[SC_INCASPDRATE]->val1;
-		if (sc->data[SC_GATLINGFEVER])
-			bonus += sc->data[SC_GATLINGFEVER]->val1;
-		if (sc->data[SC_STAR_COMFORT])
-			bonus += 3 * sc->data[SC_STAR_COMFORT]->val1;
-		if (sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 2)
+		if (sc->getSCE(SC__BODYPAINT))
+			bonus -= 5 * sc->getSCE(SC__BODYPAINT)->val1;
+		if (sc->getSCE(SC__INVISIBILITY))
+			bonus -= sc->getSCE(SC__INVISIBILITY)->val2;
+		if (sc->getSCE(SC__GROOMY))
+			bonus -= sc->getSCE(SC__GROOMY)->val2;
+		if (sc->getSCE(SC_SWINGDANCE))
+			bonus += sc->getSCE(SC_SWINGDANCE)->val3;
+		if (sc->getSCE(SC_DANCEWITHWUG))
+			bonus += sc->getSCE(SC_DANCEWITHWUG)->val3;
+		if (sc->getSCE(SC_GLOOMYDAY))
+			bonus -= sc->getSCE(SC_GLOOMYDAY)->val3;
+		if (sc->getSCE(SC_GT_CHANGE))
+			bonus += sc->getSCE(SC_GT_CHANGE)->val3;
+		if (sc->getSCE(SC_MELON_BOMB))
+			bonus -= sc->getSCE(SC_MELON_BOMB)->val3;
+		if (sc->getSCE(SC_BOOST500))
+			bonus += sc->getSCE(SC_BOOST500)->val1;
+		if (sc->getSCE(SC_EXTRACT_SALAMINE_JUICE))
+			bonus += sc->getSCE(SC_EXTRACT_SALAMINE_JUICE)->val1;
+		if (sc->getSCE(SC_GOLDENE_FERSE))
+			bonus += sc->getSCE(SC_GOLDENE_FERSE)->val3;
+		if (sc->getSCE(SC_INCASPDRATE))
+			bonus += sc->getSCE(SC_INCASPDRATE)->val1;
+		if (sc->getSCE(SC_GATLINGFEVER))
+			bonus += sc->getSCE(SC_GATLINGFEVER)->val1;
+		if (sc->getSCE(SC_STAR_COMFORT))
+			bonus += 3 * sc->getSCE(SC_STAR_COMFORT)->val1;
+		if (sc->getSCE(SC_WIND_INSIGNIA) && sc->getSCE(SC_WIND_INSIGNIA)->val1 == 2)
 			bonus += 10;
-		if (sc->data[SC_INCREASEAGI])
-			bonus += sc->data[SC_INCREASEAGI]->val1;
-		if (sc->data[SC_NIBELUNGEN] && sc->data[SC_NIBELUNGEN]->val2 == RINGNBL_ASPDRATE)
+		if (sc->getSCE(SC_INCREASEAGI))
+			bonus += sc->getSCE(SC_INCREASEAGI)->val1;
+		if (sc->getSCE(SC_NIBELUNGEN) && sc->getSCE(SC_NIBELUNGEN)->val2 == RINGNBL_ASPDRATE)
 			bonus += 20;
-		if (sc->data[SC_STARSTANCE])
-			bonus += sc->data[SC_STARSTANCE]->val2;
+		if (sc->getSCE(SC_STARSTANCE))
+			bonus += sc->getSCE(SC_STARSTANCE)->val2;
 
 		struct map_session_data* sd = BL_CAST(BL_PC, bl);
 		uint8 skill_lv;
@@ -8038,25 +8038,25 @@ static short status_calc_fix_aspd(struct block_list *bl, struct status_change *s
 {
 	if (!sc || !sc->count)
 		return cap_value(aspd, 0, 2000);
-	if (sc->data[SC_OVERED_BOOST])
-		return cap_value(2000 - sc->data[SC_OVERED_BOOST]->val3 * 10, 0, 2000);
+	if (sc->getSCE(SC_OVERED_BOOST))
+		return cap_value(2000 - sc->getSCE(SC_OVERED_BOOST)->val3 * 10, 0, 2000);
 
-	if ((sc->data[SC_GUST_OPTION] || sc->data[SC_BLAST_OPTION] || sc->data[SC_WILD_STORM_OPTION]))
+	if ((sc->getSCE(SC_GUST_OPTION) || sc->getSCE(SC_BLAST_OPTION) || sc->getSCE(SC_WILD_STORM_OPTION)))
 		aspd -= 50; // +5 ASPD
-	if (sc->data[SC_FIGHTINGSPIRIT])
-		aspd -= sc->data[SC_FIGHTINGSPIRIT]->val2;
-	if (sc->data[SC_MTF_ASPD])
-		aspd -= sc->data[SC_MTF_ASPD]->val1;
-	if (sc->data[SC_MTF_ASPD2])
-		aspd -= sc->data[SC_MTF_ASPD2]->val1;
-	if (sc->data[SC_SOULSHADOW])
-		aspd -= 10 * sc->data[SC_SOULSHADOW]->val2;
-	if (sc->data[SC_HEAT_BARREL])
-		aspd -= sc->data[SC_HEAT_BARREL]->val1 * 10;
-	if (sc->data[SC_EP16_2_BUFF_SS])
+	if (sc->getSCE(SC_FIGHTINGSPIRIT))
+		aspd -= sc->getSCE(SC_FIGHTINGSPIRIT)->val2;
+	if (sc->getSCE(SC_MTF_ASPD))
+		aspd -= sc->getSCE(SC_MTF_ASPD)->val1;
+	if (sc->getSCE(SC_MTF_ASPD2))
+		aspd -= sc->getSCE(SC_MTF_ASPD2)->val1;
+	if (sc->getSCE(SC_SOULSHADOW))
+		aspd -= 10 * sc->getSCE(SC_SOULSHADOW)->val2;
+	if (sc->getSCE(SC_HEAT_BARREL))
+		aspd -= sc->getSCE(SC_HEAT_BARREL)->val1 * 10;
+	if (sc->getSCE(SC_EP16_2_BUFF_SS))
 		aspd -= 100; // +10 ASPD
-	if (sc->data[SC_PACKING_ENVELOPE6])
-		aspd -= sc->data[SC_PACKING_ENVELOPE6]->val1 * 10;
+	if (sc->getSCE(SC_PACKING_ENVELOPE6))
+		aspd -= sc->getSCE(SC_PACKING_ENVELOPE6)->val1 * 10;
 
 	return cap_value(aspd, 0, 2000); // Will be recap for proper bl anyway
 }
@@ -8077,46 +8077,46 @@ static short status_calc_aspd_rate(struct block_list *bl, struct status_change *
 	if(!sc || !sc->count)
 		return cap_value(aspd_rate,0,SHRT_MAX);
 
-	if( !sc->data[SC_QUAGMIRE] ) {
+	if( !sc->getSCE(SC_QUAGMIRE) ) {
 		int max = 0;
-		if(sc->data[SC_STAR_COMFORT])
-			max = sc->data[SC_STAR_COMFORT]->val2;
+		if(sc->getSCE(SC_STAR_COMFORT))
+			max = sc->getSCE(SC_STAR_COMFORT)->val2;
 
-		if(sc->data[SC_TWOHANDQUICKEN] &&
-			max < sc->data[SC_TWOHANDQUICKEN]->val2)
-			max = sc->data[SC_TWOHANDQUICKEN]->val2;
+		if(sc->getSCE(SC_TWOHANDQUICKEN) &&
+			max < sc->getSCE(SC_TWOHANDQUICKEN)->val2)
+			max = sc->getSCE(SC_TWOHANDQUICKEN)->val2;
 
-		if(sc->data[SC_ONEHAND] &&
-			max < sc->data[SC_ONEHAND]->val2)
-			max = sc->data[SC_ONEHAND]->val2;
+		if(sc->getSCE(SC_ONEHAND) &&
+			max < sc->getSCE(SC_ONEHAND)->val2)
+			max = sc->getSCE(SC_ONEHAND)->val2;
 
-		if(sc->data[SC_MERC_QUICKEN] &&
-			max < sc->data[SC_MERC_QUICKEN]->val2)
-			max = sc->data[SC_MERC_QUICKEN]->val2;
+		if(sc->getSCE(SC_MERC_QUICKEN) &&
+			max < sc->getSCE(SC_MERC_QUICKEN)->val2)
+			max = sc->getSCE(SC_MERC_QUICKEN)->val2;
 
-		if(sc->data[SC_ADRENALINE2] &&
-			max < sc->data[SC_ADRENALINE2]->val3)
-			max = sc->data[SC_ADRENALINE2]->val3;
+		if(sc->getSCE(SC_ADRENALINE2) &&
+			max < sc->getSCE(SC_ADRENALINE2)->val3)
+			max = sc->getSCE(SC_ADRENALINE2)->val3;
 
-		if(sc->data[SC_ADRENALINE] &&
-			max < sc->data[SC_ADRENALINE]->val3)
-			max = sc->data[SC_ADRENALINE]->val3;
+		if(sc->getSCE(SC_ADRENALINE) &&
+			max < sc->getSCE(SC_ADRENALINE)->val3)
+			max = sc->getSCE(SC_ADRENALINE)->val3;
 
-		if(sc->data[SC_SPEARQUICKEN] &&
-			max < sc->data[SC_SPEARQUICKEN]->val2)
-			max = sc->data[SC_SPEARQUICKEN]->val2;
+		if(sc->getSCE(SC_SPEARQUICKEN) &&
+			max < sc->getSCE(SC_SPEARQUICKEN)->val2)
+			max = sc->getSCE(SC_SPEARQUICKEN)->val2;
 
-		if(sc->data[SC_GATLINGFEVER] &&
-			max < sc->data[SC_GATLINGFEVER]->val2)
-			max = sc->data[SC_GATLINGFEVER]->val2;
+		if(sc->getSCE(SC_GATLINGFEVER) &&
+			max < sc->getSCE(SC_GATLINGFEVER)->val2)
+			max = sc->getSCE(SC_GATLINGFEVER)->val2;
 
-		if(sc->data[SC_FLEET] &&
-			max < sc->data[SC_FLEET]->val2)
-			max = sc->data[SC_FLEET]->val2;
+		if(sc->getSCE(SC_FLEET) &&
+			max < sc->getSCE(SC_FLEET)->val2)
+			max = sc->getSCE(SC_FLEET)->val2;
 
-		if(sc->data[SC_ASSNCROS] && max < sc->data[SC_ASSNCROS]->val2) {
+		if(sc->getSCE(SC_ASSNCROS) && max < sc->getSCE(SC_ASSNCROS)->val2) {
 			if (bl->type!=BL_PC)
-				max = sc->data[SC_ASSNCROS]->val2;
+				max = sc->getSCE(SC_ASSNCROS)->val2;
 			else
 				switch(((TBL_PC*)bl)->status.weapon) {
 					case W_BOW:
@@ -8127,87 +8127,87 @@ static short status_calc_aspd_rate(struct block_list *bl, struct status_change *
 					case W_GRENADE:
 						break;
 					default:
-						max = sc->data[SC_ASSNCROS]->val2;
+						max = sc->getSCE(SC_ASSNCROS)->val2;
 			}
 		}
 		aspd_rate -= max;
 
-		if(sc->data[SC_BERSERK])
+		if(sc->getSCE(SC_BERSERK))
 			aspd_rate -= 300;
-		else if(sc->data[SC_MADNESSCANCEL])
+		else if(sc->getSCE(SC_MADNESSCANCEL))
 			aspd_rate -= 200;
 	}
 
-	if( sc->data[i=SC_ASPDPOTION3] ||
-		sc->data[i=SC_ASPDPOTION2] ||
-		sc->data[i=SC_ASPDPOTION1] ||
-		sc->data[i=SC_ASPDPOTION0] )
-		aspd_rate -= sc->data[i]->val2;
+	if( sc->getSCE(i=SC_ASPDPOTION3) ||
+		sc->getSCE(i=SC_ASPDPOTION2) ||
+		sc->getSCE(i=SC_ASPDPOTION1) ||
+		sc->getSCE(i=SC_ASPDPOTION0) )
+		aspd_rate -= sc->getSCE(i)->val2;
 
-	if (sc->data[SC_ATTHASTE_CASH])
-		aspd_rate -= sc->data[SC_ATTHASTE_CASH]->val2;
+	if (sc->getSCE(SC_ATTHASTE_CASH))
+		aspd_rate -= sc->getSCE(SC_ATTHASTE_CASH)->val2;
 
-	if(sc->data[SC_DONTFORGETME])
-		aspd_rate += sc->data[SC_DONTFORGETME]->val2;
+	if(sc->getSCE(SC_DONTFORGETME))
+		aspd_rate += sc->getSCE(SC_DONTFORGETME)->val2;
 #ifdef RENEWAL
-	if (sc->data[SC_ENSEMBLEFATIGUE])
-		aspd_rate += sc->data[SC_ENSEMBLEFATIGUE]->val2;
+	if (sc->getSCE(SC_ENSEMBLEFATIGUE))
+		aspd_rate += sc->getSCE(SC_ENSEMBLEFATIGUE)->val2;
 #else
-	if(sc->data[SC_LONGING])
-		aspd_rate += sc->data[SC_LONGING]->val2;
+	if(sc->getSCE(SC_LONGING))
+		aspd_rate += sc->getSCE(SC_LONGING)->val2;
 #endif
-	if(sc->data[SC_STEELBODY])
+	if(sc->getSCE(SC_STEELBODY))
 		aspd_rate += 250;
-	if(sc->data[SC_SKA])
+	if(sc->getSCE(SC_SKA))
 		aspd_rate += 250;
-	if(sc->data[SC_DEFENDER])
-		aspd_rate += sc->data[SC_DEFENDER]->val4;
-	if(sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_ENEMY)
+	if(sc->getSCE(SC_DEFENDER))
+		aspd_rate += sc->getSCE(SC_DEFENDER)->val4;
+	if(sc->getSCE(SC_GOSPEL) && sc->getSCE(SC_GOSPEL)->val4 == BCT_ENEMY)
 		aspd_rate += 250;
 #ifndef RENEWAL
-	if(sc->data[SC_GRAVITATION])
-		aspd_rate += sc->data[SC_GRAVITATION]->val2;
+	if(sc->getSCE(SC_GRAVITATION))
+		aspd_rate += sc->getSCE(SC_GRAVITATION)->val2;
 #endif
-	if(sc->data[SC_JOINTBEAT]) {
-		if( sc->data[SC_JOINTBEAT]->val2&BREAK_WRIST )
+	if(sc->getSCE(SC_JOINTBEAT)) {
+		if( sc->getSCE(SC_JOINTBEAT)->val2&BREAK_WRIST )
 			aspd_rate += 250;
-		if( sc->data[SC_JOINTBEAT]->val2&BREAK_KNEE )
+		if( sc->getSCE(SC_JOINTBEAT)->val2&BREAK_KNEE )
 			aspd_rate += 100;
 	}
-	if( sc->data[SC_FREEZING] )
+	if( sc->getSCE(SC_FREEZING) )
 		aspd_rate += 300;
-	if( sc->data[SC_HALLUCINATIONWALK_POSTDELAY] )
+	if( sc->getSCE(SC_HALLUCINATIONWALK_POSTDELAY) )
 		aspd_rate += 500;
-	if( sc->data[SC_PARALYSE] && sc->data[SC_PARALYSE]->val3 == 1 )
+	if( sc->getSCE(SC_PARALYSE) && sc->getSCE(SC_PARALYSE)->val3 == 1 )
 		aspd_rate += 100;
-	if( sc->data[SC__BODYPAINT] )
-		aspd_rate +=  50 * sc->data[SC__BODYPAINT]->val1;
-	if( sc->data[SC__INVISIBILITY] )
-		aspd_rate += sc->data[SC__INVISIBILITY]->val2 * 10;
-	if( sc->data[SC__GROOMY] )
-		aspd_rate += sc->data[SC__GROOMY]->val2 * 10;
-	if( sc->data[SC_SWINGDANCE] )
-		aspd_rate -= sc->data[SC_SWINGDANCE]->val3 * 10;
-	if( sc->data[SC_DANCEWITHWUG] )
-		aspd_rate -= sc->data[SC_DANCEWITHWUG]->val3 * 10;
-	if( sc->data[SC_GLOOMYDAY] )
-		aspd_rate += sc->data[SC_GLOOMYDAY]->val3 * 10;
-	if( sc->data[SC_GT_CHANGE] )
-		aspd_rate -= sc->data[SC_GT_CHANGE]->val3 * 10;
-	if( sc->data[SC_MELON_BOMB] )
-		aspd_rate += sc->data[SC_MELON_BOMB]->val3 * 10;
-	if( sc->data[SC_BOOST500] )
-		aspd_rate -= sc->data[SC_BOOST500]->val1 *10;
-	if( sc->data[SC_EXTRACT_SALAMINE_JUICE] )
-		aspd_rate -= sc->data[SC_EXTRACT_SALAMINE_JUICE]->val1 * 10;
-	if( sc->data[SC_INCASPDRATE] )
-		aspd_rate -= sc->data[SC_INCASPDRATE]->val1 * 10;
-	if( sc->data[SC_GOLDENE_FERSE])
-		aspd_rate -= sc->data[SC_GOLDENE_FERSE]->val3 * 10;
-	if (sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 2)
+	if( sc->getSCE(SC__BODYPAINT) )
+		aspd_rate +=  50 * sc->getSCE(SC__BODYPAINT)->val1;
+	if( sc->getSCE(SC__INVISIBILITY) )
+		aspd_rate += sc->getSCE(SC__INVISIBILITY)->val2 * 10;
+	if( sc->getSCE(SC__GROOMY) )
+		aspd_rate += sc->getSCE(SC__GROOMY)->val2 * 10;
+	if( sc->getSCE(SC_SWINGDANCE) )
+		aspd_rate -= sc->getSCE(SC_SWINGDANCE)->val3 * 10;
+	if( sc->getSCE(SC_DANCEWITHWUG) )
+		aspd_rate -= sc->getSCE(SC_DANCEWITHWUG)->val3 * 10;
+	if( sc->getSCE(SC_GLOOMYDAY) )
+		aspd_rate += sc->getSCE(SC_GLOOMYDAY)->val3 * 10;
+	if( sc->getSCE(SC_GT_CHANGE) )
+		aspd_rate -= sc->getSCE(SC_GT_CHANGE)->val3 * 10;
+	if( sc->getSCE(SC_MELON_BOMB) )
+		aspd_rate += sc->getSCE(SC_MELON_BOMB)->val3 * 10;
+	if( sc->getSCE(SC_BOOST500) )
+		aspd_rate -= sc->getSCE(SC_BOOST500)->val1 *10;
+	if( sc->getSCE(SC_EXTRACT_SALAMINE_JUICE) )
+		aspd_rate -= sc->getSCE(SC_EXTRACT_SALAMINE_JUICE)->val1 * 10;
+	if( sc->getSCE(SC_INCASPDRATE) )
+		aspd_rate -= sc->getSCE(SC_INCASPDRATE)->val1 * 10;
+	if( sc->getSCE(SC_GOLDENE_FERSE))
+		aspd_rate -= sc->getSCE(SC_GOLDENE_FERSE)->val3 * 10;
+	if (sc->getSCE(SC_WIND_INSIGNIA) && sc->getSCE(SC_WIND_INSIGNIA)->val1 == 2)
 		aspd_rate -= 100;
-	if (sc->data[SC_STARSTANCE])
-		aspd_rate -= 10 * sc->data[SC_STARSTANCE]->val2;
+	if (sc->getSCE(SC_STARSTANCE))
+		aspd_rate -= 10 * sc->getSCE(SC_STARSTANCE)->val2;
 
 	return (short)cap_value(aspd_rate,0,SHRT_MAX);
 }
@@ -8230,7 +8230,7 @@ static unsigned short status_calc_dmotion(struct block_list *bl, struct status_c
 		return 0;
 	if (bl->type == BL_PC && ((TBL_PC *)bl)->special_state.no_walk_delay)
 		return 0;
-	if( sc->data[SC_ENDURE] || sc->data[SC_RUN] || sc->data[SC_WUGDASH] )
+	if( sc->getSCE(SC_ENDURE) || sc->getSCE(SC_RUN) || sc->getSCE(SC_WUGDASH) )
 		return 0;
 
 	return (unsigned short)cap_value(dmotion,0,USHRT_MAX);
@@ -8286,18 +8286,18 @@ static unsigned char status_calc_element(struct block_list *bl, struct status_ch
 	if(!sc || !sc->count)
 		return cap_value(element, 0, UCHAR_MAX);
 
-	if(sc->data[SC_FREEZE])
+	if(sc->getSCE(SC_FREEZE))
 		return ELE_WATER;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(sc->getSCE(SC_STONE) && sc->opt1 == OPT1_STONE)
 		return ELE_EARTH;
-	if(sc->data[SC_BENEDICTIO])
+	if(sc->getSCE(SC_BENEDICTIO))
 		return ELE_HOLY;
-	if(sc->data[SC_CHANGEUNDEAD])
+	if(sc->getSCE(SC_CHANGEUNDEAD))
 		return ELE_UNDEAD;
-	if(sc->data[SC_ELEMENTALCHANGE])
-		return sc->data[SC_ELEMENTALCHANGE]->val2;
-	if(sc->data[SC_SHAPESHIFT])
-		return sc->data[SC_SHAPESHIFT]->val2;
+	if(sc->getSCE(SC_ELEMENTALCHANGE))
+		return sc->getSCE(SC_ELEMENTALCHANGE)->val2;
+	if(sc->getSCE(SC_SHAPESHIFT))
+		return sc->getSCE(SC_SHAPESHIFT)->val2;
 
 	return (unsigned char)cap_value(element,0,UCHAR_MAX);
 }
@@ -8314,19 +8314,19 @@ static unsigned char status_calc_element_lv(struct block_list *bl, struct status
 	if(!sc || !sc->count)
 		return cap_value(lv, 1, 4);
 
-	if(sc->data[SC_FREEZE])
+	if(sc->getSCE(SC_FREEZE))
 		return 1;
-	if(sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+	if(sc->getSCE(SC_STONE) && sc->opt1 == OPT1_STONE)
 		return 1;
-	if(sc->data[SC_BENEDICTIO])
+	if(sc->getSCE(SC_BENEDICTIO))
 		return 1;
-	if(sc->data[SC_CHANGEUNDEAD])
+	if(sc->getSCE(SC_CHANGEUNDEAD))
 		return 1;
-	if(sc->data[SC_ELEMENTALCHANGE])
-		return sc->data[SC_ELEMENTALCHANGE]->val1;
-	if(sc->data[SC_SHAPESHIFT])
+	if(sc->getSCE(SC_ELEMENTALCHANGE))
+		return sc->getSCE(SC_ELEMENTALCHANGE)->val1;
+	if(sc->getSCE(SC_SHAPESHIFT))
 		return 1;
-	if(sc->data[SC__INVISIBILITY])
+	if(sc->getSCE(SC__INVISIBILITY))
 		return 1;
 
 	return (unsigned char)cap_value(lv,1,4);
@@ -8343,29 +8343,29 @@ unsigned char status_calc_attack_element(struct block_list *bl, struct status_ch
 {
 	if(!sc || !sc->count)
 		return cap_value(element, 0, UCHAR_MAX);
-	if(sc->data[SC_ENCHANTARMS])
-		return sc->data[SC_ENCHANTARMS]->val1;
-	if(sc->data[SC_WATERWEAPON]
-		|| (sc->data[SC_WATER_INSIGNIA] && sc->data[SC_WATER_INSIGNIA]->val1 == 2) )
+	if(sc->getSCE(SC_ENCHANTARMS))
+		return sc->getSCE(SC_ENCHANTARMS)->val1;
+	if(sc->getSCE(SC_WATERWEAPON)
+		|| (sc->getSCE(SC_WATER_INSIGNIA) && sc->getSCE(SC_WATER_INSIGNIA)->val1 == 2) )
 		return ELE_WATER;
-	if(sc->data[SC_EARTHWEAPON]
-		|| (sc->data[SC_EARTH_INSIGNIA] && sc->data[SC_EARTH_INSIGNIA]->val1 == 2) )
+	if(sc->getSCE(SC_EARTHWEAPON)
+		|| (sc->getSCE(SC_EARTH_INSIGNIA) && sc->getSCE(SC_EARTH_INSIGNIA)->val1 == 2) )
 		return ELE_EARTH;
-	if(sc->data[SC_FIREWEAPON]
-		|| (sc->data[SC_FIRE_INSIGNIA] && sc->data[SC_FIRE_INSIGNIA]->val1 == 2) )
+	if(sc->getSCE(SC_FIREWEAPON)
+		|| (sc->getSCE(SC_FIRE_INSIGNIA) && sc->getSCE(SC_FIRE_INSIGNIA)->val1 == 2) )
 		return ELE_FIRE;
-	if(sc->data[SC_WINDWEAPON]
-		|| (sc->data[SC_WIND_INSIGNIA] && sc->data[SC_WIND_INSIGNIA]->val1 == 2) )
+	if(sc->getSCE(SC_WINDWEAPON)
+		|| (sc->getSCE(SC_WIND_INSIGNIA) && sc->getSCE(SC_WIND_INSIGNIA)->val1 == 2) )
 		return ELE_WIND;
-	if(sc->data[SC_ENCPOISON])
+	if(sc->getSCE(SC_ENCPOISON))
 		return ELE_POISON;
-	if(sc->data[SC_ASPERSIO])
+	if(sc->getSCE(SC_ASPERSIO))
 		return ELE_HOLY;
-	if(sc->data[SC_SHADOWWEAPON])
+	if(sc->getSCE(SC_SHADOWWEAPON))
 		return ELE_DARK;
-	if(sc->data[SC_GHOSTWEAPON] || sc->data[SC__INVISIBILITY])
+	if(sc->getSCE(SC_GHOSTWEAPON) || sc->getSCE(SC__INVISIBILITY))
 		return ELE_GHOST;
-	if(sc->data[SC_TIDAL_WEAPON_OPTION] || sc->data[SC_TIDAL_WEAPON] )
+	if(sc->getSCE(SC_TIDAL_WEAPON_OPTION) || sc->getSCE(SC_TIDAL_WEAPON) )
 		return ELE_WATER;
 	return (unsigned char)cap_value(element,0,UCHAR_MAX);
 }
@@ -8381,13 +8381,13 @@ static enum e_mode status_calc_mode(struct block_list *bl, struct status_change
 {
 	if(!sc || !sc->count)
 		return cap_value(mode, MD_NONE, static_cast<e_mode>(INT_MAX));
-	if(sc->data[SC_MODECHANGE]) {
-		if (sc->data[SC_MODECHANGE]->val2)
-			mode = static_cast<e_mode>((mode&~MD_MASK)|sc->data[SC_MODECHANGE]->val2); // Set mode
-		if (sc->data[SC_MODECHANGE]->val3)
-			mode = static_cast<e_mode>(mode|sc->data[SC_MODECHANGE]->val3); // Add mode
-		if (sc->data[SC_MODECHANGE]->val4)
-			mode = static_cast<e_mode>(mode&~sc->data[SC_MODECHANGE]->val4); // Del mode
+	if(sc->getSCE(SC_MODECHANGE)) {
+		if (sc->getSCE(SC_MODECHANGE)->val2)
+			mode = static_cast<e_mode>((mode&~MD_MASK)|sc->getSCE(SC_MODECHANGE)->val2); // Set mode
+		if (sc->getSCE(SC_MODECHANGE)->val3)
+			mode = static_cast<e_mode>(mode|sc->getSCE(SC_MODECHANGE)->val3); // Add mode
+		if (sc->getSCE(SC_MODECHANGE)->val4)
+			mode = static_cast<e_mode>(mode&~sc->getSCE(SC_MODECHANGE)->val4); // Del mode
 	}
 	return cap_value(mode, MD_NONE, static_cast<e_mode>(INT_MAX));
 }
@@ -8747,7 +8747,7 @@ int status_isdead(struct block_list *bl)
 int status_isimmune(struct block_list *bl)
 {
 	struct status_change *sc =status_get_sc(bl);
-	if (sc && sc->data[SC_HERMODE])
+	if (sc && sc->getSCE(SC_HERMODE))
 		return 100;
 
 	if (bl->type == BL_PC &&
@@ -8969,9 +8969,74 @@ void status_change_init(struct block_list *bl)
 {
 	struct status_change *sc = status_get_sc(bl);
 	nullpo_retv(sc);
+	if( sc->sce_max ){
+		aFree(sc->sce_heap_types);
+		aFree(sc->sce_heap_entries);
+	}
 	memset(sc, 0, sizeof (struct status_change));
 }
 
+/**
+ * Stores the entry of a status change that just started
+ * @param type: Status change (SC_*), must not be active
+ * @param entry: Entry of the status change
+ */
+void status_change::addSCE(enum sc_type type, struct status_change_entry* entry)
+{
+	if( this->sce_count == STATUS_CHANGE_INLINE && !this->sce_max ){ // Move to the heap
+		this->sce_max = STATUS_CHANGE_INLINE * 2;
+		CREATE(this->sce_heap_types, uint16, this->sce_max);
+		CREATE(this->sce_heap_entries, struct status_change_entry*, this->sce_max);
+		memcpy(this->sce_heap_types, this->sce_inline_types, sizeof(this->sce_inline_types));
+		memcpy(this->sce_heap_entries, this->sce_inline_entries, sizeof(this->sce_inline_entries));
+	} else if( this->sce_max && this->sce_count == this->sce_max ){
+		this->sce_max *= 2;
+		RECREATE(this->sce_heap_types, uint16, this->sce_max);
+		RECREATE(this->sce_heap_entries, struct status_change_entry*, this->sce_max);
+	}
+
+	if( this->sce_max ){
+		this->sce_heap_types[this->sce_count] = type;
+		this->sce_heap_entries[this->sce_count] = entry;
+	} else {
+		this->sce_inline_types[this->sce_count] = type;
+		this->sce_inline_entries[this->sce_count] = entry;
+	}
+
+	this->sce_count++;
+	this->sce_bits[type >> 5] |= 1U << (type & 31);
+}
+
+/**
+ * Forgets the entry of a status change that ended, the entry itself is not freed
+ * @param type: Status change (SC_*)
+ */
+void status_change::removeSCE(enum sc_type type)
+{
+	if( !this->getSCE(type) )
+		return;
+
+	uint16* types = this->sce_max ? this->sce_heap_types : this->sce_inline_types;
+	struct status_change_entry** entries = this->sce_max ? this->sce_heap_entries : this->sce_inline_entries;
+	uint16 i;
+
+	ARR_FIND(0, this->sce_count, i, types[i] == type);
+
+	// Keep the array dense by moving the last entry into the gap
+	this->sce_count--;
+	types[i] = types[this->sce_count];
+	entries[i] = entries[this->sce_count];
+	this->sce_bits[type >> 5] &= ~(1U << (type & 31));
+
+	if( this->sce_max && !this->sce_count ){ // Back to the inline arrays
+		aFree(this->sce_heap_types);
+		aFree(this->sce_heap_entries);
+		this->sce_heap_types = nullptr;
+		this->sce_heap_entries = nullptr;
+		this->sce_max = 0;
+	}
+}
+
 /*========================================== [Playtester]
 * Returns the interval for status changes that iterate multiple times
 * through the timer (e.g. those that deal damage in regular intervals)
@@ -9256,22 +9321,22 @@ t_tick status_get_sc_def(struct block_list *src, struct block_list *bl, enum sc_
 	}
 
 	if (sc) {
-		if (sc->data[SC_SCRESIST])
-			sc_def += sc->data[SC_SCRESIST]->val1*100; // Status resist
+		if (sc->getSCE(SC_SCRESIST))
+			sc_def += sc->getSCE(SC_SCRESIST)->val1*100; // Status resist
 #ifdef RENEWAL
-		else if (sc->data[SC_SIEGFRIED] && (type == SC_BLIND || type == SC_STONE || type == SC_FREEZE || type == SC_STUN || type == SC_CURSE || type == SC_SLEEP || type == SC_SILENCE))
-			sc_def += sc->data[SC_SIEGFRIED]->val3 * 100; // Status resistance.
+		else if (sc->getSCE(SC_SIEGFRIED) && (type == SC_BLIND || type == SC_STONE || type == SC_FREEZE || type == SC_STUN || type == SC_CURSE || type == SC_SLEEP || type == SC_SILENCE))
+			sc_def += sc->getSCE(SC_SIEGFRIED)->val3 * 100; // Status resistance.
 #else
-		else if (sc->data[SC_SIEGFRIED])
-			sc_def += sc->data[SC_SIEGFRIED]->val3*100; // Status resistance.
+		else if (sc->getSCE(SC_SIEGFRIED))
+			sc_def += sc->getSCE(SC_SIEGFRIED)->val3*100; // Status resistance.
 #endif
-		else if (sc->data[SC_LEECHESEND] && sc->data[SC_LEECHESEND]->val3 == 0) {
+		else if (sc->getSCE(SC_LEECHESEND) && sc->getSCE(SC_LEECHESEND)->val3 == 0) {
 			switch (type) {
 				case SC_BLIND:
 				case SC_STUN:
 					return 0; // Immune
 			}
-		} else if (sc->data[SC_OBLIVIONCURSE] && sc->data[SC_OBLIVIONCURSE]->val3 == 0) {
+		} else if (sc->getSCE(SC_OBLIVIONCURSE) && sc->getSCE(SC_OBLIVIONCURSE)->val3 == 0) {
 			switch (type) {
 				case SC_SILENCE:
 				case SC_CURSE:
@@ -9302,8 +9367,8 @@ t_tick status_get_sc_def(struct block_list *src, struct block_list *bl, enum sc_
 				if (it.id == type)
 					rate -= rate * it.val / 10000;
 			}
-			if (sd->sc.data[SC_COMMONSC_RESIST] && SC_COMMON_MIN <= type && type <= SC_COMMON_MAX)
-				rate -= rate*sd->sc.data[SC_COMMONSC_RESIST]->val1/100;
+			if (sd->sc.getSCE(SC_COMMONSC_RESIST) && SC_COMMON_MIN <= type && type <= SC_COMMON_MAX)
+				rate -= rate*sd->sc.getSCE(SC_COMMONSC_RESIST)->val1/100;
 		}
 
 		// Aegis accuracy
@@ -9516,14 +9581,14 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 	if (status_change_isDisabledOnMap(type, map_getmapdata(bl->m)))
 		return 0;
 
-	if (sc->data[SC_GRAVITYCONTROL])
+	if (sc->getSCE(SC_GRAVITYCONTROL))
 		return 0; // !TODO: Confirm what statuses/conditions (if not all) are blocked.
 
 	// Uncomment to prevent status adding hp to gvg mob (like bloodylust=hp*3 etc...
 //	if (bl->type == BL_MOB)
 //		if (util::vector_exists(status_get_race2(bl), RC2_GVG) && status_sc2scb_flag(type)&SCB_MAXHP) return 0;
 
-	if( sc->data[SC_REFRESH] ) {
+	if( sc->getSCE(SC_REFRESH) ) {
 		if( type >= SC_COMMON_MIN && type <= SC_COMMON_MAX) // Confirmed.
 			return 0; // Immune to status ailments
 		switch( type ) {
@@ -9543,7 +9608,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 				return 0;
 		}
 	}
-	if( sc->data[SC_INSPIRATION] ) {
+	if( sc->getSCE(SC_INSPIRATION) ) {
 		if( type >= SC_COMMON_MIN && type <= SC_COMMON_MAX )
 			return 0; // Immune to status ailments
 		switch( type ) {
@@ -9571,7 +9636,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 				return 0;
 		}
 	}
-	if( sc->data[SC_KINGS_GRACE] ) {
+	if( sc->getSCE(SC_KINGS_GRACE) ) {
 		if( type >= SC_COMMON_MIN && type <= SC_COMMON_MAX )
 			return 0; // Immune to status ailments
 		switch( type ) {
@@ -9618,25 +9683,25 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 	case SC_QUAGMIRE:
 	case SC_DONTFORGETME:
 	case SC_CREATINGSTAR:
-		if(sc->data[SC_SPEEDUP1])
+		if(sc->getSCE(SC_SPEEDUP1))
 			return 0;
 		break;
 	case SC_ANGRIFFS_MODUS:
 	case SC_GOLDENE_FERSE:
-		if ((type==SC_GOLDENE_FERSE && sc->data[SC_ANGRIFFS_MODUS])
-		|| (type==SC_ANGRIFFS_MODUS && sc->data[SC_GOLDENE_FERSE])
+		if ((type==SC_GOLDENE_FERSE && sc->getSCE(SC_ANGRIFFS_MODUS))
+		|| (type==SC_ANGRIFFS_MODUS && sc->getSCE(SC_GOLDENE_FERSE))
 		)
 			return 0;
 	case SC_VACUUM_EXTREME:
-		if (sc && (sc->data[SC_HALLUCINATIONWALK] || sc->data[SC_NPC_HALLUCINATIONWALK] || sc->data[SC_HOVERING] || sc->data[SC_VACUUM_EXTREME] ||
-			(sc->data[SC_VACUUM_EXTREME_POSTDELAY] && sc->data[SC_VACUUM_EXTREME_POSTDELAY]->val2 == val2))) // Ignore post delay from other vacuum (this will make stack effect enabled)
+		if (sc && (sc->getSCE(SC_HALLUCINATIONWALK) || sc->getSCE(SC_NPC_HALLUCINATIONWALK) || sc->getSCE(SC_HOVERING) || sc->getSCE(SC_VACUUM_EXTREME) ||
+			(sc->getSCE(SC_VACUUM_EXTREME_POSTDELAY) && sc->getSCE(SC_VACUUM_EXTREME_POSTDELAY)->val2 == val2))) // Ignore post delay from other vacuum (this will make stack effect enabled)
 			return 0;
 		break;
 	case SC_STONE:
 		// Undead are immune to Stone
 		if (undead_flag && !(flag&SCSTART_NOAVOID))
 			return 0;
-		if (sc->data[SC_POWER_OF_GAIA] || sc->data[SC_GVG_STONE])
+		if (sc->getSCE(SC_POWER_OF_GAIA) || sc->getSCE(SC_GVG_STONE))
 			return 0;
 		if (sc->opt1)
 			return 0; //Cannot override other OPT1 status changes [Skotlex]
@@ -9645,18 +9710,18 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		// Undead are immune to Freeze
 		if (undead_flag && !(flag&SCSTART_NOAVOID))
 			return 0;
-		if (sc->data[SC_GVG_FREEZ] || sc->data[SC_WARMER])
+		if (sc->getSCE(SC_GVG_FREEZ) || sc->getSCE(SC_WARMER))
 			return 0;
 		if (sc->opt1)
 			return 0; // Cannot override other opt1 status changes. [Skotlex]
 		break;
 	case SC_FREEZING:
 	case SC_CRYSTALIZE:
-		if (sc->data[SC_WARMER])
+		if (sc->getSCE(SC_WARMER))
 			return 0; // Immune to Frozen and Freezing status if under Warmer status. [Jobbie]
 		break;
 	case SC_SLEEP:
-		if (sc->data[SC_GVG_SLEEP])
+		if (sc->getSCE(SC_GVG_SLEEP))
 			return 0;
 		if (sc->opt1)
 			return 0; // Cannot override other opt1 status changes. [Skotlex]
@@ -9664,27 +9729,27 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 	case SC_STUN:
 		if (sc->opt1)
 			return 0; // Cannot override other opt1 status changes. [Skotlex]
-		if (sc->data[SC_GVG_STUN])
+		if (sc->getSCE(SC_GVG_STUN))
 			return 0;
 		break;
 	case SC_BLIND:
-		if (sc->data[SC_FEAR])
+		if (sc->getSCE(SC_FEAR))
 			return 0;
-		if (sc->data[SC_GVG_BLIND])
+		if (sc->getSCE(SC_GVG_BLIND))
 			return 0;
 		break;
 	case SC_CURSE:
-		if (sc->data[SC_GVG_CURSE])
+		if (sc->getSCE(SC_GVG_CURSE))
 			return 0;
 		break;
 	case SC_SILENCE:
-		if (sc->data[SC_GVG_SILENCE])
+		if (sc->getSCE(SC_GVG_SILENCE))
 			return 0;
 		break;
 	case SC_ALL_RIDING:
 		if( !sd || sc->option&(OPTION_RIDING|OPTION_DRAGON|OPTION_WUGRIDER|OPTION_MADOGEAR) )
 			return 0;
-		if( sc->data[type] )
+		if( sc->getSCE(type) )
 		{	// Already mounted, just dismount.
 			status_change_end(bl, SC_ALL_RIDING, INVALID_TIMER);
 			return 0;
@@ -9692,7 +9757,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		break;
 	// They're all like berserk, do not everlap each other
 	case SC_BERSERK:
-		if(sc->data[SC_SATURDAYNIGHTFEVER])
+		if(sc->getSCE(SC_SATURDAYNIGHTFEVER))
 			return 0;
 		break;
 	// Fall through
@@ -9706,7 +9771,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 			return 0;
 	break;
 	case SC_AETERNA:
-		if( (sc->data[SC_STONE] && sc->opt1 == OPT1_STONE) || sc->data[SC_FREEZE] )
+		if( (sc->getSCE(SC_STONE) && sc->opt1 == OPT1_STONE) || sc->getSCE(SC_FREEZE) )
 			return 0;
 	break;
 	case SC_KYRIE:
@@ -9715,12 +9780,12 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 			return 0;
 	break;
 	case SC_OVERTHRUST:
-		if (sc->data[SC_MAXOVERTHRUST])
+		if (sc->getSCE(SC_MAXOVERTHRUST))
 			return 0; // Overthrust can't take effect if under Max Overthrust. [Skotlex]
 	break;
 	case SC_ADRENALINE:
 	case SC_ADRENALINE2:
-		if (sc->data[SC_QUAGMIRE] || sc->data[SC_DECREASEAGI])
+		if (sc->getSCE(SC_QUAGMIRE) || sc->getSCE(SC_DECREASEAGI))
 			return 0;
 	break;
 	case SC_MAGNIFICAT:
@@ -9730,7 +9795,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 	case SC_ONEHAND:
 	case SC_MERC_QUICKEN:
 	case SC_TWOHANDQUICKEN:
-		if(sc->data[SC_DECREASEAGI])
+		if(sc->getSCE(SC_DECREASEAGI))
 			return 0;
 	case SC_INCREASEAGI:
 	case SC_CONCENTRATE:
@@ -9741,7 +9806,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		if (sc->option&OPTION_MADOGEAR)
 			return 0; // Mado is immune to the above [Ind]
 	case SC_CARTBOOST:
-		if (sc->data[SC_QUAGMIRE])
+		if (sc->getSCE(SC_QUAGMIRE))
 			return 0;
 	break;
 	case SC_CLOAKING:
@@ -9753,7 +9818,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 			return 0;
 	break;
 	case SC_NEWMOON:
- 		if (sc->data[SC_BITE])
+ 		if (sc->getSCE(SC_BITE))
  			return 0;
  	break;
 	case SC_MODECHANGE:
@@ -9761,16 +9826,16 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		enum e_mode mode;
 		struct status_data *bstatus = status_get_base_status(bl);
 		if (!bstatus) return 0;
-		if (sc->data[type]) { // Pile up with previous values.
-			if(!val2) val2 = sc->data[type]->val2;
-			val3 |= sc->data[type]->val3;
-			val4 |= sc->data[type]->val4;
+		if (sc->getSCE(type)) { // Pile up with previous values.
+			if(!val2) val2 = sc->getSCE(type)->val2;
+			val3 |= sc->getSCE(type)->val3;
+			val4 |= sc->getSCE(type)->val4;
 		}
 		mode = val2 ? static_cast<e_mode>((val2&~MD_MASK)|val2) : bstatus->mode; // Base mode
 		if (val4) mode = static_cast<e_mode>(mode&~val4); // Del mode
 		if (val3) mode = static_cast<e_mode>(mode|val3); // Add mode
 		if (mode == bstatus->mode) { // No change.
-			if (sc->data[type]) // Abort previous status
+			if (sc->getSCE(type)) // Abort previous status
 				return status_change_end(bl, type, INVALID_TIMER);
 			return 0;
 		}
@@ -9847,51 +9912,51 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 			return 0; // Stats only for Mercenaries
 	break;
 	case SC_STRFOOD:
-		if (sc->data[SC_FOOD_STR_CASH] && sc->data[SC_FOOD_STR_CASH]->val1 > val1)
+		if (sc->getSCE(SC_FOOD_STR_CASH) && sc->getSCE(SC_FOOD_STR_CASH)->val1 > val1)
 			return 0;
 	break;
 	case SC_AGIFOOD:
-		if (sc->data[SC_FOOD_AGI_CASH] && sc->data[SC_FOOD_AGI_CASH]->val1 > val1)
+		if (sc->getSCE(SC_FOOD_AGI_CASH) && sc->getSCE(SC_FOOD_AGI_CASH)->val1 > val1)
 			return 0;
 	break;
 	case SC_VITFOOD:
-		if (sc->data[SC_FOOD_VIT_CASH] && sc->data[SC_FOOD_VIT_CASH]->val1 > val1)
+		if (sc->getSCE(SC_FOOD_VIT_CASH) && sc->getSCE(SC_FOOD_VIT_CASH)->val1 > val1)
 			return 0;
 	break;
 	case SC_INTFOOD:
-		if (sc->data[SC_FOOD_INT_CASH] && sc->data[SC_FOOD_INT_CASH]->val1 > val1)
+		if (sc->getSCE(SC_FOOD_INT_CASH) && sc->getSCE(SC_FOOD_INT_CASH)->val1 > val1)
 			return 0;
 	break;
 	case SC_DEXFOOD:
-		if (sc->data[SC_FOOD_DEX_CASH] && sc->data[SC_FOOD_DEX_CASH]->val1 > val1)
+		if (sc->getSCE(SC_FOOD_DEX_CASH) && sc->getSCE(SC_FOOD_DEX_CASH)->val1 > val1)
 			return 0;
 	break;
 	case SC_LUKFOOD:
-		if (sc->data[SC_FOOD_LUK_CASH] && sc->data[SC_FOOD_LUK_CASH]->val1 > val1)
+		if (sc->getSCE(SC_FOOD_LUK_CASH) && sc->getSCE(SC_FOOD_LUK_CASH)->val1 > val1)
 			return 0;
 	break;
 	case SC_FOOD_STR_CASH:
-		if ((sc->data[SC_STRFOOD] && sc->data[SC_STRFOOD]->val1 > val1) || sc->data[SC_2011RWC_SCROLL])
+		if ((sc->getSCE(SC_STRFOOD) && sc->getSCE(SC_STRFOOD)->val1 > val1) || sc->getSCE(SC_2011RWC_SCROLL))
 			return 0;
 	break;
 	case SC_FOOD_AGI_CASH:
-		if ((sc->data[SC_AGIFOOD] && sc->data[SC_AGIFOOD]->val1 > val1) || sc->data[SC_2011RWC_SCROLL])
+		if ((sc->getSCE(SC_AGIFOOD) && sc->getSCE(SC_AGIFOOD)->val1 > val1) || sc->getSCE(SC_2011RWC_SCROLL))
 			return 0;
 	break;
 	case SC_FOOD_VIT_CASH:
-		if ((sc->data[SC_VITFOOD] && sc->data[SC_VITFOOD]->val1 > val1) || sc->data[SC_2011RWC_SCROLL])
+		if ((sc->getSCE(SC_VITFOOD) && sc->getSCE(SC_VITFOOD)->val1 > val1) || sc->getSCE(SC_2011RWC_SCROLL))
 			return 0;
 	break;
 	case SC_FOOD_INT_CASH:
-		if ((sc->data[SC_INTFOOD] && sc->data[SC_INTFOOD]->val1 > val1) || sc->data[SC_2011RWC_SCROLL])
+		if ((sc->getSCE(SC_INTFOOD) && sc->getSCE(SC_INTFOOD)->val1 > val1) || sc->getSCE(SC_2011RWC_SCROLL))
 			return 0;
 	break;
 	case SC_FOOD_DEX_CASH:
-		if ((sc->data[SC_DEXFOOD] && sc->data[SC_DEXFOOD]->val1 > val1) || sc->data[SC_2011RWC_SCROLL])
+		if ((sc->getSCE(SC_DEXFOOD) && sc->getSCE(SC_DEXFOOD)->val1 > val1) || sc->getSCE(SC_2011RWC_SCROLL))
 			return 0;
 	break;
 	case SC_FOOD_LUK_CASH:
-		if ((sc->data[SC_LUKFOOD] && sc->data[SC_LUKFOOD]->val1 > val1) || sc->data[SC_2011RWC_SCROLL])
+		if ((sc->getSCE(SC_LUKFOOD) && sc->getSCE(SC_LUKFOOD)->val1 > val1) || sc->getSCE(SC_2011RWC_SCROLL))
 			return 0;
 	break;
 	case SC_CAMOUFLAGE:
@@ -9927,45 +9992,45 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		if (val3 == 0) // Don't display icon on self
 			flag |= SCSTART_NOICON;
 		for (int32 i = SC_TOXIN; i <= SC_LEECHESEND; i++) {
-			if (sc->data[i] && sc->data[i]->val3 == 1) // It doesn't stack or even renew on the target
+			if (sc->getSCE(i) && sc->getSCE(i)->val3 == 1) // It doesn't stack or even renew on the target
 				return 0;
-			else if (sc->data[i] && sc->data[i]->val3 == 0)
+			else if (sc->getSCE(i) && sc->getSCE(i)->val3 == 0)
 				status_change_end(bl, static_cast<sc_type>(i), INVALID_TIMER); // End the bonus part on the caster
 		}
 		break;
 	case SC_SATURDAYNIGHTFEVER:
-		if (sc->data[SC_BERSERK] || sc->data[SC_INSPIRATION])
+		if (sc->getSCE(SC_BERSERK) || sc->getSCE(SC_INSPIRATION))
 			return 0;
 		break;
 	case SC_MAGNETICFIELD: // This skill does not affect players using Hover. [Lighta]
-		if(sc->data[SC_HOVERING])
+		if(sc->getSCE(SC_HOVERING))
 			return 0;
 		break;
 	case SC_HEAT_BARREL:
 		//kRO Update 2014-02-12
 		//- Cannot be stacked with Platinum Alter and Madness Canceler [Cydh]
-		if (sc->data[SC_P_ALTER] || sc->data[SC_MADNESSCANCEL])
+		if (sc->getSCE(SC_P_ALTER) || sc->getSCE(SC_MADNESSCANCEL))
 			return 0;
 		break;
 	case SC_P_ALTER:
-		if (sc->data[SC_HEAT_BARREL] || sc->data[SC_MADNESSCANCEL])
+		if (sc->getSCE(SC_HEAT_BARREL) || sc->getSCE(SC_MADNESSCANCEL))
 			return 0;
 		break;
 	case SC_MADNESSCANCEL:
-		if (sc->data[type]) { // Toggle the status but still consume requirements.
+		if (sc->getSCE(type)) { // Toggle the status but still consume requirements.
 			status_change_end(bl, type, INVALID_TIMER);
 			return 0;
 		}
-		if (sc->data[SC_P_ALTER] || sc->data[SC_HEAT_BARREL])
+		if (sc->getSCE(SC_P_ALTER) || sc->getSCE(SC_HEAT_BARREL))
 			return 0;
 		break;
 	case SC_KINGS_GRACE:
-		if (sc->data[SC_DEVOTION] || sc->data[SC_WHITEIMPRISON])
+		if (sc->getSCE(SC_DEVOTION) || sc->getSCE(SC_WHITEIMPRISON))
 			return 0;
 		break;
 	case SC_GROOMING:
 	case SC_CHATTERING:
-		if (sc->data[type])
+		if (sc->getSCE(type))
 			return 0;
 
 	case SC_WEDDING:
@@ -10053,19 +10118,19 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		// !TODO: Blessing and Agi up should do 1 damage against players on Undead Status, even on PvM
 		// !but cannot be plagiarized (this requires aegis investigation on packets and official behavior) [Brainstorm]
 		if ((!undead_flag && status->race != RC_DEMON) || bl->type == BL_PC) {
-			if (sc->data[SC_STONE] && sc->opt1 == OPT1_STONE)
+			if (sc->getSCE(SC_STONE) && sc->opt1 == OPT1_STONE)
 				status_change_end(bl, SC_STONE, INVALID_TIMER);
-			if (sc->data[SC_CURSE]) {
+			if (sc->getSCE(SC_CURSE)) {
 					status_change_end(bl, SC_CURSE, INVALID_TIMER);
 					return 1; // End Curse and do not give stat boost
 			}
 		}
-		if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
+		if(sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_HIGH)
 			status_change_end(bl, SC_SPIRIT, INVALID_TIMER);
 		break;
 	case SC_INCREASEAGI:
 		status_change_end(bl, SC_DECREASEAGI, INVALID_TIMER);
-		if(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_HIGH)
+		if(sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_HIGH)
 			status_change_end(bl, SC_SPIRIT, INVALID_TIMER);
 		break;
 	case SC_QUAGMIRE:
@@ -10156,7 +10221,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 	case SC_LUNARSTANCE:
 	case SC_STARSTANCE:
 	case SC_UNIVERSESTANCE:
-		if (sc->data[type])
+		if (sc->getSCE(type))
 			break;
 		status_change_end(bl, SC_SUNSTANCE, INVALID_TIMER);
 		status_change_end(bl, SC_LUNARSTANCE, INVALID_TIMER);
@@ -10168,7 +10233,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 	case SC_SOULSHADOW:
 	case SC_SOULFALCON:
 	case SC_SOULFAIRY:
-		if (sc->data[type])
+		if (sc->getSCE(type))
 			break;
 		status_change_end(bl, SC_SPIRIT, INVALID_TIMER);
 		status_change_end(bl, SC_SOULGOLEM, INVALID_TIMER);
@@ -10205,11 +10270,11 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		break;
 #endif
 	case SC_DELUGE:
-		if (sc->data[SC_FOGWALL] && sc->data[SC_BLIND])
+		if (sc->getSCE(SC_FOGWALL) && sc->getSCE(SC_BLIND))
 			status_change_end(bl, SC_BLIND, INVALID_TIMER);
 		break;
 	case SC_SILENCE:
-		if (sc->data[SC_GOSPEL] && sc->data[SC_GOSPEL]->val4 == BCT_SELF)
+		if (sc->getSCE(SC_GOSPEL) && sc->getSCE(SC_GOSPEL)->val4 == BCT_SELF)
 			status_change_end(bl, SC_GOSPEL, INVALID_TIMER);
 		break;
 	case SC_FREEZE:
@@ -10247,7 +10312,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		break;
 	case SC_GN_CARTBOOST:
 	case SC_CARTBOOST:
-		if(sc->data[SC_DECREASEAGI]) { // Cancel Decrease Agi, but take no further effect [Skotlex]
+		if(sc->getSCE(SC_DECREASEAGI)) { // Cancel Decrease Agi, but take no further effect [Skotlex]
 			status_change_end(bl, SC_DECREASEAGI, INVALID_TIMER);
 			return 0;
 		}
@@ -10255,7 +10320,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		//since Cart Boost don't cancel Slow Grace effect
 		//http://irowiki.org/wiki/Cart_Boost_%28Genetic%29 (view date: 2014-01-26)
 		//http://irowiki.org/wiki/Cart_Boost (view date: 2014-01-26)
-		if(sc->data[SC_DONTFORGETME])
+		if(sc->getSCE(SC_DONTFORGETME))
 			return 0;
 		break;
 	case SC_FUSION:
@@ -10354,8 +10419,8 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		if (type != SC_SONGOFMANA) status_change_end(bl, SC_SONGOFMANA, INVALID_TIMER);
 		if (type != SC_DANCEWITHWUG) status_change_end(bl, SC_DANCEWITHWUG, INVALID_TIMER);
 		if (type != SC_SATURDAYNIGHTFEVER) {
-			if (sc->data[SC_SATURDAYNIGHTFEVER]) {
-				sc->data[SC_SATURDAYNIGHTFEVER]->val2 = 0; // Mark to not lose hp
+			if (sc->getSCE(SC_SATURDAYNIGHTFEVER)) {
+				sc->getSCE(SC_SATURDAYNIGHTFEVER)->val2 = 0; // Mark to not lose hp
 				status_change_end(bl, SC_SATURDAYNIGHTFEVER, INVALID_TIMER);
 			}
 		}
@@ -10459,7 +10524,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 	}
 
 	// Check for overlapping fails
-	if( (sce = sc->data[type]) ) {
+	if( (sce = sc->getSCE(type)) ) {
 		switch( type ) {
 			case SC_MERC_FLEEUP:
 			case SC_MERC_ATKUP:
@@ -10587,7 +10652,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 				val4 = sce->val4;
 				break;
 			case SC_LERADSDEW:
-				if (sc && sc->data[SC_BERSERK])
+				if (sc && sc->getSCE(SC_BERSERK))
 					return 0;
 			case SC_SHAPESHIFT:
 			case SC_PROPERTYWALK:
@@ -10600,7 +10665,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 					return 0;
 				break;
 			case SC_JOINTBEAT:
-				if (sc && sc->data[type]->val2 & BREAK_NECK)
+				if (sc && sc->getSCE(type)->val2 & BREAK_NECK)
 					return 0; // BREAK_NECK cannot be stacked with new breaks until the status is over.
 				val2 |= sce->val2; // Stackable ailments
 			default:
@@ -10647,7 +10712,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 			if (type == SC_ADORAMUS) {
 				// 1000% base chance to blind, but still can be resisted
 				sc_start(src, bl, SC_BLIND, 1000, val1, skill_get_time(status_sc2skill(type), val1));
-				if (sc->data[SC_ADORAMUS])
+				if (sc->getSCE(SC_ADORAMUS))
 					return 0; //Adoramus can't refresh itself, but it can cause blind again
 			}
 			val2 = 2 + val1; // Agi change
@@ -10671,7 +10736,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 			break;
 		case SC_AUTOBERSERK:
 			if (status->hp < status->max_hp>>2 &&
-				(!sc->data[SC_PROVOKE] || sc->data[SC_PROVOKE]->val2==0))
+				(!sc->getSCE(SC_PROVOKE) || sc->getSCE(SC_PROVOKE)->val2==0))
 					sc_start4(src,bl,SC_PROVOKE,100,10,1,0,0,60000);
 			tick = INFINITE_TICK;
 			break;
@@ -11058,7 +11123,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		case SC_CHASEWALK:
 			val2 = tick>0?tick:10000; // Interval at which SP is drained.
 			val3 = 35 - 5 * val1; // Speed adjustment.
-			if (sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_ROGUE)
+			if (sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_ROGUE)
 				val3 -= 40;
 			val4 = 10+val1*2; // SP cost.
 			if (map_flag_gvg2(bl->m) || map_getmapflag(bl->m, MF_BATTLEGROUND)) val4 *= 5;
@@ -11189,7 +11254,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 			// Fetch caster information
 			struct block_list *pbl = map_id2bl(val1);
 			struct status_change *psc = pbl?status_get_sc(pbl):NULL;
-			struct status_change_entry *psce = psc?psc->data[SC_MARIONETTE]:NULL;
+			struct status_change_entry *psce = psc?psc->getSCE(SC_MARIONETTE):NULL;
 			// Fetch target's stats
 			struct status_data* status2 = status_get_status_data(bl); // Battle status
 
@@ -11261,8 +11326,8 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 				int i = (map_flag_gvg2(bl->m) || map_getmapflag(bl->m, MF_BATTLEGROUND))?2:3;
 				while( i >= 0 ) {
 					enum sc_type type2 = types[i];
-					if( d_sc->data[type2] )
-						status_change_start(d_bl, bl, type2, 10000, d_sc->data[type2]->val1, 0, 0, (type2 == SC_REFLECTSHIELD ? 1 : 0), skill_get_time(status_sc2skill(type2),d_sc->data[type2]->val1), (type2 == SC_DEFENDER) ? SCSTART_NOAVOID : SCSTART_NOAVOID|SCSTART_NOICON);
+					if( d_sc->getSCE(type2) )
+						status_change_start(d_bl, bl, type2, 10000, d_sc->getSCE(type2)->val1, 0, 0, (type2 == SC_REFLECTSHIELD ? 1 : 0), skill_get_time(status_sc2skill(type2),d_sc->getSCE(type2)->val1), (type2 == SC_DEFENDER) ? SCSTART_NOAVOID : SCSTART_NOAVOID|SCSTART_NOICON);
 					i--;
 				}
 			}
@@ -11277,7 +11342,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		{
 			struct block_list *src2 = val2?map_id2bl(val2):NULL;
 			struct status_change *sc2 = src2?status_get_sc(src2):NULL;
-			struct status_change_entry *sce2 = sc2?sc2->data[SC_CLOSECONFINE]:NULL;
+			struct status_change_entry *sce2 = sc2?sc2->getSCE(SC_CLOSECONFINE):NULL;
 
 			if (src2 && sc2) {
 				if (!sce2) // Start lock on caster.
@@ -12201,7 +12266,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 			break;
 		case SC_PAIN_KILLER: // Yommy leak need confirm
 			val2 = min((( 200 * val1 ) * status_get_lv(src)) / 150, 1000); // dmg reduction linear. upto a maximum of 1000 [iRO Wiki]
-			if(sc->data[SC_PARALYSIS])
+			if(sc->getSCE(SC_PARALYSIS))
 				sc_start(src,bl, SC_ENDURE, 100, val1, tick); // Start endure for same duration
 			break;
 		case SC_STYLE_CHANGE:
@@ -12746,7 +12811,7 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		case SC_FREEZE:
 		case SC_STUN:
 		case SC_GRAVITYCONTROL:
-			if (sc->data[SC_DANCING])
+			if (sc->getSCE(SC_DANCING))
 				unit_stop_walking(bl, 1);
 		case SC_TRICKDEAD:
 			status_change_end(bl, SC_DANCING, INVALID_TIMER);
@@ -13047,13 +13112,14 @@ int status_change_start(struct block_list* src, struct block_list* bl,enum sc_ty
 		tick = tick_time;
 
 	// Don't trust the previous sce assignment, in case the SC ended somewhere between there and here.
-	if((sce=sc->data[type])) { // reuse old sc
+	if((sce=sc->getSCE(type))) { // reuse old sc
 		if( sce->timer != INVALID_TIMER )
 			delete_timer(sce->timer, status_change_timer);
 		sc_isnew = false;
 	} else { // New sc
 		++(sc->count);
-		sce = sc->data[type] = ers_alloc(sc_data_ers, struct status_change_entry);
+		sce = ers_alloc(sc_data_ers, struct status_change_entry);
+		sc->addSCE(type, sce);
 	}
 	sce->val1 = val1;
 	sce->val2 = val2;
@@ -13203,13 +13269,13 @@ int status_change_clear(struct block_list* bl, int type)
 		return 0;
 
 	for(i = 0; i < SC_MAX; i++) {
-		if(!sc->data[i])
+		if(!sc->getSCE(i))
 			continue;
 
 		if(type == 0) {
 			switch (i) { // Type 0: PC killed -> Place here statuses that do not dispel on death.
 			case SC_ELEMENTALCHANGE: // Only when its Holy or Dark that it doesn't dispell on death
-				if( sc->data[i]->val2 != ELE_HOLY && sc->data[i]->val2 != ELE_DARK )
+				if( sc->getSCE(i)->val2 != ELE_HOLY && sc->getSCE(i)->val2 != ELE_DARK )
 					break;
 			case SC_WEIGHT50:
 			case SC_WEIGHT90:
@@ -13384,12 +13450,12 @@ int status_change_clear(struct block_list* bl, int type)
 
 		status_change_end(bl, (sc_type)i, INVALID_TIMER);
 
-		if( type == 1 && sc->data[i] ) { // If for some reason status_change_end decides to still keep the status when quitting. [Skotlex]
+		if( type == 1 && sc->getSCE(i) ) { // If for some reason status_change_end decides to still keep the status when quitting. [Skotlex]
 			(sc->count)--;
-			if (sc->data[i]->timer != INVALID_TIMER)
-				delete_timer(sc->data[i]->timer, status_change_timer);
-			ers_free(sc_data_ers, sc->data[i]);
-			sc->data[i] = NULL;
+			if (sc->getSCE(i)->timer != INVALID_TIMER)
+				delete_timer(sc->getSCE(i)->timer, status_change_timer);
+			ers_free(sc_data_ers, sc->getSCE(i));
+			sc->removeSCE((sc_type)i);
 		}
 	}
 
@@ -13426,7 +13492,7 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 	sc = status_get_sc(bl);
 	status = status_get_status_data(bl);
 
-	if(type < 0 || type >= SC_MAX || !sc || !(sce = sc->data[type]))
+	if(type < 0 || type >= SC_MAX || !sc || !(sce = sc->getSCE(type)))
 		return 0;
 
 	sd = BL_CAST(BL_PC,bl);
@@ -13501,7 +13567,7 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 	if ( StatusChangeStateTable[type] )
 		status_calc_state(bl,sc,( enum scs_flag ) StatusChangeStateTable[type],false);
 
-	sc->data[type] = NULL;
+	sc->removeSCE(type);
 
 	if (StatusDisplayType[type]&bl->type)
 		status_display_remove(bl,type);
@@ -13548,7 +13614,7 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 		}
 		break;
 		case SC_AUTOBERSERK:
-			if (sc->data[SC_PROVOKE] && sc->data[SC_PROVOKE]->val2 == 1)
+			if (sc->getSCE(SC_PROVOKE) && sc->getSCE(SC_PROVOKE)->val2 == 1)
 				status_change_end(bl, SC_PROVOKE, INVALID_TIMER);
 			break;
 
@@ -13561,13 +13627,13 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 				if( bl->type == BL_PC ) { // Clear Status from others
 					int i;
 					for( i = 0; i < MAX_DEVOTION; i++ ) {
-						if( sd->devotion[i] && (tsd = map_id2sd(sd->devotion[i])) && tsd->sc.data[type] )
+						if( sd->devotion[i] && (tsd = map_id2sd(sd->devotion[i])) && tsd->sc.getSCE(type) )
 							status_change_end(&tsd->bl, type, INVALID_TIMER);
 					}
 				}
 				else if( bl->type == BL_MER && ((TBL_MER*)bl)->devotion_flag ) { // Clear Status from Master
 					tsd = ((TBL_MER*)bl)->master;
-					if( tsd && tsd->sc.data[type] )
+					if( tsd && tsd->sc.getSCE(type) )
 						status_change_end(&tsd->bl, type, INVALID_TIMER);
 				}
 			}
@@ -13616,8 +13682,8 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 				struct block_list *tbl = map_id2bl(tid2);
 				struct status_change *tsc = status_get_sc(tbl);
 				sce->val4 = 0;
-				if(tbl && tsc && tsc->data[SC_BLADESTOP]) {
-					tsc->data[SC_BLADESTOP]->val4 = 0;
+				if(tbl && tsc && tsc->getSCE(SC_BLADESTOP)) {
+					tsc->getSCE(SC_BLADESTOP)->val4 = 0;
 					status_change_end(tbl, SC_BLADESTOP, INVALID_TIMER);
 				}
 				clif_bladestop(bl, tid2, 0);
@@ -13629,7 +13695,7 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 				struct status_change_entry *dsc;
 
 				if(sce->val4 && sce->val4 != BCT_SELF && (dsd=map_id2sd(sce->val4))) { // End status on partner as well
-					dsc = dsd->sc.data[SC_DANCING];
+					dsc = dsd->sc.getSCE(SC_DANCING);
 					if(dsc) {
 						// This will prevent recursive loops.
 						dsc->val2 = dsc->val4 = 0;
@@ -13673,10 +13739,10 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 		case SC_CLOSECONFINE2:{
 			struct block_list *src = sce->val2?map_id2bl(sce->val2):NULL;
 			struct status_change *sc2 = src?status_get_sc(src):NULL;
-			if (src && sc2 && sc2->data[SC_CLOSECONFINE]) {
+			if (src && sc2 && sc2->getSCE(SC_CLOSECONFINE)) {
 				// If status was already ended, do nothing.
 				// Decrease count
-				if (--(sc2->data[SC_CLOSECONFINE]->val1) <= 0) // No more holds, free him up.
+				if (--(sc2->getSCE(SC_CLOSECONFINE)->val1) <= 0) // No more holds, free him up.
 					status_change_end(src, SC_CLOSECONFINE, INVALID_TIMER);
 			}
 		}
@@ -13700,25 +13766,25 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 				struct block_list *pbl = map_id2bl(sce->val1);
 				struct status_change* sc2 = pbl?status_get_sc(pbl):NULL;
 
-				if (sc2 && sc2->data[type2]) {
-					sc2->data[type2]->val1 = 0;
+				if (sc2 && sc2->getSCE(type2)) {
+					sc2->getSCE(type2)->val1 = 0;
 					status_change_end(pbl, type2, INVALID_TIMER);
 				}
 			}
 			break;
 
 		case SC_CONCENTRATION:
-			if (sc->data[SC_ENDURE] && !sc->data[SC_ENDURE]->val4)
+			if (sc->getSCE(SC_ENDURE) && !sc->getSCE(SC_ENDURE)->val4)
 				status_change_end(bl, SC_ENDURE, INVALID_TIMER);
 			break;
 		case SC_BERSERK:
-			if(status->hp > 200 && sc && sc->data[SC__BLOODYLUST]) {
+			if(status->hp > 200 && sc && sc->getSCE(SC__BLOODYLUST)) {
 				status_percent_heal(bl, 100, 0);
 				status_change_end(bl, SC__BLOODYLUST, INVALID_TIMER);
 			} else if (status->hp > 100 && sce->val2) // If val2 is removed, no HP penalty (dispelled?) [Skotlex]
 				status_set_hp(bl, 100, 0);
-			if(sc->data[SC_ENDURE] && sc->data[SC_ENDURE]->val4) {
-				sc->data[SC_ENDURE]->val4 = 0;
+			if(sc->getSCE(SC_ENDURE) && sc->getSCE(SC_ENDURE)->val4) {
+				sc->getSCE(SC_ENDURE)->val4 = 0;
 				status_change_end(bl, SC_ENDURE, INVALID_TIMER);
 			}
 			sc_start4(bl, bl, SC_REGENERATION, 100, 10,0,0,(RGN_HP|RGN_SP), skill_get_time(LK_BERSERK, sce->val1));
@@ -13789,12 +13855,12 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 			if( sce->val2 ) {
 				struct block_list* tbl = map_id2bl(sce->val2);
 				sce->val2 = 0;
-				if( tbl && (sc = status_get_sc(tbl)) && sc->data[SC_STOP] && sc->data[SC_STOP]->val2 == bl->id )
+				if( tbl && (sc = status_get_sc(tbl)) && sc->getSCE(SC_STOP) && sc->getSCE(SC_STOP)->val2 == bl->id )
 					status_change_end(tbl, SC_STOP, INVALID_TIMER);
 			}
 			break;
 		case SC_TENSIONRELAX:
-			if (sc && (sc->data[SC_WEIGHT50] || sc->data[SC_WEIGHT90]))
+			if (sc && (sc->getSCE(SC_WEIGHT50) || sc->getSCE(SC_WEIGHT90)))
 				status_get_regen_data(bl)->state.overweight = 1; // Add the overweight flag back
 			break;
 		case SC_MONSTER_TRANSFORM:
@@ -13868,7 +13934,7 @@ int status_change_end_(struct block_list* bl, enum sc_type type, int tid, const
 				struct block_list *src = map_id2bl(sce->val2);
 				struct status_change *sc2 = status_get_sc(src);
 
-				if( sc2 && sc2->data[SC_CURSEDCIRCLE_ATKER] && --(sc2->data[SC_CURSEDCIRCLE_ATKER]->val2) == 0 ) {
+				if( sc2 && sc2->getSCE(SC_CURSEDCIRCLE_ATKER) && --(sc2->getSCE(SC_CURSEDCIRCLE_ATKER)->val2) == 0 ) {
 					clif_bladestop(bl, sce->val2, 0);
 					status_change_end(src, SC_CURSEDCIRCLE_ATKER, INVALID_TIMER);
 				}
@@ -14281,7 +14347,7 @@ TIMER_FUNC(status_change_timer){
 		return 0;
 	}
 	
-	struct status_change_entry * const sce = sc->data[type];
+	struct status_change_entry * const sce = sc->getSCE(type);
 	if(!sce) {
 		ShowDebug("status_change_timer: Null pointer id: %d data: %" PRIdPTR " bl-type: %d\n", id, data, bl->type);
 		return 0;
@@ -14309,9 +14375,9 @@ TIMER_FUNC(status_change_timer){
 		if(!status_charge(bl, 0, sce->val4))
 			break; // Not enough SP to continue.
 
-		if (!sc->data[SC_CHASEWALK2]) {
+		if (!sc->getSCE(SC_CHASEWALK2)) {
 			sc_start(bl,bl, SC_CHASEWALK2,100,1<<(sce->val1-1),
-				(t_tick)(sc->data[SC_SPIRIT] && sc->data[SC_SPIRIT]->val2 == SL_ROGUE?10:1) // SL bonus -> x10 duration
+				(t_tick)(sc->getSCE(SC_SPIRIT) && sc->getSCE(SC_SPIRIT)->val2 == SL_ROGUE?10:1) // SL bonus -> x10 duration
 				*skill_get_time2(status_sc2skill(type),sce->val1));
 		}
 		sc_timer_next(sce->val2+tick);
@@ -14360,7 +14426,7 @@ TIMER_FUNC(status_change_timer){
 		if (sc->opt1 == OPT1_STONEWAIT && sce->val4) {
 			sce->val3 = 0; //Incubation time used up
 			unit_stop_attack(bl);
-			if (sc->data[SC_DANCING]) {
+			if (sc->getSCE(SC_DANCING)) {
 				unit_stop_walking(bl, 1);
 				status_change_end(bl, SC_DANCING, INVALID_TIMER);
 			}
@@ -14379,7 +14445,7 @@ TIMER_FUNC(status_change_timer){
 
 	case SC_POISON:
 	case SC_DPOISON:
-		if (sce->val4 >= 0 && !sc->data[SC_SLOWPOISON]) {
+		if (sce->val4 >= 0 && !sc->getSCE(SC_SLOWPOISON)) {
 			unsigned int damage = 0;
 			if (sd)
 				damage = (type == SC_DPOISON) ? 2 + status->max_hp / 50 : 2 + status->max_hp * 3 / 200;
@@ -14435,7 +14501,7 @@ TIMER_FUNC(status_change_timer){
 			if (damage > 0) { // 3% Damage each 4 seconds
 				map_freeblock_lock();
 				status_zap(bl, damage, 0);
-				flag = !sc->data[type]; // Killed? Should not
+				flag = !sc->getSCE(type); // Killed? Should not
 				map_freeblock_unlock();
 			}
 
@@ -14593,7 +14659,7 @@ TIMER_FUNC(status_change_timer){
 			}
 			if( s != 0 && sce->val3 % s == 0 ) {
 #ifndef RENEWAL
-				if (sc->data[SC_LONGING])
+				if (sc->getSCE(SC_LONGING))
 					sp*= 3;
 #endif
 				if (!status_charge(bl, 0, sp))
@@ -14667,7 +14733,7 @@ TIMER_FUNC(status_change_timer){
 		break;
 
 	case SC_BLIND:
-		if(sc->data[SC_FOGWALL]) { // Blind lasts forever while you are standing on the fog.
+		if(sc->getSCE(SC_FOGWALL)) { // Blind lasts forever while you are standing on the fog.
 			sc_timer_next(5000+tick);
 			return 0;
 		}
@@ -14705,7 +14771,7 @@ TIMER_FUNC(status_change_timer){
 	case SC_RENOVATIO:
 		if( --(sce->val4) >= 0 ) {
 			int heal = status->max_hp * (sce->val1 + 4) / 100;
-			if( sc && sc->data[SC_AKAITSUKI] && heal )
+			if( sc && sc->getSCE(SC_AKAITSUKI) && heal )
 				heal = ~heal + 1;
 			status_heal(bl, heal, 0, 3);
 			sc_timer_next(5000 + tick);
@@ -14786,11 +14852,11 @@ TIMER_FUNC(status_change_timer){
 			int hp = 0;
 			struct status_change *ssc = status_get_sc(map_id2bl(sce->val2));
 
-			if (ssc && ssc->data[SC_HEATER_OPTION])
+			if (ssc && ssc->getSCE(SC_HEATER_OPTION))
 				hp = status->max_hp * 3 * sce->val1 / 100;
 			else
 				hp = status->max_hp * sce->val1 / 100;
-			if (sc && sc->data[SC_AKAITSUKI] && hp)
+			if (sc && sc->getSCE(SC_AKAITSUKI) && hp)
 				hp = ~hp + 1;
 			if (status->hp != status->max_hp)
 				status_heal(bl, hp, 0, 0);
@@ -14867,7 +14933,7 @@ TIMER_FUNC(status_change_timer){
 			static std::vector<int16> limit = { 150, 200, 280, 360, 450 };
 			uint16 skill_lv = (sd ? cap_value(pc_checkskill(sd, NC_MAINFRAME), 0, (uint16)(limit.size()-1)) : 0);
 
-			if (sc && sc->data[SC_OVERHEAT])
+			if (sc && sc->getSCE(SC_OVERHEAT))
 				status_change_end(bl,SC_OVERHEAT,INVALID_TIMER);
 			if (sce->val1 > limit[skill_lv])
 				sc_start(bl, bl, SC_OVERHEAT, 100, sce->val1, 1000);
@@ -14883,7 +14949,7 @@ TIMER_FUNC(status_change_timer){
 				damage = status->hp - 1; // Do not kill, just keep you with 1 hp minimum
 			map_freeblock_lock();
 			status_fix_damage(NULL, bl, damage, clif_damage(bl, bl, tick, 0, 0, damage, 0, DMG_NORMAL, 0, false),0);
-			if (sc->data[type]) {
+			if (sc->getSCE(type)) {
 				sc_timer_next(1000 + tick);
 			}
 			map_freeblock_unlock();
@@ -14900,7 +14966,7 @@ TIMER_FUNC(status_change_timer){
 			map_freeblock_lock();
 			if (!status_charge(bl, 0, 50))
 				status_zap(bl, 0, status->sp);
-			if (sc->data[type])
+			if (sc->getSCE(type))
 				sc_timer_next(1000 + tick);
 			map_freeblock_unlock();
 			return 0;
@@ -14974,7 +15040,7 @@ TIMER_FUNC(status_change_timer){
 			map_freeblock_lock();
 			clif_damage(bl, bl, tick, 0, 0, damage, 1, DMG_MULTI_HIT_ENDURE, 0, false);
 			status_damage(src, bl, damage,0, 0, 1, 0);
-			if( sc->data[type] ) {
+			if( sc->getSCE(type) ) {
 				sc_timer_next(2000 + tick);
 			}
 			map_freeblock_unlock();
@@ -15224,7 +15290,7 @@ TIMER_FUNC(status_change_timer){
 	}
 
 	// If status has an interval and there is at least 100ms remaining time, wait for next interval
-	if(interval > 0 && sc->data[type] && sce->val4 >= 100) {
+	if(interval > 0 && sc->getSCE(type) && sce->val4 >= 100) {
 		sc_timer_next(min(sce->val4,interval)+tick);
 		sce->val4 -= interval;
 		if (dounlock)
@@ -15266,13 +15332,13 @@ int status_change_timer_sub(struct block_list* bl, va_list ap)
 		status_change_end(bl, SC_CLOAKINGEXCEED, INVALID_TIMER);
 		status_change_end(bl, SC_CAMOUFLAGE, INVALID_TIMER);
 		status_change_end(bl, SC_NEWMOON, INVALID_TIMER);
-		if (tsc && tsc->data[SC__SHADOWFORM] && (sce && sce->val4 > 0 && sce->val4%2000 == 0) && // For every 2 seconds do the checking
-			rnd()%100 < 100 - tsc->data[SC__SHADOWFORM]->val1 * 10) // [100 - (Skill Level x 10)] %
+		if (tsc && tsc->getSCE(SC__SHADOWFORM) && (sce && sce->val4 > 0 && sce->val4%2000 == 0) && // For every 2 seconds do the checking
+			rnd()%100 < 100 - tsc->getSCE(SC__SHADOWFORM)->val1 * 10) // [100 - (Skill Level x 10)] %
 				status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 		break;
 	case SC_RUWACH: // Reveal hidden target and deal little dammages if enemy
-		if (tsc && (tsc->data[SC_HIDING] || tsc->data[SC_CLOAKING] ||
-				tsc->data[SC_CAMOUFLAGE] || tsc->data[SC_NEWMOON] || tsc->data[SC_CLOAKINGEXCEED])) {
+		if (tsc && (tsc->getSCE(SC_HIDING) || tsc->getSCE(SC_CLOAKING) ||
+				tsc->getSCE(SC_CAMOUFLAGE) || tsc->getSCE(SC_NEWMOON) || tsc->getSCE(SC_CLOAKINGEXCEED))) {
 			status_change_end(bl, SC_HIDING, INVALID_TIMER);
 			status_change_end(bl, SC_CLOAKING, INVALID_TIMER);
 			status_change_end(bl, SC_CAMOUFLAGE, INVALID_TIMER);
@@ -15281,8 +15347,8 @@ int status_change_timer_sub(struct block_list* bl, va_list ap)
 			if(battle_check_target( src, bl, BCT_ENEMY ) > 0)
 				skill_attack(BF_MAGIC,src,src,bl,AL_RUWACH,1,tick,0);
 		}
-		if (tsc && tsc->data[SC__SHADOWFORM] && (sce && sce->val4 > 0 && sce->val4%2000 == 0) && // For every 2 seconds do the checking
-			rnd()%100 < 100 - tsc->data[SC__SHADOWFORM]->val1 * 10 ) { // [100 - (Skill Level x 10)] %
+		if (tsc && tsc->getSCE(SC__SHADOWFORM) && (sce && sce->val4 > 0 && sce->val4%2000 == 0) && // For every 2 seconds do the checking
+			rnd()%100 < 100 - tsc->getSCE(SC__SHADOWFORM)->val1 * 10 ) { // [100 - (Skill Level x 10)] %
 				status_change_end(bl, SC__SHADOWFORM, INVALID_TIMER);
 				if (battle_check_target(src, bl, BCT_ENEMY) > 0)
 					skill_attack(BF_MAGIC, src, src, bl, status_sc2skill(type), 1, tick, 0);
@@ -15308,14 +15374,14 @@ int status_change_timer_sub(struct block_list* bl, va_list ap)
 		break;
 	case SC_CLOSECONFINE:
 		// Lock char has released the hold on everyone...
-		if (tsc && tsc->data[SC_CLOSECONFINE2] && tsc->data[SC_CLOSECONFINE2]->val2 == src->id) {
-			tsc->data[SC_CLOSECONFINE2]->val2 = 0;
+		if (tsc && tsc->getSCE(SC_CLOSECONFINE2) && tsc->getSCE(SC_CLOSECONFINE2)->val2 == src->id) {
+			tsc->getSCE(SC_CLOSECONFINE2)->val2 = 0;
 			status_change_end(bl, SC_CLOSECONFINE2, INVALID_TIMER);
 		}
 		break;
 	case SC_CURSEDCIRCLE_TARGET:
-		if( tsc && tsc->data[SC_CURSEDCIRCLE_TARGET] && tsc->data[SC_CURSEDCIRCLE_TARGET]->val2 == src->id ) {
-			clif_bladestop(bl, tsc->data[SC_CURSEDCIRCLE_TARGET]->val2, 0);
+		if( tsc && tsc->getSCE(SC_CURSEDCIRCLE_TARGET) && tsc->getSCE(SC_CURSEDCIRCLE_TARGET)->val2 == src->id ) {
+			clif_bladestop(bl, tsc->getSCE(SC_CURSEDCIRCLE_TARGET)->val2, 0);
 			status_change_end(bl, type, INVALID_TIMER);
 		}
 		break;
@@ -15347,7 +15413,7 @@ void status_change_clear_buffs(struct block_list* bl, uint8 type)
 			status_change_end(bl, (sc_type)i, INVALID_TIMER);
 
 	for( i = SC_COMMON_MAX+1; i < SC_MAX; i++ ) {
-		if(!sc->data[i])
+		if(!sc->getSCE(i))
 			continue;
 
 		switch (i) {
@@ -15543,7 +15609,7 @@ void status_change_clear_buffs(struct block_list* bl, uint8 type)
 			case SC_SATURDAYNIGHTFEVER:
 				if (!(type&SCCB_BUFFS))
 					continue;
-				sc->data[i]->val2 = 0;
+				sc->getSCE(i)->val2 = 0;
 				break;
 			default:
 				if (!(type&SCCB_BUFFS))
@@ -15598,10 +15664,10 @@ int status_change_spread(struct block_list *src, struct block_list *bl, bool typ
 		return 0;
 
 	for( i = SC_COMMON_MIN; i < SC_MAX; i++ ) {
-		if( !sc->data[i] || i == SC_COMMON_MAX )
+		if( !sc->getSCE(i) || i == SC_COMMON_MAX )
 			continue;
-		if (sc->data[i]->timer != INVALID_TIMER) {
-			timer = get_timer(sc->data[i]->timer);
+		if (sc->getSCE(i)->timer != INVALID_TIMER) {
+			timer = get_timer(sc->getSCE(i)->timer);
 			if (timer == NULL || timer->func != status_change_timer || DIFF_TICK(timer->tick, tick) < 0)
 				continue;
 		}
@@ -15634,7 +15700,7 @@ int status_change_spread(struct block_list *src, struct block_list *bl, bool typ
 			case SC_FEAR:
 			case SC_FREEZING:
 			case SC_VENOMBLEED:
-				if (sc->data[i]->timer != INVALID_TIMER)
+				if (sc->getSCE(i)->timer != INVALID_TIMER)
 					data.tick = DIFF_TICK(timer->tick, tick);
 				else
 					data.tick = INFINITE_TICK;
@@ -15650,8 +15716,8 @@ int status_change_spread(struct block_list *src, struct block_list *bl, bool typ
 			case SC_DPOISON:
 			case SC_BLEEDING:
 			case SC_BURNING:
-				if (sc->data[i]->timer != INVALID_TIMER)
-					data.tick = DIFF_TICK(timer->tick, tick) + sc->data[i]->val4;
+				if (sc->getSCE(i)->timer != INVALID_TIMER)
+					data.tick = DIFF_TICK(timer->tick, tick) + sc->getSCE(i)->val4;
 				else
 					data.tick = INFINITE_TICK;
 				break;
@@ -15659,10 +15725,10 @@ int status_change_spread(struct block_list *src, struct block_list *bl, bool typ
 				continue;
 		}
 		if( i ) {
-			data.val1 = sc->data[i]->val1;
-			data.val2 = sc->data[i]->val2;
-			data.val3 = sc->data[i]->val3;
-			data.val4 = sc->data[i]->val4;
+			data.val1 = sc->getSCE(i)->val1;
+			data.val2 = sc->getSCE(i)->val2;
+			data.val3 = sc->getSCE(i)->val3;
+			data.val4 = sc->getSCE(i)->val4;
 			status_change_start(src,bl,(sc_type)i,10000,data.val1,data.val2,data.val3,data.val4,data.tick,SCSTART_NOAVOID|SCSTART_NOTICKDEF|SCSTART_NORATEDEF);
 			flag = 1;
 		}
@@ -15707,7 +15773,7 @@ static int status_natural_heal(struct block_list* bl, va_list args)
 
 	if (flag && (
 		status_isdead(bl) ||
-		(sc && (sc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK) || sc->data[SC__INVISIBILITY]))
+		(sc && (sc->option&(OPTION_HIDE|OPTION_CLOAK|OPTION_CHASEWALK) || sc->getSCE(SC__INVISIBILITY)))
 	))
 		flag = RGN_NONE;
 
@@ -15803,7 +15869,7 @@ static int status_natural_heal(struct block_list* bl, va_list args)
 			rate *= 2;
 #ifdef RENEWAL
 		if (bl->type == BL_PC && (((TBL_PC*)bl)->class_&MAPID_UPPERMASK) == MAPID_MONK &&
-			sc && sc->data[SC_EXPLOSIONSPIRITS] && (!sc->data[SC_SPIRIT] || sc->data[SC_SPIRIT]->val2 != SL_MONK))
+			sc && sc->getSCE(SC_EXPLOSIONSPIRITS) && (!sc->getSCE(SC_SPIRIT) || sc->getSCE(SC_SPIRIT)->val2 != SL_MONK))
 			rate /= 2; // Tick is doubled in Fury state
 #endif
 		regen->tick.sp += rate;
@@ -15924,7 +15990,7 @@ void status_change_clear_onChangeMap(struct block_list *bl, struct status_change
 		bool mapIsTE = mapdata_flag_gvg2_te(mapdata);
 
 		for (i = 0; i < SC_MAX; i++) {
-			if (!sc->data[i] || !SCDisabled[i])
+			if (!sc->getSCE(i) || !SCDisabled[i])
 				continue;
 
 			if (status_change_isDisabledOnMap_((sc_type)i, mapIsVS, mapIsPVP, mapIsGVG, mapIsBG, mapdata->zone, mapIsTE))
@@ -2706,6 +2706,9 @@ struct status_change_entry {
 	int val1,val2,val3,val4;
 };
 
+/// Amount of status changes a unit can have before its entries are moved to the heap
+#define STATUS_CHANGE_INLINE 8
+
 ///Status change
 struct status_change {
 	unsigned int option;// effect state (bitfield)
@@ -2729,7 +2732,40 @@ struct status_change {
 #ifndef RENEWAL
 	unsigned char sg_counter; //Storm gust counter (previous hits from storm gust)
 #endif
-	struct status_change_entry *data[SC_MAX];
+
+	/// Active status changes, only a handful per unit.
+	/// The bitmap answers the lookups of inactive status changes, the active ones are
+	/// searched in a small array, which is moved to the heap when it outgrows its inline storage.
+	/// Everything is valid when zeroed, like done by status_change_init.
+	uint32 sce_bits[(SC_MAX + 31) / 32];
+	uint16 sce_count; // Amount of active status changes
+	uint16 sce_max; // Capacity of the heap arrays, 0 while the inline arrays are used
+	uint16* sce_heap_types;
+	struct status_change_entry** sce_heap_entries;
+	uint16 sce_inline_types[STATUS_CHANGE_INLINE];
+	struct status_change_entry* sce_inline_entries[STATUS_CHANGE_INLINE];
+
+	/**
+	 * Returns the entry of an active status change.
+	 * @param type: Status change (SC_*)
+	 * @return Entry or nullptr if the status change is not active
+	 */
+	struct status_change_entry* getSCE(int type) const {
+		if( type < 0 || type >= SC_MAX || !(this->sce_bits[type >> 5] & (1U << (type & 31))) )
+			return nullptr;
+
+		const uint16* types = this->sce_max ? this->sce_heap_types : this->sce_inline_types;
+
+		for( uint16 i = 0; i < this->sce_count; i++ ){
+			if( types[i] == type )
+				return this->sce_max ? this->sce_heap_entries[i] : this->sce_inline_entries[i];
+		}
+
+		return nullptr;
+	}
+
+	void addSCE(enum sc_type type, struct status_change_entry* entry);
+	void removeSCE(enum sc_type type);
 };
 
 /// Statuses that are cancelled/disabled while on Madogear
@@ -20,7 +20,9 @@
 std::string grf_list_file = "conf/grf-files.txt";
 std::string map_list_file = "map_index.txt";
 std::string map_cache_file;
+std::string map_cache_flat_file;
 int rebuild = 0;
+int flat = 1;
 
 FILE *map_cache_fp;
 
@@ -47,6 +49,35 @@ struct map_info {
 	int32 len;
 };
 
+#define MAP_CACHE_FLAT_MAGIC 0x464d4152 // "RAMF", also detects a different byte order
+#define MAP_CACHE_FLAT_VERSION 1
+#define MAP_CACHE_FLAT_ALIGN 4096
+
+// Terrain flags of the map-server, in the order of its cell_t enum
+enum flat_cell_flag {
+	FLAT_CELL_WALKABLE,
+	FLAT_CELL_SHOOTABLE,
+	FLAT_CELL_WATER,
+	FLAT_CELL_MAX
+};
+
+// This is the main header found at the very beginning of the flat map cache
+struct flat_header {
+	uint32 magic;
+	uint32 version;
+	uint32 map_count;
+	uint32 source_size;
+	uint64 source_hash;
+};
+
+// This is the entry of a map in the directory following the header of the flat map cache
+struct flat_map_info {
+	char name[MAP_NAME_LENGTH];
+	int16 xs;
+	int16 ys;
+	uint32 offset;
+};
+
 
 // Reads a map from GRF's GAT and RSW files
 int read_map(char *name, struct map_data *m)
@@ -152,6 +183,137 @@ int find_map(char *name)
 	return 0;
 }
 
+// Sets the terrain flags of a cell in the bitplanes, like map_setgatcellp of the map-server does
+void set_flat_cell(uint64 *planes, int16 xs, int16 ys, int16 x, int16 y, unsigned char gat)
+{
+	size_t words = (xs + 63) / 64;
+	size_t word = (size_t)y * words + (x >> 6);
+	uint64 bit = (uint64)1 << (x & 63);
+	bool walkable, shootable, water;
+
+	switch (gat) {
+		case 0: walkable = true;  shootable = true;  water = false; break; // walkable ground
+		case 1: walkable = false; shootable = false; water = false; break; // non-walkable ground
+		case 2: walkable = true;  shootable = true;  water = false; break; // ???
+		case 3: walkable = true;  shootable = true;  water = true;  break; // walkable water
+		case 4: walkable = true;  shootable = true;  water = false; break; // ???
+		case 5: walkable = false; shootable = true;  water = false; break; // gap (snipable)
+		case 6: walkable = true;  shootable = true;  water = false; break; // ???
+		default: walkable = shootable = water = false; break;
+	}
+
+	if (walkable)
+		planes[FLAT_CELL_WALKABLE * ys * words + word] |= bit;
+	if (shootable)
+		planes[FLAT_CELL_SHOOTABLE * ys * words + word] |= bit;
+	if (water)
+		planes[FLAT_CELL_WATER * ys * words + word] |= bit;
+}
+
+// Writes the flat map cache, which holds the maps of the map cache as uncompressed bitplanes
+// that the map-server can map into memory and use as they are.
+int write_flat_cache(const std::string &source, const std::string &target)
+{
+	FILE *fp;
+	unsigned char *buffer;
+	size_t size;
+
+	if ((fp = fopen(source.c_str(), "rb")) == NULL) {
+		ShowError("Failure when opening map cache file %s\n", source.c_str());
+		return 0;
+	}
+
+	fseek(fp, 0, SEEK_END);
+	size = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	buffer = (unsigned char *)aMalloc(size);
+
+	if (fread(buffer, 1, size, fp) != size || size < sizeof(struct main_header)) {
+		ShowError("Could not read map cache file %s\n", source.c_str());
+		aFree(buffer);
+		fclose(fp);
+		return 0;
+	}
+
+	fclose(fp);
+
+	struct flat_header flat_header;
+
+	flat_header.magic = MAP_CACHE_FLAT_MAGIC;
+	flat_header.version = MAP_CACHE_FLAT_VERSION;
+	flat_header.map_count = GetUShort(buffer + 4);
+	flat_header.source_size = (uint32)size;
+	flat_header.source_hash = 14695981039346656037ULL;
+
+	for (size_t i = 0; i < size; i++) {
+		flat_header.source_hash ^= buffer[i];
+		flat_header.source_hash *= 1099511628211ULL;
+	}
+
+	if ((fp = fopen(target.c_str(), "wb")) == NULL) {
+		ShowError("Failure when opening flat map cache file %s\n", target.c_str());
+		aFree(buffer);
+		return 0;
+	}
+
+	std::vector<struct flat_map_info> directory(flat_header.map_count);
+	unsigned char *p = buffer + sizeof(struct main_header);
+	unsigned long offset = sizeof(struct flat_header) + flat_header.map_count * sizeof(struct flat_map_info);
+	char padding[MAP_CACHE_FLAT_ALIGN] = {};
+
+	// Leave room for the header and the directory, they are written last
+	fseek(fp, offset, SEEK_SET);
+
+	for (uint32 i = 0; i < flat_header.map_count; i++) {
+		struct flat_map_info &info = directory[i];
+		unsigned long len = GetULong(p + MAP_NAME_LENGTH + 4);
+		unsigned long num_cells;
+
+		memcpy(info.name, p, MAP_NAME_LENGTH);
+		info.xs = (int16)GetUShort(p + MAP_NAME_LENGTH);
+		info.ys = (int16)GetUShort(p + MAP_NAME_LENGTH + 2);
+		num_cells = (unsigned long)info.xs * (unsigned long)info.ys;
+
+		if (info.xs <= 0 || info.ys <= 0) {
+			ShowWarning("Map '" CL_WHITE "%.*s" CL_RESET "' has an invalid size, it is not added to the flat map cache.\n", MAP_NAME_LENGTH, info.name);
+			info.xs = info.ys = 0;
+			info.offset = 0;
+			p += sizeof(struct map_info) + len;
+			continue;
+		}
+
+		std::vector<unsigned char> cells(num_cells);
+
+		decode_zip(cells.data(), &num_cells, p + sizeof(struct map_info), len);
+		p += sizeof(struct map_info) + len;
+
+		// Every map starts on a new page, so the pages of a map are only copied when it is changed
+		fwrite(padding, 1, (MAP_CACHE_FLAT_ALIGN - offset % MAP_CACHE_FLAT_ALIGN) % MAP_CACHE_FLAT_ALIGN, fp);
+		offset += (MAP_CACHE_FLAT_ALIGN - offset % MAP_CACHE_FLAT_ALIGN) % MAP_CACHE_FLAT_ALIGN;
+		info.offset = offset;
+
+		size_t words = (size_t)FLAT_CELL_MAX * info.ys * ((info.xs + 63) / 64);
+		std::vector<uint64> planes(words, 0);
+
+		for (unsigned long xy = 0; xy < num_cells; xy++)
+			set_flat_cell(planes.data(), info.xs, info.ys, (int16)(xy % info.xs), (int16)(xy / info.xs), cells[xy]);
+
+		fwrite(planes.data(), sizeof(uint64), words, fp);
+		offset += words * sizeof(uint64);
+	}
+
+	fseek(fp, 0, SEEK_SET);
+	fwrite(&flat_header, sizeof(struct flat_header), 1, fp);
+	fwrite(directory.data(), sizeof(struct flat_map_info), directory.size(), fp);
+	fclose(fp);
+
+	aFree(buffer);
+
+	ShowInfo("%d maps now in flat map cache %s\n", flat_header.map_count, target.c_str());
+
+	return 1;
+}
+
 // Cuts the extension from a map name
 char *remove_extension(char *mapname)
 {
@@ -179,7 +341,12 @@ void process_args(int argc, char *argv[])
 		} else if(strcmp(argv[i], "-cache") == 0) {
 			if(++i < argc)
 				map_cache_file = argv[i];
-		} else if(strcmp(argv[i], "-rebuild") == 0)
+		} else if(strcmp(argv[i], "-flat") == 0) {
+			if(++i < argc)
+				map_cache_flat_file = argv[i];
+		} else if(strcmp(argv[i], "-noflat") == 0)
+			flat = 0;
+		else if(strcmp(argv[i], "-rebuild") == 0)
 			rebuild = 1;
 	}
 
@@ -189,6 +356,7 @@ int do_init(int argc, char** argv)
 {
 	/* setup pre-defined, #define-dependant */
 	map_cache_file = std::string(db_path) + "/" + std::string(DBPATH) + "map_cache.dat";
+	map_cache_flat_file = std::string(db_path) + "/" + std::string(DBPATH) + "map_cache_flat.dat";
 
 	// Process the command-line arguments
 	process_args(argc, argv);
@@ -215,6 +383,16 @@ int do_init(int argc, char** argv)
 		exit(EXIT_FAILURE);
 	}
 
+	// Initialize the main header
+	if (rebuild) {
+		header.file_size = sizeof(struct main_header);
+		header.map_count = 0;
+	} else {
+		if (fread(&header, sizeof(struct main_header), 1, map_cache_fp) != 1) { printf("An error as occured while reading map_cache_fp \n"); }
+		header.file_size = GetULong((unsigned char *)&(header.file_size));
+		header.map_count = GetUShort((unsigned char *)&(header.map_count));
+	}
+
 	// Open the map list
 	FILE *list;
 	std::vector<std::string> directories = { std::string(db_path) + "/",  std::string(db_path) + "/" + std::string(DBIMPORT) + "/" };
@@ -229,16 +407,6 @@ int do_init(int argc, char** argv)
 			exit(EXIT_FAILURE);
 		}
 
-		// Initialize the main header
-		if (rebuild) {
-			header.file_size = sizeof(struct main_header);
-			header.map_count = 0;
-		} else {
-			if (fread(&header, sizeof(struct main_header), 1, map_cache_fp) != 1) { printf("An error as occured while reading map_cache_fp \n"); }
-			header.file_size = GetULong((unsigned char *)&(header.file_size));
-			header.map_count = GetUShort((unsigned char *)&(header.map_count));
-		}
-
 		// Read and process the map list
 		char line[1024];
 
@@ -285,6 +453,9 @@ int do_init(int argc, char** argv)
 
 	ShowInfo("%d maps now in cache\n", header.map_count);
 
+	if (flat && !write_flat_cache(map_cache_file, map_cache_flat_file))
+		return 1;
+
 	return 0;
 }
 
@@ -0,0 +1,262 @@
+// Copyright (c) rAthena Dev Teams - Licensed under GNU GPL
+// For more information, see LICENCE in the main folder
+
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <vector>
+
+#include "../common/cbasetypes.hpp"
+#include "../common/core.hpp"
+#include "../common/showmsg.hpp"
+#include "../common/timer.hpp"
+
+// A scheduling operation, either read from a trace or generated
+struct s_timer_event {
+	char op; // A(dd), D(elete) or S(et tick)
+	t_tick now; // tick at which the operation was done
+	int tid; // timer id inside the trace
+	t_tick tick; // expiration tick for A and S
+	int interval; // 0 for single-use timers
+};
+
+std::string trace_file;
+int synthetic_units = 10000;
+int synthetic_duration = 60000;
+
+std::vector<s_timer_event> events;
+// maps the timer ids of the trace to the ids of the replay
+std::vector<int> replay_tid;
+uint64 executed = 0;
+uint64 stale = 0;
+
+/// Timer function of all replayed timers, the data holds the timer id of the trace.
+static TIMER_FUNC(timerbench_timer){
+	executed++;
+
+	const struct TimerData* td = get_timer(tid);
+
+	if( td != nullptr && td->type&TIMER_ONCE_AUTODEL && replay_tid[data] == tid )
+		replay_tid[data] = INVALID_TIMER; // released after this call
+
+	return 0;
+}
+
+/// Reads a trace written by a server that was compiled with TIMER_TRACE.
+static bool timerbench_read_trace(const char* filename){
+	FILE* fp = fopen(filename, "r");
+
+	if( fp == nullptr ){
+		ShowError("Failed to open timer trace '%s'.\n", filename);
+		return false;
+	}
+
+	char line[256];
+	int lines = 0;
+
+	while( fgets(line, sizeof(line), fp) ){
+		s_timer_event event = {};
+
+		lines++;
+		event.op = line[0];
+
+		switch( event.op ){
+			case 'A':
+				if( sscanf(line + 1, "%" SCNd64 " %d %" SCNd64 " %d", &event.now, &event.tid, &event.tick, &event.interval) == 4 ){
+					events.push_back(event);
+					continue;
+				}
+				break;
+			case 'D':
+				if( sscanf(line + 1, "%" SCNd64 " %d", &event.now, &event.tid) == 2 ){
+					events.push_back(event);
+					continue;
+				}
+				break;
+			case 'S':
+				if( sscanf(line + 1, "%" SCNd64 " %d %" SCNd64, &event.now, &event.tid, &event.tick) == 3 ){
+					events.push_back(event);
+					continue;
+				}
+				break;
+		}
+
+		ShowWarning("Skipping invalid line %d in timer trace '%s'.\n", lines, filename);
+	}
+
+	fclose(fp);
+
+	return true;
+}
+
+/// Generates a workload that resembles a busy map-server.
+/// Every unit walks with a timer per step, attacks now and then and
+/// gets status changes, which are often removed before they expire.
+/// A few interval timers run on top of that, like skill units do.
+static void timerbench_generate(void){
+	std::mt19937 rnd(1);
+	std::vector<t_tick> next_walk(synthetic_units), next_attack(synthetic_units), next_status(synthetic_units);
+	std::vector<int> walk_tid(synthetic_units, INVALID_TIMER), status_tid(synthetic_units, INVALID_TIMER);
+	std::vector<int> free_tids;
+	int tid_max = 0;
+
+	auto acquire = [&]() -> int {
+		if( free_tids.empty() )
+			return tid_max++;
+
+		int tid = free_tids.back();
+
+		free_tids.pop_back();
+		return tid;
+	};
+
+	for( int i = 0; i < synthetic_units; i++ ){
+		next_walk[i] = rnd() % 1000;
+		next_attack[i] = rnd() % 5000;
+		next_status[i] = rnd() % 10000;
+	}
+
+	for( int i = 0; i < synthetic_units / 50; i++ )
+		events.push_back({ 'A', 0, acquire(), 100 + (t_tick)(rnd() % 100), 100 });
+
+	for( t_tick now = 0; now < synthetic_duration; now += 10 ){
+		for( int i = 0; i < synthetic_units; i++ ){
+			if( now >= next_walk[i] ){
+				// the previous step already expired, so its id is free again
+				if( walk_tid[i] != INVALID_TIMER )
+					free_tids.push_back(walk_tid[i]);
+				walk_tid[i] = acquire();
+				events.push_back({ 'A', now, walk_tid[i], now + 150, 0 });
+				next_walk[i] = now + ((rnd() % 4) ? 150 : 2000 + rnd() % 5000);
+			}
+
+			if( now >= next_attack[i] ){
+				int tid = acquire();
+
+				events.push_back({ 'A', now, tid, now + 500, 0 });
+				free_tids.push_back(tid);
+				next_attack[i] = now + 1000 + rnd() % 4000;
+			}
+
+			if( now >= next_status[i] ){
+				if( status_tid[i] != INVALID_TIMER && rnd() % 2 ){
+					events.push_back({ 'D', now, status_tid[i], 0, 0 });
+					free_tids.push_back(status_tid[i]);
+				}
+				status_tid[i] = acquire();
+				events.push_back({ 'A', now, status_tid[i], now + 10000 + (t_tick)(rnd() % 600000), 0 });
+				next_status[i] = now + 5000 + rnd() % 20000;
+			}
+		}
+	}
+}
+
+/// Replays all events like the main loop of a server would.
+static void timerbench_replay(void){
+	t_tick offset = gettick() - events.front().now;
+	t_tick now = events.front().now + offset;
+	t_tick next = do_timer(now);
+
+	for( const s_timer_event& event : events ){
+		t_tick event_now = event.now + offset;
+
+		// advance in the same steps as the main loop of a server
+		while( DIFF_TICK(now, event_now) < 0 ){
+			now = i64min(now + next, event_now);
+			next = do_timer(now);
+		}
+
+		if( event.tid >= (int)replay_tid.size() )
+			replay_tid.resize(event.tid + 1, INVALID_TIMER);
+
+		int& tid = replay_tid[event.tid];
+
+		switch( event.op ){
+			case 'A':
+				if( event.interval > 0 )
+					tid = add_timer_interval(event.tick + offset, timerbench_timer, 0, event.tid, event.interval);
+				else
+					tid = add_timer(event.tick + offset, timerbench_timer, 0, event.tid);
+				break;
+			case 'D':
+				if( tid == INVALID_TIMER ){
+					stale++;
+					break;
+				}
+				delete_timer(tid, timerbench_timer);
+				tid = INVALID_TIMER;
+				break;
+			case 'S':
+				if( tid == INVALID_TIMER ){
+					stale++;
+					break;
+				}
+				sett_tickimer(tid, event.tick + offset);
+				break;
+		}
+	}
+}
+
+static void timerbench_usage(void){
+	ShowInfo("Usage: timerbench [-trace <file>] [-units <count>] [-duration <ms>]\n");
+	ShowInfo("  -trace     replays a trace written by a server compiled with TIMER_TRACE\n");
+	ShowInfo("  -units     number of units of the synthetic workload (default: %d)\n", synthetic_units);
+	ShowInfo("  -duration  duration of the synthetic workload in ms (default: %d)\n", synthetic_duration);
+	ShowInfo("Compare the results of a build with and without ENABLE_TIMER_WHEEL.\n");
+}
+
+int do_init(int argc, char** argv){
+	for( int i = 1; i < argc; i++ ){
+		if( strcmp(argv[i], "-trace") == 0 && i + 1 < argc )
+			trace_file = argv[++i];
+		else if( strcmp(argv[i], "-units") == 0 && i + 1 < argc )
+			synthetic_units = atoi(argv[++i]);
+		else if( strcmp(argv[i], "-duration") == 0 && i + 1 < argc )
+			synthetic_duration = atoi(argv[++i]);
+		else{
+			timerbench_usage();
+			return 0;
+		}
+	}
+
+	if( !trace_file.empty() ){
+		ShowStatus("Reading timer trace '%s'...\n", trace_file.c_str());
+		if( !timerbench_read_trace(trace_file.c_str()) )
+			return 0;
+	}else{
+		ShowStatus("Generating a workload of %d units over %d ms...\n", synthetic_units, synthetic_duration);
+		timerbench_generate();
+	}
+
+	if( events.empty() ){
+		ShowError("No timer events to replay.\n");
+		return 0;
+	}
+
+#ifdef TIMER_WHEEL
+	ShowStatus("Replaying %" PRIuPTR " events with the timing wheel...\n", events.size());
+#else
+	ShowStatus("Replaying %" PRIuPTR " events with the binary heap...\n", events.size());
+#endif
+
+	timer_init();
+
+	auto start = std::chrono::steady_clock::now();
+
+	timerbench_replay();
+
+	auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+	timer_final();
+
+	ShowInfo("Executed timers: %" PRIu64 ", stale operations: %" PRIu64 "\n", executed, stale);
+	ShowInfo("Elapsed: %.3f ms (%.1f ns per event)\n", elapsed / 1000.0, elapsed * 1000.0 / events.size());
+
+	return 0;
+}
+
+void do_final(void){
+}